@@ -0,0 +1,554 @@
+# autotest/logs/spgram.gnu : auto-generated file
+reset
+set terminal png size 1200,800 enhanced font 'Verdana,10'
+set output 'autotest/logs/spgram.gnu.png'
+set autoscale y
+set ylabel 'Power Spectral Density'
+set style line 12 lc rgb '#404040' lt 0 lw 1
+set grid xtics ytics
+set grid front ls 12
+set nokey
+set xlabel 'Frequency [MHz]'
+set xrange [90.000000:110.000000]
+plot '-' u ($1*20.000000+100.000000):2 w lines lt 1 lw 2 lc rgb '#004080'
+   -0.50000000   3.27307200
+   -0.49814814   3.08578920
+   -0.49629629   2.86244774
+   -0.49444443   2.82715583
+   -0.49259260   2.96335244
+   -0.49074075   3.07214642
+   -0.48888889   3.07208061
+   -0.48703703   3.05269361
+   -0.48518518   3.10731196
+   -0.48333332   3.20427895
+   -0.48148149   3.28745604
+   -0.47962964   3.36398220
+   -0.47777778   3.41091633
+   -0.47592592   3.36530900
+   -0.47407407   3.22759676
+   -0.47222221   3.02945161
+   -0.47037038   2.80867839
+   -0.46851853   2.71599770
+   -0.46666667   2.86619210
+   -0.46481481   3.08892250
+   -0.46296296   3.18061447
+   -0.46111110   3.19254255
+   -0.45925927   3.27807641
+   -0.45740741   3.41420698
+   -0.45555556   3.46075177
+   -0.45370370   3.34857464
+   -0.45185184   3.09029698
+   -0.44999999   2.79118514
+   -0.44814816   2.65449095
+   -0.44629630   2.77825928
+   -0.44444445   3.03955746
+   -0.44259259   3.24588799
+   -0.44074073   3.29747486
+   -0.43888888   3.27900267
+   -0.43703705   3.30005145
+   -0.43518519   3.27570319
+   -0.43333334   3.15328884
+   -0.43148148   3.11955810
+   -0.42962962   3.28365374
+   -0.42777777   3.48021269
+   -0.42592591   3.57123137
+   -0.42407408   3.58302093
+   -0.42222223   3.57480335
+   -0.42037037   3.56411910
+   -0.41851851   3.53642511
+   -0.41666666   3.45958996
+   -0.41481483   3.36174703
+   -0.41296297   3.37542152
+   -0.41111112   3.55319691
+   -0.40925926   3.71863866
+   -0.40740740   3.68287659
+   -0.40555555   3.49239802
+   -0.40370369   3.34657168
+   -0.40185186   3.26451731
+   -0.40000001   3.07754159
+   -0.39814815   2.83026433
+   -0.39629629   2.85570526
+   -0.39444444   3.23223972
+   -0.39259261   3.59130907
+   -0.39074075   3.65157819
+   -0.38888890   3.46410775
+   -0.38703704   3.24773216
+   -0.38518518   3.13982964
+   -0.38333333   3.11535096
+   -0.38148147   3.07218552
+   -0.37962961   2.94955969
+   -0.37777779   2.86188412
+   -0.37592593   2.98284149
+   -0.37407407   3.20801234
+   -0.37222221   3.30756044
+   -0.37037039   3.29197025
+   -0.36851853   3.33188057
+   -0.36666667   3.45763302
+   -0.36481482   3.52133560
+   -0.36296296   3.43157291
+   -0.36111110   3.30699110
+   -0.35925925   3.32536101
+   -0.35740739   3.44571829
+   -0.35555553   3.48564124
+   -0.35370371   3.38455582
+   -0.35185185   3.22692823
+   -0.34999999   3.11694407
+   -0.34814817   3.10140800
+   -0.34629631   3.11960173
+   -0.34444445   3.03425074
+   -0.34259260   2.85353518
+   -0.34074074   2.83407307
+   -0.33888888   3.10373068
+   -0.33703703   3.39264250
+   -0.33518517   3.41900253
+   -0.33333331   3.19722438
+   -0.33148149   2.97449470
+   -0.32962963   2.92966866
+   -0.32777777   2.96234965
+   -0.32592595   2.89982820
+   -0.32407409   2.75084615
+   -0.32222223   2.70265865
+   -0.32037038   2.89842510
+   -0.31851852   3.20355988
+   -0.31666666   3.32337141
+   -0.31481481   3.12864733
+   -0.31296295   2.80670047
+   -0.31111109   2.70579219
+   -0.30925927   2.90977931
+   -0.30740741   3.15701270
+   -0.30555555   3.24614882
+   -0.30370373   3.20435476
+   -0.30185187   3.13482857
+   -0.30000001   3.06421900
+   -0.29814816   2.94398737
+   -0.29629630   2.75876641
+   -0.29444444   2.59018135
+   -0.29259259   2.49297285
+   -0.29074073   2.36909199
+   -0.28888887   2.12748551
+   -0.28703701   1.86673713
+   -0.28518519   1.80140603
+   -0.28333333   2.01815343
+   -0.28148147   2.33244991
+   -0.27962965   2.50421762
+   -0.27777779   2.50893092
+   -0.27592593   2.51634455
+   -0.27407408   2.65449548
+   -0.27222222   2.83546305
+   -0.27037036   2.89611769
+   -0.26851851   2.82054925
+   -0.26666665   2.71505928
+   -0.26481479   2.64181137
+   -0.26296297   2.56537652
+   -0.26111111   2.43017197
+   -0.25925925   2.26431274
+   -0.25740743   2.23301077
+   -0.25555557   2.46949339
+   -0.25370371   2.83569098
+   -0.25185186   3.09044886
+   -0.25000000   3.15603590
+   -0.24814814   3.11011410
+   -0.24629629   3.09086466
+   -0.24444443   3.21168327
+   -0.24259260   3.43129873
+   -0.24074075   3.56609321
+   -0.23888889   3.49075341
+   -0.23703703   3.24769473
+   -0.23518518   3.01955175
+   -0.23333332   2.98287535
+   -0.23148149   3.05270767
+   -0.22962964   2.97596455
+   -0.22777778   2.74102879
+   -0.22592592   2.62617159
+   -0.22407407   2.77391410
+   -0.22222221   2.97285271
+   -0.22037038   2.99008560
+   -0.21851853   2.84263611
+   -0.21666667   2.71155787
+   -0.21481481   2.68920398
+   -0.21296296   2.72018147
+   -0.21111110   2.72965693
+   -0.20925927   2.71670127
+   -0.20740741   2.74381518
+   -0.20555556   2.82005286
+   -0.20370370   2.87774777
+   -0.20185184   2.87076831
+   -0.19999999   2.79994130
+   -0.19814816   2.70479298
+   -0.19629630   2.66767716
+   -0.19444445   2.71658850
+   -0.19259259   2.75127196
+   -0.19074073   2.69373560
+   -0.18888888   2.61513996
+   -0.18703705   2.61592102
+   -0.18518519   2.66662621
+   -0.18333334   2.67222643
+   -0.18148148   2.65264535
+   -0.17962962   2.74742389
+   -0.17777777   2.98079348
+   -0.17592594   3.19508934
+   -0.17407408   3.27945352
+   -0.17222223   3.27029920
+   -0.17037037   3.25918865
+   -0.16851851   3.28634381
+   -0.16666666   3.30643916
+   -0.16481480   3.25383282
+   -0.16296297   3.13827729
+   -0.16111112   3.06677008
+   -0.15925926   3.12086725
+   -0.15740740   3.22911716
+   -0.15555555   3.29546595
+   -0.15370369   3.33118224
+   -0.15185186   3.34665394
+   -0.15000001   3.29741263
+   -0.14814815   3.16699529
+   -0.14629629   2.98455358
+   -0.14444444   2.84131718
+   -0.14259258   2.84871721
+   -0.14074075   2.93775892
+   -0.13888890   2.91174030
+   -0.13703704   2.75066710
+   -0.13518518   2.63862109
+   -0.13333333   2.65564704
+   -0.13148147   2.65369558
+   -0.12962964   2.55797172
+   -0.12777779   2.52741432
+   -0.12592593   2.65611625
+   -0.12407407   2.79362321
+   -0.12222221   2.84952641
+   -0.12037036   2.90412164
+   -0.11851853   2.97678423
+   -0.11666667   3.00008750
+   -0.11481482   3.01945090
+   -0.11296296   3.14126492
+   -0.11111110   3.29809546
+   -0.10925925   3.33116055
+   -0.10740742   3.22149658
+   -0.10555556   3.05020618
+   -0.10370371   2.87279749
+   -0.10185185   2.76787949
+   -0.09999999   2.84047651
+   -0.09814814   3.07332706
+   -0.09629631   3.32358241
+   -0.09444445   3.45955515
+   -0.09259260   3.42408514
+   -0.09074074   3.24399185
+   -0.08888888   3.04202819
+   -0.08703703   2.96682620
+   -0.08518520   3.02724719
+   -0.08333334   3.08898950
+   -0.08148149   3.08588505
+   -0.07962963   3.12596560
+   -0.07777777   3.29097629
+   -0.07592592   3.40404272
+   -0.07407406   3.20898271
+   -0.07222223   2.74001575
+   -0.07037038   2.44218493
+   -0.06851852   2.67205000
+   -0.06666666   3.17033172
+   -0.06481481   3.52183056
+   -0.06296295   3.55682588
+   -0.06111112   3.31450677
+   -0.05925927   2.98273540
+   -0.05740741   2.80045056
+   -0.05555555   2.82643318
+   -0.05370370   2.86562109
+   -0.05185184   2.75945067
+   -0.05000001   2.56923795
+   -0.04814816   2.41768622
+   -0.04629630   2.32810211
+   -0.04444444   2.28877258
+   -0.04259259   2.33119774
+   -0.04074073   2.48498130
+   -0.03888890   2.72195721
+   -0.03703704   3.00332332
+   -0.03518519   3.28239250
+   -0.03333333   3.43785024
+   -0.03148147   3.37590480
+   -0.02962962   3.17908168
+   -0.02777779   3.00201917
+   -0.02592593   2.85122299
+   -0.02407408   2.65440702
+   -0.02222222   2.47024369
+   -0.02037036   2.45831800
+   -0.01851851   2.62469816
+   -0.01666668   2.72284222
+   -0.01481482   2.53222680
+   -0.01296297   2.14593601
+   -0.01111111   1.94548309
+   -0.00925925   2.15224266
+   -0.00740740   2.50326896
+   -0.00555557   2.66142106
+   -0.00370371   2.62158060
+   -0.00185186   2.61952519
+    0.00000000   2.77121043
+    0.00185186   2.98356199
+    0.00370371   3.16927314
+    0.00555557   3.29797792
+    0.00740743   3.35218215
+    0.00925928   3.34978318
+    0.01111114   3.33955288
+    0.01296294   3.34718943
+    0.01481479   3.34873247
+    0.01666665   3.29366326
+    0.01851851   3.13670039
+    0.02037036   2.85235143
+    0.02222222   2.49121761
+    0.02407408   2.27005911
+    0.02592593   2.40120053
+    0.02777779   2.74394536
+    0.02962965   3.00581741
+    0.03148150   3.11923742
+    0.03333336   3.17856193
+    0.03518516   3.22641945
+    0.03703701   3.25109696
+    0.03888887   3.25782061
+    0.04074073   3.20850086
+    0.04259259   3.03714085
+    0.04444444   2.79481363
+    0.04629630   2.63375974
+    0.04814816   2.64083600
+    0.05000001   2.79196405
+    0.05185187   2.97833395
+    0.05370373   3.06470823
+    0.05555558   3.02575350
+    0.05740738   2.96444798
+    0.05925924   2.95969272
+    0.06111109   3.00671768
+    0.06296295   3.11720467
+    0.06481481   3.27282548
+    0.06666666   3.34448910
+    0.06851852   3.30347586
+    0.07037038   3.33986974
+    0.07222223   3.51168990
+    0.07407409   3.59967518
+    0.07592595   3.51293540
+    0.07777780   3.39931774
+    0.07962960   3.36232471
+    0.08148146   3.38272214
+    0.08333331   3.41547513
+    0.08518517   3.36083126
+    0.08703703   3.12459469
+    0.08888888   2.76497817
+    0.09074074   2.48057079
+    0.09259260   2.46260214
+    0.09444445   2.75012112
+    0.09629631   3.18424273
+    0.09814817   3.54387307
+    0.10000002   3.67835021
+    0.10185188   3.55262327
+    0.10370368   3.30785775
+    0.10555553   3.18434238
+    0.10740739   3.24182415
+    0.10925925   3.35335135
+    0.11111110   3.44431615
+    0.11296296   3.47031713
+    0.11481482   3.31936216
+    0.11666667   2.95185900
+    0.11851853   2.57981396
+    0.12037039   2.50574732
+    0.12222224   2.71784925
+    0.12407410   2.95931005
+    0.12592590   3.08680034
+    0.12777776   3.13382435
+    0.12962961   3.17927742
+    0.13148147   3.24018955
+    0.13333333   3.29306602
+    0.13518518   3.32684278
+    0.13703704   3.31305528
+    0.13888890   3.19201756
+    0.14074075   2.98899770
+    0.14259261   2.90748310
+    0.14444447   3.09906960
+    0.14629632   3.39685678
+    0.14814812   3.55432773
+    0.14999998   3.50749016
+    0.15185183   3.34899449
+    0.15370369   3.23490644
+    0.15555555   3.25427628
+    0.15740740   3.36717248
+    0.15925926   3.52600360
+    0.16111112   3.68867111
+    0.16296297   3.74052906
+    0.16481483   3.61327195
+    0.16666669   3.41647363
+    0.16851854   3.33113861
+    0.17037040   3.40256810
+    0.17222220   3.52402115
+    0.17407405   3.57656837
+    0.17592591   3.52865815
+    0.17777777   3.41255331
+    0.17962962   3.22836494
+    0.18148148   2.98892784
+    0.18333334   2.83568597
+    0.18518519   2.87098193
+    0.18703705   2.96237803
+    0.18888891   3.00006652
+    0.19074076   3.06479454
+    0.19259262   3.17835069
+    0.19444442   3.25450778
+    0.19629627   3.29094768
+    0.19814813   3.28877926
+    0.19999999   3.17685628
+    0.20185184   3.00163245
+    0.20370370   2.96034718
+    0.20555556   3.09757590
+    0.20740741   3.19423485
+    0.20925927   3.07469511
+    0.21111113   2.81318665
+    0.21296299   2.60149837
+    0.21481484   2.52705908
+    0.21666664   2.58936429
+    0.21851850   2.74984956
+    0.22037035   2.89755201
+    0.22222221   2.93255091
+    0.22407407   2.84133720
+    0.22592592   2.68850088
+    0.22777778   2.61157894
+    0.22962964   2.73051453
+    0.23148149   2.97663307
+    0.23333335   3.15554857
+    0.23518521   3.18082476
+    0.23703706   3.13410139
+    0.23888886   3.12719440
+    0.24074072   3.17721510
+    0.24259257   3.24494314
+    0.24444443   3.30908203
+    0.24629629   3.36782575
+    0.24814814   3.40226293
+    0.25000000   3.35562038
+    0.25185186   3.18582392
+    0.25370371   2.94892311
+    0.25555557   2.80099535
+    0.25740743   2.83994317
+    0.25925928   2.96979642
+    0.26111114   3.05685043
+    0.26296294   3.08186245
+    0.26481479   3.04881215
+    0.26666665   2.94526148
+    0.26851851   2.86140633
+    0.27037036   2.93904185
+    0.27222222   3.12597895
+    0.27407408   3.21391916
+    0.27592593   3.11898232
+    0.27777779   2.94353461
+    0.27962965   2.80030704
+    0.28148150   2.69879866
+    0.28333336   2.61840010
+    0.28518516   2.56205845
+    0.28703701   2.52958417
+    0.28888887   2.50858831
+    0.29074073   2.49808359
+    0.29259259   2.55021858
+    0.29444444   2.73257613
+    0.29629630   2.99573565
+    0.29814816   3.19030046
+    0.30000001   3.23035240
+    0.30185187   3.17356920
+    0.30370373   3.16299796
+    0.30555558   3.27749467
+    0.30740738   3.44831610
+    0.30925924   3.55135441
+    0.31111109   3.54520941
+    0.31296295   3.49513817
+    0.31481481   3.45807672
+    0.31666666   3.40357661
+    0.31851852   3.31691790
+    0.32037038   3.29290915
+    0.32222223   3.38131332
+    0.32407409   3.42443991
+    0.32592595   3.27816534
+    0.32777780   3.06022644
+    0.32962960   2.98712492
+    0.33148146   3.07197380
+    0.33333331   3.16463923
+    0.33518517   3.11809993
+    0.33703703   2.87802196
+    0.33888888   2.57020569
+    0.34074074   2.45040035
+    0.34259260   2.61323833
+    0.34444445   2.82953548
+    0.34629631   2.82178903
+    0.34814817   2.59412313
+    0.35000002   2.45058680
+    0.35185188   2.62001157
+    0.35370368   2.99115133
+    0.35555553   3.33598351
+    0.35740739   3.45799398
+    0.35925925   3.25439835
+    0.36111110   2.87591600
+    0.36296296   2.65079141
+    0.36481482   2.62812638
+    0.36666667   2.56560612
+    0.36851853   2.46416664
+    0.37037039   2.58441949
+    0.37222224   2.88809085
+    0.37407410   3.03767872
+    0.37592590   2.92535830
+    0.37777776   2.79459667
+    0.37962961   2.91153955
+    0.38148147   3.21918678
+    0.38333333   3.50347567
+    0.38518518   3.70542192
+    0.38703704   3.87057662
+    0.38888890   3.97278357
+    0.39074075   3.97721410
+    0.39259261   3.95013285
+    0.39444447   3.92775154
+    0.39629632   3.80730772
+    0.39814812   3.51284695
+    0.39999998   3.16758966
+    0.40185183   2.98655295
+    0.40370369   2.98564243
+    0.40555555   3.01611328
+    0.40740740   3.04649639
+    0.40925926   3.13050413
+    0.41111112   3.23111892
+    0.41296297   3.31605434
+    0.41481483   3.44434071
+    0.41666669   3.60815883
+    0.41851854   3.69459867
+    0.42037040   3.62700081
+    0.42222220   3.39962721
+    0.42407405   3.04148722
+    0.42592591   2.64419460
+    0.42777777   2.40645385
+    0.42962962   2.51918936
+    0.43148148   2.90579438
+    0.43333334   3.25854063
+    0.43518519   3.36541438
+    0.43703705   3.25964546
+    0.43888891   3.11833668
+    0.44074076   3.06843638
+    0.44259262   3.09105659
+    0.44444442   3.10972190
+    0.44629627   3.13642216
+    0.44814813   3.22317338
+    0.44999999   3.27878761
+    0.45185184   3.17538214
+    0.45370370   3.00243258
+    0.45555556   2.96312571
+    0.45740741   3.01819324
+    0.45925927   2.95002198
+    0.46111113   2.71375871
+    0.46296299   2.45860219
+    0.46481484   2.31713581
+    0.46666664   2.34265471
+    0.46851850   2.48751116
+    0.47037035   2.56412745
+    0.47222221   2.49104476
+    0.47407407   2.47383690
+    0.47592592   2.67085052
+    0.47777778   2.88310671
+    0.47962964   2.90205216
+    0.48148149   2.83256531
+    0.48333335   2.88357353
+    0.48518521   3.01485014
+    0.48703706   3.07342172
+    0.48888886   3.06461596
+    0.49074072   3.06615376
+    0.49259257   3.08652687
+    0.49444443   3.12063336
+    0.49629629   3.19511795
+    0.49814814   3.28535771
+e
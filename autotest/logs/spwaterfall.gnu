@@ -0,0 +1,30 @@
+#!/usr/bin/gnuplot
+reset
+set terminal png size 640,480 enhanced font 'Verdana,10'
+set output 'autotest/logs/spwaterfall.png'
+unset key
+set style line 11 lc rgb '#808080' lt 1
+set border 3 front ls 11
+set style line 12 lc rgb '#888888' lt 0 lw 1
+set grid front ls 12
+set tics nomirror out scale 0.75
+set yrange [0:799.999023]
+set ylabel 'Sample Index'
+set format y '%.0f k'
+# disable colorbar tics
+set cbtics scale 0
+set palette negative defined ( \
+    0 '#D53E4F',\
+    1 '#F46D43',\
+    2 '#FDAE61',\
+    3 '#FEE08B',\
+    4 '#E6F598',\
+    5 '#ABDDA4',\
+    6 '#66C2A5',\
+    7 '#3288BD' )
+
+set xlabel 'Frequency [MHz]'
+set xrange [90.000000:110.000000]
+set xtics 5.000000
+set title 'waterfall'
+plot 'autotest/logs/spwaterfall.bin' u ($1*20.000000+100.000000):($2*1.000000e-03):3 binary matrix with image
@@ -0,0 +1,4821 @@
+// adding null to package null from autotest/null_autotest.c:25
+// adding libliquid to package libliquid from autotest/libliquid_autotest.c:27
+// adding agc_crcf_dc_gain_control to package agc_crcf from src/agc/tests/agc_crcf_autotest.c:27
+// adding agc_crcf_scale to package agc_crcf from src/agc/tests/agc_crcf_autotest.c:58
+// adding agc_crcf_ac_gain_control to package agc_crcf from src/agc/tests/agc_crcf_autotest.c:85
+// adding agc_crcf_rssi_sinusoid to package agc_crcf from src/agc/tests/agc_crcf_autotest.c:116
+// adding agc_crcf_rssi_noise to package agc_crcf from src/agc/tests/agc_crcf_autotest.c:154
+// adding agc_crcf_squelch to package agc_crcf from src/agc/tests/agc_crcf_autotest.c:192
+// adding agc_crcf_lock to package agc_crcf from src/agc/tests/agc_crcf_autotest.c:249
+// adding agc_crcf_invalid_config to package agc_crcf from src/agc/tests/agc_crcf_autotest.c:288
+// adding agc_crcf_copy to package agc_crcf from src/agc/tests/agc_crcf_autotest.c:324
+// adding cvsd_rmse_sine to package cvsd from src/audio/tests/cvsd_autotest.c:27
+// adding cvsd_rmse_sine8 to package cvsd from src/audio/tests/cvsd_autotest.c:65
+// adding cvsd_invalid_config to package cvsd from src/audio/tests/cvsd_autotest.c:108
+// adding cbufferf to package cbuffer from src/buffer/tests/cbuffer_autotest.c:32
+// adding cbuffercf to package cbuffer from src/buffer/tests/cbuffer_autotest.c:109
+// adding cbufferf_flow to package cbuffer from src/buffer/tests/cbuffer_autotest.c:218
+// adding cbufferf_config to package cbuffer from src/buffer/tests/cbuffer_autotest.c:299
+// adding cbuffer_copy to package cbuffer from src/buffer/tests/cbuffer_autotest.c:335
+// adding wdelayf to package wdelay from src/buffer/tests/wdelay_autotest.c:27
+// adding wdelay_copy to package wdelay from src/buffer/tests/wdelay_autotest.c:89
+// adding window_config_errors to package buffer_window from src/buffer/tests/buffer_window_autotest.c:26
+// adding windowf to package buffer_window from src/buffer/tests/buffer_window_autotest.c:39
+// adding window_copy to package buffer_window from src/buffer/tests/buffer_window_autotest.c:143
+// adding dotprod_rrrf_basic to package dotprod_rrrf from src/dotprod/tests/dotprod_rrrf_autotest.c:31
+// adding dotprod_rrrf_uneven to package dotprod_rrrf from src/dotprod/tests/dotprod_rrrf_autotest.c:79
+// adding dotprod_rrrf_struct to package dotprod_rrrf from src/dotprod/tests/dotprod_rrrf_autotest.c:119
+// adding dotprod_rrrf_struct_align to package dotprod_rrrf from src/dotprod/tests/dotprod_rrrf_autotest.c:158
+// adding dotprod_rrrf_rand01 to package dotprod_rrrf from src/dotprod/tests/dotprod_rrrf_autotest.c:205
+// adding dotprod_rrrf_rand02 to package dotprod_rrrf from src/dotprod/tests/dotprod_rrrf_autotest.c:232
+// adding dotprod_rrrf_struct_lengths to package dotprod_rrrf from src/dotprod/tests/dotprod_rrrf_autotest.c:278
+// adding dotprod_rrrf_struct_vs_ordinal to package dotprod_rrrf from src/dotprod/tests/dotprod_rrrf_autotest.c:398
+// adding dotprod_crcf_rand01 to package dotprod_crcf from src/dotprod/tests/dotprod_crcf_autotest.c:29
+// adding dotprod_crcf_rand02 to package dotprod_crcf from src/dotprod/tests/dotprod_crcf_autotest.c:87
+// adding dotprod_crcf_struct_vs_ordinal to package dotprod_crcf from src/dotprod/tests/dotprod_crcf_autotest.c:190
+// adding dotprod_cccf_rand16 to package dotprod_cccf from src/dotprod/tests/dotprod_cccf_autotest.c:33
+// adding dotprod_cccf_struct_lengths to package dotprod_cccf from src/dotprod/tests/dotprod_cccf_autotest.c:96
+// adding dotprod_cccf_struct_vs_ordinal to package dotprod_cccf from src/dotprod/tests/dotprod_cccf_autotest.c:245
+// adding sumsqf_3 to package sumsqf from src/dotprod/tests/sumsqf_autotest.c:50
+// adding sumsqf_4 to package sumsqf from src/dotprod/tests/sumsqf_autotest.c:51
+// adding sumsqf_7 to package sumsqf from src/dotprod/tests/sumsqf_autotest.c:52
+// adding sumsqf_8 to package sumsqf from src/dotprod/tests/sumsqf_autotest.c:53
+// adding sumsqf_15 to package sumsqf from src/dotprod/tests/sumsqf_autotest.c:54
+// adding sumsqf_16 to package sumsqf from src/dotprod/tests/sumsqf_autotest.c:55
+// adding sumsqcf_3 to package sumsqcf from src/dotprod/tests/sumsqcf_autotest.c:50
+// adding sumsqcf_4 to package sumsqcf from src/dotprod/tests/sumsqcf_autotest.c:51
+// adding sumsqcf_7 to package sumsqcf from src/dotprod/tests/sumsqcf_autotest.c:52
+// adding sumsqcf_8 to package sumsqcf from src/dotprod/tests/sumsqcf_autotest.c:53
+// adding sumsqcf_15 to package sumsqcf from src/dotprod/tests/sumsqcf_autotest.c:54
+// adding sumsqcf_16 to package sumsqcf from src/dotprod/tests/sumsqcf_autotest.c:55
+// adding eqlms_00 to package eqlms_cccf from src/equalization/tests/eqlms_cccf_autotest.c:129
+// adding eqlms_01 to package eqlms_cccf from src/equalization/tests/eqlms_cccf_autotest.c:130
+// adding eqlms_02 to package eqlms_cccf from src/equalization/tests/eqlms_cccf_autotest.c:131
+// adding eqlms_03 to package eqlms_cccf from src/equalization/tests/eqlms_cccf_autotest.c:134
+// adding eqlms_04 to package eqlms_cccf from src/equalization/tests/eqlms_cccf_autotest.c:135
+// adding eqlms_05 to package eqlms_cccf from src/equalization/tests/eqlms_cccf_autotest.c:136
+// adding eqlms_06 to package eqlms_cccf from src/equalization/tests/eqlms_cccf_autotest.c:137
+// adding eqlms_07 to package eqlms_cccf from src/equalization/tests/eqlms_cccf_autotest.c:140
+// adding eqlms_08 to package eqlms_cccf from src/equalization/tests/eqlms_cccf_autotest.c:141
+// adding eqlms_09 to package eqlms_cccf from src/equalization/tests/eqlms_cccf_autotest.c:142
+// adding eqlms_10 to package eqlms_cccf from src/equalization/tests/eqlms_cccf_autotest.c:143
+// adding eqlms_11 to package eqlms_cccf from src/equalization/tests/eqlms_cccf_autotest.c:144
+// adding eqlms_config to package eqlms_cccf from src/equalization/tests/eqlms_cccf_autotest.c:147
+// adding eqlms_cccf_copy to package eqlms_cccf from src/equalization/tests/eqlms_cccf_autotest.c:193
+// adding eqrls_cccf_sysid to package eqrls_cccf from src/equalization/tests/eqrls_cccf_autotest.c:71
+// adding eqrls_cccf_sysid_invqr to package eqrls_cccf from src/equalization/tests/eqrls_cccf_autotest.c:72
+// adding eqrls_cccf_sysid_ftf to package eqrls_cccf from src/equalization/tests/eqrls_cccf_autotest.c:73
+// adding eqrls_cccf_sysid_ftf_slow to package eqrls_cccf from src/equalization/tests/eqrls_cccf_autotest.c:74
+// adding eqrls_cccf_invqr to package eqrls_cccf from src/equalization/tests/eqrls_cccf_autotest.c:127
+// adding eqrls_cccf_ftf to package eqrls_cccf from src/equalization/tests/eqrls_cccf_autotest.c:128
+// adding eqrls_cccf_ftf_slow to package eqrls_cccf from src/equalization/tests/eqrls_cccf_autotest.c:129
+// adding eqrls_rrrf_01 to package eqrls_rrrf from src/equalization/tests/eqrls_rrrf_autotest.c:39
+// adding eqrls_rrrf_copy to package eqrls_rrrf from src/equalization/tests/eqrls_rrrf_autotest.c:88
+// adding eqrls_rrrf_invqr to package eqrls_rrrf from src/equalization/tests/eqrls_rrrf_autotest.c:196
+// adding eqrls_rrrf_ftf to package eqrls_rrrf from src/equalization/tests/eqrls_rrrf_autotest.c:197
+// adding eqrls_rrrf_ftf_slow to package eqrls_rrrf from src/equalization/tests/eqrls_rrrf_autotest.c:198
+// adding eqrls_rrrf_config to package eqrls_rrrf from src/equalization/tests/eqrls_rrrf_autotest.c:200
+// adding eqrls_rrrf_copy_ftf to package eqrls_rrrf from src/equalization/tests/eqrls_rrrf_autotest.c:214
+// adding reverse_byte to package crc from src/fec/tests/crc_autotest.c:31
+// adding reverse_uint16 to package crc from src/fec/tests/crc_autotest.c:46
+// adding reverse_uint32 to package crc from src/fec/tests/crc_autotest.c:59
+// adding checksum to package crc from src/fec/tests/crc_autotest.c:108
+// adding crc8 to package crc from src/fec/tests/crc_autotest.c:109
+// adding crc16 to package crc from src/fec/tests/crc_autotest.c:110
+// adding crc24 to package crc from src/fec/tests/crc_autotest.c:111
+// adding crc32 to package crc from src/fec/tests/crc_autotest.c:112
+// adding crc_config to package crc from src/fec/tests/crc_autotest.c:114
+// adding fec_r3 to package fec from src/fec/tests/fec_autotest.c:92
+// adding fec_r5 to package fec from src/fec/tests/fec_autotest.c:93
+// adding fec_h74 to package fec from src/fec/tests/fec_autotest.c:96
+// adding fec_h84 to package fec from src/fec/tests/fec_autotest.c:97
+// adding fec_h128 to package fec from src/fec/tests/fec_autotest.c:98
+// adding fec_g2412 to package fec from src/fec/tests/fec_autotest.c:101
+// adding fec_secded2216 to package fec from src/fec/tests/fec_autotest.c:104
+// adding fec_secded3932 to package fec from src/fec/tests/fec_autotest.c:105
+// adding fec_secded7264 to package fec from src/fec/tests/fec_autotest.c:106
+// adding fec_v27 to package fec from src/fec/tests/fec_autotest.c:109
+// adding fec_v29 to package fec from src/fec/tests/fec_autotest.c:110
+// adding fec_v39 to package fec from src/fec/tests/fec_autotest.c:111
+// adding fec_v615 to package fec from src/fec/tests/fec_autotest.c:112
+// adding fec_v27p23 to package fec from src/fec/tests/fec_autotest.c:115
+// adding fec_v27p34 to package fec from src/fec/tests/fec_autotest.c:116
+// adding fec_v27p45 to package fec from src/fec/tests/fec_autotest.c:117
+// adding fec_v27p56 to package fec from src/fec/tests/fec_autotest.c:118
+// adding fec_v27p67 to package fec from src/fec/tests/fec_autotest.c:119
+// adding fec_v27p78 to package fec from src/fec/tests/fec_autotest.c:120
+// adding fec_v29p23 to package fec from src/fec/tests/fec_autotest.c:122
+// adding fec_v29p34 to package fec from src/fec/tests/fec_autotest.c:123
+// adding fec_v29p45 to package fec from src/fec/tests/fec_autotest.c:124
+// adding fec_v29p56 to package fec from src/fec/tests/fec_autotest.c:125
+// adding fec_v29p67 to package fec from src/fec/tests/fec_autotest.c:126
+// adding fec_v29p78 to package fec from src/fec/tests/fec_autotest.c:127
+// adding fec_rs8 to package fec from src/fec/tests/fec_autotest.c:130
+// adding fec_ldpc12 to package fec from src/fec/tests/fec_autotest.c:133
+// adding fec_ldpc23 to package fec from src/fec/tests/fec_autotest.c:134
+// adding fec_ldpc34 to package fec from src/fec/tests/fec_autotest.c:135
+// adding fec_config to package fec_config from src/fec/tests/fec_config_autotest.c:29
+// adding fec_str2fec to package fec_config from src/fec/tests/fec_config_autotest.c:55
+// adding fec_is_convolutional to package fec_config from src/fec/tests/fec_config_autotest.c:94
+// adding fec_is_punctured to package fec_config from src/fec/tests/fec_config_autotest.c:125
+// adding fec_is_reedsolomon to package fec_config from src/fec/tests/fec_config_autotest.c:156
+// adding fec_is_hamming to package fec_config from src/fec/tests/fec_config_autotest.c:167
+// adding fec_copy_r3 to package fec_copy from src/fec/tests/fec_copy_autotest.c:100
+// adding fec_copy_r5 to package fec_copy from src/fec/tests/fec_copy_autotest.c:101
+// adding fec_copy_h74 to package fec_copy from src/fec/tests/fec_copy_autotest.c:104
+// adding fec_copy_h84 to package fec_copy from src/fec/tests/fec_copy_autotest.c:105
+// adding fec_copy_h128 to package fec_copy from src/fec/tests/fec_copy_autotest.c:106
+// adding fec_copy_g2412 to package fec_copy from src/fec/tests/fec_copy_autotest.c:109
+// adding fec_copy_secded2216 to package fec_copy from src/fec/tests/fec_copy_autotest.c:112
+// adding fec_copy_secded3932 to package fec_copy from src/fec/tests/fec_copy_autotest.c:113
+// adding fec_copy_secded7264 to package fec_copy from src/fec/tests/fec_copy_autotest.c:114
+// adding fec_copy_v27 to package fec_copy from src/fec/tests/fec_copy_autotest.c:117
+// adding fec_copy_v29 to package fec_copy from src/fec/tests/fec_copy_autotest.c:118
+// adding fec_copy_v39 to package fec_copy from src/fec/tests/fec_copy_autotest.c:119
+// adding fec_copy_v615 to package fec_copy from src/fec/tests/fec_copy_autotest.c:120
+// adding fec_copy_v27p23 to package fec_copy from src/fec/tests/fec_copy_autotest.c:123
+// adding fec_copy_v27p34 to package fec_copy from src/fec/tests/fec_copy_autotest.c:124
+// adding fec_copy_v27p45 to package fec_copy from src/fec/tests/fec_copy_autotest.c:125
+// adding fec_copy_v27p56 to package fec_copy from src/fec/tests/fec_copy_autotest.c:126
+// adding fec_copy_v27p67 to package fec_copy from src/fec/tests/fec_copy_autotest.c:127
+// adding fec_copy_v27p78 to package fec_copy from src/fec/tests/fec_copy_autotest.c:128
+// adding fec_copy_v29p23 to package fec_copy from src/fec/tests/fec_copy_autotest.c:130
+// adding fec_copy_v29p34 to package fec_copy from src/fec/tests/fec_copy_autotest.c:131
+// adding fec_copy_v29p45 to package fec_copy from src/fec/tests/fec_copy_autotest.c:132
+// adding fec_copy_v29p56 to package fec_copy from src/fec/tests/fec_copy_autotest.c:133
+// adding fec_copy_v29p67 to package fec_copy from src/fec/tests/fec_copy_autotest.c:134
+// adding fec_copy_v29p78 to package fec_copy from src/fec/tests/fec_copy_autotest.c:135
+// adding fec_copy_rs8 to package fec_copy from src/fec/tests/fec_copy_autotest.c:138
+// adding fec_copy_ldpc12 to package fec_copy from src/fec/tests/fec_copy_autotest.c:141
+// adding fecsoft_r3 to package fec_soft from src/fec/tests/fec_soft_autotest.c:108
+// adding fecsoft_r5 to package fec_soft from src/fec/tests/fec_soft_autotest.c:109
+// adding fecsoft_h74 to package fec_soft from src/fec/tests/fec_soft_autotest.c:112
+// adding fecsoft_h84 to package fec_soft from src/fec/tests/fec_soft_autotest.c:113
+// adding fecsoft_h128 to package fec_soft from src/fec/tests/fec_soft_autotest.c:114
+// adding fecsoft_v27 to package fec_soft from src/fec/tests/fec_soft_autotest.c:117
+// adding fecsoft_v29 to package fec_soft from src/fec/tests/fec_soft_autotest.c:118
+// adding fecsoft_v39 to package fec_soft from src/fec/tests/fec_soft_autotest.c:119
+// adding fecsoft_v615 to package fec_soft from src/fec/tests/fec_soft_autotest.c:120
+// adding fecsoft_v27p23 to package fec_soft from src/fec/tests/fec_soft_autotest.c:123
+// adding fecsoft_v27p34 to package fec_soft from src/fec/tests/fec_soft_autotest.c:124
+// adding fecsoft_v27p45 to package fec_soft from src/fec/tests/fec_soft_autotest.c:125
+// adding fecsoft_v27p56 to package fec_soft from src/fec/tests/fec_soft_autotest.c:126
+// adding fecsoft_v27p67 to package fec_soft from src/fec/tests/fec_soft_autotest.c:127
+// adding fecsoft_v27p78 to package fec_soft from src/fec/tests/fec_soft_autotest.c:128
+// adding fecsoft_v29p23 to package fec_soft from src/fec/tests/fec_soft_autotest.c:130
+// adding fecsoft_v29p34 to package fec_soft from src/fec/tests/fec_soft_autotest.c:131
+// adding fecsoft_v29p45 to package fec_soft from src/fec/tests/fec_soft_autotest.c:132
+// adding fecsoft_v29p56 to package fec_soft from src/fec/tests/fec_soft_autotest.c:133
+// adding fecsoft_v29p67 to package fec_soft from src/fec/tests/fec_soft_autotest.c:134
+// adding fecsoft_v29p78 to package fec_soft from src/fec/tests/fec_soft_autotest.c:135
+// adding fecsoft_rs8 to package fec_soft from src/fec/tests/fec_soft_autotest.c:138
+// adding fecsoft_ldpc12 to package fec_soft from src/fec/tests/fec_soft_autotest.c:141
+// adding fecsoft_ldpc23 to package fec_soft from src/fec/tests/fec_soft_autotest.c:142
+// adding fecsoft_ldpc34 to package fec_soft from src/fec/tests/fec_soft_autotest.c:143
+// adding golay2412_codec to package fec_golay2412 from src/fec/tests/fec_golay2412_autotest.c:67
+// adding hamming74_codec to package fec_hamming74 from src/fec/tests/fec_hamming74_autotest.c:29
+// adding hamming74_codec_soft to package fec_hamming74 from src/fec/tests/fec_hamming74_autotest.c:72
+// adding hamming84_codec to package fec_hamming84 from src/fec/tests/fec_hamming84_autotest.c:29
+// adding hamming84_codec_soft to package fec_hamming84 from src/fec/tests/fec_hamming84_autotest.c:71
+// adding hamming128_codec to package fec_hamming128 from src/fec/tests/fec_hamming128_autotest.c:32
+// adding hamming128_codec_soft to package fec_hamming128 from src/fec/tests/fec_hamming128_autotest.c:71
+// adding hamming1511_codec to package fec_hamming1511 from src/fec/tests/fec_hamming1511_autotest.c:32
+// adding hamming3126_codec to package fec_hamming3126 from src/fec/tests/fec_hamming3126_autotest.c:32
+// adding fec_ldpc12_hard_n1 to package fec_ldpc from src/fec/tests/fec_ldpc_autotest.c:104
+// adding fec_ldpc12_hard_n37 to package fec_ldpc from src/fec/tests/fec_ldpc_autotest.c:105
+// adding fec_ldpc12_hard_n144 to package fec_ldpc from src/fec/tests/fec_ldpc_autotest.c:106
+// adding fec_ldpc12_hard_n1000 to package fec_ldpc from src/fec/tests/fec_ldpc_autotest.c:107
+// adding fec_ldpc23_hard_n192 to package fec_ldpc from src/fec/tests/fec_ldpc_autotest.c:108
+// adding fec_ldpc23_hard_n500 to package fec_ldpc from src/fec/tests/fec_ldpc_autotest.c:109
+// adding fec_ldpc34_hard_n216 to package fec_ldpc from src/fec/tests/fec_ldpc_autotest.c:110
+// adding fec_ldpc34_hard_n777 to package fec_ldpc from src/fec/tests/fec_ldpc_autotest.c:111
+// adding fec_ldpc12_soft_n144 to package fec_ldpc from src/fec/tests/fec_ldpc_autotest.c:114
+// adding fec_ldpc23_soft_n192 to package fec_ldpc from src/fec/tests/fec_ldpc_autotest.c:115
+// adding fec_ldpc34_soft_n216 to package fec_ldpc from src/fec/tests/fec_ldpc_autotest.c:116
+// adding fec_ldpc_length to package fec_ldpc from src/fec/tests/fec_ldpc_autotest.c:120
+// adding fec_ldpc12_girth to package fec_ldpc from src/fec/tests/fec_ldpc_autotest.c:187
+// adding fec_ldpc23_girth to package fec_ldpc from src/fec/tests/fec_ldpc_autotest.c:188
+// adding fec_ldpc34_girth to package fec_ldpc from src/fec/tests/fec_ldpc_autotest.c:189
+// adding reedsolomon_223_255 to package fec_reedsolomon from src/fec/tests/fec_reedsolomon_autotest.c:32
+// adding reedsolomon_lengths to package fec_reedsolomon from src/fec/tests/fec_reedsolomon_autotest.c:84
+// adding rep3_codec to package fec_rep3 from src/fec/tests/fec_rep3_autotest.c:29
+// adding rep5_codec to package fec_rep5 from src/fec/tests/fec_rep5_autotest.c:29
+// adding secded2216_codec_e0 to package fec_secded2216 from src/fec/tests/fec_secded2216_autotest.c:32
+// adding secded2216_codec_e1 to package fec_secded2216 from src/fec/tests/fec_secded2216_autotest.c:55
+// adding secded2216_codec_e2 to package fec_secded2216 from src/fec/tests/fec_secded2216_autotest.c:93
+// adding secded3932_codec_e0 to package fec_secded3932 from src/fec/tests/fec_secded3932_autotest.c:32
+// adding secded3932_codec_e1 to package fec_secded3932 from src/fec/tests/fec_secded3932_autotest.c:59
+// adding secded3932_codec_e2 to package fec_secded3932 from src/fec/tests/fec_secded3932_autotest.c:103
+// adding secded7264_codec_e0 to package fec_secded7264 from src/fec/tests/fec_secded7264_autotest.c:32
+// adding secded7264_codec_e1 to package fec_secded7264 from src/fec/tests/fec_secded7264_autotest.c:69
+// adding secded7264_codec_e2 to package fec_secded7264 from src/fec/tests/fec_secded7264_autotest.c:111
+// adding interleaver_hard_8 to package interleaver from src/fec/tests/interleaver_autotest.c:79
+// adding interleaver_hard_16 to package interleaver from src/fec/tests/interleaver_autotest.c:80
+// adding interleaver_hard_64 to package interleaver from src/fec/tests/interleaver_autotest.c:81
+// adding interleaver_hard_256 to package interleaver from src/fec/tests/interleaver_autotest.c:82
+// adding interleaver_soft_8 to package interleaver from src/fec/tests/interleaver_autotest.c:84
+// adding interleaver_soft_16 to package interleaver from src/fec/tests/interleaver_autotest.c:85
+// adding interleaver_soft_64 to package interleaver from src/fec/tests/interleaver_autotest.c:86
+// adding interleaver_soft_256 to package interleaver from src/fec/tests/interleaver_autotest.c:87
+// adding interleaver_depth to package interleaver from src/fec/tests/interleaver_autotest.c:90
+// adding packetizer_copy to package packetizer_copy from src/fec/tests/packetizer_copy_autotest.c:27
+// adding packetizer_n16_0_0 to package packetizer from src/fec/tests/packetizer_autotest.c:65
+// adding packetizer_n16_0_1 to package packetizer from src/fec/tests/packetizer_autotest.c:66
+// adding packetizer_n16_0_2 to package packetizer from src/fec/tests/packetizer_autotest.c:67
+// adding packetizer_batch_0_0 to package packetizer from src/fec/tests/packetizer_autotest.c:122
+// adding packetizer_batch_0_1 to package packetizer from src/fec/tests/packetizer_autotest.c:123
+// adding packetizer_batch_1_0 to package packetizer from src/fec/tests/packetizer_autotest.c:124
+// adding packetizer_batch_1_1 to package packetizer from src/fec/tests/packetizer_autotest.c:125
+// adding asgramcf_copy to package asgram from src/fft/tests/asgram_autotest.c:30
+// adding fft_3 to package fft_small from src/fft/tests/fft_small_autotest.c:36
+// adding fft_5 to package fft_small from src/fft/tests/fft_small_autotest.c:37
+// adding fft_6 to package fft_small from src/fft/tests/fft_small_autotest.c:38
+// adding fft_7 to package fft_small from src/fft/tests/fft_small_autotest.c:39
+// adding fft_9 to package fft_small from src/fft/tests/fft_small_autotest.c:40
+// adding fft_2 to package fft_radix2 from src/fft/tests/fft_radix2_autotest.c:36
+// adding fft_4 to package fft_radix2 from src/fft/tests/fft_radix2_autotest.c:37
+// adding fft_8 to package fft_radix2 from src/fft/tests/fft_radix2_autotest.c:38
+// adding fft_16 to package fft_radix2 from src/fft/tests/fft_radix2_autotest.c:39
+// adding fft_32 to package fft_radix2 from src/fft/tests/fft_radix2_autotest.c:40
+// adding fft_64 to package fft_radix2 from src/fft/tests/fft_radix2_autotest.c:41
+// adding fft_10 to package fft_composite from src/fft/tests/fft_composite_autotest.c:37
+// adding fft_21 to package fft_composite from src/fft/tests/fft_composite_autotest.c:38
+// adding fft_22 to package fft_composite from src/fft/tests/fft_composite_autotest.c:39
+// adding fft_24 to package fft_composite from src/fft/tests/fft_composite_autotest.c:40
+// adding fft_26 to package fft_composite from src/fft/tests/fft_composite_autotest.c:41
+// adding fft_30 to package fft_composite from src/fft/tests/fft_composite_autotest.c:42
+// adding fft_35 to package fft_composite from src/fft/tests/fft_composite_autotest.c:43
+// adding fft_36 to package fft_composite from src/fft/tests/fft_composite_autotest.c:44
+// adding fft_48 to package fft_composite from src/fft/tests/fft_composite_autotest.c:45
+// adding fft_63 to package fft_composite from src/fft/tests/fft_composite_autotest.c:46
+// adding fft_92 to package fft_composite from src/fft/tests/fft_composite_autotest.c:47
+// adding fft_96 to package fft_composite from src/fft/tests/fft_composite_autotest.c:48
+// adding fft_120 to package fft_composite from src/fft/tests/fft_composite_autotest.c:50
+// adding fft_130 to package fft_composite from src/fft/tests/fft_composite_autotest.c:51
+// adding fft_192 to package fft_composite from src/fft/tests/fft_composite_autotest.c:52
+// adding fft_17 to package fft_prime from src/fft/tests/fft_prime_autotest.c:36
+// adding fft_43 to package fft_prime from src/fft/tests/fft_prime_autotest.c:37
+// adding fft_79 to package fft_prime from src/fft/tests/fft_prime_autotest.c:38
+// adding fft_157 to package fft_prime from src/fft/tests/fft_prime_autotest.c:39
+// adding fft_317 to package fft_prime from src/fft/tests/fft_prime_autotest.c:40
+// adding fft_509 to package fft_prime from src/fft/tests/fft_prime_autotest.c:41
+// adding fft_r2r_REDFT00_n8 to package fft_r2r from src/fft/tests/fft_r2r_autotest.c:66
+// adding fft_r2r_REDFT10_n8 to package fft_r2r from src/fft/tests/fft_r2r_autotest.c:67
+// adding fft_r2r_REDFT01_n8 to package fft_r2r from src/fft/tests/fft_r2r_autotest.c:68
+// adding fft_r2r_REDFT11_n8 to package fft_r2r from src/fft/tests/fft_r2r_autotest.c:69
+// adding fft_r2r_RODFT00_n8 to package fft_r2r from src/fft/tests/fft_r2r_autotest.c:71
+// adding fft_r2r_RODFT10_n8 to package fft_r2r from src/fft/tests/fft_r2r_autotest.c:72
+// adding fft_r2r_RODFT01_n8 to package fft_r2r from src/fft/tests/fft_r2r_autotest.c:73
+// adding fft_r2r_RODFT11_n8 to package fft_r2r from src/fft/tests/fft_r2r_autotest.c:74
+// adding fft_r2r_REDFT00_n32 to package fft_r2r from src/fft/tests/fft_r2r_autotest.c:81
+// adding fft_r2r_REDFT10_n32 to package fft_r2r from src/fft/tests/fft_r2r_autotest.c:82
+// adding fft_r2r_REDFT01_n32 to package fft_r2r from src/fft/tests/fft_r2r_autotest.c:83
+// adding fft_r2r_REDFT11_n32 to package fft_r2r from src/fft/tests/fft_r2r_autotest.c:84
+// adding fft_r2r_RODFT00_n32 to package fft_r2r from src/fft/tests/fft_r2r_autotest.c:86
+// adding fft_r2r_RODFT10_n32 to package fft_r2r from src/fft/tests/fft_r2r_autotest.c:87
+// adding fft_r2r_RODFT01_n32 to package fft_r2r from src/fft/tests/fft_r2r_autotest.c:88
+// adding fft_r2r_RODFT11_n32 to package fft_r2r from src/fft/tests/fft_r2r_autotest.c:89
+// adding fft_r2r_REDFT00_n27 to package fft_r2r from src/fft/tests/fft_r2r_autotest.c:96
+// adding fft_r2r_REDFT10_n27 to package fft_r2r from src/fft/tests/fft_r2r_autotest.c:97
+// adding fft_r2r_REDFT01_n27 to package fft_r2r from src/fft/tests/fft_r2r_autotest.c:98
+// adding fft_r2r_REDFT11_n27 to package fft_r2r from src/fft/tests/fft_r2r_autotest.c:99
+// adding fft_r2r_RODFT00_n27 to package fft_r2r from src/fft/tests/fft_r2r_autotest.c:101
+// adding fft_r2r_RODFT10_n27 to package fft_r2r from src/fft/tests/fft_r2r_autotest.c:102
+// adding fft_r2r_RODFT01_n27 to package fft_r2r from src/fft/tests/fft_r2r_autotest.c:103
+// adding fft_r2r_RODFT11_n27 to package fft_r2r from src/fft/tests/fft_r2r_autotest.c:104
+// adding fft_shift_4 to package fft_shift from src/fft/tests/fft_shift_autotest.c:26
+// adding fft_shift_8 to package fft_shift from src/fft/tests/fft_shift_autotest.c:47
+// adding spgramcf_noise_440 to package spgram from src/fft/tests/spgram_autotest.c:71
+// adding spgramcf_noise_1024 to package spgram from src/fft/tests/spgram_autotest.c:72
+// adding spgramcf_noise_1200 to package spgram from src/fft/tests/spgram_autotest.c:73
+// adding spgramcf_noise_custom_0 to package spgram from src/fft/tests/spgram_autotest.c:76
+// adding spgramcf_noise_custom_1 to package spgram from src/fft/tests/spgram_autotest.c:77
+// adding spgramcf_noise_custom_2 to package spgram from src/fft/tests/spgram_autotest.c:78
+// adding spgramcf_noise_custom_3 to package spgram from src/fft/tests/spgram_autotest.c:79
+// adding spgramcf_noise_hamming to package spgram from src/fft/tests/spgram_autotest.c:82
+// adding spgramcf_noise_hann to package spgram from src/fft/tests/spgram_autotest.c:83
+// adding spgramcf_noise_blackmanharris to package spgram from src/fft/tests/spgram_autotest.c:84
+// adding spgramcf_noise_blackmanharris7 to package spgram from src/fft/tests/spgram_autotest.c:85
+// adding spgramcf_noise_kaiser to package spgram from src/fft/tests/spgram_autotest.c:86
+// adding spgramcf_noise_flattop to package spgram from src/fft/tests/spgram_autotest.c:87
+// adding spgramcf_noise_triangular to package spgram from src/fft/tests/spgram_autotest.c:88
+// adding spgramcf_noise_rcostaper to package spgram from src/fft/tests/spgram_autotest.c:89
+// adding spgramcf_noise_kbd to package spgram from src/fft/tests/spgram_autotest.c:90
+// adding spgramcf_signal_00 to package spgram from src/fft/tests/spgram_autotest.c:152
+// adding spgramcf_signal_01 to package spgram from src/fft/tests/spgram_autotest.c:153
+// adding spgramcf_signal_02 to package spgram from src/fft/tests/spgram_autotest.c:154
+// adding spgramcf_signal_03 to package spgram from src/fft/tests/spgram_autotest.c:155
+// adding spgramcf_signal_04 to package spgram from src/fft/tests/spgram_autotest.c:156
+// adding spgramcf_signal_05 to package spgram from src/fft/tests/spgram_autotest.c:157
+// adding spgramcf_counters to package spgram from src/fft/tests/spgram_autotest.c:159
+// adding spgramcf_invalid_config to package spgram from src/fft/tests/spgram_autotest.c:219
+// adding spgramcf_standalone to package spgram from src/fft/tests/spgram_autotest.c:250
+// adding spgramcf_short to package spgram from src/fft/tests/spgram_autotest.c:281
+// adding spgramcf_copy to package spgram from src/fft/tests/spgram_autotest.c:316
+// adding spgramcf_null to package spgram from src/fft/tests/spgram_autotest.c:363
+// adding spgram_gnuplot to package spgram from src/fft/tests/spgram_autotest.c:377
+// adding spwaterfall_invalid_config to package spwaterfall from src/fft/tests/spwaterfall_autotest.c:30
+// adding spwaterfallcf_noise_440 to package spwaterfall from src/fft/tests/spwaterfall_autotest.c:117
+// adding spwaterfallcf_noise_1024 to package spwaterfall from src/fft/tests/spwaterfall_autotest.c:118
+// adding spwaterfallcf_noise_1200 to package spwaterfall from src/fft/tests/spwaterfall_autotest.c:119
+// adding spwaterfall_operation to package spwaterfall from src/fft/tests/spwaterfall_autotest.c:122
+// adding spwaterfall_copy to package spwaterfall from src/fft/tests/spwaterfall_autotest.c:154
+// adding spwaterfall_gnuplot to package spwaterfall from src/fft/tests/spwaterfall_autotest.c:198
+// adding dds_cccf_0 to package dds_cccf from src/filter/tests/dds_cccf_autotest.c:103
+// adding dds_cccf_1 to package dds_cccf from src/filter/tests/dds_cccf_autotest.c:104
+// adding dds_cccf_2 to package dds_cccf from src/filter/tests/dds_cccf_autotest.c:105
+// adding dds_config to package dds_cccf from src/filter/tests/dds_cccf_autotest.c:112
+// adding dds_copy to package dds_cccf from src/filter/tests/dds_cccf_autotest.c:144
+// adding design_cache_kaiser to package design_cache from src/filter/tests/design_cache_autotest.c:27
+// adding design_cache_evict to package design_cache from src/filter/tests/design_cache_autotest.c:58
+// adding design_cache_designs to package design_cache from src/filter/tests/design_cache_autotest.c:100
+// adding design_cache_single_rkaiser to package design_cache from src/filter/tests/design_cache_autotest.c:187
+// adding design_cache_single_arkaiser to package design_cache from src/filter/tests/design_cache_autotest.c:188
+// adding design_cache_single_hM3 to package design_cache from src/filter/tests/design_cache_autotest.c:189
+// adding design_cache_halfband to package design_cache from src/filter/tests/design_cache_autotest.c:192
+// adding design_cache_config to package design_cache from src/filter/tests/design_cache_autotest.c:212
+// adding fdelay_rrrf_0 to package fdelay_rrrf from src/filter/tests/fdelay_rrrf_autotest.c:78
+// adding fdelay_rrrf_1 to package fdelay_rrrf from src/filter/tests/fdelay_rrrf_autotest.c:79
+// adding fdelay_rrrf_2 to package fdelay_rrrf from src/filter/tests/fdelay_rrrf_autotest.c:80
+// adding fdelay_rrrf_3 to package fdelay_rrrf from src/filter/tests/fdelay_rrrf_autotest.c:81
+// adding fdelay_rrrf_4 to package fdelay_rrrf from src/filter/tests/fdelay_rrrf_autotest.c:82
+// adding fdelay_rrrf_5 to package fdelay_rrrf from src/filter/tests/fdelay_rrrf_autotest.c:83
+// adding fdelay_rrrf_6 to package fdelay_rrrf from src/filter/tests/fdelay_rrrf_autotest.c:84
+// adding fdelay_rrrf_7 to package fdelay_rrrf from src/filter/tests/fdelay_rrrf_autotest.c:85
+// adding fdelay_rrrf_8 to package fdelay_rrrf from src/filter/tests/fdelay_rrrf_autotest.c:86
+// adding fdelay_rrrf_9 to package fdelay_rrrf from src/filter/tests/fdelay_rrrf_autotest.c:87
+// adding fdelay_rrrf_config to package fdelay_rrrf from src/filter/tests/fdelay_rrrf_autotest.c:89
+// adding fdelay_rrrf_push_write to package fdelay_rrrf from src/filter/tests/fdelay_rrrf_autotest.c:124
+// adding fftfilt_rrrf_data_h4x256 to package fftfilt_xxxf from src/filter/tests/fftfilt_xxxf_autotest.c:36
+// adding fftfilt_rrrf_data_h7x256 to package fftfilt_xxxf from src/filter/tests/fftfilt_xxxf_autotest.c:42
+// adding fftfilt_rrrf_data_h13x256 to package fftfilt_xxxf from src/filter/tests/fftfilt_xxxf_autotest.c:48
+// adding fftfilt_rrrf_data_h23x256 to package fftfilt_xxxf from src/filter/tests/fftfilt_xxxf_autotest.c:54
+// adding fftfilt_crcf_data_h4x256 to package fftfilt_xxxf from src/filter/tests/fftfilt_xxxf_autotest.c:65
+// adding fftfilt_crcf_data_h7x256 to package fftfilt_xxxf from src/filter/tests/fftfilt_xxxf_autotest.c:71
+// adding fftfilt_crcf_data_h13x256 to package fftfilt_xxxf from src/filter/tests/fftfilt_xxxf_autotest.c:77
+// adding fftfilt_crcf_data_h23x256 to package fftfilt_xxxf from src/filter/tests/fftfilt_xxxf_autotest.c:83
+// adding fftfilt_cccf_data_h4x256 to package fftfilt_xxxf from src/filter/tests/fftfilt_xxxf_autotest.c:94
+// adding fftfilt_cccf_data_h7x256 to package fftfilt_xxxf from src/filter/tests/fftfilt_xxxf_autotest.c:100
+// adding fftfilt_cccf_data_h13x256 to package fftfilt_xxxf from src/filter/tests/fftfilt_xxxf_autotest.c:106
+// adding fftfilt_cccf_data_h23x256 to package fftfilt_xxxf from src/filter/tests/fftfilt_xxxf_autotest.c:112
+// adding fftfilt_config to package fftfilt_xxxf from src/filter/tests/fftfilt_xxxf_autotest.c:119
+// adding fftfilt_copy to package fftfilt_xxxf from src/filter/tests/fftfilt_xxxf_autotest.c:146
+// adding filter_crosscorr_rrrf to package filter_crosscorr from src/filter/tests/filter_crosscorr_autotest.c:26
+// adding firdecim_config to package firdecim from src/filter/tests/firdecim_autotest.c:26
+// adding firdecim_block to package firdecim from src/filter/tests/firdecim_autotest.c:69
+// adding firdecim_rrrf_common to package firdecim_xxxf from src/filter/tests/firdecim_xxxf_autotest.c:33
+// adding firdecim_crcf_common to package firdecim_xxxf from src/filter/tests/firdecim_xxxf_autotest.c:40
+// adding firdecim_rrrf_data_M2h4x20 to package firdecim_xxxf from src/filter/tests/firdecim_xxxf_autotest.c:50
+// adding firdecim_rrrf_data_M3h7x30 to package firdecim_xxxf from src/filter/tests/firdecim_xxxf_autotest.c:57
+// adding firdecim_rrrf_data_M4h13x40 to package firdecim_xxxf from src/filter/tests/firdecim_xxxf_autotest.c:64
+// adding firdecim_rrrf_data_M5h23x50 to package firdecim_xxxf from src/filter/tests/firdecim_xxxf_autotest.c:71
+// adding firdecim_crcf_data_M2h4x20 to package firdecim_xxxf from src/filter/tests/firdecim_xxxf_autotest.c:83
+// adding firdecim_crcf_data_M3h7x30 to package firdecim_xxxf from src/filter/tests/firdecim_xxxf_autotest.c:90
+// adding firdecim_crcf_data_M4h13x40 to package firdecim_xxxf from src/filter/tests/firdecim_xxxf_autotest.c:97
+// adding firdecim_crcf_data_M5h23x50 to package firdecim_xxxf from src/filter/tests/firdecim_xxxf_autotest.c:104
+// adding firdecim_cccf_data_M2h4x20 to package firdecim_xxxf from src/filter/tests/firdecim_xxxf_autotest.c:116
+// adding firdecim_cccf_data_M3h7x30 to package firdecim_xxxf from src/filter/tests/firdecim_xxxf_autotest.c:123
+// adding firdecim_cccf_data_M4h13x40 to package firdecim_xxxf from src/filter/tests/firdecim_xxxf_autotest.c:130
+// adding firdecim_cccf_data_M5h23x50 to package firdecim_xxxf from src/filter/tests/firdecim_xxxf_autotest.c:137
+// adding liquid_firdes_rcos to package firdes from src/filter/tests/firdes_autotest.c:26
+// adding liquid_firdes_rrcos to package firdes from src/filter/tests/firdes_autotest.c:59
+// adding firdes_rrcos to package firdes from src/filter/tests/firdes_autotest.c:129
+// adding firdes_rkaiser to package firdes from src/filter/tests/firdes_autotest.c:130
+// adding firdes_arkaiser to package firdes from src/filter/tests/firdes_autotest.c:131
+// adding liquid_firdes_dcblock to package firdes from src/filter/tests/firdes_autotest.c:133
+// adding liquid_firdes_notch to package firdes from src/filter/tests/firdes_autotest.c:161
+// adding liquid_getopt_str2firfilt to package firdes from src/filter/tests/firdes_autotest.c:194
+// adding liquid_firdes_config to package firdes from src/filter/tests/firdes_autotest.c:214
+// adding liquid_firdes_estimate to package firdes from src/filter/tests/firdes_autotest.c:277
+// adding firdes_prototype_kaiser to package firdes from src/filter/tests/firdes_autotest.c:336
+// adding firdes_prototype_pm to package firdes from src/filter/tests/firdes_autotest.c:337
+// adding firdes_prototype_rcos to package firdes from src/filter/tests/firdes_autotest.c:338
+// adding firdes_prototype_fexp to package firdes from src/filter/tests/firdes_autotest.c:339
+// adding firdes_prototype_fsech to package firdes from src/filter/tests/firdes_autotest.c:340
+// adding firdes_prototype_farcsech to package firdes from src/filter/tests/firdes_autotest.c:341
+// adding firdes_prototype_arkaiser to package firdes from src/filter/tests/firdes_autotest.c:342
+// adding firdes_prototype_rkaiser to package firdes from src/filter/tests/firdes_autotest.c:343
+// adding firdes_prototype_rrcos to package firdes from src/filter/tests/firdes_autotest.c:344
+// adding firdes_prototype_hm3 to package firdes from src/filter/tests/firdes_autotest.c:345
+// adding firdes_prototype_rfexp to package firdes from src/filter/tests/firdes_autotest.c:346
+// adding firdes_prototype_rfsech to package firdes from src/filter/tests/firdes_autotest.c:347
+// adding firdes_prototype_rfarcsech to package firdes from src/filter/tests/firdes_autotest.c:348
+// adding firdes_doppler to package firdes from src/filter/tests/firdes_autotest.c:353
+// adding liquid_freqrespf to package firdes from src/filter/tests/firdes_autotest.c:376
+// adding liquid_freqrespcf to package firdes from src/filter/tests/firdes_autotest.c:403
+// adding firdespm_bandpass_n24 to package firdespm from src/filter/tests/firdespm_autotest.c:33
+// adding firdespm_bandpass_n32 to package firdespm from src/filter/tests/firdespm_autotest.c:86
+// adding firdespm_lowpass to package firdespm from src/filter/tests/firdespm_autotest.c:148
+// adding firdespm_callback to package firdespm from src/filter/tests/firdespm_autotest.c:179
+// adding firdespm_halfband_m2_ft400 to package firdespm from src/filter/tests/firdespm_autotest.c:235
+// adding firdespm_halfband_m4_ft400 to package firdespm from src/filter/tests/firdespm_autotest.c:236
+// adding firdespm_halfband_m4_ft200 to package firdespm from src/filter/tests/firdespm_autotest.c:237
+// adding firdespm_halfband_m10_ft200 to package firdespm from src/filter/tests/firdespm_autotest.c:238
+// adding firdespm_halfband_m12_ft100 to package firdespm from src/filter/tests/firdespm_autotest.c:239
+// adding firdespm_halfband_m20_ft050 to package firdespm from src/filter/tests/firdespm_autotest.c:240
+// adding firdespm_halfband_m40_ft050 to package firdespm from src/filter/tests/firdespm_autotest.c:241
+// adding firdespm_halfband_m80_ft010 to package firdespm from src/filter/tests/firdespm_autotest.c:242
+// adding firdespm_lowpass_long to package firdespm from src/filter/tests/firdespm_autotest.c:245
+// adding firdespm_workers to package firdespm from src/filter/tests/firdespm_autotest.c:267
+// adding firdespm_copy to package firdespm from src/filter/tests/firdespm_autotest.c:283
+// adding firdespm_config to package firdespm from src/filter/tests/firdespm_autotest.c:306
+// adding firdespm_differentiator to package firdespm from src/filter/tests/firdespm_autotest.c:358
+// adding firdespm_hilbert to package firdespm from src/filter/tests/firdespm_autotest.c:382
+// adding firfilt_crcf_kaiser to package firfilt from src/filter/tests/firfilt_autotest.c:26
+// adding firfilt_crcf_firdespm to package firfilt from src/filter/tests/firfilt_autotest.c:43
+// adding firfilt_crcf_rect to package firfilt from src/filter/tests/firfilt_autotest.c:60
+// adding firfilt_crcf_notch to package firfilt from src/filter/tests/firfilt_autotest.c:77
+// adding firfilt_cccf_notch to package firfilt from src/filter/tests/firfilt_autotest.c:93
+// adding firfilt_config to package firfilt from src/filter/tests/firfilt_autotest.c:107
+// adding firfilt_recreate to package firfilt from src/filter/tests/firfilt_autotest.c:142
+// adding firfilt_push_write to package firfilt from src/filter/tests/firfilt_autotest.c:193
+// adding firfilt_cccf_notch_0 to package firfilt_cccf_notch from src/filter/tests/firfilt_cccf_notch_autotest.c:74
+// adding firfilt_cccf_notch_1 to package firfilt_cccf_notch from src/filter/tests/firfilt_cccf_notch_autotest.c:75
+// adding firfilt_cccf_notch_2 to package firfilt_cccf_notch from src/filter/tests/firfilt_cccf_notch_autotest.c:76
+// adding firfilt_cccf_notch_3 to package firfilt_cccf_notch from src/filter/tests/firfilt_cccf_notch_autotest.c:77
+// adding firfilt_cccf_notch_4 to package firfilt_cccf_notch from src/filter/tests/firfilt_cccf_notch_autotest.c:78
+// adding firfilt_cccf_notch_5 to package firfilt_cccf_notch from src/filter/tests/firfilt_cccf_notch_autotest.c:79
+// adding firfilt_cccf_coefficients_test to package firfilt_coefficients from src/filter/tests/firfilt_coefficients_autotest.c:28
+// adding firfilt_rnyquist_baseline_arkaiser to package firfilt_rnyquist from src/filter/tests/firfilt_rnyquist_autotest.c:94
+// adding firfilt_rnyquist_baseline_rkaiser to package firfilt_rnyquist from src/filter/tests/firfilt_rnyquist_autotest.c:95
+// adding firfilt_rnyquist_baseline_rrc to package firfilt_rnyquist from src/filter/tests/firfilt_rnyquist_autotest.c:96
+// adding firfilt_rnyquist_baseline_hm3 to package firfilt_rnyquist from src/filter/tests/firfilt_rnyquist_autotest.c:97
+// adding firfilt_rnyquist_baseline_gmsktxrx to package firfilt_rnyquist from src/filter/tests/firfilt_rnyquist_autotest.c:98
+// adding firfilt_rnyquist_baseline_rfexp to package firfilt_rnyquist from src/filter/tests/firfilt_rnyquist_autotest.c:99
+// adding firfilt_rnyquist_baseline_rfsech to package firfilt_rnyquist from src/filter/tests/firfilt_rnyquist_autotest.c:100
+// adding firfilt_rnyquist_baseline_rfarcsech to package firfilt_rnyquist from src/filter/tests/firfilt_rnyquist_autotest.c:101
+// adding firfilt_rnyquist_0 to package firfilt_rnyquist from src/filter/tests/firfilt_rnyquist_autotest.c:104
+// adding firfilt_rnyquist_1 to package firfilt_rnyquist from src/filter/tests/firfilt_rnyquist_autotest.c:105
+// adding firfilt_rnyquist_2 to package firfilt_rnyquist from src/filter/tests/firfilt_rnyquist_autotest.c:106
+// adding firfilt_rnyquist_3 to package firfilt_rnyquist from src/filter/tests/firfilt_rnyquist_autotest.c:107
+// adding firfilt_rnyquist_4 to package firfilt_rnyquist from src/filter/tests/firfilt_rnyquist_autotest.c:108
+// adding firfilt_rnyquist_5 to package firfilt_rnyquist from src/filter/tests/firfilt_rnyquist_autotest.c:109
+// adding firfilt_rnyquist_6 to package firfilt_rnyquist from src/filter/tests/firfilt_rnyquist_autotest.c:110
+// adding firfilt_rnyquist_7 to package firfilt_rnyquist from src/filter/tests/firfilt_rnyquist_autotest.c:111
+// adding firfilt_rnyquist_8 to package firfilt_rnyquist from src/filter/tests/firfilt_rnyquist_autotest.c:112
+// adding firfilt_rnyquist_9 to package firfilt_rnyquist from src/filter/tests/firfilt_rnyquist_autotest.c:113
+// adding firfilt_rrrf_data_h4x8 to package firfilt_xxxf from src/filter/tests/firfilt_xxxf_autotest.c:36
+// adding firfilt_rrrf_data_h7x16 to package firfilt_xxxf from src/filter/tests/firfilt_xxxf_autotest.c:42
+// adding firfilt_rrrf_data_h13x32 to package firfilt_xxxf from src/filter/tests/firfilt_xxxf_autotest.c:48
+// adding firfilt_rrrf_data_h23x64 to package firfilt_xxxf from src/filter/tests/firfilt_xxxf_autotest.c:54
+// adding firfilt_crcf_data_h4x8 to package firfilt_xxxf from src/filter/tests/firfilt_xxxf_autotest.c:65
+// adding firfilt_crcf_data_h7x16 to package firfilt_xxxf from src/filter/tests/firfilt_xxxf_autotest.c:71
+// adding firfilt_crcf_data_h13x32 to package firfilt_xxxf from src/filter/tests/firfilt_xxxf_autotest.c:77
+// adding firfilt_crcf_data_h23x64 to package firfilt_xxxf from src/filter/tests/firfilt_xxxf_autotest.c:83
+// adding firfilt_cccf_data_h4x8 to package firfilt_xxxf from src/filter/tests/firfilt_xxxf_autotest.c:94
+// adding firfilt_cccf_data_h7x16 to package firfilt_xxxf from src/filter/tests/firfilt_xxxf_autotest.c:100
+// adding firfilt_cccf_data_h13x32 to package firfilt_xxxf from src/filter/tests/firfilt_xxxf_autotest.c:106
+// adding firfilt_cccf_data_h23x64 to package firfilt_xxxf from src/filter/tests/firfilt_xxxf_autotest.c:112
+// adding firfilt_crcf_copy to package firfilt_copy from src/filter/tests/firfilt_copy_autotest.c:28
+// adding firhilbf_decim to package firhilb from src/filter/tests/firhilb_autotest.c:31
+// adding firhilbf_interp to package firhilb from src/filter/tests/firhilb_autotest.c:76
+// adding firhilbf_psd to package firhilb from src/filter/tests/firhilb_autotest.c:119
+// adding firhilbf_invalid_config to package firhilb from src/filter/tests/firhilb_autotest.c:183
+// adding firhilbf_copy_interp to package firhilb from src/filter/tests/firhilb_autotest.c:201
+// adding firhilbf_copy_decim to package firhilb from src/filter/tests/firhilb_autotest.c:233
+// adding firhilbf_r2c_block to package firhilb from src/filter/tests/firhilb_autotest.c:308
+// adding firhilbf_c2r_block to package firhilb from src/filter/tests/firhilb_autotest.c:337
+// adding firhilbf_decim_block to package firhilb from src/filter/tests/firhilb_autotest.c:366
+// adding firhilbf_interp_block to package firhilb from src/filter/tests/firhilb_autotest.c:395
+// adding firinterp_rrrf_common to package firinterp from src/filter/tests/firinterp_autotest.c:26
+// adding firinterp_crcf_common to package firinterp from src/filter/tests/firinterp_autotest.c:33
+// adding firinterp_rrrf_generic to package firinterp from src/filter/tests/firinterp_autotest.c:43
+// adding firinterp_crcf_generic to package firinterp from src/filter/tests/firinterp_autotest.c:99
+// adding firinterp_crcf_rnyquist_0 to package firinterp from src/filter/tests/firinterp_autotest.c:208
+// adding firinterp_crcf_rnyquist_1 to package firinterp from src/filter/tests/firinterp_autotest.c:211
+// adding firinterp_crcf_rnyquist_2 to package firinterp from src/filter/tests/firinterp_autotest.c:214
+// adding firinterp_crcf_rnyquist_3 to package firinterp from src/filter/tests/firinterp_autotest.c:217
+// adding firinterp_copy to package firinterp from src/filter/tests/firinterp_autotest.c:221
+// adding firinterp_flush to package firinterp from src/filter/tests/firinterp_autotest.c:253
+// adding firpfb_impulse_response to package firpfb from src/filter/tests/firpfb_autotest.c:27
+// adding firpfb_crcf_copy to package firpfb from src/filter/tests/firpfb_autotest.c:80
+// adding fir_groupdelay_n3 to package groupdelay from src/filter/tests/groupdelay_autotest.c:29
+// adding iir_groupdelay_n3 to package groupdelay from src/filter/tests/groupdelay_autotest.c:73
+// adding iir_groupdelay_n8 to package groupdelay from src/filter/tests/groupdelay_autotest.c:117
+// adding iir_groupdelay_sos_n8 to package groupdelay from src/filter/tests/groupdelay_autotest.c:188
+// adding iirdecim_copy to package iirdecim from src/filter/tests/iirdecim_autotest.c:27
+// adding iirdes_butter_2 to package iirdes from src/filter/tests/iirdes_autotest.c:32
+// adding iirdes_ellip_lowpass_0 to package iirdes from src/filter/tests/iirdes_autotest.c:108
+// adding iirdes_ellip_lowpass_1 to package iirdes from src/filter/tests/iirdes_autotest.c:109
+// adding iirdes_ellip_lowpass_2 to package iirdes from src/filter/tests/iirdes_autotest.c:110
+// adding iirdes_ellip_lowpass_3 to package iirdes from src/filter/tests/iirdes_autotest.c:111
+// adding iirdes_ellip_lowpass_4 to package iirdes from src/filter/tests/iirdes_autotest.c:112
+// adding iirdes_cheby1_lowpass_0 to package iirdes from src/filter/tests/iirdes_autotest.c:144
+// adding iirdes_cheby1_lowpass_1 to package iirdes from src/filter/tests/iirdes_autotest.c:145
+// adding iirdes_cheby1_lowpass_2 to package iirdes from src/filter/tests/iirdes_autotest.c:146
+// adding iirdes_cheby1_lowpass_3 to package iirdes from src/filter/tests/iirdes_autotest.c:147
+// adding iirdes_cheby1_lowpass_4 to package iirdes from src/filter/tests/iirdes_autotest.c:148
+// adding iirdes_cheby2_lowpass_0 to package iirdes from src/filter/tests/iirdes_autotest.c:180
+// adding iirdes_cheby2_lowpass_1 to package iirdes from src/filter/tests/iirdes_autotest.c:181
+// adding iirdes_cheby2_lowpass_2 to package iirdes from src/filter/tests/iirdes_autotest.c:183
+// adding iirdes_cheby2_lowpass_3 to package iirdes from src/filter/tests/iirdes_autotest.c:184
+// adding iirdes_cheby2_lowpass_4 to package iirdes from src/filter/tests/iirdes_autotest.c:186
+// adding iirdes_butter_lowpass_0 to package iirdes from src/filter/tests/iirdes_autotest.c:217
+// adding iirdes_butter_lowpass_1 to package iirdes from src/filter/tests/iirdes_autotest.c:218
+// adding iirdes_butter_lowpass_2 to package iirdes from src/filter/tests/iirdes_autotest.c:219
+// adding iirdes_butter_lowpass_3 to package iirdes from src/filter/tests/iirdes_autotest.c:220
+// adding iirdes_butter_lowpass_4 to package iirdes from src/filter/tests/iirdes_autotest.c:221
+// adding iirdes_ellip_highpass to package iirdes from src/filter/tests/iirdes_autotest.c:224
+// adding iirdes_ellip_bandpass to package iirdes from src/filter/tests/iirdes_autotest.c:251
+// adding iirdes_ellip_bandstop to package iirdes from src/filter/tests/iirdes_autotest.c:281
+// adding iirdes_bessel to package iirdes from src/filter/tests/iirdes_autotest.c:312
+// adding iirdes_cplxpair_n6 to package iirdes_support from src/filter/tests/iirdes_support_autotest.c:28
+// adding iirdes_cplxpair_n20 to package iirdes_support from src/filter/tests/iirdes_support_autotest.c:77
+// adding iirdes_dzpk2sosf to package iirdes_support from src/filter/tests/iirdes_support_autotest.c:153
+// adding iirdes_isstable_n2_yes to package iirdes_support from src/filter/tests/iirdes_support_autotest.c:201
+// adding iirdes_isstable_n2_no to package iirdes_support from src/filter/tests/iirdes_support_autotest.c:221
+// adding iirfilt_integrator to package iirfilt from src/filter/tests/iirfilt_autotest.c:26
+// adding iirfilt_differentiator to package iirfilt from src/filter/tests/iirfilt_autotest.c:53
+// adding iirfilt_dcblock to package iirfilt from src/filter/tests/iirfilt_autotest.c:79
+// adding iirfilt_copy_tf to package iirfilt from src/filter/tests/iirfilt_autotest.c:156
+// adding iirfilt_copy_sos to package iirfilt from src/filter/tests/iirfilt_autotest.c:157
+// adding iirfilt_config to package iirfilt from src/filter/tests/iirfilt_autotest.c:160
+// adding iirfilt_rrrf_h3x64 to package iirfilt_xxxf from src/filter/tests/iirfilt_xxxf_autotest.c:36
+// adding iirfilt_rrrf_h5x64 to package iirfilt_xxxf from src/filter/tests/iirfilt_xxxf_autotest.c:43
+// adding iirfilt_rrrf_h7x64 to package iirfilt_xxxf from src/filter/tests/iirfilt_xxxf_autotest.c:50
+// adding iirfilt_crcf_h3x64 to package iirfilt_xxxf from src/filter/tests/iirfilt_xxxf_autotest.c:62
+// adding iirfilt_crcf_h5x64 to package iirfilt_xxxf from src/filter/tests/iirfilt_xxxf_autotest.c:69
+// adding iirfilt_crcf_h7x64 to package iirfilt_xxxf from src/filter/tests/iirfilt_xxxf_autotest.c:76
+// adding iirfilt_cccf_h3x64 to package iirfilt_xxxf from src/filter/tests/iirfilt_xxxf_autotest.c:88
+// adding iirfilt_cccf_h5x64 to package iirfilt_xxxf from src/filter/tests/iirfilt_xxxf_autotest.c:95
+// adding iirfilt_cccf_h7x64 to package iirfilt_xxxf from src/filter/tests/iirfilt_xxxf_autotest.c:102
+// adding iirfiltbank_crcf_channels to package iirfiltbank from src/filter/tests/iirfiltbank_autotest.c:29
+// adding iirfiltbank_rrrf_dcblock_block to package iirfiltbank from src/filter/tests/iirfiltbank_autotest.c:68
+// adding iirfiltbank_crcf_lookahead_n4_1024 to package iirfiltbank from src/filter/tests/iirfiltbank_autotest.c:128
+// adding iirfiltbank_crcf_lookahead_n7_1500 to package iirfiltbank from src/filter/tests/iirfiltbank_autotest.c:129
+// adding iirfiltbank_crcf_lookahead_n3_4099 to package iirfiltbank from src/filter/tests/iirfiltbank_autotest.c:130
+// adding iirfiltbank_copy to package iirfiltbank from src/filter/tests/iirfiltbank_autotest.c:132
+// adding iirfiltbank_config to package iirfiltbank from src/filter/tests/iirfiltbank_autotest.c:163
+// adding iirfiltsos_impulse_n2 to package iirfiltsos from src/filter/tests/iirfiltsos_autotest.c:26
+// adding iirfiltsos_step_n2 to package iirfiltsos from src/filter/tests/iirfiltsos_autotest.c:84
+// adding iirfiltsos_copy to package iirfiltsos from src/filter/tests/iirfiltsos_autotest.c:137
+// adding iirfiltsos_config to package iirfiltsos from src/filter/tests/iirfiltsos_autotest.c:173
+// adding iirhilbf_interp_decim to package iirhilb from src/filter/tests/iirhilb_autotest.c:27
+// adding iirhilbf_filter to package iirhilb from src/filter/tests/iirhilb_autotest.c:93
+// adding iirhilbf_invalid_config to package iirhilb from src/filter/tests/iirhilb_autotest.c:175
+// adding iirhilbf_copy_interp to package iirhilb from src/filter/tests/iirhilb_autotest.c:194
+// adding iirhilbf_copy_decim to package iirhilb from src/filter/tests/iirhilb_autotest.c:227
+// adding iirinterp_crcf_M2_O9 to package iirinterp from src/filter/tests/iirinterp_autotest.c:81
+// adding iirinterp_crcf_M3_O9 to package iirinterp from src/filter/tests/iirinterp_autotest.c:82
+// adding iirinterp_crcf_M4_O9 to package iirinterp from src/filter/tests/iirinterp_autotest.c:83
+// adding iirinterp_copy to package iirinterp from src/filter/tests/iirinterp_autotest.c:86
+// adding lpc_p4 to package lpc from src/filter/tests/lpc_autotest.c:104
+// adding lpc_p6 to package lpc from src/filter/tests/lpc_autotest.c:105
+// adding lpc_p8 to package lpc from src/filter/tests/lpc_autotest.c:106
+// adding lpc_p10 to package lpc from src/filter/tests/lpc_autotest.c:107
+// adding lpc_p16 to package lpc from src/filter/tests/lpc_autotest.c:108
+// adding lpc_p32 to package lpc from src/filter/tests/lpc_autotest.c:109
+// adding msresamp_crcf_01 to package msresamp_crcf from src/filter/tests/msresamp_crcf_autotest.c:78
+// adding msresamp_crcf_02 to package msresamp_crcf from src/filter/tests/msresamp_crcf_autotest.c:79
+// adding msresamp_crcf_03 to package msresamp_crcf from src/filter/tests/msresamp_crcf_autotest.c:80
+// adding msresamp_crcf_num_output_0 to package msresamp_crcf from src/filter/tests/msresamp_crcf_autotest.c:129
+// adding msresamp_crcf_num_output_1 to package msresamp_crcf from src/filter/tests/msresamp_crcf_autotest.c:130
+// adding msresamp_crcf_num_output_2 to package msresamp_crcf from src/filter/tests/msresamp_crcf_autotest.c:131
+// adding msresamp_crcf_num_output_3 to package msresamp_crcf from src/filter/tests/msresamp_crcf_autotest.c:132
+// adding msresamp_crcf_num_output_4 to package msresamp_crcf from src/filter/tests/msresamp_crcf_autotest.c:133
+// adding msresamp_crcf_num_output_5 to package msresamp_crcf from src/filter/tests/msresamp_crcf_autotest.c:134
+// adding msresamp_crcf_num_output_6 to package msresamp_crcf from src/filter/tests/msresamp_crcf_autotest.c:135
+// adding msresamp_crcf_num_output_7 to package msresamp_crcf from src/filter/tests/msresamp_crcf_autotest.c:136
+// adding msresamp_crcf_copy to package msresamp_crcf from src/filter/tests/msresamp_crcf_autotest.c:139
+// adding msresamp2_crcf_interp_01 to package msresamp2_crcf from src/filter/tests/msresamp2_crcf_autotest.c:80
+// adding msresamp2_crcf_interp_02 to package msresamp2_crcf from src/filter/tests/msresamp2_crcf_autotest.c:81
+// adding msresamp2_crcf_interp_03 to package msresamp2_crcf from src/filter/tests/msresamp2_crcf_autotest.c:82
+// adding msresamp2_crcf_interp_04 to package msresamp2_crcf from src/filter/tests/msresamp2_crcf_autotest.c:83
+// adding msresamp2_crcf_interp_05 to package msresamp2_crcf from src/filter/tests/msresamp2_crcf_autotest.c:85
+// adding msresamp2_crcf_interp_06 to package msresamp2_crcf from src/filter/tests/msresamp2_crcf_autotest.c:86
+// adding msresamp2_crcf_interp_07 to package msresamp2_crcf from src/filter/tests/msresamp2_crcf_autotest.c:87
+// adding msresamp2_crcf_interp_08 to package msresamp2_crcf from src/filter/tests/msresamp2_crcf_autotest.c:88
+// adding msresamp2_crcf_interp_09 to package msresamp2_crcf from src/filter/tests/msresamp2_crcf_autotest.c:90
+// adding msresamp2_crcf_interp_10 to package msresamp2_crcf from src/filter/tests/msresamp2_crcf_autotest.c:91
+// adding msresamp2_crcf_interp_11 to package msresamp2_crcf from src/filter/tests/msresamp2_crcf_autotest.c:92
+// adding msresamp2_copy to package msresamp2_crcf from src/filter/tests/msresamp2_crcf_autotest.c:96
+// adding ordfilt_copy to package ordfilt from src/filter/tests/ordfilt_autotest.c:27
+// adding rresamp_crcf_baseline_P1_Q5 to package rresamp_crcf from src/filter/tests/rresamp_crcf_autotest.c:99
+// adding rresamp_crcf_baseline_P2_Q5 to package rresamp_crcf from src/filter/tests/rresamp_crcf_autotest.c:100
+// adding rresamp_crcf_baseline_P3_Q5 to package rresamp_crcf from src/filter/tests/rresamp_crcf_autotest.c:101
+// adding rresamp_crcf_baseline_P6_Q5 to package rresamp_crcf from src/filter/tests/rresamp_crcf_autotest.c:102
+// adding rresamp_crcf_baseline_P8_Q5 to package rresamp_crcf from src/filter/tests/rresamp_crcf_autotest.c:103
+// adding rresamp_crcf_baseline_P9_Q5 to package rresamp_crcf from src/filter/tests/rresamp_crcf_autotest.c:104
+// adding rresamp_crcf_default_P1_Q5 to package rresamp_crcf from src/filter/tests/rresamp_crcf_autotest.c:107
+// adding rresamp_crcf_default_P2_Q5 to package rresamp_crcf from src/filter/tests/rresamp_crcf_autotest.c:108
+// adding rresamp_crcf_default_P3_Q5 to package rresamp_crcf from src/filter/tests/rresamp_crcf_autotest.c:109
+// adding rresamp_crcf_default_P6_Q5 to package rresamp_crcf from src/filter/tests/rresamp_crcf_autotest.c:110
+// adding rresamp_crcf_default_P8_Q5 to package rresamp_crcf from src/filter/tests/rresamp_crcf_autotest.c:111
+// adding rresamp_crcf_default_P9_Q5 to package rresamp_crcf from src/filter/tests/rresamp_crcf_autotest.c:112
+// adding rresamp_crcf_arkaiser_P3_Q5 to package rresamp_crcf from src/filter/tests/rresamp_crcf_autotest.c:115
+// adding rresamp_crcf_arkaiser_P5_Q3 to package rresamp_crcf from src/filter/tests/rresamp_crcf_autotest.c:116
+// adding rresamp_crcf_rrcos_P3_Q5 to package rresamp_crcf from src/filter/tests/rresamp_crcf_autotest.c:117
+// adding rresamp_crcf_rrcos_P5_Q3 to package rresamp_crcf from src/filter/tests/rresamp_crcf_autotest.c:118
+// adding rresamp_copy to package rresamp_crcf from src/filter/tests/rresamp_crcf_autotest.c:121
+// adding rresamp_config to package rresamp_crcf from src/filter/tests/rresamp_crcf_autotest.c:166
+// adding rresamp_crcf_part_P1_Q5 to package rresamp_crcf_partition from src/filter/tests/rresamp_crcf_partition_autotest.c:76
+// adding rresamp_crcf_part_P2_Q5 to package rresamp_crcf_partition from src/filter/tests/rresamp_crcf_partition_autotest.c:77
+// adding rresamp_crcf_part_P3_Q5 to package rresamp_crcf_partition from src/filter/tests/rresamp_crcf_partition_autotest.c:78
+// adding rresamp_crcf_part_P6_Q5 to package rresamp_crcf_partition from src/filter/tests/rresamp_crcf_partition_autotest.c:79
+// adding rresamp_crcf_part_P8_Q5 to package rresamp_crcf_partition from src/filter/tests/rresamp_crcf_partition_autotest.c:80
+// adding rresamp_crcf_part_P9_Q5 to package rresamp_crcf_partition from src/filter/tests/rresamp_crcf_partition_autotest.c:81
+// adding resamp_crcf_00 to package resamp_crcf from src/filter/tests/resamp_crcf_autotest.c:76
+// adding resamp_crcf_01 to package resamp_crcf from src/filter/tests/resamp_crcf_autotest.c:77
+// adding resamp_crcf_02 to package resamp_crcf from src/filter/tests/resamp_crcf_autotest.c:78
+// adding resamp_crcf_03 to package resamp_crcf from src/filter/tests/resamp_crcf_autotest.c:79
+// adding resamp_crcf_10 to package resamp_crcf from src/filter/tests/resamp_crcf_autotest.c:84
+// adding resamp_crcf_11 to package resamp_crcf from src/filter/tests/resamp_crcf_autotest.c:85
+// adding resamp_crcf_12 to package resamp_crcf from src/filter/tests/resamp_crcf_autotest.c:86
+// adding resamp_crcf_13 to package resamp_crcf from src/filter/tests/resamp_crcf_autotest.c:87
+// adding resamp_crcf_num_output_0 to package resamp_crcf from src/filter/tests/resamp_crcf_autotest.c:134
+// adding resamp_crcf_num_output_1 to package resamp_crcf from src/filter/tests/resamp_crcf_autotest.c:135
+// adding resamp_crcf_num_output_2 to package resamp_crcf from src/filter/tests/resamp_crcf_autotest.c:136
+// adding resamp_crcf_num_output_3 to package resamp_crcf from src/filter/tests/resamp_crcf_autotest.c:137
+// adding resamp_crcf_num_output_4 to package resamp_crcf from src/filter/tests/resamp_crcf_autotest.c:138
+// adding resamp_crcf_num_output_5 to package resamp_crcf from src/filter/tests/resamp_crcf_autotest.c:139
+// adding resamp_crcf_num_output_6 to package resamp_crcf from src/filter/tests/resamp_crcf_autotest.c:140
+// adding resamp_crcf_num_output_7 to package resamp_crcf from src/filter/tests/resamp_crcf_autotest.c:141
+// adding resamp_crcf_copy to package resamp_crcf from src/filter/tests/resamp_crcf_autotest.c:144
+// adding resamp2_analysis to package resamp2_crcf from src/filter/tests/resamp2_crcf_autotest.c:27
+// adding resamp2_synthesis to package resamp2_crcf from src/filter/tests/resamp2_crcf_autotest.c:99
+// adding resamp2_crcf_filter_0 to package resamp2_crcf from src/filter/tests/resamp2_crcf_autotest.c:215
+// adding resamp2_crcf_filter_1 to package resamp2_crcf from src/filter/tests/resamp2_crcf_autotest.c:216
+// adding resamp2_crcf_filter_2 to package resamp2_crcf from src/filter/tests/resamp2_crcf_autotest.c:217
+// adding resamp2_crcf_filter_3 to package resamp2_crcf from src/filter/tests/resamp2_crcf_autotest.c:218
+// adding resamp2_crcf_filter_4 to package resamp2_crcf from src/filter/tests/resamp2_crcf_autotest.c:219
+// adding resamp2_crcf_filter_5 to package resamp2_crcf from src/filter/tests/resamp2_crcf_autotest.c:220
+// adding resamp2_config to package resamp2_crcf from src/filter/tests/resamp2_crcf_autotest.c:222
+// adding resamp2_copy to package resamp2_crcf from src/filter/tests/resamp2_crcf_autotest.c:262
+// adding liquid_rkaiser_config to package rkaiser from src/filter/tests/rkaiser_autotest.c:26
+// adding symsync_copy to package symsync_copy from src/filter/tests/symsync_copy_autotest.c:27
+// adding symsync_config to package symsync_copy from src/filter/tests/symsync_copy_autotest.c:71
+// adding symsync_crcf_scenario_0 to package symsync_crcf from src/filter/tests/symsync_crcf_autotest.c:177
+// adding symsync_crcf_scenario_1 to package symsync_crcf from src/filter/tests/symsync_crcf_autotest.c:178
+// adding symsync_crcf_scenario_2 to package symsync_crcf from src/filter/tests/symsync_crcf_autotest.c:179
+// adding symsync_crcf_scenario_3 to package symsync_crcf from src/filter/tests/symsync_crcf_autotest.c:180
+// adding symsync_crcf_scenario_4 to package symsync_crcf from src/filter/tests/symsync_crcf_autotest.c:183
+// adding symsync_crcf_scenario_5 to package symsync_crcf from src/filter/tests/symsync_crcf_autotest.c:184
+// adding symsync_crcf_scenario_6 to package symsync_crcf from src/filter/tests/symsync_crcf_autotest.c:185
+// adding symsync_crcf_scenario_7 to package symsync_crcf from src/filter/tests/symsync_crcf_autotest.c:186
+// adding symsync_crcf_fused_mf to package symsync_crcf from src/filter/tests/symsync_crcf_autotest.c:191
+// adding symsync_crcf_block to package symsync_crcf from src/filter/tests/symsync_crcf_autotest.c:233
+// adding symsync_rrrf_scenario_0 to package symsync_rrrf from src/filter/tests/symsync_rrrf_autotest.c:173
+// adding symsync_rrrf_scenario_1 to package symsync_rrrf from src/filter/tests/symsync_rrrf_autotest.c:174
+// adding symsync_rrrf_scenario_2 to package symsync_rrrf from src/filter/tests/symsync_rrrf_autotest.c:175
+// adding symsync_rrrf_scenario_3 to package symsync_rrrf from src/filter/tests/symsync_rrrf_autotest.c:176
+// adding symsync_rrrf_scenario_4 to package symsync_rrrf from src/filter/tests/symsync_rrrf_autotest.c:179
+// adding symsync_rrrf_scenario_5 to package symsync_rrrf from src/filter/tests/symsync_rrrf_autotest.c:180
+// adding symsync_rrrf_scenario_6 to package symsync_rrrf from src/filter/tests/symsync_rrrf_autotest.c:181
+// adding symsync_rrrf_scenario_7 to package symsync_rrrf from src/filter/tests/symsync_rrrf_autotest.c:182
+// adding bpacketsync to package bpacketsync from src/framing/tests/bpacketsync_autotest.c:47
+// adding bsync_rrrf_15 to package bsync from src/framing/tests/bsync_autotest.c:29
+// adding bsync_crcf_15 to package bsync from src/framing/tests/bsync_autotest.c:70
+// adding detector_cccf_n64 to package detector from src/framing/tests/detector_autotest.c:39
+// adding detector_cccf_n83 to package detector from src/framing/tests/detector_autotest.c:40
+// adding detector_cccf_n128 to package detector from src/framing/tests/detector_autotest.c:42
+// adding detector_cccf_n167 to package detector from src/framing/tests/detector_autotest.c:43
+// adding detector_cccf_n256 to package detector from src/framing/tests/detector_autotest.c:45
+// adding detector_cccf_n335 to package detector from src/framing/tests/detector_autotest.c:46
+// adding detector_cccf_n512 to package detector from src/framing/tests/detector_autotest.c:48
+// adding detector_cccf_n671 to package detector from src/framing/tests/detector_autotest.c:49
+// adding detector_cccf_n1024 to package detector from src/framing/tests/detector_autotest.c:51
+// adding detector_cccf_n1341 to package detector from src/framing/tests/detector_autotest.c:52
+// adding dsssframe64sync to package dsssframe64 from src/framing/tests/dsssframe64_autotest.c:30
+// adding dsssframe64_config to package dsssframe64 from src/framing/tests/dsssframe64_autotest.c:67
+// adding dsssframe64gen_copy to package dsssframe64 from src/framing/tests/dsssframe64_autotest.c:103
+// adding dsssframe64sync_copy to package dsssframe64 from src/framing/tests/dsssframe64_autotest.c:134
+// adding dsssframesync to package dsssframesync from src/framing/tests/dsssframesync_autotest.c:29
+// adding flexframesync to package flexframesync from src/framing/tests/flexframesync_autotest.c:32
+// adding framesync64 to package framesync64 from src/framing/tests/framesync64_autotest.c:31
+// adding framegen64_copy to package framesync64 from src/framing/tests/framesync64_autotest.c:67
+// adding framesync64_copy to package framesync64 from src/framing/tests/framesync64_autotest.c:82
+// adding framesync64_config to package framesync64 from src/framing/tests/framesync64_autotest.c:144
+// adding framesync64_debug_none to package framesync64 from src/framing/tests/framesync64_autotest.c:250
+// adding framesync64_debug_user to package framesync64 from src/framing/tests/framesync64_autotest.c:251
+// adding framesync64_debug_ndet to package framesync64 from src/framing/tests/framesync64_autotest.c:252
+// adding framesync64_debug_head to package framesync64 from src/framing/tests/framesync64_autotest.c:253
+// adding framesync64_debug_rand to package framesync64 from src/framing/tests/framesync64_autotest.c:254
+// adding framesync64_estimation to package framesync64 from src/framing/tests/framesync64_autotest.c:288
+// adding framesync64_batch_w1 to package framesync_batch from src/framing/tests/framesync_batch_autotest.c:111
+// adding framesync64_batch_w4 to package framesync_batch from src/framing/tests/framesync_batch_autotest.c:112
+// adding flexframesync_batch_w1 to package framesync_batch from src/framing/tests/framesync_batch_autotest.c:158
+// adding flexframesync_batch_w3 to package framesync_batch from src/framing/tests/framesync_batch_autotest.c:159
+// adding framesync64_batch_streaming to package framesync_batch from src/framing/tests/framesync_batch_autotest.c:162
+// adding framesync_batch_config to package framesync_batch from src/framing/tests/framesync_batch_autotest.c:194
+// adding fskframesync to package fskframesync from src/framing/tests/fskframesync_autotest.c:31
+// adding gmskframesync_process to package gmskframe from src/framing/tests/gmskframe_autotest.c:30
+// adding gmskframesync_multiple to package gmskframe from src/framing/tests/gmskframe_autotest.c:88
+// adding gmskframesync_k02_m05_bt20 to package gmskframe from src/framing/tests/gmskframe_autotest.c:164
+// adding gmskframesync_k02_m05_bt30 to package gmskframe from src/framing/tests/gmskframe_autotest.c:165
+// adding gmskframesync_k02_m05_bt40 to package gmskframe from src/framing/tests/gmskframe_autotest.c:166
+// adding gmskframesync_k04_m05_bt20 to package gmskframe from src/framing/tests/gmskframe_autotest.c:169
+// adding gmskframesync_k04_m05_bt30 to package gmskframe from src/framing/tests/gmskframe_autotest.c:170
+// adding gmskframesync_k04_m05_bt40 to package gmskframe from src/framing/tests/gmskframe_autotest.c:171
+// adding gmskframesync_k03_m07_bt20 to package gmskframe from src/framing/tests/gmskframe_autotest.c:174
+// adding gmskframesync_k08_m20_bt15 to package gmskframe from src/framing/tests/gmskframe_autotest.c:175
+// adding gmskframesync_k15_m02_bt40 to package gmskframe from src/framing/tests/gmskframe_autotest.c:176
+// adding msourcecf_tone to package msource from src/framing/tests/msource_autotest.c:41
+// adding msourcecf_chirp to package msource from src/framing/tests/msource_autotest.c:103
+// adding msourcecf_aggregate to package msource from src/framing/tests/msource_autotest.c:149
+// adding msourcecf_config to package msource from src/framing/tests/msource_autotest.c:249
+// adding msourcecf_accessor to package msource from src/framing/tests/msource_autotest.c:306
+// adding msourcecf_copy to package msource from src/framing/tests/msource_autotest.c:385
+// adding presync_bank_n64 to package presync from src/framing/tests/presync_autotest.c:106
+// adding presync_fft_n64 to package presync from src/framing/tests/presync_autotest.c:107
+// adding presync_fft_n64_neg to package presync from src/framing/tests/presync_autotest.c:108
+// adding presync_fft_n256 to package presync from src/framing/tests/presync_autotest.c:109
+// adding presync_fft_n256_zero to package presync from src/framing/tests/presync_autotest.c:110
+// adding bpresync_bank_n64 to package presync from src/framing/tests/presync_autotest.c:111
+// adding bpresync_fft_n64 to package presync from src/framing/tests/presync_autotest.c:112
+// adding bpresync_fft_n256_neg to package presync from src/framing/tests/presync_autotest.c:113
+// adding presync_fft_block to package presync from src/framing/tests/presync_autotest.c:116
+// adding presync_config to package presync from src/framing/tests/presync_autotest.c:147
+// adding ofdmflexframe_00 to package ofdmflexframe from src/framing/tests/ofdmflexframe_autotest.c:87
+// adding ofdmflexframe_01 to package ofdmflexframe from src/framing/tests/ofdmflexframe_autotest.c:88
+// adding ofdmflexframe_02 to package ofdmflexframe from src/framing/tests/ofdmflexframe_autotest.c:89
+// adding ofdmflexframe_03 to package ofdmflexframe from src/framing/tests/ofdmflexframe_autotest.c:90
+// adding ofdmflexframe_04 to package ofdmflexframe from src/framing/tests/ofdmflexframe_autotest.c:91
+// adding ofdmflexframe_05 to package ofdmflexframe from src/framing/tests/ofdmflexframe_autotest.c:92
+// adding ofdmflexframe_06 to package ofdmflexframe from src/framing/tests/ofdmflexframe_autotest.c:93
+// adding ofdmflexframe_07 to package ofdmflexframe from src/framing/tests/ofdmflexframe_autotest.c:94
+// adding ofdmflexframe_08 to package ofdmflexframe from src/framing/tests/ofdmflexframe_autotest.c:95
+// adding ofdmflexframe_09 to package ofdmflexframe from src/framing/tests/ofdmflexframe_autotest.c:96
+// adding ofdmflexframegen_config to package ofdmflexframe from src/framing/tests/ofdmflexframe_autotest.c:98
+// adding ofdmflexframesync_config to package ofdmflexframe from src/framing/tests/ofdmflexframe_autotest.c:122
+// adding qdetector_cccf_linear_n64 to package qdetector_cccf from src/framing/tests/qdetector_cccf_autotest.c:37
+// adding qdetector_cccf_linear_n83 to package qdetector_cccf from src/framing/tests/qdetector_cccf_autotest.c:38
+// adding qdetector_cccf_linear_n128 to package qdetector_cccf from src/framing/tests/qdetector_cccf_autotest.c:39
+// adding qdetector_cccf_linear_n167 to package qdetector_cccf from src/framing/tests/qdetector_cccf_autotest.c:40
+// adding qdetector_cccf_linear_n256 to package qdetector_cccf from src/framing/tests/qdetector_cccf_autotest.c:41
+// adding qdetector_cccf_linear_n335 to package qdetector_cccf from src/framing/tests/qdetector_cccf_autotest.c:42
+// adding qdetector_cccf_linear_n512 to package qdetector_cccf from src/framing/tests/qdetector_cccf_autotest.c:43
+// adding qdetector_cccf_linear_n671 to package qdetector_cccf from src/framing/tests/qdetector_cccf_autotest.c:44
+// adding qdetector_cccf_linear_n1024 to package qdetector_cccf from src/framing/tests/qdetector_cccf_autotest.c:45
+// adding qdetector_cccf_linear_n1341 to package qdetector_cccf from src/framing/tests/qdetector_cccf_autotest.c:46
+// adding qdetector_cccf_gmsk_n64 to package qdetector_cccf from src/framing/tests/qdetector_cccf_autotest.c:49
+// adding qdetector_cccf_gmsk_n83 to package qdetector_cccf from src/framing/tests/qdetector_cccf_autotest.c:50
+// adding qdetector_cccf_gmsk_n128 to package qdetector_cccf from src/framing/tests/qdetector_cccf_autotest.c:51
+// adding qdetector_cccf_gmsk_n167 to package qdetector_cccf from src/framing/tests/qdetector_cccf_autotest.c:52
+// adding qdetector_cccf_gmsk_n256 to package qdetector_cccf from src/framing/tests/qdetector_cccf_autotest.c:53
+// adding qdetector_cccf_gmsk_n335 to package qdetector_cccf from src/framing/tests/qdetector_cccf_autotest.c:54
+// adding qdetector_cccf_gmsk_n512 to package qdetector_cccf from src/framing/tests/qdetector_cccf_autotest.c:55
+// adding qdetector_cccf_gmsk_n671 to package qdetector_cccf from src/framing/tests/qdetector_cccf_autotest.c:56
+// adding qdetector_cccf_gmsk_n1024 to package qdetector_cccf from src/framing/tests/qdetector_cccf_autotest.c:57
+// adding qdetector_cccf_gmsk_n1341 to package qdetector_cccf from src/framing/tests/qdetector_cccf_autotest.c:58
+// adding qdetector_cccf_copy to package qdetector_cccf_copy from src/framing/tests/qdetector_cccf_copy_autotest.c:30
+// adding qdsync_cccf_k2 to package qdsync_cccf from src/framing/tests/qdsync_cccf_autotest.c:159
+// adding qdsync_cccf_k3 to package qdsync_cccf from src/framing/tests/qdsync_cccf_autotest.c:160
+// adding qdsync_cccf_k4 to package qdsync_cccf from src/framing/tests/qdsync_cccf_autotest.c:161
+// adding qdsync_set_buf_len to package qdsync_cccf from src/framing/tests/qdsync_cccf_autotest.c:164
+// adding qdsync_cccf_copy to package qdsync_cccf from src/framing/tests/qdsync_cccf_autotest.c:221
+// adding qdsync_cccf_config to package qdsync_cccf from src/framing/tests/qdsync_cccf_autotest.c:304
+// adding qpacketmodem_bpsk to package qpacketmodem from src/framing/tests/qpacketmodem_autotest.c:77
+// adding qpacketmodem_qpsk to package qpacketmodem from src/framing/tests/qpacketmodem_autotest.c:78
+// adding qpacketmodem_psk8 to package qpacketmodem from src/framing/tests/qpacketmodem_autotest.c:79
+// adding qpacketmodem_qam16 to package qpacketmodem from src/framing/tests/qpacketmodem_autotest.c:80
+// adding qpacketmodem_sqam32 to package qpacketmodem from src/framing/tests/qpacketmodem_autotest.c:81
+// adding qpacketmodem_qam64 to package qpacketmodem from src/framing/tests/qpacketmodem_autotest.c:82
+// adding qpacketmodem_sqam128 to package qpacketmodem from src/framing/tests/qpacketmodem_autotest.c:83
+// adding qpacketmodem_qam256 to package qpacketmodem from src/framing/tests/qpacketmodem_autotest.c:84
+// adding qpacketmodem_ldpc12 to package qpacketmodem from src/framing/tests/qpacketmodem_autotest.c:85
+// adding qpacketmodem_ldpc34 to package qpacketmodem from src/framing/tests/qpacketmodem_autotest.c:86
+// adding qpacketmodem_evm to package qpacketmodem from src/framing/tests/qpacketmodem_autotest.c:89
+// adding qpacketmodem_unmod_bpsk to package qpacketmodem from src/framing/tests/qpacketmodem_autotest.c:184
+// adding qpacketmodem_unmod_qpsk to package qpacketmodem from src/framing/tests/qpacketmodem_autotest.c:185
+// adding qpacketmodem_unmod_psk8 to package qpacketmodem from src/framing/tests/qpacketmodem_autotest.c:186
+// adding qpacketmodem_unmod_qam16 to package qpacketmodem from src/framing/tests/qpacketmodem_autotest.c:187
+// adding qpacketmodem_unmod_sqam32 to package qpacketmodem from src/framing/tests/qpacketmodem_autotest.c:188
+// adding qpacketmodem_unmod_qam64 to package qpacketmodem from src/framing/tests/qpacketmodem_autotest.c:189
+// adding qpacketmodem_unmod_sqam128 to package qpacketmodem from src/framing/tests/qpacketmodem_autotest.c:190
+// adding qpacketmodem_unmod_qam256 to package qpacketmodem from src/framing/tests/qpacketmodem_autotest.c:191
+// adding qpacketmodem_copy to package qpacketmodem from src/framing/tests/qpacketmodem_autotest.c:194
+// adding qpilotsync_100_16 to package qpilotsync from src/framing/tests/qpilotsync_autotest.c:181
+// adding qpilotsync_200_20 to package qpilotsync from src/framing/tests/qpilotsync_autotest.c:182
+// adding qpilotsync_300_24 to package qpilotsync from src/framing/tests/qpilotsync_autotest.c:183
+// adding qpilotsync_400_28 to package qpilotsync from src/framing/tests/qpilotsync_autotest.c:184
+// adding qpilotsync_500_32 to package qpilotsync from src/framing/tests/qpilotsync_autotest.c:185
+// adding qpilotgen_config to package qpilotsync from src/framing/tests/qpilotsync_autotest.c:187
+// adding qpilotsync_config to package qpilotsync from src/framing/tests/qpilotsync_autotest.c:209
+// adding qsourcecf_config to package qsource from src/framing/tests/qsource_autotest.c:27
+// adding symstreamcf_psd_k2_m12_b030 to package symstreamcf from src/framing/tests/symstreamcf_autotest.c:81
+// adding symstreamcf_psd_k4_m12_b030 to package symstreamcf from src/framing/tests/symstreamcf_autotest.c:82
+// adding symstreamcf_psd_k4_m25_b020 to package symstreamcf from src/framing/tests/symstreamcf_autotest.c:83
+// adding symstreamcf_psd_k7_m11_b035 to package symstreamcf from src/framing/tests/symstreamcf_autotest.c:84
+// adding symstreamcf_copy to package symstreamcf from src/framing/tests/symstreamcf_autotest.c:87
+// adding symstreamcf_delay_00 to package symstreamcf_delay from src/framing/tests/symstreamcf_delay_autotest.c:61
+// adding symstreamcf_delay_01 to package symstreamcf_delay from src/framing/tests/symstreamcf_delay_autotest.c:62
+// adding symstreamcf_delay_02 to package symstreamcf_delay from src/framing/tests/symstreamcf_delay_autotest.c:63
+// adding symstreamcf_delay_03 to package symstreamcf_delay from src/framing/tests/symstreamcf_delay_autotest.c:64
+// adding symstreamcf_delay_04 to package symstreamcf_delay from src/framing/tests/symstreamcf_delay_autotest.c:65
+// adding symstreamcf_delay_05 to package symstreamcf_delay from src/framing/tests/symstreamcf_delay_autotest.c:66
+// adding symstreamcf_delay_06 to package symstreamcf_delay from src/framing/tests/symstreamcf_delay_autotest.c:67
+// adding symstreamcf_delay_07 to package symstreamcf_delay from src/framing/tests/symstreamcf_delay_autotest.c:68
+// adding symstreamcf_delay_08 to package symstreamcf_delay from src/framing/tests/symstreamcf_delay_autotest.c:69
+// adding symstreamcf_delay_09 to package symstreamcf_delay from src/framing/tests/symstreamcf_delay_autotest.c:70
+// adding symstreamcf_delay_10 to package symstreamcf_delay from src/framing/tests/symstreamcf_delay_autotest.c:72
+// adding symstreamcf_delay_11 to package symstreamcf_delay from src/framing/tests/symstreamcf_delay_autotest.c:73
+// adding symstreamcf_delay_12 to package symstreamcf_delay from src/framing/tests/symstreamcf_delay_autotest.c:74
+// adding symstreamcf_delay_13 to package symstreamcf_delay from src/framing/tests/symstreamcf_delay_autotest.c:75
+// adding symstreamcf_delay_14 to package symstreamcf_delay from src/framing/tests/symstreamcf_delay_autotest.c:76
+// adding symstreamcf_delay_15 to package symstreamcf_delay from src/framing/tests/symstreamcf_delay_autotest.c:77
+// adding symstreamcf_delay_16 to package symstreamcf_delay from src/framing/tests/symstreamcf_delay_autotest.c:78
+// adding symstreamcf_delay_17 to package symstreamcf_delay from src/framing/tests/symstreamcf_delay_autotest.c:79
+// adding symstreamcf_delay_18 to package symstreamcf_delay from src/framing/tests/symstreamcf_delay_autotest.c:80
+// adding symstreamcf_delay_19 to package symstreamcf_delay from src/framing/tests/symstreamcf_delay_autotest.c:81
+// adding symstreamrcf_psd_bw200_m12_b030 to package symstreamrcf from src/framing/tests/symstreamrcf_autotest.c:82
+// adding symstreamrcf_psd_bw400_m12_b030 to package symstreamrcf from src/framing/tests/symstreamrcf_autotest.c:83
+// adding symstreamrcf_psd_bw400_m25_b020 to package symstreamrcf from src/framing/tests/symstreamrcf_autotest.c:84
+// adding symstreamrcf_psd_bw700_m11_b035 to package symstreamrcf from src/framing/tests/symstreamrcf_autotest.c:85
+// adding symstreamrcf_copy to package symstreamrcf from src/framing/tests/symstreamrcf_autotest.c:88
+// adding symstreamrcf_delay_00 to package symstreamrcf_delay from src/framing/tests/symstreamrcf_delay_autotest.c:79
+// adding symstreamrcf_delay_01 to package symstreamrcf_delay from src/framing/tests/symstreamrcf_delay_autotest.c:80
+// adding symstreamrcf_delay_02 to package symstreamrcf_delay from src/framing/tests/symstreamrcf_delay_autotest.c:81
+// adding symstreamrcf_delay_03 to package symstreamrcf_delay from src/framing/tests/symstreamrcf_delay_autotest.c:82
+// adding symstreamrcf_delay_04 to package symstreamrcf_delay from src/framing/tests/symstreamrcf_delay_autotest.c:83
+// adding symstreamrcf_delay_05 to package symstreamrcf_delay from src/framing/tests/symstreamrcf_delay_autotest.c:84
+// adding symstreamrcf_delay_06 to package symstreamrcf_delay from src/framing/tests/symstreamrcf_delay_autotest.c:85
+// adding symstreamrcf_delay_07 to package symstreamrcf_delay from src/framing/tests/symstreamrcf_delay_autotest.c:86
+// adding symstreamrcf_delay_08 to package symstreamrcf_delay from src/framing/tests/symstreamrcf_delay_autotest.c:87
+// adding symstreamrcf_delay_09 to package symstreamrcf_delay from src/framing/tests/symstreamrcf_delay_autotest.c:88
+// adding symstreamrcf_delay_10 to package symstreamrcf_delay from src/framing/tests/symstreamrcf_delay_autotest.c:90
+// adding symstreamrcf_delay_11 to package symstreamrcf_delay from src/framing/tests/symstreamrcf_delay_autotest.c:91
+// adding symstreamrcf_delay_12 to package symstreamrcf_delay from src/framing/tests/symstreamrcf_delay_autotest.c:92
+// adding symstreamrcf_delay_13 to package symstreamrcf_delay from src/framing/tests/symstreamrcf_delay_autotest.c:93
+// adding symstreamrcf_delay_14 to package symstreamrcf_delay from src/framing/tests/symstreamrcf_delay_autotest.c:94
+// adding symstreamrcf_delay_15 to package symstreamrcf_delay from src/framing/tests/symstreamrcf_delay_autotest.c:95
+// adding symstreamrcf_delay_16 to package symstreamrcf_delay from src/framing/tests/symstreamrcf_delay_autotest.c:96
+// adding symstreamrcf_delay_17 to package symstreamrcf_delay from src/framing/tests/symstreamrcf_delay_autotest.c:97
+// adding symstreamrcf_delay_18 to package symstreamrcf_delay from src/framing/tests/symstreamrcf_delay_autotest.c:98
+// adding symstreamrcf_delay_19 to package symstreamrcf_delay from src/framing/tests/symstreamrcf_delay_autotest.c:99
+// adding symtrack_cccf_bpsk to package symtrack_cccf from src/framing/tests/symtrack_cccf_autotest.c:109
+// adding symtrack_cccf_qpsk to package symtrack_cccf from src/framing/tests/symtrack_cccf_autotest.c:110
+// adding symtrack_cccf_config_invalid to package symtrack_cccf from src/framing/tests/symtrack_cccf_autotest.c:113
+// adding symtrack_cccf_config_valid to package symtrack_cccf from src/framing/tests/symtrack_cccf_autotest.c:141
+// adding gcd_one to package gcd from src/math/tests/gcd_autotest.c:39
+// adding gcd_edge_cases to package gcd from src/math/tests/gcd_autotest.c:51
+// adding gcd_base to package gcd from src/math/tests/gcd_autotest.c:61
+// adding window_hamming to package math_window from src/math/tests/math_window_autotest.c:81
+// adding window_hann to package math_window from src/math/tests/math_window_autotest.c:82
+// adding window_blackmanharris to package math_window from src/math/tests/math_window_autotest.c:83
+// adding window_blackmanharris7 to package math_window from src/math/tests/math_window_autotest.c:84
+// adding window_kaiser to package math_window from src/math/tests/math_window_autotest.c:85
+// adding window_flattop to package math_window from src/math/tests/math_window_autotest.c:86
+// adding window_triangular to package math_window from src/math/tests/math_window_autotest.c:87
+// adding window_rcostaper to package math_window from src/math/tests/math_window_autotest.c:88
+// adding window_kbd to package math_window from src/math/tests/math_window_autotest.c:89
+// adding kbd_n16 to package math_window from src/math/tests/math_window_autotest.c:118
+// adding kbd_n32 to package math_window from src/math/tests/math_window_autotest.c:119
+// adding kbd_n48 to package math_window from src/math/tests/math_window_autotest.c:120
+// adding window_config to package math_window from src/math/tests/math_window_autotest.c:123
+// adding Q to package math from src/math/tests/math_autotest.c:28
+// adding sincf to package math from src/math/tests/math_autotest.c:43
+// adding nextpow2 to package math from src/math/tests/math_autotest.c:50
+// adding math_config to package math from src/math/tests/math_autotest.c:78
+// adding lnbesselif to package math_bessel from src/math/tests/math_bessel_autotest.c:29
+// adding besselif to package math_bessel from src/math/tests/math_bessel_autotest.c:62
+// adding besseli0f to package math_bessel from src/math/tests/math_bessel_autotest.c:97
+// adding besseljf to package math_bessel from src/math/tests/math_bessel_autotest.c:112
+// adding besselj0f to package math_bessel from src/math/tests/math_bessel_autotest.c:156
+// adding gamma to package math_gamma from src/math/tests/math_gamma_autotest.c:29
+// adding lngamma to package math_gamma from src/math/tests/math_gamma_autotest.c:73
+// adding uppergamma to package math_gamma from src/math/tests/math_gamma_autotest.c:133
+// adding factorial to package math_gamma from src/math/tests/math_gamma_autotest.c:166
+// adding nchoosek to package math_gamma from src/math/tests/math_gamma_autotest.c:181
+// adding cexpf to package math_complex from src/math/tests/math_complex_autotest.c:27
+// adding clogf to package math_complex from src/math/tests/math_complex_autotest.c:79
+// adding csqrtf to package math_complex from src/math/tests/math_complex_autotest.c:130
+// adding casinf to package math_complex from src/math/tests/math_complex_autotest.c:181
+// adding cacosf to package math_complex from src/math/tests/math_complex_autotest.c:233
+// adding catanf to package math_complex from src/math/tests/math_complex_autotest.c:286
+// adding vmath_sincos_exact to package math_fast from src/math/tests/math_fast_autotest.c:120
+// adding vmath_sincos_precise to package math_fast from src/math/tests/math_fast_autotest.c:121
+// adding vmath_sincos_fast to package math_fast from src/math/tests/math_fast_autotest.c:122
+// adding vmath_cexpj_exact to package math_fast from src/math/tests/math_fast_autotest.c:123
+// adding vmath_cexpj_precise to package math_fast from src/math/tests/math_fast_autotest.c:124
+// adding vmath_cexpj_fast to package math_fast from src/math/tests/math_fast_autotest.c:125
+// adding vmath_atan2_exact to package math_fast from src/math/tests/math_fast_autotest.c:126
+// adding vmath_atan2_precise to package math_fast from src/math/tests/math_fast_autotest.c:127
+// adding vmath_atan2_fast to package math_fast from src/math/tests/math_fast_autotest.c:128
+// adding vmath_exp_exact to package math_fast from src/math/tests/math_fast_autotest.c:129
+// adding vmath_exp_precise to package math_fast from src/math/tests/math_fast_autotest.c:130
+// adding vmath_exp_fast to package math_fast from src/math/tests/math_fast_autotest.c:131
+// adding vmath_log_exact to package math_fast from src/math/tests/math_fast_autotest.c:132
+// adding vmath_log_precise to package math_fast from src/math/tests/math_fast_autotest.c:133
+// adding vmath_log_fast to package math_fast from src/math/tests/math_fast_autotest.c:134
+// adding vmath_log10_exact to package math_fast from src/math/tests/math_fast_autotest.c:135
+// adding vmath_log10_precise to package math_fast from src/math/tests/math_fast_autotest.c:136
+// adding vmath_log10_fast to package math_fast from src/math/tests/math_fast_autotest.c:137
+// adding vmath_special to package math_fast from src/math/tests/math_fast_autotest.c:140
+// adding vmath_inplace to package math_fast from src/math/tests/math_fast_autotest.c:194
+// adding vmath_config to package math_fast from src/math/tests/math_fast_autotest.c:209
+// adding polyf_fit_q3n3 to package polynomial from src/math/tests/polynomial_autotest.c:31
+// adding polyf_lagrange_issue165 to package polynomial from src/math/tests/polynomial_autotest.c:59
+// adding polyf_lagrange to package polynomial from src/math/tests/polynomial_autotest.c:98
+// adding polyf_expandroots_4 to package polynomial from src/math/tests/polynomial_autotest.c:150
+// adding polyf_expandroots_11 to package polynomial from src/math/tests/polynomial_autotest.c:179
+// adding polycf_expandroots_4 to package polynomial from src/math/tests/polynomial_autotest.c:211
+// adding polyf_expandroots2_3 to package polynomial from src/math/tests/polynomial_autotest.c:244
+// adding polyf_mul_2_3 to package polynomial from src/math/tests/polynomial_autotest.c:273
+// adding poly_expandbinomial_n6 to package polynomial from src/math/tests/polynomial_autotest.c:302
+// adding poly_binomial_expand_pm_m6_k1 to package polynomial from src/math/tests/polynomial_autotest.c:325
+// adding poly_expandbinomial_pm_m5_k2 to package polynomial from src/math/tests/polynomial_autotest.c:350
+// adding polyf_findroots_real to package polynomial_findroots from src/math/tests/polynomial_findroots_autotest.c:65
+// adding polyf_findroots_complex to package polynomial_findroots from src/math/tests/polynomial_findroots_autotest.c:73
+// adding polyf_findroots_mix to package polynomial_findroots from src/math/tests/polynomial_findroots_autotest.c:83
+// adding polyf_findroots_mix2 to package polynomial_findroots from src/math/tests/polynomial_findroots_autotest.c:98
+// adding prime_small to package prime from src/math/tests/prime_autotest.c:27
+// adding factors to package prime from src/math/tests/prime_autotest.c:87
+// adding totient to package prime from src/math/tests/prime_autotest.c:110
+// adding matrixcf_add to package matrixcf from src/matrix/tests/matrixcf_autotest.c:32
+// adding matrixcf_aug to package matrixcf from src/matrix/tests/matrixcf_autotest.c:53
+// adding matrixcf_chol to package matrixcf from src/matrix/tests/matrixcf_autotest.c:82
+// adding matrixcf_inv to package matrixcf from src/matrix/tests/matrixcf_autotest.c:108
+// adding matrixcf_linsolve to package matrixcf from src/matrix/tests/matrixcf_autotest.c:133
+// adding matrixcf_ludecomp_crout to package matrixcf from src/matrix/tests/matrixcf_autotest.c:163
+// adding matrixcf_ludecomp_doolittle to package matrixcf from src/matrix/tests/matrixcf_autotest.c:213
+// adding matrixcf_mul to package matrixcf from src/matrix/tests/matrixcf_autotest.c:263
+// adding matrixcf_qrdecomp to package matrixcf from src/matrix/tests/matrixcf_autotest.c:292
+// adding matrixcf_transmul to package matrixcf from src/matrix/tests/matrixcf_autotest.c:349
+// adding matrixcf_mul_blocked to package matrixcf from src/matrix/tests/matrixcf_autotest.c:434
+// adding matrixcf_transmul_blocked to package matrixcf from src/matrix/tests/matrixcf_autotest.c:454
+// adding matrixcf_lusolve to package matrixcf from src/matrix/tests/matrixcf_autotest.c:498
+// adding matrixcf_lufactor_singular to package matrixcf from src/matrix/tests/matrixcf_autotest.c:522
+// adding matrixcf_cholsolve to package matrixcf from src/matrix/tests/matrixcf_autotest.c:540
+// adding matrixf_add to package matrixf from src/matrix/tests/matrixf_autotest.c:33
+// adding matrixf_aug to package matrixf from src/matrix/tests/matrixf_autotest.c:52
+// adding matrixf_cgsolve to package matrixf from src/matrix/tests/matrixf_autotest.c:79
+// adding matrixf_chol to package matrixf from src/matrix/tests/matrixf_autotest.c:105
+// adding matrixf_gramschmidt to package matrixf from src/matrix/tests/matrixf_autotest.c:129
+// adding matrixf_inv to package matrixf from src/matrix/tests/matrixf_autotest.c:152
+// adding matrixf_linsolve to package matrixf from src/matrix/tests/matrixf_autotest.c:175
+// adding matrixf_ludecomp_crout to package matrixf from src/matrix/tests/matrixf_autotest.c:204
+// adding matrixf_ludecomp_doolittle to package matrixf from src/matrix/tests/matrixf_autotest.c:249
+// adding matrixf_mul to package matrixf from src/matrix/tests/matrixf_autotest.c:294
+// adding matrixf_qrdecomp to package matrixf from src/matrix/tests/matrixf_autotest.c:321
+// adding matrixf_transmul to package matrixf from src/matrix/tests/matrixf_autotest.c:373
+// adding matrixf_mul_blocked to package matrixf from src/matrix/tests/matrixf_autotest.c:427
+// adding matrixf_lusolve to package matrixf from src/matrix/tests/matrixf_autotest.c:456
+// adding smatrixb_vmul to package smatrixb from src/matrix/tests/smatrixb_autotest.c:33
+// adding smatrixb_mul to package smatrixb from src/matrix/tests/smatrixb_autotest.c:116
+// adding smatrixb_mulf to package smatrixb from src/matrix/tests/smatrixb_autotest.c:184
+// adding smatrixb_vmulf to package smatrixb from src/matrix/tests/smatrixb_autotest.c:279
+// adding smatrixf_vmul to package smatrixf from src/matrix/tests/smatrixf_autotest.c:33
+// adding smatrixf_mul to package smatrixf from src/matrix/tests/smatrixf_autotest.c:69
+// adding smatrixi_vmul to package smatrixi from src/matrix/tests/smatrixi_autotest.c:33
+// adding smatrixi_mul to package smatrixi from src/matrix/tests/smatrixi_autotest.c:68
+// adding ampmodem_dsb_carrier_on to package ampmodem from src/modem/tests/ampmodem_autotest.c:117
+// adding ampmodem_usb_carrier_on to package ampmodem from src/modem/tests/ampmodem_autotest.c:118
+// adding ampmodem_lsb_carrier_on to package ampmodem from src/modem/tests/ampmodem_autotest.c:119
+// adding ampmodem_dsb_carrier_off to package ampmodem from src/modem/tests/ampmodem_autotest.c:121
+// adding ampmodem_usb_carrier_off to package ampmodem from src/modem/tests/ampmodem_autotest.c:122
+// adding ampmodem_lsb_carrier_off to package ampmodem from src/modem/tests/ampmodem_autotest.c:123
+// adding ampmodem_block_dsb_carrier_on to package ampmodem from src/modem/tests/ampmodem_autotest.c:204
+// adding ampmodem_block_usb_carrier_on to package ampmodem from src/modem/tests/ampmodem_autotest.c:205
+// adding ampmodem_block_lsb_carrier_on to package ampmodem from src/modem/tests/ampmodem_autotest.c:206
+// adding ampmodem_block_dsb_carrier_off to package ampmodem from src/modem/tests/ampmodem_autotest.c:207
+// adding ampmodem_block_usb_carrier_off to package ampmodem from src/modem/tests/ampmodem_autotest.c:208
+// adding ampmodem_block_lsb_carrier_off to package ampmodem from src/modem/tests/ampmodem_autotest.c:209
+// adding cpfskmodem_bps1_h0p5000_k4_m3_square to package cpfskmodem from src/modem/tests/cpfskmodem_autotest.c:99
+// adding cpfskmodem_bps1_h0p0250_k4_m3_square to package cpfskmodem from src/modem/tests/cpfskmodem_autotest.c:100
+// adding cpfskmodem_bps1_h0p1250_k4_m3_square to package cpfskmodem from src/modem/tests/cpfskmodem_autotest.c:101
+// adding cpfskmodem_bps1_h0p0625_k4_m3_square to package cpfskmodem from src/modem/tests/cpfskmodem_autotest.c:102
+// adding cpfskmodem_bps1_h0p5000_k4_m3_rcosfull to package cpfskmodem from src/modem/tests/cpfskmodem_autotest.c:105
+// adding cpfskmodem_bps1_h0p0250_k4_m3_rcosfull to package cpfskmodem from src/modem/tests/cpfskmodem_autotest.c:106
+// adding cpfskmodem_bps1_h0p1250_k4_m3_rcosfull to package cpfskmodem from src/modem/tests/cpfskmodem_autotest.c:107
+// adding cpfskmodem_bps1_h0p0625_k4_m3_rcosfull to package cpfskmodem from src/modem/tests/cpfskmodem_autotest.c:108
+// adding cpfskmodem_bps1_h0p5000_k4_m3_rcospart to package cpfskmodem from src/modem/tests/cpfskmodem_autotest.c:111
+// adding cpfskmodem_bps1_h0p0250_k4_m3_rcospart to package cpfskmodem from src/modem/tests/cpfskmodem_autotest.c:112
+// adding cpfskmodem_bps1_h0p1250_k4_m3_rcospart to package cpfskmodem from src/modem/tests/cpfskmodem_autotest.c:113
+// adding cpfskmodem_bps1_h0p0625_k4_m3_rcospart to package cpfskmodem from src/modem/tests/cpfskmodem_autotest.c:114
+// adding cpfskmodem_bps1_h0p5000_k4_m3_gmsk to package cpfskmodem from src/modem/tests/cpfskmodem_autotest.c:117
+// adding cpfskmodem_bps1_h0p0250_k4_m3_gmsk to package cpfskmodem from src/modem/tests/cpfskmodem_autotest.c:118
+// adding cpfskmodem_bps1_h0p1250_k4_m3_gmsk to package cpfskmodem from src/modem/tests/cpfskmodem_autotest.c:119
+// adding cpfskmodem_bps1_h0p0625_k4_m3_gmsk to package cpfskmodem from src/modem/tests/cpfskmodem_autotest.c:120
+// adding cpfskmodem_bps2_h0p0250_k4_m3_square to package cpfskmodem from src/modem/tests/cpfskmodem_autotest.c:127
+// adding cpfskmodem_bps3_h0p1250_k4_m3_square to package cpfskmodem from src/modem/tests/cpfskmodem_autotest.c:128
+// adding cpfskmodem_bps4_h0p0625_k4_m3_square to package cpfskmodem from src/modem/tests/cpfskmodem_autotest.c:129
+// adding cpfskmodem_bps1_h0p5_k2_m7_gmsk to package cpfskmodem from src/modem/tests/cpfskmodem_autotest.c:137
+// adding cpfskmodem_bps1_h0p5_k4_m7_gmsk to package cpfskmodem from src/modem/tests/cpfskmodem_autotest.c:138
+// adding cpfskmodem_bps1_h0p5_k6_m7_gmsk to package cpfskmodem from src/modem/tests/cpfskmodem_autotest.c:139
+// adding cpfskmodem_bps1_h0p5_k8_m7_gmsk to package cpfskmodem from src/modem/tests/cpfskmodem_autotest.c:140
+// adding cpfskmodem_coherent_bps1_h0p5_square to package cpfskmodem from src/modem/tests/cpfskmodem_autotest.c:165
+// adding cpfskmodem_coherent_bps1_h0p25_square to package cpfskmodem from src/modem/tests/cpfskmodem_autotest.c:166
+// adding cpfskmodem_coherent_bps1_h0p5_rcosfull to package cpfskmodem from src/modem/tests/cpfskmodem_autotest.c:167
+// adding cpfskmodem_coherent_bps1_h0p5_rcospart to package cpfskmodem from src/modem/tests/cpfskmodem_autotest.c:168
+// adding cpfskmodem_coherent_bps1_h0p5_gmsk to package cpfskmodem from src/modem/tests/cpfskmodem_autotest.c:169
+// adding cpfskmodem_coherent_bps1_h0p5_k8_m7_gmsk to package cpfskmodem from src/modem/tests/cpfskmodem_autotest.c:170
+// adding cpfskmodem_coherent_bps2_h0p25_square to package cpfskmodem from src/modem/tests/cpfskmodem_autotest.c:171
+// adding cpfskmodem_coherent_sensitivity to package cpfskmodem from src/modem/tests/cpfskmodem_autotest.c:207
+// adding cpfskdem_block_noncoherent to package cpfskmodem from src/modem/tests/cpfskmodem_autotest.c:249
+// adding cpfskdem_block_coherent to package cpfskmodem from src/modem/tests/cpfskmodem_autotest.c:250
+// adding cpfskmodem_spectrum to package cpfskmodem from src/modem/tests/cpfskmodem_autotest.c:253
+// adding cpfskmodem_config to package cpfskmodem from src/modem/tests/cpfskmodem_autotest.c:306
+// adding freqmodem_kf_0_02 to package freqmodem from src/modem/tests/freqmodem_autotest.c:68
+// adding freqmodem_kf_0_04 to package freqmodem from src/modem/tests/freqmodem_autotest.c:69
+// adding freqmodem_kf_0_08 to package freqmodem from src/modem/tests/freqmodem_autotest.c:70
+// adding freqdem_block_exact to package freqmodem from src/modem/tests/freqmodem_autotest.c:108
+// adding freqdem_block_terms2 to package freqmodem from src/modem/tests/freqmodem_autotest.c:109
+// adding freqdem_block_terms4 to package freqmodem from src/modem/tests/freqmodem_autotest.c:110
+// adding freqdem_block_terms7 to package freqmodem from src/modem/tests/freqmodem_autotest.c:111
+// adding freqdem_config to package freqmodem from src/modem/tests/freqmodem_autotest.c:113
+// adding fskmodem_norm_M2 to package fskmodem from src/modem/tests/fskmodem_autotest.c:63
+// adding fskmodem_norm_M4 to package fskmodem from src/modem/tests/fskmodem_autotest.c:64
+// adding fskmodem_norm_M8 to package fskmodem from src/modem/tests/fskmodem_autotest.c:65
+// adding fskmodem_norm_M16 to package fskmodem from src/modem/tests/fskmodem_autotest.c:66
+// adding fskmodem_norm_M32 to package fskmodem from src/modem/tests/fskmodem_autotest.c:67
+// adding fskmodem_norm_M64 to package fskmodem from src/modem/tests/fskmodem_autotest.c:68
+// adding fskmodem_norm_M128 to package fskmodem from src/modem/tests/fskmodem_autotest.c:69
+// adding fskmodem_norm_M256 to package fskmodem from src/modem/tests/fskmodem_autotest.c:70
+// adding fskmodem_norm_M512 to package fskmodem from src/modem/tests/fskmodem_autotest.c:71
+// adding fskmodem_norm_M1024 to package fskmodem from src/modem/tests/fskmodem_autotest.c:72
+// adding fskmodem_misc_M2 to package fskmodem from src/modem/tests/fskmodem_autotest.c:75
+// adding fskmodem_misc_M4 to package fskmodem from src/modem/tests/fskmodem_autotest.c:76
+// adding fskmodem_misc_M8 to package fskmodem from src/modem/tests/fskmodem_autotest.c:77
+// adding fskmodem_misc_M16 to package fskmodem from src/modem/tests/fskmodem_autotest.c:78
+// adding fskmodem_misc_M32 to package fskmodem from src/modem/tests/fskmodem_autotest.c:79
+// adding fskmodem_misc_M64 to package fskmodem from src/modem/tests/fskmodem_autotest.c:80
+// adding fskmodem_misc_M128 to package fskmodem from src/modem/tests/fskmodem_autotest.c:81
+// adding fskmodem_misc_M256 to package fskmodem from src/modem/tests/fskmodem_autotest.c:82
+// adding fskmodem_misc_M512 to package fskmodem from src/modem/tests/fskmodem_autotest.c:83
+// adding fskmodem_misc_M1024 to package fskmodem from src/modem/tests/fskmodem_autotest.c:84
+// adding fskmod_copy to package fskmodem from src/modem/tests/fskmodem_autotest.c:87
+// adding fskdem_copy to package fskmodem from src/modem/tests/fskmodem_autotest.c:130
+// adding fskdem_block_fft to package fskmodem from src/modem/tests/fskmodem_autotest.c:231
+// adding fskdem_block_pruned to package fskmodem from src/modem/tests/fskmodem_autotest.c:232
+// adding fskdem_pruned to package fskmodem from src/modem/tests/fskmodem_autotest.c:235
+// adding gmskmodem_k4_m3_b025 to package gmskmodem from src/modem/tests/gmskmodem_autotest.c:83
+// adding gmskmodem_k2_m3_b025 to package gmskmodem from src/modem/tests/gmskmodem_autotest.c:86
+// adding gmskmodem_k3_m3_b025 to package gmskmodem from src/modem/tests/gmskmodem_autotest.c:87
+// adding gmskmodem_k5_m3_b025 to package gmskmodem from src/modem/tests/gmskmodem_autotest.c:88
+// adding gmskmodem_k8_m3_b033 to package gmskmodem from src/modem/tests/gmskmodem_autotest.c:89
+// adding gmskmodem_k4_m1_b025 to package gmskmodem from src/modem/tests/gmskmodem_autotest.c:92
+// adding gmskmodem_k4_m2_b025 to package gmskmodem from src/modem/tests/gmskmodem_autotest.c:93
+// adding gmskmodem_k4_m8_b025 to package gmskmodem from src/modem/tests/gmskmodem_autotest.c:94
+// adding gmskmodem_k4_m3_b020 to package gmskmodem from src/modem/tests/gmskmodem_autotest.c:97
+// adding gmskmodem_k4_m3_b033 to package gmskmodem from src/modem/tests/gmskmodem_autotest.c:98
+// adding gmskmodem_k4_m3_b050 to package gmskmodem from src/modem/tests/gmskmodem_autotest.c:99
+// adding gmskmod_copy to package gmskmodem from src/modem/tests/gmskmodem_autotest.c:102
+// adding gmskdem_copy to package gmskmodem from src/modem/tests/gmskmodem_autotest.c:145
+// adding gmskdem_block to package gmskmodem from src/modem/tests/gmskmodem_autotest.c:189
+// adding mod_demod_psk2 to package modem from src/modem/tests/modem_autotest.c:58
+// adding mod_demod_psk4 to package modem from src/modem/tests/modem_autotest.c:59
+// adding mod_demod_psk8 to package modem from src/modem/tests/modem_autotest.c:60
+// adding mod_demod_psk16 to package modem from src/modem/tests/modem_autotest.c:61
+// adding mod_demod_psk32 to package modem from src/modem/tests/modem_autotest.c:62
+// adding mod_demod_psk64 to package modem from src/modem/tests/modem_autotest.c:63
+// adding mod_demod_psk128 to package modem from src/modem/tests/modem_autotest.c:64
+// adding mod_demod_psk256 to package modem from src/modem/tests/modem_autotest.c:65
+// adding mod_demod_dpsk2 to package modem from src/modem/tests/modem_autotest.c:68
+// adding mod_demod_dpsk4 to package modem from src/modem/tests/modem_autotest.c:69
+// adding mod_demod_dpsk8 to package modem from src/modem/tests/modem_autotest.c:70
+// adding mod_demod_dpsk16 to package modem from src/modem/tests/modem_autotest.c:71
+// adding mod_demod_dpsk32 to package modem from src/modem/tests/modem_autotest.c:72
+// adding mod_demod_dpsk64 to package modem from src/modem/tests/modem_autotest.c:73
+// adding mod_demod_dpsk128 to package modem from src/modem/tests/modem_autotest.c:74
+// adding mod_demod_dpsk256 to package modem from src/modem/tests/modem_autotest.c:75
+// adding mod_demod_ask2 to package modem from src/modem/tests/modem_autotest.c:78
+// adding mod_demod_ask4 to package modem from src/modem/tests/modem_autotest.c:79
+// adding mod_demod_ask8 to package modem from src/modem/tests/modem_autotest.c:80
+// adding mod_demod_ask16 to package modem from src/modem/tests/modem_autotest.c:81
+// adding mod_demod_ask32 to package modem from src/modem/tests/modem_autotest.c:82
+// adding mod_demod_ask64 to package modem from src/modem/tests/modem_autotest.c:83
+// adding mod_demod_ask128 to package modem from src/modem/tests/modem_autotest.c:84
+// adding mod_demod_ask256 to package modem from src/modem/tests/modem_autotest.c:85
+// adding mod_demod_qam4 to package modem from src/modem/tests/modem_autotest.c:88
+// adding mod_demod_qam8 to package modem from src/modem/tests/modem_autotest.c:89
+// adding mod_demod_qam16 to package modem from src/modem/tests/modem_autotest.c:90
+// adding mod_demod_qam32 to package modem from src/modem/tests/modem_autotest.c:91
+// adding mod_demod_qam64 to package modem from src/modem/tests/modem_autotest.c:92
+// adding mod_demod_qam128 to package modem from src/modem/tests/modem_autotest.c:93
+// adding mod_demod_qam256 to package modem from src/modem/tests/modem_autotest.c:94
+// adding mod_demod_apsk4 to package modem from src/modem/tests/modem_autotest.c:97
+// adding mod_demod_apsk8 to package modem from src/modem/tests/modem_autotest.c:98
+// adding mod_demod_apsk16 to package modem from src/modem/tests/modem_autotest.c:99
+// adding mod_demod_apsk32 to package modem from src/modem/tests/modem_autotest.c:100
+// adding mod_demod_apsk64 to package modem from src/modem/tests/modem_autotest.c:101
+// adding mod_demod_apsk128 to package modem from src/modem/tests/modem_autotest.c:102
+// adding mod_demod_apsk256 to package modem from src/modem/tests/modem_autotest.c:103
+// adding mod_demod_bpsk to package modem from src/modem/tests/modem_autotest.c:106
+// adding mod_demod_qpsk to package modem from src/modem/tests/modem_autotest.c:107
+// adding mod_demod_ook to package modem from src/modem/tests/modem_autotest.c:108
+// adding mod_demod_sqam32 to package modem from src/modem/tests/modem_autotest.c:109
+// adding mod_demod_sqam128 to package modem from src/modem/tests/modem_autotest.c:110
+// adding mod_demod_V29 to package modem from src/modem/tests/modem_autotest.c:111
+// adding mod_demod_arb16opt to package modem from src/modem/tests/modem_autotest.c:112
+// adding mod_demod_arb32opt to package modem from src/modem/tests/modem_autotest.c:113
+// adding mod_demod_arb64opt to package modem from src/modem/tests/modem_autotest.c:114
+// adding mod_demod_arb128opt to package modem from src/modem/tests/modem_autotest.c:115
+// adding mod_demod_arb256opt to package modem from src/modem/tests/modem_autotest.c:116
+// adding mod_demod_arb64vt to package modem from src/modem/tests/modem_autotest.c:117
+// adding mod_demod_pi4dqpsk to package modem from src/modem/tests/modem_autotest.c:118
+// adding modem_block_psk8 to package modem_block from src/modem/tests/modem_block_autotest.c:84
+// adding modem_block_psk64 to package modem_block from src/modem/tests/modem_block_autotest.c:85
+// adding modem_block_dpsk4 to package modem_block from src/modem/tests/modem_block_autotest.c:86
+// adding modem_block_ask4 to package modem_block from src/modem/tests/modem_block_autotest.c:87
+// adding modem_block_ask16 to package modem_block from src/modem/tests/modem_block_autotest.c:88
+// adding modem_block_qam4 to package modem_block from src/modem/tests/modem_block_autotest.c:89
+// adding modem_block_qam16 to package modem_block from src/modem/tests/modem_block_autotest.c:90
+// adding modem_block_qam32 to package modem_block from src/modem/tests/modem_block_autotest.c:91
+// adding modem_block_qam256 to package modem_block from src/modem/tests/modem_block_autotest.c:92
+// adding modem_block_apsk16 to package modem_block from src/modem/tests/modem_block_autotest.c:93
+// adding modem_block_apsk64 to package modem_block from src/modem/tests/modem_block_autotest.c:94
+// adding modem_block_bpsk to package modem_block from src/modem/tests/modem_block_autotest.c:95
+// adding modem_block_qpsk to package modem_block from src/modem/tests/modem_block_autotest.c:96
+// adding modem_block_ook to package modem_block from src/modem/tests/modem_block_autotest.c:97
+// adding modem_block_sqam32 to package modem_block from src/modem/tests/modem_block_autotest.c:98
+// adding modem_block_arb16opt to package modem_block from src/modem/tests/modem_block_autotest.c:99
+// adding modem_block_pi4dqpsk to package modem_block from src/modem/tests/modem_block_autotest.c:100
+// adding modem_block_config to package modem_block from src/modem/tests/modem_block_autotest.c:102
+// adding modem_copy_psk2 to package modem_config from src/modem/tests/modem_config_autotest.c:73
+// adding modem_copy_psk4 to package modem_config from src/modem/tests/modem_config_autotest.c:74
+// adding modem_copy_psk8 to package modem_config from src/modem/tests/modem_config_autotest.c:75
+// adding modem_copy_psk16 to package modem_config from src/modem/tests/modem_config_autotest.c:76
+// adding modem_copy_psk32 to package modem_config from src/modem/tests/modem_config_autotest.c:77
+// adding modem_copy_psk64 to package modem_config from src/modem/tests/modem_config_autotest.c:78
+// adding modem_copy_psk128 to package modem_config from src/modem/tests/modem_config_autotest.c:79
+// adding modem_copy_psk256 to package modem_config from src/modem/tests/modem_config_autotest.c:80
+// adding modem_copy_dpsk2 to package modem_config from src/modem/tests/modem_config_autotest.c:83
+// adding modem_copy_dpsk4 to package modem_config from src/modem/tests/modem_config_autotest.c:84
+// adding modem_copy_dpsk8 to package modem_config from src/modem/tests/modem_config_autotest.c:85
+// adding modem_copy_dpsk16 to package modem_config from src/modem/tests/modem_config_autotest.c:86
+// adding modem_copy_dpsk32 to package modem_config from src/modem/tests/modem_config_autotest.c:87
+// adding modem_copy_dpsk64 to package modem_config from src/modem/tests/modem_config_autotest.c:88
+// adding modem_copy_dpsk128 to package modem_config from src/modem/tests/modem_config_autotest.c:89
+// adding modem_copy_dpsk256 to package modem_config from src/modem/tests/modem_config_autotest.c:90
+// adding modem_copy_ask2 to package modem_config from src/modem/tests/modem_config_autotest.c:93
+// adding modem_copy_ask4 to package modem_config from src/modem/tests/modem_config_autotest.c:94
+// adding modem_copy_ask8 to package modem_config from src/modem/tests/modem_config_autotest.c:95
+// adding modem_copy_ask16 to package modem_config from src/modem/tests/modem_config_autotest.c:96
+// adding modem_copy_ask32 to package modem_config from src/modem/tests/modem_config_autotest.c:97
+// adding modem_copy_ask64 to package modem_config from src/modem/tests/modem_config_autotest.c:98
+// adding modem_copy_ask128 to package modem_config from src/modem/tests/modem_config_autotest.c:99
+// adding modem_copy_ask256 to package modem_config from src/modem/tests/modem_config_autotest.c:100
+// adding modem_copy_qam4 to package modem_config from src/modem/tests/modem_config_autotest.c:103
+// adding modem_copy_qam8 to package modem_config from src/modem/tests/modem_config_autotest.c:104
+// adding modem_copy_qam16 to package modem_config from src/modem/tests/modem_config_autotest.c:105
+// adding modem_copy_qam32 to package modem_config from src/modem/tests/modem_config_autotest.c:106
+// adding modem_copy_qam64 to package modem_config from src/modem/tests/modem_config_autotest.c:107
+// adding modem_copy_qam128 to package modem_config from src/modem/tests/modem_config_autotest.c:108
+// adding modem_copy_qam256 to package modem_config from src/modem/tests/modem_config_autotest.c:109
+// adding modem_copy_apsk4 to package modem_config from src/modem/tests/modem_config_autotest.c:112
+// adding modem_copy_apsk8 to package modem_config from src/modem/tests/modem_config_autotest.c:113
+// adding modem_copy_apsk16 to package modem_config from src/modem/tests/modem_config_autotest.c:114
+// adding modem_copy_apsk32 to package modem_config from src/modem/tests/modem_config_autotest.c:115
+// adding modem_copy_apsk64 to package modem_config from src/modem/tests/modem_config_autotest.c:116
+// adding modem_copy_apsk128 to package modem_config from src/modem/tests/modem_config_autotest.c:117
+// adding modem_copy_apsk256 to package modem_config from src/modem/tests/modem_config_autotest.c:118
+// adding modem_copy_bpsk to package modem_config from src/modem/tests/modem_config_autotest.c:121
+// adding modem_copy_qpsk to package modem_config from src/modem/tests/modem_config_autotest.c:122
+// adding modem_copy_ook to package modem_config from src/modem/tests/modem_config_autotest.c:123
+// adding modem_copy_sqam32 to package modem_config from src/modem/tests/modem_config_autotest.c:124
+// adding modem_copy_sqam128 to package modem_config from src/modem/tests/modem_config_autotest.c:125
+// adding modem_copy_V29 to package modem_config from src/modem/tests/modem_config_autotest.c:126
+// adding modem_copy_arb16opt to package modem_config from src/modem/tests/modem_config_autotest.c:127
+// adding modem_copy_arb32opt to package modem_config from src/modem/tests/modem_config_autotest.c:128
+// adding modem_copy_arb64opt to package modem_config from src/modem/tests/modem_config_autotest.c:129
+// adding modem_copy_arb128opt to package modem_config from src/modem/tests/modem_config_autotest.c:130
+// adding modem_copy_arb256opt to package modem_config from src/modem/tests/modem_config_autotest.c:131
+// adding modem_copy_arb64vt to package modem_config from src/modem/tests/modem_config_autotest.c:132
+// adding modem_copy_pi4dqpsk to package modem_config from src/modem/tests/modem_config_autotest.c:133
+// adding modem_config to package modem_config from src/modem/tests/modem_config_autotest.c:136
+// adding demodsoft_psk2 to package modem_demodsoft from src/modem/tests/modem_demodsoft_autotest.c:70
+// adding demodsoft_psk4 to package modem_demodsoft from src/modem/tests/modem_demodsoft_autotest.c:71
+// adding demodsoft_psk8 to package modem_demodsoft from src/modem/tests/modem_demodsoft_autotest.c:72
+// adding demodsoft_psk16 to package modem_demodsoft from src/modem/tests/modem_demodsoft_autotest.c:73
+// adding demodsoft_psk32 to package modem_demodsoft from src/modem/tests/modem_demodsoft_autotest.c:74
+// adding demodsoft_psk64 to package modem_demodsoft from src/modem/tests/modem_demodsoft_autotest.c:75
+// adding demodsoft_psk128 to package modem_demodsoft from src/modem/tests/modem_demodsoft_autotest.c:76
+// adding demodsoft_psk256 to package modem_demodsoft from src/modem/tests/modem_demodsoft_autotest.c:77
+// adding demodsoft_dpsk2 to package modem_demodsoft from src/modem/tests/modem_demodsoft_autotest.c:80
+// adding demodsoft_dpsk4 to package modem_demodsoft from src/modem/tests/modem_demodsoft_autotest.c:81
+// adding demodsoft_dpsk8 to package modem_demodsoft from src/modem/tests/modem_demodsoft_autotest.c:82
+// adding demodsoft_dpsk16 to package modem_demodsoft from src/modem/tests/modem_demodsoft_autotest.c:83
+// adding demodsoft_dpsk32 to package modem_demodsoft from src/modem/tests/modem_demodsoft_autotest.c:84
+// adding demodsoft_dpsk64 to package modem_demodsoft from src/modem/tests/modem_demodsoft_autotest.c:85
+// adding demodsoft_dpsk128 to package modem_demodsoft from src/modem/tests/modem_demodsoft_autotest.c:86
+// adding demodsoft_dpsk256 to package modem_demodsoft from src/modem/tests/modem_demodsoft_autotest.c:87
+// adding demodsoft_ask2 to package modem_demodsoft from src/modem/tests/modem_demodsoft_autotest.c:90
+// adding demodsoft_ask4 to package modem_demodsoft from src/modem/tests/modem_demodsoft_autotest.c:91
+// adding demodsoft_ask8 to package modem_demodsoft from src/modem/tests/modem_demodsoft_autotest.c:92
+// adding demodsoft_ask16 to package modem_demodsoft from src/modem/tests/modem_demodsoft_autotest.c:93
+// adding demodsoft_ask32 to package modem_demodsoft from src/modem/tests/modem_demodsoft_autotest.c:94
+// adding demodsoft_ask64 to package modem_demodsoft from src/modem/tests/modem_demodsoft_autotest.c:95
+// adding demodsoft_ask128 to package modem_demodsoft from src/modem/tests/modem_demodsoft_autotest.c:96
+// adding demodsoft_ask256 to package modem_demodsoft from src/modem/tests/modem_demodsoft_autotest.c:97
+// adding demodsoft_qam4 to package modem_demodsoft from src/modem/tests/modem_demodsoft_autotest.c:100
+// adding demodsoft_qam8 to package modem_demodsoft from src/modem/tests/modem_demodsoft_autotest.c:101
+// adding demodsoft_qam16 to package modem_demodsoft from src/modem/tests/modem_demodsoft_autotest.c:102
+// adding demodsoft_qam32 to package modem_demodsoft from src/modem/tests/modem_demodsoft_autotest.c:103
+// adding demodsoft_qam64 to package modem_demodsoft from src/modem/tests/modem_demodsoft_autotest.c:104
+// adding demodsoft_qam128 to package modem_demodsoft from src/modem/tests/modem_demodsoft_autotest.c:105
+// adding demodsoft_qam256 to package modem_demodsoft from src/modem/tests/modem_demodsoft_autotest.c:106
+// adding demodsoft_apsk4 to package modem_demodsoft from src/modem/tests/modem_demodsoft_autotest.c:109
+// adding demodsoft_apsk8 to package modem_demodsoft from src/modem/tests/modem_demodsoft_autotest.c:110
+// adding demodsoft_apsk16 to package modem_demodsoft from src/modem/tests/modem_demodsoft_autotest.c:111
+// adding demodsoft_apsk32 to package modem_demodsoft from src/modem/tests/modem_demodsoft_autotest.c:112
+// adding demodsoft_apsk64 to package modem_demodsoft from src/modem/tests/modem_demodsoft_autotest.c:113
+// adding demodsoft_apsk128 to package modem_demodsoft from src/modem/tests/modem_demodsoft_autotest.c:114
+// adding demodsoft_apsk256 to package modem_demodsoft from src/modem/tests/modem_demodsoft_autotest.c:115
+// adding demodsoft_bpsk to package modem_demodsoft from src/modem/tests/modem_demodsoft_autotest.c:118
+// adding demodsoft_qpsk to package modem_demodsoft from src/modem/tests/modem_demodsoft_autotest.c:119
+// adding demodsoft_ook to package modem_demodsoft from src/modem/tests/modem_demodsoft_autotest.c:120
+// adding demodsoft_sqam32 to package modem_demodsoft from src/modem/tests/modem_demodsoft_autotest.c:121
+// adding demodsoft_sqam128 to package modem_demodsoft from src/modem/tests/modem_demodsoft_autotest.c:122
+// adding demodsoft_V29 to package modem_demodsoft from src/modem/tests/modem_demodsoft_autotest.c:123
+// adding demodsoft_arb16opt to package modem_demodsoft from src/modem/tests/modem_demodsoft_autotest.c:124
+// adding demodsoft_arb32opt to package modem_demodsoft from src/modem/tests/modem_demodsoft_autotest.c:125
+// adding demodsoft_arb64opt to package modem_demodsoft from src/modem/tests/modem_demodsoft_autotest.c:126
+// adding demodsoft_arb128opt to package modem_demodsoft from src/modem/tests/modem_demodsoft_autotest.c:127
+// adding demodsoft_arb256opt to package modem_demodsoft from src/modem/tests/modem_demodsoft_autotest.c:128
+// adding demodsoft_arb64vt to package modem_demodsoft from src/modem/tests/modem_demodsoft_autotest.c:129
+// adding demodsoft_pi4dqpsk to package modem_demodsoft from src/modem/tests/modem_demodsoft_autotest.c:130
+// adding demodstats_psk2 to package modem_demodstats from src/modem/tests/modem_demodstats_autotest.c:99
+// adding demodstats_psk4 to package modem_demodstats from src/modem/tests/modem_demodstats_autotest.c:100
+// adding demodstats_psk8 to package modem_demodstats from src/modem/tests/modem_demodstats_autotest.c:101
+// adding demodstats_psk16 to package modem_demodstats from src/modem/tests/modem_demodstats_autotest.c:102
+// adding demodstats_psk32 to package modem_demodstats from src/modem/tests/modem_demodstats_autotest.c:103
+// adding demodstats_psk64 to package modem_demodstats from src/modem/tests/modem_demodstats_autotest.c:104
+// adding demodstats_psk128 to package modem_demodstats from src/modem/tests/modem_demodstats_autotest.c:105
+// adding demodstats_psk256 to package modem_demodstats from src/modem/tests/modem_demodstats_autotest.c:106
+// adding demodstats_dpsk2 to package modem_demodstats from src/modem/tests/modem_demodstats_autotest.c:109
+// adding demodstats_dpsk4 to package modem_demodstats from src/modem/tests/modem_demodstats_autotest.c:110
+// adding demodstats_dpsk8 to package modem_demodstats from src/modem/tests/modem_demodstats_autotest.c:111
+// adding demodstats_dpsk16 to package modem_demodstats from src/modem/tests/modem_demodstats_autotest.c:112
+// adding demodstats_dpsk32 to package modem_demodstats from src/modem/tests/modem_demodstats_autotest.c:113
+// adding demodstats_dpsk64 to package modem_demodstats from src/modem/tests/modem_demodstats_autotest.c:114
+// adding demodstats_dpsk128 to package modem_demodstats from src/modem/tests/modem_demodstats_autotest.c:115
+// adding demodstats_dpsk256 to package modem_demodstats from src/modem/tests/modem_demodstats_autotest.c:116
+// adding demodstats_ask2 to package modem_demodstats from src/modem/tests/modem_demodstats_autotest.c:119
+// adding demodstats_ask4 to package modem_demodstats from src/modem/tests/modem_demodstats_autotest.c:120
+// adding demodstats_ask8 to package modem_demodstats from src/modem/tests/modem_demodstats_autotest.c:121
+// adding demodstats_ask16 to package modem_demodstats from src/modem/tests/modem_demodstats_autotest.c:122
+// adding demodstats_ask32 to package modem_demodstats from src/modem/tests/modem_demodstats_autotest.c:123
+// adding demodstats_ask64 to package modem_demodstats from src/modem/tests/modem_demodstats_autotest.c:124
+// adding demodstats_ask128 to package modem_demodstats from src/modem/tests/modem_demodstats_autotest.c:125
+// adding demodstats_ask256 to package modem_demodstats from src/modem/tests/modem_demodstats_autotest.c:126
+// adding demodstats_qam4 to package modem_demodstats from src/modem/tests/modem_demodstats_autotest.c:129
+// adding demodstats_qam8 to package modem_demodstats from src/modem/tests/modem_demodstats_autotest.c:130
+// adding demodstats_qam16 to package modem_demodstats from src/modem/tests/modem_demodstats_autotest.c:131
+// adding demodstats_qam32 to package modem_demodstats from src/modem/tests/modem_demodstats_autotest.c:132
+// adding demodstats_qam64 to package modem_demodstats from src/modem/tests/modem_demodstats_autotest.c:133
+// adding demodstats_qam128 to package modem_demodstats from src/modem/tests/modem_demodstats_autotest.c:134
+// adding demodstats_qam256 to package modem_demodstats from src/modem/tests/modem_demodstats_autotest.c:135
+// adding demodstats_apsk4 to package modem_demodstats from src/modem/tests/modem_demodstats_autotest.c:138
+// adding demodstats_apsk8 to package modem_demodstats from src/modem/tests/modem_demodstats_autotest.c:139
+// adding demodstats_apsk16 to package modem_demodstats from src/modem/tests/modem_demodstats_autotest.c:140
+// adding demodstats_apsk32 to package modem_demodstats from src/modem/tests/modem_demodstats_autotest.c:141
+// adding demodstats_apsk64 to package modem_demodstats from src/modem/tests/modem_demodstats_autotest.c:142
+// adding demodstats_apsk128 to package modem_demodstats from src/modem/tests/modem_demodstats_autotest.c:143
+// adding demodstats_apsk256 to package modem_demodstats from src/modem/tests/modem_demodstats_autotest.c:144
+// adding demodstats_bpsk to package modem_demodstats from src/modem/tests/modem_demodstats_autotest.c:147
+// adding demodstats_qpsk to package modem_demodstats from src/modem/tests/modem_demodstats_autotest.c:148
+// adding demodstats_ook to package modem_demodstats from src/modem/tests/modem_demodstats_autotest.c:149
+// adding demodstats_sqam32 to package modem_demodstats from src/modem/tests/modem_demodstats_autotest.c:150
+// adding demodstats_sqam128 to package modem_demodstats from src/modem/tests/modem_demodstats_autotest.c:151
+// adding demodstats_V29 to package modem_demodstats from src/modem/tests/modem_demodstats_autotest.c:152
+// adding demodstats_arb16opt to package modem_demodstats from src/modem/tests/modem_demodstats_autotest.c:153
+// adding demodstats_arb32opt to package modem_demodstats from src/modem/tests/modem_demodstats_autotest.c:154
+// adding demodstats_arb64opt to package modem_demodstats from src/modem/tests/modem_demodstats_autotest.c:155
+// adding demodstats_arb128opt to package modem_demodstats from src/modem/tests/modem_demodstats_autotest.c:156
+// adding demodstats_arb256opt to package modem_demodstats from src/modem/tests/modem_demodstats_autotest.c:157
+// adding demodstats_arb64vt to package modem_demodstats from src/modem/tests/modem_demodstats_autotest.c:158
+// adding modemcf_print_schemes to package modem_utilities from src/modem/tests/modem_utilities_autotest.c:27
+// adding modemcf_str2mod to package modem_utilities from src/modem/tests/modem_utilities_autotest.c:33
+// adding modemcf_types to package modem_utilities from src/modem/tests/modem_utilities_autotest.c:93
+// adding firpfbch_crcf_synthesis to package firpfbch_crcf_synthesizer from src/multichannel/tests/firpfbch_crcf_synthesizer_autotest.c:30
+// adding firpfbch_crcf_analysis to package firpfbch_crcf_analyzer from src/multichannel/tests/firpfbch_crcf_analyzer_autotest.c:30
+// adding firpfbch_crcf_config to package firpfbch_crcf from src/multichannel/tests/firpfbch_crcf_autotest.c:27
+// adding firpfbch2_crcf_n8 to package firpfbch2_crcf from src/multichannel/tests/firpfbch2_crcf_autotest.c:95
+// adding firpfbch2_crcf_n16 to package firpfbch2_crcf from src/multichannel/tests/firpfbch2_crcf_autotest.c:96
+// adding firpfbch2_crcf_n32 to package firpfbch2_crcf from src/multichannel/tests/firpfbch2_crcf_autotest.c:97
+// adding firpfbch2_crcf_n64 to package firpfbch2_crcf from src/multichannel/tests/firpfbch2_crcf_autotest.c:98
+// adding firpfbch2_crcf_copy to package firpfbch2_crcf from src/multichannel/tests/firpfbch2_crcf_autotest.c:100
+// adding firpfbch2_crcf_config to package firpfbch2_crcf from src/multichannel/tests/firpfbch2_crcf_autotest.c:142
+// adding firpfbchr_crcf to package firpfbchr_crcf from src/multichannel/tests/firpfbchr_crcf_autotest.c:27
+// adding firpfbchr_crcf_config to package firpfbchr_crcf from src/multichannel/tests/firpfbchr_crcf_autotest.c:118
+// adding ofdmframesync_acquire_n64 to package ofdmframe from src/multichannel/tests/ofdmframe_autotest.c:142
+// adding ofdmframesync_acquire_n128 to package ofdmframe from src/multichannel/tests/ofdmframe_autotest.c:143
+// adding ofdmframesync_acquire_n256 to package ofdmframe from src/multichannel/tests/ofdmframe_autotest.c:144
+// adding ofdmframesync_acquire_n512 to package ofdmframe from src/multichannel/tests/ofdmframe_autotest.c:145
+// adding ofdmframesync_block_n64 to package ofdmframe from src/multichannel/tests/ofdmframe_autotest.c:250
+// adding ofdmframesync_block_n128 to package ofdmframe from src/multichannel/tests/ofdmframe_autotest.c:251
+// adding ofdmframesync_block_n512 to package ofdmframe from src/multichannel/tests/ofdmframe_autotest.c:252
+// adding ofdmframe_common_config to package ofdmframe from src/multichannel/tests/ofdmframe_autotest.c:254
+// adding ofdmframegen_config to package ofdmframe from src/multichannel/tests/ofdmframe_autotest.c:298
+// adding ofdmframesync_config to package ofdmframe from src/multichannel/tests/ofdmframe_autotest.c:323
+// adding nco_crcf_constrain to package nco_crcf from src/nco/tests/nco_crcf_autotest.c:40
+// adding nco_crcf_copy to package nco_crcf from src/nco/tests/nco_crcf_autotest.c:87
+// adding nco_config to package nco_crcf from src/nco/tests/nco_crcf_autotest.c:122
+// adding nco_crcf_frequency to package nco_crcf_frequency from src/nco/tests/nco_crcf_frequency_autotest.c:79
+// adding nco_crcf_mix_nco_0 to package nco_crcf_mix from src/nco/tests/nco_crcf_mix_autotest.c:69
+// adding nco_crcf_mix_nco_1 to package nco_crcf_mix from src/nco/tests/nco_crcf_mix_autotest.c:70
+// adding nco_crcf_mix_nco_2 to package nco_crcf_mix from src/nco/tests/nco_crcf_mix_autotest.c:71
+// adding nco_crcf_mix_nco_3 to package nco_crcf_mix from src/nco/tests/nco_crcf_mix_autotest.c:72
+// adding nco_crcf_mix_nco_4 to package nco_crcf_mix from src/nco/tests/nco_crcf_mix_autotest.c:73
+// adding nco_crcf_mix_nco_5 to package nco_crcf_mix from src/nco/tests/nco_crcf_mix_autotest.c:74
+// adding nco_crcf_mix_nco_6 to package nco_crcf_mix from src/nco/tests/nco_crcf_mix_autotest.c:75
+// adding nco_crcf_mix_nco_7 to package nco_crcf_mix from src/nco/tests/nco_crcf_mix_autotest.c:76
+// adding nco_crcf_mix_nco_8 to package nco_crcf_mix from src/nco/tests/nco_crcf_mix_autotest.c:77
+// adding nco_crcf_mix_nco_9 to package nco_crcf_mix from src/nco/tests/nco_crcf_mix_autotest.c:78
+// adding nco_crcf_mix_vco_0 to package nco_crcf_mix from src/nco/tests/nco_crcf_mix_autotest.c:81
+// adding nco_crcf_mix_vco_1 to package nco_crcf_mix from src/nco/tests/nco_crcf_mix_autotest.c:82
+// adding nco_crcf_mix_vco_2 to package nco_crcf_mix from src/nco/tests/nco_crcf_mix_autotest.c:83
+// adding nco_crcf_mix_vco_3 to package nco_crcf_mix from src/nco/tests/nco_crcf_mix_autotest.c:84
+// adding nco_crcf_mix_vco_4 to package nco_crcf_mix from src/nco/tests/nco_crcf_mix_autotest.c:85
+// adding nco_crcf_mix_vco_5 to package nco_crcf_mix from src/nco/tests/nco_crcf_mix_autotest.c:86
+// adding nco_crcf_mix_vco_6 to package nco_crcf_mix from src/nco/tests/nco_crcf_mix_autotest.c:87
+// adding nco_crcf_mix_vco_7 to package nco_crcf_mix from src/nco/tests/nco_crcf_mix_autotest.c:88
+// adding nco_crcf_mix_vco_8 to package nco_crcf_mix from src/nco/tests/nco_crcf_mix_autotest.c:89
+// adding nco_crcf_mix_vco_9 to package nco_crcf_mix from src/nco/tests/nco_crcf_mix_autotest.c:90
+// adding nco_crcf_phase to package nco_crcf_phase from src/nco/tests/nco_crcf_phase_autotest.c:65
+// adding nco_basic to package nco_crcf_phase from src/nco/tests/nco_crcf_phase_autotest.c:95
+// adding nco_mixing to package nco_crcf_phase from src/nco/tests/nco_crcf_phase_autotest.c:146
+// adding nco_block_mixing to package nco_crcf_phase from src/nco/tests/nco_crcf_phase_autotest.c:186
+// adding nco_crcf_pll_phase to package nco_crcf_pll from src/nco/tests/nco_crcf_pll_autotest.c:98
+// adding nco_crcf_pll_freq to package nco_crcf_pll from src/nco/tests/nco_crcf_pll_autotest.c:121
+// adding nco_crcf_spectrum_nco_f00 to package nco_crcf_spectrum from src/nco/tests/nco_crcf_spectrum_autotest.c:85
+// adding nco_crcf_spectrum_nco_f01 to package nco_crcf_spectrum from src/nco/tests/nco_crcf_spectrum_autotest.c:86
+// adding nco_crcf_spectrum_nco_f02 to package nco_crcf_spectrum from src/nco/tests/nco_crcf_spectrum_autotest.c:87
+// adding nco_crcf_spectrum_nco_f03 to package nco_crcf_spectrum from src/nco/tests/nco_crcf_spectrum_autotest.c:88
+// adding nco_crcf_spectrum_nco_f04 to package nco_crcf_spectrum from src/nco/tests/nco_crcf_spectrum_autotest.c:89
+// adding nco_crcf_spectrum_vco_f00 to package nco_crcf_spectrum from src/nco/tests/nco_crcf_spectrum_autotest.c:92
+// adding nco_crcf_spectrum_vco_f01 to package nco_crcf_spectrum from src/nco/tests/nco_crcf_spectrum_autotest.c:93
+// adding nco_crcf_spectrum_vco_f02 to package nco_crcf_spectrum from src/nco/tests/nco_crcf_spectrum_autotest.c:94
+// adding nco_crcf_spectrum_vco_f03 to package nco_crcf_spectrum from src/nco/tests/nco_crcf_spectrum_autotest.c:95
+// adding nco_crcf_spectrum_vco_f04 to package nco_crcf_spectrum from src/nco/tests/nco_crcf_spectrum_autotest.c:96
+// adding nco_unwrap_phase to package unwrap_phase from src/nco/tests/unwrap_phase_autotest.c:30
+// adding gasearch_peak to package gasearch from src/optim/tests/gasearch_autotest.c:51
+// adding chromosome_config to package gasearch from src/optim/tests/gasearch_autotest.c:98
+// adding gasearch_config to package gasearch from src/optim/tests/gasearch_autotest.c:167
+// adding gasearch_workers to package gasearch from src/optim/tests/gasearch_autotest.c:259
+// adding gasearch_cache to package gasearch from src/optim/tests/gasearch_autotest.c:269
+// adding gasearch_workers_count to package gasearch from src/optim/tests/gasearch_autotest.c:310
+// adding gradsearch_rosenbrock to package gradsearch from src/optim/tests/gradsearch_autotest.c:38
+// adding gradsearch_maxutility to package gradsearch from src/optim/tests/gradsearch_autotest.c:116
+// adding gradsearch_workers to package gradsearch from src/optim/tests/gradsearch_autotest.c:182
+// adding gradsearch_gradient to package gradsearch from src/optim/tests/gradsearch_autotest.c:193
+// adding qnsearch_rosenbrock to package qnsearch from src/optim/tests/qnsearch_autotest.c:35
+// adding qnsearch_config to package qnsearch from src/optim/tests/qnsearch_autotest.c:67
+// adding qnsearch_workers to package qnsearch from src/optim/tests/qnsearch_autotest.c:94
+// adding qnsearch_gradient to package qnsearch from src/optim/tests/qnsearch_autotest.c:119
+// adding qs1dsearch_min_01 to package qs1dsearch from src/optim/tests/qs1dsearch_autotest.c:79
+// adding qs1dsearch_min_02 to package qs1dsearch from src/optim/tests/qs1dsearch_autotest.c:80
+// adding qs1dsearch_min_03 to package qs1dsearch from src/optim/tests/qs1dsearch_autotest.c:81
+// adding qs1dsearch_min_05 to package qs1dsearch from src/optim/tests/qs1dsearch_autotest.c:82
+// adding qs1dsearch_min_06 to package qs1dsearch from src/optim/tests/qs1dsearch_autotest.c:83
+// adding qs1dsearch_min_07 to package qs1dsearch from src/optim/tests/qs1dsearch_autotest.c:84
+// adding qs1dsearch_min_08 to package qs1dsearch from src/optim/tests/qs1dsearch_autotest.c:85
+// adding qs1dsearch_min_10 to package qs1dsearch from src/optim/tests/qs1dsearch_autotest.c:87
+// adding qs1dsearch_min_11 to package qs1dsearch from src/optim/tests/qs1dsearch_autotest.c:88
+// adding qs1dsearch_min_12 to package qs1dsearch from src/optim/tests/qs1dsearch_autotest.c:89
+// adding qs1dsearch_min_13 to package qs1dsearch from src/optim/tests/qs1dsearch_autotest.c:90
+// adding qs1dsearch_max_01 to package qs1dsearch from src/optim/tests/qs1dsearch_autotest.c:95
+// adding qs1dsearch_max_02 to package qs1dsearch from src/optim/tests/qs1dsearch_autotest.c:96
+// adding qs1dsearch_max_03 to package qs1dsearch from src/optim/tests/qs1dsearch_autotest.c:97
+// adding qs1dsearch_max_05 to package qs1dsearch from src/optim/tests/qs1dsearch_autotest.c:98
+// adding qs1dsearch_max_06 to package qs1dsearch from src/optim/tests/qs1dsearch_autotest.c:99
+// adding qs1dsearch_max_07 to package qs1dsearch from src/optim/tests/qs1dsearch_autotest.c:100
+// adding qs1dsearch_max_08 to package qs1dsearch from src/optim/tests/qs1dsearch_autotest.c:101
+// adding qs1dsearch_max_10 to package qs1dsearch from src/optim/tests/qs1dsearch_autotest.c:103
+// adding qs1dsearch_max_11 to package qs1dsearch from src/optim/tests/qs1dsearch_autotest.c:104
+// adding qs1dsearch_max_12 to package qs1dsearch from src/optim/tests/qs1dsearch_autotest.c:105
+// adding qs1dsearch_max_13 to package qs1dsearch from src/optim/tests/qs1dsearch_autotest.c:106
+// adding qs1dsearch_config to package qs1dsearch from src/optim/tests/qs1dsearch_autotest.c:109
+// adding optim_rosenbrock to package utility from src/optim/tests/utility_autotest.c:34
+// adding compand_float to package compand from src/quantization/tests/compand_autotest.c:26
+// adding compand_cfloat to package compand from src/quantization/tests/compand_autotest.c:52
+// adding quantize_float_n8 to package quantize from src/quantization/tests/quantize_autotest.c:26
+// adding scramble_n16 to package scramble from src/random/tests/scramble_autotest.c:117
+// adding scramble_n64 to package scramble from src/random/tests/scramble_autotest.c:118
+// adding scramble_n256 to package scramble from src/random/tests/scramble_autotest.c:119
+// adding scramble_n11 to package scramble from src/random/tests/scramble_autotest.c:121
+// adding scramble_n33 to package scramble from src/random/tests/scramble_autotest.c:122
+// adding scramble_n277 to package scramble from src/random/tests/scramble_autotest.c:123
+// adding scramble_soft_n16 to package scramble from src/random/tests/scramble_autotest.c:128
+// adding scramble_soft_n64 to package scramble from src/random/tests/scramble_autotest.c:129
+// adding scramble_soft_n256 to package scramble from src/random/tests/scramble_autotest.c:130
+// adding scramble_soft_n11 to package scramble from src/random/tests/scramble_autotest.c:132
+// adding scramble_soft_n33 to package scramble from src/random/tests/scramble_autotest.c:133
+// adding scramble_soft_n277 to package scramble from src/random/tests/scramble_autotest.c:134
+// adding randf to package random from src/random/tests/random_autotest.c:30
+// adding randnf to package random from src/random/tests/random_autotest.c:51
+// adding crandnf to package random from src/random/tests/random_autotest.c:72
+// adding randweibf to package random from src/random/tests/random_autotest.c:95
+// adding randricekf to package random from src/random/tests/random_autotest.c:125
+// adding randexpf to package random from src/random/tests/random_autotest.c:147
+// adding random_config to package random from src/random/tests/random_autotest.c:174
+// adding distribution_randnf to package random_distributions from src/random/tests/random_distributions_autotest.c:118
+// adding bsequence_init to package bsequence from src/sequence/tests/bsequence_autotest.c:29
+// adding bsequence_correlate to package bsequence from src/sequence/tests/bsequence_autotest.c:66
+// adding bsequence_add to package bsequence from src/sequence/tests/bsequence_autotest.c:92
+// adding bsequence_mul to package bsequence from src/sequence/tests/bsequence_autotest.c:140
+// adding bsequence_accumulate to package bsequence from src/sequence/tests/bsequence_autotest.c:188
+// adding complementary_code_n8 to package complementary_codes from src/sequence/tests/complementary_codes_autotest.c:69
+// adding complementary_code_n16 to package complementary_codes from src/sequence/tests/complementary_codes_autotest.c:70
+// adding complementary_code_n32 to package complementary_codes from src/sequence/tests/complementary_codes_autotest.c:71
+// adding complementary_code_n64 to package complementary_codes from src/sequence/tests/complementary_codes_autotest.c:72
+// adding complementary_code_n128 to package complementary_codes from src/sequence/tests/complementary_codes_autotest.c:73
+// adding complementary_code_n256 to package complementary_codes from src/sequence/tests/complementary_codes_autotest.c:74
+// adding complementary_code_n512 to package complementary_codes from src/sequence/tests/complementary_codes_autotest.c:75
+// adding bsequence_init_msequence to package msequence from src/sequence/tests/msequence_autotest.c:27
+// adding msequence_xcorr_m2 to package msequence from src/sequence/tests/msequence_autotest.c:83
+// adding msequence_xcorr_m3 to package msequence from src/sequence/tests/msequence_autotest.c:84
+// adding msequence_xcorr_m4 to package msequence from src/sequence/tests/msequence_autotest.c:85
+// adding msequence_xcorr_m5 to package msequence from src/sequence/tests/msequence_autotest.c:86
+// adding msequence_xcorr_m6 to package msequence from src/sequence/tests/msequence_autotest.c:87
+// adding msequence_xcorr_m7 to package msequence from src/sequence/tests/msequence_autotest.c:88
+// adding msequence_xcorr_m8 to package msequence from src/sequence/tests/msequence_autotest.c:89
+// adding msequence_xcorr_m9 to package msequence from src/sequence/tests/msequence_autotest.c:90
+// adding msequence_xcorr_m10 to package msequence from src/sequence/tests/msequence_autotest.c:91
+// adding msequence_xcorr_m11 to package msequence from src/sequence/tests/msequence_autotest.c:92
+// adding msequence_xcorr_m12 to package msequence from src/sequence/tests/msequence_autotest.c:93
+// adding msequence_period_m2 to package msequence from src/sequence/tests/msequence_autotest.c:109
+// adding msequence_period_m3 to package msequence from src/sequence/tests/msequence_autotest.c:110
+// adding msequence_period_m4 to package msequence from src/sequence/tests/msequence_autotest.c:111
+// adding msequence_period_m5 to package msequence from src/sequence/tests/msequence_autotest.c:112
+// adding msequence_period_m6 to package msequence from src/sequence/tests/msequence_autotest.c:113
+// adding msequence_period_m7 to package msequence from src/sequence/tests/msequence_autotest.c:114
+// adding msequence_period_m8 to package msequence from src/sequence/tests/msequence_autotest.c:115
+// adding msequence_period_m9 to package msequence from src/sequence/tests/msequence_autotest.c:116
+// adding msequence_period_m10 to package msequence from src/sequence/tests/msequence_autotest.c:117
+// adding msequence_period_m11 to package msequence from src/sequence/tests/msequence_autotest.c:118
+// adding msequence_period_m12 to package msequence from src/sequence/tests/msequence_autotest.c:119
+// adding msequence_period_m13 to package msequence from src/sequence/tests/msequence_autotest.c:120
+// adding msequence_period_m14 to package msequence from src/sequence/tests/msequence_autotest.c:121
+// adding msequence_period_m15 to package msequence from src/sequence/tests/msequence_autotest.c:122
+// adding msequence_period_m16 to package msequence from src/sequence/tests/msequence_autotest.c:123
+// adding msequence_period_m17 to package msequence from src/sequence/tests/msequence_autotest.c:124
+// adding msequence_period_m18 to package msequence from src/sequence/tests/msequence_autotest.c:125
+// adding msequence_period_m19 to package msequence from src/sequence/tests/msequence_autotest.c:126
+// adding msequence_period_m20 to package msequence from src/sequence/tests/msequence_autotest.c:127
+// adding msequence_period_m21 to package msequence from src/sequence/tests/msequence_autotest.c:128
+// adding msequence_period_m22 to package msequence from src/sequence/tests/msequence_autotest.c:129
+// adding msequence_period_m23 to package msequence from src/sequence/tests/msequence_autotest.c:130
+// adding msequence_period_m24 to package msequence from src/sequence/tests/msequence_autotest.c:131
+// adding msequence_period_m25 to package msequence from src/sequence/tests/msequence_autotest.c:132
+// adding msequence_period_m26 to package msequence from src/sequence/tests/msequence_autotest.c:133
+// adding msequence_period_m27 to package msequence from src/sequence/tests/msequence_autotest.c:134
+// adding msequence_period_m28 to package msequence from src/sequence/tests/msequence_autotest.c:135
+// adding msequence_period_m29 to package msequence from src/sequence/tests/msequence_autotest.c:136
+// adding msequence_period_m30 to package msequence from src/sequence/tests/msequence_autotest.c:137
+// adding msequence_period_m31 to package msequence from src/sequence/tests/msequence_autotest.c:138
+// adding msequence_config to package msequence from src/sequence/tests/msequence_autotest.c:140
+// adding lbshift to package bshift_array from src/utility/tests/bshift_array_autotest.c:31
+// adding rbshift to package bshift_array from src/utility/tests/bshift_array_autotest.c:79
+// adding lbcircshift to package bshift_array from src/utility/tests/bshift_array_autotest.c:127
+// adding rbcircshift to package bshift_array from src/utility/tests/bshift_array_autotest.c:175
+// adding count_ones to package count_bits from src/utility/tests/count_bits_autotest.c:29
+// adding count_ones_mod2 to package count_bits from src/utility/tests/count_bits_autotest.c:45
+// adding bdotprod to package count_bits from src/utility/tests/count_bits_autotest.c:61
+// adding count_leading_zeros to package count_bits from src/utility/tests/count_bits_autotest.c:91
+// adding msb_index to package count_bits from src/utility/tests/count_bits_autotest.c:140
+// adding pack_array to package pack_bytes from src/utility/tests/pack_bytes_autotest.c:30
+// adding unpack_array to package pack_bytes from src/utility/tests/pack_bytes_autotest.c:64
+// adding repack_array to package pack_bytes from src/utility/tests/pack_bytes_autotest.c:98
+// adding pack_bytes_01 to package pack_bytes from src/utility/tests/pack_bytes_autotest.c:130
+// adding unpack_bytes_01 to package pack_bytes from src/utility/tests/pack_bytes_autotest.c:171
+// adding repack_bytes_01 to package pack_bytes from src/utility/tests/pack_bytes_autotest.c:196
+// adding repack_bytes_02 to package pack_bytes from src/utility/tests/pack_bytes_autotest.c:222
+// adding repack_bytes_03 to package pack_bytes from src/utility/tests/pack_bytes_autotest.c:246
+// adding repack_bytes_04_uneven to package pack_bytes from src/utility/tests/pack_bytes_autotest.c:270
+// adding profile_firfilt to package profile from src/utility/tests/profile_autotest.c:42
+// adding profile_fftplan to package profile from src/utility/tests/profile_autotest.c:75
+// adding profile_callback to package profile from src/utility/tests/profile_autotest.c:110
+// adding profile_json to package profile from src/utility/tests/profile_autotest.c:140
+// adding lshift to package shift_array from src/utility/tests/shift_array_autotest.c:30
+// adding rshift to package shift_array from src/utility/tests/shift_array_autotest.c:69
+// adding lcircshift to package shift_array from src/utility/tests/shift_array_autotest.c:108
+// adding rcircshift to package shift_array from src/utility/tests/shift_array_autotest.c:147
+// auto-generated file, do not edit
+// invoked with script type 'autotest' and delimiter '/'
+// the following types need to be defined externally:
+//      typedef ...(autotest_function_t)(...);
+//      typedef struct {
+//          unsigned int id;        // script identification number
+//          autotest_function_t * api;    // pointer to function API
+//          const char * name;      // script name
+//          ...
+//      } autotest_t;
+//      typedef struct {
+//          unsigned int id;        // package identification number
+//          unsigned int index;     // index of first script
+//          unsigned int n;         // number of scripts in package
+//          const char * name;      // name of package
+//      } package_t;
+
+#ifndef __LIQUID_AUTOSCRIPT_INCLUDE_H__
+#define __LIQUID_AUTOSCRIPT_INCLUDE_H__
+
+#define AUTOSCRIPT_VERSION "0.3.1"
+
+// number of packages
+#define NUM_PACKAGES (166)
+
+// number of scripts
+#define NUM_AUTOSCRIPTS (1483)
+
+// function declarations
+// autotest/null_autotest.c
+autotest_function_t autotest_null;
+// autotest/libliquid_autotest.c
+autotest_function_t autotest_libliquid;
+// src/agc/tests/agc_crcf_autotest.c
+autotest_function_t autotest_agc_crcf_dc_gain_control;
+autotest_function_t autotest_agc_crcf_scale;
+autotest_function_t autotest_agc_crcf_ac_gain_control;
+autotest_function_t autotest_agc_crcf_rssi_sinusoid;
+autotest_function_t autotest_agc_crcf_rssi_noise;
+autotest_function_t autotest_agc_crcf_squelch;
+autotest_function_t autotest_agc_crcf_lock;
+autotest_function_t autotest_agc_crcf_invalid_config;
+autotest_function_t autotest_agc_crcf_copy;
+// src/audio/tests/cvsd_autotest.c
+autotest_function_t autotest_cvsd_rmse_sine;
+autotest_function_t autotest_cvsd_rmse_sine8;
+autotest_function_t autotest_cvsd_invalid_config;
+// src/buffer/tests/cbuffer_autotest.c
+autotest_function_t autotest_cbufferf;
+autotest_function_t autotest_cbuffercf;
+autotest_function_t autotest_cbufferf_flow;
+autotest_function_t autotest_cbufferf_config;
+autotest_function_t autotest_cbuffer_copy;
+// src/buffer/tests/wdelay_autotest.c
+autotest_function_t autotest_wdelayf;
+autotest_function_t autotest_wdelay_copy;
+// src/buffer/tests/buffer_window_autotest.c
+autotest_function_t autotest_window_config_errors;
+autotest_function_t autotest_windowf;
+autotest_function_t autotest_window_copy;
+// src/dotprod/tests/dotprod_rrrf_autotest.c
+autotest_function_t autotest_dotprod_rrrf_basic;
+autotest_function_t autotest_dotprod_rrrf_uneven;
+autotest_function_t autotest_dotprod_rrrf_struct;
+autotest_function_t autotest_dotprod_rrrf_struct_align;
+autotest_function_t autotest_dotprod_rrrf_rand01;
+autotest_function_t autotest_dotprod_rrrf_rand02;
+autotest_function_t autotest_dotprod_rrrf_struct_lengths;
+autotest_function_t autotest_dotprod_rrrf_struct_vs_ordinal;
+// src/dotprod/tests/dotprod_crcf_autotest.c
+autotest_function_t autotest_dotprod_crcf_rand01;
+autotest_function_t autotest_dotprod_crcf_rand02;
+autotest_function_t autotest_dotprod_crcf_struct_vs_ordinal;
+// src/dotprod/tests/dotprod_cccf_autotest.c
+autotest_function_t autotest_dotprod_cccf_rand16;
+autotest_function_t autotest_dotprod_cccf_struct_lengths;
+autotest_function_t autotest_dotprod_cccf_struct_vs_ordinal;
+// src/dotprod/tests/sumsqf_autotest.c
+autotest_function_t autotest_sumsqf_3;
+autotest_function_t autotest_sumsqf_4;
+autotest_function_t autotest_sumsqf_7;
+autotest_function_t autotest_sumsqf_8;
+autotest_function_t autotest_sumsqf_15;
+autotest_function_t autotest_sumsqf_16;
+// src/dotprod/tests/sumsqcf_autotest.c
+autotest_function_t autotest_sumsqcf_3;
+autotest_function_t autotest_sumsqcf_4;
+autotest_function_t autotest_sumsqcf_7;
+autotest_function_t autotest_sumsqcf_8;
+autotest_function_t autotest_sumsqcf_15;
+autotest_function_t autotest_sumsqcf_16;
+// src/equalization/tests/eqlms_cccf_autotest.c
+autotest_function_t autotest_eqlms_00;
+autotest_function_t autotest_eqlms_01;
+autotest_function_t autotest_eqlms_02;
+autotest_function_t autotest_eqlms_03;
+autotest_function_t autotest_eqlms_04;
+autotest_function_t autotest_eqlms_05;
+autotest_function_t autotest_eqlms_06;
+autotest_function_t autotest_eqlms_07;
+autotest_function_t autotest_eqlms_08;
+autotest_function_t autotest_eqlms_09;
+autotest_function_t autotest_eqlms_10;
+autotest_function_t autotest_eqlms_11;
+autotest_function_t autotest_eqlms_config;
+autotest_function_t autotest_eqlms_cccf_copy;
+// src/equalization/tests/eqrls_cccf_autotest.c
+autotest_function_t autotest_eqrls_cccf_sysid;
+autotest_function_t autotest_eqrls_cccf_sysid_invqr;
+autotest_function_t autotest_eqrls_cccf_sysid_ftf;
+autotest_function_t autotest_eqrls_cccf_sysid_ftf_slow;
+autotest_function_t autotest_eqrls_cccf_invqr;
+autotest_function_t autotest_eqrls_cccf_ftf;
+autotest_function_t autotest_eqrls_cccf_ftf_slow;
+// src/equalization/tests/eqrls_rrrf_autotest.c
+autotest_function_t autotest_eqrls_rrrf_01;
+autotest_function_t autotest_eqrls_rrrf_copy;
+autotest_function_t autotest_eqrls_rrrf_invqr;
+autotest_function_t autotest_eqrls_rrrf_ftf;
+autotest_function_t autotest_eqrls_rrrf_ftf_slow;
+autotest_function_t autotest_eqrls_rrrf_config;
+autotest_function_t autotest_eqrls_rrrf_copy_ftf;
+// src/fec/tests/crc_autotest.c
+autotest_function_t autotest_reverse_byte;
+autotest_function_t autotest_reverse_uint16;
+autotest_function_t autotest_reverse_uint32;
+autotest_function_t autotest_checksum;
+autotest_function_t autotest_crc8;
+autotest_function_t autotest_crc16;
+autotest_function_t autotest_crc24;
+autotest_function_t autotest_crc32;
+autotest_function_t autotest_crc_config;
+// src/fec/tests/fec_autotest.c
+autotest_function_t autotest_fec_r3;
+autotest_function_t autotest_fec_r5;
+autotest_function_t autotest_fec_h74;
+autotest_function_t autotest_fec_h84;
+autotest_function_t autotest_fec_h128;
+autotest_function_t autotest_fec_g2412;
+autotest_function_t autotest_fec_secded2216;
+autotest_function_t autotest_fec_secded3932;
+autotest_function_t autotest_fec_secded7264;
+autotest_function_t autotest_fec_v27;
+autotest_function_t autotest_fec_v29;
+autotest_function_t autotest_fec_v39;
+autotest_function_t autotest_fec_v615;
+autotest_function_t autotest_fec_v27p23;
+autotest_function_t autotest_fec_v27p34;
+autotest_function_t autotest_fec_v27p45;
+autotest_function_t autotest_fec_v27p56;
+autotest_function_t autotest_fec_v27p67;
+autotest_function_t autotest_fec_v27p78;
+autotest_function_t autotest_fec_v29p23;
+autotest_function_t autotest_fec_v29p34;
+autotest_function_t autotest_fec_v29p45;
+autotest_function_t autotest_fec_v29p56;
+autotest_function_t autotest_fec_v29p67;
+autotest_function_t autotest_fec_v29p78;
+autotest_function_t autotest_fec_rs8;
+autotest_function_t autotest_fec_ldpc12;
+autotest_function_t autotest_fec_ldpc23;
+autotest_function_t autotest_fec_ldpc34;
+// src/fec/tests/fec_config_autotest.c
+autotest_function_t autotest_fec_config;
+autotest_function_t autotest_fec_str2fec;
+autotest_function_t autotest_fec_is_convolutional;
+autotest_function_t autotest_fec_is_punctured;
+autotest_function_t autotest_fec_is_reedsolomon;
+autotest_function_t autotest_fec_is_hamming;
+// src/fec/tests/fec_copy_autotest.c
+autotest_function_t autotest_fec_copy_r3;
+autotest_function_t autotest_fec_copy_r5;
+autotest_function_t autotest_fec_copy_h74;
+autotest_function_t autotest_fec_copy_h84;
+autotest_function_t autotest_fec_copy_h128;
+autotest_function_t autotest_fec_copy_g2412;
+autotest_function_t autotest_fec_copy_secded2216;
+autotest_function_t autotest_fec_copy_secded3932;
+autotest_function_t autotest_fec_copy_secded7264;
+autotest_function_t autotest_fec_copy_v27;
+autotest_function_t autotest_fec_copy_v29;
+autotest_function_t autotest_fec_copy_v39;
+autotest_function_t autotest_fec_copy_v615;
+autotest_function_t autotest_fec_copy_v27p23;
+autotest_function_t autotest_fec_copy_v27p34;
+autotest_function_t autotest_fec_copy_v27p45;
+autotest_function_t autotest_fec_copy_v27p56;
+autotest_function_t autotest_fec_copy_v27p67;
+autotest_function_t autotest_fec_copy_v27p78;
+autotest_function_t autotest_fec_copy_v29p23;
+autotest_function_t autotest_fec_copy_v29p34;
+autotest_function_t autotest_fec_copy_v29p45;
+autotest_function_t autotest_fec_copy_v29p56;
+autotest_function_t autotest_fec_copy_v29p67;
+autotest_function_t autotest_fec_copy_v29p78;
+autotest_function_t autotest_fec_copy_rs8;
+autotest_function_t autotest_fec_copy_ldpc12;
+// src/fec/tests/fec_soft_autotest.c
+autotest_function_t autotest_fecsoft_r3;
+autotest_function_t autotest_fecsoft_r5;
+autotest_function_t autotest_fecsoft_h74;
+autotest_function_t autotest_fecsoft_h84;
+autotest_function_t autotest_fecsoft_h128;
+autotest_function_t autotest_fecsoft_v27;
+autotest_function_t autotest_fecsoft_v29;
+autotest_function_t autotest_fecsoft_v39;
+autotest_function_t autotest_fecsoft_v615;
+autotest_function_t autotest_fecsoft_v27p23;
+autotest_function_t autotest_fecsoft_v27p34;
+autotest_function_t autotest_fecsoft_v27p45;
+autotest_function_t autotest_fecsoft_v27p56;
+autotest_function_t autotest_fecsoft_v27p67;
+autotest_function_t autotest_fecsoft_v27p78;
+autotest_function_t autotest_fecsoft_v29p23;
+autotest_function_t autotest_fecsoft_v29p34;
+autotest_function_t autotest_fecsoft_v29p45;
+autotest_function_t autotest_fecsoft_v29p56;
+autotest_function_t autotest_fecsoft_v29p67;
+autotest_function_t autotest_fecsoft_v29p78;
+autotest_function_t autotest_fecsoft_rs8;
+autotest_function_t autotest_fecsoft_ldpc12;
+autotest_function_t autotest_fecsoft_ldpc23;
+autotest_function_t autotest_fecsoft_ldpc34;
+// src/fec/tests/fec_golay2412_autotest.c
+autotest_function_t autotest_golay2412_codec;
+// src/fec/tests/fec_hamming74_autotest.c
+autotest_function_t autotest_hamming74_codec;
+autotest_function_t autotest_hamming74_codec_soft;
+// src/fec/tests/fec_hamming84_autotest.c
+autotest_function_t autotest_hamming84_codec;
+autotest_function_t autotest_hamming84_codec_soft;
+// src/fec/tests/fec_hamming128_autotest.c
+autotest_function_t autotest_hamming128_codec;
+autotest_function_t autotest_hamming128_codec_soft;
+// src/fec/tests/fec_hamming1511_autotest.c
+autotest_function_t autotest_hamming1511_codec;
+// src/fec/tests/fec_hamming3126_autotest.c
+autotest_function_t autotest_hamming3126_codec;
+// src/fec/tests/fec_ldpc_autotest.c
+autotest_function_t autotest_fec_ldpc12_hard_n1;
+autotest_function_t autotest_fec_ldpc12_hard_n37;
+autotest_function_t autotest_fec_ldpc12_hard_n144;
+autotest_function_t autotest_fec_ldpc12_hard_n1000;
+autotest_function_t autotest_fec_ldpc23_hard_n192;
+autotest_function_t autotest_fec_ldpc23_hard_n500;
+autotest_function_t autotest_fec_ldpc34_hard_n216;
+autotest_function_t autotest_fec_ldpc34_hard_n777;
+autotest_function_t autotest_fec_ldpc12_soft_n144;
+autotest_function_t autotest_fec_ldpc23_soft_n192;
+autotest_function_t autotest_fec_ldpc34_soft_n216;
+autotest_function_t autotest_fec_ldpc_length;
+autotest_function_t autotest_fec_ldpc12_girth;
+autotest_function_t autotest_fec_ldpc23_girth;
+autotest_function_t autotest_fec_ldpc34_girth;
+// src/fec/tests/fec_reedsolomon_autotest.c
+autotest_function_t autotest_reedsolomon_223_255;
+autotest_function_t autotest_reedsolomon_lengths;
+// src/fec/tests/fec_rep3_autotest.c
+autotest_function_t autotest_rep3_codec;
+// src/fec/tests/fec_rep5_autotest.c
+autotest_function_t autotest_rep5_codec;
+// src/fec/tests/fec_secded2216_autotest.c
+autotest_function_t autotest_secded2216_codec_e0;
+autotest_function_t autotest_secded2216_codec_e1;
+autotest_function_t autotest_secded2216_codec_e2;
+// src/fec/tests/fec_secded3932_autotest.c
+autotest_function_t autotest_secded3932_codec_e0;
+autotest_function_t autotest_secded3932_codec_e1;
+autotest_function_t autotest_secded3932_codec_e2;
+// src/fec/tests/fec_secded7264_autotest.c
+autotest_function_t autotest_secded7264_codec_e0;
+autotest_function_t autotest_secded7264_codec_e1;
+autotest_function_t autotest_secded7264_codec_e2;
+// src/fec/tests/interleaver_autotest.c
+autotest_function_t autotest_interleaver_hard_8;
+autotest_function_t autotest_interleaver_hard_16;
+autotest_function_t autotest_interleaver_hard_64;
+autotest_function_t autotest_interleaver_hard_256;
+autotest_function_t autotest_interleaver_soft_8;
+autotest_function_t autotest_interleaver_soft_16;
+autotest_function_t autotest_interleaver_soft_64;
+autotest_function_t autotest_interleaver_soft_256;
+autotest_function_t autotest_interleaver_depth;
+// src/fec/tests/packetizer_copy_autotest.c
+autotest_function_t autotest_packetizer_copy;
+// src/fec/tests/packetizer_autotest.c
+autotest_function_t autotest_packetizer_n16_0_0;
+autotest_function_t autotest_packetizer_n16_0_1;
+autotest_function_t autotest_packetizer_n16_0_2;
+autotest_function_t autotest_packetizer_batch_0_0;
+autotest_function_t autotest_packetizer_batch_0_1;
+autotest_function_t autotest_packetizer_batch_1_0;
+autotest_function_t autotest_packetizer_batch_1_1;
+// src/fft/tests/asgram_autotest.c
+autotest_function_t autotest_asgramcf_copy;
+// src/fft/tests/fft_small_autotest.c
+autotest_function_t autotest_fft_3;
+autotest_function_t autotest_fft_5;
+autotest_function_t autotest_fft_6;
+autotest_function_t autotest_fft_7;
+autotest_function_t autotest_fft_9;
+// src/fft/tests/fft_radix2_autotest.c
+autotest_function_t autotest_fft_2;
+autotest_function_t autotest_fft_4;
+autotest_function_t autotest_fft_8;
+autotest_function_t autotest_fft_16;
+autotest_function_t autotest_fft_32;
+autotest_function_t autotest_fft_64;
+// src/fft/tests/fft_composite_autotest.c
+autotest_function_t autotest_fft_10;
+autotest_function_t autotest_fft_21;
+autotest_function_t autotest_fft_22;
+autotest_function_t autotest_fft_24;
+autotest_function_t autotest_fft_26;
+autotest_function_t autotest_fft_30;
+autotest_function_t autotest_fft_35;
+autotest_function_t autotest_fft_36;
+autotest_function_t autotest_fft_48;
+autotest_function_t autotest_fft_63;
+autotest_function_t autotest_fft_92;
+autotest_function_t autotest_fft_96;
+autotest_function_t autotest_fft_120;
+autotest_function_t autotest_fft_130;
+autotest_function_t autotest_fft_192;
+// src/fft/tests/fft_prime_autotest.c
+autotest_function_t autotest_fft_17;
+autotest_function_t autotest_fft_43;
+autotest_function_t autotest_fft_79;
+autotest_function_t autotest_fft_157;
+autotest_function_t autotest_fft_317;
+autotest_function_t autotest_fft_509;
+// src/fft/tests/fft_r2r_autotest.c
+autotest_function_t autotest_fft_r2r_REDFT00_n8;
+autotest_function_t autotest_fft_r2r_REDFT10_n8;
+autotest_function_t autotest_fft_r2r_REDFT01_n8;
+autotest_function_t autotest_fft_r2r_REDFT11_n8;
+autotest_function_t autotest_fft_r2r_RODFT00_n8;
+autotest_function_t autotest_fft_r2r_RODFT10_n8;
+autotest_function_t autotest_fft_r2r_RODFT01_n8;
+autotest_function_t autotest_fft_r2r_RODFT11_n8;
+autotest_function_t autotest_fft_r2r_REDFT00_n32;
+autotest_function_t autotest_fft_r2r_REDFT10_n32;
+autotest_function_t autotest_fft_r2r_REDFT01_n32;
+autotest_function_t autotest_fft_r2r_REDFT11_n32;
+autotest_function_t autotest_fft_r2r_RODFT00_n32;
+autotest_function_t autotest_fft_r2r_RODFT10_n32;
+autotest_function_t autotest_fft_r2r_RODFT01_n32;
+autotest_function_t autotest_fft_r2r_RODFT11_n32;
+autotest_function_t autotest_fft_r2r_REDFT00_n27;
+autotest_function_t autotest_fft_r2r_REDFT10_n27;
+autotest_function_t autotest_fft_r2r_REDFT01_n27;
+autotest_function_t autotest_fft_r2r_REDFT11_n27;
+autotest_function_t autotest_fft_r2r_RODFT00_n27;
+autotest_function_t autotest_fft_r2r_RODFT10_n27;
+autotest_function_t autotest_fft_r2r_RODFT01_n27;
+autotest_function_t autotest_fft_r2r_RODFT11_n27;
+// src/fft/tests/fft_shift_autotest.c
+autotest_function_t autotest_fft_shift_4;
+autotest_function_t autotest_fft_shift_8;
+// src/fft/tests/spgram_autotest.c
+autotest_function_t autotest_spgramcf_noise_440;
+autotest_function_t autotest_spgramcf_noise_1024;
+autotest_function_t autotest_spgramcf_noise_1200;
+autotest_function_t autotest_spgramcf_noise_custom_0;
+autotest_function_t autotest_spgramcf_noise_custom_1;
+autotest_function_t autotest_spgramcf_noise_custom_2;
+autotest_function_t autotest_spgramcf_noise_custom_3;
+autotest_function_t autotest_spgramcf_noise_hamming;
+autotest_function_t autotest_spgramcf_noise_hann;
+autotest_function_t autotest_spgramcf_noise_blackmanharris;
+autotest_function_t autotest_spgramcf_noise_blackmanharris7;
+autotest_function_t autotest_spgramcf_noise_kaiser;
+autotest_function_t autotest_spgramcf_noise_flattop;
+autotest_function_t autotest_spgramcf_noise_triangular;
+autotest_function_t autotest_spgramcf_noise_rcostaper;
+autotest_function_t autotest_spgramcf_noise_kbd;
+autotest_function_t autotest_spgramcf_signal_00;
+autotest_function_t autotest_spgramcf_signal_01;
+autotest_function_t autotest_spgramcf_signal_02;
+autotest_function_t autotest_spgramcf_signal_03;
+autotest_function_t autotest_spgramcf_signal_04;
+autotest_function_t autotest_spgramcf_signal_05;
+autotest_function_t autotest_spgramcf_counters;
+autotest_function_t autotest_spgramcf_invalid_config;
+autotest_function_t autotest_spgramcf_standalone;
+autotest_function_t autotest_spgramcf_short;
+autotest_function_t autotest_spgramcf_copy;
+autotest_function_t autotest_spgramcf_null;
+autotest_function_t autotest_spgram_gnuplot;
+// src/fft/tests/spwaterfall_autotest.c
+autotest_function_t autotest_spwaterfall_invalid_config;
+autotest_function_t autotest_spwaterfallcf_noise_440;
+autotest_function_t autotest_spwaterfallcf_noise_1024;
+autotest_function_t autotest_spwaterfallcf_noise_1200;
+autotest_function_t autotest_spwaterfall_operation;
+autotest_function_t autotest_spwaterfall_copy;
+autotest_function_t autotest_spwaterfall_gnuplot;
+// src/filter/tests/dds_cccf_autotest.c
+autotest_function_t autotest_dds_cccf_0;
+autotest_function_t autotest_dds_cccf_1;
+autotest_function_t autotest_dds_cccf_2;
+autotest_function_t autotest_dds_config;
+autotest_function_t autotest_dds_copy;
+// src/filter/tests/design_cache_autotest.c
+autotest_function_t autotest_design_cache_kaiser;
+autotest_function_t autotest_design_cache_evict;
+autotest_function_t autotest_design_cache_designs;
+autotest_function_t autotest_design_cache_single_rkaiser;
+autotest_function_t autotest_design_cache_single_arkaiser;
+autotest_function_t autotest_design_cache_single_hM3;
+autotest_function_t autotest_design_cache_halfband;
+autotest_function_t autotest_design_cache_config;
+// src/filter/tests/fdelay_rrrf_autotest.c
+autotest_function_t autotest_fdelay_rrrf_0;
+autotest_function_t autotest_fdelay_rrrf_1;
+autotest_function_t autotest_fdelay_rrrf_2;
+autotest_function_t autotest_fdelay_rrrf_3;
+autotest_function_t autotest_fdelay_rrrf_4;
+autotest_function_t autotest_fdelay_rrrf_5;
+autotest_function_t autotest_fdelay_rrrf_6;
+autotest_function_t autotest_fdelay_rrrf_7;
+autotest_function_t autotest_fdelay_rrrf_8;
+autotest_function_t autotest_fdelay_rrrf_9;
+autotest_function_t autotest_fdelay_rrrf_config;
+autotest_function_t autotest_fdelay_rrrf_push_write;
+// src/filter/tests/fftfilt_xxxf_autotest.c
+autotest_function_t autotest_fftfilt_rrrf_data_h4x256;
+autotest_function_t autotest_fftfilt_rrrf_data_h7x256;
+autotest_function_t autotest_fftfilt_rrrf_data_h13x256;
+autotest_function_t autotest_fftfilt_rrrf_data_h23x256;
+autotest_function_t autotest_fftfilt_crcf_data_h4x256;
+autotest_function_t autotest_fftfilt_crcf_data_h7x256;
+autotest_function_t autotest_fftfilt_crcf_data_h13x256;
+autotest_function_t autotest_fftfilt_crcf_data_h23x256;
+autotest_function_t autotest_fftfilt_cccf_data_h4x256;
+autotest_function_t autotest_fftfilt_cccf_data_h7x256;
+autotest_function_t autotest_fftfilt_cccf_data_h13x256;
+autotest_function_t autotest_fftfilt_cccf_data_h23x256;
+autotest_function_t autotest_fftfilt_config;
+autotest_function_t autotest_fftfilt_copy;
+// src/filter/tests/filter_crosscorr_autotest.c
+autotest_function_t autotest_filter_crosscorr_rrrf;
+// src/filter/tests/firdecim_autotest.c
+autotest_function_t autotest_firdecim_config;
+autotest_function_t autotest_firdecim_block;
+// src/filter/tests/firdecim_xxxf_autotest.c
+autotest_function_t autotest_firdecim_rrrf_common;
+autotest_function_t autotest_firdecim_crcf_common;
+autotest_function_t autotest_firdecim_rrrf_data_M2h4x20;
+autotest_function_t autotest_firdecim_rrrf_data_M3h7x30;
+autotest_function_t autotest_firdecim_rrrf_data_M4h13x40;
+autotest_function_t autotest_firdecim_rrrf_data_M5h23x50;
+autotest_function_t autotest_firdecim_crcf_data_M2h4x20;
+autotest_function_t autotest_firdecim_crcf_data_M3h7x30;
+autotest_function_t autotest_firdecim_crcf_data_M4h13x40;
+autotest_function_t autotest_firdecim_crcf_data_M5h23x50;
+autotest_function_t autotest_firdecim_cccf_data_M2h4x20;
+autotest_function_t autotest_firdecim_cccf_data_M3h7x30;
+autotest_function_t autotest_firdecim_cccf_data_M4h13x40;
+autotest_function_t autotest_firdecim_cccf_data_M5h23x50;
+// src/filter/tests/firdes_autotest.c
+autotest_function_t autotest_liquid_firdes_rcos;
+autotest_function_t autotest_liquid_firdes_rrcos;
+autotest_function_t autotest_firdes_rrcos;
+autotest_function_t autotest_firdes_rkaiser;
+autotest_function_t autotest_firdes_arkaiser;
+autotest_function_t autotest_liquid_firdes_dcblock;
+autotest_function_t autotest_liquid_firdes_notch;
+autotest_function_t autotest_liquid_getopt_str2firfilt;
+autotest_function_t autotest_liquid_firdes_config;
+autotest_function_t autotest_liquid_firdes_estimate;
+autotest_function_t autotest_firdes_prototype_kaiser;
+autotest_function_t autotest_firdes_prototype_pm;
+autotest_function_t autotest_firdes_prototype_rcos;
+autotest_function_t autotest_firdes_prototype_fexp;
+autotest_function_t autotest_firdes_prototype_fsech;
+autotest_function_t autotest_firdes_prototype_farcsech;
+autotest_function_t autotest_firdes_prototype_arkaiser;
+autotest_function_t autotest_firdes_prototype_rkaiser;
+autotest_function_t autotest_firdes_prototype_rrcos;
+autotest_function_t autotest_firdes_prototype_hm3;
+autotest_function_t autotest_firdes_prototype_rfexp;
+autotest_function_t autotest_firdes_prototype_rfsech;
+autotest_function_t autotest_firdes_prototype_rfarcsech;
+autotest_function_t autotest_firdes_doppler;
+autotest_function_t autotest_liquid_freqrespf;
+autotest_function_t autotest_liquid_freqrespcf;
+// src/filter/tests/firdespm_autotest.c
+autotest_function_t autotest_firdespm_bandpass_n24;
+autotest_function_t autotest_firdespm_bandpass_n32;
+autotest_function_t autotest_firdespm_lowpass;
+autotest_function_t autotest_firdespm_callback;
+autotest_function_t autotest_firdespm_halfband_m2_ft400;
+autotest_function_t autotest_firdespm_halfband_m4_ft400;
+autotest_function_t autotest_firdespm_halfband_m4_ft200;
+autotest_function_t autotest_firdespm_halfband_m10_ft200;
+autotest_function_t autotest_firdespm_halfband_m12_ft100;
+autotest_function_t autotest_firdespm_halfband_m20_ft050;
+autotest_function_t autotest_firdespm_halfband_m40_ft050;
+autotest_function_t autotest_firdespm_halfband_m80_ft010;
+autotest_function_t autotest_firdespm_lowpass_long;
+autotest_function_t autotest_firdespm_workers;
+autotest_function_t autotest_firdespm_copy;
+autotest_function_t autotest_firdespm_config;
+autotest_function_t autotest_firdespm_differentiator;
+autotest_function_t autotest_firdespm_hilbert;
+// src/filter/tests/firfilt_autotest.c
+autotest_function_t autotest_firfilt_crcf_kaiser;
+autotest_function_t autotest_firfilt_crcf_firdespm;
+autotest_function_t autotest_firfilt_crcf_rect;
+autotest_function_t autotest_firfilt_crcf_notch;
+autotest_function_t autotest_firfilt_cccf_notch;
+autotest_function_t autotest_firfilt_config;
+autotest_function_t autotest_firfilt_recreate;
+autotest_function_t autotest_firfilt_push_write;
+// src/filter/tests/firfilt_cccf_notch_autotest.c
+autotest_function_t autotest_firfilt_cccf_notch_0;
+autotest_function_t autotest_firfilt_cccf_notch_1;
+autotest_function_t autotest_firfilt_cccf_notch_2;
+autotest_function_t autotest_firfilt_cccf_notch_3;
+autotest_function_t autotest_firfilt_cccf_notch_4;
+autotest_function_t autotest_firfilt_cccf_notch_5;
+// src/filter/tests/firfilt_coefficients_autotest.c
+autotest_function_t autotest_firfilt_cccf_coefficients_test;
+// src/filter/tests/firfilt_rnyquist_autotest.c
+autotest_function_t autotest_firfilt_rnyquist_baseline_arkaiser;
+autotest_function_t autotest_firfilt_rnyquist_baseline_rkaiser;
+autotest_function_t autotest_firfilt_rnyquist_baseline_rrc;
+autotest_function_t autotest_firfilt_rnyquist_baseline_hm3;
+autotest_function_t autotest_firfilt_rnyquist_baseline_gmsktxrx;
+autotest_function_t autotest_firfilt_rnyquist_baseline_rfexp;
+autotest_function_t autotest_firfilt_rnyquist_baseline_rfsech;
+autotest_function_t autotest_firfilt_rnyquist_baseline_rfarcsech;
+autotest_function_t autotest_firfilt_rnyquist_0;
+autotest_function_t autotest_firfilt_rnyquist_1;
+autotest_function_t autotest_firfilt_rnyquist_2;
+autotest_function_t autotest_firfilt_rnyquist_3;
+autotest_function_t autotest_firfilt_rnyquist_4;
+autotest_function_t autotest_firfilt_rnyquist_5;
+autotest_function_t autotest_firfilt_rnyquist_6;
+autotest_function_t autotest_firfilt_rnyquist_7;
+autotest_function_t autotest_firfilt_rnyquist_8;
+autotest_function_t autotest_firfilt_rnyquist_9;
+// src/filter/tests/firfilt_xxxf_autotest.c
+autotest_function_t autotest_firfilt_rrrf_data_h4x8;
+autotest_function_t autotest_firfilt_rrrf_data_h7x16;
+autotest_function_t autotest_firfilt_rrrf_data_h13x32;
+autotest_function_t autotest_firfilt_rrrf_data_h23x64;
+autotest_function_t autotest_firfilt_crcf_data_h4x8;
+autotest_function_t autotest_firfilt_crcf_data_h7x16;
+autotest_function_t autotest_firfilt_crcf_data_h13x32;
+autotest_function_t autotest_firfilt_crcf_data_h23x64;
+autotest_function_t autotest_firfilt_cccf_data_h4x8;
+autotest_function_t autotest_firfilt_cccf_data_h7x16;
+autotest_function_t autotest_firfilt_cccf_data_h13x32;
+autotest_function_t autotest_firfilt_cccf_data_h23x64;
+// src/filter/tests/firfilt_copy_autotest.c
+autotest_function_t autotest_firfilt_crcf_copy;
+// src/filter/tests/firhilb_autotest.c
+autotest_function_t autotest_firhilbf_decim;
+autotest_function_t autotest_firhilbf_interp;
+autotest_function_t autotest_firhilbf_psd;
+autotest_function_t autotest_firhilbf_invalid_config;
+autotest_function_t autotest_firhilbf_copy_interp;
+autotest_function_t autotest_firhilbf_copy_decim;
+autotest_function_t autotest_firhilbf_r2c_block;
+autotest_function_t autotest_firhilbf_c2r_block;
+autotest_function_t autotest_firhilbf_decim_block;
+autotest_function_t autotest_firhilbf_interp_block;
+// src/filter/tests/firinterp_autotest.c
+autotest_function_t autotest_firinterp_rrrf_common;
+autotest_function_t autotest_firinterp_crcf_common;
+autotest_function_t autotest_firinterp_rrrf_generic;
+autotest_function_t autotest_firinterp_crcf_generic;
+autotest_function_t autotest_firinterp_crcf_rnyquist_0;
+autotest_function_t autotest_firinterp_crcf_rnyquist_1;
+autotest_function_t autotest_firinterp_crcf_rnyquist_2;
+autotest_function_t autotest_firinterp_crcf_rnyquist_3;
+autotest_function_t autotest_firinterp_copy;
+autotest_function_t autotest_firinterp_flush;
+// src/filter/tests/firpfb_autotest.c
+autotest_function_t autotest_firpfb_impulse_response;
+autotest_function_t autotest_firpfb_crcf_copy;
+// src/filter/tests/groupdelay_autotest.c
+autotest_function_t autotest_fir_groupdelay_n3;
+autotest_function_t autotest_iir_groupdelay_n3;
+autotest_function_t autotest_iir_groupdelay_n8;
+autotest_function_t autotest_iir_groupdelay_sos_n8;
+// src/filter/tests/iirdecim_autotest.c
+autotest_function_t autotest_iirdecim_copy;
+// src/filter/tests/iirdes_autotest.c
+autotest_function_t autotest_iirdes_butter_2;
+autotest_function_t autotest_iirdes_ellip_lowpass_0;
+autotest_function_t autotest_iirdes_ellip_lowpass_1;
+autotest_function_t autotest_iirdes_ellip_lowpass_2;
+autotest_function_t autotest_iirdes_ellip_lowpass_3;
+autotest_function_t autotest_iirdes_ellip_lowpass_4;
+autotest_function_t autotest_iirdes_cheby1_lowpass_0;
+autotest_function_t autotest_iirdes_cheby1_lowpass_1;
+autotest_function_t autotest_iirdes_cheby1_lowpass_2;
+autotest_function_t autotest_iirdes_cheby1_lowpass_3;
+autotest_function_t autotest_iirdes_cheby1_lowpass_4;
+autotest_function_t autotest_iirdes_cheby2_lowpass_0;
+autotest_function_t autotest_iirdes_cheby2_lowpass_1;
+autotest_function_t autotest_iirdes_cheby2_lowpass_2;
+autotest_function_t autotest_iirdes_cheby2_lowpass_3;
+autotest_function_t autotest_iirdes_cheby2_lowpass_4;
+autotest_function_t autotest_iirdes_butter_lowpass_0;
+autotest_function_t autotest_iirdes_butter_lowpass_1;
+autotest_function_t autotest_iirdes_butter_lowpass_2;
+autotest_function_t autotest_iirdes_butter_lowpass_3;
+autotest_function_t autotest_iirdes_butter_lowpass_4;
+autotest_function_t autotest_iirdes_ellip_highpass;
+autotest_function_t autotest_iirdes_ellip_bandpass;
+autotest_function_t autotest_iirdes_ellip_bandstop;
+autotest_function_t autotest_iirdes_bessel;
+// src/filter/tests/iirdes_support_autotest.c
+autotest_function_t autotest_iirdes_cplxpair_n6;
+autotest_function_t autotest_iirdes_cplxpair_n20;
+autotest_function_t autotest_iirdes_dzpk2sosf;
+autotest_function_t autotest_iirdes_isstable_n2_yes;
+autotest_function_t autotest_iirdes_isstable_n2_no;
+// src/filter/tests/iirfilt_autotest.c
+autotest_function_t autotest_iirfilt_integrator;
+autotest_function_t autotest_iirfilt_differentiator;
+autotest_function_t autotest_iirfilt_dcblock;
+autotest_function_t autotest_iirfilt_copy_tf;
+autotest_function_t autotest_iirfilt_copy_sos;
+autotest_function_t autotest_iirfilt_config;
+// src/filter/tests/iirfilt_xxxf_autotest.c
+autotest_function_t autotest_iirfilt_rrrf_h3x64;
+autotest_function_t autotest_iirfilt_rrrf_h5x64;
+autotest_function_t autotest_iirfilt_rrrf_h7x64;
+autotest_function_t autotest_iirfilt_crcf_h3x64;
+autotest_function_t autotest_iirfilt_crcf_h5x64;
+autotest_function_t autotest_iirfilt_crcf_h7x64;
+autotest_function_t autotest_iirfilt_cccf_h3x64;
+autotest_function_t autotest_iirfilt_cccf_h5x64;
+autotest_function_t autotest_iirfilt_cccf_h7x64;
+// src/filter/tests/iirfiltbank_autotest.c
+autotest_function_t autotest_iirfiltbank_crcf_channels;
+autotest_function_t autotest_iirfiltbank_rrrf_dcblock_block;
+autotest_function_t autotest_iirfiltbank_crcf_lookahead_n4_1024;
+autotest_function_t autotest_iirfiltbank_crcf_lookahead_n7_1500;
+autotest_function_t autotest_iirfiltbank_crcf_lookahead_n3_4099;
+autotest_function_t autotest_iirfiltbank_copy;
+autotest_function_t autotest_iirfiltbank_config;
+// src/filter/tests/iirfiltsos_autotest.c
+autotest_function_t autotest_iirfiltsos_impulse_n2;
+autotest_function_t autotest_iirfiltsos_step_n2;
+autotest_function_t autotest_iirfiltsos_copy;
+autotest_function_t autotest_iirfiltsos_config;
+// src/filter/tests/iirhilb_autotest.c
+autotest_function_t autotest_iirhilbf_interp_decim;
+autotest_function_t autotest_iirhilbf_filter;
+autotest_function_t autotest_iirhilbf_invalid_config;
+autotest_function_t autotest_iirhilbf_copy_interp;
+autotest_function_t autotest_iirhilbf_copy_decim;
+// src/filter/tests/iirinterp_autotest.c
+autotest_function_t autotest_iirinterp_crcf_M2_O9;
+autotest_function_t autotest_iirinterp_crcf_M3_O9;
+autotest_function_t autotest_iirinterp_crcf_M4_O9;
+autotest_function_t autotest_iirinterp_copy;
+// src/filter/tests/lpc_autotest.c
+autotest_function_t autotest_lpc_p4;
+autotest_function_t autotest_lpc_p6;
+autotest_function_t autotest_lpc_p8;
+autotest_function_t autotest_lpc_p10;
+autotest_function_t autotest_lpc_p16;
+autotest_function_t autotest_lpc_p32;
+// src/filter/tests/msresamp_crcf_autotest.c
+autotest_function_t autotest_msresamp_crcf_01;
+autotest_function_t autotest_msresamp_crcf_02;
+autotest_function_t autotest_msresamp_crcf_03;
+autotest_function_t autotest_msresamp_crcf_num_output_0;
+autotest_function_t autotest_msresamp_crcf_num_output_1;
+autotest_function_t autotest_msresamp_crcf_num_output_2;
+autotest_function_t autotest_msresamp_crcf_num_output_3;
+autotest_function_t autotest_msresamp_crcf_num_output_4;
+autotest_function_t autotest_msresamp_crcf_num_output_5;
+autotest_function_t autotest_msresamp_crcf_num_output_6;
+autotest_function_t autotest_msresamp_crcf_num_output_7;
+autotest_function_t autotest_msresamp_crcf_copy;
+// src/filter/tests/msresamp2_crcf_autotest.c
+autotest_function_t autotest_msresamp2_crcf_interp_01;
+autotest_function_t autotest_msresamp2_crcf_interp_02;
+autotest_function_t autotest_msresamp2_crcf_interp_03;
+autotest_function_t autotest_msresamp2_crcf_interp_04;
+autotest_function_t autotest_msresamp2_crcf_interp_05;
+autotest_function_t autotest_msresamp2_crcf_interp_06;
+autotest_function_t autotest_msresamp2_crcf_interp_07;
+autotest_function_t autotest_msresamp2_crcf_interp_08;
+autotest_function_t autotest_msresamp2_crcf_interp_09;
+autotest_function_t autotest_msresamp2_crcf_interp_10;
+autotest_function_t autotest_msresamp2_crcf_interp_11;
+autotest_function_t autotest_msresamp2_copy;
+// src/filter/tests/ordfilt_autotest.c
+autotest_function_t autotest_ordfilt_copy;
+// src/filter/tests/rresamp_crcf_autotest.c
+autotest_function_t autotest_rresamp_crcf_baseline_P1_Q5;
+autotest_function_t autotest_rresamp_crcf_baseline_P2_Q5;
+autotest_function_t autotest_rresamp_crcf_baseline_P3_Q5;
+autotest_function_t autotest_rresamp_crcf_baseline_P6_Q5;
+autotest_function_t autotest_rresamp_crcf_baseline_P8_Q5;
+autotest_function_t autotest_rresamp_crcf_baseline_P9_Q5;
+autotest_function_t autotest_rresamp_crcf_default_P1_Q5;
+autotest_function_t autotest_rresamp_crcf_default_P2_Q5;
+autotest_function_t autotest_rresamp_crcf_default_P3_Q5;
+autotest_function_t autotest_rresamp_crcf_default_P6_Q5;
+autotest_function_t autotest_rresamp_crcf_default_P8_Q5;
+autotest_function_t autotest_rresamp_crcf_default_P9_Q5;
+autotest_function_t autotest_rresamp_crcf_arkaiser_P3_Q5;
+autotest_function_t autotest_rresamp_crcf_arkaiser_P5_Q3;
+autotest_function_t autotest_rresamp_crcf_rrcos_P3_Q5;
+autotest_function_t autotest_rresamp_crcf_rrcos_P5_Q3;
+autotest_function_t autotest_rresamp_copy;
+autotest_function_t autotest_rresamp_config;
+// src/filter/tests/rresamp_crcf_partition_autotest.c
+autotest_function_t autotest_rresamp_crcf_part_P1_Q5;
+autotest_function_t autotest_rresamp_crcf_part_P2_Q5;
+autotest_function_t autotest_rresamp_crcf_part_P3_Q5;
+autotest_function_t autotest_rresamp_crcf_part_P6_Q5;
+autotest_function_t autotest_rresamp_crcf_part_P8_Q5;
+autotest_function_t autotest_rresamp_crcf_part_P9_Q5;
+// src/filter/tests/resamp_crcf_autotest.c
+autotest_function_t autotest_resamp_crcf_00;
+autotest_function_t autotest_resamp_crcf_01;
+autotest_function_t autotest_resamp_crcf_02;
+autotest_function_t autotest_resamp_crcf_03;
+autotest_function_t autotest_resamp_crcf_10;
+autotest_function_t autotest_resamp_crcf_11;
+autotest_function_t autotest_resamp_crcf_12;
+autotest_function_t autotest_resamp_crcf_13;
+autotest_function_t autotest_resamp_crcf_num_output_0;
+autotest_function_t autotest_resamp_crcf_num_output_1;
+autotest_function_t autotest_resamp_crcf_num_output_2;
+autotest_function_t autotest_resamp_crcf_num_output_3;
+autotest_function_t autotest_resamp_crcf_num_output_4;
+autotest_function_t autotest_resamp_crcf_num_output_5;
+autotest_function_t autotest_resamp_crcf_num_output_6;
+autotest_function_t autotest_resamp_crcf_num_output_7;
+autotest_function_t autotest_resamp_crcf_copy;
+// src/filter/tests/resamp2_crcf_autotest.c
+autotest_function_t autotest_resamp2_analysis;
+autotest_function_t autotest_resamp2_synthesis;
+autotest_function_t autotest_resamp2_crcf_filter_0;
+autotest_function_t autotest_resamp2_crcf_filter_1;
+autotest_function_t autotest_resamp2_crcf_filter_2;
+autotest_function_t autotest_resamp2_crcf_filter_3;
+autotest_function_t autotest_resamp2_crcf_filter_4;
+autotest_function_t autotest_resamp2_crcf_filter_5;
+autotest_function_t autotest_resamp2_config;
+autotest_function_t autotest_resamp2_copy;
+// src/filter/tests/rkaiser_autotest.c
+autotest_function_t autotest_liquid_rkaiser_config;
+// src/filter/tests/symsync_copy_autotest.c
+autotest_function_t autotest_symsync_copy;
+autotest_function_t autotest_symsync_config;
+// src/filter/tests/symsync_crcf_autotest.c
+autotest_function_t autotest_symsync_crcf_scenario_0;
+autotest_function_t autotest_symsync_crcf_scenario_1;
+autotest_function_t autotest_symsync_crcf_scenario_2;
+autotest_function_t autotest_symsync_crcf_scenario_3;
+autotest_function_t autotest_symsync_crcf_scenario_4;
+autotest_function_t autotest_symsync_crcf_scenario_5;
+autotest_function_t autotest_symsync_crcf_scenario_6;
+autotest_function_t autotest_symsync_crcf_scenario_7;
+autotest_function_t autotest_symsync_crcf_fused_mf;
+autotest_function_t autotest_symsync_crcf_block;
+// src/filter/tests/symsync_rrrf_autotest.c
+autotest_function_t autotest_symsync_rrrf_scenario_0;
+autotest_function_t autotest_symsync_rrrf_scenario_1;
+autotest_function_t autotest_symsync_rrrf_scenario_2;
+autotest_function_t autotest_symsync_rrrf_scenario_3;
+autotest_function_t autotest_symsync_rrrf_scenario_4;
+autotest_function_t autotest_symsync_rrrf_scenario_5;
+autotest_function_t autotest_symsync_rrrf_scenario_6;
+autotest_function_t autotest_symsync_rrrf_scenario_7;
+// src/framing/tests/bpacketsync_autotest.c
+autotest_function_t autotest_bpacketsync;
+// src/framing/tests/bsync_autotest.c
+autotest_function_t autotest_bsync_rrrf_15;
+autotest_function_t autotest_bsync_crcf_15;
+// src/framing/tests/detector_autotest.c
+autotest_function_t autotest_detector_cccf_n64;
+autotest_function_t autotest_detector_cccf_n83;
+autotest_function_t autotest_detector_cccf_n128;
+autotest_function_t autotest_detector_cccf_n167;
+autotest_function_t autotest_detector_cccf_n256;
+autotest_function_t autotest_detector_cccf_n335;
+autotest_function_t autotest_detector_cccf_n512;
+autotest_function_t autotest_detector_cccf_n671;
+autotest_function_t autotest_detector_cccf_n1024;
+autotest_function_t autotest_detector_cccf_n1341;
+// src/framing/tests/dsssframe64_autotest.c
+autotest_function_t autotest_dsssframe64sync;
+autotest_function_t autotest_dsssframe64_config;
+autotest_function_t autotest_dsssframe64gen_copy;
+autotest_function_t autotest_dsssframe64sync_copy;
+// src/framing/tests/dsssframesync_autotest.c
+autotest_function_t autotest_dsssframesync;
+// src/framing/tests/flexframesync_autotest.c
+autotest_function_t autotest_flexframesync;
+// src/framing/tests/framesync64_autotest.c
+autotest_function_t autotest_framesync64;
+autotest_function_t autotest_framegen64_copy;
+autotest_function_t autotest_framesync64_copy;
+autotest_function_t autotest_framesync64_config;
+autotest_function_t autotest_framesync64_debug_none;
+autotest_function_t autotest_framesync64_debug_user;
+autotest_function_t autotest_framesync64_debug_ndet;
+autotest_function_t autotest_framesync64_debug_head;
+autotest_function_t autotest_framesync64_debug_rand;
+autotest_function_t autotest_framesync64_estimation;
+// src/framing/tests/framesync_batch_autotest.c
+autotest_function_t autotest_framesync64_batch_w1;
+autotest_function_t autotest_framesync64_batch_w4;
+autotest_function_t autotest_flexframesync_batch_w1;
+autotest_function_t autotest_flexframesync_batch_w3;
+autotest_function_t autotest_framesync64_batch_streaming;
+autotest_function_t autotest_framesync_batch_config;
+// src/framing/tests/fskframesync_autotest.c
+autotest_function_t autotest_fskframesync;
+// src/framing/tests/gmskframe_autotest.c
+autotest_function_t autotest_gmskframesync_process;
+autotest_function_t autotest_gmskframesync_multiple;
+autotest_function_t autotest_gmskframesync_k02_m05_bt20;
+autotest_function_t autotest_gmskframesync_k02_m05_bt30;
+autotest_function_t autotest_gmskframesync_k02_m05_bt40;
+autotest_function_t autotest_gmskframesync_k04_m05_bt20;
+autotest_function_t autotest_gmskframesync_k04_m05_bt30;
+autotest_function_t autotest_gmskframesync_k04_m05_bt40;
+autotest_function_t autotest_gmskframesync_k03_m07_bt20;
+autotest_function_t autotest_gmskframesync_k08_m20_bt15;
+autotest_function_t autotest_gmskframesync_k15_m02_bt40;
+// src/framing/tests/msource_autotest.c
+autotest_function_t autotest_msourcecf_tone;
+autotest_function_t autotest_msourcecf_chirp;
+autotest_function_t autotest_msourcecf_aggregate;
+autotest_function_t autotest_msourcecf_config;
+autotest_function_t autotest_msourcecf_accessor;
+autotest_function_t autotest_msourcecf_copy;
+// src/framing/tests/presync_autotest.c
+autotest_function_t autotest_presync_bank_n64;
+autotest_function_t autotest_presync_fft_n64;
+autotest_function_t autotest_presync_fft_n64_neg;
+autotest_function_t autotest_presync_fft_n256;
+autotest_function_t autotest_presync_fft_n256_zero;
+autotest_function_t autotest_bpresync_bank_n64;
+autotest_function_t autotest_bpresync_fft_n64;
+autotest_function_t autotest_bpresync_fft_n256_neg;
+autotest_function_t autotest_presync_fft_block;
+autotest_function_t autotest_presync_config;
+// src/framing/tests/ofdmflexframe_autotest.c
+autotest_function_t autotest_ofdmflexframe_00;
+autotest_function_t autotest_ofdmflexframe_01;
+autotest_function_t autotest_ofdmflexframe_02;
+autotest_function_t autotest_ofdmflexframe_03;
+autotest_function_t autotest_ofdmflexframe_04;
+autotest_function_t autotest_ofdmflexframe_05;
+autotest_function_t autotest_ofdmflexframe_06;
+autotest_function_t autotest_ofdmflexframe_07;
+autotest_function_t autotest_ofdmflexframe_08;
+autotest_function_t autotest_ofdmflexframe_09;
+autotest_function_t autotest_ofdmflexframegen_config;
+autotest_function_t autotest_ofdmflexframesync_config;
+// src/framing/tests/qdetector_cccf_autotest.c
+autotest_function_t autotest_qdetector_cccf_linear_n64;
+autotest_function_t autotest_qdetector_cccf_linear_n83;
+autotest_function_t autotest_qdetector_cccf_linear_n128;
+autotest_function_t autotest_qdetector_cccf_linear_n167;
+autotest_function_t autotest_qdetector_cccf_linear_n256;
+autotest_function_t autotest_qdetector_cccf_linear_n335;
+autotest_function_t autotest_qdetector_cccf_linear_n512;
+autotest_function_t autotest_qdetector_cccf_linear_n671;
+autotest_function_t autotest_qdetector_cccf_linear_n1024;
+autotest_function_t autotest_qdetector_cccf_linear_n1341;
+autotest_function_t autotest_qdetector_cccf_gmsk_n64;
+autotest_function_t autotest_qdetector_cccf_gmsk_n83;
+autotest_function_t autotest_qdetector_cccf_gmsk_n128;
+autotest_function_t autotest_qdetector_cccf_gmsk_n167;
+autotest_function_t autotest_qdetector_cccf_gmsk_n256;
+autotest_function_t autotest_qdetector_cccf_gmsk_n335;
+autotest_function_t autotest_qdetector_cccf_gmsk_n512;
+autotest_function_t autotest_qdetector_cccf_gmsk_n671;
+autotest_function_t autotest_qdetector_cccf_gmsk_n1024;
+autotest_function_t autotest_qdetector_cccf_gmsk_n1341;
+// src/framing/tests/qdetector_cccf_copy_autotest.c
+autotest_function_t autotest_qdetector_cccf_copy;
+// src/framing/tests/qdsync_cccf_autotest.c
+autotest_function_t autotest_qdsync_cccf_k2;
+autotest_function_t autotest_qdsync_cccf_k3;
+autotest_function_t autotest_qdsync_cccf_k4;
+autotest_function_t autotest_qdsync_set_buf_len;
+autotest_function_t autotest_qdsync_cccf_copy;
+autotest_function_t autotest_qdsync_cccf_config;
+// src/framing/tests/qpacketmodem_autotest.c
+autotest_function_t autotest_qpacketmodem_bpsk;
+autotest_function_t autotest_qpacketmodem_qpsk;
+autotest_function_t autotest_qpacketmodem_psk8;
+autotest_function_t autotest_qpacketmodem_qam16;
+autotest_function_t autotest_qpacketmodem_sqam32;
+autotest_function_t autotest_qpacketmodem_qam64;
+autotest_function_t autotest_qpacketmodem_sqam128;
+autotest_function_t autotest_qpacketmodem_qam256;
+autotest_function_t autotest_qpacketmodem_ldpc12;
+autotest_function_t autotest_qpacketmodem_ldpc34;
+autotest_function_t autotest_qpacketmodem_evm;
+autotest_function_t autotest_qpacketmodem_unmod_bpsk;
+autotest_function_t autotest_qpacketmodem_unmod_qpsk;
+autotest_function_t autotest_qpacketmodem_unmod_psk8;
+autotest_function_t autotest_qpacketmodem_unmod_qam16;
+autotest_function_t autotest_qpacketmodem_unmod_sqam32;
+autotest_function_t autotest_qpacketmodem_unmod_qam64;
+autotest_function_t autotest_qpacketmodem_unmod_sqam128;
+autotest_function_t autotest_qpacketmodem_unmod_qam256;
+autotest_function_t autotest_qpacketmodem_copy;
+// src/framing/tests/qpilotsync_autotest.c
+autotest_function_t autotest_qpilotsync_100_16;
+autotest_function_t autotest_qpilotsync_200_20;
+autotest_function_t autotest_qpilotsync_300_24;
+autotest_function_t autotest_qpilotsync_400_28;
+autotest_function_t autotest_qpilotsync_500_32;
+autotest_function_t autotest_qpilotgen_config;
+autotest_function_t autotest_qpilotsync_config;
+// src/framing/tests/qsource_autotest.c
+autotest_function_t autotest_qsourcecf_config;
+// src/framing/tests/symstreamcf_autotest.c
+autotest_function_t autotest_symstreamcf_psd_k2_m12_b030;
+autotest_function_t autotest_symstreamcf_psd_k4_m12_b030;
+autotest_function_t autotest_symstreamcf_psd_k4_m25_b020;
+autotest_function_t autotest_symstreamcf_psd_k7_m11_b035;
+autotest_function_t autotest_symstreamcf_copy;
+// src/framing/tests/symstreamcf_delay_autotest.c
+autotest_function_t autotest_symstreamcf_delay_00;
+autotest_function_t autotest_symstreamcf_delay_01;
+autotest_function_t autotest_symstreamcf_delay_02;
+autotest_function_t autotest_symstreamcf_delay_03;
+autotest_function_t autotest_symstreamcf_delay_04;
+autotest_function_t autotest_symstreamcf_delay_05;
+autotest_function_t autotest_symstreamcf_delay_06;
+autotest_function_t autotest_symstreamcf_delay_07;
+autotest_function_t autotest_symstreamcf_delay_08;
+autotest_function_t autotest_symstreamcf_delay_09;
+autotest_function_t autotest_symstreamcf_delay_10;
+autotest_function_t autotest_symstreamcf_delay_11;
+autotest_function_t autotest_symstreamcf_delay_12;
+autotest_function_t autotest_symstreamcf_delay_13;
+autotest_function_t autotest_symstreamcf_delay_14;
+autotest_function_t autotest_symstreamcf_delay_15;
+autotest_function_t autotest_symstreamcf_delay_16;
+autotest_function_t autotest_symstreamcf_delay_17;
+autotest_function_t autotest_symstreamcf_delay_18;
+autotest_function_t autotest_symstreamcf_delay_19;
+// src/framing/tests/symstreamrcf_autotest.c
+autotest_function_t autotest_symstreamrcf_psd_bw200_m12_b030;
+autotest_function_t autotest_symstreamrcf_psd_bw400_m12_b030;
+autotest_function_t autotest_symstreamrcf_psd_bw400_m25_b020;
+autotest_function_t autotest_symstreamrcf_psd_bw700_m11_b035;
+autotest_function_t autotest_symstreamrcf_copy;
+// src/framing/tests/symstreamrcf_delay_autotest.c
+autotest_function_t autotest_symstreamrcf_delay_00;
+autotest_function_t autotest_symstreamrcf_delay_01;
+autotest_function_t autotest_symstreamrcf_delay_02;
+autotest_function_t autotest_symstreamrcf_delay_03;
+autotest_function_t autotest_symstreamrcf_delay_04;
+autotest_function_t autotest_symstreamrcf_delay_05;
+autotest_function_t autotest_symstreamrcf_delay_06;
+autotest_function_t autotest_symstreamrcf_delay_07;
+autotest_function_t autotest_symstreamrcf_delay_08;
+autotest_function_t autotest_symstreamrcf_delay_09;
+autotest_function_t autotest_symstreamrcf_delay_10;
+autotest_function_t autotest_symstreamrcf_delay_11;
+autotest_function_t autotest_symstreamrcf_delay_12;
+autotest_function_t autotest_symstreamrcf_delay_13;
+autotest_function_t autotest_symstreamrcf_delay_14;
+autotest_function_t autotest_symstreamrcf_delay_15;
+autotest_function_t autotest_symstreamrcf_delay_16;
+autotest_function_t autotest_symstreamrcf_delay_17;
+autotest_function_t autotest_symstreamrcf_delay_18;
+autotest_function_t autotest_symstreamrcf_delay_19;
+// src/framing/tests/symtrack_cccf_autotest.c
+autotest_function_t autotest_symtrack_cccf_bpsk;
+autotest_function_t autotest_symtrack_cccf_qpsk;
+autotest_function_t autotest_symtrack_cccf_config_invalid;
+autotest_function_t autotest_symtrack_cccf_config_valid;
+// src/math/tests/gcd_autotest.c
+autotest_function_t autotest_gcd_one;
+autotest_function_t autotest_gcd_edge_cases;
+autotest_function_t autotest_gcd_base;
+// src/math/tests/math_window_autotest.c
+autotest_function_t autotest_window_hamming;
+autotest_function_t autotest_window_hann;
+autotest_function_t autotest_window_blackmanharris;
+autotest_function_t autotest_window_blackmanharris7;
+autotest_function_t autotest_window_kaiser;
+autotest_function_t autotest_window_flattop;
+autotest_function_t autotest_window_triangular;
+autotest_function_t autotest_window_rcostaper;
+autotest_function_t autotest_window_kbd;
+autotest_function_t autotest_kbd_n16;
+autotest_function_t autotest_kbd_n32;
+autotest_function_t autotest_kbd_n48;
+autotest_function_t autotest_window_config;
+// src/math/tests/math_autotest.c
+autotest_function_t autotest_Q;
+autotest_function_t autotest_sincf;
+autotest_function_t autotest_nextpow2;
+autotest_function_t autotest_math_config;
+// src/math/tests/math_bessel_autotest.c
+autotest_function_t autotest_lnbesselif;
+autotest_function_t autotest_besselif;
+autotest_function_t autotest_besseli0f;
+autotest_function_t autotest_besseljf;
+autotest_function_t autotest_besselj0f;
+// src/math/tests/math_gamma_autotest.c
+autotest_function_t autotest_gamma;
+autotest_function_t autotest_lngamma;
+autotest_function_t autotest_uppergamma;
+autotest_function_t autotest_factorial;
+autotest_function_t autotest_nchoosek;
+// src/math/tests/math_complex_autotest.c
+autotest_function_t autotest_cexpf;
+autotest_function_t autotest_clogf;
+autotest_function_t autotest_csqrtf;
+autotest_function_t autotest_casinf;
+autotest_function_t autotest_cacosf;
+autotest_function_t autotest_catanf;
+// src/math/tests/math_fast_autotest.c
+autotest_function_t autotest_vmath_sincos_exact;
+autotest_function_t autotest_vmath_sincos_precise;
+autotest_function_t autotest_vmath_sincos_fast;
+autotest_function_t autotest_vmath_cexpj_exact;
+autotest_function_t autotest_vmath_cexpj_precise;
+autotest_function_t autotest_vmath_cexpj_fast;
+autotest_function_t autotest_vmath_atan2_exact;
+autotest_function_t autotest_vmath_atan2_precise;
+autotest_function_t autotest_vmath_atan2_fast;
+autotest_function_t autotest_vmath_exp_exact;
+autotest_function_t autotest_vmath_exp_precise;
+autotest_function_t autotest_vmath_exp_fast;
+autotest_function_t autotest_vmath_log_exact;
+autotest_function_t autotest_vmath_log_precise;
+autotest_function_t autotest_vmath_log_fast;
+autotest_function_t autotest_vmath_log10_exact;
+autotest_function_t autotest_vmath_log10_precise;
+autotest_function_t autotest_vmath_log10_fast;
+autotest_function_t autotest_vmath_special;
+autotest_function_t autotest_vmath_inplace;
+autotest_function_t autotest_vmath_config;
+// src/math/tests/polynomial_autotest.c
+autotest_function_t autotest_polyf_fit_q3n3;
+autotest_function_t autotest_polyf_lagrange_issue165;
+autotest_function_t autotest_polyf_lagrange;
+autotest_function_t autotest_polyf_expandroots_4;
+autotest_function_t autotest_polyf_expandroots_11;
+autotest_function_t autotest_polycf_expandroots_4;
+autotest_function_t autotest_polyf_expandroots2_3;
+autotest_function_t autotest_polyf_mul_2_3;
+autotest_function_t autotest_poly_expandbinomial_n6;
+autotest_function_t autotest_poly_binomial_expand_pm_m6_k1;
+autotest_function_t autotest_poly_expandbinomial_pm_m5_k2;
+// src/math/tests/polynomial_findroots_autotest.c
+autotest_function_t autotest_polyf_findroots_real;
+autotest_function_t autotest_polyf_findroots_complex;
+autotest_function_t autotest_polyf_findroots_mix;
+autotest_function_t autotest_polyf_findroots_mix2;
+// src/math/tests/prime_autotest.c
+autotest_function_t autotest_prime_small;
+autotest_function_t autotest_factors;
+autotest_function_t autotest_totient;
+// src/matrix/tests/matrixcf_autotest.c
+autotest_function_t autotest_matrixcf_add;
+autotest_function_t autotest_matrixcf_aug;
+autotest_function_t autotest_matrixcf_chol;
+autotest_function_t autotest_matrixcf_inv;
+autotest_function_t autotest_matrixcf_linsolve;
+autotest_function_t autotest_matrixcf_ludecomp_crout;
+autotest_function_t autotest_matrixcf_ludecomp_doolittle;
+autotest_function_t autotest_matrixcf_mul;
+autotest_function_t autotest_matrixcf_qrdecomp;
+autotest_function_t autotest_matrixcf_transmul;
+autotest_function_t autotest_matrixcf_mul_blocked;
+autotest_function_t autotest_matrixcf_transmul_blocked;
+autotest_function_t autotest_matrixcf_lusolve;
+autotest_function_t autotest_matrixcf_lufactor_singular;
+autotest_function_t autotest_matrixcf_cholsolve;
+// src/matrix/tests/matrixf_autotest.c
+autotest_function_t autotest_matrixf_add;
+autotest_function_t autotest_matrixf_aug;
+autotest_function_t autotest_matrixf_cgsolve;
+autotest_function_t autotest_matrixf_chol;
+autotest_function_t autotest_matrixf_gramschmidt;
+autotest_function_t autotest_matrixf_inv;
+autotest_function_t autotest_matrixf_linsolve;
+autotest_function_t autotest_matrixf_ludecomp_crout;
+autotest_function_t autotest_matrixf_ludecomp_doolittle;
+autotest_function_t autotest_matrixf_mul;
+autotest_function_t autotest_matrixf_qrdecomp;
+autotest_function_t autotest_matrixf_transmul;
+autotest_function_t autotest_matrixf_mul_blocked;
+autotest_function_t autotest_matrixf_lusolve;
+// src/matrix/tests/smatrixb_autotest.c
+autotest_function_t autotest_smatrixb_vmul;
+autotest_function_t autotest_smatrixb_mul;
+autotest_function_t autotest_smatrixb_mulf;
+autotest_function_t autotest_smatrixb_vmulf;
+// src/matrix/tests/smatrixf_autotest.c
+autotest_function_t autotest_smatrixf_vmul;
+autotest_function_t autotest_smatrixf_mul;
+// src/matrix/tests/smatrixi_autotest.c
+autotest_function_t autotest_smatrixi_vmul;
+autotest_function_t autotest_smatrixi_mul;
+// src/modem/tests/ampmodem_autotest.c
+autotest_function_t autotest_ampmodem_dsb_carrier_on;
+autotest_function_t autotest_ampmodem_usb_carrier_on;
+autotest_function_t autotest_ampmodem_lsb_carrier_on;
+autotest_function_t autotest_ampmodem_dsb_carrier_off;
+autotest_function_t autotest_ampmodem_usb_carrier_off;
+autotest_function_t autotest_ampmodem_lsb_carrier_off;
+autotest_function_t autotest_ampmodem_block_dsb_carrier_on;
+autotest_function_t autotest_ampmodem_block_usb_carrier_on;
+autotest_function_t autotest_ampmodem_block_lsb_carrier_on;
+autotest_function_t autotest_ampmodem_block_dsb_carrier_off;
+autotest_function_t autotest_ampmodem_block_usb_carrier_off;
+autotest_function_t autotest_ampmodem_block_lsb_carrier_off;
+// src/modem/tests/cpfskmodem_autotest.c
+autotest_function_t autotest_cpfskmodem_bps1_h0p5000_k4_m3_square;
+autotest_function_t autotest_cpfskmodem_bps1_h0p0250_k4_m3_square;
+autotest_function_t autotest_cpfskmodem_bps1_h0p1250_k4_m3_square;
+autotest_function_t autotest_cpfskmodem_bps1_h0p0625_k4_m3_square;
+autotest_function_t autotest_cpfskmodem_bps1_h0p5000_k4_m3_rcosfull;
+autotest_function_t autotest_cpfskmodem_bps1_h0p0250_k4_m3_rcosfull;
+autotest_function_t autotest_cpfskmodem_bps1_h0p1250_k4_m3_rcosfull;
+autotest_function_t autotest_cpfskmodem_bps1_h0p0625_k4_m3_rcosfull;
+autotest_function_t autotest_cpfskmodem_bps1_h0p5000_k4_m3_rcospart;
+autotest_function_t autotest_cpfskmodem_bps1_h0p0250_k4_m3_rcospart;
+autotest_function_t autotest_cpfskmodem_bps1_h0p1250_k4_m3_rcospart;
+autotest_function_t autotest_cpfskmodem_bps1_h0p0625_k4_m3_rcospart;
+autotest_function_t autotest_cpfskmodem_bps1_h0p5000_k4_m3_gmsk;
+autotest_function_t autotest_cpfskmodem_bps1_h0p0250_k4_m3_gmsk;
+autotest_function_t autotest_cpfskmodem_bps1_h0p1250_k4_m3_gmsk;
+autotest_function_t autotest_cpfskmodem_bps1_h0p0625_k4_m3_gmsk;
+autotest_function_t autotest_cpfskmodem_bps2_h0p0250_k4_m3_square;
+autotest_function_t autotest_cpfskmodem_bps3_h0p1250_k4_m3_square;
+autotest_function_t autotest_cpfskmodem_bps4_h0p0625_k4_m3_square;
+autotest_function_t autotest_cpfskmodem_bps1_h0p5_k2_m7_gmsk;
+autotest_function_t autotest_cpfskmodem_bps1_h0p5_k4_m7_gmsk;
+autotest_function_t autotest_cpfskmodem_bps1_h0p5_k6_m7_gmsk;
+autotest_function_t autotest_cpfskmodem_bps1_h0p5_k8_m7_gmsk;
+autotest_function_t autotest_cpfskmodem_coherent_bps1_h0p5_square;
+autotest_function_t autotest_cpfskmodem_coherent_bps1_h0p25_square;
+autotest_function_t autotest_cpfskmodem_coherent_bps1_h0p5_rcosfull;
+autotest_function_t autotest_cpfskmodem_coherent_bps1_h0p5_rcospart;
+autotest_function_t autotest_cpfskmodem_coherent_bps1_h0p5_gmsk;
+autotest_function_t autotest_cpfskmodem_coherent_bps1_h0p5_k8_m7_gmsk;
+autotest_function_t autotest_cpfskmodem_coherent_bps2_h0p25_square;
+autotest_function_t autotest_cpfskmodem_coherent_sensitivity;
+autotest_function_t autotest_cpfskdem_block_noncoherent;
+autotest_function_t autotest_cpfskdem_block_coherent;
+autotest_function_t autotest_cpfskmodem_spectrum;
+autotest_function_t autotest_cpfskmodem_config;
+// src/modem/tests/freqmodem_autotest.c
+autotest_function_t autotest_freqmodem_kf_0_02;
+autotest_function_t autotest_freqmodem_kf_0_04;
+autotest_function_t autotest_freqmodem_kf_0_08;
+autotest_function_t autotest_freqdem_block_exact;
+autotest_function_t autotest_freqdem_block_terms2;
+autotest_function_t autotest_freqdem_block_terms4;
+autotest_function_t autotest_freqdem_block_terms7;
+autotest_function_t autotest_freqdem_config;
+// src/modem/tests/fskmodem_autotest.c
+autotest_function_t autotest_fskmodem_norm_M2;
+autotest_function_t autotest_fskmodem_norm_M4;
+autotest_function_t autotest_fskmodem_norm_M8;
+autotest_function_t autotest_fskmodem_norm_M16;
+autotest_function_t autotest_fskmodem_norm_M32;
+autotest_function_t autotest_fskmodem_norm_M64;
+autotest_function_t autotest_fskmodem_norm_M128;
+autotest_function_t autotest_fskmodem_norm_M256;
+autotest_function_t autotest_fskmodem_norm_M512;
+autotest_function_t autotest_fskmodem_norm_M1024;
+autotest_function_t autotest_fskmodem_misc_M2;
+autotest_function_t autotest_fskmodem_misc_M4;
+autotest_function_t autotest_fskmodem_misc_M8;
+autotest_function_t autotest_fskmodem_misc_M16;
+autotest_function_t autotest_fskmodem_misc_M32;
+autotest_function_t autotest_fskmodem_misc_M64;
+autotest_function_t autotest_fskmodem_misc_M128;
+autotest_function_t autotest_fskmodem_misc_M256;
+autotest_function_t autotest_fskmodem_misc_M512;
+autotest_function_t autotest_fskmodem_misc_M1024;
+autotest_function_t autotest_fskmod_copy;
+autotest_function_t autotest_fskdem_copy;
+autotest_function_t autotest_fskdem_block_fft;
+autotest_function_t autotest_fskdem_block_pruned;
+autotest_function_t autotest_fskdem_pruned;
+// src/modem/tests/gmskmodem_autotest.c
+autotest_function_t autotest_gmskmodem_k4_m3_b025;
+autotest_function_t autotest_gmskmodem_k2_m3_b025;
+autotest_function_t autotest_gmskmodem_k3_m3_b025;
+autotest_function_t autotest_gmskmodem_k5_m3_b025;
+autotest_function_t autotest_gmskmodem_k8_m3_b033;
+autotest_function_t autotest_gmskmodem_k4_m1_b025;
+autotest_function_t autotest_gmskmodem_k4_m2_b025;
+autotest_function_t autotest_gmskmodem_k4_m8_b025;
+autotest_function_t autotest_gmskmodem_k4_m3_b020;
+autotest_function_t autotest_gmskmodem_k4_m3_b033;
+autotest_function_t autotest_gmskmodem_k4_m3_b050;
+autotest_function_t autotest_gmskmod_copy;
+autotest_function_t autotest_gmskdem_copy;
+autotest_function_t autotest_gmskdem_block;
+// src/modem/tests/modem_autotest.c
+autotest_function_t autotest_mod_demod_psk2;
+autotest_function_t autotest_mod_demod_psk4;
+autotest_function_t autotest_mod_demod_psk8;
+autotest_function_t autotest_mod_demod_psk16;
+autotest_function_t autotest_mod_demod_psk32;
+autotest_function_t autotest_mod_demod_psk64;
+autotest_function_t autotest_mod_demod_psk128;
+autotest_function_t autotest_mod_demod_psk256;
+autotest_function_t autotest_mod_demod_dpsk2;
+autotest_function_t autotest_mod_demod_dpsk4;
+autotest_function_t autotest_mod_demod_dpsk8;
+autotest_function_t autotest_mod_demod_dpsk16;
+autotest_function_t autotest_mod_demod_dpsk32;
+autotest_function_t autotest_mod_demod_dpsk64;
+autotest_function_t autotest_mod_demod_dpsk128;
+autotest_function_t autotest_mod_demod_dpsk256;
+autotest_function_t autotest_mod_demod_ask2;
+autotest_function_t autotest_mod_demod_ask4;
+autotest_function_t autotest_mod_demod_ask8;
+autotest_function_t autotest_mod_demod_ask16;
+autotest_function_t autotest_mod_demod_ask32;
+autotest_function_t autotest_mod_demod_ask64;
+autotest_function_t autotest_mod_demod_ask128;
+autotest_function_t autotest_mod_demod_ask256;
+autotest_function_t autotest_mod_demod_qam4;
+autotest_function_t autotest_mod_demod_qam8;
+autotest_function_t autotest_mod_demod_qam16;
+autotest_function_t autotest_mod_demod_qam32;
+autotest_function_t autotest_mod_demod_qam64;
+autotest_function_t autotest_mod_demod_qam128;
+autotest_function_t autotest_mod_demod_qam256;
+autotest_function_t autotest_mod_demod_apsk4;
+autotest_function_t autotest_mod_demod_apsk8;
+autotest_function_t autotest_mod_demod_apsk16;
+autotest_function_t autotest_mod_demod_apsk32;
+autotest_function_t autotest_mod_demod_apsk64;
+autotest_function_t autotest_mod_demod_apsk128;
+autotest_function_t autotest_mod_demod_apsk256;
+autotest_function_t autotest_mod_demod_bpsk;
+autotest_function_t autotest_mod_demod_qpsk;
+autotest_function_t autotest_mod_demod_ook;
+autotest_function_t autotest_mod_demod_sqam32;
+autotest_function_t autotest_mod_demod_sqam128;
+autotest_function_t autotest_mod_demod_V29;
+autotest_function_t autotest_mod_demod_arb16opt;
+autotest_function_t autotest_mod_demod_arb32opt;
+autotest_function_t autotest_mod_demod_arb64opt;
+autotest_function_t autotest_mod_demod_arb128opt;
+autotest_function_t autotest_mod_demod_arb256opt;
+autotest_function_t autotest_mod_demod_arb64vt;
+autotest_function_t autotest_mod_demod_pi4dqpsk;
+// src/modem/tests/modem_block_autotest.c
+autotest_function_t autotest_modem_block_psk8;
+autotest_function_t autotest_modem_block_psk64;
+autotest_function_t autotest_modem_block_dpsk4;
+autotest_function_t autotest_modem_block_ask4;
+autotest_function_t autotest_modem_block_ask16;
+autotest_function_t autotest_modem_block_qam4;
+autotest_function_t autotest_modem_block_qam16;
+autotest_function_t autotest_modem_block_qam32;
+autotest_function_t autotest_modem_block_qam256;
+autotest_function_t autotest_modem_block_apsk16;
+autotest_function_t autotest_modem_block_apsk64;
+autotest_function_t autotest_modem_block_bpsk;
+autotest_function_t autotest_modem_block_qpsk;
+autotest_function_t autotest_modem_block_ook;
+autotest_function_t autotest_modem_block_sqam32;
+autotest_function_t autotest_modem_block_arb16opt;
+autotest_function_t autotest_modem_block_pi4dqpsk;
+autotest_function_t autotest_modem_block_config;
+// src/modem/tests/modem_config_autotest.c
+autotest_function_t autotest_modem_copy_psk2;
+autotest_function_t autotest_modem_copy_psk4;
+autotest_function_t autotest_modem_copy_psk8;
+autotest_function_t autotest_modem_copy_psk16;
+autotest_function_t autotest_modem_copy_psk32;
+autotest_function_t autotest_modem_copy_psk64;
+autotest_function_t autotest_modem_copy_psk128;
+autotest_function_t autotest_modem_copy_psk256;
+autotest_function_t autotest_modem_copy_dpsk2;
+autotest_function_t autotest_modem_copy_dpsk4;
+autotest_function_t autotest_modem_copy_dpsk8;
+autotest_function_t autotest_modem_copy_dpsk16;
+autotest_function_t autotest_modem_copy_dpsk32;
+autotest_function_t autotest_modem_copy_dpsk64;
+autotest_function_t autotest_modem_copy_dpsk128;
+autotest_function_t autotest_modem_copy_dpsk256;
+autotest_function_t autotest_modem_copy_ask2;
+autotest_function_t autotest_modem_copy_ask4;
+autotest_function_t autotest_modem_copy_ask8;
+autotest_function_t autotest_modem_copy_ask16;
+autotest_function_t autotest_modem_copy_ask32;
+autotest_function_t autotest_modem_copy_ask64;
+autotest_function_t autotest_modem_copy_ask128;
+autotest_function_t autotest_modem_copy_ask256;
+autotest_function_t autotest_modem_copy_qam4;
+autotest_function_t autotest_modem_copy_qam8;
+autotest_function_t autotest_modem_copy_qam16;
+autotest_function_t autotest_modem_copy_qam32;
+autotest_function_t autotest_modem_copy_qam64;
+autotest_function_t autotest_modem_copy_qam128;
+autotest_function_t autotest_modem_copy_qam256;
+autotest_function_t autotest_modem_copy_apsk4;
+autotest_function_t autotest_modem_copy_apsk8;
+autotest_function_t autotest_modem_copy_apsk16;
+autotest_function_t autotest_modem_copy_apsk32;
+autotest_function_t autotest_modem_copy_apsk64;
+autotest_function_t autotest_modem_copy_apsk128;
+autotest_function_t autotest_modem_copy_apsk256;
+autotest_function_t autotest_modem_copy_bpsk;
+autotest_function_t autotest_modem_copy_qpsk;
+autotest_function_t autotest_modem_copy_ook;
+autotest_function_t autotest_modem_copy_sqam32;
+autotest_function_t autotest_modem_copy_sqam128;
+autotest_function_t autotest_modem_copy_V29;
+autotest_function_t autotest_modem_copy_arb16opt;
+autotest_function_t autotest_modem_copy_arb32opt;
+autotest_function_t autotest_modem_copy_arb64opt;
+autotest_function_t autotest_modem_copy_arb128opt;
+autotest_function_t autotest_modem_copy_arb256opt;
+autotest_function_t autotest_modem_copy_arb64vt;
+autotest_function_t autotest_modem_copy_pi4dqpsk;
+autotest_function_t autotest_modem_config;
+// src/modem/tests/modem_demodsoft_autotest.c
+autotest_function_t autotest_demodsoft_psk2;
+autotest_function_t autotest_demodsoft_psk4;
+autotest_function_t autotest_demodsoft_psk8;
+autotest_function_t autotest_demodsoft_psk16;
+autotest_function_t autotest_demodsoft_psk32;
+autotest_function_t autotest_demodsoft_psk64;
+autotest_function_t autotest_demodsoft_psk128;
+autotest_function_t autotest_demodsoft_psk256;
+autotest_function_t autotest_demodsoft_dpsk2;
+autotest_function_t autotest_demodsoft_dpsk4;
+autotest_function_t autotest_demodsoft_dpsk8;
+autotest_function_t autotest_demodsoft_dpsk16;
+autotest_function_t autotest_demodsoft_dpsk32;
+autotest_function_t autotest_demodsoft_dpsk64;
+autotest_function_t autotest_demodsoft_dpsk128;
+autotest_function_t autotest_demodsoft_dpsk256;
+autotest_function_t autotest_demodsoft_ask2;
+autotest_function_t autotest_demodsoft_ask4;
+autotest_function_t autotest_demodsoft_ask8;
+autotest_function_t autotest_demodsoft_ask16;
+autotest_function_t autotest_demodsoft_ask32;
+autotest_function_t autotest_demodsoft_ask64;
+autotest_function_t autotest_demodsoft_ask128;
+autotest_function_t autotest_demodsoft_ask256;
+autotest_function_t autotest_demodsoft_qam4;
+autotest_function_t autotest_demodsoft_qam8;
+autotest_function_t autotest_demodsoft_qam16;
+autotest_function_t autotest_demodsoft_qam32;
+autotest_function_t autotest_demodsoft_qam64;
+autotest_function_t autotest_demodsoft_qam128;
+autotest_function_t autotest_demodsoft_qam256;
+autotest_function_t autotest_demodsoft_apsk4;
+autotest_function_t autotest_demodsoft_apsk8;
+autotest_function_t autotest_demodsoft_apsk16;
+autotest_function_t autotest_demodsoft_apsk32;
+autotest_function_t autotest_demodsoft_apsk64;
+autotest_function_t autotest_demodsoft_apsk128;
+autotest_function_t autotest_demodsoft_apsk256;
+autotest_function_t autotest_demodsoft_bpsk;
+autotest_function_t autotest_demodsoft_qpsk;
+autotest_function_t autotest_demodsoft_ook;
+autotest_function_t autotest_demodsoft_sqam32;
+autotest_function_t autotest_demodsoft_sqam128;
+autotest_function_t autotest_demodsoft_V29;
+autotest_function_t autotest_demodsoft_arb16opt;
+autotest_function_t autotest_demodsoft_arb32opt;
+autotest_function_t autotest_demodsoft_arb64opt;
+autotest_function_t autotest_demodsoft_arb128opt;
+autotest_function_t autotest_demodsoft_arb256opt;
+autotest_function_t autotest_demodsoft_arb64vt;
+autotest_function_t autotest_demodsoft_pi4dqpsk;
+// src/modem/tests/modem_demodstats_autotest.c
+autotest_function_t autotest_demodstats_psk2;
+autotest_function_t autotest_demodstats_psk4;
+autotest_function_t autotest_demodstats_psk8;
+autotest_function_t autotest_demodstats_psk16;
+autotest_function_t autotest_demodstats_psk32;
+autotest_function_t autotest_demodstats_psk64;
+autotest_function_t autotest_demodstats_psk128;
+autotest_function_t autotest_demodstats_psk256;
+autotest_function_t autotest_demodstats_dpsk2;
+autotest_function_t autotest_demodstats_dpsk4;
+autotest_function_t autotest_demodstats_dpsk8;
+autotest_function_t autotest_demodstats_dpsk16;
+autotest_function_t autotest_demodstats_dpsk32;
+autotest_function_t autotest_demodstats_dpsk64;
+autotest_function_t autotest_demodstats_dpsk128;
+autotest_function_t autotest_demodstats_dpsk256;
+autotest_function_t autotest_demodstats_ask2;
+autotest_function_t autotest_demodstats_ask4;
+autotest_function_t autotest_demodstats_ask8;
+autotest_function_t autotest_demodstats_ask16;
+autotest_function_t autotest_demodstats_ask32;
+autotest_function_t autotest_demodstats_ask64;
+autotest_function_t autotest_demodstats_ask128;
+autotest_function_t autotest_demodstats_ask256;
+autotest_function_t autotest_demodstats_qam4;
+autotest_function_t autotest_demodstats_qam8;
+autotest_function_t autotest_demodstats_qam16;
+autotest_function_t autotest_demodstats_qam32;
+autotest_function_t autotest_demodstats_qam64;
+autotest_function_t autotest_demodstats_qam128;
+autotest_function_t autotest_demodstats_qam256;
+autotest_function_t autotest_demodstats_apsk4;
+autotest_function_t autotest_demodstats_apsk8;
+autotest_function_t autotest_demodstats_apsk16;
+autotest_function_t autotest_demodstats_apsk32;
+autotest_function_t autotest_demodstats_apsk64;
+autotest_function_t autotest_demodstats_apsk128;
+autotest_function_t autotest_demodstats_apsk256;
+autotest_function_t autotest_demodstats_bpsk;
+autotest_function_t autotest_demodstats_qpsk;
+autotest_function_t autotest_demodstats_ook;
+autotest_function_t autotest_demodstats_sqam32;
+autotest_function_t autotest_demodstats_sqam128;
+autotest_function_t autotest_demodstats_V29;
+autotest_function_t autotest_demodstats_arb16opt;
+autotest_function_t autotest_demodstats_arb32opt;
+autotest_function_t autotest_demodstats_arb64opt;
+autotest_function_t autotest_demodstats_arb128opt;
+autotest_function_t autotest_demodstats_arb256opt;
+autotest_function_t autotest_demodstats_arb64vt;
+// src/modem/tests/modem_utilities_autotest.c
+autotest_function_t autotest_modemcf_print_schemes;
+autotest_function_t autotest_modemcf_str2mod;
+autotest_function_t autotest_modemcf_types;
+// src/multichannel/tests/firpfbch_crcf_synthesizer_autotest.c
+autotest_function_t autotest_firpfbch_crcf_synthesis;
+// src/multichannel/tests/firpfbch_crcf_analyzer_autotest.c
+autotest_function_t autotest_firpfbch_crcf_analysis;
+// src/multichannel/tests/firpfbch_crcf_autotest.c
+autotest_function_t autotest_firpfbch_crcf_config;
+// src/multichannel/tests/firpfbch2_crcf_autotest.c
+autotest_function_t autotest_firpfbch2_crcf_n8;
+autotest_function_t autotest_firpfbch2_crcf_n16;
+autotest_function_t autotest_firpfbch2_crcf_n32;
+autotest_function_t autotest_firpfbch2_crcf_n64;
+autotest_function_t autotest_firpfbch2_crcf_copy;
+autotest_function_t autotest_firpfbch2_crcf_config;
+// src/multichannel/tests/firpfbchr_crcf_autotest.c
+autotest_function_t autotest_firpfbchr_crcf;
+autotest_function_t autotest_firpfbchr_crcf_config;
+// src/multichannel/tests/ofdmframe_autotest.c
+autotest_function_t autotest_ofdmframesync_acquire_n64;
+autotest_function_t autotest_ofdmframesync_acquire_n128;
+autotest_function_t autotest_ofdmframesync_acquire_n256;
+autotest_function_t autotest_ofdmframesync_acquire_n512;
+autotest_function_t autotest_ofdmframesync_block_n64;
+autotest_function_t autotest_ofdmframesync_block_n128;
+autotest_function_t autotest_ofdmframesync_block_n512;
+autotest_function_t autotest_ofdmframe_common_config;
+autotest_function_t autotest_ofdmframegen_config;
+autotest_function_t autotest_ofdmframesync_config;
+// src/nco/tests/nco_crcf_autotest.c
+autotest_function_t autotest_nco_crcf_constrain;
+autotest_function_t autotest_nco_crcf_copy;
+autotest_function_t autotest_nco_config;
+// src/nco/tests/nco_crcf_frequency_autotest.c
+autotest_function_t autotest_nco_crcf_frequency;
+// src/nco/tests/nco_crcf_mix_autotest.c
+autotest_function_t autotest_nco_crcf_mix_nco_0;
+autotest_function_t autotest_nco_crcf_mix_nco_1;
+autotest_function_t autotest_nco_crcf_mix_nco_2;
+autotest_function_t autotest_nco_crcf_mix_nco_3;
+autotest_function_t autotest_nco_crcf_mix_nco_4;
+autotest_function_t autotest_nco_crcf_mix_nco_5;
+autotest_function_t autotest_nco_crcf_mix_nco_6;
+autotest_function_t autotest_nco_crcf_mix_nco_7;
+autotest_function_t autotest_nco_crcf_mix_nco_8;
+autotest_function_t autotest_nco_crcf_mix_nco_9;
+autotest_function_t autotest_nco_crcf_mix_vco_0;
+autotest_function_t autotest_nco_crcf_mix_vco_1;
+autotest_function_t autotest_nco_crcf_mix_vco_2;
+autotest_function_t autotest_nco_crcf_mix_vco_3;
+autotest_function_t autotest_nco_crcf_mix_vco_4;
+autotest_function_t autotest_nco_crcf_mix_vco_5;
+autotest_function_t autotest_nco_crcf_mix_vco_6;
+autotest_function_t autotest_nco_crcf_mix_vco_7;
+autotest_function_t autotest_nco_crcf_mix_vco_8;
+autotest_function_t autotest_nco_crcf_mix_vco_9;
+// src/nco/tests/nco_crcf_phase_autotest.c
+autotest_function_t autotest_nco_crcf_phase;
+autotest_function_t autotest_nco_basic;
+autotest_function_t autotest_nco_mixing;
+autotest_function_t autotest_nco_block_mixing;
+// src/nco/tests/nco_crcf_pll_autotest.c
+autotest_function_t autotest_nco_crcf_pll_phase;
+autotest_function_t autotest_nco_crcf_pll_freq;
+// src/nco/tests/nco_crcf_spectrum_autotest.c
+autotest_function_t autotest_nco_crcf_spectrum_nco_f00;
+autotest_function_t autotest_nco_crcf_spectrum_nco_f01;
+autotest_function_t autotest_nco_crcf_spectrum_nco_f02;
+autotest_function_t autotest_nco_crcf_spectrum_nco_f03;
+autotest_function_t autotest_nco_crcf_spectrum_nco_f04;
+autotest_function_t autotest_nco_crcf_spectrum_vco_f00;
+autotest_function_t autotest_nco_crcf_spectrum_vco_f01;
+autotest_function_t autotest_nco_crcf_spectrum_vco_f02;
+autotest_function_t autotest_nco_crcf_spectrum_vco_f03;
+autotest_function_t autotest_nco_crcf_spectrum_vco_f04;
+// src/nco/tests/unwrap_phase_autotest.c
+autotest_function_t autotest_nco_unwrap_phase;
+// src/optim/tests/gasearch_autotest.c
+autotest_function_t autotest_gasearch_peak;
+autotest_function_t autotest_chromosome_config;
+autotest_function_t autotest_gasearch_config;
+autotest_function_t autotest_gasearch_workers;
+autotest_function_t autotest_gasearch_cache;
+autotest_function_t autotest_gasearch_workers_count;
+// src/optim/tests/gradsearch_autotest.c
+autotest_function_t autotest_gradsearch_rosenbrock;
+autotest_function_t autotest_gradsearch_maxutility;
+autotest_function_t autotest_gradsearch_workers;
+autotest_function_t autotest_gradsearch_gradient;
+// src/optim/tests/qnsearch_autotest.c
+autotest_function_t autotest_qnsearch_rosenbrock;
+autotest_function_t autotest_qnsearch_config;
+autotest_function_t autotest_qnsearch_workers;
+autotest_function_t autotest_qnsearch_gradient;
+// src/optim/tests/qs1dsearch_autotest.c
+autotest_function_t autotest_qs1dsearch_min_01;
+autotest_function_t autotest_qs1dsearch_min_02;
+autotest_function_t autotest_qs1dsearch_min_03;
+autotest_function_t autotest_qs1dsearch_min_05;
+autotest_function_t autotest_qs1dsearch_min_06;
+autotest_function_t autotest_qs1dsearch_min_07;
+autotest_function_t autotest_qs1dsearch_min_08;
+autotest_function_t autotest_qs1dsearch_min_10;
+autotest_function_t autotest_qs1dsearch_min_11;
+autotest_function_t autotest_qs1dsearch_min_12;
+autotest_function_t autotest_qs1dsearch_min_13;
+autotest_function_t autotest_qs1dsearch_max_01;
+autotest_function_t autotest_qs1dsearch_max_02;
+autotest_function_t autotest_qs1dsearch_max_03;
+autotest_function_t autotest_qs1dsearch_max_05;
+autotest_function_t autotest_qs1dsearch_max_06;
+autotest_function_t autotest_qs1dsearch_max_07;
+autotest_function_t autotest_qs1dsearch_max_08;
+autotest_function_t autotest_qs1dsearch_max_10;
+autotest_function_t autotest_qs1dsearch_max_11;
+autotest_function_t autotest_qs1dsearch_max_12;
+autotest_function_t autotest_qs1dsearch_max_13;
+autotest_function_t autotest_qs1dsearch_config;
+// src/optim/tests/utility_autotest.c
+autotest_function_t autotest_optim_rosenbrock;
+// src/quantization/tests/compand_autotest.c
+autotest_function_t autotest_compand_float;
+autotest_function_t autotest_compand_cfloat;
+// src/quantization/tests/quantize_autotest.c
+autotest_function_t autotest_quantize_float_n8;
+// src/random/tests/scramble_autotest.c
+autotest_function_t autotest_scramble_n16;
+autotest_function_t autotest_scramble_n64;
+autotest_function_t autotest_scramble_n256;
+autotest_function_t autotest_scramble_n11;
+autotest_function_t autotest_scramble_n33;
+autotest_function_t autotest_scramble_n277;
+autotest_function_t autotest_scramble_soft_n16;
+autotest_function_t autotest_scramble_soft_n64;
+autotest_function_t autotest_scramble_soft_n256;
+autotest_function_t autotest_scramble_soft_n11;
+autotest_function_t autotest_scramble_soft_n33;
+autotest_function_t autotest_scramble_soft_n277;
+// src/random/tests/random_autotest.c
+autotest_function_t autotest_randf;
+autotest_function_t autotest_randnf;
+autotest_function_t autotest_crandnf;
+autotest_function_t autotest_randweibf;
+autotest_function_t autotest_randricekf;
+autotest_function_t autotest_randexpf;
+autotest_function_t autotest_random_config;
+// src/random/tests/random_distributions_autotest.c
+autotest_function_t autotest_distribution_randnf;
+// src/sequence/tests/bsequence_autotest.c
+autotest_function_t autotest_bsequence_init;
+autotest_function_t autotest_bsequence_correlate;
+autotest_function_t autotest_bsequence_add;
+autotest_function_t autotest_bsequence_mul;
+autotest_function_t autotest_bsequence_accumulate;
+// src/sequence/tests/complementary_codes_autotest.c
+autotest_function_t autotest_complementary_code_n8;
+autotest_function_t autotest_complementary_code_n16;
+autotest_function_t autotest_complementary_code_n32;
+autotest_function_t autotest_complementary_code_n64;
+autotest_function_t autotest_complementary_code_n128;
+autotest_function_t autotest_complementary_code_n256;
+autotest_function_t autotest_complementary_code_n512;
+// src/sequence/tests/msequence_autotest.c
+autotest_function_t autotest_bsequence_init_msequence;
+autotest_function_t autotest_msequence_xcorr_m2;
+autotest_function_t autotest_msequence_xcorr_m3;
+autotest_function_t autotest_msequence_xcorr_m4;
+autotest_function_t autotest_msequence_xcorr_m5;
+autotest_function_t autotest_msequence_xcorr_m6;
+autotest_function_t autotest_msequence_xcorr_m7;
+autotest_function_t autotest_msequence_xcorr_m8;
+autotest_function_t autotest_msequence_xcorr_m9;
+autotest_function_t autotest_msequence_xcorr_m10;
+autotest_function_t autotest_msequence_xcorr_m11;
+autotest_function_t autotest_msequence_xcorr_m12;
+autotest_function_t autotest_msequence_period_m2;
+autotest_function_t autotest_msequence_period_m3;
+autotest_function_t autotest_msequence_period_m4;
+autotest_function_t autotest_msequence_period_m5;
+autotest_function_t autotest_msequence_period_m6;
+autotest_function_t autotest_msequence_period_m7;
+autotest_function_t autotest_msequence_period_m8;
+autotest_function_t autotest_msequence_period_m9;
+autotest_function_t autotest_msequence_period_m10;
+autotest_function_t autotest_msequence_period_m11;
+autotest_function_t autotest_msequence_period_m12;
+autotest_function_t autotest_msequence_period_m13;
+autotest_function_t autotest_msequence_period_m14;
+autotest_function_t autotest_msequence_period_m15;
+autotest_function_t autotest_msequence_period_m16;
+autotest_function_t autotest_msequence_period_m17;
+autotest_function_t autotest_msequence_period_m18;
+autotest_function_t autotest_msequence_period_m19;
+autotest_function_t autotest_msequence_period_m20;
+autotest_function_t autotest_msequence_period_m21;
+autotest_function_t autotest_msequence_period_m22;
+autotest_function_t autotest_msequence_period_m23;
+autotest_function_t autotest_msequence_period_m24;
+autotest_function_t autotest_msequence_period_m25;
+autotest_function_t autotest_msequence_period_m26;
+autotest_function_t autotest_msequence_period_m27;
+autotest_function_t autotest_msequence_period_m28;
+autotest_function_t autotest_msequence_period_m29;
+autotest_function_t autotest_msequence_period_m30;
+autotest_function_t autotest_msequence_period_m31;
+autotest_function_t autotest_msequence_config;
+// src/utility/tests/bshift_array_autotest.c
+autotest_function_t autotest_lbshift;
+autotest_function_t autotest_rbshift;
+autotest_function_t autotest_lbcircshift;
+autotest_function_t autotest_rbcircshift;
+// src/utility/tests/count_bits_autotest.c
+autotest_function_t autotest_count_ones;
+autotest_function_t autotest_count_ones_mod2;
+autotest_function_t autotest_bdotprod;
+autotest_function_t autotest_count_leading_zeros;
+autotest_function_t autotest_msb_index;
+// src/utility/tests/pack_bytes_autotest.c
+autotest_function_t autotest_pack_array;
+autotest_function_t autotest_unpack_array;
+autotest_function_t autotest_repack_array;
+autotest_function_t autotest_pack_bytes_01;
+autotest_function_t autotest_unpack_bytes_01;
+autotest_function_t autotest_repack_bytes_01;
+autotest_function_t autotest_repack_bytes_02;
+autotest_function_t autotest_repack_bytes_03;
+autotest_function_t autotest_repack_bytes_04_uneven;
+// src/utility/tests/profile_autotest.c
+autotest_function_t autotest_profile_firfilt;
+autotest_function_t autotest_profile_fftplan;
+autotest_function_t autotest_profile_callback;
+autotest_function_t autotest_profile_json;
+// src/utility/tests/shift_array_autotest.c
+autotest_function_t autotest_lshift;
+autotest_function_t autotest_rshift;
+autotest_function_t autotest_lcircshift;
+autotest_function_t autotest_rcircshift;
+
+// array of scripts
+autotest_t scripts[NUM_AUTOSCRIPTS] = {
+    {.id =    0, .api = &autotest_null,                                     .name = "null"},
+    {.id =    1, .api = &autotest_libliquid,                                .name = "libliquid"},
+    {.id =    2, .api = &autotest_agc_crcf_dc_gain_control,                 .name = "agc_crcf_dc_gain_control"},
+    {.id =    3, .api = &autotest_agc_crcf_scale,                           .name = "agc_crcf_scale"},
+    {.id =    4, .api = &autotest_agc_crcf_ac_gain_control,                 .name = "agc_crcf_ac_gain_control"},
+    {.id =    5, .api = &autotest_agc_crcf_rssi_sinusoid,                   .name = "agc_crcf_rssi_sinusoid"},
+    {.id =    6, .api = &autotest_agc_crcf_rssi_noise,                      .name = "agc_crcf_rssi_noise"},
+    {.id =    7, .api = &autotest_agc_crcf_squelch,                         .name = "agc_crcf_squelch"},
+    {.id =    8, .api = &autotest_agc_crcf_lock,                            .name = "agc_crcf_lock"},
+    {.id =    9, .api = &autotest_agc_crcf_invalid_config,                  .name = "agc_crcf_invalid_config"},
+    {.id =   10, .api = &autotest_agc_crcf_copy,                            .name = "agc_crcf_copy"},
+    {.id =   11, .api = &autotest_cvsd_rmse_sine,                           .name = "cvsd_rmse_sine"},
+    {.id =   12, .api = &autotest_cvsd_rmse_sine8,                          .name = "cvsd_rmse_sine8"},
+    {.id =   13, .api = &autotest_cvsd_invalid_config,                      .name = "cvsd_invalid_config"},
+    {.id =   14, .api = &autotest_cbufferf,                                 .name = "cbufferf"},
+    {.id =   15, .api = &autotest_cbuffercf,                                .name = "cbuffercf"},
+    {.id =   16, .api = &autotest_cbufferf_flow,                            .name = "cbufferf_flow"},
+    {.id =   17, .api = &autotest_cbufferf_config,                          .name = "cbufferf_config"},
+    {.id =   18, .api = &autotest_cbuffer_copy,                             .name = "cbuffer_copy"},
+    {.id =   19, .api = &autotest_wdelayf,                                  .name = "wdelayf"},
+    {.id =   20, .api = &autotest_wdelay_copy,                              .name = "wdelay_copy"},
+    {.id =   21, .api = &autotest_window_config_errors,                     .name = "window_config_errors"},
+    {.id =   22, .api = &autotest_windowf,                                  .name = "windowf"},
+    {.id =   23, .api = &autotest_window_copy,                              .name = "window_copy"},
+    {.id =   24, .api = &autotest_dotprod_rrrf_basic,                       .name = "dotprod_rrrf_basic"},
+    {.id =   25, .api = &autotest_dotprod_rrrf_uneven,                      .name = "dotprod_rrrf_uneven"},
+    {.id =   26, .api = &autotest_dotprod_rrrf_struct,                      .name = "dotprod_rrrf_struct"},
+    {.id =   27, .api = &autotest_dotprod_rrrf_struct_align,                .name = "dotprod_rrrf_struct_align"},
+    {.id =   28, .api = &autotest_dotprod_rrrf_rand01,                      .name = "dotprod_rrrf_rand01"},
+    {.id =   29, .api = &autotest_dotprod_rrrf_rand02,                      .name = "dotprod_rrrf_rand02"},
+    {.id =   30, .api = &autotest_dotprod_rrrf_struct_lengths,              .name = "dotprod_rrrf_struct_lengths"},
+    {.id =   31, .api = &autotest_dotprod_rrrf_struct_vs_ordinal,           .name = "dotprod_rrrf_struct_vs_ordinal"},
+    {.id =   32, .api = &autotest_dotprod_crcf_rand01,                      .name = "dotprod_crcf_rand01"},
+    {.id =   33, .api = &autotest_dotprod_crcf_rand02,                      .name = "dotprod_crcf_rand02"},
+    {.id =   34, .api = &autotest_dotprod_crcf_struct_vs_ordinal,           .name = "dotprod_crcf_struct_vs_ordinal"},
+    {.id =   35, .api = &autotest_dotprod_cccf_rand16,                      .name = "dotprod_cccf_rand16"},
+    {.id =   36, .api = &autotest_dotprod_cccf_struct_lengths,              .name = "dotprod_cccf_struct_lengths"},
+    {.id =   37, .api = &autotest_dotprod_cccf_struct_vs_ordinal,           .name = "dotprod_cccf_struct_vs_ordinal"},
+    {.id =   38, .api = &autotest_sumsqf_3,                                 .name = "sumsqf_3"},
+    {.id =   39, .api = &autotest_sumsqf_4,                                 .name = "sumsqf_4"},
+    {.id =   40, .api = &autotest_sumsqf_7,                                 .name = "sumsqf_7"},
+    {.id =   41, .api = &autotest_sumsqf_8,                                 .name = "sumsqf_8"},
+    {.id =   42, .api = &autotest_sumsqf_15,                                .name = "sumsqf_15"},
+    {.id =   43, .api = &autotest_sumsqf_16,                                .name = "sumsqf_16"},
+    {.id =   44, .api = &autotest_sumsqcf_3,                                .name = "sumsqcf_3"},
+    {.id =   45, .api = &autotest_sumsqcf_4,                                .name = "sumsqcf_4"},
+    {.id =   46, .api = &autotest_sumsqcf_7,                                .name = "sumsqcf_7"},
+    {.id =   47, .api = &autotest_sumsqcf_8,                                .name = "sumsqcf_8"},
+    {.id =   48, .api = &autotest_sumsqcf_15,                               .name = "sumsqcf_15"},
+    {.id =   49, .api = &autotest_sumsqcf_16,                               .name = "sumsqcf_16"},
+    {.id =   50, .api = &autotest_eqlms_00,                                 .name = "eqlms_00"},
+    {.id =   51, .api = &autotest_eqlms_01,                                 .name = "eqlms_01"},
+    {.id =   52, .api = &autotest_eqlms_02,                                 .name = "eqlms_02"},
+    {.id =   53, .api = &autotest_eqlms_03,                                 .name = "eqlms_03"},
+    {.id =   54, .api = &autotest_eqlms_04,                                 .name = "eqlms_04"},
+    {.id =   55, .api = &autotest_eqlms_05,                                 .name = "eqlms_05"},
+    {.id =   56, .api = &autotest_eqlms_06,                                 .name = "eqlms_06"},
+    {.id =   57, .api = &autotest_eqlms_07,                                 .name = "eqlms_07"},
+    {.id =   58, .api = &autotest_eqlms_08,                                 .name = "eqlms_08"},
+    {.id =   59, .api = &autotest_eqlms_09,                                 .name = "eqlms_09"},
+    {.id =   60, .api = &autotest_eqlms_10,                                 .name = "eqlms_10"},
+    {.id =   61, .api = &autotest_eqlms_11,                                 .name = "eqlms_11"},
+    {.id =   62, .api = &autotest_eqlms_config,                             .name = "eqlms_config"},
+    {.id =   63, .api = &autotest_eqlms_cccf_copy,                          .name = "eqlms_cccf_copy"},
+    {.id =   64, .api = &autotest_eqrls_cccf_sysid,                         .name = "eqrls_cccf_sysid"},
+    {.id =   65, .api = &autotest_eqrls_cccf_sysid_invqr,                   .name = "eqrls_cccf_sysid_invqr"},
+    {.id =   66, .api = &autotest_eqrls_cccf_sysid_ftf,                     .name = "eqrls_cccf_sysid_ftf"},
+    {.id =   67, .api = &autotest_eqrls_cccf_sysid_ftf_slow,                .name = "eqrls_cccf_sysid_ftf_slow"},
+    {.id =   68, .api = &autotest_eqrls_cccf_invqr,                         .name = "eqrls_cccf_invqr"},
+    {.id =   69, .api = &autotest_eqrls_cccf_ftf,                           .name = "eqrls_cccf_ftf"},
+    {.id =   70, .api = &autotest_eqrls_cccf_ftf_slow,                      .name = "eqrls_cccf_ftf_slow"},
+    {.id =   71, .api = &autotest_eqrls_rrrf_01,                            .name = "eqrls_rrrf_01"},
+    {.id =   72, .api = &autotest_eqrls_rrrf_copy,                          .name = "eqrls_rrrf_copy"},
+    {.id =   73, .api = &autotest_eqrls_rrrf_invqr,                         .name = "eqrls_rrrf_invqr"},
+    {.id =   74, .api = &autotest_eqrls_rrrf_ftf,                           .name = "eqrls_rrrf_ftf"},
+    {.id =   75, .api = &autotest_eqrls_rrrf_ftf_slow,                      .name = "eqrls_rrrf_ftf_slow"},
+    {.id =   76, .api = &autotest_eqrls_rrrf_config,                        .name = "eqrls_rrrf_config"},
+    {.id =   77, .api = &autotest_eqrls_rrrf_copy_ftf,                      .name = "eqrls_rrrf_copy_ftf"},
+    {.id =   78, .api = &autotest_reverse_byte,                             .name = "reverse_byte"},
+    {.id =   79, .api = &autotest_reverse_uint16,                           .name = "reverse_uint16"},
+    {.id =   80, .api = &autotest_reverse_uint32,                           .name = "reverse_uint32"},
+    {.id =   81, .api = &autotest_checksum,                                 .name = "checksum"},
+    {.id =   82, .api = &autotest_crc8,                                     .name = "crc8"},
+    {.id =   83, .api = &autotest_crc16,                                    .name = "crc16"},
+    {.id =   84, .api = &autotest_crc24,                                    .name = "crc24"},
+    {.id =   85, .api = &autotest_crc32,                                    .name = "crc32"},
+    {.id =   86, .api = &autotest_crc_config,                               .name = "crc_config"},
+    {.id =   87, .api = &autotest_fec_r3,                                   .name = "fec_r3"},
+    {.id =   88, .api = &autotest_fec_r5,                                   .name = "fec_r5"},
+    {.id =   89, .api = &autotest_fec_h74,                                  .name = "fec_h74"},
+    {.id =   90, .api = &autotest_fec_h84,                                  .name = "fec_h84"},
+    {.id =   91, .api = &autotest_fec_h128,                                 .name = "fec_h128"},
+    {.id =   92, .api = &autotest_fec_g2412,                                .name = "fec_g2412"},
+    {.id =   93, .api = &autotest_fec_secded2216,                           .name = "fec_secded2216"},
+    {.id =   94, .api = &autotest_fec_secded3932,                           .name = "fec_secded3932"},
+    {.id =   95, .api = &autotest_fec_secded7264,                           .name = "fec_secded7264"},
+    {.id =   96, .api = &autotest_fec_v27,                                  .name = "fec_v27"},
+    {.id =   97, .api = &autotest_fec_v29,                                  .name = "fec_v29"},
+    {.id =   98, .api = &autotest_fec_v39,                                  .name = "fec_v39"},
+    {.id =   99, .api = &autotest_fec_v615,                                 .name = "fec_v615"},
+    {.id =  100, .api = &autotest_fec_v27p23,                               .name = "fec_v27p23"},
+    {.id =  101, .api = &autotest_fec_v27p34,                               .name = "fec_v27p34"},
+    {.id =  102, .api = &autotest_fec_v27p45,                               .name = "fec_v27p45"},
+    {.id =  103, .api = &autotest_fec_v27p56,                               .name = "fec_v27p56"},
+    {.id =  104, .api = &autotest_fec_v27p67,                               .name = "fec_v27p67"},
+    {.id =  105, .api = &autotest_fec_v27p78,                               .name = "fec_v27p78"},
+    {.id =  106, .api = &autotest_fec_v29p23,                               .name = "fec_v29p23"},
+    {.id =  107, .api = &autotest_fec_v29p34,                               .name = "fec_v29p34"},
+    {.id =  108, .api = &autotest_fec_v29p45,                               .name = "fec_v29p45"},
+    {.id =  109, .api = &autotest_fec_v29p56,                               .name = "fec_v29p56"},
+    {.id =  110, .api = &autotest_fec_v29p67,                               .name = "fec_v29p67"},
+    {.id =  111, .api = &autotest_fec_v29p78,                               .name = "fec_v29p78"},
+    {.id =  112, .api = &autotest_fec_rs8,                                  .name = "fec_rs8"},
+    {.id =  113, .api = &autotest_fec_ldpc12,                               .name = "fec_ldpc12"},
+    {.id =  114, .api = &autotest_fec_ldpc23,                               .name = "fec_ldpc23"},
+    {.id =  115, .api = &autotest_fec_ldpc34,                               .name = "fec_ldpc34"},
+    {.id =  116, .api = &autotest_fec_config,                               .name = "fec_config"},
+    {.id =  117, .api = &autotest_fec_str2fec,                              .name = "fec_str2fec"},
+    {.id =  118, .api = &autotest_fec_is_convolutional,                     .name = "fec_is_convolutional"},
+    {.id =  119, .api = &autotest_fec_is_punctured,                         .name = "fec_is_punctured"},
+    {.id =  120, .api = &autotest_fec_is_reedsolomon,                       .name = "fec_is_reedsolomon"},
+    {.id =  121, .api = &autotest_fec_is_hamming,                           .name = "fec_is_hamming"},
+    {.id =  122, .api = &autotest_fec_copy_r3,                              .name = "fec_copy_r3"},
+    {.id =  123, .api = &autotest_fec_copy_r5,                              .name = "fec_copy_r5"},
+    {.id =  124, .api = &autotest_fec_copy_h74,                             .name = "fec_copy_h74"},
+    {.id =  125, .api = &autotest_fec_copy_h84,                             .name = "fec_copy_h84"},
+    {.id =  126, .api = &autotest_fec_copy_h128,                            .name = "fec_copy_h128"},
+    {.id =  127, .api = &autotest_fec_copy_g2412,                           .name = "fec_copy_g2412"},
+    {.id =  128, .api = &autotest_fec_copy_secded2216,                      .name = "fec_copy_secded2216"},
+    {.id =  129, .api = &autotest_fec_copy_secded3932,                      .name = "fec_copy_secded3932"},
+    {.id =  130, .api = &autotest_fec_copy_secded7264,                      .name = "fec_copy_secded7264"},
+    {.id =  131, .api = &autotest_fec_copy_v27,                             .name = "fec_copy_v27"},
+    {.id =  132, .api = &autotest_fec_copy_v29,                             .name = "fec_copy_v29"},
+    {.id =  133, .api = &autotest_fec_copy_v39,                             .name = "fec_copy_v39"},
+    {.id =  134, .api = &autotest_fec_copy_v615,                            .name = "fec_copy_v615"},
+    {.id =  135, .api = &autotest_fec_copy_v27p23,                          .name = "fec_copy_v27p23"},
+    {.id =  136, .api = &autotest_fec_copy_v27p34,                          .name = "fec_copy_v27p34"},
+    {.id =  137, .api = &autotest_fec_copy_v27p45,                          .name = "fec_copy_v27p45"},
+    {.id =  138, .api = &autotest_fec_copy_v27p56,                          .name = "fec_copy_v27p56"},
+    {.id =  139, .api = &autotest_fec_copy_v27p67,                          .name = "fec_copy_v27p67"},
+    {.id =  140, .api = &autotest_fec_copy_v27p78,                          .name = "fec_copy_v27p78"},
+    {.id =  141, .api = &autotest_fec_copy_v29p23,                          .name = "fec_copy_v29p23"},
+    {.id =  142, .api = &autotest_fec_copy_v29p34,                          .name = "fec_copy_v29p34"},
+    {.id =  143, .api = &autotest_fec_copy_v29p45,                          .name = "fec_copy_v29p45"},
+    {.id =  144, .api = &autotest_fec_copy_v29p56,                          .name = "fec_copy_v29p56"},
+    {.id =  145, .api = &autotest_fec_copy_v29p67,                          .name = "fec_copy_v29p67"},
+    {.id =  146, .api = &autotest_fec_copy_v29p78,                          .name = "fec_copy_v29p78"},
+    {.id =  147, .api = &autotest_fec_copy_rs8,                             .name = "fec_copy_rs8"},
+    {.id =  148, .api = &autotest_fec_copy_ldpc12,                          .name = "fec_copy_ldpc12"},
+    {.id =  149, .api = &autotest_fecsoft_r3,                               .name = "fecsoft_r3"},
+    {.id =  150, .api = &autotest_fecsoft_r5,                               .name = "fecsoft_r5"},
+    {.id =  151, .api = &autotest_fecsoft_h74,                              .name = "fecsoft_h74"},
+    {.id =  152, .api = &autotest_fecsoft_h84,                              .name = "fecsoft_h84"},
+    {.id =  153, .api = &autotest_fecsoft_h128,                             .name = "fecsoft_h128"},
+    {.id =  154, .api = &autotest_fecsoft_v27,                              .name = "fecsoft_v27"},
+    {.id =  155, .api = &autotest_fecsoft_v29,                              .name = "fecsoft_v29"},
+    {.id =  156, .api = &autotest_fecsoft_v39,                              .name = "fecsoft_v39"},
+    {.id =  157, .api = &autotest_fecsoft_v615,                             .name = "fecsoft_v615"},
+    {.id =  158, .api = &autotest_fecsoft_v27p23,                           .name = "fecsoft_v27p23"},
+    {.id =  159, .api = &autotest_fecsoft_v27p34,                           .name = "fecsoft_v27p34"},
+    {.id =  160, .api = &autotest_fecsoft_v27p45,                           .name = "fecsoft_v27p45"},
+    {.id =  161, .api = &autotest_fecsoft_v27p56,                           .name = "fecsoft_v27p56"},
+    {.id =  162, .api = &autotest_fecsoft_v27p67,                           .name = "fecsoft_v27p67"},
+    {.id =  163, .api = &autotest_fecsoft_v27p78,                           .name = "fecsoft_v27p78"},
+    {.id =  164, .api = &autotest_fecsoft_v29p23,                           .name = "fecsoft_v29p23"},
+    {.id =  165, .api = &autotest_fecsoft_v29p34,                           .name = "fecsoft_v29p34"},
+    {.id =  166, .api = &autotest_fecsoft_v29p45,                           .name = "fecsoft_v29p45"},
+    {.id =  167, .api = &autotest_fecsoft_v29p56,                           .name = "fecsoft_v29p56"},
+    {.id =  168, .api = &autotest_fecsoft_v29p67,                           .name = "fecsoft_v29p67"},
+    {.id =  169, .api = &autotest_fecsoft_v29p78,                           .name = "fecsoft_v29p78"},
+    {.id =  170, .api = &autotest_fecsoft_rs8,                              .name = "fecsoft_rs8"},
+    {.id =  171, .api = &autotest_fecsoft_ldpc12,                           .name = "fecsoft_ldpc12"},
+    {.id =  172, .api = &autotest_fecsoft_ldpc23,                           .name = "fecsoft_ldpc23"},
+    {.id =  173, .api = &autotest_fecsoft_ldpc34,                           .name = "fecsoft_ldpc34"},
+    {.id =  174, .api = &autotest_golay2412_codec,                          .name = "golay2412_codec"},
+    {.id =  175, .api = &autotest_hamming74_codec,                          .name = "hamming74_codec"},
+    {.id =  176, .api = &autotest_hamming74_codec_soft,                     .name = "hamming74_codec_soft"},
+    {.id =  177, .api = &autotest_hamming84_codec,                          .name = "hamming84_codec"},
+    {.id =  178, .api = &autotest_hamming84_codec_soft,                     .name = "hamming84_codec_soft"},
+    {.id =  179, .api = &autotest_hamming128_codec,                         .name = "hamming128_codec"},
+    {.id =  180, .api = &autotest_hamming128_codec_soft,                    .name = "hamming128_codec_soft"},
+    {.id =  181, .api = &autotest_hamming1511_codec,                        .name = "hamming1511_codec"},
+    {.id =  182, .api = &autotest_hamming3126_codec,                        .name = "hamming3126_codec"},
+    {.id =  183, .api = &autotest_fec_ldpc12_hard_n1,                       .name = "fec_ldpc12_hard_n1"},
+    {.id =  184, .api = &autotest_fec_ldpc12_hard_n37,                      .name = "fec_ldpc12_hard_n37"},
+    {.id =  185, .api = &autotest_fec_ldpc12_hard_n144,                     .name = "fec_ldpc12_hard_n144"},
+    {.id =  186, .api = &autotest_fec_ldpc12_hard_n1000,                    .name = "fec_ldpc12_hard_n1000"},
+    {.id =  187, .api = &autotest_fec_ldpc23_hard_n192,                     .name = "fec_ldpc23_hard_n192"},
+    {.id =  188, .api = &autotest_fec_ldpc23_hard_n500,                     .name = "fec_ldpc23_hard_n500"},
+    {.id =  189, .api = &autotest_fec_ldpc34_hard_n216,                     .name = "fec_ldpc34_hard_n216"},
+    {.id =  190, .api = &autotest_fec_ldpc34_hard_n777,                     .name = "fec_ldpc34_hard_n777"},
+    {.id =  191, .api = &autotest_fec_ldpc12_soft_n144,                     .name = "fec_ldpc12_soft_n144"},
+    {.id =  192, .api = &autotest_fec_ldpc23_soft_n192,                     .name = "fec_ldpc23_soft_n192"},
+    {.id =  193, .api = &autotest_fec_ldpc34_soft_n216,                     .name = "fec_ldpc34_soft_n216"},
+    {.id =  194, .api = &autotest_fec_ldpc_length,                          .name = "fec_ldpc_length"},
+    {.id =  195, .api = &autotest_fec_ldpc12_girth,                         .name = "fec_ldpc12_girth"},
+    {.id =  196, .api = &autotest_fec_ldpc23_girth,                         .name = "fec_ldpc23_girth"},
+    {.id =  197, .api = &autotest_fec_ldpc34_girth,                         .name = "fec_ldpc34_girth"},
+    {.id =  198, .api = &autotest_reedsolomon_223_255,                      .name = "reedsolomon_223_255"},
+    {.id =  199, .api = &autotest_reedsolomon_lengths,                      .name = "reedsolomon_lengths"},
+    {.id =  200, .api = &autotest_rep3_codec,                               .name = "rep3_codec"},
+    {.id =  201, .api = &autotest_rep5_codec,                               .name = "rep5_codec"},
+    {.id =  202, .api = &autotest_secded2216_codec_e0,                      .name = "secded2216_codec_e0"},
+    {.id =  203, .api = &autotest_secded2216_codec_e1,                      .name = "secded2216_codec_e1"},
+    {.id =  204, .api = &autotest_secded2216_codec_e2,                      .name = "secded2216_codec_e2"},
+    {.id =  205, .api = &autotest_secded3932_codec_e0,                      .name = "secded3932_codec_e0"},
+    {.id =  206, .api = &autotest_secded3932_codec_e1,                      .name = "secded3932_codec_e1"},
+    {.id =  207, .api = &autotest_secded3932_codec_e2,                      .name = "secded3932_codec_e2"},
+    {.id =  208, .api = &autotest_secded7264_codec_e0,                      .name = "secded7264_codec_e0"},
+    {.id =  209, .api = &autotest_secded7264_codec_e1,                      .name = "secded7264_codec_e1"},
+    {.id =  210, .api = &autotest_secded7264_codec_e2,                      .name = "secded7264_codec_e2"},
+    {.id =  211, .api = &autotest_interleaver_hard_8,                       .name = "interleaver_hard_8"},
+    {.id =  212, .api = &autotest_interleaver_hard_16,                      .name = "interleaver_hard_16"},
+    {.id =  213, .api = &autotest_interleaver_hard_64,                      .name = "interleaver_hard_64"},
+    {.id =  214, .api = &autotest_interleaver_hard_256,                     .name = "interleaver_hard_256"},
+    {.id =  215, .api = &autotest_interleaver_soft_8,                       .name = "interleaver_soft_8"},
+    {.id =  216, .api = &autotest_interleaver_soft_16,                      .name = "interleaver_soft_16"},
+    {.id =  217, .api = &autotest_interleaver_soft_64,                      .name = "interleaver_soft_64"},
+    {.id =  218, .api = &autotest_interleaver_soft_256,                     .name = "interleaver_soft_256"},
+    {.id =  219, .api = &autotest_interleaver_depth,                        .name = "interleaver_depth"},
+    {.id =  220, .api = &autotest_packetizer_copy,                          .name = "packetizer_copy"},
+    {.id =  221, .api = &autotest_packetizer_n16_0_0,                       .name = "packetizer_n16_0_0"},
+    {.id =  222, .api = &autotest_packetizer_n16_0_1,                       .name = "packetizer_n16_0_1"},
+    {.id =  223, .api = &autotest_packetizer_n16_0_2,                       .name = "packetizer_n16_0_2"},
+    {.id =  224, .api = &autotest_packetizer_batch_0_0,                     .name = "packetizer_batch_0_0"},
+    {.id =  225, .api = &autotest_packetizer_batch_0_1,                     .name = "packetizer_batch_0_1"},
+    {.id =  226, .api = &autotest_packetizer_batch_1_0,                     .name = "packetizer_batch_1_0"},
+    {.id =  227, .api = &autotest_packetizer_batch_1_1,                     .name = "packetizer_batch_1_1"},
+    {.id =  228, .api = &autotest_asgramcf_copy,                            .name = "asgramcf_copy"},
+    {.id =  229, .api = &autotest_fft_3,                                    .name = "fft_3"},
+    {.id =  230, .api = &autotest_fft_5,                                    .name = "fft_5"},
+    {.id =  231, .api = &autotest_fft_6,                                    .name = "fft_6"},
+    {.id =  232, .api = &autotest_fft_7,                                    .name = "fft_7"},
+    {.id =  233, .api = &autotest_fft_9,                                    .name = "fft_9"},
+    {.id =  234, .api = &autotest_fft_2,                                    .name = "fft_2"},
+    {.id =  235, .api = &autotest_fft_4,                                    .name = "fft_4"},
+    {.id =  236, .api = &autotest_fft_8,                                    .name = "fft_8"},
+    {.id =  237, .api = &autotest_fft_16,                                   .name = "fft_16"},
+    {.id =  238, .api = &autotest_fft_32,                                   .name = "fft_32"},
+    {.id =  239, .api = &autotest_fft_64,                                   .name = "fft_64"},
+    {.id =  240, .api = &autotest_fft_10,                                   .name = "fft_10"},
+    {.id =  241, .api = &autotest_fft_21,                                   .name = "fft_21"},
+    {.id =  242, .api = &autotest_fft_22,                                   .name = "fft_22"},
+    {.id =  243, .api = &autotest_fft_24,                                   .name = "fft_24"},
+    {.id =  244, .api = &autotest_fft_26,                                   .name = "fft_26"},
+    {.id =  245, .api = &autotest_fft_30,                                   .name = "fft_30"},
+    {.id =  246, .api = &autotest_fft_35,                                   .name = "fft_35"},
+    {.id =  247, .api = &autotest_fft_36,                                   .name = "fft_36"},
+    {.id =  248, .api = &autotest_fft_48,                                   .name = "fft_48"},
+    {.id =  249, .api = &autotest_fft_63,                                   .name = "fft_63"},
+    {.id =  250, .api = &autotest_fft_92,                                   .name = "fft_92"},
+    {.id =  251, .api = &autotest_fft_96,                                   .name = "fft_96"},
+    {.id =  252, .api = &autotest_fft_120,                                  .name = "fft_120"},
+    {.id =  253, .api = &autotest_fft_130,                                  .name = "fft_130"},
+    {.id =  254, .api = &autotest_fft_192,                                  .name = "fft_192"},
+    {.id =  255, .api = &autotest_fft_17,                                   .name = "fft_17"},
+    {.id =  256, .api = &autotest_fft_43,                                   .name = "fft_43"},
+    {.id =  257, .api = &autotest_fft_79,                                   .name = "fft_79"},
+    {.id =  258, .api = &autotest_fft_157,                                  .name = "fft_157"},
+    {.id =  259, .api = &autotest_fft_317,                                  .name = "fft_317"},
+    {.id =  260, .api = &autotest_fft_509,                                  .name = "fft_509"},
+    {.id =  261, .api = &autotest_fft_r2r_REDFT00_n8,                       .name = "fft_r2r_REDFT00_n8"},
+    {.id =  262, .api = &autotest_fft_r2r_REDFT10_n8,                       .name = "fft_r2r_REDFT10_n8"},
+    {.id =  263, .api = &autotest_fft_r2r_REDFT01_n8,                       .name = "fft_r2r_REDFT01_n8"},
+    {.id =  264, .api = &autotest_fft_r2r_REDFT11_n8,                       .name = "fft_r2r_REDFT11_n8"},
+    {.id =  265, .api = &autotest_fft_r2r_RODFT00_n8,                       .name = "fft_r2r_RODFT00_n8"},
+    {.id =  266, .api = &autotest_fft_r2r_RODFT10_n8,                       .name = "fft_r2r_RODFT10_n8"},
+    {.id =  267, .api = &autotest_fft_r2r_RODFT01_n8,                       .name = "fft_r2r_RODFT01_n8"},
+    {.id =  268, .api = &autotest_fft_r2r_RODFT11_n8,                       .name = "fft_r2r_RODFT11_n8"},
+    {.id =  269, .api = &autotest_fft_r2r_REDFT00_n32,                      .name = "fft_r2r_REDFT00_n32"},
+    {.id =  270, .api = &autotest_fft_r2r_REDFT10_n32,                      .name = "fft_r2r_REDFT10_n32"},
+    {.id =  271, .api = &autotest_fft_r2r_REDFT01_n32,                      .name = "fft_r2r_REDFT01_n32"},
+    {.id =  272, .api = &autotest_fft_r2r_REDFT11_n32,                      .name = "fft_r2r_REDFT11_n32"},
+    {.id =  273, .api = &autotest_fft_r2r_RODFT00_n32,                      .name = "fft_r2r_RODFT00_n32"},
+    {.id =  274, .api = &autotest_fft_r2r_RODFT10_n32,                      .name = "fft_r2r_RODFT10_n32"},
+    {.id =  275, .api = &autotest_fft_r2r_RODFT01_n32,                      .name = "fft_r2r_RODFT01_n32"},
+    {.id =  276, .api = &autotest_fft_r2r_RODFT11_n32,                      .name = "fft_r2r_RODFT11_n32"},
+    {.id =  277, .api = &autotest_fft_r2r_REDFT00_n27,                      .name = "fft_r2r_REDFT00_n27"},
+    {.id =  278, .api = &autotest_fft_r2r_REDFT10_n27,                      .name = "fft_r2r_REDFT10_n27"},
+    {.id =  279, .api = &autotest_fft_r2r_REDFT01_n27,                      .name = "fft_r2r_REDFT01_n27"},
+    {.id =  280, .api = &autotest_fft_r2r_REDFT11_n27,                      .name = "fft_r2r_REDFT11_n27"},
+    {.id =  281, .api = &autotest_fft_r2r_RODFT00_n27,                      .name = "fft_r2r_RODFT00_n27"},
+    {.id =  282, .api = &autotest_fft_r2r_RODFT10_n27,                      .name = "fft_r2r_RODFT10_n27"},
+    {.id =  283, .api = &autotest_fft_r2r_RODFT01_n27,                      .name = "fft_r2r_RODFT01_n27"},
+    {.id =  284, .api = &autotest_fft_r2r_RODFT11_n27,                      .name = "fft_r2r_RODFT11_n27"},
+    {.id =  285, .api = &autotest_fft_shift_4,                              .name = "fft_shift_4"},
+    {.id =  286, .api = &autotest_fft_shift_8,                              .name = "fft_shift_8"},
+    {.id =  287, .api = &autotest_spgramcf_noise_440,                       .name = "spgramcf_noise_440"},
+    {.id =  288, .api = &autotest_spgramcf_noise_1024,                      .name = "spgramcf_noise_1024"},
+    {.id =  289, .api = &autotest_spgramcf_noise_1200,                      .name = "spgramcf_noise_1200"},
+    {.id =  290, .api = &autotest_spgramcf_noise_custom_0,                  .name = "spgramcf_noise_custom_0"},
+    {.id =  291, .api = &autotest_spgramcf_noise_custom_1,                  .name = "spgramcf_noise_custom_1"},
+    {.id =  292, .api = &autotest_spgramcf_noise_custom_2,                  .name = "spgramcf_noise_custom_2"},
+    {.id =  293, .api = &autotest_spgramcf_noise_custom_3,                  .name = "spgramcf_noise_custom_3"},
+    {.id =  294, .api = &autotest_spgramcf_noise_hamming,                   .name = "spgramcf_noise_hamming"},
+    {.id =  295, .api = &autotest_spgramcf_noise_hann,                      .name = "spgramcf_noise_hann"},
+    {.id =  296, .api = &autotest_spgramcf_noise_blackmanharris,            .name = "spgramcf_noise_blackmanharris"},
+    {.id =  297, .api = &autotest_spgramcf_noise_blackmanharris7,           .name = "spgramcf_noise_blackmanharris7"},
+    {.id =  298, .api = &autotest_spgramcf_noise_kaiser,                    .name = "spgramcf_noise_kaiser"},
+    {.id =  299, .api = &autotest_spgramcf_noise_flattop,                   .name = "spgramcf_noise_flattop"},
+    {.id =  300, .api = &autotest_spgramcf_noise_triangular,                .name = "spgramcf_noise_triangular"},
+    {.id =  301, .api = &autotest_spgramcf_noise_rcostaper,                 .name = "spgramcf_noise_rcostaper"},
+    {.id =  302, .api = &autotest_spgramcf_noise_kbd,                       .name = "spgramcf_noise_kbd"},
+    {.id =  303, .api = &autotest_spgramcf_signal_00,                       .name = "spgramcf_signal_00"},
+    {.id =  304, .api = &autotest_spgramcf_signal_01,                       .name = "spgramcf_signal_01"},
+    {.id =  305, .api = &autotest_spgramcf_signal_02,                       .name = "spgramcf_signal_02"},
+    {.id =  306, .api = &autotest_spgramcf_signal_03,                       .name = "spgramcf_signal_03"},
+    {.id =  307, .api = &autotest_spgramcf_signal_04,                       .name = "spgramcf_signal_04"},
+    {.id =  308, .api = &autotest_spgramcf_signal_05,                       .name = "spgramcf_signal_05"},
+    {.id =  309, .api = &autotest_spgramcf_counters,                        .name = "spgramcf_counters"},
+    {.id =  310, .api = &autotest_spgramcf_invalid_config,                  .name = "spgramcf_invalid_config"},
+    {.id =  311, .api = &autotest_spgramcf_standalone,                      .name = "spgramcf_standalone"},
+    {.id =  312, .api = &autotest_spgramcf_short,                           .name = "spgramcf_short"},
+    {.id =  313, .api = &autotest_spgramcf_copy,                            .name = "spgramcf_copy"},
+    {.id =  314, .api = &autotest_spgramcf_null,                            .name = "spgramcf_null"},
+    {.id =  315, .api = &autotest_spgram_gnuplot,                           .name = "spgram_gnuplot"},
+    {.id =  316, .api = &autotest_spwaterfall_invalid_config,               .name = "spwaterfall_invalid_config"},
+    {.id =  317, .api = &autotest_spwaterfallcf_noise_440,                  .name = "spwaterfallcf_noise_440"},
+    {.id =  318, .api = &autotest_spwaterfallcf_noise_1024,                 .name = "spwaterfallcf_noise_1024"},
+    {.id =  319, .api = &autotest_spwaterfallcf_noise_1200,                 .name = "spwaterfallcf_noise_1200"},
+    {.id =  320, .api = &autotest_spwaterfall_operation,                    .name = "spwaterfall_operation"},
+    {.id =  321, .api = &autotest_spwaterfall_copy,                         .name = "spwaterfall_copy"},
+    {.id =  322, .api = &autotest_spwaterfall_gnuplot,                      .name = "spwaterfall_gnuplot"},
+    {.id =  323, .api = &autotest_dds_cccf_0,                               .name = "dds_cccf_0"},
+    {.id =  324, .api = &autotest_dds_cccf_1,                               .name = "dds_cccf_1"},
+    {.id =  325, .api = &autotest_dds_cccf_2,                               .name = "dds_cccf_2"},
+    {.id =  326, .api = &autotest_dds_config,                               .name = "dds_config"},
+    {.id =  327, .api = &autotest_dds_copy,                                 .name = "dds_copy"},
+    {.id =  328, .api = &autotest_design_cache_kaiser,                      .name = "design_cache_kaiser"},
+    {.id =  329, .api = &autotest_design_cache_evict,                       .name = "design_cache_evict"},
+    {.id =  330, .api = &autotest_design_cache_designs,                     .name = "design_cache_designs"},
+    {.id =  331, .api = &autotest_design_cache_single_rkaiser,              .name = "design_cache_single_rkaiser"},
+    {.id =  332, .api = &autotest_design_cache_single_arkaiser,             .name = "design_cache_single_arkaiser"},
+    {.id =  333, .api = &autotest_design_cache_single_hM3,                  .name = "design_cache_single_hM3"},
+    {.id =  334, .api = &autotest_design_cache_halfband,                    .name = "design_cache_halfband"},
+    {.id =  335, .api = &autotest_design_cache_config,                      .name = "design_cache_config"},
+    {.id =  336, .api = &autotest_fdelay_rrrf_0,                            .name = "fdelay_rrrf_0"},
+    {.id =  337, .api = &autotest_fdelay_rrrf_1,                            .name = "fdelay_rrrf_1"},
+    {.id =  338, .api = &autotest_fdelay_rrrf_2,                            .name = "fdelay_rrrf_2"},
+    {.id =  339, .api = &autotest_fdelay_rrrf_3,                            .name = "fdelay_rrrf_3"},
+    {.id =  340, .api = &autotest_fdelay_rrrf_4,                            .name = "fdelay_rrrf_4"},
+    {.id =  341, .api = &autotest_fdelay_rrrf_5,                            .name = "fdelay_rrrf_5"},
+    {.id =  342, .api = &autotest_fdelay_rrrf_6,                            .name = "fdelay_rrrf_6"},
+    {.id =  343, .api = &autotest_fdelay_rrrf_7,                            .name = "fdelay_rrrf_7"},
+    {.id =  344, .api = &autotest_fdelay_rrrf_8,                            .name = "fdelay_rrrf_8"},
+    {.id =  345, .api = &autotest_fdelay_rrrf_9,                            .name = "fdelay_rrrf_9"},
+    {.id =  346, .api = &autotest_fdelay_rrrf_config,                       .name = "fdelay_rrrf_config"},
+    {.id =  347, .api = &autotest_fdelay_rrrf_push_write,                   .name = "fdelay_rrrf_push_write"},
+    {.id =  348, .api = &autotest_fftfilt_rrrf_data_h4x256,                 .name = "fftfilt_rrrf_data_h4x256"},
+    {.id =  349, .api = &autotest_fftfilt_rrrf_data_h7x256,                 .name = "fftfilt_rrrf_data_h7x256"},
+    {.id =  350, .api = &autotest_fftfilt_rrrf_data_h13x256,                .name = "fftfilt_rrrf_data_h13x256"},
+    {.id =  351, .api = &autotest_fftfilt_rrrf_data_h23x256,                .name = "fftfilt_rrrf_data_h23x256"},
+    {.id =  352, .api = &autotest_fftfilt_crcf_data_h4x256,                 .name = "fftfilt_crcf_data_h4x256"},
+    {.id =  353, .api = &autotest_fftfilt_crcf_data_h7x256,                 .name = "fftfilt_crcf_data_h7x256"},
+    {.id =  354, .api = &autotest_fftfilt_crcf_data_h13x256,                .name = "fftfilt_crcf_data_h13x256"},
+    {.id =  355, .api = &autotest_fftfilt_crcf_data_h23x256,                .name = "fftfilt_crcf_data_h23x256"},
+    {.id =  356, .api = &autotest_fftfilt_cccf_data_h4x256,                 .name = "fftfilt_cccf_data_h4x256"},
+    {.id =  357, .api = &autotest_fftfilt_cccf_data_h7x256,                 .name = "fftfilt_cccf_data_h7x256"},
+    {.id =  358, .api = &autotest_fftfilt_cccf_data_h13x256,                .name = "fftfilt_cccf_data_h13x256"},
+    {.id =  359, .api = &autotest_fftfilt_cccf_data_h23x256,                .name = "fftfilt_cccf_data_h23x256"},
+    {.id =  360, .api = &autotest_fftfilt_config,                           .name = "fftfilt_config"},
+    {.id =  361, .api = &autotest_fftfilt_copy,                             .name = "fftfilt_copy"},
+    {.id =  362, .api = &autotest_filter_crosscorr_rrrf,                    .name = "filter_crosscorr_rrrf"},
+    {.id =  363, .api = &autotest_firdecim_config,                          .name = "firdecim_config"},
+    {.id =  364, .api = &autotest_firdecim_block,                           .name = "firdecim_block"},
+    {.id =  365, .api = &autotest_firdecim_rrrf_common,                     .name = "firdecim_rrrf_common"},
+    {.id =  366, .api = &autotest_firdecim_crcf_common,                     .name = "firdecim_crcf_common"},
+    {.id =  367, .api = &autotest_firdecim_rrrf_data_M2h4x20,               .name = "firdecim_rrrf_data_M2h4x20"},
+    {.id =  368, .api = &autotest_firdecim_rrrf_data_M3h7x30,               .name = "firdecim_rrrf_data_M3h7x30"},
+    {.id =  369, .api = &autotest_firdecim_rrrf_data_M4h13x40,              .name = "firdecim_rrrf_data_M4h13x40"},
+    {.id =  370, .api = &autotest_firdecim_rrrf_data_M5h23x50,              .name = "firdecim_rrrf_data_M5h23x50"},
+    {.id =  371, .api = &autotest_firdecim_crcf_data_M2h4x20,               .name = "firdecim_crcf_data_M2h4x20"},
+    {.id =  372, .api = &autotest_firdecim_crcf_data_M3h7x30,               .name = "firdecim_crcf_data_M3h7x30"},
+    {.id =  373, .api = &autotest_firdecim_crcf_data_M4h13x40,              .name = "firdecim_crcf_data_M4h13x40"},
+    {.id =  374, .api = &autotest_firdecim_crcf_data_M5h23x50,              .name = "firdecim_crcf_data_M5h23x50"},
+    {.id =  375, .api = &autotest_firdecim_cccf_data_M2h4x20,               .name = "firdecim_cccf_data_M2h4x20"},
+    {.id =  376, .api = &autotest_firdecim_cccf_data_M3h7x30,               .name = "firdecim_cccf_data_M3h7x30"},
+    {.id =  377, .api = &autotest_firdecim_cccf_data_M4h13x40,              .name = "firdecim_cccf_data_M4h13x40"},
+    {.id =  378, .api = &autotest_firdecim_cccf_data_M5h23x50,              .name = "firdecim_cccf_data_M5h23x50"},
+    {.id =  379, .api = &autotest_liquid_firdes_rcos,                       .name = "liquid_firdes_rcos"},
+    {.id =  380, .api = &autotest_liquid_firdes_rrcos,                      .name = "liquid_firdes_rrcos"},
+    {.id =  381, .api = &autotest_firdes_rrcos,                             .name = "firdes_rrcos"},
+    {.id =  382, .api = &autotest_firdes_rkaiser,                           .name = "firdes_rkaiser"},
+    {.id =  383, .api = &autotest_firdes_arkaiser,                          .name = "firdes_arkaiser"},
+    {.id =  384, .api = &autotest_liquid_firdes_dcblock,                    .name = "liquid_firdes_dcblock"},
+    {.id =  385, .api = &autotest_liquid_firdes_notch,                      .name = "liquid_firdes_notch"},
+    {.id =  386, .api = &autotest_liquid_getopt_str2firfilt,                .name = "liquid_getopt_str2firfilt"},
+    {.id =  387, .api = &autotest_liquid_firdes_config,                     .name = "liquid_firdes_config"},
+    {.id =  388, .api = &autotest_liquid_firdes_estimate,                   .name = "liquid_firdes_estimate"},
+    {.id =  389, .api = &autotest_firdes_prototype_kaiser,                  .name = "firdes_prototype_kaiser"},
+    {.id =  390, .api = &autotest_firdes_prototype_pm,                      .name = "firdes_prototype_pm"},
+    {.id =  391, .api = &autotest_firdes_prototype_rcos,                    .name = "firdes_prototype_rcos"},
+    {.id =  392, .api = &autotest_firdes_prototype_fexp,                    .name = "firdes_prototype_fexp"},
+    {.id =  393, .api = &autotest_firdes_prototype_fsech,                   .name = "firdes_prototype_fsech"},
+    {.id =  394, .api = &autotest_firdes_prototype_farcsech,                .name = "firdes_prototype_farcsech"},
+    {.id =  395, .api = &autotest_firdes_prototype_arkaiser,                .name = "firdes_prototype_arkaiser"},
+    {.id =  396, .api = &autotest_firdes_prototype_rkaiser,                 .name = "firdes_prototype_rkaiser"},
+    {.id =  397, .api = &autotest_firdes_prototype_rrcos,                   .name = "firdes_prototype_rrcos"},
+    {.id =  398, .api = &autotest_firdes_prototype_hm3,                     .name = "firdes_prototype_hm3"},
+    {.id =  399, .api = &autotest_firdes_prototype_rfexp,                   .name = "firdes_prototype_rfexp"},
+    {.id =  400, .api = &autotest_firdes_prototype_rfsech,                  .name = "firdes_prototype_rfsech"},
+    {.id =  401, .api = &autotest_firdes_prototype_rfarcsech,               .name = "firdes_prototype_rfarcsech"},
+    {.id =  402, .api = &autotest_firdes_doppler,                           .name = "firdes_doppler"},
+    {.id =  403, .api = &autotest_liquid_freqrespf,                         .name = "liquid_freqrespf"},
+    {.id =  404, .api = &autotest_liquid_freqrespcf,                        .name = "liquid_freqrespcf"},
+    {.id =  405, .api = &autotest_firdespm_bandpass_n24,                    .name = "firdespm_bandpass_n24"},
+    {.id =  406, .api = &autotest_firdespm_bandpass_n32,                    .name = "firdespm_bandpass_n32"},
+    {.id =  407, .api = &autotest_firdespm_lowpass,                         .name = "firdespm_lowpass"},
+    {.id =  408, .api = &autotest_firdespm_callback,                        .name = "firdespm_callback"},
+    {.id =  409, .api = &autotest_firdespm_halfband_m2_ft400,               .name = "firdespm_halfband_m2_ft400"},
+    {.id =  410, .api = &autotest_firdespm_halfband_m4_ft400,               .name = "firdespm_halfband_m4_ft400"},
+    {.id =  411, .api = &autotest_firdespm_halfband_m4_ft200,               .name = "firdespm_halfband_m4_ft200"},
+    {.id =  412, .api = &autotest_firdespm_halfband_m10_ft200,              .name = "firdespm_halfband_m10_ft200"},
+    {.id =  413, .api = &autotest_firdespm_halfband_m12_ft100,              .name = "firdespm_halfband_m12_ft100"},
+    {.id =  414, .api = &autotest_firdespm_halfband_m20_ft050,              .name = "firdespm_halfband_m20_ft050"},
+    {.id =  415, .api = &autotest_firdespm_halfband_m40_ft050,              .name = "firdespm_halfband_m40_ft050"},
+    {.id =  416, .api = &autotest_firdespm_halfband_m80_ft010,              .name = "firdespm_halfband_m80_ft010"},
+    {.id =  417, .api = &autotest_firdespm_lowpass_long,                    .name = "firdespm_lowpass_long"},
+    {.id =  418, .api = &autotest_firdespm_workers,                         .name = "firdespm_workers"},
+    {.id =  419, .api = &autotest_firdespm_copy,                            .name = "firdespm_copy"},
+    {.id =  420, .api = &autotest_firdespm_config,                          .name = "firdespm_config"},
+    {.id =  421, .api = &autotest_firdespm_differentiator,                  .name = "firdespm_differentiator"},
+    {.id =  422, .api = &autotest_firdespm_hilbert,                         .name = "firdespm_hilbert"},
+    {.id =  423, .api = &autotest_firfilt_crcf_kaiser,                      .name = "firfilt_crcf_kaiser"},
+    {.id =  424, .api = &autotest_firfilt_crcf_firdespm,                    .name = "firfilt_crcf_firdespm"},
+    {.id =  425, .api = &autotest_firfilt_crcf_rect,                        .name = "firfilt_crcf_rect"},
+    {.id =  426, .api = &autotest_firfilt_crcf_notch,                       .name = "firfilt_crcf_notch"},
+    {.id =  427, .api = &autotest_firfilt_cccf_notch,                       .name = "firfilt_cccf_notch"},
+    {.id =  428, .api = &autotest_firfilt_config,                           .name = "firfilt_config"},
+    {.id =  429, .api = &autotest_firfilt_recreate,                         .name = "firfilt_recreate"},
+    {.id =  430, .api = &autotest_firfilt_push_write,                       .name = "firfilt_push_write"},
+    {.id =  431, .api = &autotest_firfilt_cccf_notch_0,                     .name = "firfilt_cccf_notch_0"},
+    {.id =  432, .api = &autotest_firfilt_cccf_notch_1,                     .name = "firfilt_cccf_notch_1"},
+    {.id =  433, .api = &autotest_firfilt_cccf_notch_2,                     .name = "firfilt_cccf_notch_2"},
+    {.id =  434, .api = &autotest_firfilt_cccf_notch_3,                     .name = "firfilt_cccf_notch_3"},
+    {.id =  435, .api = &autotest_firfilt_cccf_notch_4,                     .name = "firfilt_cccf_notch_4"},
+    {.id =  436, .api = &autotest_firfilt_cccf_notch_5,                     .name = "firfilt_cccf_notch_5"},
+    {.id =  437, .api = &autotest_firfilt_cccf_coefficients_test,           .name = "firfilt_cccf_coefficients_test"},
+    {.id =  438, .api = &autotest_firfilt_rnyquist_baseline_arkaiser,       .name = "firfilt_rnyquist_baseline_arkaiser"},
+    {.id =  439, .api = &autotest_firfilt_rnyquist_baseline_rkaiser,        .name = "firfilt_rnyquist_baseline_rkaiser"},
+    {.id =  440, .api = &autotest_firfilt_rnyquist_baseline_rrc,            .name = "firfilt_rnyquist_baseline_rrc"},
+    {.id =  441, .api = &autotest_firfilt_rnyquist_baseline_hm3,            .name = "firfilt_rnyquist_baseline_hm3"},
+    {.id =  442, .api = &autotest_firfilt_rnyquist_baseline_gmsktxrx,       .name = "firfilt_rnyquist_baseline_gmsktxrx"},
+    {.id =  443, .api = &autotest_firfilt_rnyquist_baseline_rfexp,          .name = "firfilt_rnyquist_baseline_rfexp"},
+    {.id =  444, .api = &autotest_firfilt_rnyquist_baseline_rfsech,         .name = "firfilt_rnyquist_baseline_rfsech"},
+    {.id =  445, .api = &autotest_firfilt_rnyquist_baseline_rfarcsech,      .name = "firfilt_rnyquist_baseline_rfarcsech"},
+    {.id =  446, .api = &autotest_firfilt_rnyquist_0,                       .name = "firfilt_rnyquist_0"},
+    {.id =  447, .api = &autotest_firfilt_rnyquist_1,                       .name = "firfilt_rnyquist_1"},
+    {.id =  448, .api = &autotest_firfilt_rnyquist_2,                       .name = "firfilt_rnyquist_2"},
+    {.id =  449, .api = &autotest_firfilt_rnyquist_3,                       .name = "firfilt_rnyquist_3"},
+    {.id =  450, .api = &autotest_firfilt_rnyquist_4,                       .name = "firfilt_rnyquist_4"},
+    {.id =  451, .api = &autotest_firfilt_rnyquist_5,                       .name = "firfilt_rnyquist_5"},
+    {.id =  452, .api = &autotest_firfilt_rnyquist_6,                       .name = "firfilt_rnyquist_6"},
+    {.id =  453, .api = &autotest_firfilt_rnyquist_7,                       .name = "firfilt_rnyquist_7"},
+    {.id =  454, .api = &autotest_firfilt_rnyquist_8,                       .name = "firfilt_rnyquist_8"},
+    {.id =  455, .api = &autotest_firfilt_rnyquist_9,                       .name = "firfilt_rnyquist_9"},
+    {.id =  456, .api = &autotest_firfilt_rrrf_data_h4x8,                   .name = "firfilt_rrrf_data_h4x8"},
+    {.id =  457, .api = &autotest_firfilt_rrrf_data_h7x16,                  .name = "firfilt_rrrf_data_h7x16"},
+    {.id =  458, .api = &autotest_firfilt_rrrf_data_h13x32,                 .name = "firfilt_rrrf_data_h13x32"},
+    {.id =  459, .api = &autotest_firfilt_rrrf_data_h23x64,                 .name = "firfilt_rrrf_data_h23x64"},
+    {.id =  460, .api = &autotest_firfilt_crcf_data_h4x8,                   .name = "firfilt_crcf_data_h4x8"},
+    {.id =  461, .api = &autotest_firfilt_crcf_data_h7x16,                  .name = "firfilt_crcf_data_h7x16"},
+    {.id =  462, .api = &autotest_firfilt_crcf_data_h13x32,                 .name = "firfilt_crcf_data_h13x32"},
+    {.id =  463, .api = &autotest_firfilt_crcf_data_h23x64,                 .name = "firfilt_crcf_data_h23x64"},
+    {.id =  464, .api = &autotest_firfilt_cccf_data_h4x8,                   .name = "firfilt_cccf_data_h4x8"},
+    {.id =  465, .api = &autotest_firfilt_cccf_data_h7x16,                  .name = "firfilt_cccf_data_h7x16"},
+    {.id =  466, .api = &autotest_firfilt_cccf_data_h13x32,                 .name = "firfilt_cccf_data_h13x32"},
+    {.id =  467, .api = &autotest_firfilt_cccf_data_h23x64,                 .name = "firfilt_cccf_data_h23x64"},
+    {.id =  468, .api = &autotest_firfilt_crcf_copy,                        .name = "firfilt_crcf_copy"},
+    {.id =  469, .api = &autotest_firhilbf_decim,                           .name = "firhilbf_decim"},
+    {.id =  470, .api = &autotest_firhilbf_interp,                          .name = "firhilbf_interp"},
+    {.id =  471, .api = &autotest_firhilbf_psd,                             .name = "firhilbf_psd"},
+    {.id =  472, .api = &autotest_firhilbf_invalid_config,                  .name = "firhilbf_invalid_config"},
+    {.id =  473, .api = &autotest_firhilbf_copy_interp,                     .name = "firhilbf_copy_interp"},
+    {.id =  474, .api = &autotest_firhilbf_copy_decim,                      .name = "firhilbf_copy_decim"},
+    {.id =  475, .api = &autotest_firhilbf_r2c_block,                       .name = "firhilbf_r2c_block"},
+    {.id =  476, .api = &autotest_firhilbf_c2r_block,                       .name = "firhilbf_c2r_block"},
+    {.id =  477, .api = &autotest_firhilbf_decim_block,                     .name = "firhilbf_decim_block"},
+    {.id =  478, .api = &autotest_firhilbf_interp_block,                    .name = "firhilbf_interp_block"},
+    {.id =  479, .api = &autotest_firinterp_rrrf_common,                    .name = "firinterp_rrrf_common"},
+    {.id =  480, .api = &autotest_firinterp_crcf_common,                    .name = "firinterp_crcf_common"},
+    {.id =  481, .api = &autotest_firinterp_rrrf_generic,                   .name = "firinterp_rrrf_generic"},
+    {.id =  482, .api = &autotest_firinterp_crcf_generic,                   .name = "firinterp_crcf_generic"},
+    {.id =  483, .api = &autotest_firinterp_crcf_rnyquist_0,                .name = "firinterp_crcf_rnyquist_0"},
+    {.id =  484, .api = &autotest_firinterp_crcf_rnyquist_1,                .name = "firinterp_crcf_rnyquist_1"},
+    {.id =  485, .api = &autotest_firinterp_crcf_rnyquist_2,                .name = "firinterp_crcf_rnyquist_2"},
+    {.id =  486, .api = &autotest_firinterp_crcf_rnyquist_3,                .name = "firinterp_crcf_rnyquist_3"},
+    {.id =  487, .api = &autotest_firinterp_copy,                           .name = "firinterp_copy"},
+    {.id =  488, .api = &autotest_firinterp_flush,                          .name = "firinterp_flush"},
+    {.id =  489, .api = &autotest_firpfb_impulse_response,                  .name = "firpfb_impulse_response"},
+    {.id =  490, .api = &autotest_firpfb_crcf_copy,                         .name = "firpfb_crcf_copy"},
+    {.id =  491, .api = &autotest_fir_groupdelay_n3,                        .name = "fir_groupdelay_n3"},
+    {.id =  492, .api = &autotest_iir_groupdelay_n3,                        .name = "iir_groupdelay_n3"},
+    {.id =  493, .api = &autotest_iir_groupdelay_n8,                        .name = "iir_groupdelay_n8"},
+    {.id =  494, .api = &autotest_iir_groupdelay_sos_n8,                    .name = "iir_groupdelay_sos_n8"},
+    {.id =  495, .api = &autotest_iirdecim_copy,                            .name = "iirdecim_copy"},
+    {.id =  496, .api = &autotest_iirdes_butter_2,                          .name = "iirdes_butter_2"},
+    {.id =  497, .api = &autotest_iirdes_ellip_lowpass_0,                   .name = "iirdes_ellip_lowpass_0"},
+    {.id =  498, .api = &autotest_iirdes_ellip_lowpass_1,                   .name = "iirdes_ellip_lowpass_1"},
+    {.id =  499, .api = &autotest_iirdes_ellip_lowpass_2,                   .name = "iirdes_ellip_lowpass_2"},
+    {.id =  500, .api = &autotest_iirdes_ellip_lowpass_3,                   .name = "iirdes_ellip_lowpass_3"},
+    {.id =  501, .api = &autotest_iirdes_ellip_lowpass_4,                   .name = "iirdes_ellip_lowpass_4"},
+    {.id =  502, .api = &autotest_iirdes_cheby1_lowpass_0,                  .name = "iirdes_cheby1_lowpass_0"},
+    {.id =  503, .api = &autotest_iirdes_cheby1_lowpass_1,                  .name = "iirdes_cheby1_lowpass_1"},
+    {.id =  504, .api = &autotest_iirdes_cheby1_lowpass_2,                  .name = "iirdes_cheby1_lowpass_2"},
+    {.id =  505, .api = &autotest_iirdes_cheby1_lowpass_3,                  .name = "iirdes_cheby1_lowpass_3"},
+    {.id =  506, .api = &autotest_iirdes_cheby1_lowpass_4,                  .name = "iirdes_cheby1_lowpass_4"},
+    {.id =  507, .api = &autotest_iirdes_cheby2_lowpass_0,                  .name = "iirdes_cheby2_lowpass_0"},
+    {.id =  508, .api = &autotest_iirdes_cheby2_lowpass_1,                  .name = "iirdes_cheby2_lowpass_1"},
+    {.id =  509, .api = &autotest_iirdes_cheby2_lowpass_2,                  .name = "iirdes_cheby2_lowpass_2"},
+    {.id =  510, .api = &autotest_iirdes_cheby2_lowpass_3,                  .name = "iirdes_cheby2_lowpass_3"},
+    {.id =  511, .api = &autotest_iirdes_cheby2_lowpass_4,                  .name = "iirdes_cheby2_lowpass_4"},
+    {.id =  512, .api = &autotest_iirdes_butter_lowpass_0,                  .name = "iirdes_butter_lowpass_0"},
+    {.id =  513, .api = &autotest_iirdes_butter_lowpass_1,                  .name = "iirdes_butter_lowpass_1"},
+    {.id =  514, .api = &autotest_iirdes_butter_lowpass_2,                  .name = "iirdes_butter_lowpass_2"},
+    {.id =  515, .api = &autotest_iirdes_butter_lowpass_3,                  .name = "iirdes_butter_lowpass_3"},
+    {.id =  516, .api = &autotest_iirdes_butter_lowpass_4,                  .name = "iirdes_butter_lowpass_4"},
+    {.id =  517, .api = &autotest_iirdes_ellip_highpass,                    .name = "iirdes_ellip_highpass"},
+    {.id =  518, .api = &autotest_iirdes_ellip_bandpass,                    .name = "iirdes_ellip_bandpass"},
+    {.id =  519, .api = &autotest_iirdes_ellip_bandstop,                    .name = "iirdes_ellip_bandstop"},
+    {.id =  520, .api = &autotest_iirdes_bessel,                            .name = "iirdes_bessel"},
+    {.id =  521, .api = &autotest_iirdes_cplxpair_n6,                       .name = "iirdes_cplxpair_n6"},
+    {.id =  522, .api = &autotest_iirdes_cplxpair_n20,                      .name = "iirdes_cplxpair_n20"},
+    {.id =  523, .api = &autotest_iirdes_dzpk2sosf,                         .name = "iirdes_dzpk2sosf"},
+    {.id =  524, .api = &autotest_iirdes_isstable_n2_yes,                   .name = "iirdes_isstable_n2_yes"},
+    {.id =  525, .api = &autotest_iirdes_isstable_n2_no,                    .name = "iirdes_isstable_n2_no"},
+    {.id =  526, .api = &autotest_iirfilt_integrator,                       .name = "iirfilt_integrator"},
+    {.id =  527, .api = &autotest_iirfilt_differentiator,                   .name = "iirfilt_differentiator"},
+    {.id =  528, .api = &autotest_iirfilt_dcblock,                          .name = "iirfilt_dcblock"},
+    {.id =  529, .api = &autotest_iirfilt_copy_tf,                          .name = "iirfilt_copy_tf"},
+    {.id =  530, .api = &autotest_iirfilt_copy_sos,                         .name = "iirfilt_copy_sos"},
+    {.id =  531, .api = &autotest_iirfilt_config,                           .name = "iirfilt_config"},
+    {.id =  532, .api = &autotest_iirfilt_rrrf_h3x64,                       .name = "iirfilt_rrrf_h3x64"},
+    {.id =  533, .api = &autotest_iirfilt_rrrf_h5x64,                       .name = "iirfilt_rrrf_h5x64"},
+    {.id =  534, .api = &autotest_iirfilt_rrrf_h7x64,                       .name = "iirfilt_rrrf_h7x64"},
+    {.id =  535, .api = &autotest_iirfilt_crcf_h3x64,                       .name = "iirfilt_crcf_h3x64"},
+    {.id =  536, .api = &autotest_iirfilt_crcf_h5x64,                       .name = "iirfilt_crcf_h5x64"},
+    {.id =  537, .api = &autotest_iirfilt_crcf_h7x64,                       .name = "iirfilt_crcf_h7x64"},
+    {.id =  538, .api = &autotest_iirfilt_cccf_h3x64,                       .name = "iirfilt_cccf_h3x64"},
+    {.id =  539, .api = &autotest_iirfilt_cccf_h5x64,                       .name = "iirfilt_cccf_h5x64"},
+    {.id =  540, .api = &autotest_iirfilt_cccf_h7x64,                       .name = "iirfilt_cccf_h7x64"},
+    {.id =  541, .api = &autotest_iirfiltbank_crcf_channels,                .name = "iirfiltbank_crcf_channels"},
+    {.id =  542, .api = &autotest_iirfiltbank_rrrf_dcblock_block,           .name = "iirfiltbank_rrrf_dcblock_block"},
+    {.id =  543, .api = &autotest_iirfiltbank_crcf_lookahead_n4_1024,       .name = "iirfiltbank_crcf_lookahead_n4_1024"},
+    {.id =  544, .api = &autotest_iirfiltbank_crcf_lookahead_n7_1500,       .name = "iirfiltbank_crcf_lookahead_n7_1500"},
+    {.id =  545, .api = &autotest_iirfiltbank_crcf_lookahead_n3_4099,       .name = "iirfiltbank_crcf_lookahead_n3_4099"},
+    {.id =  546, .api = &autotest_iirfiltbank_copy,                         .name = "iirfiltbank_copy"},
+    {.id =  547, .api = &autotest_iirfiltbank_config,                       .name = "iirfiltbank_config"},
+    {.id =  548, .api = &autotest_iirfiltsos_impulse_n2,                    .name = "iirfiltsos_impulse_n2"},
+    {.id =  549, .api = &autotest_iirfiltsos_step_n2,                       .name = "iirfiltsos_step_n2"},
+    {.id =  550, .api = &autotest_iirfiltsos_copy,                          .name = "iirfiltsos_copy"},
+    {.id =  551, .api = &autotest_iirfiltsos_config,                        .name = "iirfiltsos_config"},
+    {.id =  552, .api = &autotest_iirhilbf_interp_decim,                    .name = "iirhilbf_interp_decim"},
+    {.id =  553, .api = &autotest_iirhilbf_filter,                          .name = "iirhilbf_filter"},
+    {.id =  554, .api = &autotest_iirhilbf_invalid_config,                  .name = "iirhilbf_invalid_config"},
+    {.id =  555, .api = &autotest_iirhilbf_copy_interp,                     .name = "iirhilbf_copy_interp"},
+    {.id =  556, .api = &autotest_iirhilbf_copy_decim,                      .name = "iirhilbf_copy_decim"},
+    {.id =  557, .api = &autotest_iirinterp_crcf_M2_O9,                     .name = "iirinterp_crcf_M2_O9"},
+    {.id =  558, .api = &autotest_iirinterp_crcf_M3_O9,                     .name = "iirinterp_crcf_M3_O9"},
+    {.id =  559, .api = &autotest_iirinterp_crcf_M4_O9,                     .name = "iirinterp_crcf_M4_O9"},
+    {.id =  560, .api = &autotest_iirinterp_copy,                           .name = "iirinterp_copy"},
+    {.id =  561, .api = &autotest_lpc_p4,                                   .name = "lpc_p4"},
+    {.id =  562, .api = &autotest_lpc_p6,                                   .name = "lpc_p6"},
+    {.id =  563, .api = &autotest_lpc_p8,                                   .name = "lpc_p8"},
+    {.id =  564, .api = &autotest_lpc_p10,                                  .name = "lpc_p10"},
+    {.id =  565, .api = &autotest_lpc_p16,                                  .name = "lpc_p16"},
+    {.id =  566, .api = &autotest_lpc_p32,                                  .name = "lpc_p32"},
+    {.id =  567, .api = &autotest_msresamp_crcf_01,                         .name = "msresamp_crcf_01"},
+    {.id =  568, .api = &autotest_msresamp_crcf_02,                         .name = "msresamp_crcf_02"},
+    {.id =  569, .api = &autotest_msresamp_crcf_03,                         .name = "msresamp_crcf_03"},
+    {.id =  570, .api = &autotest_msresamp_crcf_num_output_0,               .name = "msresamp_crcf_num_output_0"},
+    {.id =  571, .api = &autotest_msresamp_crcf_num_output_1,               .name = "msresamp_crcf_num_output_1"},
+    {.id =  572, .api = &autotest_msresamp_crcf_num_output_2,               .name = "msresamp_crcf_num_output_2"},
+    {.id =  573, .api = &autotest_msresamp_crcf_num_output_3,               .name = "msresamp_crcf_num_output_3"},
+    {.id =  574, .api = &autotest_msresamp_crcf_num_output_4,               .name = "msresamp_crcf_num_output_4"},
+    {.id =  575, .api = &autotest_msresamp_crcf_num_output_5,               .name = "msresamp_crcf_num_output_5"},
+    {.id =  576, .api = &autotest_msresamp_crcf_num_output_6,               .name = "msresamp_crcf_num_output_6"},
+    {.id =  577, .api = &autotest_msresamp_crcf_num_output_7,               .name = "msresamp_crcf_num_output_7"},
+    {.id =  578, .api = &autotest_msresamp_crcf_copy,                       .name = "msresamp_crcf_copy"},
+    {.id =  579, .api = &autotest_msresamp2_crcf_interp_01,                 .name = "msresamp2_crcf_interp_01"},
+    {.id =  580, .api = &autotest_msresamp2_crcf_interp_02,                 .name = "msresamp2_crcf_interp_02"},
+    {.id =  581, .api = &autotest_msresamp2_crcf_interp_03,                 .name = "msresamp2_crcf_interp_03"},
+    {.id =  582, .api = &autotest_msresamp2_crcf_interp_04,                 .name = "msresamp2_crcf_interp_04"},
+    {.id =  583, .api = &autotest_msresamp2_crcf_interp_05,                 .name = "msresamp2_crcf_interp_05"},
+    {.id =  584, .api = &autotest_msresamp2_crcf_interp_06,                 .name = "msresamp2_crcf_interp_06"},
+    {.id =  585, .api = &autotest_msresamp2_crcf_interp_07,                 .name = "msresamp2_crcf_interp_07"},
+    {.id =  586, .api = &autotest_msresamp2_crcf_interp_08,                 .name = "msresamp2_crcf_interp_08"},
+    {.id =  587, .api = &autotest_msresamp2_crcf_interp_09,                 .name = "msresamp2_crcf_interp_09"},
+    {.id =  588, .api = &autotest_msresamp2_crcf_interp_10,                 .name = "msresamp2_crcf_interp_10"},
+    {.id =  589, .api = &autotest_msresamp2_crcf_interp_11,                 .name = "msresamp2_crcf_interp_11"},
+    {.id =  590, .api = &autotest_msresamp2_copy,                           .name = "msresamp2_copy"},
+    {.id =  591, .api = &autotest_ordfilt_copy,                             .name = "ordfilt_copy"},
+    {.id =  592, .api = &autotest_rresamp_crcf_baseline_P1_Q5,              .name = "rresamp_crcf_baseline_P1_Q5"},
+    {.id =  593, .api = &autotest_rresamp_crcf_baseline_P2_Q5,              .name = "rresamp_crcf_baseline_P2_Q5"},
+    {.id =  594, .api = &autotest_rresamp_crcf_baseline_P3_Q5,              .name = "rresamp_crcf_baseline_P3_Q5"},
+    {.id =  595, .api = &autotest_rresamp_crcf_baseline_P6_Q5,              .name = "rresamp_crcf_baseline_P6_Q5"},
+    {.id =  596, .api = &autotest_rresamp_crcf_baseline_P8_Q5,              .name = "rresamp_crcf_baseline_P8_Q5"},
+    {.id =  597, .api = &autotest_rresamp_crcf_baseline_P9_Q5,              .name = "rresamp_crcf_baseline_P9_Q5"},
+    {.id =  598, .api = &autotest_rresamp_crcf_default_P1_Q5,               .name = "rresamp_crcf_default_P1_Q5"},
+    {.id =  599, .api = &autotest_rresamp_crcf_default_P2_Q5,               .name = "rresamp_crcf_default_P2_Q5"},
+    {.id =  600, .api = &autotest_rresamp_crcf_default_P3_Q5,               .name = "rresamp_crcf_default_P3_Q5"},
+    {.id =  601, .api = &autotest_rresamp_crcf_default_P6_Q5,               .name = "rresamp_crcf_default_P6_Q5"},
+    {.id =  602, .api = &autotest_rresamp_crcf_default_P8_Q5,               .name = "rresamp_crcf_default_P8_Q5"},
+    {.id =  603, .api = &autotest_rresamp_crcf_default_P9_Q5,               .name = "rresamp_crcf_default_P9_Q5"},
+    {.id =  604, .api = &autotest_rresamp_crcf_arkaiser_P3_Q5,              .name = "rresamp_crcf_arkaiser_P3_Q5"},
+    {.id =  605, .api = &autotest_rresamp_crcf_arkaiser_P5_Q3,              .name = "rresamp_crcf_arkaiser_P5_Q3"},
+    {.id =  606, .api = &autotest_rresamp_crcf_rrcos_P3_Q5,                 .name = "rresamp_crcf_rrcos_P3_Q5"},
+    {.id =  607, .api = &autotest_rresamp_crcf_rrcos_P5_Q3,                 .name = "rresamp_crcf_rrcos_P5_Q3"},
+    {.id =  608, .api = &autotest_rresamp_copy,                             .name = "rresamp_copy"},
+    {.id =  609, .api = &autotest_rresamp_config,                           .name = "rresamp_config"},
+    {.id =  610, .api = &autotest_rresamp_crcf_part_P1_Q5,                  .name = "rresamp_crcf_part_P1_Q5"},
+    {.id =  611, .api = &autotest_rresamp_crcf_part_P2_Q5,                  .name = "rresamp_crcf_part_P2_Q5"},
+    {.id =  612, .api = &autotest_rresamp_crcf_part_P3_Q5,                  .name = "rresamp_crcf_part_P3_Q5"},
+    {.id =  613, .api = &autotest_rresamp_crcf_part_P6_Q5,                  .name = "rresamp_crcf_part_P6_Q5"},
+    {.id =  614, .api = &autotest_rresamp_crcf_part_P8_Q5,                  .name = "rresamp_crcf_part_P8_Q5"},
+    {.id =  615, .api = &autotest_rresamp_crcf_part_P9_Q5,                  .name = "rresamp_crcf_part_P9_Q5"},
+    {.id =  616, .api = &autotest_resamp_crcf_00,                           .name = "resamp_crcf_00"},
+    {.id =  617, .api = &autotest_resamp_crcf_01,                           .name = "resamp_crcf_01"},
+    {.id =  618, .api = &autotest_resamp_crcf_02,                           .name = "resamp_crcf_02"},
+    {.id =  619, .api = &autotest_resamp_crcf_03,                           .name = "resamp_crcf_03"},
+    {.id =  620, .api = &autotest_resamp_crcf_10,                           .name = "resamp_crcf_10"},
+    {.id =  621, .api = &autotest_resamp_crcf_11,                           .name = "resamp_crcf_11"},
+    {.id =  622, .api = &autotest_resamp_crcf_12,                           .name = "resamp_crcf_12"},
+    {.id =  623, .api = &autotest_resamp_crcf_13,                           .name = "resamp_crcf_13"},
+    {.id =  624, .api = &autotest_resamp_crcf_num_output_0,                 .name = "resamp_crcf_num_output_0"},
+    {.id =  625, .api = &autotest_resamp_crcf_num_output_1,                 .name = "resamp_crcf_num_output_1"},
+    {.id =  626, .api = &autotest_resamp_crcf_num_output_2,                 .name = "resamp_crcf_num_output_2"},
+    {.id =  627, .api = &autotest_resamp_crcf_num_output_3,                 .name = "resamp_crcf_num_output_3"},
+    {.id =  628, .api = &autotest_resamp_crcf_num_output_4,                 .name = "resamp_crcf_num_output_4"},
+    {.id =  629, .api = &autotest_resamp_crcf_num_output_5,                 .name = "resamp_crcf_num_output_5"},
+    {.id =  630, .api = &autotest_resamp_crcf_num_output_6,                 .name = "resamp_crcf_num_output_6"},
+    {.id =  631, .api = &autotest_resamp_crcf_num_output_7,                 .name = "resamp_crcf_num_output_7"},
+    {.id =  632, .api = &autotest_resamp_crcf_copy,                         .name = "resamp_crcf_copy"},
+    {.id =  633, .api = &autotest_resamp2_analysis,                         .name = "resamp2_analysis"},
+    {.id =  634, .api = &autotest_resamp2_synthesis,                        .name = "resamp2_synthesis"},
+    {.id =  635, .api = &autotest_resamp2_crcf_filter_0,                    .name = "resamp2_crcf_filter_0"},
+    {.id =  636, .api = &autotest_resamp2_crcf_filter_1,                    .name = "resamp2_crcf_filter_1"},
+    {.id =  637, .api = &autotest_resamp2_crcf_filter_2,                    .name = "resamp2_crcf_filter_2"},
+    {.id =  638, .api = &autotest_resamp2_crcf_filter_3,                    .name = "resamp2_crcf_filter_3"},
+    {.id =  639, .api = &autotest_resamp2_crcf_filter_4,                    .name = "resamp2_crcf_filter_4"},
+    {.id =  640, .api = &autotest_resamp2_crcf_filter_5,                    .name = "resamp2_crcf_filter_5"},
+    {.id =  641, .api = &autotest_resamp2_config,                           .name = "resamp2_config"},
+    {.id =  642, .api = &autotest_resamp2_copy,                             .name = "resamp2_copy"},
+    {.id =  643, .api = &autotest_liquid_rkaiser_config,                    .name = "liquid_rkaiser_config"},
+    {.id =  644, .api = &autotest_symsync_copy,                             .name = "symsync_copy"},
+    {.id =  645, .api = &autotest_symsync_config,                           .name = "symsync_config"},
+    {.id =  646, .api = &autotest_symsync_crcf_scenario_0,                  .name = "symsync_crcf_scenario_0"},
+    {.id =  647, .api = &autotest_symsync_crcf_scenario_1,                  .name = "symsync_crcf_scenario_1"},
+    {.id =  648, .api = &autotest_symsync_crcf_scenario_2,                  .name = "symsync_crcf_scenario_2"},
+    {.id =  649, .api = &autotest_symsync_crcf_scenario_3,                  .name = "symsync_crcf_scenario_3"},
+    {.id =  650, .api = &autotest_symsync_crcf_scenario_4,                  .name = "symsync_crcf_scenario_4"},
+    {.id =  651, .api = &autotest_symsync_crcf_scenario_5,                  .name = "symsync_crcf_scenario_5"},
+    {.id =  652, .api = &autotest_symsync_crcf_scenario_6,                  .name = "symsync_crcf_scenario_6"},
+    {.id =  653, .api = &autotest_symsync_crcf_scenario_7,                  .name = "symsync_crcf_scenario_7"},
+    {.id =  654, .api = &autotest_symsync_crcf_fused_mf,                    .name = "symsync_crcf_fused_mf"},
+    {.id =  655, .api = &autotest_symsync_crcf_block,                       .name = "symsync_crcf_block"},
+    {.id =  656, .api = &autotest_symsync_rrrf_scenario_0,                  .name = "symsync_rrrf_scenario_0"},
+    {.id =  657, .api = &autotest_symsync_rrrf_scenario_1,                  .name = "symsync_rrrf_scenario_1"},
+    {.id =  658, .api = &autotest_symsync_rrrf_scenario_2,                  .name = "symsync_rrrf_scenario_2"},
+    {.id =  659, .api = &autotest_symsync_rrrf_scenario_3,                  .name = "symsync_rrrf_scenario_3"},
+    {.id =  660, .api = &autotest_symsync_rrrf_scenario_4,                  .name = "symsync_rrrf_scenario_4"},
+    {.id =  661, .api = &autotest_symsync_rrrf_scenario_5,                  .name = "symsync_rrrf_scenario_5"},
+    {.id =  662, .api = &autotest_symsync_rrrf_scenario_6,                  .name = "symsync_rrrf_scenario_6"},
+    {.id =  663, .api = &autotest_symsync_rrrf_scenario_7,                  .name = "symsync_rrrf_scenario_7"},
+    {.id =  664, .api = &autotest_bpacketsync,                              .name = "bpacketsync"},
+    {.id =  665, .api = &autotest_bsync_rrrf_15,                            .name = "bsync_rrrf_15"},
+    {.id =  666, .api = &autotest_bsync_crcf_15,                            .name = "bsync_crcf_15"},
+    {.id =  667, .api = &autotest_detector_cccf_n64,                        .name = "detector_cccf_n64"},
+    {.id =  668, .api = &autotest_detector_cccf_n83,                        .name = "detector_cccf_n83"},
+    {.id =  669, .api = &autotest_detector_cccf_n128,                       .name = "detector_cccf_n128"},
+    {.id =  670, .api = &autotest_detector_cccf_n167,                       .name = "detector_cccf_n167"},
+    {.id =  671, .api = &autotest_detector_cccf_n256,                       .name = "detector_cccf_n256"},
+    {.id =  672, .api = &autotest_detector_cccf_n335,                       .name = "detector_cccf_n335"},
+    {.id =  673, .api = &autotest_detector_cccf_n512,                       .name = "detector_cccf_n512"},
+    {.id =  674, .api = &autotest_detector_cccf_n671,                       .name = "detector_cccf_n671"},
+    {.id =  675, .api = &autotest_detector_cccf_n1024,                      .name = "detector_cccf_n1024"},
+    {.id =  676, .api = &autotest_detector_cccf_n1341,                      .name = "detector_cccf_n1341"},
+    {.id =  677, .api = &autotest_dsssframe64sync,                          .name = "dsssframe64sync"},
+    {.id =  678, .api = &autotest_dsssframe64_config,                       .name = "dsssframe64_config"},
+    {.id =  679, .api = &autotest_dsssframe64gen_copy,                      .name = "dsssframe64gen_copy"},
+    {.id =  680, .api = &autotest_dsssframe64sync_copy,                     .name = "dsssframe64sync_copy"},
+    {.id =  681, .api = &autotest_dsssframesync,                            .name = "dsssframesync"},
+    {.id =  682, .api = &autotest_flexframesync,                            .name = "flexframesync"},
+    {.id =  683, .api = &autotest_framesync64,                              .name = "framesync64"},
+    {.id =  684, .api = &autotest_framegen64_copy,                          .name = "framegen64_copy"},
+    {.id =  685, .api = &autotest_framesync64_copy,                         .name = "framesync64_copy"},
+    {.id =  686, .api = &autotest_framesync64_config,                       .name = "framesync64_config"},
+    {.id =  687, .api = &autotest_framesync64_debug_none,                   .name = "framesync64_debug_none"},
+    {.id =  688, .api = &autotest_framesync64_debug_user,                   .name = "framesync64_debug_user"},
+    {.id =  689, .api = &autotest_framesync64_debug_ndet,                   .name = "framesync64_debug_ndet"},
+    {.id =  690, .api = &autotest_framesync64_debug_head,                   .name = "framesync64_debug_head"},
+    {.id =  691, .api = &autotest_framesync64_debug_rand,                   .name = "framesync64_debug_rand"},
+    {.id =  692, .api = &autotest_framesync64_estimation,                   .name = "framesync64_estimation"},
+    {.id =  693, .api = &autotest_framesync64_batch_w1,                     .name = "framesync64_batch_w1"},
+    {.id =  694, .api = &autotest_framesync64_batch_w4,                     .name = "framesync64_batch_w4"},
+    {.id =  695, .api = &autotest_flexframesync_batch_w1,                   .name = "flexframesync_batch_w1"},
+    {.id =  696, .api = &autotest_flexframesync_batch_w3,                   .name = "flexframesync_batch_w3"},
+    {.id =  697, .api = &autotest_framesync64_batch_streaming,              .name = "framesync64_batch_streaming"},
+    {.id =  698, .api = &autotest_framesync_batch_config,                   .name = "framesync_batch_config"},
+    {.id =  699, .api = &autotest_fskframesync,                             .name = "fskframesync"},
+    {.id =  700, .api = &autotest_gmskframesync_process,                    .name = "gmskframesync_process"},
+    {.id =  701, .api = &autotest_gmskframesync_multiple,                   .name = "gmskframesync_multiple"},
+    {.id =  702, .api = &autotest_gmskframesync_k02_m05_bt20,               .name = "gmskframesync_k02_m05_bt20"},
+    {.id =  703, .api = &autotest_gmskframesync_k02_m05_bt30,               .name = "gmskframesync_k02_m05_bt30"},
+    {.id =  704, .api = &autotest_gmskframesync_k02_m05_bt40,               .name = "gmskframesync_k02_m05_bt40"},
+    {.id =  705, .api = &autotest_gmskframesync_k04_m05_bt20,               .name = "gmskframesync_k04_m05_bt20"},
+    {.id =  706, .api = &autotest_gmskframesync_k04_m05_bt30,               .name = "gmskframesync_k04_m05_bt30"},
+    {.id =  707, .api = &autotest_gmskframesync_k04_m05_bt40,               .name = "gmskframesync_k04_m05_bt40"},
+    {.id =  708, .api = &autotest_gmskframesync_k03_m07_bt20,               .name = "gmskframesync_k03_m07_bt20"},
+    {.id =  709, .api = &autotest_gmskframesync_k08_m20_bt15,               .name = "gmskframesync_k08_m20_bt15"},
+    {.id =  710, .api = &autotest_gmskframesync_k15_m02_bt40,               .name = "gmskframesync_k15_m02_bt40"},
+    {.id =  711, .api = &autotest_msourcecf_tone,                           .name = "msourcecf_tone"},
+    {.id =  712, .api = &autotest_msourcecf_chirp,                          .name = "msourcecf_chirp"},
+    {.id =  713, .api = &autotest_msourcecf_aggregate,                      .name = "msourcecf_aggregate"},
+    {.id =  714, .api = &autotest_msourcecf_config,                         .name = "msourcecf_config"},
+    {.id =  715, .api = &autotest_msourcecf_accessor,                       .name = "msourcecf_accessor"},
+    {.id =  716, .api = &autotest_msourcecf_copy,                           .name = "msourcecf_copy"},
+    {.id =  717, .api = &autotest_presync_bank_n64,                         .name = "presync_bank_n64"},
+    {.id =  718, .api = &autotest_presync_fft_n64,                          .name = "presync_fft_n64"},
+    {.id =  719, .api = &autotest_presync_fft_n64_neg,                      .name = "presync_fft_n64_neg"},
+    {.id =  720, .api = &autotest_presync_fft_n256,                         .name = "presync_fft_n256"},
+    {.id =  721, .api = &autotest_presync_fft_n256_zero,                    .name = "presync_fft_n256_zero"},
+    {.id =  722, .api = &autotest_bpresync_bank_n64,                        .name = "bpresync_bank_n64"},
+    {.id =  723, .api = &autotest_bpresync_fft_n64,                         .name = "bpresync_fft_n64"},
+    {.id =  724, .api = &autotest_bpresync_fft_n256_neg,                    .name = "bpresync_fft_n256_neg"},
+    {.id =  725, .api = &autotest_presync_fft_block,                        .name = "presync_fft_block"},
+    {.id =  726, .api = &autotest_presync_config,                           .name = "presync_config"},
+    {.id =  727, .api = &autotest_ofdmflexframe_00,                         .name = "ofdmflexframe_00"},
+    {.id =  728, .api = &autotest_ofdmflexframe_01,                         .name = "ofdmflexframe_01"},
+    {.id =  729, .api = &autotest_ofdmflexframe_02,                         .name = "ofdmflexframe_02"},
+    {.id =  730, .api = &autotest_ofdmflexframe_03,                         .name = "ofdmflexframe_03"},
+    {.id =  731, .api = &autotest_ofdmflexframe_04,                         .name = "ofdmflexframe_04"},
+    {.id =  732, .api = &autotest_ofdmflexframe_05,                         .name = "ofdmflexframe_05"},
+    {.id =  733, .api = &autotest_ofdmflexframe_06,                         .name = "ofdmflexframe_06"},
+    {.id =  734, .api = &autotest_ofdmflexframe_07,                         .name = "ofdmflexframe_07"},
+    {.id =  735, .api = &autotest_ofdmflexframe_08,                         .name = "ofdmflexframe_08"},
+    {.id =  736, .api = &autotest_ofdmflexframe_09,                         .name = "ofdmflexframe_09"},
+    {.id =  737, .api = &autotest_ofdmflexframegen_config,                  .name = "ofdmflexframegen_config"},
+    {.id =  738, .api = &autotest_ofdmflexframesync_config,                 .name = "ofdmflexframesync_config"},
+    {.id =  739, .api = &autotest_qdetector_cccf_linear_n64,                .name = "qdetector_cccf_linear_n64"},
+    {.id =  740, .api = &autotest_qdetector_cccf_linear_n83,                .name = "qdetector_cccf_linear_n83"},
+    {.id =  741, .api = &autotest_qdetector_cccf_linear_n128,               .name = "qdetector_cccf_linear_n128"},
+    {.id =  742, .api = &autotest_qdetector_cccf_linear_n167,               .name = "qdetector_cccf_linear_n167"},
+    {.id =  743, .api = &autotest_qdetector_cccf_linear_n256,               .name = "qdetector_cccf_linear_n256"},
+    {.id =  744, .api = &autotest_qdetector_cccf_linear_n335,               .name = "qdetector_cccf_linear_n335"},
+    {.id =  745, .api = &autotest_qdetector_cccf_linear_n512,               .name = "qdetector_cccf_linear_n512"},
+    {.id =  746, .api = &autotest_qdetector_cccf_linear_n671,               .name = "qdetector_cccf_linear_n671"},
+    {.id =  747, .api = &autotest_qdetector_cccf_linear_n1024,              .name = "qdetector_cccf_linear_n1024"},
+    {.id =  748, .api = &autotest_qdetector_cccf_linear_n1341,              .name = "qdetector_cccf_linear_n1341"},
+    {.id =  749, .api = &autotest_qdetector_cccf_gmsk_n64,                  .name = "qdetector_cccf_gmsk_n64"},
+    {.id =  750, .api = &autotest_qdetector_cccf_gmsk_n83,                  .name = "qdetector_cccf_gmsk_n83"},
+    {.id =  751, .api = &autotest_qdetector_cccf_gmsk_n128,                 .name = "qdetector_cccf_gmsk_n128"},
+    {.id =  752, .api = &autotest_qdetector_cccf_gmsk_n167,                 .name = "qdetector_cccf_gmsk_n167"},
+    {.id =  753, .api = &autotest_qdetector_cccf_gmsk_n256,                 .name = "qdetector_cccf_gmsk_n256"},
+    {.id =  754, .api = &autotest_qdetector_cccf_gmsk_n335,                 .name = "qdetector_cccf_gmsk_n335"},
+    {.id =  755, .api = &autotest_qdetector_cccf_gmsk_n512,                 .name = "qdetector_cccf_gmsk_n512"},
+    {.id =  756, .api = &autotest_qdetector_cccf_gmsk_n671,                 .name = "qdetector_cccf_gmsk_n671"},
+    {.id =  757, .api = &autotest_qdetector_cccf_gmsk_n1024,                .name = "qdetector_cccf_gmsk_n1024"},
+    {.id =  758, .api = &autotest_qdetector_cccf_gmsk_n1341,                .name = "qdetector_cccf_gmsk_n1341"},
+    {.id =  759, .api = &autotest_qdetector_cccf_copy,                      .name = "qdetector_cccf_copy"},
+    {.id =  760, .api = &autotest_qdsync_cccf_k2,                           .name = "qdsync_cccf_k2"},
+    {.id =  761, .api = &autotest_qdsync_cccf_k3,                           .name = "qdsync_cccf_k3"},
+    {.id =  762, .api = &autotest_qdsync_cccf_k4,                           .name = "qdsync_cccf_k4"},
+    {.id =  763, .api = &autotest_qdsync_set_buf_len,                       .name = "qdsync_set_buf_len"},
+    {.id =  764, .api = &autotest_qdsync_cccf_copy,                         .name = "qdsync_cccf_copy"},
+    {.id =  765, .api = &autotest_qdsync_cccf_config,                       .name = "qdsync_cccf_config"},
+    {.id =  766, .api = &autotest_qpacketmodem_bpsk,                        .name = "qpacketmodem_bpsk"},
+    {.id =  767, .api = &autotest_qpacketmodem_qpsk,                        .name = "qpacketmodem_qpsk"},
+    {.id =  768, .api = &autotest_qpacketmodem_psk8,                        .name = "qpacketmodem_psk8"},
+    {.id =  769, .api = &autotest_qpacketmodem_qam16,                       .name = "qpacketmodem_qam16"},
+    {.id =  770, .api = &autotest_qpacketmodem_sqam32,                      .name = "qpacketmodem_sqam32"},
+    {.id =  771, .api = &autotest_qpacketmodem_qam64,                       .name = "qpacketmodem_qam64"},
+    {.id =  772, .api = &autotest_qpacketmodem_sqam128,                     .name = "qpacketmodem_sqam128"},
+    {.id =  773, .api = &autotest_qpacketmodem_qam256,                      .name = "qpacketmodem_qam256"},
+    {.id =  774, .api = &autotest_qpacketmodem_ldpc12,                      .name = "qpacketmodem_ldpc12"},
+    {.id =  775, .api = &autotest_qpacketmodem_ldpc34,                      .name = "qpacketmodem_ldpc34"},
+    {.id =  776, .api = &autotest_qpacketmodem_evm,                         .name = "qpacketmodem_evm"},
+    {.id =  777, .api = &autotest_qpacketmodem_unmod_bpsk,                  .name = "qpacketmodem_unmod_bpsk"},
+    {.id =  778, .api = &autotest_qpacketmodem_unmod_qpsk,                  .name = "qpacketmodem_unmod_qpsk"},
+    {.id =  779, .api = &autotest_qpacketmodem_unmod_psk8,                  .name = "qpacketmodem_unmod_psk8"},
+    {.id =  780, .api = &autotest_qpacketmodem_unmod_qam16,                 .name = "qpacketmodem_unmod_qam16"},
+    {.id =  781, .api = &autotest_qpacketmodem_unmod_sqam32,                .name = "qpacketmodem_unmod_sqam32"},
+    {.id =  782, .api = &autotest_qpacketmodem_unmod_qam64,                 .name = "qpacketmodem_unmod_qam64"},
+    {.id =  783, .api = &autotest_qpacketmodem_unmod_sqam128,               .name = "qpacketmodem_unmod_sqam128"},
+    {.id =  784, .api = &autotest_qpacketmodem_unmod_qam256,                .name = "qpacketmodem_unmod_qam256"},
+    {.id =  785, .api = &autotest_qpacketmodem_copy,                        .name = "qpacketmodem_copy"},
+    {.id =  786, .api = &autotest_qpilotsync_100_16,                        .name = "qpilotsync_100_16"},
+    {.id =  787, .api = &autotest_qpilotsync_200_20,                        .name = "qpilotsync_200_20"},
+    {.id =  788, .api = &autotest_qpilotsync_300_24,                        .name = "qpilotsync_300_24"},
+    {.id =  789, .api = &autotest_qpilotsync_400_28,                        .name = "qpilotsync_400_28"},
+    {.id =  790, .api = &autotest_qpilotsync_500_32,                        .name = "qpilotsync_500_32"},
+    {.id =  791, .api = &autotest_qpilotgen_config,                         .name = "qpilotgen_config"},
+    {.id =  792, .api = &autotest_qpilotsync_config,                        .name = "qpilotsync_config"},
+    {.id =  793, .api = &autotest_qsourcecf_config,                         .name = "qsourcecf_config"},
+    {.id =  794, .api = &autotest_symstreamcf_psd_k2_m12_b030,              .name = "symstreamcf_psd_k2_m12_b030"},
+    {.id =  795, .api = &autotest_symstreamcf_psd_k4_m12_b030,              .name = "symstreamcf_psd_k4_m12_b030"},
+    {.id =  796, .api = &autotest_symstreamcf_psd_k4_m25_b020,              .name = "symstreamcf_psd_k4_m25_b020"},
+    {.id =  797, .api = &autotest_symstreamcf_psd_k7_m11_b035,              .name = "symstreamcf_psd_k7_m11_b035"},
+    {.id =  798, .api = &autotest_symstreamcf_copy,                         .name = "symstreamcf_copy"},
+    {.id =  799, .api = &autotest_symstreamcf_delay_00,                     .name = "symstreamcf_delay_00"},
+    {.id =  800, .api = &autotest_symstreamcf_delay_01,                     .name = "symstreamcf_delay_01"},
+    {.id =  801, .api = &autotest_symstreamcf_delay_02,                     .name = "symstreamcf_delay_02"},
+    {.id =  802, .api = &autotest_symstreamcf_delay_03,                     .name = "symstreamcf_delay_03"},
+    {.id =  803, .api = &autotest_symstreamcf_delay_04,                     .name = "symstreamcf_delay_04"},
+    {.id =  804, .api = &autotest_symstreamcf_delay_05,                     .name = "symstreamcf_delay_05"},
+    {.id =  805, .api = &autotest_symstreamcf_delay_06,                     .name = "symstreamcf_delay_06"},
+    {.id =  806, .api = &autotest_symstreamcf_delay_07,                     .name = "symstreamcf_delay_07"},
+    {.id =  807, .api = &autotest_symstreamcf_delay_08,                     .name = "symstreamcf_delay_08"},
+    {.id =  808, .api = &autotest_symstreamcf_delay_09,                     .name = "symstreamcf_delay_09"},
+    {.id =  809, .api = &autotest_symstreamcf_delay_10,                     .name = "symstreamcf_delay_10"},
+    {.id =  810, .api = &autotest_symstreamcf_delay_11,                     .name = "symstreamcf_delay_11"},
+    {.id =  811, .api = &autotest_symstreamcf_delay_12,                     .name = "symstreamcf_delay_12"},
+    {.id =  812, .api = &autotest_symstreamcf_delay_13,                     .name = "symstreamcf_delay_13"},
+    {.id =  813, .api = &autotest_symstreamcf_delay_14,                     .name = "symstreamcf_delay_14"},
+    {.id =  814, .api = &autotest_symstreamcf_delay_15,                     .name = "symstreamcf_delay_15"},
+    {.id =  815, .api = &autotest_symstreamcf_delay_16,                     .name = "symstreamcf_delay_16"},
+    {.id =  816, .api = &autotest_symstreamcf_delay_17,                     .name = "symstreamcf_delay_17"},
+    {.id =  817, .api = &autotest_symstreamcf_delay_18,                     .name = "symstreamcf_delay_18"},
+    {.id =  818, .api = &autotest_symstreamcf_delay_19,                     .name = "symstreamcf_delay_19"},
+    {.id =  819, .api = &autotest_symstreamrcf_psd_bw200_m12_b030,          .name = "symstreamrcf_psd_bw200_m12_b030"},
+    {.id =  820, .api = &autotest_symstreamrcf_psd_bw400_m12_b030,          .name = "symstreamrcf_psd_bw400_m12_b030"},
+    {.id =  821, .api = &autotest_symstreamrcf_psd_bw400_m25_b020,          .name = "symstreamrcf_psd_bw400_m25_b020"},
+    {.id =  822, .api = &autotest_symstreamrcf_psd_bw700_m11_b035,          .name = "symstreamrcf_psd_bw700_m11_b035"},
+    {.id =  823, .api = &autotest_symstreamrcf_copy,                        .name = "symstreamrcf_copy"},
+    {.id =  824, .api = &autotest_symstreamrcf_delay_00,                    .name = "symstreamrcf_delay_00"},
+    {.id =  825, .api = &autotest_symstreamrcf_delay_01,                    .name = "symstreamrcf_delay_01"},
+    {.id =  826, .api = &autotest_symstreamrcf_delay_02,                    .name = "symstreamrcf_delay_02"},
+    {.id =  827, .api = &autotest_symstreamrcf_delay_03,                    .name = "symstreamrcf_delay_03"},
+    {.id =  828, .api = &autotest_symstreamrcf_delay_04,                    .name = "symstreamrcf_delay_04"},
+    {.id =  829, .api = &autotest_symstreamrcf_delay_05,                    .name = "symstreamrcf_delay_05"},
+    {.id =  830, .api = &autotest_symstreamrcf_delay_06,                    .name = "symstreamrcf_delay_06"},
+    {.id =  831, .api = &autotest_symstreamrcf_delay_07,                    .name = "symstreamrcf_delay_07"},
+    {.id =  832, .api = &autotest_symstreamrcf_delay_08,                    .name = "symstreamrcf_delay_08"},
+    {.id =  833, .api = &autotest_symstreamrcf_delay_09,                    .name = "symstreamrcf_delay_09"},
+    {.id =  834, .api = &autotest_symstreamrcf_delay_10,                    .name = "symstreamrcf_delay_10"},
+    {.id =  835, .api = &autotest_symstreamrcf_delay_11,                    .name = "symstreamrcf_delay_11"},
+    {.id =  836, .api = &autotest_symstreamrcf_delay_12,                    .name = "symstreamrcf_delay_12"},
+    {.id =  837, .api = &autotest_symstreamrcf_delay_13,                    .name = "symstreamrcf_delay_13"},
+    {.id =  838, .api = &autotest_symstreamrcf_delay_14,                    .name = "symstreamrcf_delay_14"},
+    {.id =  839, .api = &autotest_symstreamrcf_delay_15,                    .name = "symstreamrcf_delay_15"},
+    {.id =  840, .api = &autotest_symstreamrcf_delay_16,                    .name = "symstreamrcf_delay_16"},
+    {.id =  841, .api = &autotest_symstreamrcf_delay_17,                    .name = "symstreamrcf_delay_17"},
+    {.id =  842, .api = &autotest_symstreamrcf_delay_18,                    .name = "symstreamrcf_delay_18"},
+    {.id =  843, .api = &autotest_symstreamrcf_delay_19,                    .name = "symstreamrcf_delay_19"},
+    {.id =  844, .api = &autotest_symtrack_cccf_bpsk,                       .name = "symtrack_cccf_bpsk"},
+    {.id =  845, .api = &autotest_symtrack_cccf_qpsk,                       .name = "symtrack_cccf_qpsk"},
+    {.id =  846, .api = &autotest_symtrack_cccf_config_invalid,             .name = "symtrack_cccf_config_invalid"},
+    {.id =  847, .api = &autotest_symtrack_cccf_config_valid,               .name = "symtrack_cccf_config_valid"},
+    {.id =  848, .api = &autotest_gcd_one,                                  .name = "gcd_one"},
+    {.id =  849, .api = &autotest_gcd_edge_cases,                           .name = "gcd_edge_cases"},
+    {.id =  850, .api = &autotest_gcd_base,                                 .name = "gcd_base"},
+    {.id =  851, .api = &autotest_window_hamming,                           .name = "window_hamming"},
+    {.id =  852, .api = &autotest_window_hann,                              .name = "window_hann"},
+    {.id =  853, .api = &autotest_window_blackmanharris,                    .name = "window_blackmanharris"},
+    {.id =  854, .api = &autotest_window_blackmanharris7,                   .name = "window_blackmanharris7"},
+    {.id =  855, .api = &autotest_window_kaiser,                            .name = "window_kaiser"},
+    {.id =  856, .api = &autotest_window_flattop,                           .name = "window_flattop"},
+    {.id =  857, .api = &autotest_window_triangular,                        .name = "window_triangular"},
+    {.id =  858, .api = &autotest_window_rcostaper,                         .name = "window_rcostaper"},
+    {.id =  859, .api = &autotest_window_kbd,                               .name = "window_kbd"},
+    {.id =  860, .api = &autotest_kbd_n16,                                  .name = "kbd_n16"},
+    {.id =  861, .api = &autotest_kbd_n32,                                  .name = "kbd_n32"},
+    {.id =  862, .api = &autotest_kbd_n48,                                  .name = "kbd_n48"},
+    {.id =  863, .api = &autotest_window_config,                            .name = "window_config"},
+    {.id =  864, .api = &autotest_Q,                                        .name = "Q"},
+    {.id =  865, .api = &autotest_sincf,                                    .name = "sincf"},
+    {.id =  866, .api = &autotest_nextpow2,                                 .name = "nextpow2"},
+    {.id =  867, .api = &autotest_math_config,                              .name = "math_config"},
+    {.id =  868, .api = &autotest_lnbesselif,                               .name = "lnbesselif"},
+    {.id =  869, .api = &autotest_besselif,                                 .name = "besselif"},
+    {.id =  870, .api = &autotest_besseli0f,                                .name = "besseli0f"},
+    {.id =  871, .api = &autotest_besseljf,                                 .name = "besseljf"},
+    {.id =  872, .api = &autotest_besselj0f,                                .name = "besselj0f"},
+    {.id =  873, .api = &autotest_gamma,                                    .name = "gamma"},
+    {.id =  874, .api = &autotest_lngamma,                                  .name = "lngamma"},
+    {.id =  875, .api = &autotest_uppergamma,                               .name = "uppergamma"},
+    {.id =  876, .api = &autotest_factorial,                                .name = "factorial"},
+    {.id =  877, .api = &autotest_nchoosek,                                 .name = "nchoosek"},
+    {.id =  878, .api = &autotest_cexpf,                                    .name = "cexpf"},
+    {.id =  879, .api = &autotest_clogf,                                    .name = "clogf"},
+    {.id =  880, .api = &autotest_csqrtf,                                   .name = "csqrtf"},
+    {.id =  881, .api = &autotest_casinf,                                   .name = "casinf"},
+    {.id =  882, .api = &autotest_cacosf,                                   .name = "cacosf"},
+    {.id =  883, .api = &autotest_catanf,                                   .name = "catanf"},
+    {.id =  884, .api = &autotest_vmath_sincos_exact,                       .name = "vmath_sincos_exact"},
+    {.id =  885, .api = &autotest_vmath_sincos_precise,                     .name = "vmath_sincos_precise"},
+    {.id =  886, .api = &autotest_vmath_sincos_fast,                        .name = "vmath_sincos_fast"},
+    {.id =  887, .api = &autotest_vmath_cexpj_exact,                        .name = "vmath_cexpj_exact"},
+    {.id =  888, .api = &autotest_vmath_cexpj_precise,                      .name = "vmath_cexpj_precise"},
+    {.id =  889, .api = &autotest_vmath_cexpj_fast,                         .name = "vmath_cexpj_fast"},
+    {.id =  890, .api = &autotest_vmath_atan2_exact,                        .name = "vmath_atan2_exact"},
+    {.id =  891, .api = &autotest_vmath_atan2_precise,                      .name = "vmath_atan2_precise"},
+    {.id =  892, .api = &autotest_vmath_atan2_fast,                         .name = "vmath_atan2_fast"},
+    {.id =  893, .api = &autotest_vmath_exp_exact,                          .name = "vmath_exp_exact"},
+    {.id =  894, .api = &autotest_vmath_exp_precise,                        .name = "vmath_exp_precise"},
+    {.id =  895, .api = &autotest_vmath_exp_fast,                           .name = "vmath_exp_fast"},
+    {.id =  896, .api = &autotest_vmath_log_exact,                          .name = "vmath_log_exact"},
+    {.id =  897, .api = &autotest_vmath_log_precise,                        .name = "vmath_log_precise"},
+    {.id =  898, .api = &autotest_vmath_log_fast,                           .name = "vmath_log_fast"},
+    {.id =  899, .api = &autotest_vmath_log10_exact,                        .name = "vmath_log10_exact"},
+    {.id =  900, .api = &autotest_vmath_log10_precise,                      .name = "vmath_log10_precise"},
+    {.id =  901, .api = &autotest_vmath_log10_fast,                         .name = "vmath_log10_fast"},
+    {.id =  902, .api = &autotest_vmath_special,                            .name = "vmath_special"},
+    {.id =  903, .api = &autotest_vmath_inplace,                            .name = "vmath_inplace"},
+    {.id =  904, .api = &autotest_vmath_config,                             .name = "vmath_config"},
+    {.id =  905, .api = &autotest_polyf_fit_q3n3,                           .name = "polyf_fit_q3n3"},
+    {.id =  906, .api = &autotest_polyf_lagrange_issue165,                  .name = "polyf_lagrange_issue165"},
+    {.id =  907, .api = &autotest_polyf_lagrange,                           .name = "polyf_lagrange"},
+    {.id =  908, .api = &autotest_polyf_expandroots_4,                      .name = "polyf_expandroots_4"},
+    {.id =  909, .api = &autotest_polyf_expandroots_11,                     .name = "polyf_expandroots_11"},
+    {.id =  910, .api = &autotest_polycf_expandroots_4,                     .name = "polycf_expandroots_4"},
+    {.id =  911, .api = &autotest_polyf_expandroots2_3,                     .name = "polyf_expandroots2_3"},
+    {.id =  912, .api = &autotest_polyf_mul_2_3,                            .name = "polyf_mul_2_3"},
+    {.id =  913, .api = &autotest_poly_expandbinomial_n6,                   .name = "poly_expandbinomial_n6"},
+    {.id =  914, .api = &autotest_poly_binomial_expand_pm_m6_k1,            .name = "poly_binomial_expand_pm_m6_k1"},
+    {.id =  915, .api = &autotest_poly_expandbinomial_pm_m5_k2,             .name = "poly_expandbinomial_pm_m5_k2"},
+    {.id =  916, .api = &autotest_polyf_findroots_real,                     .name = "polyf_findroots_real"},
+    {.id =  917, .api = &autotest_polyf_findroots_complex,                  .name = "polyf_findroots_complex"},
+    {.id =  918, .api = &autotest_polyf_findroots_mix,                      .name = "polyf_findroots_mix"},
+    {.id =  919, .api = &autotest_polyf_findroots_mix2,                     .name = "polyf_findroots_mix2"},
+    {.id =  920, .api = &autotest_prime_small,                              .name = "prime_small"},
+    {.id =  921, .api = &autotest_factors,                                  .name = "factors"},
+    {.id =  922, .api = &autotest_totient,                                  .name = "totient"},
+    {.id =  923, .api = &autotest_matrixcf_add,                             .name = "matrixcf_add"},
+    {.id =  924, .api = &autotest_matrixcf_aug,                             .name = "matrixcf_aug"},
+    {.id =  925, .api = &autotest_matrixcf_chol,                            .name = "matrixcf_chol"},
+    {.id =  926, .api = &autotest_matrixcf_inv,                             .name = "matrixcf_inv"},
+    {.id =  927, .api = &autotest_matrixcf_linsolve,                        .name = "matrixcf_linsolve"},
+    {.id =  928, .api = &autotest_matrixcf_ludecomp_crout,                  .name = "matrixcf_ludecomp_crout"},
+    {.id =  929, .api = &autotest_matrixcf_ludecomp_doolittle,              .name = "matrixcf_ludecomp_doolittle"},
+    {.id =  930, .api = &autotest_matrixcf_mul,                             .name = "matrixcf_mul"},
+    {.id =  931, .api = &autotest_matrixcf_qrdecomp,                        .name = "matrixcf_qrdecomp"},
+    {.id =  932, .api = &autotest_matrixcf_transmul,                        .name = "matrixcf_transmul"},
+    {.id =  933, .api = &autotest_matrixcf_mul_blocked,                     .name = "matrixcf_mul_blocked"},
+    {.id =  934, .api = &autotest_matrixcf_transmul_blocked,                .name = "matrixcf_transmul_blocked"},
+    {.id =  935, .api = &autotest_matrixcf_lusolve,                         .name = "matrixcf_lusolve"},
+    {.id =  936, .api = &autotest_matrixcf_lufactor_singular,               .name = "matrixcf_lufactor_singular"},
+    {.id =  937, .api = &autotest_matrixcf_cholsolve,                       .name = "matrixcf_cholsolve"},
+    {.id =  938, .api = &autotest_matrixf_add,                              .name = "matrixf_add"},
+    {.id =  939, .api = &autotest_matrixf_aug,                              .name = "matrixf_aug"},
+    {.id =  940, .api = &autotest_matrixf_cgsolve,                          .name = "matrixf_cgsolve"},
+    {.id =  941, .api = &autotest_matrixf_chol,                             .name = "matrixf_chol"},
+    {.id =  942, .api = &autotest_matrixf_gramschmidt,                      .name = "matrixf_gramschmidt"},
+    {.id =  943, .api = &autotest_matrixf_inv,                              .name = "matrixf_inv"},
+    {.id =  944, .api = &autotest_matrixf_linsolve,                         .name = "matrixf_linsolve"},
+    {.id =  945, .api = &autotest_matrixf_ludecomp_crout,                   .name = "matrixf_ludecomp_crout"},
+    {.id =  946, .api = &autotest_matrixf_ludecomp_doolittle,               .name = "matrixf_ludecomp_doolittle"},
+    {.id =  947, .api = &autotest_matrixf_mul,                              .name = "matrixf_mul"},
+    {.id =  948, .api = &autotest_matrixf_qrdecomp,                         .name = "matrixf_qrdecomp"},
+    {.id =  949, .api = &autotest_matrixf_transmul,                         .name = "matrixf_transmul"},
+    {.id =  950, .api = &autotest_matrixf_mul_blocked,                      .name = "matrixf_mul_blocked"},
+    {.id =  951, .api = &autotest_matrixf_lusolve,                          .name = "matrixf_lusolve"},
+    {.id =  952, .api = &autotest_smatrixb_vmul,                            .name = "smatrixb_vmul"},
+    {.id =  953, .api = &autotest_smatrixb_mul,                             .name = "smatrixb_mul"},
+    {.id =  954, .api = &autotest_smatrixb_mulf,                            .name = "smatrixb_mulf"},
+    {.id =  955, .api = &autotest_smatrixb_vmulf,                           .name = "smatrixb_vmulf"},
+    {.id =  956, .api = &autotest_smatrixf_vmul,                            .name = "smatrixf_vmul"},
+    {.id =  957, .api = &autotest_smatrixf_mul,                             .name = "smatrixf_mul"},
+    {.id =  958, .api = &autotest_smatrixi_vmul,                            .name = "smatrixi_vmul"},
+    {.id =  959, .api = &autotest_smatrixi_mul,                             .name = "smatrixi_mul"},
+    {.id =  960, .api = &autotest_ampmodem_dsb_carrier_on,                  .name = "ampmodem_dsb_carrier_on"},
+    {.id =  961, .api = &autotest_ampmodem_usb_carrier_on,                  .name = "ampmodem_usb_carrier_on"},
+    {.id =  962, .api = &autotest_ampmodem_lsb_carrier_on,                  .name = "ampmodem_lsb_carrier_on"},
+    {.id =  963, .api = &autotest_ampmodem_dsb_carrier_off,                 .name = "ampmodem_dsb_carrier_off"},
+    {.id =  964, .api = &autotest_ampmodem_usb_carrier_off,                 .name = "ampmodem_usb_carrier_off"},
+    {.id =  965, .api = &autotest_ampmodem_lsb_carrier_off,                 .name = "ampmodem_lsb_carrier_off"},
+    {.id =  966, .api = &autotest_ampmodem_block_dsb_carrier_on,            .name = "ampmodem_block_dsb_carrier_on"},
+    {.id =  967, .api = &autotest_ampmodem_block_usb_carrier_on,            .name = "ampmodem_block_usb_carrier_on"},
+    {.id =  968, .api = &autotest_ampmodem_block_lsb_carrier_on,            .name = "ampmodem_block_lsb_carrier_on"},
+    {.id =  969, .api = &autotest_ampmodem_block_dsb_carrier_off,           .name = "ampmodem_block_dsb_carrier_off"},
+    {.id =  970, .api = &autotest_ampmodem_block_usb_carrier_off,           .name = "ampmodem_block_usb_carrier_off"},
+    {.id =  971, .api = &autotest_ampmodem_block_lsb_carrier_off,           .name = "ampmodem_block_lsb_carrier_off"},
+    {.id =  972, .api = &autotest_cpfskmodem_bps1_h0p5000_k4_m3_square,     .name = "cpfskmodem_bps1_h0p5000_k4_m3_square"},
+    {.id =  973, .api = &autotest_cpfskmodem_bps1_h0p0250_k4_m3_square,     .name = "cpfskmodem_bps1_h0p0250_k4_m3_square"},
+    {.id =  974, .api = &autotest_cpfskmodem_bps1_h0p1250_k4_m3_square,     .name = "cpfskmodem_bps1_h0p1250_k4_m3_square"},
+    {.id =  975, .api = &autotest_cpfskmodem_bps1_h0p0625_k4_m3_square,     .name = "cpfskmodem_bps1_h0p0625_k4_m3_square"},
+    {.id =  976, .api = &autotest_cpfskmodem_bps1_h0p5000_k4_m3_rcosfull,   .name = "cpfskmodem_bps1_h0p5000_k4_m3_rcosfull"},
+    {.id =  977, .api = &autotest_cpfskmodem_bps1_h0p0250_k4_m3_rcosfull,   .name = "cpfskmodem_bps1_h0p0250_k4_m3_rcosfull"},
+    {.id =  978, .api = &autotest_cpfskmodem_bps1_h0p1250_k4_m3_rcosfull,   .name = "cpfskmodem_bps1_h0p1250_k4_m3_rcosfull"},
+    {.id =  979, .api = &autotest_cpfskmodem_bps1_h0p0625_k4_m3_rcosfull,   .name = "cpfskmodem_bps1_h0p0625_k4_m3_rcosfull"},
+    {.id =  980, .api = &autotest_cpfskmodem_bps1_h0p5000_k4_m3_rcospart,   .name = "cpfskmodem_bps1_h0p5000_k4_m3_rcospart"},
+    {.id =  981, .api = &autotest_cpfskmodem_bps1_h0p0250_k4_m3_rcospart,   .name = "cpfskmodem_bps1_h0p0250_k4_m3_rcospart"},
+    {.id =  982, .api = &autotest_cpfskmodem_bps1_h0p1250_k4_m3_rcospart,   .name = "cpfskmodem_bps1_h0p1250_k4_m3_rcospart"},
+    {.id =  983, .api = &autotest_cpfskmodem_bps1_h0p0625_k4_m3_rcospart,   .name = "cpfskmodem_bps1_h0p0625_k4_m3_rcospart"},
+    {.id =  984, .api = &autotest_cpfskmodem_bps1_h0p5000_k4_m3_gmsk,       .name = "cpfskmodem_bps1_h0p5000_k4_m3_gmsk"},
+    {.id =  985, .api = &autotest_cpfskmodem_bps1_h0p0250_k4_m3_gmsk,       .name = "cpfskmodem_bps1_h0p0250_k4_m3_gmsk"},
+    {.id =  986, .api = &autotest_cpfskmodem_bps1_h0p1250_k4_m3_gmsk,       .name = "cpfskmodem_bps1_h0p1250_k4_m3_gmsk"},
+    {.id =  987, .api = &autotest_cpfskmodem_bps1_h0p0625_k4_m3_gmsk,       .name = "cpfskmodem_bps1_h0p0625_k4_m3_gmsk"},
+    {.id =  988, .api = &autotest_cpfskmodem_bps2_h0p0250_k4_m3_square,     .name = "cpfskmodem_bps2_h0p0250_k4_m3_square"},
+    {.id =  989, .api = &autotest_cpfskmodem_bps3_h0p1250_k4_m3_square,     .name = "cpfskmodem_bps3_h0p1250_k4_m3_square"},
+    {.id =  990, .api = &autotest_cpfskmodem_bps4_h0p0625_k4_m3_square,     .name = "cpfskmodem_bps4_h0p0625_k4_m3_square"},
+    {.id =  991, .api = &autotest_cpfskmodem_bps1_h0p5_k2_m7_gmsk,          .name = "cpfskmodem_bps1_h0p5_k2_m7_gmsk"},
+    {.id =  992, .api = &autotest_cpfskmodem_bps1_h0p5_k4_m7_gmsk,          .name = "cpfskmodem_bps1_h0p5_k4_m7_gmsk"},
+    {.id =  993, .api = &autotest_cpfskmodem_bps1_h0p5_k6_m7_gmsk,          .name = "cpfskmodem_bps1_h0p5_k6_m7_gmsk"},
+    {.id =  994, .api = &autotest_cpfskmodem_bps1_h0p5_k8_m7_gmsk,          .name = "cpfskmodem_bps1_h0p5_k8_m7_gmsk"},
+    {.id =  995, .api = &autotest_cpfskmodem_coherent_bps1_h0p5_square,     .name = "cpfskmodem_coherent_bps1_h0p5_square"},
+    {.id =  996, .api = &autotest_cpfskmodem_coherent_bps1_h0p25_square,    .name = "cpfskmodem_coherent_bps1_h0p25_square"},
+    {.id =  997, .api = &autotest_cpfskmodem_coherent_bps1_h0p5_rcosfull,   .name = "cpfskmodem_coherent_bps1_h0p5_rcosfull"},
+    {.id =  998, .api = &autotest_cpfskmodem_coherent_bps1_h0p5_rcospart,   .name = "cpfskmodem_coherent_bps1_h0p5_rcospart"},
+    {.id =  999, .api = &autotest_cpfskmodem_coherent_bps1_h0p5_gmsk,       .name = "cpfskmodem_coherent_bps1_h0p5_gmsk"},
+    {.id = 1000, .api = &autotest_cpfskmodem_coherent_bps1_h0p5_k8_m7_gmsk, .name = "cpfskmodem_coherent_bps1_h0p5_k8_m7_gmsk"},
+    {.id = 1001, .api = &autotest_cpfskmodem_coherent_bps2_h0p25_square,    .name = "cpfskmodem_coherent_bps2_h0p25_square"},
+    {.id = 1002, .api = &autotest_cpfskmodem_coherent_sensitivity,          .name = "cpfskmodem_coherent_sensitivity"},
+    {.id = 1003, .api = &autotest_cpfskdem_block_noncoherent,               .name = "cpfskdem_block_noncoherent"},
+    {.id = 1004, .api = &autotest_cpfskdem_block_coherent,                  .name = "cpfskdem_block_coherent"},
+    {.id = 1005, .api = &autotest_cpfskmodem_spectrum,                      .name = "cpfskmodem_spectrum"},
+    {.id = 1006, .api = &autotest_cpfskmodem_config,                        .name = "cpfskmodem_config"},
+    {.id = 1007, .api = &autotest_freqmodem_kf_0_02,                        .name = "freqmodem_kf_0_02"},
+    {.id = 1008, .api = &autotest_freqmodem_kf_0_04,                        .name = "freqmodem_kf_0_04"},
+    {.id = 1009, .api = &autotest_freqmodem_kf_0_08,                        .name = "freqmodem_kf_0_08"},
+    {.id = 1010, .api = &autotest_freqdem_block_exact,                      .name = "freqdem_block_exact"},
+    {.id = 1011, .api = &autotest_freqdem_block_terms2,                     .name = "freqdem_block_terms2"},
+    {.id = 1012, .api = &autotest_freqdem_block_terms4,                     .name = "freqdem_block_terms4"},
+    {.id = 1013, .api = &autotest_freqdem_block_terms7,                     .name = "freqdem_block_terms7"},
+    {.id = 1014, .api = &autotest_freqdem_config,                           .name = "freqdem_config"},
+    {.id = 1015, .api = &autotest_fskmodem_norm_M2,                         .name = "fskmodem_norm_M2"},
+    {.id = 1016, .api = &autotest_fskmodem_norm_M4,                         .name = "fskmodem_norm_M4"},
+    {.id = 1017, .api = &autotest_fskmodem_norm_M8,                         .name = "fskmodem_norm_M8"},
+    {.id = 1018, .api = &autotest_fskmodem_norm_M16,                        .name = "fskmodem_norm_M16"},
+    {.id = 1019, .api = &autotest_fskmodem_norm_M32,                        .name = "fskmodem_norm_M32"},
+    {.id = 1020, .api = &autotest_fskmodem_norm_M64,                        .name = "fskmodem_norm_M64"},
+    {.id = 1021, .api = &autotest_fskmodem_norm_M128,                       .name = "fskmodem_norm_M128"},
+    {.id = 1022, .api = &autotest_fskmodem_norm_M256,                       .name = "fskmodem_norm_M256"},
+    {.id = 1023, .api = &autotest_fskmodem_norm_M512,                       .name = "fskmodem_norm_M512"},
+    {.id = 1024, .api = &autotest_fskmodem_norm_M1024,                      .name = "fskmodem_norm_M1024"},
+    {.id = 1025, .api = &autotest_fskmodem_misc_M2,                         .name = "fskmodem_misc_M2"},
+    {.id = 1026, .api = &autotest_fskmodem_misc_M4,                         .name = "fskmodem_misc_M4"},
+    {.id = 1027, .api = &autotest_fskmodem_misc_M8,                         .name = "fskmodem_misc_M8"},
+    {.id = 1028, .api = &autotest_fskmodem_misc_M16,                        .name = "fskmodem_misc_M16"},
+    {.id = 1029, .api = &autotest_fskmodem_misc_M32,                        .name = "fskmodem_misc_M32"},
+    {.id = 1030, .api = &autotest_fskmodem_misc_M64,                        .name = "fskmodem_misc_M64"},
+    {.id = 1031, .api = &autotest_fskmodem_misc_M128,                       .name = "fskmodem_misc_M128"},
+    {.id = 1032, .api = &autotest_fskmodem_misc_M256,                       .name = "fskmodem_misc_M256"},
+    {.id = 1033, .api = &autotest_fskmodem_misc_M512,                       .name = "fskmodem_misc_M512"},
+    {.id = 1034, .api = &autotest_fskmodem_misc_M1024,                      .name = "fskmodem_misc_M1024"},
+    {.id = 1035, .api = &autotest_fskmod_copy,                              .name = "fskmod_copy"},
+    {.id = 1036, .api = &autotest_fskdem_copy,                              .name = "fskdem_copy"},
+    {.id = 1037, .api = &autotest_fskdem_block_fft,                         .name = "fskdem_block_fft"},
+    {.id = 1038, .api = &autotest_fskdem_block_pruned,                      .name = "fskdem_block_pruned"},
+    {.id = 1039, .api = &autotest_fskdem_pruned,                            .name = "fskdem_pruned"},
+    {.id = 1040, .api = &autotest_gmskmodem_k4_m3_b025,                     .name = "gmskmodem_k4_m3_b025"},
+    {.id = 1041, .api = &autotest_gmskmodem_k2_m3_b025,                     .name = "gmskmodem_k2_m3_b025"},
+    {.id = 1042, .api = &autotest_gmskmodem_k3_m3_b025,                     .name = "gmskmodem_k3_m3_b025"},
+    {.id = 1043, .api = &autotest_gmskmodem_k5_m3_b025,                     .name = "gmskmodem_k5_m3_b025"},
+    {.id = 1044, .api = &autotest_gmskmodem_k8_m3_b033,                     .name = "gmskmodem_k8_m3_b033"},
+    {.id = 1045, .api = &autotest_gmskmodem_k4_m1_b025,                     .name = "gmskmodem_k4_m1_b025"},
+    {.id = 1046, .api = &autotest_gmskmodem_k4_m2_b025,                     .name = "gmskmodem_k4_m2_b025"},
+    {.id = 1047, .api = &autotest_gmskmodem_k4_m8_b025,                     .name = "gmskmodem_k4_m8_b025"},
+    {.id = 1048, .api = &autotest_gmskmodem_k4_m3_b020,                     .name = "gmskmodem_k4_m3_b020"},
+    {.id = 1049, .api = &autotest_gmskmodem_k4_m3_b033,                     .name = "gmskmodem_k4_m3_b033"},
+    {.id = 1050, .api = &autotest_gmskmodem_k4_m3_b050,                     .name = "gmskmodem_k4_m3_b050"},
+    {.id = 1051, .api = &autotest_gmskmod_copy,                             .name = "gmskmod_copy"},
+    {.id = 1052, .api = &autotest_gmskdem_copy,                             .name = "gmskdem_copy"},
+    {.id = 1053, .api = &autotest_gmskdem_block,                            .name = "gmskdem_block"},
+    {.id = 1054, .api = &autotest_mod_demod_psk2,                           .name = "mod_demod_psk2"},
+    {.id = 1055, .api = &autotest_mod_demod_psk4,                           .name = "mod_demod_psk4"},
+    {.id = 1056, .api = &autotest_mod_demod_psk8,                           .name = "mod_demod_psk8"},
+    {.id = 1057, .api = &autotest_mod_demod_psk16,                          .name = "mod_demod_psk16"},
+    {.id = 1058, .api = &autotest_mod_demod_psk32,                          .name = "mod_demod_psk32"},
+    {.id = 1059, .api = &autotest_mod_demod_psk64,                          .name = "mod_demod_psk64"},
+    {.id = 1060, .api = &autotest_mod_demod_psk128,                         .name = "mod_demod_psk128"},
+    {.id = 1061, .api = &autotest_mod_demod_psk256,                         .name = "mod_demod_psk256"},
+    {.id = 1062, .api = &autotest_mod_demod_dpsk2,                          .name = "mod_demod_dpsk2"},
+    {.id = 1063, .api = &autotest_mod_demod_dpsk4,                          .name = "mod_demod_dpsk4"},
+    {.id = 1064, .api = &autotest_mod_demod_dpsk8,                          .name = "mod_demod_dpsk8"},
+    {.id = 1065, .api = &autotest_mod_demod_dpsk16,                         .name = "mod_demod_dpsk16"},
+    {.id = 1066, .api = &autotest_mod_demod_dpsk32,                         .name = "mod_demod_dpsk32"},
+    {.id = 1067, .api = &autotest_mod_demod_dpsk64,                         .name = "mod_demod_dpsk64"},
+    {.id = 1068, .api = &autotest_mod_demod_dpsk128,                        .name = "mod_demod_dpsk128"},
+    {.id = 1069, .api = &autotest_mod_demod_dpsk256,                        .name = "mod_demod_dpsk256"},
+    {.id = 1070, .api = &autotest_mod_demod_ask2,                           .name = "mod_demod_ask2"},
+    {.id = 1071, .api = &autotest_mod_demod_ask4,                           .name = "mod_demod_ask4"},
+    {.id = 1072, .api = &autotest_mod_demod_ask8,                           .name = "mod_demod_ask8"},
+    {.id = 1073, .api = &autotest_mod_demod_ask16,                          .name = "mod_demod_ask16"},
+    {.id = 1074, .api = &autotest_mod_demod_ask32,                          .name = "mod_demod_ask32"},
+    {.id = 1075, .api = &autotest_mod_demod_ask64,                          .name = "mod_demod_ask64"},
+    {.id = 1076, .api = &autotest_mod_demod_ask128,                         .name = "mod_demod_ask128"},
+    {.id = 1077, .api = &autotest_mod_demod_ask256,                         .name = "mod_demod_ask256"},
+    {.id = 1078, .api = &autotest_mod_demod_qam4,                           .name = "mod_demod_qam4"},
+    {.id = 1079, .api = &autotest_mod_demod_qam8,                           .name = "mod_demod_qam8"},
+    {.id = 1080, .api = &autotest_mod_demod_qam16,                          .name = "mod_demod_qam16"},
+    {.id = 1081, .api = &autotest_mod_demod_qam32,                          .name = "mod_demod_qam32"},
+    {.id = 1082, .api = &autotest_mod_demod_qam64,                          .name = "mod_demod_qam64"},
+    {.id = 1083, .api = &autotest_mod_demod_qam128,                         .name = "mod_demod_qam128"},
+    {.id = 1084, .api = &autotest_mod_demod_qam256,                         .name = "mod_demod_qam256"},
+    {.id = 1085, .api = &autotest_mod_demod_apsk4,                          .name = "mod_demod_apsk4"},
+    {.id = 1086, .api = &autotest_mod_demod_apsk8,                          .name = "mod_demod_apsk8"},
+    {.id = 1087, .api = &autotest_mod_demod_apsk16,                         .name = "mod_demod_apsk16"},
+    {.id = 1088, .api = &autotest_mod_demod_apsk32,                         .name = "mod_demod_apsk32"},
+    {.id = 1089, .api = &autotest_mod_demod_apsk64,                         .name = "mod_demod_apsk64"},
+    {.id = 1090, .api = &autotest_mod_demod_apsk128,                        .name = "mod_demod_apsk128"},
+    {.id = 1091, .api = &autotest_mod_demod_apsk256,                        .name = "mod_demod_apsk256"},
+    {.id = 1092, .api = &autotest_mod_demod_bpsk,                           .name = "mod_demod_bpsk"},
+    {.id = 1093, .api = &autotest_mod_demod_qpsk,                           .name = "mod_demod_qpsk"},
+    {.id = 1094, .api = &autotest_mod_demod_ook,                            .name = "mod_demod_ook"},
+    {.id = 1095, .api = &autotest_mod_demod_sqam32,                         .name = "mod_demod_sqam32"},
+    {.id = 1096, .api = &autotest_mod_demod_sqam128,                        .name = "mod_demod_sqam128"},
+    {.id = 1097, .api = &autotest_mod_demod_V29,                            .name = "mod_demod_V29"},
+    {.id = 1098, .api = &autotest_mod_demod_arb16opt,                       .name = "mod_demod_arb16opt"},
+    {.id = 1099, .api = &autotest_mod_demod_arb32opt,                       .name = "mod_demod_arb32opt"},
+    {.id = 1100, .api = &autotest_mod_demod_arb64opt,                       .name = "mod_demod_arb64opt"},
+    {.id = 1101, .api = &autotest_mod_demod_arb128opt,                      .name = "mod_demod_arb128opt"},
+    {.id = 1102, .api = &autotest_mod_demod_arb256opt,                      .name = "mod_demod_arb256opt"},
+    {.id = 1103, .api = &autotest_mod_demod_arb64vt,                        .name = "mod_demod_arb64vt"},
+    {.id = 1104, .api = &autotest_mod_demod_pi4dqpsk,                       .name = "mod_demod_pi4dqpsk"},
+    {.id = 1105, .api = &autotest_modem_block_psk8,                         .name = "modem_block_psk8"},
+    {.id = 1106, .api = &autotest_modem_block_psk64,                        .name = "modem_block_psk64"},
+    {.id = 1107, .api = &autotest_modem_block_dpsk4,                        .name = "modem_block_dpsk4"},
+    {.id = 1108, .api = &autotest_modem_block_ask4,                         .name = "modem_block_ask4"},
+    {.id = 1109, .api = &autotest_modem_block_ask16,                        .name = "modem_block_ask16"},
+    {.id = 1110, .api = &autotest_modem_block_qam4,                         .name = "modem_block_qam4"},
+    {.id = 1111, .api = &autotest_modem_block_qam16,                        .name = "modem_block_qam16"},
+    {.id = 1112, .api = &autotest_modem_block_qam32,                        .name = "modem_block_qam32"},
+    {.id = 1113, .api = &autotest_modem_block_qam256,                       .name = "modem_block_qam256"},
+    {.id = 1114, .api = &autotest_modem_block_apsk16,                       .name = "modem_block_apsk16"},
+    {.id = 1115, .api = &autotest_modem_block_apsk64,                       .name = "modem_block_apsk64"},
+    {.id = 1116, .api = &autotest_modem_block_bpsk,                         .name = "modem_block_bpsk"},
+    {.id = 1117, .api = &autotest_modem_block_qpsk,                         .name = "modem_block_qpsk"},
+    {.id = 1118, .api = &autotest_modem_block_ook,                          .name = "modem_block_ook"},
+    {.id = 1119, .api = &autotest_modem_block_sqam32,                       .name = "modem_block_sqam32"},
+    {.id = 1120, .api = &autotest_modem_block_arb16opt,                     .name = "modem_block_arb16opt"},
+    {.id = 1121, .api = &autotest_modem_block_pi4dqpsk,                     .name = "modem_block_pi4dqpsk"},
+    {.id = 1122, .api = &autotest_modem_block_config,                       .name = "modem_block_config"},
+    {.id = 1123, .api = &autotest_modem_copy_psk2,                          .name = "modem_copy_psk2"},
+    {.id = 1124, .api = &autotest_modem_copy_psk4,                          .name = "modem_copy_psk4"},
+    {.id = 1125, .api = &autotest_modem_copy_psk8,                          .name = "modem_copy_psk8"},
+    {.id = 1126, .api = &autotest_modem_copy_psk16,                         .name = "modem_copy_psk16"},
+    {.id = 1127, .api = &autotest_modem_copy_psk32,                         .name = "modem_copy_psk32"},
+    {.id = 1128, .api = &autotest_modem_copy_psk64,                         .name = "modem_copy_psk64"},
+    {.id = 1129, .api = &autotest_modem_copy_psk128,                        .name = "modem_copy_psk128"},
+    {.id = 1130, .api = &autotest_modem_copy_psk256,                        .name = "modem_copy_psk256"},
+    {.id = 1131, .api = &autotest_modem_copy_dpsk2,                         .name = "modem_copy_dpsk2"},
+    {.id = 1132, .api = &autotest_modem_copy_dpsk4,                         .name = "modem_copy_dpsk4"},
+    {.id = 1133, .api = &autotest_modem_copy_dpsk8,                         .name = "modem_copy_dpsk8"},
+    {.id = 1134, .api = &autotest_modem_copy_dpsk16,                        .name = "modem_copy_dpsk16"},
+    {.id = 1135, .api = &autotest_modem_copy_dpsk32,                        .name = "modem_copy_dpsk32"},
+    {.id = 1136, .api = &autotest_modem_copy_dpsk64,                        .name = "modem_copy_dpsk64"},
+    {.id = 1137, .api = &autotest_modem_copy_dpsk128,                       .name = "modem_copy_dpsk128"},
+    {.id = 1138, .api = &autotest_modem_copy_dpsk256,                       .name = "modem_copy_dpsk256"},
+    {.id = 1139, .api = &autotest_modem_copy_ask2,                          .name = "modem_copy_ask2"},
+    {.id = 1140, .api = &autotest_modem_copy_ask4,                          .name = "modem_copy_ask4"},
+    {.id = 1141, .api = &autotest_modem_copy_ask8,                          .name = "modem_copy_ask8"},
+    {.id = 1142, .api = &autotest_modem_copy_ask16,                         .name = "modem_copy_ask16"},
+    {.id = 1143, .api = &autotest_modem_copy_ask32,                         .name = "modem_copy_ask32"},
+    {.id = 1144, .api = &autotest_modem_copy_ask64,                         .name = "modem_copy_ask64"},
+    {.id = 1145, .api = &autotest_modem_copy_ask128,                        .name = "modem_copy_ask128"},
+    {.id = 1146, .api = &autotest_modem_copy_ask256,                        .name = "modem_copy_ask256"},
+    {.id = 1147, .api = &autotest_modem_copy_qam4,                          .name = "modem_copy_qam4"},
+    {.id = 1148, .api = &autotest_modem_copy_qam8,                          .name = "modem_copy_qam8"},
+    {.id = 1149, .api = &autotest_modem_copy_qam16,                         .name = "modem_copy_qam16"},
+    {.id = 1150, .api = &autotest_modem_copy_qam32,                         .name = "modem_copy_qam32"},
+    {.id = 1151, .api = &autotest_modem_copy_qam64,                         .name = "modem_copy_qam64"},
+    {.id = 1152, .api = &autotest_modem_copy_qam128,                        .name = "modem_copy_qam128"},
+    {.id = 1153, .api = &autotest_modem_copy_qam256,                        .name = "modem_copy_qam256"},
+    {.id = 1154, .api = &autotest_modem_copy_apsk4,                         .name = "modem_copy_apsk4"},
+    {.id = 1155, .api = &autotest_modem_copy_apsk8,                         .name = "modem_copy_apsk8"},
+    {.id = 1156, .api = &autotest_modem_copy_apsk16,                        .name = "modem_copy_apsk16"},
+    {.id = 1157, .api = &autotest_modem_copy_apsk32,                        .name = "modem_copy_apsk32"},
+    {.id = 1158, .api = &autotest_modem_copy_apsk64,                        .name = "modem_copy_apsk64"},
+    {.id = 1159, .api = &autotest_modem_copy_apsk128,                       .name = "modem_copy_apsk128"},
+    {.id = 1160, .api = &autotest_modem_copy_apsk256,                       .name = "modem_copy_apsk256"},
+    {.id = 1161, .api = &autotest_modem_copy_bpsk,                          .name = "modem_copy_bpsk"},
+    {.id = 1162, .api = &autotest_modem_copy_qpsk,                          .name = "modem_copy_qpsk"},
+    {.id = 1163, .api = &autotest_modem_copy_ook,                           .name = "modem_copy_ook"},
+    {.id = 1164, .api = &autotest_modem_copy_sqam32,                        .name = "modem_copy_sqam32"},
+    {.id = 1165, .api = &autotest_modem_copy_sqam128,                       .name = "modem_copy_sqam128"},
+    {.id = 1166, .api = &autotest_modem_copy_V29,                           .name = "modem_copy_V29"},
+    {.id = 1167, .api = &autotest_modem_copy_arb16opt,                      .name = "modem_copy_arb16opt"},
+    {.id = 1168, .api = &autotest_modem_copy_arb32opt,                      .name = "modem_copy_arb32opt"},
+    {.id = 1169, .api = &autotest_modem_copy_arb64opt,                      .name = "modem_copy_arb64opt"},
+    {.id = 1170, .api = &autotest_modem_copy_arb128opt,                     .name = "modem_copy_arb128opt"},
+    {.id = 1171, .api = &autotest_modem_copy_arb256opt,                     .name = "modem_copy_arb256opt"},
+    {.id = 1172, .api = &autotest_modem_copy_arb64vt,                       .name = "modem_copy_arb64vt"},
+    {.id = 1173, .api = &autotest_modem_copy_pi4dqpsk,                      .name = "modem_copy_pi4dqpsk"},
+    {.id = 1174, .api = &autotest_modem_config,                             .name = "modem_config"},
+    {.id = 1175, .api = &autotest_demodsoft_psk2,                           .name = "demodsoft_psk2"},
+    {.id = 1176, .api = &autotest_demodsoft_psk4,                           .name = "demodsoft_psk4"},
+    {.id = 1177, .api = &autotest_demodsoft_psk8,                           .name = "demodsoft_psk8"},
+    {.id = 1178, .api = &autotest_demodsoft_psk16,                          .name = "demodsoft_psk16"},
+    {.id = 1179, .api = &autotest_demodsoft_psk32,                          .name = "demodsoft_psk32"},
+    {.id = 1180, .api = &autotest_demodsoft_psk64,                          .name = "demodsoft_psk64"},
+    {.id = 1181, .api = &autotest_demodsoft_psk128,                         .name = "demodsoft_psk128"},
+    {.id = 1182, .api = &autotest_demodsoft_psk256,                         .name = "demodsoft_psk256"},
+    {.id = 1183, .api = &autotest_demodsoft_dpsk2,                          .name = "demodsoft_dpsk2"},
+    {.id = 1184, .api = &autotest_demodsoft_dpsk4,                          .name = "demodsoft_dpsk4"},
+    {.id = 1185, .api = &autotest_demodsoft_dpsk8,                          .name = "demodsoft_dpsk8"},
+    {.id = 1186, .api = &autotest_demodsoft_dpsk16,                         .name = "demodsoft_dpsk16"},
+    {.id = 1187, .api = &autotest_demodsoft_dpsk32,                         .name = "demodsoft_dpsk32"},
+    {.id = 1188, .api = &autotest_demodsoft_dpsk64,                         .name = "demodsoft_dpsk64"},
+    {.id = 1189, .api = &autotest_demodsoft_dpsk128,                        .name = "demodsoft_dpsk128"},
+    {.id = 1190, .api = &autotest_demodsoft_dpsk256,                        .name = "demodsoft_dpsk256"},
+    {.id = 1191, .api = &autotest_demodsoft_ask2,                           .name = "demodsoft_ask2"},
+    {.id = 1192, .api = &autotest_demodsoft_ask4,                           .name = "demodsoft_ask4"},
+    {.id = 1193, .api = &autotest_demodsoft_ask8,                           .name = "demodsoft_ask8"},
+    {.id = 1194, .api = &autotest_demodsoft_ask16,                          .name = "demodsoft_ask16"},
+    {.id = 1195, .api = &autotest_demodsoft_ask32,                          .name = "demodsoft_ask32"},
+    {.id = 1196, .api = &autotest_demodsoft_ask64,                          .name = "demodsoft_ask64"},
+    {.id = 1197, .api = &autotest_demodsoft_ask128,                         .name = "demodsoft_ask128"},
+    {.id = 1198, .api = &autotest_demodsoft_ask256,                         .name = "demodsoft_ask256"},
+    {.id = 1199, .api = &autotest_demodsoft_qam4,                           .name = "demodsoft_qam4"},
+    {.id = 1200, .api = &autotest_demodsoft_qam8,                           .name = "demodsoft_qam8"},
+    {.id = 1201, .api = &autotest_demodsoft_qam16,                          .name = "demodsoft_qam16"},
+    {.id = 1202, .api = &autotest_demodsoft_qam32,                          .name = "demodsoft_qam32"},
+    {.id = 1203, .api = &autotest_demodsoft_qam64,                          .name = "demodsoft_qam64"},
+    {.id = 1204, .api = &autotest_demodsoft_qam128,                         .name = "demodsoft_qam128"},
+    {.id = 1205, .api = &autotest_demodsoft_qam256,                         .name = "demodsoft_qam256"},
+    {.id = 1206, .api = &autotest_demodsoft_apsk4,                          .name = "demodsoft_apsk4"},
+    {.id = 1207, .api = &autotest_demodsoft_apsk8,                          .name = "demodsoft_apsk8"},
+    {.id = 1208, .api = &autotest_demodsoft_apsk16,                         .name = "demodsoft_apsk16"},
+    {.id = 1209, .api = &autotest_demodsoft_apsk32,                         .name = "demodsoft_apsk32"},
+    {.id = 1210, .api = &autotest_demodsoft_apsk64,                         .name = "demodsoft_apsk64"},
+    {.id = 1211, .api = &autotest_demodsoft_apsk128,                        .name = "demodsoft_apsk128"},
+    {.id = 1212, .api = &autotest_demodsoft_apsk256,                        .name = "demodsoft_apsk256"},
+    {.id = 1213, .api = &autotest_demodsoft_bpsk,                           .name = "demodsoft_bpsk"},
+    {.id = 1214, .api = &autotest_demodsoft_qpsk,                           .name = "demodsoft_qpsk"},
+    {.id = 1215, .api = &autotest_demodsoft_ook,                            .name = "demodsoft_ook"},
+    {.id = 1216, .api = &autotest_demodsoft_sqam32,                         .name = "demodsoft_sqam32"},
+    {.id = 1217, .api = &autotest_demodsoft_sqam128,                        .name = "demodsoft_sqam128"},
+    {.id = 1218, .api = &autotest_demodsoft_V29,                            .name = "demodsoft_V29"},
+    {.id = 1219, .api = &autotest_demodsoft_arb16opt,                       .name = "demodsoft_arb16opt"},
+    {.id = 1220, .api = &autotest_demodsoft_arb32opt,                       .name = "demodsoft_arb32opt"},
+    {.id = 1221, .api = &autotest_demodsoft_arb64opt,                       .name = "demodsoft_arb64opt"},
+    {.id = 1222, .api = &autotest_demodsoft_arb128opt,                      .name = "demodsoft_arb128opt"},
+    {.id = 1223, .api = &autotest_demodsoft_arb256opt,                      .name = "demodsoft_arb256opt"},
+    {.id = 1224, .api = &autotest_demodsoft_arb64vt,                        .name = "demodsoft_arb64vt"},
+    {.id = 1225, .api = &autotest_demodsoft_pi4dqpsk,                       .name = "demodsoft_pi4dqpsk"},
+    {.id = 1226, .api = &autotest_demodstats_psk2,                          .name = "demodstats_psk2"},
+    {.id = 1227, .api = &autotest_demodstats_psk4,                          .name = "demodstats_psk4"},
+    {.id = 1228, .api = &autotest_demodstats_psk8,                          .name = "demodstats_psk8"},
+    {.id = 1229, .api = &autotest_demodstats_psk16,                         .name = "demodstats_psk16"},
+    {.id = 1230, .api = &autotest_demodstats_psk32,                         .name = "demodstats_psk32"},
+    {.id = 1231, .api = &autotest_demodstats_psk64,                         .name = "demodstats_psk64"},
+    {.id = 1232, .api = &autotest_demodstats_psk128,                        .name = "demodstats_psk128"},
+    {.id = 1233, .api = &autotest_demodstats_psk256,                        .name = "demodstats_psk256"},
+    {.id = 1234, .api = &autotest_demodstats_dpsk2,                         .name = "demodstats_dpsk2"},
+    {.id = 1235, .api = &autotest_demodstats_dpsk4,                         .name = "demodstats_dpsk4"},
+    {.id = 1236, .api = &autotest_demodstats_dpsk8,                         .name = "demodstats_dpsk8"},
+    {.id = 1237, .api = &autotest_demodstats_dpsk16,                        .name = "demodstats_dpsk16"},
+    {.id = 1238, .api = &autotest_demodstats_dpsk32,                        .name = "demodstats_dpsk32"},
+    {.id = 1239, .api = &autotest_demodstats_dpsk64,                        .name = "demodstats_dpsk64"},
+    {.id = 1240, .api = &autotest_demodstats_dpsk128,                       .name = "demodstats_dpsk128"},
+    {.id = 1241, .api = &autotest_demodstats_dpsk256,                       .name = "demodstats_dpsk256"},
+    {.id = 1242, .api = &autotest_demodstats_ask2,                          .name = "demodstats_ask2"},
+    {.id = 1243, .api = &autotest_demodstats_ask4,                          .name = "demodstats_ask4"},
+    {.id = 1244, .api = &autotest_demodstats_ask8,                          .name = "demodstats_ask8"},
+    {.id = 1245, .api = &autotest_demodstats_ask16,                         .name = "demodstats_ask16"},
+    {.id = 1246, .api = &autotest_demodstats_ask32,                         .name = "demodstats_ask32"},
+    {.id = 1247, .api = &autotest_demodstats_ask64,                         .name = "demodstats_ask64"},
+    {.id = 1248, .api = &autotest_demodstats_ask128,                        .name = "demodstats_ask128"},
+    {.id = 1249, .api = &autotest_demodstats_ask256,                        .name = "demodstats_ask256"},
+    {.id = 1250, .api = &autotest_demodstats_qam4,                          .name = "demodstats_qam4"},
+    {.id = 1251, .api = &autotest_demodstats_qam8,                          .name = "demodstats_qam8"},
+    {.id = 1252, .api = &autotest_demodstats_qam16,                         .name = "demodstats_qam16"},
+    {.id = 1253, .api = &autotest_demodstats_qam32,                         .name = "demodstats_qam32"},
+    {.id = 1254, .api = &autotest_demodstats_qam64,                         .name = "demodstats_qam64"},
+    {.id = 1255, .api = &autotest_demodstats_qam128,                        .name = "demodstats_qam128"},
+    {.id = 1256, .api = &autotest_demodstats_qam256,                        .name = "demodstats_qam256"},
+    {.id = 1257, .api = &autotest_demodstats_apsk4,                         .name = "demodstats_apsk4"},
+    {.id = 1258, .api = &autotest_demodstats_apsk8,                         .name = "demodstats_apsk8"},
+    {.id = 1259, .api = &autotest_demodstats_apsk16,                        .name = "demodstats_apsk16"},
+    {.id = 1260, .api = &autotest_demodstats_apsk32,                        .name = "demodstats_apsk32"},
+    {.id = 1261, .api = &autotest_demodstats_apsk64,                        .name = "demodstats_apsk64"},
+    {.id = 1262, .api = &autotest_demodstats_apsk128,                       .name = "demodstats_apsk128"},
+    {.id = 1263, .api = &autotest_demodstats_apsk256,                       .name = "demodstats_apsk256"},
+    {.id = 1264, .api = &autotest_demodstats_bpsk,                          .name = "demodstats_bpsk"},
+    {.id = 1265, .api = &autotest_demodstats_qpsk,                          .name = "demodstats_qpsk"},
+    {.id = 1266, .api = &autotest_demodstats_ook,                           .name = "demodstats_ook"},
+    {.id = 1267, .api = &autotest_demodstats_sqam32,                        .name = "demodstats_sqam32"},
+    {.id = 1268, .api = &autotest_demodstats_sqam128,                       .name = "demodstats_sqam128"},
+    {.id = 1269, .api = &autotest_demodstats_V29,                           .name = "demodstats_V29"},
+    {.id = 1270, .api = &autotest_demodstats_arb16opt,                      .name = "demodstats_arb16opt"},
+    {.id = 1271, .api = &autotest_demodstats_arb32opt,                      .name = "demodstats_arb32opt"},
+    {.id = 1272, .api = &autotest_demodstats_arb64opt,                      .name = "demodstats_arb64opt"},
+    {.id = 1273, .api = &autotest_demodstats_arb128opt,                     .name = "demodstats_arb128opt"},
+    {.id = 1274, .api = &autotest_demodstats_arb256opt,                     .name = "demodstats_arb256opt"},
+    {.id = 1275, .api = &autotest_demodstats_arb64vt,                       .name = "demodstats_arb64vt"},
+    {.id = 1276, .api = &autotest_modemcf_print_schemes,                    .name = "modemcf_print_schemes"},
+    {.id = 1277, .api = &autotest_modemcf_str2mod,                          .name = "modemcf_str2mod"},
+    {.id = 1278, .api = &autotest_modemcf_types,                            .name = "modemcf_types"},
+    {.id = 1279, .api = &autotest_firpfbch_crcf_synthesis,                  .name = "firpfbch_crcf_synthesis"},
+    {.id = 1280, .api = &autotest_firpfbch_crcf_analysis,                   .name = "firpfbch_crcf_analysis"},
+    {.id = 1281, .api = &autotest_firpfbch_crcf_config,                     .name = "firpfbch_crcf_config"},
+    {.id = 1282, .api = &autotest_firpfbch2_crcf_n8,                        .name = "firpfbch2_crcf_n8"},
+    {.id = 1283, .api = &autotest_firpfbch2_crcf_n16,                       .name = "firpfbch2_crcf_n16"},
+    {.id = 1284, .api = &autotest_firpfbch2_crcf_n32,                       .name = "firpfbch2_crcf_n32"},
+    {.id = 1285, .api = &autotest_firpfbch2_crcf_n64,                       .name = "firpfbch2_crcf_n64"},
+    {.id = 1286, .api = &autotest_firpfbch2_crcf_copy,                      .name = "firpfbch2_crcf_copy"},
+    {.id = 1287, .api = &autotest_firpfbch2_crcf_config,                    .name = "firpfbch2_crcf_config"},
+    {.id = 1288, .api = &autotest_firpfbchr_crcf,                           .name = "firpfbchr_crcf"},
+    {.id = 1289, .api = &autotest_firpfbchr_crcf_config,                    .name = "firpfbchr_crcf_config"},
+    {.id = 1290, .api = &autotest_ofdmframesync_acquire_n64,                .name = "ofdmframesync_acquire_n64"},
+    {.id = 1291, .api = &autotest_ofdmframesync_acquire_n128,               .name = "ofdmframesync_acquire_n128"},
+    {.id = 1292, .api = &autotest_ofdmframesync_acquire_n256,               .name = "ofdmframesync_acquire_n256"},
+    {.id = 1293, .api = &autotest_ofdmframesync_acquire_n512,               .name = "ofdmframesync_acquire_n512"},
+    {.id = 1294, .api = &autotest_ofdmframesync_block_n64,                  .name = "ofdmframesync_block_n64"},
+    {.id = 1295, .api = &autotest_ofdmframesync_block_n128,                 .name = "ofdmframesync_block_n128"},
+    {.id = 1296, .api = &autotest_ofdmframesync_block_n512,                 .name = "ofdmframesync_block_n512"},
+    {.id = 1297, .api = &autotest_ofdmframe_common_config,                  .name = "ofdmframe_common_config"},
+    {.id = 1298, .api = &autotest_ofdmframegen_config,                      .name = "ofdmframegen_config"},
+    {.id = 1299, .api = &autotest_ofdmframesync_config,                     .name = "ofdmframesync_config"},
+    {.id = 1300, .api = &autotest_nco_crcf_constrain,                       .name = "nco_crcf_constrain"},
+    {.id = 1301, .api = &autotest_nco_crcf_copy,                            .name = "nco_crcf_copy"},
+    {.id = 1302, .api = &autotest_nco_config,                               .name = "nco_config"},
+    {.id = 1303, .api = &autotest_nco_crcf_frequency,                       .name = "nco_crcf_frequency"},
+    {.id = 1304, .api = &autotest_nco_crcf_mix_nco_0,                       .name = "nco_crcf_mix_nco_0"},
+    {.id = 1305, .api = &autotest_nco_crcf_mix_nco_1,                       .name = "nco_crcf_mix_nco_1"},
+    {.id = 1306, .api = &autotest_nco_crcf_mix_nco_2,                       .name = "nco_crcf_mix_nco_2"},
+    {.id = 1307, .api = &autotest_nco_crcf_mix_nco_3,                       .name = "nco_crcf_mix_nco_3"},
+    {.id = 1308, .api = &autotest_nco_crcf_mix_nco_4,                       .name = "nco_crcf_mix_nco_4"},
+    {.id = 1309, .api = &autotest_nco_crcf_mix_nco_5,                       .name = "nco_crcf_mix_nco_5"},
+    {.id = 1310, .api = &autotest_nco_crcf_mix_nco_6,                       .name = "nco_crcf_mix_nco_6"},
+    {.id = 1311, .api = &autotest_nco_crcf_mix_nco_7,                       .name = "nco_crcf_mix_nco_7"},
+    {.id = 1312, .api = &autotest_nco_crcf_mix_nco_8,                       .name = "nco_crcf_mix_nco_8"},
+    {.id = 1313, .api = &autotest_nco_crcf_mix_nco_9,                       .name = "nco_crcf_mix_nco_9"},
+    {.id = 1314, .api = &autotest_nco_crcf_mix_vco_0,                       .name = "nco_crcf_mix_vco_0"},
+    {.id = 1315, .api = &autotest_nco_crcf_mix_vco_1,                       .name = "nco_crcf_mix_vco_1"},
+    {.id = 1316, .api = &autotest_nco_crcf_mix_vco_2,                       .name = "nco_crcf_mix_vco_2"},
+    {.id = 1317, .api = &autotest_nco_crcf_mix_vco_3,                       .name = "nco_crcf_mix_vco_3"},
+    {.id = 1318, .api = &autotest_nco_crcf_mix_vco_4,                       .name = "nco_crcf_mix_vco_4"},
+    {.id = 1319, .api = &autotest_nco_crcf_mix_vco_5,                       .name = "nco_crcf_mix_vco_5"},
+    {.id = 1320, .api = &autotest_nco_crcf_mix_vco_6,                       .name = "nco_crcf_mix_vco_6"},
+    {.id = 1321, .api = &autotest_nco_crcf_mix_vco_7,                       .name = "nco_crcf_mix_vco_7"},
+    {.id = 1322, .api = &autotest_nco_crcf_mix_vco_8,                       .name = "nco_crcf_mix_vco_8"},
+    {.id = 1323, .api = &autotest_nco_crcf_mix_vco_9,                       .name = "nco_crcf_mix_vco_9"},
+    {.id = 1324, .api = &autotest_nco_crcf_phase,                           .name = "nco_crcf_phase"},
+    {.id = 1325, .api = &autotest_nco_basic,                                .name = "nco_basic"},
+    {.id = 1326, .api = &autotest_nco_mixing,                               .name = "nco_mixing"},
+    {.id = 1327, .api = &autotest_nco_block_mixing,                         .name = "nco_block_mixing"},
+    {.id = 1328, .api = &autotest_nco_crcf_pll_phase,                       .name = "nco_crcf_pll_phase"},
+    {.id = 1329, .api = &autotest_nco_crcf_pll_freq,                        .name = "nco_crcf_pll_freq"},
+    {.id = 1330, .api = &autotest_nco_crcf_spectrum_nco_f00,                .name = "nco_crcf_spectrum_nco_f00"},
+    {.id = 1331, .api = &autotest_nco_crcf_spectrum_nco_f01,                .name = "nco_crcf_spectrum_nco_f01"},
+    {.id = 1332, .api = &autotest_nco_crcf_spectrum_nco_f02,                .name = "nco_crcf_spectrum_nco_f02"},
+    {.id = 1333, .api = &autotest_nco_crcf_spectrum_nco_f03,                .name = "nco_crcf_spectrum_nco_f03"},
+    {.id = 1334, .api = &autotest_nco_crcf_spectrum_nco_f04,                .name = "nco_crcf_spectrum_nco_f04"},
+    {.id = 1335, .api = &autotest_nco_crcf_spectrum_vco_f00,                .name = "nco_crcf_spectrum_vco_f00"},
+    {.id = 1336, .api = &autotest_nco_crcf_spectrum_vco_f01,                .name = "nco_crcf_spectrum_vco_f01"},
+    {.id = 1337, .api = &autotest_nco_crcf_spectrum_vco_f02,                .name = "nco_crcf_spectrum_vco_f02"},
+    {.id = 1338, .api = &autotest_nco_crcf_spectrum_vco_f03,                .name = "nco_crcf_spectrum_vco_f03"},
+    {.id = 1339, .api = &autotest_nco_crcf_spectrum_vco_f04,                .name = "nco_crcf_spectrum_vco_f04"},
+    {.id = 1340, .api = &autotest_nco_unwrap_phase,                         .name = "nco_unwrap_phase"},
+    {.id = 1341, .api = &autotest_gasearch_peak,                            .name = "gasearch_peak"},
+    {.id = 1342, .api = &autotest_chromosome_config,                        .name = "chromosome_config"},
+    {.id = 1343, .api = &autotest_gasearch_config,                          .name = "gasearch_config"},
+    {.id = 1344, .api = &autotest_gasearch_workers,                         .name = "gasearch_workers"},
+    {.id = 1345, .api = &autotest_gasearch_cache,                           .name = "gasearch_cache"},
+    {.id = 1346, .api = &autotest_gasearch_workers_count,                   .name = "gasearch_workers_count"},
+    {.id = 1347, .api = &autotest_gradsearch_rosenbrock,                    .name = "gradsearch_rosenbrock"},
+    {.id = 1348, .api = &autotest_gradsearch_maxutility,                    .name = "gradsearch_maxutility"},
+    {.id = 1349, .api = &autotest_gradsearch_workers,                       .name = "gradsearch_workers"},
+    {.id = 1350, .api = &autotest_gradsearch_gradient,                      .name = "gradsearch_gradient"},
+    {.id = 1351, .api = &autotest_qnsearch_rosenbrock,                      .name = "qnsearch_rosenbrock"},
+    {.id = 1352, .api = &autotest_qnsearch_config,                          .name = "qnsearch_config"},
+    {.id = 1353, .api = &autotest_qnsearch_workers,                         .name = "qnsearch_workers"},
+    {.id = 1354, .api = &autotest_qnsearch_gradient,                        .name = "qnsearch_gradient"},
+    {.id = 1355, .api = &autotest_qs1dsearch_min_01,                        .name = "qs1dsearch_min_01"},
+    {.id = 1356, .api = &autotest_qs1dsearch_min_02,                        .name = "qs1dsearch_min_02"},
+    {.id = 1357, .api = &autotest_qs1dsearch_min_03,                        .name = "qs1dsearch_min_03"},
+    {.id = 1358, .api = &autotest_qs1dsearch_min_05,                        .name = "qs1dsearch_min_05"},
+    {.id = 1359, .api = &autotest_qs1dsearch_min_06,                        .name = "qs1dsearch_min_06"},
+    {.id = 1360, .api = &autotest_qs1dsearch_min_07,                        .name = "qs1dsearch_min_07"},
+    {.id = 1361, .api = &autotest_qs1dsearch_min_08,                        .name = "qs1dsearch_min_08"},
+    {.id = 1362, .api = &autotest_qs1dsearch_min_10,                        .name = "qs1dsearch_min_10"},
+    {.id = 1363, .api = &autotest_qs1dsearch_min_11,                        .name = "qs1dsearch_min_11"},
+    {.id = 1364, .api = &autotest_qs1dsearch_min_12,                        .name = "qs1dsearch_min_12"},
+    {.id = 1365, .api = &autotest_qs1dsearch_min_13,                        .name = "qs1dsearch_min_13"},
+    {.id = 1366, .api = &autotest_qs1dsearch_max_01,                        .name = "qs1dsearch_max_01"},
+    {.id = 1367, .api = &autotest_qs1dsearch_max_02,                        .name = "qs1dsearch_max_02"},
+    {.id = 1368, .api = &autotest_qs1dsearch_max_03,                        .name = "qs1dsearch_max_03"},
+    {.id = 1369, .api = &autotest_qs1dsearch_max_05,                        .name = "qs1dsearch_max_05"},
+    {.id = 1370, .api = &autotest_qs1dsearch_max_06,                        .name = "qs1dsearch_max_06"},
+    {.id = 1371, .api = &autotest_qs1dsearch_max_07,                        .name = "qs1dsearch_max_07"},
+    {.id = 1372, .api = &autotest_qs1dsearch_max_08,                        .name = "qs1dsearch_max_08"},
+    {.id = 1373, .api = &autotest_qs1dsearch_max_10,                        .name = "qs1dsearch_max_10"},
+    {.id = 1374, .api = &autotest_qs1dsearch_max_11,                        .name = "qs1dsearch_max_11"},
+    {.id = 1375, .api = &autotest_qs1dsearch_max_12,                        .name = "qs1dsearch_max_12"},
+    {.id = 1376, .api = &autotest_qs1dsearch_max_13,                        .name = "qs1dsearch_max_13"},
+    {.id = 1377, .api = &autotest_qs1dsearch_config,                        .name = "qs1dsearch_config"},
+    {.id = 1378, .api = &autotest_optim_rosenbrock,                         .name = "optim_rosenbrock"},
+    {.id = 1379, .api = &autotest_compand_float,                            .name = "compand_float"},
+    {.id = 1380, .api = &autotest_compand_cfloat,                           .name = "compand_cfloat"},
+    {.id = 1381, .api = &autotest_quantize_float_n8,                        .name = "quantize_float_n8"},
+    {.id = 1382, .api = &autotest_scramble_n16,                             .name = "scramble_n16"},
+    {.id = 1383, .api = &autotest_scramble_n64,                             .name = "scramble_n64"},
+    {.id = 1384, .api = &autotest_scramble_n256,                            .name = "scramble_n256"},
+    {.id = 1385, .api = &autotest_scramble_n11,                             .name = "scramble_n11"},
+    {.id = 1386, .api = &autotest_scramble_n33,                             .name = "scramble_n33"},
+    {.id = 1387, .api = &autotest_scramble_n277,                            .name = "scramble_n277"},
+    {.id = 1388, .api = &autotest_scramble_soft_n16,                        .name = "scramble_soft_n16"},
+    {.id = 1389, .api = &autotest_scramble_soft_n64,                        .name = "scramble_soft_n64"},
+    {.id = 1390, .api = &autotest_scramble_soft_n256,                       .name = "scramble_soft_n256"},
+    {.id = 1391, .api = &autotest_scramble_soft_n11,                        .name = "scramble_soft_n11"},
+    {.id = 1392, .api = &autotest_scramble_soft_n33,                        .name = "scramble_soft_n33"},
+    {.id = 1393, .api = &autotest_scramble_soft_n277,                       .name = "scramble_soft_n277"},
+    {.id = 1394, .api = &autotest_randf,                                    .name = "randf"},
+    {.id = 1395, .api = &autotest_randnf,                                   .name = "randnf"},
+    {.id = 1396, .api = &autotest_crandnf,                                  .name = "crandnf"},
+    {.id = 1397, .api = &autotest_randweibf,                                .name = "randweibf"},
+    {.id = 1398, .api = &autotest_randricekf,                               .name = "randricekf"},
+    {.id = 1399, .api = &autotest_randexpf,                                 .name = "randexpf"},
+    {.id = 1400, .api = &autotest_random_config,                            .name = "random_config"},
+    {.id = 1401, .api = &autotest_distribution_randnf,                      .name = "distribution_randnf"},
+    {.id = 1402, .api = &autotest_bsequence_init,                           .name = "bsequence_init"},
+    {.id = 1403, .api = &autotest_bsequence_correlate,                      .name = "bsequence_correlate"},
+    {.id = 1404, .api = &autotest_bsequence_add,                            .name = "bsequence_add"},
+    {.id = 1405, .api = &autotest_bsequence_mul,                            .name = "bsequence_mul"},
+    {.id = 1406, .api = &autotest_bsequence_accumulate,                     .name = "bsequence_accumulate"},
+    {.id = 1407, .api = &autotest_complementary_code_n8,                    .name = "complementary_code_n8"},
+    {.id = 1408, .api = &autotest_complementary_code_n16,                   .name = "complementary_code_n16"},
+    {.id = 1409, .api = &autotest_complementary_code_n32,                   .name = "complementary_code_n32"},
+    {.id = 1410, .api = &autotest_complementary_code_n64,                   .name = "complementary_code_n64"},
+    {.id = 1411, .api = &autotest_complementary_code_n128,                  .name = "complementary_code_n128"},
+    {.id = 1412, .api = &autotest_complementary_code_n256,                  .name = "complementary_code_n256"},
+    {.id = 1413, .api = &autotest_complementary_code_n512,                  .name = "complementary_code_n512"},
+    {.id = 1414, .api = &autotest_bsequence_init_msequence,                 .name = "bsequence_init_msequence"},
+    {.id = 1415, .api = &autotest_msequence_xcorr_m2,                       .name = "msequence_xcorr_m2"},
+    {.id = 1416, .api = &autotest_msequence_xcorr_m3,                       .name = "msequence_xcorr_m3"},
+    {.id = 1417, .api = &autotest_msequence_xcorr_m4,                       .name = "msequence_xcorr_m4"},
+    {.id = 1418, .api = &autotest_msequence_xcorr_m5,                       .name = "msequence_xcorr_m5"},
+    {.id = 1419, .api = &autotest_msequence_xcorr_m6,                       .name = "msequence_xcorr_m6"},
+    {.id = 1420, .api = &autotest_msequence_xcorr_m7,                       .name = "msequence_xcorr_m7"},
+    {.id = 1421, .api = &autotest_msequence_xcorr_m8,                       .name = "msequence_xcorr_m8"},
+    {.id = 1422, .api = &autotest_msequence_xcorr_m9,                       .name = "msequence_xcorr_m9"},
+    {.id = 1423, .api = &autotest_msequence_xcorr_m10,                      .name = "msequence_xcorr_m10"},
+    {.id = 1424, .api = &autotest_msequence_xcorr_m11,                      .name = "msequence_xcorr_m11"},
+    {.id = 1425, .api = &autotest_msequence_xcorr_m12,                      .name = "msequence_xcorr_m12"},
+    {.id = 1426, .api = &autotest_msequence_period_m2,                      .name = "msequence_period_m2"},
+    {.id = 1427, .api = &autotest_msequence_period_m3,                      .name = "msequence_period_m3"},
+    {.id = 1428, .api = &autotest_msequence_period_m4,                      .name = "msequence_period_m4"},
+    {.id = 1429, .api = &autotest_msequence_period_m5,                      .name = "msequence_period_m5"},
+    {.id = 1430, .api = &autotest_msequence_period_m6,                      .name = "msequence_period_m6"},
+    {.id = 1431, .api = &autotest_msequence_period_m7,                      .name = "msequence_period_m7"},
+    {.id = 1432, .api = &autotest_msequence_period_m8,                      .name = "msequence_period_m8"},
+    {.id = 1433, .api = &autotest_msequence_period_m9,                      .name = "msequence_period_m9"},
+    {.id = 1434, .api = &autotest_msequence_period_m10,                     .name = "msequence_period_m10"},
+    {.id = 1435, .api = &autotest_msequence_period_m11,                     .name = "msequence_period_m11"},
+    {.id = 1436, .api = &autotest_msequence_period_m12,                     .name = "msequence_period_m12"},
+    {.id = 1437, .api = &autotest_msequence_period_m13,                     .name = "msequence_period_m13"},
+    {.id = 1438, .api = &autotest_msequence_period_m14,                     .name = "msequence_period_m14"},
+    {.id = 1439, .api = &autotest_msequence_period_m15,                     .name = "msequence_period_m15"},
+    {.id = 1440, .api = &autotest_msequence_period_m16,                     .name = "msequence_period_m16"},
+    {.id = 1441, .api = &autotest_msequence_period_m17,                     .name = "msequence_period_m17"},
+    {.id = 1442, .api = &autotest_msequence_period_m18,                     .name = "msequence_period_m18"},
+    {.id = 1443, .api = &autotest_msequence_period_m19,                     .name = "msequence_period_m19"},
+    {.id = 1444, .api = &autotest_msequence_period_m20,                     .name = "msequence_period_m20"},
+    {.id = 1445, .api = &autotest_msequence_period_m21,                     .name = "msequence_period_m21"},
+    {.id = 1446, .api = &autotest_msequence_period_m22,                     .name = "msequence_period_m22"},
+    {.id = 1447, .api = &autotest_msequence_period_m23,                     .name = "msequence_period_m23"},
+    {.id = 1448, .api = &autotest_msequence_period_m24,                     .name = "msequence_period_m24"},
+    {.id = 1449, .api = &autotest_msequence_period_m25,                     .name = "msequence_period_m25"},
+    {.id = 1450, .api = &autotest_msequence_period_m26,                     .name = "msequence_period_m26"},
+    {.id = 1451, .api = &autotest_msequence_period_m27,                     .name = "msequence_period_m27"},
+    {.id = 1452, .api = &autotest_msequence_period_m28,                     .name = "msequence_period_m28"},
+    {.id = 1453, .api = &autotest_msequence_period_m29,                     .name = "msequence_period_m29"},
+    {.id = 1454, .api = &autotest_msequence_period_m30,                     .name = "msequence_period_m30"},
+    {.id = 1455, .api = &autotest_msequence_period_m31,                     .name = "msequence_period_m31"},
+    {.id = 1456, .api = &autotest_msequence_config,                         .name = "msequence_config"},
+    {.id = 1457, .api = &autotest_lbshift,                                  .name = "lbshift"},
+    {.id = 1458, .api = &autotest_rbshift,                                  .name = "rbshift"},
+    {.id = 1459, .api = &autotest_lbcircshift,                              .name = "lbcircshift"},
+    {.id = 1460, .api = &autotest_rbcircshift,                              .name = "rbcircshift"},
+    {.id = 1461, .api = &autotest_count_ones,                               .name = "count_ones"},
+    {.id = 1462, .api = &autotest_count_ones_mod2,                          .name = "count_ones_mod2"},
+    {.id = 1463, .api = &autotest_bdotprod,                                 .name = "bdotprod"},
+    {.id = 1464, .api = &autotest_count_leading_zeros,                      .name = "count_leading_zeros"},
+    {.id = 1465, .api = &autotest_msb_index,                                .name = "msb_index"},
+    {.id = 1466, .api = &autotest_pack_array,                               .name = "pack_array"},
+    {.id = 1467, .api = &autotest_unpack_array,                             .name = "unpack_array"},
+    {.id = 1468, .api = &autotest_repack_array,                             .name = "repack_array"},
+    {.id = 1469, .api = &autotest_pack_bytes_01,                            .name = "pack_bytes_01"},
+    {.id = 1470, .api = &autotest_unpack_bytes_01,                          .name = "unpack_bytes_01"},
+    {.id = 1471, .api = &autotest_repack_bytes_01,                          .name = "repack_bytes_01"},
+    {.id = 1472, .api = &autotest_repack_bytes_02,                          .name = "repack_bytes_02"},
+    {.id = 1473, .api = &autotest_repack_bytes_03,                          .name = "repack_bytes_03"},
+    {.id = 1474, .api = &autotest_repack_bytes_04_uneven,                   .name = "repack_bytes_04_uneven"},
+    {.id = 1475, .api = &autotest_profile_firfilt,                          .name = "profile_firfilt"},
+    {.id = 1476, .api = &autotest_profile_fftplan,                          .name = "profile_fftplan"},
+    {.id = 1477, .api = &autotest_profile_callback,                         .name = "profile_callback"},
+    {.id = 1478, .api = &autotest_profile_json,                             .name = "profile_json"},
+    {.id = 1479, .api = &autotest_lshift,                                   .name = "lshift"},
+    {.id = 1480, .api = &autotest_rshift,                                   .name = "rshift"},
+    {.id = 1481, .api = &autotest_lcircshift,                               .name = "lcircshift"},
+    {.id = 1482, .api = &autotest_rcircshift,                               .name = "rcircshift"}
+};
+
+// array of packages
+package_t packages[NUM_PACKAGES] = {
+    {.id =    0, .index =    0, .num_scripts =    1, .name = "null"},
+    {.id =    1, .index =    1, .num_scripts =    1, .name = "libliquid"},
+    {.id =    2, .index =    2, .num_scripts =    9, .name = "agc_crcf"},
+    {.id =    3, .index =   11, .num_scripts =    3, .name = "cvsd"},
+    {.id =    4, .index =   14, .num_scripts =    5, .name = "cbuffer"},
+    {.id =    5, .index =   19, .num_scripts =    2, .name = "wdelay"},
+    {.id =    6, .index =   21, .num_scripts =    3, .name = "buffer_window"},
+    {.id =    7, .index =   24, .num_scripts =    8, .name = "dotprod_rrrf"},
+    {.id =    8, .index =   32, .num_scripts =    3, .name = "dotprod_crcf"},
+    {.id =    9, .index =   35, .num_scripts =    3, .name = "dotprod_cccf"},
+    {.id =   10, .index =   38, .num_scripts =    6, .name = "sumsqf"},
+    {.id =   11, .index =   44, .num_scripts =    6, .name = "sumsqcf"},
+    {.id =   12, .index =   50, .num_scripts =   14, .name = "eqlms_cccf"},
+    {.id =   13, .index =   64, .num_scripts =    7, .name = "eqrls_cccf"},
+    {.id =   14, .index =   71, .num_scripts =    7, .name = "eqrls_rrrf"},
+    {.id =   15, .index =   78, .num_scripts =    9, .name = "crc"},
+    {.id =   16, .index =   87, .num_scripts =   29, .name = "fec"},
+    {.id =   17, .index =  116, .num_scripts =    6, .name = "fec_config"},
+    {.id =   18, .index =  122, .num_scripts =   27, .name = "fec_copy"},
+    {.id =   19, .index =  149, .num_scripts =   25, .name = "fec_soft"},
+    {.id =   20, .index =  174, .num_scripts =    1, .name = "fec_golay2412"},
+    {.id =   21, .index =  175, .num_scripts =    2, .name = "fec_hamming74"},
+    {.id =   22, .index =  177, .num_scripts =    2, .name = "fec_hamming84"},
+    {.id =   23, .index =  179, .num_scripts =    2, .name = "fec_hamming128"},
+    {.id =   24, .index =  181, .num_scripts =    1, .name = "fec_hamming1511"},
+    {.id =   25, .index =  182, .num_scripts =    1, .name = "fec_hamming3126"},
+    {.id =   26, .index =  183, .num_scripts =   15, .name = "fec_ldpc"},
+    {.id =   27, .index =  198, .num_scripts =    2, .name = "fec_reedsolomon"},
+    {.id =   28, .index =  200, .num_scripts =    1, .name = "fec_rep3"},
+    {.id =   29, .index =  201, .num_scripts =    1, .name = "fec_rep5"},
+    {.id =   30, .index =  202, .num_scripts =    3, .name = "fec_secded2216"},
+    {.id =   31, .index =  205, .num_scripts =    3, .name = "fec_secded3932"},
+    {.id =   32, .index =  208, .num_scripts =    3, .name = "fec_secded7264"},
+    {.id =   33, .index =  211, .num_scripts =    9, .name = "interleaver"},
+    {.id =   34, .index =  220, .num_scripts =    1, .name = "packetizer_copy"},
+    {.id =   35, .index =  221, .num_scripts =    7, .name = "packetizer"},
+    {.id =   36, .index =  228, .num_scripts =    1, .name = "asgram"},
+    {.id =   37, .index =  229, .num_scripts =    5, .name = "fft_small"},
+    {.id =   38, .index =  234, .num_scripts =    6, .name = "fft_radix2"},
+    {.id =   39, .index =  240, .num_scripts =   15, .name = "fft_composite"},
+    {.id =   40, .index =  255, .num_scripts =    6, .name = "fft_prime"},
+    {.id =   41, .index =  261, .num_scripts =   24, .name = "fft_r2r"},
+    {.id =   42, .index =  285, .num_scripts =    2, .name = "fft_shift"},
+    {.id =   43, .index =  287, .num_scripts =   29, .name = "spgram"},
+    {.id =   44, .index =  316, .num_scripts =    7, .name = "spwaterfall"},
+    {.id =   45, .index =  323, .num_scripts =    5, .name = "dds_cccf"},
+    {.id =   46, .index =  328, .num_scripts =    8, .name = "design_cache"},
+    {.id =   47, .index =  336, .num_scripts =   12, .name = "fdelay_rrrf"},
+    {.id =   48, .index =  348, .num_scripts =   14, .name = "fftfilt_xxxf"},
+    {.id =   49, .index =  362, .num_scripts =    1, .name = "filter_crosscorr"},
+    {.id =   50, .index =  363, .num_scripts =    2, .name = "firdecim"},
+    {.id =   51, .index =  365, .num_scripts =   14, .name = "firdecim_xxxf"},
+    {.id =   52, .index =  379, .num_scripts =   26, .name = "firdes"},
+    {.id =   53, .index =  405, .num_scripts =   18, .name = "firdespm"},
+    {.id =   54, .index =  423, .num_scripts =    8, .name = "firfilt"},
+    {.id =   55, .index =  431, .num_scripts =    6, .name = "firfilt_cccf_notch"},
+    {.id =   56, .index =  437, .num_scripts =    1, .name = "firfilt_coefficients"},
+    {.id =   57, .index =  438, .num_scripts =   18, .name = "firfilt_rnyquist"},
+    {.id =   58, .index =  456, .num_scripts =   12, .name = "firfilt_xxxf"},
+    {.id =   59, .index =  468, .num_scripts =    1, .name = "firfilt_copy"},
+    {.id =   60, .index =  469, .num_scripts =   10, .name = "firhilb"},
+    {.id =   61, .index =  479, .num_scripts =   10, .name = "firinterp"},
+    {.id =   62, .index =  489, .num_scripts =    2, .name = "firpfb"},
+    {.id =   63, .index =  491, .num_scripts =    4, .name = "groupdelay"},
+    {.id =   64, .index =  495, .num_scripts =    1, .name = "iirdecim"},
+    {.id =   65, .index =  496, .num_scripts =   25, .name = "iirdes"},
+    {.id =   66, .index =  521, .num_scripts =    5, .name = "iirdes_support"},
+    {.id =   67, .index =  526, .num_scripts =    6, .name = "iirfilt"},
+    {.id =   68, .index =  532, .num_scripts =    9, .name = "iirfilt_xxxf"},
+    {.id =   69, .index =  541, .num_scripts =    7, .name = "iirfiltbank"},
+    {.id =   70, .index =  548, .num_scripts =    4, .name = "iirfiltsos"},
+    {.id =   71, .index =  552, .num_scripts =    5, .name = "iirhilb"},
+    {.id =   72, .index =  557, .num_scripts =    4, .name = "iirinterp"},
+    {.id =   73, .index =  561, .num_scripts =    6, .name = "lpc"},
+    {.id =   74, .index =  567, .num_scripts =   12, .name = "msresamp_crcf"},
+    {.id =   75, .index =  579, .num_scripts =   12, .name = "msresamp2_crcf"},
+    {.id =   76, .index =  591, .num_scripts =    1, .name = "ordfilt"},
+    {.id =   77, .index =  592, .num_scripts =   18, .name = "rresamp_crcf"},
+    {.id =   78, .index =  610, .num_scripts =    6, .name = "rresamp_crcf_partition"},
+    {.id =   79, .index =  616, .num_scripts =   17, .name = "resamp_crcf"},
+    {.id =   80, .index =  633, .num_scripts =   10, .name = "resamp2_crcf"},
+    {.id =   81, .index =  643, .num_scripts =    1, .name = "rkaiser"},
+    {.id =   82, .index =  644, .num_scripts =    2, .name = "symsync_copy"},
+    {.id =   83, .index =  646, .num_scripts =   10, .name = "symsync_crcf"},
+    {.id =   84, .index =  656, .num_scripts =    8, .name = "symsync_rrrf"},
+    {.id =   85, .index =  664, .num_scripts =    1, .name = "bpacketsync"},
+    {.id =   86, .index =  665, .num_scripts =    2, .name = "bsync"},
+    {.id =   87, .index =  667, .num_scripts =   10, .name = "detector"},
+    {.id =   88, .index =  677, .num_scripts =    4, .name = "dsssframe64"},
+    {.id =   89, .index =  681, .num_scripts =    1, .name = "dsssframesync"},
+    {.id =   90, .index =  682, .num_scripts =    1, .name = "flexframesync"},
+    {.id =   91, .index =  683, .num_scripts =   10, .name = "framesync64"},
+    {.id =   92, .index =  693, .num_scripts =    6, .name = "framesync_batch"},
+    {.id =   93, .index =  699, .num_scripts =    1, .name = "fskframesync"},
+    {.id =   94, .index =  700, .num_scripts =   11, .name = "gmskframe"},
+    {.id =   95, .index =  711, .num_scripts =    6, .name = "msource"},
+    {.id =   96, .index =  717, .num_scripts =   10, .name = "presync"},
+    {.id =   97, .index =  727, .num_scripts =   12, .name = "ofdmflexframe"},
+    {.id =   98, .index =  739, .num_scripts =   20, .name = "qdetector_cccf"},
+    {.id =   99, .index =  759, .num_scripts =    1, .name = "qdetector_cccf_copy"},
+    {.id =  100, .index =  760, .num_scripts =    6, .name = "qdsync_cccf"},
+    {.id =  101, .index =  766, .num_scripts =   20, .name = "qpacketmodem"},
+    {.id =  102, .index =  786, .num_scripts =    7, .name = "qpilotsync"},
+    {.id =  103, .index =  793, .num_scripts =    1, .name = "qsource"},
+    {.id =  104, .index =  794, .num_scripts =    5, .name = "symstreamcf"},
+    {.id =  105, .index =  799, .num_scripts =   20, .name = "symstreamcf_delay"},
+    {.id =  106, .index =  819, .num_scripts =    5, .name = "symstreamrcf"},
+    {.id =  107, .index =  824, .num_scripts =   20, .name = "symstreamrcf_delay"},
+    {.id =  108, .index =  844, .num_scripts =    4, .name = "symtrack_cccf"},
+    {.id =  109, .index =  848, .num_scripts =    3, .name = "gcd"},
+    {.id =  110, .index =  851, .num_scripts =   13, .name = "math_window"},
+    {.id =  111, .index =  864, .num_scripts =    4, .name = "math"},
+    {.id =  112, .index =  868, .num_scripts =    5, .name = "math_bessel"},
+    {.id =  113, .index =  873, .num_scripts =    5, .name = "math_gamma"},
+    {.id =  114, .index =  878, .num_scripts =    6, .name = "math_complex"},
+    {.id =  115, .index =  884, .num_scripts =   21, .name = "math_fast"},
+    {.id =  116, .index =  905, .num_scripts =   11, .name = "polynomial"},
+    {.id =  117, .index =  916, .num_scripts =    4, .name = "polynomial_findroots"},
+    {.id =  118, .index =  920, .num_scripts =    3, .name = "prime"},
+    {.id =  119, .index =  923, .num_scripts =   15, .name = "matrixcf"},
+    {.id =  120, .index =  938, .num_scripts =   14, .name = "matrixf"},
+    {.id =  121, .index =  952, .num_scripts =    4, .name = "smatrixb"},
+    {.id =  122, .index =  956, .num_scripts =    2, .name = "smatrixf"},
+    {.id =  123, .index =  958, .num_scripts =    2, .name = "smatrixi"},
+    {.id =  124, .index =  960, .num_scripts =   12, .name = "ampmodem"},
+    {.id =  125, .index =  972, .num_scripts =   35, .name = "cpfskmodem"},
+    {.id =  126, .index = 1007, .num_scripts =    8, .name = "freqmodem"},
+    {.id =  127, .index = 1015, .num_scripts =   25, .name = "fskmodem"},
+    {.id =  128, .index = 1040, .num_scripts =   14, .name = "gmskmodem"},
+    {.id =  129, .index = 1054, .num_scripts =   51, .name = "modem"},
+    {.id =  130, .index = 1105, .num_scripts =   18, .name = "modem_block"},
+    {.id =  131, .index = 1123, .num_scripts =   52, .name = "modem_config"},
+    {.id =  132, .index = 1175, .num_scripts =   51, .name = "modem_demodsoft"},
+    {.id =  133, .index = 1226, .num_scripts =   50, .name = "modem_demodstats"},
+    {.id =  134, .index = 1276, .num_scripts =    3, .name = "modem_utilities"},
+    {.id =  135, .index = 1279, .num_scripts =    1, .name = "firpfbch_crcf_synthesizer"},
+    {.id =  136, .index = 1280, .num_scripts =    1, .name = "firpfbch_crcf_analyzer"},
+    {.id =  137, .index = 1281, .num_scripts =    1, .name = "firpfbch_crcf"},
+    {.id =  138, .index = 1282, .num_scripts =    6, .name = "firpfbch2_crcf"},
+    {.id =  139, .index = 1288, .num_scripts =    2, .name = "firpfbchr_crcf"},
+    {.id =  140, .index = 1290, .num_scripts =   10, .name = "ofdmframe"},
+    {.id =  141, .index = 1300, .num_scripts =    3, .name = "nco_crcf"},
+    {.id =  142, .index = 1303, .num_scripts =    1, .name = "nco_crcf_frequency"},
+    {.id =  143, .index = 1304, .num_scripts =   20, .name = "nco_crcf_mix"},
+    {.id =  144, .index = 1324, .num_scripts =    4, .name = "nco_crcf_phase"},
+    {.id =  145, .index = 1328, .num_scripts =    2, .name = "nco_crcf_pll"},
+    {.id =  146, .index = 1330, .num_scripts =   10, .name = "nco_crcf_spectrum"},
+    {.id =  147, .index = 1340, .num_scripts =    1, .name = "unwrap_phase"},
+    {.id =  148, .index = 1341, .num_scripts =    6, .name = "gasearch"},
+    {.id =  149, .index = 1347, .num_scripts =    4, .name = "gradsearch"},
+    {.id =  150, .index = 1351, .num_scripts =    4, .name = "qnsearch"},
+    {.id =  151, .index = 1355, .num_scripts =   23, .name = "qs1dsearch"},
+    {.id =  152, .index = 1378, .num_scripts =    1, .name = "utility"},
+    {.id =  153, .index = 1379, .num_scripts =    2, .name = "compand"},
+    {.id =  154, .index = 1381, .num_scripts =    1, .name = "quantize"},
+    {.id =  155, .index = 1382, .num_scripts =   12, .name = "scramble"},
+    {.id =  156, .index = 1394, .num_scripts =    7, .name = "random"},
+    {.id =  157, .index = 1401, .num_scripts =    1, .name = "random_distributions"},
+    {.id =  158, .index = 1402, .num_scripts =    5, .name = "bsequence"},
+    {.id =  159, .index = 1407, .num_scripts =    7, .name = "complementary_codes"},
+    {.id =  160, .index = 1414, .num_scripts =   43, .name = "msequence"},
+    {.id =  161, .index = 1457, .num_scripts =    4, .name = "bshift_array"},
+    {.id =  162, .index = 1461, .num_scripts =    5, .name = "count_bits"},
+    {.id =  163, .index = 1466, .num_scripts =    9, .name = "pack_bytes"},
+    {.id =  164, .index = 1475, .num_scripts =    4, .name = "profile"},
+    {.id =  165, .index = 1479, .num_scripts =    4, .name = "shift_array"}
+};
+
+#endif // __LIQUID_AUTOSCRIPT_INCLUDE_H__
+
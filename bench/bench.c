@@ -28,6 +28,11 @@
 //
 
 
+// enable CPU affinity macros
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
 // default include headers
 #include <stdio.h>
 #include <stdlib.h>
@@ -37,6 +42,29 @@
 #include <time.h>
 #include <sys/resource.h>
 
+// performance counters and core pinning are only available on Linux
+#if defined(__linux__)
+#  define BENCH_HAVE_PERF 1
+#  include <unistd.h>
+#  include <sched.h>
+#  include <sys/syscall.h>
+#  include <linux/perf_event.h>
+#else
+#  define BENCH_HAVE_PERF 0
+#endif
+
+// multi-threaded scaling mode requires pthreads and core pinning
+#include "config.h"
+#if BENCH_HAVE_PERF && HAVE_LIBPTHREAD
+#  define BENCH_HAVE_THREADS 1
+#  include <pthread.h>
+#  include <dirent.h>
+#else
+#  define BENCH_HAVE_THREADS 0
+#endif
+
+#include "bench/bench.h"
+
 // define benchmark function pointer
 typedef void(benchmark_function_t) (
     struct rusage *_start,
@@ -54,6 +82,20 @@ typedef struct {
     float                  rate;
     float                  cycles_per_trial;//
     unsigned int           num_attempts;    // number of attempts to reach target time
+    unsigned int           num_reps;        // number of timed repetitions
+    float *                samples;         // execution time per trial, each repetition (s)
+    float                  time_median;     // median execution time per trial (s)
+    float                  time_p95;        // 95th percentile execution time per trial (s)
+    float                  time_ci95[2];    // 95% confidence interval of median (s)
+    double *               counters;        // performance counters per trial (median)
+    unsigned int           num_threads;     // number of concurrent instances (scaling mode)
+    float                  rate_single;     // single-instance rate, wall clock (trials/s)
+    float                  rate_aggregate;  // aggregate rate of all instances (trials/s)
+    float *                rate_thread;     // rate of each instance (trials/s)
+    float                  efficiency;      // scaling efficiency: aggregate/(threads*single)
+    unsigned int           num_metrics;     // number of auxiliary metrics reported
+    const char *           metric_name [BENCH_MAX_METRICS];
+    double                 metric_value[BENCH_MAX_METRICS];
 } benchmark_t;
 
 // define package_t
@@ -74,23 +116,55 @@ typedef struct {
 //   package_t packages[NUM_PACKAGES]
 #include "benchmark_include.h"
 
+// performance counters (perf_event_open), opened per thread
+enum {
+    COUNTER_TASK_CLOCK=0,   // task clock (software, ns)
+    COUNTER_CYCLES,         // cpu cycles
+    COUNTER_INSTRUCTIONS,   // retired instructions
+    COUNTER_CACHE_MISSES,   // last-level cache misses
+    COUNTER_BRANCH_MISSES,  // mis-predicted branches
+    NUM_COUNTERS
+};
+const char * counter_str[NUM_COUNTERS] = {
+    "task_clock_ns", "cycles", "instructions", "cache_misses", "branch_misses"};
+typedef struct {
+    int fd[NUM_COUNTERS];   // file descriptor for each counter (-1 if unavailable)
+} counters_t;
+int  counters_open (counters_t * _c);
+void counters_close(counters_t * _c);
+void counters_read (counters_t * _c, double * _v);
+
 // helper functions:
+int  pin_to_cpu(int _cpu);
 void estimate_cpu_clock(void);
 void set_num_trials_from_cpu_speed(void);
 void execute_benchmark(benchmark_t* _benchmark, int _verbose);
+void execute_benchmark_reps(benchmark_t* _benchmark, unsigned long int _n);
+void execute_benchmark_scaling(benchmark_t* _benchmark, unsigned long int _n);
+int  set_thread_placement(unsigned int _num_threads, int _compact);
 void execute_package(package_t* _package, int _verbose);
 
 char convert_units(float * _s);
 void print_benchmark_results(benchmark_t* _benchmark);
+void print_benchmark_stats(benchmark_t* _benchmark);
 void print_package_results(package_t* _package);
 double calculate_execution_time(struct rusage, struct rusage);
 
 unsigned long int num_base_trials = 1<<12;
 float cpu_clock = 1.0f; // cpu clock speed (Hz)
 float runtime=0.050f;   // minimum run time (s)
+unsigned int num_reps   = 1;    // number of timed repetitions per benchmark
+unsigned int num_warmup = 0;    // number of untimed warm-up runs per benchmark
+int use_counters = 0;           // measure performance counters?
+counters_t counters;            // performance counters for main thread
+unsigned int num_threads = 1;   // number of concurrent instances per benchmark
+int * thread_cpu = NULL;        // cpu core for each instance
+benchmark_t * benchmark_current = NULL; // benchmark receiving reported metrics
 
 FILE * fid; // output file id
 void output_benchmark_to_file(FILE * _fid, benchmark_t * _benchmark);
+void output_benchmark_stats(FILE * _fid, benchmark_t * _benchmark);
+void output_benchmark_scaling(FILE * _fid, benchmark_t * _benchmark);
 
 void usage()
 {
@@ -111,6 +185,14 @@ void usage()
     printf("  -L           : list all available scripts\n");
     printf("  -s <search>  : run all packages/benchmarks matching search string\n");
     printf("  -o <file>    : output file (json)\n");
+    printf("  -r <reps>    : number of timed repetitions per benchmark (median, p95)\n");
+    printf("  -w <runs>    : number of warm-up runs per benchmark\n");
+    printf("  -C <cpu>     : pin to cpu core (-j instances keep their own placement)\n");
+    printf("  -P           : measure hardware performance counters (Linux)\n");
+    printf("  -j <threads> : run <threads> concurrent instances on pinned cores and\n");
+    printf("                 report aggregate throughput and scaling efficiency\n");
+    printf("  -a <policy>  : thread placement: 'spread' across NUMA nodes (default)\n");
+    printf("                 or 'compact' (fill one node first)\n");
 }
 
 // main function
@@ -132,10 +214,12 @@ int main(int argc, char *argv[])
     int cpu_clock_detect = 1;
     char filename[256] = "benchmark.json";
     char search_string[128];
+    int cpu = -1;
+    int compact = 0;
 
     // get input options
     int d;
-    while((d = getopt(argc,argv,"hvqfec:n:b:p:t:lLs:o:")) != EOF){
+    while((d = getopt(argc,argv,"hvqfec:n:b:p:t:lLs:o:r:w:C:Pj:a:")) != EOF){
         switch (d) {
         case 'h':   usage();        return 0;
         case 'v':   verbose = 1;    break;
@@ -205,6 +289,41 @@ int main(int argc, char *argv[])
             strncpy(filename,optarg,255);
             filename[255] = '\0';
             break;
+        case 'r':
+            num_reps = atoi(optarg);
+            if (num_reps < 1 || num_reps > 1000) {
+                printf("error: number of repetitions must be in [1,1000]\n");
+                return -1;
+            }
+            break;
+        case 'w':
+            num_warmup = atoi(optarg);
+            break;
+        case 'C':
+            cpu = atoi(optarg);
+            break;
+        case 'P':
+            use_counters = 1;
+            break;
+        case 'j':
+            num_threads = atoi(optarg);
+            if (num_threads < 1 || num_threads > 1024) {
+                printf("error: number of threads must be in [1,1024]\n");
+                return -1;
+            }
+#if !BENCH_HAVE_THREADS
+            printf("error: multi-threaded mode not supported on this platform\n");
+            return -1;
+#endif
+            break;
+        case 'a':
+            if      (strcmp(optarg,"spread" )==0) compact = 0;
+            else if (strcmp(optarg,"compact")==0) compact = 1;
+            else {
+                printf("error: unknown placement policy '%s'\n", optarg);
+                return -1;
+            }
+            break;
         default:
             usage();
             return 0;
@@ -218,6 +337,23 @@ int main(int argc, char *argv[])
         // do nothing
     }
 
+    // determine cpu core for each concurrent instance from all cores this
+    // process may run on; this must precede pinning the main thread, which
+    // would otherwise restrict every instance to the pinned core
+    if (num_threads > 1 && set_thread_placement(num_threads, compact) != 0)
+        return -1;
+
+    // pin to core before estimating clock frequency; concurrent instances
+    // set their own affinity and are unaffected
+    if (cpu >= 0 && pin_to_cpu(cpu) != 0)
+        return -1;
+
+    // open performance counters; disable if none are available
+    if (use_counters && counters_open(&counters) == 0) {
+        fprintf(stderr,"warning: performance counters unavailable\n");
+        use_counters = 0;
+    }
+
     if (cpu_clock_detect)
         estimate_cpu_clock();
 
@@ -291,17 +427,52 @@ int main(int argc, char *argv[])
     fprintf(fid,"  \"cpu_clock\"           : %e,\n", cpu_clock);
     fprintf(fid,"  \"cpu_clock_determined\": \"%s\",\n", cpu_clock_detect ? "estimated" : "specified");
     fprintf(fid,"  \"num_trials\"          : %lu,\n", num_base_trials);
+    // options which change measurement are only recorded when used, so
+    // that default output matches the original format
+    if (num_reps > 1 || num_warmup > 0) {
+        fprintf(fid,"  \"num_reps\"            : %u,\n", num_reps);
+        fprintf(fid,"  \"num_warmup\"          : %u,\n", num_warmup);
+    }
+    if (cpu >= 0)
+        fprintf(fid,"  \"cpu\"                 : %d,\n", cpu);
+    if (use_counters) {
+        fprintf(fid,"  \"counters\"            : [");
+        for (i=0, j=0; i<NUM_COUNTERS; i++) {
+            if (counters.fd[i] >= 0)
+                fprintf(fid,"%s\"%s\"", j++ ? ", " : "", counter_str[i]);
+        }
+        fprintf(fid,"],\n");
+    }
+    if (num_threads > 1) {
+        fprintf(fid,"  \"num_threads\"         : %u,\n", num_threads);
+        fprintf(fid,"  \"thread_cpus\"         : [");
+        for (i=0; i<num_threads && thread_cpu != NULL; i++)
+            fprintf(fid,"%s%d", i ? ", " : "", thread_cpu[i]);
+        fprintf(fid,"],\n");
+    }
     fprintf(fid,"  \"benchmarks\"          : [\n");
     for (i=0; i<NUM_AUTOSCRIPTS; i++) {
-        fprintf(fid,"    {\"id\":%5u, \"trials\":%12u, \"extime\":%12.4e, \"rate\":%12.4e, \"cycles_per_trial\":%12.4e, \"attempts\":%2u, \"name\":\"%s\"}%s\n",
+        fprintf(fid,"    {\"id\":%5u, \"trials\":%12u, \"extime\":%12.4e, \"rate\":%12.4e, \"cycles_per_trial\":%12.4e, \"attempts\":%2u, \"name\":\"%s\"",
                 scripts[i].id,
                 scripts[i].num_trials,
                 scripts[i].extime,
                 scripts[i].rate,
                 scripts[i].cycles_per_trial,
                 scripts[i].num_attempts,
-                scripts[i].name,
-                i==NUM_AUTOSCRIPTS-1 ? "" : ",");
+                scripts[i].name);
+        if (scripts[i].num_reps > 0)
+            output_benchmark_stats(fid, &scripts[i]);
+        if (scripts[i].num_threads > 0)
+            output_benchmark_scaling(fid, &scripts[i]);
+        if (scripts[i].num_metrics > 0) {
+            fprintf(fid,", \"metrics\":{");
+            for (j=0; j<scripts[i].num_metrics; j++) {
+                fprintf(fid,"%s\"%s\":%12.4e", j ? ", " : "",
+                        scripts[i].metric_name[j], scripts[i].metric_value[j]);
+            }
+            fprintf(fid,"}");
+        }
+        fprintf(fid,"}%s\n", i==NUM_AUTOSCRIPTS-1 ? "" : ",");
     }
     fprintf(fid,"  ]\n");
     fprintf(fid,"}\n");
@@ -309,6 +480,15 @@ int main(int argc, char *argv[])
     if (verbose)
         printf("output JSON results written to %s\n", filename);
 
+    // clean up allocated statistics
+    for (i=0; i<NUM_AUTOSCRIPTS; i++) {
+        free(scripts[i].samples);
+        free(scripts[i].counters);
+        free(scripts[i].rate_thread);
+    }
+    free(thread_cpu);
+    if (use_counters)
+        counters_close(&counters);
     return 0;
 }
 
@@ -374,6 +554,7 @@ void execute_benchmark(benchmark_t* _benchmark, int _verbose)
 
     unsigned int num_attempts = 0;
     unsigned long int num_trials;
+    benchmark_current = _benchmark;
     do {
         // increment number of attempts
         num_attempts++;
@@ -400,10 +581,141 @@ void execute_benchmark(benchmark_t* _benchmark, int _verbose)
     _benchmark->rate = _benchmark->extime==0 ? 0 : (float)(_benchmark->num_trials) / _benchmark->extime;
     _benchmark->cycles_per_trial = _benchmark->extime==0 ? 0 : cpu_clock / (_benchmark->rate);
 
+    // run timed repetitions with the calibrated number of trials
+    if (num_reps > 1 || num_warmup > 0 || use_counters)
+        execute_benchmark_reps(_benchmark, n);
+
+    // run concurrent instances with the calibrated number of trials;
+    // metrics reported by these instances are ignored
+    benchmark_current = NULL;
+    if (num_threads > 1)
+        execute_benchmark_scaling(_benchmark, n);
+
     if (_verbose)
         print_benchmark_results(_benchmark);
 }
 
+// report auxiliary metric for benchmark currently being run
+void benchmark_report(const char * _name,
+                      double       _value)
+{
+    benchmark_t * b = benchmark_current;
+    if (b == NULL)
+        return;
+
+    // replace existing value
+    unsigned int i;
+    for (i=0; i<b->num_metrics; i++) {
+        if (strcmp(b->metric_name[i], _name) == 0) {
+            b->metric_value[i] = _value;
+            return;
+        }
+    }
+    if (b->num_metrics == BENCH_MAX_METRICS) {
+        fprintf(stderr,"warning: benchmark_report(), too many metrics for '%s'\n", b->name);
+        return;
+    }
+    b->metric_name [b->num_metrics] = _name;
+    b->metric_value[b->num_metrics] = _value;
+    b->num_metrics++;
+}
+
+// compare function for sorting
+int compare_float(const void * _a, const void * _b)
+{
+    float a = *(const float*)_a;
+    float b = *(const float*)_b;
+    return a < b ? -1 : (a > b ? 1 : 0);
+}
+
+// run warm-up and timed repetitions of benchmark and compute statistics
+// of the execution time per trial. Performance counters are measured
+// over each call and set-up costs are removed by subtracting a baseline
+// call with a single trial:
+//   counter/trial = (C(n) - C(1)) / (trials(n) - trials(1))
+void execute_benchmark_reps(benchmark_t*      _benchmark,
+                            unsigned long int _n)
+{
+    struct rusage start, finish;
+    unsigned long int num_trials;
+    unsigned int r, k;
+
+    // warm-up runs
+    for (r=0; r<num_warmup; r++) {
+        num_trials = _n;
+        _benchmark->api(&start, &finish, &num_trials);
+    }
+
+    // baseline call for performance counters
+    double c0[NUM_COUNTERS], c1[NUM_COUNTERS], c_base[NUM_COUNTERS];
+    unsigned long int t_base = 1;
+    if (use_counters) {
+        counters_read(&counters, c0);
+        _benchmark->api(&start, &finish, &t_base);
+        counters_read(&counters, c1);
+        for (k=0; k<NUM_COUNTERS; k++)
+            c_base[k] = c1[k] - c0[k];
+    }
+
+    // timed repetitions
+    float  * samples = (float *) malloc(num_reps*sizeof(float));
+    double * c_trial = (double*) malloc(num_reps*NUM_COUNTERS*sizeof(double));
+    for (r=0; r<num_reps; r++) {
+        num_trials = _n;
+        if (use_counters) counters_read(&counters, c0);
+        _benchmark->api(&start, &finish, &num_trials);
+        if (use_counters) counters_read(&counters, c1);
+
+        samples[r] = num_trials == 0 ? 0 : calculate_execution_time(start, finish) / num_trials;
+        for (k=0; k<NUM_COUNTERS; k++) {
+            c_trial[k*num_reps + r] = !use_counters || num_trials <= t_base ? NAN :
+                (c1[k] - c0[k] - c_base[k]) / (double)(num_trials - t_base);
+        }
+    }
+
+    // sort execution times and compute median, 95th percentile, and
+    // distribution-free 95% confidence interval of the median
+    float * t = (float*) malloc(num_reps*sizeof(float));
+    memmove(t, samples, num_reps*sizeof(float));
+    qsort(t, num_reps, sizeof(float), compare_float);
+    int R  = (int)num_reps;
+    int i0 = (int)floorf(0.5f*(R - 1.96f*sqrtf(R)));        // lower order statistic
+    int i1 = (int)ceilf (0.5f*(R + 1.96f*sqrtf(R)));        // upper order statistic
+    int i95= (int)ceilf (0.95f*R) - 1;
+    _benchmark->time_median  = R % 2 ? t[R/2] : 0.5f*(t[R/2-1] + t[R/2]);
+    _benchmark->time_p95     = t[i95 < 0 ? 0 : i95];
+    _benchmark->time_ci95[0] = t[i0 < 0 ? 0 : i0];
+    _benchmark->time_ci95[1] = t[i1 > R-1 ? R-1 : i1];
+    free(t);
+
+    // median of each counter
+    double * c = (double*) malloc(NUM_COUNTERS*sizeof(double));
+    for (k=0; k<NUM_COUNTERS; k++) {
+        if (!use_counters || counters.fd[k] < 0 || isnan(c_trial[k*num_reps])) {
+            c[k] = NAN;
+            continue;
+        }
+        float v[num_reps];
+        for (r=0; r<num_reps; r++)
+            v[r] = (float)c_trial[k*num_reps + r];
+        qsort(v, num_reps, sizeof(float), compare_float);
+        c[k] = R % 2 ? v[R/2] : 0.5f*(v[R/2-1] + v[R/2]);
+    }
+    free(c_trial);
+
+    // store results, replacing calibration values
+    free(_benchmark->samples);
+    free(_benchmark->counters);
+    _benchmark->num_reps = num_reps;
+    _benchmark->samples  = samples;
+    _benchmark->counters = c;
+    if (_benchmark->time_median > 0) {
+        _benchmark->rate = 1.0f / _benchmark->time_median;
+        _benchmark->cycles_per_trial = isnan(c[COUNTER_CYCLES]) ?
+            cpu_clock * _benchmark->time_median : (float)c[COUNTER_CYCLES];
+    }
+}
+
 void execute_package(package_t* _package, int _verbose)
 {
     if (_verbose)
@@ -457,6 +769,80 @@ void print_benchmark_results(benchmark_t* _b)
         extime_format, extime_units,
         rate_format, rate_units,
         cycles_format, cycles_units);
+    print_benchmark_stats(_b);
+
+    // print results from multi-threaded scaling mode
+    if (_b->num_threads > 0) {
+        float r[3] = {_b->rate_single, _b->rate_aggregate, _b->rate_aggregate / _b->num_threads};
+        char  u[3];
+        unsigned int i;
+        for (i=0; i<3; i++)
+            u[i] = convert_units(&r[i]);
+        printf("         %u threads: single %6.2f %ct/s, aggregate %6.2f %ct/s, per thread %6.2f %ct/s, efficiency %5.1f%%\n",
+            _b->num_threads, r[0], u[0], r[1], u[1], r[2], u[2], 100*_b->efficiency);
+    }
+
+    // print auxiliary metrics reported by benchmark
+    unsigned int m;
+    for (m=0; m<_b->num_metrics; m++)
+        printf("%s%s %.4g%s", m ? ", " : "         ", _b->metric_name[m], _b->metric_value[m],
+                m+1 == _b->num_metrics ? "\n" : "");
+}
+
+// print statistics from repeated runs and performance counters
+void print_benchmark_stats(benchmark_t* _b)
+{
+    if (_b->num_reps == 0)
+        return;
+
+    float v[4] = {_b->time_median, _b->time_p95, _b->time_ci95[0], _b->time_ci95[1]};
+    char  u[4];
+    unsigned int i;
+    for (i=0; i<4; i++)
+        u[i] = convert_units(&v[i]);
+    printf("         median %6.2f %cs, p95 %6.2f %cs, ci95 [%6.2f %cs, %6.2f %cs] (%u reps)\n",
+        v[0], u[0], v[1], u[1], v[2], u[2], v[3], u[3], _b->num_reps);
+
+    // print available performance counters (per trial)
+    int n = 0;
+    for (i=COUNTER_CYCLES; i<NUM_COUNTERS; i++) {
+        if (_b->counters == NULL || isnan(_b->counters[i]))
+            continue;
+        printf("%s%s/t %.4g", n++ ? ", " : "         ", counter_str[i], _b->counters[i]);
+    }
+    if (n > 0 && !isnan(_b->counters[COUNTER_CYCLES]) && !isnan(_b->counters[COUNTER_INSTRUCTIONS]))
+        printf(", ipc %.3f", _b->counters[COUNTER_INSTRUCTIONS] / _b->counters[COUNTER_CYCLES]);
+    if (n > 0)
+        printf("\n");
+}
+
+// write statistics from repeated runs and performance counters
+void output_benchmark_stats(FILE * _fid, benchmark_t * _b)
+{
+    unsigned int i;
+    fprintf(_fid,", \"reps\":%u, \"time_median\":%12.4e, \"time_p95\":%12.4e, \"time_ci95\":[%12.4e,%12.4e]",
+            _b->num_reps, _b->time_median, _b->time_p95, _b->time_ci95[0], _b->time_ci95[1]);
+    fprintf(_fid,", \"counters\":{");
+    int n = 0;
+    for (i=0; i<NUM_COUNTERS; i++) {
+        if (_b->counters != NULL && !isnan(_b->counters[i]))
+            fprintf(_fid,"%s\"%s\":%12.4e", n++ ? ", " : "", counter_str[i], _b->counters[i]);
+    }
+    fprintf(_fid,"}, \"samples\":[");
+    for (i=0; i<_b->num_reps; i++)
+        fprintf(_fid,"%s%.4e", i ? "," : "", _b->samples[i]);
+    fprintf(_fid,"]");
+}
+
+// write results from multi-threaded scaling mode
+void output_benchmark_scaling(FILE * _fid, benchmark_t * _b)
+{
+    unsigned int i;
+    fprintf(_fid,", \"threads\":%u, \"rate_single\":%12.4e, \"rate_aggregate\":%12.4e, \"efficiency\":%8.4f, \"rate_thread\":[",
+            _b->num_threads, _b->rate_single, _b->rate_aggregate, _b->efficiency);
+    for (i=0; i<_b->num_threads; i++)
+        fprintf(_fid,"%s%.4e", i ? "," : "", _b->rate_thread[i]);
+    fprintf(_fid,"]");
 }
 
 void print_package_results(package_t* _package)
@@ -476,3 +862,275 @@ double calculate_execution_time(struct rusage _start, struct rusage _finish)
         + _finish.ru_stime.tv_sec - _start.ru_stime.tv_sec
         + 1e-6*(_finish.ru_stime.tv_usec - _start.ru_stime.tv_usec);
 }
+
+// pin calling thread to cpu core
+int pin_to_cpu(int _cpu)
+{
+#if BENCH_HAVE_PERF
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(_cpu, &set);
+    if (sched_setaffinity(0, sizeof(cpu_set_t), &set) != 0) {
+        fprintf(stderr,"error: could not pin to cpu %d\n", _cpu);
+        return -1;
+    }
+    return 0;
+#else
+    fprintf(stderr,"error: cpu pinning not supported on this platform\n");
+    return -1;
+#endif
+}
+
+// open performance counters for calling thread, returning the number
+// of counters available (not all hosts expose hardware counters)
+int counters_open(counters_t * _c)
+{
+    unsigned int i;
+    int num_open = 0;
+    for (i=0; i<NUM_COUNTERS; i++) {
+        _c->fd[i] = -1;
+#if BENCH_HAVE_PERF
+        struct perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size           = sizeof(attr);
+        attr.type           = i == COUNTER_TASK_CLOCK ? PERF_TYPE_SOFTWARE : PERF_TYPE_HARDWARE;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv     = 1;
+        switch (i) {
+        case COUNTER_TASK_CLOCK:    attr.config = PERF_COUNT_SW_TASK_CLOCK;         break;
+        case COUNTER_CYCLES:        attr.config = PERF_COUNT_HW_CPU_CYCLES;         break;
+        case COUNTER_INSTRUCTIONS:  attr.config = PERF_COUNT_HW_INSTRUCTIONS;       break;
+        case COUNTER_CACHE_MISSES:  attr.config = PERF_COUNT_HW_CACHE_MISSES;       break;
+        case COUNTER_BRANCH_MISSES: attr.config = PERF_COUNT_HW_BRANCH_MISSES;      break;
+        default:;
+        }
+        _c->fd[i] = (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+        if (_c->fd[i] >= 0)
+            num_open++;
+#endif
+    }
+    return num_open;
+}
+
+// close performance counters
+void counters_close(counters_t * _c)
+{
+    unsigned int i;
+    for (i=0; i<NUM_COUNTERS; i++) {
+#if BENCH_HAVE_PERF
+        if (_c->fd[i] >= 0)
+            close(_c->fd[i]);
+#endif
+        _c->fd[i] = -1;
+    }
+}
+
+// read current value of performance counters (NAN if unavailable)
+void counters_read(counters_t * _c, double * _v)
+{
+    unsigned int i;
+    for (i=0; i<NUM_COUNTERS; i++) {
+        _v[i] = NAN;
+#if BENCH_HAVE_PERF
+        unsigned long long int value;
+        if (_c->fd[i] >= 0 && read(_c->fd[i], &value, sizeof(value)) == sizeof(value))
+            _v[i] = (double)value;
+#endif
+    }
+}
+
+#if BENCH_HAVE_THREADS
+// read integer from sysfs file, returning -1 on failure
+int read_sysfs_int(const char * _path)
+{
+    FILE * f = fopen(_path, "r");
+    if (f == NULL)
+        return -1;
+    int v = -1;
+    if (fscanf(f, "%d", &v) != 1)
+        v = -1;
+    fclose(f);
+    return v;
+}
+
+// get NUMA node of cpu core from sysfs (0 if unknown)
+int get_cpu_node(int _cpu)
+{
+    char path[128];
+    snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d", _cpu);
+    DIR * d = opendir(path);
+    if (d == NULL)
+        return 0;
+    int node = 0;
+    struct dirent * e;
+    while ((e = readdir(d)) != NULL) {
+        if (strncmp(e->d_name, "node", 4) == 0 && sscanf(e->d_name+4, "%d", &node) == 1)
+            break;
+    }
+    closedir(d);
+    return node;
+}
+
+// placement of a cpu core: NUMA node, SMT rank (0 for the first hardware
+// thread of a physical core), and position among cores with the same node
+// and rank
+typedef struct {
+    int cpu;
+    int node;
+    int smt;
+    int pos;
+} cpu_place_t;
+int placement_compact = 0;
+
+int compare_cpu_place(const void * _a, const void * _b)
+{
+    const cpu_place_t * a = (const cpu_place_t*)_a;
+    const cpu_place_t * b = (const cpu_place_t*)_b;
+    // fill physical cores before SMT siblings; spread interleaves NUMA
+    // nodes while compact fills one node before moving to the next
+    int ka[3] = {a->smt, placement_compact ? a->node : a->pos, placement_compact ? a->pos : a->node};
+    int kb[3] = {b->smt, placement_compact ? b->node : b->pos, placement_compact ? b->pos : b->node};
+    unsigned int i;
+    for (i=0; i<3; i++) {
+        if (ka[i] != kb[i])
+            return ka[i] < kb[i] ? -1 : 1;
+    }
+    return 0;
+}
+#endif
+
+// determine cpu core for each of _num_threads instances among the cores
+// this process may run on, wrapping around if there are more threads
+// than cores
+int set_thread_placement(unsigned int _num_threads, int _compact)
+{
+#if BENCH_HAVE_THREADS
+    cpu_set_t set;
+    if (sched_getaffinity(0, sizeof(cpu_set_t), &set) != 0) {
+        fprintf(stderr,"error: could not get cpu affinity\n");
+        return -1;
+    }
+    int num_cpus = CPU_COUNT(&set);
+    cpu_place_t * p = (cpu_place_t*) malloc(num_cpus*sizeof(cpu_place_t));
+    int i, j, n = 0;
+    char path[128];
+    for (i=0; i<CPU_SETSIZE && n<num_cpus; i++) {
+        if (!CPU_ISSET(i, &set))
+            continue;
+        p[n].cpu  = i;
+        p[n].node = get_cpu_node(i);
+        // first entry in sibling list is the primary hardware thread
+        snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/topology/thread_siblings_list", i);
+        int first = read_sysfs_int(path);
+        p[n].smt  = (first < 0 || first == i) ? 0 : 1;
+        p[n].pos  = 0;
+        for (j=0; j<n; j++)
+            p[n].pos += (p[j].node == p[n].node && p[j].smt == p[n].smt);
+        n++;
+    }
+    placement_compact = _compact;
+    qsort(p, n, sizeof(cpu_place_t), compare_cpu_place);
+
+    free(thread_cpu);
+    thread_cpu = (int*) malloc(_num_threads*sizeof(int));
+    printf("  placing %u instances (%s):", _num_threads, _compact ? "compact" : "spread");
+    for (i=0; i<(int)_num_threads; i++) {
+        thread_cpu[i] = p[i % n].cpu;
+        printf(" %d", thread_cpu[i]);
+    }
+    printf("\n");
+    if ((int)_num_threads > n)
+        fprintf(stderr,"warning: %u threads oversubscribe %d available cores\n", _num_threads, n);
+    free(p);
+    return 0;
+#else
+    fprintf(stderr,"error: multi-threaded mode not supported on this platform\n");
+    return -1;
+#endif
+}
+
+#if BENCH_HAVE_THREADS
+// state of each concurrent benchmark instance
+typedef struct {
+    benchmark_t *       benchmark;  // benchmark to run
+    int                 cpu;        // cpu core to pin to
+    unsigned long int   num_trials; // requested/performed number of trials
+    double              t0, t1;     // wall-clock start/finish times (s)
+    pthread_barrier_t * barrier;    // start all instances together
+} bench_thread_t;
+
+double get_wall_time(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + 1e-9*ts.tv_nsec;
+}
+
+void * bench_thread_run(void * _arg)
+{
+    bench_thread_t * q = (bench_thread_t*)_arg;
+    struct rusage start, finish;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(q->cpu, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &set);
+    pthread_barrier_wait(q->barrier);
+    q->t0 = get_wall_time();
+    q->benchmark->api(&start, &finish, &q->num_trials);
+    q->t1 = get_wall_time();
+    return NULL;
+}
+
+// run _num_threads instances of benchmark concurrently, returning the
+// aggregate rate and writing the rate of each instance to _rate
+float run_benchmark_threads(benchmark_t *     _benchmark,
+                            unsigned long int _n,
+                            unsigned int      _num_threads,
+                            float *           _rate)
+{
+    bench_thread_t *  q = (bench_thread_t*) malloc(_num_threads*sizeof(bench_thread_t));
+    pthread_t *       t = (pthread_t*)      malloc(_num_threads*sizeof(pthread_t));
+    pthread_barrier_t barrier;
+    pthread_barrier_init(&barrier, NULL, _num_threads);
+    unsigned int i;
+    for (i=0; i<_num_threads; i++) {
+        q[i].benchmark  = _benchmark;
+        q[i].cpu        = thread_cpu[i];
+        q[i].num_trials = _n;
+        q[i].barrier    = &barrier;
+        pthread_create(&t[i], NULL, bench_thread_run, &q[i]);
+    }
+    double t0 = 0, t1 = 0, num_trials = 0;
+    for (i=0; i<_num_threads; i++) {
+        pthread_join(t[i], NULL);
+        t0 = (i==0 || q[i].t0 < t0) ? q[i].t0 : t0;
+        t1 = (i==0 || q[i].t1 > t1) ? q[i].t1 : t1;
+        num_trials += q[i].num_trials;
+        if (_rate != NULL)
+            _rate[i] = q[i].t1 > q[i].t0 ? q[i].num_trials / (q[i].t1 - q[i].t0) : 0;
+    }
+    pthread_barrier_destroy(&barrier);
+    free(q);
+    free(t);
+    return t1 > t0 ? num_trials / (t1 - t0) : 0;
+}
+#endif
+
+// run benchmark as independent concurrent instances pinned to cores to
+// measure how throughput scales when shared resources (memory bandwidth,
+// last-level cache) are contended. Timing uses the wall clock as process
+// resource usage is shared by all threads; the single-instance reference
+// is measured the same way.
+void execute_benchmark_scaling(benchmark_t*      _benchmark,
+                               unsigned long int _n)
+{
+#if BENCH_HAVE_THREADS
+    free(_benchmark->rate_thread);
+    _benchmark->num_threads    = num_threads;
+    _benchmark->rate_thread    = (float*) malloc(num_threads*sizeof(float));
+    _benchmark->rate_single    = run_benchmark_threads(_benchmark, _n, 1, NULL);
+    _benchmark->rate_aggregate = run_benchmark_threads(_benchmark, _n, num_threads, _benchmark->rate_thread);
+    _benchmark->efficiency     = _benchmark->rate_single == 0 ? 0 :
+        _benchmark->rate_aggregate / (num_threads * _benchmark->rate_single);
+#endif
+}
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Interface between benchmark scripts and the benchmark program
+//
+
+#ifndef __LIQUID_BENCH_H__
+#define __LIQUID_BENCH_H__
+
+// maximum number of auxiliary metrics per benchmark
+#define BENCH_MAX_METRICS (8)
+
+// Report an auxiliary metric for the benchmark currently being run,
+// e.g. frames/s or the time spent in one stage of a processing chain.
+// Reporting the same name again replaces its value. Reports from the
+// concurrent instances of the multi-threaded scaling mode are ignored.
+//  _name   : metric name (string literal)
+//  _value  : metric value
+void benchmark_report(const char * _name,
+                      double       _value);
+
+#endif // __LIQUID_BENCH_H__
@@ -0,0 +1,3104 @@
+// adding null to package null from bench/null_benchmark.c:27
+// adding agc_crcf to package agc_crcf from src/agc/bench/agc_crcf_benchmark.c:28
+// adding cvsd_encode to package cvsd from src/audio/bench/cvsd_benchmark.c:27
+// adding cvsd_decode to package cvsd from src/audio/bench/cvsd_benchmark.c:70
+// adding cbuffercf_n16 to package cbuffercf from src/buffer/bench/cbuffercf_benchmark.c:99
+// adding cbuffercf_n32 to package cbuffercf from src/buffer/bench/cbuffercf_benchmark.c:100
+// adding cbuffercf_n64 to package cbuffercf from src/buffer/bench/cbuffercf_benchmark.c:101
+// adding cbuffercf_n128 to package cbuffercf from src/buffer/bench/cbuffercf_benchmark.c:102
+// adding cbuffercf_n256 to package cbuffercf from src/buffer/bench/cbuffercf_benchmark.c:103
+// adding cbuffercf_n512 to package cbuffercf from src/buffer/bench/cbuffercf_benchmark.c:104
+// adding cbuffercf_n1024 to package cbuffercf from src/buffer/bench/cbuffercf_benchmark.c:105
+// adding windowcf_push_n16 to package window_push from src/buffer/bench/window_push_benchmark.c:63
+// adding windowcf_push_n32 to package window_push from src/buffer/bench/window_push_benchmark.c:64
+// adding windowcf_push_n64 to package window_push from src/buffer/bench/window_push_benchmark.c:65
+// adding windowcf_push_n128 to package window_push from src/buffer/bench/window_push_benchmark.c:66
+// adding windowcf_push_n256 to package window_push from src/buffer/bench/window_push_benchmark.c:67
+// adding windowcf_read_n16 to package window_read from src/buffer/bench/window_read_benchmark.c:64
+// adding windowcf_read_n32 to package window_read from src/buffer/bench/window_read_benchmark.c:65
+// adding windowcf_read_n64 to package window_read from src/buffer/bench/window_read_benchmark.c:66
+// adding windowcf_read_n128 to package window_read from src/buffer/bench/window_read_benchmark.c:67
+// adding windowcf_read_n256 to package window_read from src/buffer/bench/window_read_benchmark.c:68
+// adding dotprod_cccf_4 to package dotprod_cccf from src/dotprod/bench/dotprod_cccf_benchmark.c:73
+// adding dotprod_cccf_16 to package dotprod_cccf from src/dotprod/bench/dotprod_cccf_benchmark.c:74
+// adding dotprod_cccf_64 to package dotprod_cccf from src/dotprod/bench/dotprod_cccf_benchmark.c:75
+// adding dotprod_cccf_256 to package dotprod_cccf from src/dotprod/bench/dotprod_cccf_benchmark.c:76
+// adding dotprod_crcf_4 to package dotprod_crcf from src/dotprod/bench/dotprod_crcf_benchmark.c:73
+// adding dotprod_crcf_16 to package dotprod_crcf from src/dotprod/bench/dotprod_crcf_benchmark.c:74
+// adding dotprod_crcf_64 to package dotprod_crcf from src/dotprod/bench/dotprod_crcf_benchmark.c:75
+// adding dotprod_crcf_256 to package dotprod_crcf from src/dotprod/bench/dotprod_crcf_benchmark.c:76
+// adding dotprod_rrrf_4 to package dotprod_rrrf from src/dotprod/bench/dotprod_rrrf_benchmark.c:67
+// adding dotprod_rrrf_16 to package dotprod_rrrf from src/dotprod/bench/dotprod_rrrf_benchmark.c:68
+// adding dotprod_rrrf_64 to package dotprod_rrrf from src/dotprod/bench/dotprod_rrrf_benchmark.c:69
+// adding dotprod_rrrf_256 to package dotprod_rrrf from src/dotprod/bench/dotprod_rrrf_benchmark.c:70
+// adding sumsqf_4 to package sumsqf from src/dotprod/bench/sumsqf_benchmark.c:63
+// adding sumsqf_16 to package sumsqf from src/dotprod/bench/sumsqf_benchmark.c:64
+// adding sumsqf_64 to package sumsqf from src/dotprod/bench/sumsqf_benchmark.c:65
+// adding sumsqf_256 to package sumsqf from src/dotprod/bench/sumsqf_benchmark.c:66
+// adding sumsqcf_4 to package sumsqcf from src/dotprod/bench/sumsqcf_benchmark.c:63
+// adding sumsqcf_16 to package sumsqcf from src/dotprod/bench/sumsqcf_benchmark.c:64
+// adding sumsqcf_64 to package sumsqcf from src/dotprod/bench/sumsqcf_benchmark.c:65
+// adding sumsqcf_256 to package sumsqcf from src/dotprod/bench/sumsqcf_benchmark.c:66
+// adding eqlms_cccf_n4 to package eqlms_cccf from src/equalization/bench/eqlms_cccf_benchmark.c:81
+// adding eqlms_cccf_n8 to package eqlms_cccf from src/equalization/bench/eqlms_cccf_benchmark.c:82
+// adding eqlms_cccf_n16 to package eqlms_cccf from src/equalization/bench/eqlms_cccf_benchmark.c:83
+// adding eqlms_cccf_n32 to package eqlms_cccf from src/equalization/bench/eqlms_cccf_benchmark.c:84
+// adding eqlms_cccf_n64 to package eqlms_cccf from src/equalization/bench/eqlms_cccf_benchmark.c:85
+// adding eqrls_cccf_n4 to package eqrls_cccf from src/equalization/bench/eqrls_cccf_benchmark.c:85
+// adding eqrls_cccf_n8 to package eqrls_cccf from src/equalization/bench/eqrls_cccf_benchmark.c:86
+// adding eqrls_cccf_n16 to package eqrls_cccf from src/equalization/bench/eqrls_cccf_benchmark.c:87
+// adding eqrls_cccf_n32 to package eqrls_cccf from src/equalization/bench/eqrls_cccf_benchmark.c:88
+// adding eqrls_cccf_n64 to package eqrls_cccf from src/equalization/bench/eqrls_cccf_benchmark.c:89
+// adding eqrls_cccf_invqr_n16 to package eqrls_cccf from src/equalization/bench/eqrls_cccf_benchmark.c:91
+// adding eqrls_cccf_invqr_n64 to package eqrls_cccf from src/equalization/bench/eqrls_cccf_benchmark.c:92
+// adding eqrls_cccf_ftf_n16 to package eqrls_cccf from src/equalization/bench/eqrls_cccf_benchmark.c:94
+// adding eqrls_cccf_ftf_n64 to package eqrls_cccf from src/equalization/bench/eqrls_cccf_benchmark.c:95
+// adding eqrls_cccf_ftf_n256 to package eqrls_cccf from src/equalization/bench/eqrls_cccf_benchmark.c:96
+// adding crc_checksum_n256 to package crc from src/fec/bench/crc_benchmark.c:76
+// adding crc_crc8_n256 to package crc from src/fec/bench/crc_benchmark.c:78
+// adding crc_crc16_n256 to package crc from src/fec/bench/crc_benchmark.c:79
+// adding crc_crc24_n256 to package crc from src/fec/bench/crc_benchmark.c:80
+// adding crc_crc32_n256 to package crc from src/fec/bench/crc_benchmark.c:81
+// adding fec_enc_none_n64 to package fec_encode from src/fec/bench/fec_encode_benchmark.c:140
+// adding fec_enc_rep3_n64 to package fec_encode from src/fec/bench/fec_encode_benchmark.c:142
+// adding fec_enc_rep5_n64 to package fec_encode from src/fec/bench/fec_encode_benchmark.c:143
+// adding fec_enc_hamming74_n64 to package fec_encode from src/fec/bench/fec_encode_benchmark.c:144
+// adding fec_enc_hamming84_n64 to package fec_encode from src/fec/bench/fec_encode_benchmark.c:145
+// adding fec_enc_hamming128_n64 to package fec_encode from src/fec/bench/fec_encode_benchmark.c:146
+// adding fec_enc_secded2216_n64 to package fec_encode from src/fec/bench/fec_encode_benchmark.c:149
+// adding fec_enc_secded3932_n64 to package fec_encode from src/fec/bench/fec_encode_benchmark.c:150
+// adding fec_enc_secded7264_n64 to package fec_encode from src/fec/bench/fec_encode_benchmark.c:151
+// adding fec_enc_golay2412_n64 to package fec_encode from src/fec/bench/fec_encode_benchmark.c:153
+// adding fec_enc_conv27_n64 to package fec_encode from src/fec/bench/fec_encode_benchmark.c:155
+// adding fec_enc_conv29_n64 to package fec_encode from src/fec/bench/fec_encode_benchmark.c:156
+// adding fec_enc_conv39_n64 to package fec_encode from src/fec/bench/fec_encode_benchmark.c:157
+// adding fec_enc_conv615_n64 to package fec_encode from src/fec/bench/fec_encode_benchmark.c:158
+// adding fec_enc_conv27p23_n64 to package fec_encode from src/fec/bench/fec_encode_benchmark.c:160
+// adding fec_enc_conv27p34_n64 to package fec_encode from src/fec/bench/fec_encode_benchmark.c:161
+// adding fec_enc_conv27p45_n64 to package fec_encode from src/fec/bench/fec_encode_benchmark.c:162
+// adding fec_enc_rs8_n64 to package fec_encode from src/fec/bench/fec_encode_benchmark.c:164
+// adding fec_enc_rs8_n223 to package fec_encode from src/fec/bench/fec_encode_benchmark.c:165
+// adding fec_enc_rs8_n1024 to package fec_encode from src/fec/bench/fec_encode_benchmark.c:166
+// adding fec_enc_ldpc12_n64 to package fec_encode from src/fec/bench/fec_encode_benchmark.c:168
+// adding fec_enc_ldpc12_n144 to package fec_encode from src/fec/bench/fec_encode_benchmark.c:169
+// adding fec_enc_ldpc34_n216 to package fec_encode from src/fec/bench/fec_encode_benchmark.c:170
+// adding fec_dec_none_n64 to package fec_decode from src/fec/bench/fec_decode_benchmark.c:146
+// adding fec_dec_rep3_n64 to package fec_decode from src/fec/bench/fec_decode_benchmark.c:148
+// adding fec_dec_rep5_n64 to package fec_decode from src/fec/bench/fec_decode_benchmark.c:149
+// adding fec_dec_hamming74_n64 to package fec_decode from src/fec/bench/fec_decode_benchmark.c:150
+// adding fec_dec_hamming84_n64 to package fec_decode from src/fec/bench/fec_decode_benchmark.c:151
+// adding fec_dec_hamming128_n64 to package fec_decode from src/fec/bench/fec_decode_benchmark.c:152
+// adding fec_dec_secded2216_n64 to package fec_decode from src/fec/bench/fec_decode_benchmark.c:155
+// adding fec_dec_secded3932_n64 to package fec_decode from src/fec/bench/fec_decode_benchmark.c:156
+// adding fec_dec_secded7264_n64 to package fec_decode from src/fec/bench/fec_decode_benchmark.c:157
+// adding fec_dec_golay2412_n64 to package fec_decode from src/fec/bench/fec_decode_benchmark.c:159
+// adding fec_dec_conv27_n64 to package fec_decode from src/fec/bench/fec_decode_benchmark.c:161
+// adding fec_dec_conv29_n64 to package fec_decode from src/fec/bench/fec_decode_benchmark.c:162
+// adding fec_dec_conv39_n64 to package fec_decode from src/fec/bench/fec_decode_benchmark.c:163
+// adding fec_dec_conv615_n64 to package fec_decode from src/fec/bench/fec_decode_benchmark.c:164
+// adding fec_dec_conv27p23_n64 to package fec_decode from src/fec/bench/fec_decode_benchmark.c:166
+// adding fec_dec_conv27p34_n64 to package fec_decode from src/fec/bench/fec_decode_benchmark.c:167
+// adding fec_dec_conv27p45_n64 to package fec_decode from src/fec/bench/fec_decode_benchmark.c:168
+// adding fec_dec_conv27p56_n64 to package fec_decode from src/fec/bench/fec_decode_benchmark.c:169
+// adding fec_dec_conv27p67_n64 to package fec_decode from src/fec/bench/fec_decode_benchmark.c:170
+// adding fec_dec_conv27p78_n64 to package fec_decode from src/fec/bench/fec_decode_benchmark.c:171
+// adding fec_dec_conv29p23_n64 to package fec_decode from src/fec/bench/fec_decode_benchmark.c:173
+// adding fec_dec_conv29p34_n64 to package fec_decode from src/fec/bench/fec_decode_benchmark.c:174
+// adding fec_dec_conv29p45_n64 to package fec_decode from src/fec/bench/fec_decode_benchmark.c:175
+// adding fec_dec_conv29p56_n64 to package fec_decode from src/fec/bench/fec_decode_benchmark.c:176
+// adding fec_dec_conv29p67_n64 to package fec_decode from src/fec/bench/fec_decode_benchmark.c:177
+// adding fec_dec_conv29p78_n64 to package fec_decode from src/fec/bench/fec_decode_benchmark.c:178
+// adding fec_dec_rs8_n64 to package fec_decode from src/fec/bench/fec_decode_benchmark.c:180
+// adding fec_dec_rs8_n223 to package fec_decode from src/fec/bench/fec_decode_benchmark.c:181
+// adding fec_dec_rs8_n1024 to package fec_decode from src/fec/bench/fec_decode_benchmark.c:182
+// adding fec_dec_ldpc12_n64 to package fec_decode from src/fec/bench/fec_decode_benchmark.c:184
+// adding fec_dec_ldpc12_n144 to package fec_decode from src/fec/bench/fec_decode_benchmark.c:185
+// adding fecsoft_dec_none_n64 to package fecsoft_decode from src/fec/bench/fecsoft_decode_benchmark.c:161
+// adding fecsoft_dec_rep3_n64 to package fecsoft_decode from src/fec/bench/fecsoft_decode_benchmark.c:163
+// adding fecsoft_dec_rep5_n64 to package fecsoft_decode from src/fec/bench/fecsoft_decode_benchmark.c:164
+// adding fecsoft_dec_hamming74_n64 to package fecsoft_decode from src/fec/bench/fecsoft_decode_benchmark.c:165
+// adding fecsoft_dec_hamming84_n64 to package fecsoft_decode from src/fec/bench/fecsoft_decode_benchmark.c:166
+// adding fecsoft_dec_hamming128_n64 to package fecsoft_decode from src/fec/bench/fecsoft_decode_benchmark.c:167
+// adding fecsoft_dec_conv27_n64 to package fecsoft_decode from src/fec/bench/fecsoft_decode_benchmark.c:169
+// adding fecsoft_dec_conv29_n64 to package fecsoft_decode from src/fec/bench/fecsoft_decode_benchmark.c:170
+// adding fecsoft_dec_conv39_n64 to package fecsoft_decode from src/fec/bench/fecsoft_decode_benchmark.c:171
+// adding fecsoft_dec_conv615_n64 to package fecsoft_decode from src/fec/bench/fecsoft_decode_benchmark.c:172
+// adding fecsoft_dec_conv27p23_n64 to package fecsoft_decode from src/fec/bench/fecsoft_decode_benchmark.c:174
+// adding fecsoft_dec_conv27p34_n64 to package fecsoft_decode from src/fec/bench/fecsoft_decode_benchmark.c:175
+// adding fecsoft_dec_conv27p45_n64 to package fecsoft_decode from src/fec/bench/fecsoft_decode_benchmark.c:176
+// adding fecsoft_dec_conv27p56_n64 to package fecsoft_decode from src/fec/bench/fecsoft_decode_benchmark.c:177
+// adding fecsoft_dec_conv27p67_n64 to package fecsoft_decode from src/fec/bench/fecsoft_decode_benchmark.c:178
+// adding fecsoft_dec_conv27p78_n64 to package fecsoft_decode from src/fec/bench/fecsoft_decode_benchmark.c:179
+// adding fecsoft_dec_conv29p23_n64 to package fecsoft_decode from src/fec/bench/fecsoft_decode_benchmark.c:181
+// adding fecsoft_dec_conv29p34_n64 to package fecsoft_decode from src/fec/bench/fecsoft_decode_benchmark.c:182
+// adding fecsoft_dec_conv29p45_n64 to package fecsoft_decode from src/fec/bench/fecsoft_decode_benchmark.c:183
+// adding fecsoft_dec_conv29p56_n64 to package fecsoft_decode from src/fec/bench/fecsoft_decode_benchmark.c:184
+// adding fecsoft_dec_conv29p67_n64 to package fecsoft_decode from src/fec/bench/fecsoft_decode_benchmark.c:185
+// adding fecsoft_dec_conv29p78_n64 to package fecsoft_decode from src/fec/bench/fecsoft_decode_benchmark.c:186
+// adding fecsoft_dec_rs8_n64 to package fecsoft_decode from src/fec/bench/fecsoft_decode_benchmark.c:188
+// adding fecsoft_dec_ldpc12_n64 to package fecsoft_decode from src/fec/bench/fecsoft_decode_benchmark.c:190
+// adding fecsoft_dec_ldpc12_n144 to package fecsoft_decode from src/fec/bench/fecsoft_decode_benchmark.c:191
+// adding fecsoft_dec_ldpc34_n216 to package fecsoft_decode from src/fec/bench/fecsoft_decode_benchmark.c:192
+// adding sumproduct_m16 to package sumproduct from src/fec/bench/sumproduct_benchmark.c:113
+// adding sumproduct_m32 to package sumproduct from src/fec/bench/sumproduct_benchmark.c:114
+// adding sumproduct_m64 to package sumproduct from src/fec/bench/sumproduct_benchmark.c:115
+// adding sumproduct_m128 to package sumproduct from src/fec/bench/sumproduct_benchmark.c:116
+// adding interleaver_8 to package interleaver from src/fec/bench/interleaver_benchmark.c:111
+// adding interleaver_16 to package interleaver from src/fec/bench/interleaver_benchmark.c:112
+// adding interleaver_32 to package interleaver from src/fec/bench/interleaver_benchmark.c:113
+// adding interleaver_64 to package interleaver from src/fec/bench/interleaver_benchmark.c:114
+// adding interleaver_128 to package interleaver from src/fec/bench/interleaver_benchmark.c:115
+// adding interleaver_256 to package interleaver from src/fec/bench/interleaver_benchmark.c:116
+// adding interleaver_512 to package interleaver from src/fec/bench/interleaver_benchmark.c:117
+// adding interleaver_1024 to package interleaver from src/fec/bench/interleaver_benchmark.c:118
+// adding interleaver_soft_64 to package interleaver from src/fec/bench/interleaver_benchmark.c:120
+// adding interleaver_soft_256 to package interleaver from src/fec/bench/interleaver_benchmark.c:121
+// adding interleaver_soft_1024 to package interleaver from src/fec/bench/interleaver_benchmark.c:122
+// adding packetizer_n16 to package packetizer_decode from src/fec/bench/packetizer_decode_benchmark.c:93
+// adding packetizer_n32 to package packetizer_decode from src/fec/bench/packetizer_decode_benchmark.c:94
+// adding packetizer_n64 to package packetizer_decode from src/fec/bench/packetizer_decode_benchmark.c:95
+// adding packetizer_n128 to package packetizer_decode from src/fec/bench/packetizer_decode_benchmark.c:96
+// adding packetizer_n256 to package packetizer_decode from src/fec/bench/packetizer_decode_benchmark.c:97
+// adding packetizer_n512 to package packetizer_decode from src/fec/bench/packetizer_decode_benchmark.c:98
+// adding packetizer_n1024 to package packetizer_decode from src/fec/bench/packetizer_decode_benchmark.c:99
+// adding packetizer_n256_crc32_h74 to package packetizer_decode from src/fec/bench/packetizer_decode_benchmark.c:101
+// adding packetizer_n256_crc32_g2412 to package packetizer_decode from src/fec/bench/packetizer_decode_benchmark.c:102
+// adding fft_6 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:36
+// adding fft_9 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:37
+// adding fft_10 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:38
+// adding fft_12 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:39
+// adding fft_14 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:40
+// adding fft_15 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:41
+// adding fft_18 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:42
+// adding fft_20 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:43
+// adding fft_21 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:44
+// adding fft_22 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:45
+// adding fft_24 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:46
+// adding fft_25 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:47
+// adding fft_26 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:48
+// adding fft_27 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:49
+// adding fft_28 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:50
+// adding fft_30 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:51
+// adding fft_33 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:52
+// adding fft_34 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:53
+// adding fft_35 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:54
+// adding fft_36 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:55
+// adding fft_38 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:56
+// adding fft_39 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:57
+// adding fft_40 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:58
+// adding fft_42 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:59
+// adding fft_44 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:60
+// adding fft_45 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:61
+// adding fft_46 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:62
+// adding fft_48 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:63
+// adding fft_49 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:64
+// adding fft_50 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:65
+// adding fft_51 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:66
+// adding fft_52 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:67
+// adding fft_54 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:68
+// adding fft_55 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:69
+// adding fft_56 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:70
+// adding fft_57 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:71
+// adding fft_58 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:72
+// adding fft_60 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:73
+// adding fft_62 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:74
+// adding fft_63 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:75
+// adding fft_65 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:76
+// adding fft_66 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:77
+// adding fft_68 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:78
+// adding fft_69 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:79
+// adding fft_70 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:80
+// adding fft_72 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:81
+// adding fft_74 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:82
+// adding fft_75 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:83
+// adding fft_76 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:84
+// adding fft_77 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:85
+// adding fft_78 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:86
+// adding fft_80 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:87
+// adding fft_81 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:88
+// adding fft_82 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:89
+// adding fft_84 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:90
+// adding fft_85 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:91
+// adding fft_86 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:92
+// adding fft_87 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:93
+// adding fft_88 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:94
+// adding fft_90 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:95
+// adding fft_91 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:96
+// adding fft_92 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:97
+// adding fft_93 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:98
+// adding fft_94 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:99
+// adding fft_95 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:100
+// adding fft_96 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:101
+// adding fft_98 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:102
+// adding fft_99 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:103
+// adding fft_100 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:104
+// adding fft_102 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:105
+// adding fft_104 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:106
+// adding fft_105 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:107
+// adding fft_106 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:108
+// adding fft_108 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:109
+// adding fft_110 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:110
+// adding fft_111 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:111
+// adding fft_112 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:112
+// adding fft_114 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:113
+// adding fft_115 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:114
+// adding fft_116 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:115
+// adding fft_117 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:116
+// adding fft_118 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:117
+// adding fft_119 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:118
+// adding fft_120 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:119
+// adding fft_121 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:120
+// adding fft_122 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:121
+// adding fft_123 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:122
+// adding fft_124 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:123
+// adding fft_125 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:124
+// adding fft_126 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:125
+// adding fft_129 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:126
+// adding fft_130 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:127
+// adding fft_132 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:128
+// adding fft_133 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:129
+// adding fft_134 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:130
+// adding fft_135 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:131
+// adding fft_136 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:132
+// adding fft_138 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:133
+// adding fft_140 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:134
+// adding fft_141 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:135
+// adding fft_142 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:136
+// adding fft_143 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:137
+// adding fft_144 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:138
+// adding fft_145 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:139
+// adding fft_146 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:140
+// adding fft_147 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:141
+// adding fft_148 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:142
+// adding fft_150 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:143
+// adding fft_152 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:144
+// adding fft_153 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:145
+// adding fft_154 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:146
+// adding fft_155 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:147
+// adding fft_156 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:148
+// adding fft_158 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:149
+// adding fft_159 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:150
+// adding fft_160 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:151
+// adding fft_161 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:152
+// adding fft_162 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:153
+// adding fft_164 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:154
+// adding fft_165 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:155
+// adding fft_166 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:156
+// adding fft_168 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:157
+// adding fft_169 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:158
+// adding fft_170 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:159
+// adding fft_171 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:160
+// adding fft_172 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:161
+// adding fft_174 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:162
+// adding fft_175 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:163
+// adding fft_176 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:164
+// adding fft_177 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:165
+// adding fft_178 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:166
+// adding fft_180 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:167
+// adding fft_182 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:168
+// adding fft_183 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:169
+// adding fft_184 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:170
+// adding fft_185 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:171
+// adding fft_186 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:172
+// adding fft_187 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:173
+// adding fft_188 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:174
+// adding fft_189 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:175
+// adding fft_190 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:176
+// adding fft_192 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:177
+// adding fft_194 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:178
+// adding fft_195 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:179
+// adding fft_196 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:180
+// adding fft_198 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:181
+// adding fft_200 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:182
+// adding fft_201 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:183
+// adding fft_202 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:184
+// adding fft_203 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:185
+// adding fft_204 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:186
+// adding fft_205 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:187
+// adding fft_206 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:188
+// adding fft_207 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:189
+// adding fft_208 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:190
+// adding fft_209 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:191
+// adding fft_210 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:192
+// adding fft_212 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:193
+// adding fft_213 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:194
+// adding fft_214 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:195
+// adding fft_215 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:196
+// adding fft_216 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:197
+// adding fft_217 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:198
+// adding fft_218 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:199
+// adding fft_219 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:200
+// adding fft_220 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:201
+// adding fft_221 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:202
+// adding fft_222 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:203
+// adding fft_224 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:204
+// adding fft_225 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:205
+// adding fft_226 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:206
+// adding fft_228 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:207
+// adding fft_230 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:208
+// adding fft_231 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:209
+// adding fft_232 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:210
+// adding fft_234 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:211
+// adding fft_235 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:212
+// adding fft_236 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:213
+// adding fft_237 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:214
+// adding fft_238 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:215
+// adding fft_240 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:216
+// adding fft_242 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:217
+// adding fft_243 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:218
+// adding fft_244 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:219
+// adding fft_245 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:220
+// adding fft_246 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:221
+// adding fft_247 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:222
+// adding fft_248 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:223
+// adding fft_249 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:224
+// adding fft_250 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:225
+// adding fft_252 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:226
+// adding fft_253 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:227
+// adding fft_254 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:228
+// adding fft_255 to package fft_composite from src/fft/bench/fft_composite_benchmark.c:229
+// adding fft_3 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:35
+// adding fft_5 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:36
+// adding fft_7 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:37
+// adding fft_11 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:38
+// adding fft_13 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:39
+// adding fft_17 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:40
+// adding fft_19 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:41
+// adding fft_23 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:42
+// adding fft_29 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:43
+// adding fft_31 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:44
+// adding fft_37 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:45
+// adding fft_41 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:46
+// adding fft_43 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:47
+// adding fft_47 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:48
+// adding fft_53 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:49
+// adding fft_59 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:50
+// adding fft_61 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:51
+// adding fft_67 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:52
+// adding fft_71 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:53
+// adding fft_73 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:54
+// adding fft_79 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:55
+// adding fft_83 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:56
+// adding fft_89 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:57
+// adding fft_97 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:58
+// adding fft_101 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:59
+// adding fft_103 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:60
+// adding fft_107 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:61
+// adding fft_109 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:62
+// adding fft_113 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:63
+// adding fft_127 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:64
+// adding fft_131 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:65
+// adding fft_137 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:66
+// adding fft_139 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:67
+// adding fft_149 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:68
+// adding fft_151 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:69
+// adding fft_157 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:70
+// adding fft_163 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:71
+// adding fft_167 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:72
+// adding fft_173 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:73
+// adding fft_179 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:74
+// adding fft_181 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:75
+// adding fft_191 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:76
+// adding fft_193 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:77
+// adding fft_197 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:78
+// adding fft_199 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:79
+// adding fft_211 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:80
+// adding fft_223 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:81
+// adding fft_227 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:82
+// adding fft_229 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:83
+// adding fft_233 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:84
+// adding fft_239 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:85
+// adding fft_241 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:86
+// adding fft_251 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:87
+// adding fft_257 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:88
+// adding fft_263 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:89
+// adding fft_269 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:90
+// adding fft_271 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:91
+// adding fft_277 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:92
+// adding fft_281 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:93
+// adding fft_283 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:94
+// adding fft_293 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:95
+// adding fft_307 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:96
+// adding fft_311 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:97
+// adding fft_313 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:98
+// adding fft_317 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:99
+// adding fft_331 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:100
+// adding fft_337 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:101
+// adding fft_347 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:102
+// adding fft_349 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:103
+// adding fft_353 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:104
+// adding fft_359 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:105
+// adding fft_367 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:106
+// adding fft_373 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:107
+// adding fft_379 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:108
+// adding fft_383 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:109
+// adding fft_389 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:110
+// adding fft_397 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:111
+// adding fft_401 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:112
+// adding fft_409 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:113
+// adding fft_419 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:114
+// adding fft_421 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:115
+// adding fft_431 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:116
+// adding fft_433 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:117
+// adding fft_439 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:118
+// adding fft_443 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:119
+// adding fft_449 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:120
+// adding fft_457 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:121
+// adding fft_461 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:122
+// adding fft_463 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:123
+// adding fft_467 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:124
+// adding fft_479 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:125
+// adding fft_487 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:126
+// adding fft_491 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:127
+// adding fft_499 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:128
+// adding fft_503 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:129
+// adding fft_509 to package fft_prime from src/fft/bench/fft_prime_benchmark.c:130
+// adding fft_2 to package fft_radix2 from src/fft/bench/fft_radix2_benchmark.c:35
+// adding fft_4 to package fft_radix2 from src/fft/bench/fft_radix2_benchmark.c:36
+// adding fft_8 to package fft_radix2 from src/fft/bench/fft_radix2_benchmark.c:37
+// adding fft_16 to package fft_radix2 from src/fft/bench/fft_radix2_benchmark.c:38
+// adding fft_32 to package fft_radix2 from src/fft/bench/fft_radix2_benchmark.c:39
+// adding fft_64 to package fft_radix2 from src/fft/bench/fft_radix2_benchmark.c:40
+// adding fft_128 to package fft_radix2 from src/fft/bench/fft_radix2_benchmark.c:41
+// adding fft_256 to package fft_radix2 from src/fft/bench/fft_radix2_benchmark.c:42
+// adding fft_512 to package fft_radix2 from src/fft/bench/fft_radix2_benchmark.c:43
+// adding fft_1024 to package fft_radix2 from src/fft/bench/fft_radix2_benchmark.c:44
+// adding fft_2048 to package fft_radix2 from src/fft/bench/fft_radix2_benchmark.c:45
+// adding fft_4096 to package fft_radix2 from src/fft/bench/fft_radix2_benchmark.c:46
+// adding fft_8192 to package fft_radix2 from src/fft/bench/fft_radix2_benchmark.c:47
+// adding fft_16384 to package fft_radix2 from src/fft/bench/fft_radix2_benchmark.c:48
+// adding fft_32768 to package fft_radix2 from src/fft/bench/fft_radix2_benchmark.c:49
+// adding fft_REDFT00_128 to package fft_r2r from src/fft/bench/fft_r2r_benchmark.c:78
+// adding fft_REDFT01_128 to package fft_r2r from src/fft/bench/fft_r2r_benchmark.c:79
+// adding fft_REDFT10_128 to package fft_r2r from src/fft/bench/fft_r2r_benchmark.c:80
+// adding fft_REDFT11_128 to package fft_r2r from src/fft/bench/fft_r2r_benchmark.c:81
+// adding fft_RODFT00_128 to package fft_r2r from src/fft/bench/fft_r2r_benchmark.c:83
+// adding fft_RODFT01_128 to package fft_r2r from src/fft/bench/fft_r2r_benchmark.c:84
+// adding fft_RODFT10_128 to package fft_r2r from src/fft/bench/fft_r2r_benchmark.c:85
+// adding fft_RODFT11_128 to package fft_r2r from src/fft/bench/fft_r2r_benchmark.c:86
+// adding fft_REDFT00_127 to package fft_r2r from src/fft/bench/fft_r2r_benchmark.c:91
+// adding fft_REDFT01_127 to package fft_r2r from src/fft/bench/fft_r2r_benchmark.c:92
+// adding fft_REDFT10_127 to package fft_r2r from src/fft/bench/fft_r2r_benchmark.c:93
+// adding fft_REDFT11_127 to package fft_r2r from src/fft/bench/fft_r2r_benchmark.c:94
+// adding fft_RODFT00_127 to package fft_r2r from src/fft/bench/fft_r2r_benchmark.c:96
+// adding fft_RODFT01_127 to package fft_r2r from src/fft/bench/fft_r2r_benchmark.c:97
+// adding fft_RODFT10_127 to package fft_r2r from src/fft/bench/fft_r2r_benchmark.c:98
+// adding fft_RODFT11_127 to package fft_r2r from src/fft/bench/fft_r2r_benchmark.c:99
+// adding spgramcf_1200 to package spgramcf from src/fft/bench/spgramcf_benchmark.c:73
+// adding spgramcf_9600 to package spgramcf from src/fft/bench/spgramcf_benchmark.c:76
+// adding spgramcf_76800 to package spgramcf from src/fft/bench/spgramcf_benchmark.c:79
+// adding spgramcf_614400 to package spgramcf from src/fft/bench/spgramcf_benchmark.c:82
+// adding fftfilt_crcf_4 to package fftfilt_crcf from src/filter/bench/fftfilt_crcf_benchmark.c:78
+// adding fftfilt_crcf_8 to package fftfilt_crcf from src/filter/bench/fftfilt_crcf_benchmark.c:79
+// adding fftfilt_crcf_16 to package fftfilt_crcf from src/filter/bench/fftfilt_crcf_benchmark.c:80
+// adding fftfilt_crcf_32 to package fftfilt_crcf from src/filter/bench/fftfilt_crcf_benchmark.c:81
+// adding fftfilt_crcf_64 to package fftfilt_crcf from src/filter/bench/fftfilt_crcf_benchmark.c:82
+// adding firdecim_crcf_m2_h8 to package firdecim_crcf from src/filter/bench/firdecim_crcf_benchmark.c:71
+// adding firdecim_crcf_m4_h16 to package firdecim_crcf from src/filter/bench/firdecim_crcf_benchmark.c:72
+// adding firdecim_crcf_m8_h32 to package firdecim_crcf from src/filter/bench/firdecim_crcf_benchmark.c:73
+// adding firdecim_crcf_m16_h64 to package firdecim_crcf from src/filter/bench/firdecim_crcf_benchmark.c:74
+// adding firdecim_cccf_m32_h128 to package firdecim_crcf from src/filter/bench/firdecim_crcf_benchmark.c:75
+// adding firdespm_n51 to package firdespm from src/filter/bench/firdespm_benchmark.c:63
+// adding firdespm_n101 to package firdespm from src/filter/bench/firdespm_benchmark.c:64
+// adding firdespm_n251 to package firdespm from src/filter/bench/firdespm_benchmark.c:65
+// adding firdespm_n501 to package firdespm from src/filter/bench/firdespm_benchmark.c:66
+// adding firdespm_n1001 to package firdespm from src/filter/bench/firdespm_benchmark.c:67
+// adding firdespm_n2001 to package firdespm from src/filter/bench/firdespm_benchmark.c:68
+// adding firdespm_n2001_w4 to package firdespm from src/filter/bench/firdespm_benchmark.c:69
+// adding firhilbf_decim_m3 to package firhilb from src/filter/bench/firhilb_benchmark.c:64
+// adding firhilbf_decim_m5 to package firhilb from src/filter/bench/firhilb_benchmark.c:65
+// adding firhilbf_decim_m9 to package firhilb from src/filter/bench/firhilb_benchmark.c:66
+// adding firhilbf_decim_m13 to package firhilb from src/filter/bench/firhilb_benchmark.c:67
+// adding firhilbf_c2r_m13 to package firhilb from src/filter/bench/firhilb_benchmark.c:115
+// adding firhilbf_c2r_m25 to package firhilb from src/filter/bench/firhilb_benchmark.c:116
+// adding firhilbf_c2r_block_m13 to package firhilb from src/filter/bench/firhilb_benchmark.c:117
+// adding firhilbf_c2r_block_m25 to package firhilb from src/filter/bench/firhilb_benchmark.c:118
+// adding firinterp_crcf_m2_h8 to package firinterp_crcf from src/filter/bench/firinterp_crcf_benchmark.c:66
+// adding firinterp_crcf_m4_h16 to package firinterp_crcf from src/filter/bench/firinterp_crcf_benchmark.c:67
+// adding firinterp_crcf_m8_h32 to package firinterp_crcf from src/filter/bench/firinterp_crcf_benchmark.c:68
+// adding firinterp_crcf_m16_h64 to package firinterp_crcf from src/filter/bench/firinterp_crcf_benchmark.c:69
+// adding firinterp_crcf_m32_h128 to package firinterp_crcf from src/filter/bench/firinterp_crcf_benchmark.c:70
+// adding firfilt_crcf_4 to package firfilt_crcf from src/filter/bench/firfilt_crcf_benchmark.c:74
+// adding firfilt_crcf_8 to package firfilt_crcf from src/filter/bench/firfilt_crcf_benchmark.c:75
+// adding firfilt_crcf_16 to package firfilt_crcf from src/filter/bench/firfilt_crcf_benchmark.c:76
+// adding firfilt_crcf_32 to package firfilt_crcf from src/filter/bench/firfilt_crcf_benchmark.c:77
+// adding firfilt_crcf_64 to package firfilt_crcf from src/filter/bench/firfilt_crcf_benchmark.c:78
+// adding iirdecim_crcf_M2 to package iirdecim_crcf from src/filter/bench/iirdecim_crcf_benchmark.c:75
+// adding iirdecim_crcf_M4 to package iirdecim_crcf from src/filter/bench/iirdecim_crcf_benchmark.c:76
+// adding iirdecim_crcf_M8 to package iirdecim_crcf from src/filter/bench/iirdecim_crcf_benchmark.c:77
+// adding iirdecim_crcf_M16 to package iirdecim_crcf from src/filter/bench/iirdecim_crcf_benchmark.c:78
+// adding iirdecim_cccf_M32 to package iirdecim_crcf from src/filter/bench/iirdecim_crcf_benchmark.c:79
+// adding iirfilt_crcf_4 to package iirfilt_crcf from src/filter/bench/iirfilt_crcf_benchmark.c:85
+// adding iirfilt_crcf_8 to package iirfilt_crcf from src/filter/bench/iirfilt_crcf_benchmark.c:86
+// adding iirfilt_crcf_16 to package iirfilt_crcf from src/filter/bench/iirfilt_crcf_benchmark.c:87
+// adding iirfilt_crcf_32 to package iirfilt_crcf from src/filter/bench/iirfilt_crcf_benchmark.c:88
+// adding iirfilt_crcf_64 to package iirfilt_crcf from src/filter/bench/iirfilt_crcf_benchmark.c:89
+// adding iirfilt_crcf_sos_4 to package iirfilt_crcf from src/filter/bench/iirfilt_crcf_benchmark.c:92
+// adding iirfilt_crcf_sos_8 to package iirfilt_crcf from src/filter/bench/iirfilt_crcf_benchmark.c:93
+// adding iirfilt_crcf_sos_16 to package iirfilt_crcf from src/filter/bench/iirfilt_crcf_benchmark.c:94
+// adding iirfilt_crcf_sos_32 to package iirfilt_crcf from src/filter/bench/iirfilt_crcf_benchmark.c:95
+// adding iirfilt_crcf_sos_64 to package iirfilt_crcf from src/filter/bench/iirfilt_crcf_benchmark.c:96
+// adding irfilt_crcf_dcblock to package iirfilt_crcf from src/filter/bench/iirfilt_crcf_benchmark.c:99
+// adding iirfiltbank_crcf_M64_n4 to package iirfiltbank_crcf from src/filter/bench/iirfiltbank_crcf_benchmark.c:72
+// adding iirfiltbank_crcf_M256_n4 to package iirfiltbank_crcf from src/filter/bench/iirfiltbank_crcf_benchmark.c:73
+// adding iirfiltbank_crcf_M512_n4 to package iirfiltbank_crcf from src/filter/bench/iirfiltbank_crcf_benchmark.c:74
+// adding iirfiltbank_crcf_M1_n4 to package iirfiltbank_crcf from src/filter/bench/iirfiltbank_crcf_benchmark.c:77
+// adding iirfiltbank_crcf_M1_n8 to package iirfiltbank_crcf from src/filter/bench/iirfiltbank_crcf_benchmark.c:78
+// adding iirinterp_crcf_M2 to package iirinterp_crcf from src/filter/bench/iirinterp_crcf_benchmark.c:70
+// adding iirinterp_crcf_M4 to package iirinterp_crcf from src/filter/bench/iirinterp_crcf_benchmark.c:71
+// adding iirinterp_crcf_M8 to package iirinterp_crcf from src/filter/bench/iirinterp_crcf_benchmark.c:72
+// adding iirinterp_crcf_M16 to package iirinterp_crcf from src/filter/bench/iirinterp_crcf_benchmark.c:73
+// adding iirinterp_crcf_M32 to package iirinterp_crcf from src/filter/bench/iirinterp_crcf_benchmark.c:74
+// adding rresamp_crcf_P17_Q1 to package rresamp_crcf from src/filter/bench/rresamp_crcf_benchmark.c:77
+// adding rresamp_crcf_P17_Q2 to package rresamp_crcf from src/filter/bench/rresamp_crcf_benchmark.c:78
+// adding rresamp_crcf_P17_Q4 to package rresamp_crcf from src/filter/bench/rresamp_crcf_benchmark.c:79
+// adding rresamp_crcf_P17_Q8 to package rresamp_crcf from src/filter/bench/rresamp_crcf_benchmark.c:80
+// adding rresamp_crcf_P17_Q16 to package rresamp_crcf from src/filter/bench/rresamp_crcf_benchmark.c:81
+// adding rresamp_crcf_P17_Q32 to package rresamp_crcf from src/filter/bench/rresamp_crcf_benchmark.c:82
+// adding rresamp_crcf_P17_Q64 to package rresamp_crcf from src/filter/bench/rresamp_crcf_benchmark.c:83
+// adding rresamp_crcf_P17_Q128 to package rresamp_crcf from src/filter/bench/rresamp_crcf_benchmark.c:84
+// adding rresamp_crcf_P17_Q256 to package rresamp_crcf from src/filter/bench/rresamp_crcf_benchmark.c:85
+// adding resamp_crcf_P17_Q1 to package resamp_crcf from src/filter/bench/resamp_crcf_benchmark.c:78
+// adding resamp_crcf_P17_Q2 to package resamp_crcf from src/filter/bench/resamp_crcf_benchmark.c:79
+// adding resamp_crcf_P17_Q4 to package resamp_crcf from src/filter/bench/resamp_crcf_benchmark.c:80
+// adding resamp_crcf_P17_Q8 to package resamp_crcf from src/filter/bench/resamp_crcf_benchmark.c:81
+// adding resamp_crcf_P17_Q16 to package resamp_crcf from src/filter/bench/resamp_crcf_benchmark.c:82
+// adding resamp_crcf_P17_Q32 to package resamp_crcf from src/filter/bench/resamp_crcf_benchmark.c:83
+// adding resamp_crcf_P17_Q64 to package resamp_crcf from src/filter/bench/resamp_crcf_benchmark.c:84
+// adding resamp_crcf_P17_Q128 to package resamp_crcf from src/filter/bench/resamp_crcf_benchmark.c:85
+// adding resamp_crcf_P17_Q256 to package resamp_crcf from src/filter/bench/resamp_crcf_benchmark.c:86
+// adding resamp2_crcf_decim_m2 to package resamp2_crcf from src/filter/bench/resamp2_crcf_benchmark.c:87
+// adding resamp2_crcf_decim_m4 to package resamp2_crcf from src/filter/bench/resamp2_crcf_benchmark.c:88
+// adding resamp2_crcf_decim_m8 to package resamp2_crcf from src/filter/bench/resamp2_crcf_benchmark.c:89
+// adding resamp2_crcf_decim_m16 to package resamp2_crcf from src/filter/bench/resamp2_crcf_benchmark.c:90
+// adding resamp2_crcf_decim_m32 to package resamp2_crcf from src/filter/bench/resamp2_crcf_benchmark.c:91
+// adding resamp2_crcf_decim_m64 to package resamp2_crcf from src/filter/bench/resamp2_crcf_benchmark.c:92
+// adding resamp2_crcf_decim_m128 to package resamp2_crcf from src/filter/bench/resamp2_crcf_benchmark.c:93
+// adding resamp2_crcf_decim_m256 to package resamp2_crcf from src/filter/bench/resamp2_crcf_benchmark.c:94
+// adding resamp2_crcf_interp_m2 to package resamp2_crcf from src/filter/bench/resamp2_crcf_benchmark.c:99
+// adding resamp2_crcf_interp_m4 to package resamp2_crcf from src/filter/bench/resamp2_crcf_benchmark.c:100
+// adding resamp2_crcf_interp_m8 to package resamp2_crcf from src/filter/bench/resamp2_crcf_benchmark.c:101
+// adding resamp2_crcf_interp_m16 to package resamp2_crcf from src/filter/bench/resamp2_crcf_benchmark.c:102
+// adding resamp2_crcf_interp_m32 to package resamp2_crcf from src/filter/bench/resamp2_crcf_benchmark.c:103
+// adding resamp2_crcf_interp_m64 to package resamp2_crcf from src/filter/bench/resamp2_crcf_benchmark.c:104
+// adding resamp2_crcf_interp_m128 to package resamp2_crcf from src/filter/bench/resamp2_crcf_benchmark.c:105
+// adding resamp2_crcf_interp_m256 to package resamp2_crcf from src/filter/bench/resamp2_crcf_benchmark.c:106
+// adding symsync_crcf_k2_m2 to package symsync_crcf from src/filter/bench/symsync_crcf_benchmark.c:80
+// adding symsync_crcf_k2_m4 to package symsync_crcf from src/filter/bench/symsync_crcf_benchmark.c:81
+// adding symsync_crcf_k2_m8 to package symsync_crcf from src/filter/bench/symsync_crcf_benchmark.c:82
+// adding symsync_crcf_k2_m16 to package symsync_crcf from src/filter/bench/symsync_crcf_benchmark.c:83
+// adding presync_cccf_16 to package presync from src/framing/bench/presync_benchmark.c:91
+// adding presync_cccf_32 to package presync from src/framing/bench/presync_benchmark.c:92
+// adding presync_cccf_64 to package presync from src/framing/bench/presync_benchmark.c:93
+// adding presync_cccf_128 to package presync from src/framing/bench/presync_benchmark.c:94
+// adding presync_cccf_256 to package presync from src/framing/bench/presync_benchmark.c:95
+// adding presync_cccf_m32_64 to package presync from src/framing/bench/presync_benchmark.c:98
+// adding presync_cccf_m32_256 to package presync from src/framing/bench/presync_benchmark.c:99
+// adding presync_cccf_fft_16 to package presync from src/framing/bench/presync_benchmark.c:100
+// adding presync_cccf_fft_32 to package presync from src/framing/bench/presync_benchmark.c:101
+// adding presync_cccf_fft_64 to package presync from src/framing/bench/presync_benchmark.c:102
+// adding presync_cccf_fft_128 to package presync from src/framing/bench/presync_benchmark.c:103
+// adding presync_cccf_fft_256 to package presync from src/framing/bench/presync_benchmark.c:104
+// adding bpacketsync to package bpacketsync from src/framing/bench/bpacketsync_benchmark.c:46
+// adding bpresync_cccf_16 to package bpresync from src/framing/bench/bpresync_benchmark.c:88
+// adding bpresync_cccf_32 to package bpresync from src/framing/bench/bpresync_benchmark.c:89
+// adding bpresync_cccf_64 to package bpresync from src/framing/bench/bpresync_benchmark.c:90
+// adding bpresync_cccf_128 to package bpresync from src/framing/bench/bpresync_benchmark.c:91
+// adding bpresync_cccf_256 to package bpresync from src/framing/bench/bpresync_benchmark.c:92
+// adding bsync_cccf_16 to package bsync from src/framing/bench/bsync_benchmark.c:85
+// adding bsync_cccf_32 to package bsync from src/framing/bench/bsync_benchmark.c:86
+// adding bsync_cccf_64 to package bsync from src/framing/bench/bsync_benchmark.c:87
+// adding bsync_cccf_128 to package bsync from src/framing/bench/bsync_benchmark.c:88
+// adding bsync_cccf_256 to package bsync from src/framing/bench/bsync_benchmark.c:89
+// adding detector_cccf_16 to package detector from src/framing/bench/detector_benchmark.c:93
+// adding detector_cccf_32 to package detector from src/framing/bench/detector_benchmark.c:94
+// adding detector_cccf_64 to package detector from src/framing/bench/detector_benchmark.c:95
+// adding detector_cccf_128 to package detector from src/framing/bench/detector_benchmark.c:96
+// adding detector_cccf_256 to package detector from src/framing/bench/detector_benchmark.c:97
+// adding flexframesync to package flexframesync from src/framing/bench/flexframesync_benchmark.c:30
+// adding framesync64 to package framesync64 from src/framing/bench/framesync64_benchmark.c:50
+// adding gmskframesync to package gmskframesync from src/framing/bench/gmskframesync_benchmark.c:32
+// adding gmskframesync_noise to package gmskframesync from src/framing/bench/gmskframesync_benchmark.c:77
+// adding qdetector_cccf_16 to package qdetector from src/framing/bench/qdetector_benchmark.c:95
+// adding qdetector_cccf_32 to package qdetector from src/framing/bench/qdetector_benchmark.c:96
+// adding qdetector_cccf_64 to package qdetector from src/framing/bench/qdetector_benchmark.c:97
+// adding qdetector_cccf_128 to package qdetector from src/framing/bench/qdetector_benchmark.c:98
+// adding qdetector_cccf_256 to package qdetector from src/framing/bench/qdetector_benchmark.c:99
+// adding qdetector_cccf_512 to package qdetector from src/framing/bench/qdetector_benchmark.c:100
+// adding qdetector_cccf_1024 to package qdetector from src/framing/bench/qdetector_benchmark.c:101
+// adding qdetector_cccf_2048 to package qdetector from src/framing/bench/qdetector_benchmark.c:102
+// adding qdetector_cccf_4096 to package qdetector from src/framing/bench/qdetector_benchmark.c:103
+// adding qdetector_cccf_8192 to package qdetector from src/framing/bench/qdetector_benchmark.c:104
+// adding rxchain_framesync64_awgn to package rxchain from src/framing/bench/rxchain_benchmark.c:299
+// adding rxchain_framesync64_cfo to package rxchain from src/framing/bench/rxchain_benchmark.c:300
+// adding rxchain_framesync64_multipath to package rxchain from src/framing/bench/rxchain_benchmark.c:301
+// adding rxchain_framesync64_all to package rxchain from src/framing/bench/rxchain_benchmark.c:302
+// adding rxchain_flexframesync_awgn to package rxchain from src/framing/bench/rxchain_benchmark.c:303
+// adding rxchain_flexframesync_cfo to package rxchain from src/framing/bench/rxchain_benchmark.c:304
+// adding rxchain_flexframesync_multipath to package rxchain from src/framing/bench/rxchain_benchmark.c:305
+// adding rxchain_flexframesync_all to package rxchain from src/framing/bench/rxchain_benchmark.c:306
+// adding rxchain_ofdmflexframesync_awgn to package rxchain from src/framing/bench/rxchain_benchmark.c:307
+// adding rxchain_ofdmflexframesync_cfo to package rxchain from src/framing/bench/rxchain_benchmark.c:308
+// adding rxchain_ofdmflexframesync_multipath to package rxchain from src/framing/bench/rxchain_benchmark.c:309
+// adding rxchain_ofdmflexframesync_all to package rxchain from src/framing/bench/rxchain_benchmark.c:310
+// adding vmath_sincos_exact to package math_fast from src/math/bench/math_fast_benchmark.c:71
+// adding vmath_sincos_precise to package math_fast from src/math/bench/math_fast_benchmark.c:72
+// adding vmath_sincos_fast to package math_fast from src/math/bench/math_fast_benchmark.c:73
+// adding vmath_cexpj_exact to package math_fast from src/math/bench/math_fast_benchmark.c:74
+// adding vmath_cexpj_precise to package math_fast from src/math/bench/math_fast_benchmark.c:75
+// adding vmath_cexpj_fast to package math_fast from src/math/bench/math_fast_benchmark.c:76
+// adding vmath_atan2_exact to package math_fast from src/math/bench/math_fast_benchmark.c:77
+// adding vmath_atan2_precise to package math_fast from src/math/bench/math_fast_benchmark.c:78
+// adding vmath_atan2_fast to package math_fast from src/math/bench/math_fast_benchmark.c:79
+// adding vmath_exp_exact to package math_fast from src/math/bench/math_fast_benchmark.c:80
+// adding vmath_exp_precise to package math_fast from src/math/bench/math_fast_benchmark.c:81
+// adding vmath_exp_fast to package math_fast from src/math/bench/math_fast_benchmark.c:82
+// adding vmath_log_exact to package math_fast from src/math/bench/math_fast_benchmark.c:83
+// adding vmath_log_precise to package math_fast from src/math/bench/math_fast_benchmark.c:84
+// adding vmath_log_fast to package math_fast from src/math/bench/math_fast_benchmark.c:85
+// adding vmath_log10_exact to package math_fast from src/math/bench/math_fast_benchmark.c:86
+// adding vmath_log10_precise to package math_fast from src/math/bench/math_fast_benchmark.c:87
+// adding vmath_log10_fast to package math_fast from src/math/bench/math_fast_benchmark.c:88
+// adding polyf_fit_q3_n8 to package polyfit from src/math/bench/polyfit_benchmark.c:66
+// adding polyf_fit_q3_n16 to package polyfit from src/math/bench/polyfit_benchmark.c:67
+// adding polyf_fit_q3_n32 to package polyfit from src/math/bench/polyfit_benchmark.c:68
+// adding polyf_fit_q3_n64 to package polyfit from src/math/bench/polyfit_benchmark.c:69
+// adding polyf_fit_q3_n128 to package polyfit from src/math/bench/polyfit_benchmark.c:70
+// adding matrixcf_mul_n8 to package matrixcf_mul from src/matrix/bench/matrixcf_mul_benchmark.c:113
+// adding matrixcf_mul_n16 to package matrixcf_mul from src/matrix/bench/matrixcf_mul_benchmark.c:114
+// adding matrixcf_mul_n32 to package matrixcf_mul from src/matrix/bench/matrixcf_mul_benchmark.c:115
+// adding matrixcf_mul_n64 to package matrixcf_mul from src/matrix/bench/matrixcf_mul_benchmark.c:116
+// adding matrixcf_mul_ref_n8 to package matrixcf_mul from src/matrix/bench/matrixcf_mul_benchmark.c:118
+// adding matrixcf_mul_ref_n16 to package matrixcf_mul from src/matrix/bench/matrixcf_mul_benchmark.c:119
+// adding matrixcf_mul_ref_n32 to package matrixcf_mul from src/matrix/bench/matrixcf_mul_benchmark.c:120
+// adding matrixcf_mul_ref_n64 to package matrixcf_mul from src/matrix/bench/matrixcf_mul_benchmark.c:121
+// adding matrixcf_transpose_mul_n16 to package matrixcf_mul from src/matrix/bench/matrixcf_mul_benchmark.c:123
+// adding matrixcf_transpose_mul_n64 to package matrixcf_mul from src/matrix/bench/matrixcf_mul_benchmark.c:124
+// adding matrixcf_mulv_n16 to package matrixcf_mul from src/matrix/bench/matrixcf_mul_benchmark.c:126
+// adding matrixcf_mulv_n32 to package matrixcf_mul from src/matrix/bench/matrixcf_mul_benchmark.c:127
+// adding matrixcf_mulv_n64 to package matrixcf_mul from src/matrix/bench/matrixcf_mul_benchmark.c:128
+// adding matrixcf_mulv_ref_n16 to package matrixcf_mul from src/matrix/bench/matrixcf_mul_benchmark.c:130
+// adding matrixcf_mulv_ref_n32 to package matrixcf_mul from src/matrix/bench/matrixcf_mul_benchmark.c:131
+// adding matrixcf_mulv_ref_n64 to package matrixcf_mul from src/matrix/bench/matrixcf_mul_benchmark.c:132
+// adding matrixf_inv_n2 to package matrixf_inv from src/matrix/bench/matrixf_inv_benchmark.c:60
+// adding matrixf_inv_n4 to package matrixf_inv from src/matrix/bench/matrixf_inv_benchmark.c:61
+// adding matrixf_inv_n8 to package matrixf_inv from src/matrix/bench/matrixf_inv_benchmark.c:62
+// adding matrixf_inv_n16 to package matrixf_inv from src/matrix/bench/matrixf_inv_benchmark.c:63
+// adding matrixf_inv_n32 to package matrixf_inv from src/matrix/bench/matrixf_inv_benchmark.c:64
+// adding matrixf_inv_n64 to package matrixf_inv from src/matrix/bench/matrixf_inv_benchmark.c:65
+// adding matrixf_linsolve_n2 to package matrixf_linsolve from src/matrix/bench/matrixf_linsolve_benchmark.c:66
+// adding matrixf_linsolve_n4 to package matrixf_linsolve from src/matrix/bench/matrixf_linsolve_benchmark.c:67
+// adding matrixf_linsolve_n8 to package matrixf_linsolve from src/matrix/bench/matrixf_linsolve_benchmark.c:68
+// adding matrixf_linsolve_n16 to package matrixf_linsolve from src/matrix/bench/matrixf_linsolve_benchmark.c:69
+// adding matrixf_linsolve_n32 to package matrixf_linsolve from src/matrix/bench/matrixf_linsolve_benchmark.c:70
+// adding matrixf_linsolve_n64 to package matrixf_linsolve from src/matrix/bench/matrixf_linsolve_benchmark.c:71
+// adding matrixf_lusolve_n16 to package matrixf_lusolve from src/matrix/bench/matrixf_lusolve_benchmark.c:94
+// adding matrixf_lusolve_n32 to package matrixf_lusolve from src/matrix/bench/matrixf_lusolve_benchmark.c:95
+// adding matrixf_lusolve_n64 to package matrixf_lusolve from src/matrix/bench/matrixf_lusolve_benchmark.c:96
+// adding matrixf_gjelim_n16 to package matrixf_lusolve from src/matrix/bench/matrixf_lusolve_benchmark.c:98
+// adding matrixf_gjelim_n32 to package matrixf_lusolve from src/matrix/bench/matrixf_lusolve_benchmark.c:99
+// adding matrixf_gjelim_n64 to package matrixf_lusolve from src/matrix/bench/matrixf_lusolve_benchmark.c:100
+// adding matrixf_cholsolve_n16 to package matrixf_lusolve from src/matrix/bench/matrixf_lusolve_benchmark.c:102
+// adding matrixf_cholsolve_n32 to package matrixf_lusolve from src/matrix/bench/matrixf_lusolve_benchmark.c:103
+// adding matrixf_cholsolve_n64 to package matrixf_lusolve from src/matrix/bench/matrixf_lusolve_benchmark.c:104
+// adding matrixf_mul_n2 to package matrixf_mul from src/matrix/bench/matrixf_mul_benchmark.c:64
+// adding matrixf_mul_n4 to package matrixf_mul from src/matrix/bench/matrixf_mul_benchmark.c:65
+// adding matrixf_mul_n8 to package matrixf_mul from src/matrix/bench/matrixf_mul_benchmark.c:66
+// adding matrixf_mul_n16 to package matrixf_mul from src/matrix/bench/matrixf_mul_benchmark.c:67
+// adding matrixf_mul_n32 to package matrixf_mul from src/matrix/bench/matrixf_mul_benchmark.c:68
+// adding matrixf_mul_n64 to package matrixf_mul from src/matrix/bench/matrixf_mul_benchmark.c:69
+// adding smatrixf_mul_n32 to package smatrixf_mul from src/matrix/bench/smatrixf_mul_benchmark.c:90
+// adding smatrixf_mul_n64 to package smatrixf_mul from src/matrix/bench/smatrixf_mul_benchmark.c:91
+// adding smatrixf_mul_n128 to package smatrixf_mul from src/matrix/bench/smatrixf_mul_benchmark.c:92
+// adding smatrixf_mul_n256 to package smatrixf_mul from src/matrix/bench/smatrixf_mul_benchmark.c:93
+// adding smatrixf_mul_n512 to package smatrixf_mul from src/matrix/bench/smatrixf_mul_benchmark.c:94
+// adding ampmodem_demod_usb_sc to package ampmodem from src/modem/bench/ampmodem_benchmark.c:74
+// adding ampmodem_demod_usb_sc_block to package ampmodem from src/modem/bench/ampmodem_benchmark.c:75
+// adding ampmodem_demod_usb to package ampmodem from src/modem/bench/ampmodem_benchmark.c:76
+// adding ampmodem_demod_usb_block to package ampmodem from src/modem/bench/ampmodem_benchmark.c:77
+// adding cpfskdem_noncoherent to package cpfskdem from src/modem/bench/cpfskdem_benchmark.c:81
+// adding cpfskdem_noncoherent_block to package cpfskdem from src/modem/bench/cpfskdem_benchmark.c:82
+// adding cpfskdem_coherent to package cpfskdem from src/modem/bench/cpfskdem_benchmark.c:83
+// adding cpfskdem_coherent_block to package cpfskdem from src/modem/bench/cpfskdem_benchmark.c:84
+// adding freqdem to package freqdem from src/modem/bench/freqdem_benchmark.c:30
+// adding freqdem_block_exact to package freqdem from src/modem/bench/freqdem_benchmark.c:121
+// adding freqdem_block_terms3 to package freqdem from src/modem/bench/freqdem_benchmark.c:122
+// adding freqdem_block_terms5 to package freqdem from src/modem/bench/freqdem_benchmark.c:123
+// adding freqdem_block_terms7 to package freqdem from src/modem/bench/freqdem_benchmark.c:124
+// adding freqmod to package freqmod from src/modem/bench/freqmod_benchmark.c:30
+// adding fskdem_norm_M2 to package fskdem from src/modem/bench/fskdem_benchmark.c:81
+// adding fskdem_norm_M4 to package fskdem from src/modem/bench/fskdem_benchmark.c:82
+// adding fskdem_norm_M8 to package fskdem from src/modem/bench/fskdem_benchmark.c:83
+// adding fskdem_norm_M16 to package fskdem from src/modem/bench/fskdem_benchmark.c:84
+// adding fskdem_norm_M32 to package fskdem from src/modem/bench/fskdem_benchmark.c:85
+// adding fskdem_norm_M64 to package fskdem from src/modem/bench/fskdem_benchmark.c:86
+// adding fskdem_norm_M128 to package fskdem from src/modem/bench/fskdem_benchmark.c:87
+// adding fskdem_norm_M256 to package fskdem from src/modem/bench/fskdem_benchmark.c:88
+// adding fskdem_norm_M512 to package fskdem from src/modem/bench/fskdem_benchmark.c:89
+// adding fskdem_norm_M1024 to package fskdem from src/modem/bench/fskdem_benchmark.c:90
+// adding fskdem_misc_M2 to package fskdem from src/modem/bench/fskdem_benchmark.c:93
+// adding fskdem_misc_M4 to package fskdem from src/modem/bench/fskdem_benchmark.c:94
+// adding fskdem_misc_M8 to package fskdem from src/modem/bench/fskdem_benchmark.c:95
+// adding fskdem_misc_M16 to package fskdem from src/modem/bench/fskdem_benchmark.c:96
+// adding fskdem_misc_M32 to package fskdem from src/modem/bench/fskdem_benchmark.c:97
+// adding fskdem_misc_M64 to package fskdem from src/modem/bench/fskdem_benchmark.c:98
+// adding fskdem_misc_M128 to package fskdem from src/modem/bench/fskdem_benchmark.c:99
+// adding fskdem_misc_M256 to package fskdem from src/modem/bench/fskdem_benchmark.c:100
+// adding fskdem_misc_M512 to package fskdem from src/modem/bench/fskdem_benchmark.c:101
+// adding fskdem_misc_M1024 to package fskdem from src/modem/bench/fskdem_benchmark.c:102
+// adding fskdem_block_fft_M2 to package fskdem from src/modem/bench/fskdem_benchmark.c:148
+// adding fskdem_block_fft_M4 to package fskdem from src/modem/bench/fskdem_benchmark.c:149
+// adding fskdem_block_fft_M8 to package fskdem from src/modem/bench/fskdem_benchmark.c:150
+// adding fskdem_block_pruned_M2 to package fskdem from src/modem/bench/fskdem_benchmark.c:151
+// adding fskdem_block_pruned_M4 to package fskdem from src/modem/bench/fskdem_benchmark.c:152
+// adding fskdem_block_pruned_M8 to package fskdem from src/modem/bench/fskdem_benchmark.c:153
+// adding fskmod_norm_M2 to package fskmod from src/modem/bench/fskmod_benchmark.c:77
+// adding fskmod_norm_M4 to package fskmod from src/modem/bench/fskmod_benchmark.c:78
+// adding fskmod_norm_M8 to package fskmod from src/modem/bench/fskmod_benchmark.c:79
+// adding fskmod_norm_M16 to package fskmod from src/modem/bench/fskmod_benchmark.c:80
+// adding fskmod_norm_M32 to package fskmod from src/modem/bench/fskmod_benchmark.c:81
+// adding fskmod_norm_M64 to package fskmod from src/modem/bench/fskmod_benchmark.c:82
+// adding fskmod_norm_M128 to package fskmod from src/modem/bench/fskmod_benchmark.c:83
+// adding fskmod_norm_M256 to package fskmod from src/modem/bench/fskmod_benchmark.c:84
+// adding fskmod_norm_M512 to package fskmod from src/modem/bench/fskmod_benchmark.c:85
+// adding fskmod_norm_M1024 to package fskmod from src/modem/bench/fskmod_benchmark.c:86
+// adding fskmod_misc_M2 to package fskmod from src/modem/bench/fskmod_benchmark.c:89
+// adding fskmod_misc_M4 to package fskmod from src/modem/bench/fskmod_benchmark.c:90
+// adding fskmod_misc_M8 to package fskmod from src/modem/bench/fskmod_benchmark.c:91
+// adding fskmod_misc_M16 to package fskmod from src/modem/bench/fskmod_benchmark.c:92
+// adding fskmod_misc_M32 to package fskmod from src/modem/bench/fskmod_benchmark.c:93
+// adding fskmod_misc_M64 to package fskmod from src/modem/bench/fskmod_benchmark.c:94
+// adding fskmod_misc_M128 to package fskmod from src/modem/bench/fskmod_benchmark.c:95
+// adding fskmod_misc_M256 to package fskmod from src/modem/bench/fskmod_benchmark.c:96
+// adding fskmod_misc_M512 to package fskmod from src/modem/bench/fskmod_benchmark.c:97
+// adding fskmod_misc_M1024 to package fskmod from src/modem/bench/fskmod_benchmark.c:98
+// adding gmskmodem_modulate to package gmskmodem from src/modem/bench/gmskmodem_benchmark.c:30
+// adding gmskmodem_demodulate to package gmskmodem from src/modem/bench/gmskmodem_benchmark.c:62
+// adding gmskmodem_demodulate_block to package gmskmodem from src/modem/bench/gmskmodem_benchmark.c:98
+// adding modulate_bpsk to package modem_modulate from src/modem/bench/modem_modulate_benchmark.c:62
+// adding modulate_qpsk to package modem_modulate from src/modem/bench/modem_modulate_benchmark.c:63
+// adding modulate_ook to package modem_modulate from src/modem/bench/modem_modulate_benchmark.c:64
+// adding modulate_sqam32 to package modem_modulate from src/modem/bench/modem_modulate_benchmark.c:65
+// adding modulate_sqam128 to package modem_modulate from src/modem/bench/modem_modulate_benchmark.c:66
+// adding modulate_ask2 to package modem_modulate from src/modem/bench/modem_modulate_benchmark.c:69
+// adding modulate_ask4 to package modem_modulate from src/modem/bench/modem_modulate_benchmark.c:70
+// adding modulate_ask8 to package modem_modulate from src/modem/bench/modem_modulate_benchmark.c:71
+// adding modulate_ask16 to package modem_modulate from src/modem/bench/modem_modulate_benchmark.c:72
+// adding modulate_psk2 to package modem_modulate from src/modem/bench/modem_modulate_benchmark.c:75
+// adding modulate_psk4 to package modem_modulate from src/modem/bench/modem_modulate_benchmark.c:76
+// adding modulate_psk8 to package modem_modulate from src/modem/bench/modem_modulate_benchmark.c:77
+// adding modulate_psk16 to package modem_modulate from src/modem/bench/modem_modulate_benchmark.c:78
+// adding modulate_psk32 to package modem_modulate from src/modem/bench/modem_modulate_benchmark.c:79
+// adding modulate_psk64 to package modem_modulate from src/modem/bench/modem_modulate_benchmark.c:80
+// adding modulate_dpsk2 to package modem_modulate from src/modem/bench/modem_modulate_benchmark.c:83
+// adding modulate_dpsk4 to package modem_modulate from src/modem/bench/modem_modulate_benchmark.c:84
+// adding modulate_dpsk8 to package modem_modulate from src/modem/bench/modem_modulate_benchmark.c:85
+// adding modulate_dpsk16 to package modem_modulate from src/modem/bench/modem_modulate_benchmark.c:86
+// adding modulate_dpsk32 to package modem_modulate from src/modem/bench/modem_modulate_benchmark.c:87
+// adding modulate_dpsk64 to package modem_modulate from src/modem/bench/modem_modulate_benchmark.c:88
+// adding modulate_qam4 to package modem_modulate from src/modem/bench/modem_modulate_benchmark.c:91
+// adding modulate_qam8 to package modem_modulate from src/modem/bench/modem_modulate_benchmark.c:92
+// adding modulate_qam16 to package modem_modulate from src/modem/bench/modem_modulate_benchmark.c:93
+// adding modulate_qam32 to package modem_modulate from src/modem/bench/modem_modulate_benchmark.c:94
+// adding modulate_qam64 to package modem_modulate from src/modem/bench/modem_modulate_benchmark.c:95
+// adding modulate_qam128 to package modem_modulate from src/modem/bench/modem_modulate_benchmark.c:96
+// adding modulate_qam256 to package modem_modulate from src/modem/bench/modem_modulate_benchmark.c:97
+// adding modulate_apsk4 to package modem_modulate from src/modem/bench/modem_modulate_benchmark.c:100
+// adding modulate_apsk8 to package modem_modulate from src/modem/bench/modem_modulate_benchmark.c:101
+// adding modulate_apsk16 to package modem_modulate from src/modem/bench/modem_modulate_benchmark.c:102
+// adding modulate_apsk32 to package modem_modulate from src/modem/bench/modem_modulate_benchmark.c:103
+// adding modulate_apsk64 to package modem_modulate from src/modem/bench/modem_modulate_benchmark.c:104
+// adding modulate_apsk128 to package modem_modulate from src/modem/bench/modem_modulate_benchmark.c:105
+// adding modulate_apsk256 to package modem_modulate from src/modem/bench/modem_modulate_benchmark.c:106
+// adding modulate_arbV29 to package modem_modulate from src/modem/bench/modem_modulate_benchmark.c:109
+// adding modulate_arb16opt to package modem_modulate from src/modem/bench/modem_modulate_benchmark.c:110
+// adding modulate_arb32opt to package modem_modulate from src/modem/bench/modem_modulate_benchmark.c:111
+// adding modulate_arb64opt to package modem_modulate from src/modem/bench/modem_modulate_benchmark.c:112
+// adding modulate_arb128opt to package modem_modulate from src/modem/bench/modem_modulate_benchmark.c:113
+// adding modulate_arb256opt to package modem_modulate from src/modem/bench/modem_modulate_benchmark.c:114
+// adding modulate_arb64vt to package modem_modulate from src/modem/bench/modem_modulate_benchmark.c:115
+// adding demodulate_bpsk to package modem_demodulate from src/modem/bench/modem_demodulate_benchmark.c:104
+// adding demodulate_qpsk to package modem_demodulate from src/modem/bench/modem_demodulate_benchmark.c:105
+// adding demodulate_ook to package modem_demodulate from src/modem/bench/modem_demodulate_benchmark.c:106
+// adding demodulate_sqam32 to package modem_demodulate from src/modem/bench/modem_demodulate_benchmark.c:107
+// adding demodulate_sqam128 to package modem_demodulate from src/modem/bench/modem_demodulate_benchmark.c:108
+// adding demodulate_ask2 to package modem_demodulate from src/modem/bench/modem_demodulate_benchmark.c:111
+// adding demodulate_ask4 to package modem_demodulate from src/modem/bench/modem_demodulate_benchmark.c:112
+// adding demodulate_ask8 to package modem_demodulate from src/modem/bench/modem_demodulate_benchmark.c:113
+// adding demodulate_ask16 to package modem_demodulate from src/modem/bench/modem_demodulate_benchmark.c:114
+// adding demodulate_psk2 to package modem_demodulate from src/modem/bench/modem_demodulate_benchmark.c:117
+// adding demodulate_psk4 to package modem_demodulate from src/modem/bench/modem_demodulate_benchmark.c:118
+// adding demodulate_psk8 to package modem_demodulate from src/modem/bench/modem_demodulate_benchmark.c:119
+// adding demodulate_psk16 to package modem_demodulate from src/modem/bench/modem_demodulate_benchmark.c:120
+// adding demodulate_psk32 to package modem_demodulate from src/modem/bench/modem_demodulate_benchmark.c:121
+// adding demodulate_psk64 to package modem_demodulate from src/modem/bench/modem_demodulate_benchmark.c:122
+// adding demodulate_dpsk2 to package modem_demodulate from src/modem/bench/modem_demodulate_benchmark.c:125
+// adding demodulate_dpsk4 to package modem_demodulate from src/modem/bench/modem_demodulate_benchmark.c:126
+// adding demodulate_dpsk8 to package modem_demodulate from src/modem/bench/modem_demodulate_benchmark.c:127
+// adding demodulate_dpsk16 to package modem_demodulate from src/modem/bench/modem_demodulate_benchmark.c:128
+// adding demodulate_dpsk32 to package modem_demodulate from src/modem/bench/modem_demodulate_benchmark.c:129
+// adding demodulate_dpsk64 to package modem_demodulate from src/modem/bench/modem_demodulate_benchmark.c:130
+// adding demodulate_qam4 to package modem_demodulate from src/modem/bench/modem_demodulate_benchmark.c:133
+// adding demodulate_qam8 to package modem_demodulate from src/modem/bench/modem_demodulate_benchmark.c:134
+// adding demodulate_qam16 to package modem_demodulate from src/modem/bench/modem_demodulate_benchmark.c:135
+// adding demodulate_qam32 to package modem_demodulate from src/modem/bench/modem_demodulate_benchmark.c:136
+// adding demodulate_qam64 to package modem_demodulate from src/modem/bench/modem_demodulate_benchmark.c:137
+// adding demodulate_qam128 to package modem_demodulate from src/modem/bench/modem_demodulate_benchmark.c:138
+// adding demodulate_qam256 to package modem_demodulate from src/modem/bench/modem_demodulate_benchmark.c:139
+// adding demodulate_apsk4 to package modem_demodulate from src/modem/bench/modem_demodulate_benchmark.c:142
+// adding demodulate_apsk8 to package modem_demodulate from src/modem/bench/modem_demodulate_benchmark.c:143
+// adding demodulate_apsk16 to package modem_demodulate from src/modem/bench/modem_demodulate_benchmark.c:144
+// adding demodulate_apsk32 to package modem_demodulate from src/modem/bench/modem_demodulate_benchmark.c:145
+// adding demodulate_apsk64 to package modem_demodulate from src/modem/bench/modem_demodulate_benchmark.c:146
+// adding demodulate_apsk128 to package modem_demodulate from src/modem/bench/modem_demodulate_benchmark.c:147
+// adding demodulate_apsk256 to package modem_demodulate from src/modem/bench/modem_demodulate_benchmark.c:148
+// adding demodulate_arbV29 to package modem_demodulate from src/modem/bench/modem_demodulate_benchmark.c:151
+// adding demodulate_arb16opt to package modem_demodulate from src/modem/bench/modem_demodulate_benchmark.c:152
+// adding demodulate_arb32opt to package modem_demodulate from src/modem/bench/modem_demodulate_benchmark.c:153
+// adding demodulate_arb64opt to package modem_demodulate from src/modem/bench/modem_demodulate_benchmark.c:154
+// adding demodulate_arb128opt to package modem_demodulate from src/modem/bench/modem_demodulate_benchmark.c:155
+// adding demodulate_arb256opt to package modem_demodulate from src/modem/bench/modem_demodulate_benchmark.c:156
+// adding demodulate_arb64vt to package modem_demodulate from src/modem/bench/modem_demodulate_benchmark.c:157
+// adding demodulate_block_bpsk to package modem_demodulate_block from src/modem/bench/modem_demodulate_block_benchmark.c:67
+// adding demodulate_block_qpsk to package modem_demodulate_block from src/modem/bench/modem_demodulate_block_benchmark.c:68
+// adding demodulate_block_ask16 to package modem_demodulate_block from src/modem/bench/modem_demodulate_block_benchmark.c:69
+// adding demodulate_block_psk8 to package modem_demodulate_block from src/modem/bench/modem_demodulate_block_benchmark.c:70
+// adding demodulate_block_dpsk8 to package modem_demodulate_block from src/modem/bench/modem_demodulate_block_benchmark.c:71
+// adding demodulate_block_qam16 to package modem_demodulate_block from src/modem/bench/modem_demodulate_block_benchmark.c:72
+// adding demodulate_block_qam64 to package modem_demodulate_block from src/modem/bench/modem_demodulate_block_benchmark.c:73
+// adding demodulate_block_qam256 to package modem_demodulate_block from src/modem/bench/modem_demodulate_block_benchmark.c:74
+// adding demodulate_block_apsk64 to package modem_demodulate_block from src/modem/bench/modem_demodulate_block_benchmark.c:75
+// adding demodsoft_bpsk to package modem_demodsoft from src/modem/bench/modem_demodsoft_benchmark.c:104
+// adding demodsoft_qpsk to package modem_demodsoft from src/modem/bench/modem_demodsoft_benchmark.c:105
+// adding demodsoft_ook to package modem_demodsoft from src/modem/bench/modem_demodsoft_benchmark.c:106
+// adding demodsoft_sqam32 to package modem_demodsoft from src/modem/bench/modem_demodsoft_benchmark.c:107
+// adding demodsoft_sqam128 to package modem_demodsoft from src/modem/bench/modem_demodsoft_benchmark.c:108
+// adding demodsoft_ask2 to package modem_demodsoft from src/modem/bench/modem_demodsoft_benchmark.c:111
+// adding demodsoft_ask4 to package modem_demodsoft from src/modem/bench/modem_demodsoft_benchmark.c:112
+// adding demodsoft_ask8 to package modem_demodsoft from src/modem/bench/modem_demodsoft_benchmark.c:113
+// adding demodsoft_ask16 to package modem_demodsoft from src/modem/bench/modem_demodsoft_benchmark.c:114
+// adding demodsoft_psk2 to package modem_demodsoft from src/modem/bench/modem_demodsoft_benchmark.c:117
+// adding demodsoft_psk4 to package modem_demodsoft from src/modem/bench/modem_demodsoft_benchmark.c:118
+// adding demodsoft_psk8 to package modem_demodsoft from src/modem/bench/modem_demodsoft_benchmark.c:119
+// adding demodsoft_psk16 to package modem_demodsoft from src/modem/bench/modem_demodsoft_benchmark.c:120
+// adding demodsoft_psk32 to package modem_demodsoft from src/modem/bench/modem_demodsoft_benchmark.c:121
+// adding demodsoft_psk64 to package modem_demodsoft from src/modem/bench/modem_demodsoft_benchmark.c:122
+// adding demodsoft_dpsk2 to package modem_demodsoft from src/modem/bench/modem_demodsoft_benchmark.c:125
+// adding demodsoft_dpsk4 to package modem_demodsoft from src/modem/bench/modem_demodsoft_benchmark.c:126
+// adding demodsoft_dpsk8 to package modem_demodsoft from src/modem/bench/modem_demodsoft_benchmark.c:127
+// adding demodsoft_dpsk16 to package modem_demodsoft from src/modem/bench/modem_demodsoft_benchmark.c:128
+// adding demodsoft_dpsk32 to package modem_demodsoft from src/modem/bench/modem_demodsoft_benchmark.c:129
+// adding demodsoft_dpsk64 to package modem_demodsoft from src/modem/bench/modem_demodsoft_benchmark.c:130
+// adding demodsoft_qam4 to package modem_demodsoft from src/modem/bench/modem_demodsoft_benchmark.c:133
+// adding demodsoft_qam8 to package modem_demodsoft from src/modem/bench/modem_demodsoft_benchmark.c:134
+// adding demodsoft_qam16 to package modem_demodsoft from src/modem/bench/modem_demodsoft_benchmark.c:135
+// adding demodsoft_qam32 to package modem_demodsoft from src/modem/bench/modem_demodsoft_benchmark.c:136
+// adding demodsoft_qam64 to package modem_demodsoft from src/modem/bench/modem_demodsoft_benchmark.c:137
+// adding demodsoft_qam128 to package modem_demodsoft from src/modem/bench/modem_demodsoft_benchmark.c:138
+// adding demodsoft_qam256 to package modem_demodsoft from src/modem/bench/modem_demodsoft_benchmark.c:139
+// adding demodsoft_apsk4 to package modem_demodsoft from src/modem/bench/modem_demodsoft_benchmark.c:142
+// adding demodsoft_apsk8 to package modem_demodsoft from src/modem/bench/modem_demodsoft_benchmark.c:143
+// adding demodsoft_apsk16 to package modem_demodsoft from src/modem/bench/modem_demodsoft_benchmark.c:144
+// adding demodsoft_apsk32 to package modem_demodsoft from src/modem/bench/modem_demodsoft_benchmark.c:145
+// adding demodsoft_apsk64 to package modem_demodsoft from src/modem/bench/modem_demodsoft_benchmark.c:146
+// adding demodsoft_apsk128 to package modem_demodsoft from src/modem/bench/modem_demodsoft_benchmark.c:147
+// adding demodsoft_apsk256 to package modem_demodsoft from src/modem/bench/modem_demodsoft_benchmark.c:148
+// adding demodsoft_arbV29 to package modem_demodsoft from src/modem/bench/modem_demodsoft_benchmark.c:151
+// adding demodsoft_arb16opt to package modem_demodsoft from src/modem/bench/modem_demodsoft_benchmark.c:152
+// adding demodsoft_arb32opt to package modem_demodsoft from src/modem/bench/modem_demodsoft_benchmark.c:153
+// adding demodsoft_arb64opt to package modem_demodsoft from src/modem/bench/modem_demodsoft_benchmark.c:154
+// adding demodsoft_arb128opt to package modem_demodsoft from src/modem/bench/modem_demodsoft_benchmark.c:155
+// adding demodsoft_arb256opt to package modem_demodsoft from src/modem/bench/modem_demodsoft_benchmark.c:156
+// adding demodsoft_arb64vt to package modem_demodsoft from src/modem/bench/modem_demodsoft_benchmark.c:157
+// adding firpfbch_crcf_a4 to package firpfbch_crcf from src/multichannel/bench/firpfbch_crcf_benchmark.c:80
+// adding firpfbch_crcf_a16 to package firpfbch_crcf from src/multichannel/bench/firpfbch_crcf_benchmark.c:81
+// adding firpfbch_crcf_a64 to package firpfbch_crcf from src/multichannel/bench/firpfbch_crcf_benchmark.c:82
+// adding firpfbch_crcf_a256 to package firpfbch_crcf from src/multichannel/bench/firpfbch_crcf_benchmark.c:83
+// adding firpfbch_crcf_a512 to package firpfbch_crcf from src/multichannel/bench/firpfbch_crcf_benchmark.c:84
+// adding firpfbch_crcf_a1024 to package firpfbch_crcf from src/multichannel/bench/firpfbch_crcf_benchmark.c:85
+// adding firpfbch2_crcf_a4 to package firpfbch2_crcf from src/multichannel/bench/firpfbch2_crcf_benchmark.c:70
+// adding firpfbch2_crcf_a16 to package firpfbch2_crcf from src/multichannel/bench/firpfbch2_crcf_benchmark.c:71
+// adding firpfbch2_crcf_a64 to package firpfbch2_crcf from src/multichannel/bench/firpfbch2_crcf_benchmark.c:72
+// adding firpfbch2_crcf_a256 to package firpfbch2_crcf from src/multichannel/bench/firpfbch2_crcf_benchmark.c:73
+// adding firpfbch2_crcf_a512 to package firpfbch2_crcf from src/multichannel/bench/firpfbch2_crcf_benchmark.c:74
+// adding firpfbch2_crcf_a1024 to package firpfbch2_crcf from src/multichannel/bench/firpfbch2_crcf_benchmark.c:75
+// adding firpfbch2_crcf_s4 to package firpfbch2_crcf from src/multichannel/bench/firpfbch2_crcf_benchmark.c:78
+// adding firpfbch2_crcf_s16 to package firpfbch2_crcf from src/multichannel/bench/firpfbch2_crcf_benchmark.c:79
+// adding firpfbch2_crcf_s64 to package firpfbch2_crcf from src/multichannel/bench/firpfbch2_crcf_benchmark.c:80
+// adding firpfbch2_crcf_s256 to package firpfbch2_crcf from src/multichannel/bench/firpfbch2_crcf_benchmark.c:81
+// adding firpfbch2_crcf_s512 to package firpfbch2_crcf from src/multichannel/bench/firpfbch2_crcf_benchmark.c:82
+// adding firpfbch2_crcf_s1024 to package firpfbch2_crcf from src/multichannel/bench/firpfbch2_crcf_benchmark.c:83
+// adding firpfbchr_crcf_M0064_P0063 to package firpfbchr_crcf from src/multichannel/bench/firpfbchr_crcf_benchmark.c:74
+// adding firpfbchr_crcf_M0128_P0127 to package firpfbchr_crcf from src/multichannel/bench/firpfbchr_crcf_benchmark.c:75
+// adding firpfbchr_crcf_M0256_P0255 to package firpfbchr_crcf from src/multichannel/bench/firpfbchr_crcf_benchmark.c:76
+// adding firpfbchr_crcf_M0512_P0511 to package firpfbchr_crcf from src/multichannel/bench/firpfbchr_crcf_benchmark.c:77
+// adding firpfbchr_crcf_M1024_P1023 to package firpfbchr_crcf from src/multichannel/bench/firpfbchr_crcf_benchmark.c:78
+// adding firpfbchr_crcf_M2048_P2047 to package firpfbchr_crcf from src/multichannel/bench/firpfbchr_crcf_benchmark.c:79
+// adding firpfbchr_crcf_M4096_P4095 to package firpfbchr_crcf from src/multichannel/bench/firpfbchr_crcf_benchmark.c:80
+// adding ofdmframesync_acquire_n64 to package ofdmframesync_acquire from src/multichannel/bench/ofdmframesync_acquire_benchmark.c:101
+// adding ofdmframesync_acquire_n128 to package ofdmframesync_acquire from src/multichannel/bench/ofdmframesync_acquire_benchmark.c:102
+// adding ofdmframesync_acquire_n256 to package ofdmframesync_acquire from src/multichannel/bench/ofdmframesync_acquire_benchmark.c:103
+// adding ofdmframesync_acquire_n512 to package ofdmframesync_acquire from src/multichannel/bench/ofdmframesync_acquire_benchmark.c:104
+// adding ofdmframesync_rxsymbol_n64 to package ofdmframesync_rxsymbol from src/multichannel/bench/ofdmframesync_rxsymbol_benchmark.c:109
+// adding ofdmframesync_rxsymbol_n128 to package ofdmframesync_rxsymbol from src/multichannel/bench/ofdmframesync_rxsymbol_benchmark.c:110
+// adding ofdmframesync_rxsymbol_n256 to package ofdmframesync_rxsymbol from src/multichannel/bench/ofdmframesync_rxsymbol_benchmark.c:111
+// adding ofdmframesync_rxsymbol_n512 to package ofdmframesync_rxsymbol from src/multichannel/bench/ofdmframesync_rxsymbol_benchmark.c:112
+// adding ofdmframesync_rxsymbol_n1024 to package ofdmframesync_rxsymbol from src/multichannel/bench/ofdmframesync_rxsymbol_benchmark.c:114
+// adding ofdmframesync_rxsymbol_n2048 to package ofdmframesync_rxsymbol from src/multichannel/bench/ofdmframesync_rxsymbol_benchmark.c:115
+// adding ofdmframesync_rxsymbol_n4096 to package ofdmframesync_rxsymbol from src/multichannel/bench/ofdmframesync_rxsymbol_benchmark.c:116
+// adding nco_sincos to package nco from src/nco/bench/nco_benchmark.c:28
+// adding nco_mix_up to package nco from src/nco/bench/nco_benchmark.c:52
+// adding nco_mix_block_up to package nco from src/nco/bench/nco_benchmark.c:79
+// adding vco_sincos to package vco from src/nco/bench/vco_benchmark.c:28
+// adding vco_mix_up to package vco from src/nco/bench/vco_benchmark.c:49
+// adding vco_mix_block_up to package vco from src/nco/bench/vco_benchmark.c:76
+// adding quantize_adc to package quantizer from src/quantization/bench/quantizer_benchmark.c:27
+// adding quantize_dac to package quantizer from src/quantization/bench/quantizer_benchmark.c:51
+// adding compress_mulaw to package compander from src/quantization/bench/compander_benchmark.c:27
+// adding expand_mulaw to package compander from src/quantization/bench/compander_benchmark.c:51
+// adding random_uniform to package random from src/random/bench/random_benchmark.c:29
+// adding random_normal to package random from src/random/bench/random_benchmark.c:55
+// adding random_complex_normal to package random from src/random/bench/random_benchmark.c:81
+// adding random_weibull to package random from src/random/bench/random_benchmark.c:107
+// adding random_ricek to package random from src/random/bench/random_benchmark.c:136
+// adding bsequence_xcorr_n16 to package bsequence from src/sequence/bench/bsequence_benchmark.c:69
+// adding bsequence_xcorr_n64 to package bsequence from src/sequence/bench/bsequence_benchmark.c:70
+// adding bsequence_xcorr_n256 to package bsequence from src/sequence/bench/bsequence_benchmark.c:71
+// adding bsequence_xcorr_n1024 to package bsequence from src/sequence/bench/bsequence_benchmark.c:72
+// adding count_ones to package byte_utilities from src/utility/bench/byte_utilities_benchmark.c:27
+// auto-generated file, do not edit
+// invoked with script type 'benchmark' and delimiter '/'
+// the following types need to be defined externally:
+//      typedef ...(benchmark_function_t)(...);
+//      typedef struct {
+//          unsigned int id;        // script identification number
+//          benchmark_function_t * api;    // pointer to function API
+//          const char * name;      // script name
+//          ...
+//      } benchmark_t;
+//      typedef struct {
+//          unsigned int id;        // package identification number
+//          unsigned int index;     // index of first script
+//          unsigned int n;         // number of scripts in package
+//          const char * name;      // name of package
+//      } package_t;
+
+#ifndef __LIQUID_AUTOSCRIPT_INCLUDE_H__
+#define __LIQUID_AUTOSCRIPT_INCLUDE_H__
+
+#define AUTOSCRIPT_VERSION "0.3.1"
+
+// number of packages
+#define NUM_PACKAGES (80)
+
+// number of scripts
+#define NUM_AUTOSCRIPTS (968)
+
+// function declarations
+// bench/null_benchmark.c
+benchmark_function_t benchmark_null;
+// src/agc/bench/agc_crcf_benchmark.c
+benchmark_function_t benchmark_agc_crcf;
+// src/audio/bench/cvsd_benchmark.c
+benchmark_function_t benchmark_cvsd_encode;
+benchmark_function_t benchmark_cvsd_decode;
+// src/buffer/bench/cbuffercf_benchmark.c
+benchmark_function_t benchmark_cbuffercf_n16;
+benchmark_function_t benchmark_cbuffercf_n32;
+benchmark_function_t benchmark_cbuffercf_n64;
+benchmark_function_t benchmark_cbuffercf_n128;
+benchmark_function_t benchmark_cbuffercf_n256;
+benchmark_function_t benchmark_cbuffercf_n512;
+benchmark_function_t benchmark_cbuffercf_n1024;
+// src/buffer/bench/window_push_benchmark.c
+benchmark_function_t benchmark_windowcf_push_n16;
+benchmark_function_t benchmark_windowcf_push_n32;
+benchmark_function_t benchmark_windowcf_push_n64;
+benchmark_function_t benchmark_windowcf_push_n128;
+benchmark_function_t benchmark_windowcf_push_n256;
+// src/buffer/bench/window_read_benchmark.c
+benchmark_function_t benchmark_windowcf_read_n16;
+benchmark_function_t benchmark_windowcf_read_n32;
+benchmark_function_t benchmark_windowcf_read_n64;
+benchmark_function_t benchmark_windowcf_read_n128;
+benchmark_function_t benchmark_windowcf_read_n256;
+// src/dotprod/bench/dotprod_cccf_benchmark.c
+benchmark_function_t benchmark_dotprod_cccf_4;
+benchmark_function_t benchmark_dotprod_cccf_16;
+benchmark_function_t benchmark_dotprod_cccf_64;
+benchmark_function_t benchmark_dotprod_cccf_256;
+// src/dotprod/bench/dotprod_crcf_benchmark.c
+benchmark_function_t benchmark_dotprod_crcf_4;
+benchmark_function_t benchmark_dotprod_crcf_16;
+benchmark_function_t benchmark_dotprod_crcf_64;
+benchmark_function_t benchmark_dotprod_crcf_256;
+// src/dotprod/bench/dotprod_rrrf_benchmark.c
+benchmark_function_t benchmark_dotprod_rrrf_4;
+benchmark_function_t benchmark_dotprod_rrrf_16;
+benchmark_function_t benchmark_dotprod_rrrf_64;
+benchmark_function_t benchmark_dotprod_rrrf_256;
+// src/dotprod/bench/sumsqf_benchmark.c
+benchmark_function_t benchmark_sumsqf_4;
+benchmark_function_t benchmark_sumsqf_16;
+benchmark_function_t benchmark_sumsqf_64;
+benchmark_function_t benchmark_sumsqf_256;
+// src/dotprod/bench/sumsqcf_benchmark.c
+benchmark_function_t benchmark_sumsqcf_4;
+benchmark_function_t benchmark_sumsqcf_16;
+benchmark_function_t benchmark_sumsqcf_64;
+benchmark_function_t benchmark_sumsqcf_256;
+// src/equalization/bench/eqlms_cccf_benchmark.c
+benchmark_function_t benchmark_eqlms_cccf_n4;
+benchmark_function_t benchmark_eqlms_cccf_n8;
+benchmark_function_t benchmark_eqlms_cccf_n16;
+benchmark_function_t benchmark_eqlms_cccf_n32;
+benchmark_function_t benchmark_eqlms_cccf_n64;
+// src/equalization/bench/eqrls_cccf_benchmark.c
+benchmark_function_t benchmark_eqrls_cccf_n4;
+benchmark_function_t benchmark_eqrls_cccf_n8;
+benchmark_function_t benchmark_eqrls_cccf_n16;
+benchmark_function_t benchmark_eqrls_cccf_n32;
+benchmark_function_t benchmark_eqrls_cccf_n64;
+benchmark_function_t benchmark_eqrls_cccf_invqr_n16;
+benchmark_function_t benchmark_eqrls_cccf_invqr_n64;
+benchmark_function_t benchmark_eqrls_cccf_ftf_n16;
+benchmark_function_t benchmark_eqrls_cccf_ftf_n64;
+benchmark_function_t benchmark_eqrls_cccf_ftf_n256;
+// src/fec/bench/crc_benchmark.c
+benchmark_function_t benchmark_crc_checksum_n256;
+benchmark_function_t benchmark_crc_crc8_n256;
+benchmark_function_t benchmark_crc_crc16_n256;
+benchmark_function_t benchmark_crc_crc24_n256;
+benchmark_function_t benchmark_crc_crc32_n256;
+// src/fec/bench/fec_encode_benchmark.c
+benchmark_function_t benchmark_fec_enc_none_n64;
+benchmark_function_t benchmark_fec_enc_rep3_n64;
+benchmark_function_t benchmark_fec_enc_rep5_n64;
+benchmark_function_t benchmark_fec_enc_hamming74_n64;
+benchmark_function_t benchmark_fec_enc_hamming84_n64;
+benchmark_function_t benchmark_fec_enc_hamming128_n64;
+benchmark_function_t benchmark_fec_enc_secded2216_n64;
+benchmark_function_t benchmark_fec_enc_secded3932_n64;
+benchmark_function_t benchmark_fec_enc_secded7264_n64;
+benchmark_function_t benchmark_fec_enc_golay2412_n64;
+benchmark_function_t benchmark_fec_enc_conv27_n64;
+benchmark_function_t benchmark_fec_enc_conv29_n64;
+benchmark_function_t benchmark_fec_enc_conv39_n64;
+benchmark_function_t benchmark_fec_enc_conv615_n64;
+benchmark_function_t benchmark_fec_enc_conv27p23_n64;
+benchmark_function_t benchmark_fec_enc_conv27p34_n64;
+benchmark_function_t benchmark_fec_enc_conv27p45_n64;
+benchmark_function_t benchmark_fec_enc_rs8_n64;
+benchmark_function_t benchmark_fec_enc_rs8_n223;
+benchmark_function_t benchmark_fec_enc_rs8_n1024;
+benchmark_function_t benchmark_fec_enc_ldpc12_n64;
+benchmark_function_t benchmark_fec_enc_ldpc12_n144;
+benchmark_function_t benchmark_fec_enc_ldpc34_n216;
+// src/fec/bench/fec_decode_benchmark.c
+benchmark_function_t benchmark_fec_dec_none_n64;
+benchmark_function_t benchmark_fec_dec_rep3_n64;
+benchmark_function_t benchmark_fec_dec_rep5_n64;
+benchmark_function_t benchmark_fec_dec_hamming74_n64;
+benchmark_function_t benchmark_fec_dec_hamming84_n64;
+benchmark_function_t benchmark_fec_dec_hamming128_n64;
+benchmark_function_t benchmark_fec_dec_secded2216_n64;
+benchmark_function_t benchmark_fec_dec_secded3932_n64;
+benchmark_function_t benchmark_fec_dec_secded7264_n64;
+benchmark_function_t benchmark_fec_dec_golay2412_n64;
+benchmark_function_t benchmark_fec_dec_conv27_n64;
+benchmark_function_t benchmark_fec_dec_conv29_n64;
+benchmark_function_t benchmark_fec_dec_conv39_n64;
+benchmark_function_t benchmark_fec_dec_conv615_n64;
+benchmark_function_t benchmark_fec_dec_conv27p23_n64;
+benchmark_function_t benchmark_fec_dec_conv27p34_n64;
+benchmark_function_t benchmark_fec_dec_conv27p45_n64;
+benchmark_function_t benchmark_fec_dec_conv27p56_n64;
+benchmark_function_t benchmark_fec_dec_conv27p67_n64;
+benchmark_function_t benchmark_fec_dec_conv27p78_n64;
+benchmark_function_t benchmark_fec_dec_conv29p23_n64;
+benchmark_function_t benchmark_fec_dec_conv29p34_n64;
+benchmark_function_t benchmark_fec_dec_conv29p45_n64;
+benchmark_function_t benchmark_fec_dec_conv29p56_n64;
+benchmark_function_t benchmark_fec_dec_conv29p67_n64;
+benchmark_function_t benchmark_fec_dec_conv29p78_n64;
+benchmark_function_t benchmark_fec_dec_rs8_n64;
+benchmark_function_t benchmark_fec_dec_rs8_n223;
+benchmark_function_t benchmark_fec_dec_rs8_n1024;
+benchmark_function_t benchmark_fec_dec_ldpc12_n64;
+benchmark_function_t benchmark_fec_dec_ldpc12_n144;
+// src/fec/bench/fecsoft_decode_benchmark.c
+benchmark_function_t benchmark_fecsoft_dec_none_n64;
+benchmark_function_t benchmark_fecsoft_dec_rep3_n64;
+benchmark_function_t benchmark_fecsoft_dec_rep5_n64;
+benchmark_function_t benchmark_fecsoft_dec_hamming74_n64;
+benchmark_function_t benchmark_fecsoft_dec_hamming84_n64;
+benchmark_function_t benchmark_fecsoft_dec_hamming128_n64;
+benchmark_function_t benchmark_fecsoft_dec_conv27_n64;
+benchmark_function_t benchmark_fecsoft_dec_conv29_n64;
+benchmark_function_t benchmark_fecsoft_dec_conv39_n64;
+benchmark_function_t benchmark_fecsoft_dec_conv615_n64;
+benchmark_function_t benchmark_fecsoft_dec_conv27p23_n64;
+benchmark_function_t benchmark_fecsoft_dec_conv27p34_n64;
+benchmark_function_t benchmark_fecsoft_dec_conv27p45_n64;
+benchmark_function_t benchmark_fecsoft_dec_conv27p56_n64;
+benchmark_function_t benchmark_fecsoft_dec_conv27p67_n64;
+benchmark_function_t benchmark_fecsoft_dec_conv27p78_n64;
+benchmark_function_t benchmark_fecsoft_dec_conv29p23_n64;
+benchmark_function_t benchmark_fecsoft_dec_conv29p34_n64;
+benchmark_function_t benchmark_fecsoft_dec_conv29p45_n64;
+benchmark_function_t benchmark_fecsoft_dec_conv29p56_n64;
+benchmark_function_t benchmark_fecsoft_dec_conv29p67_n64;
+benchmark_function_t benchmark_fecsoft_dec_conv29p78_n64;
+benchmark_function_t benchmark_fecsoft_dec_rs8_n64;
+benchmark_function_t benchmark_fecsoft_dec_ldpc12_n64;
+benchmark_function_t benchmark_fecsoft_dec_ldpc12_n144;
+benchmark_function_t benchmark_fecsoft_dec_ldpc34_n216;
+// src/fec/bench/sumproduct_benchmark.c
+benchmark_function_t benchmark_sumproduct_m16;
+benchmark_function_t benchmark_sumproduct_m32;
+benchmark_function_t benchmark_sumproduct_m64;
+benchmark_function_t benchmark_sumproduct_m128;
+// src/fec/bench/interleaver_benchmark.c
+benchmark_function_t benchmark_interleaver_8;
+benchmark_function_t benchmark_interleaver_16;
+benchmark_function_t benchmark_interleaver_32;
+benchmark_function_t benchmark_interleaver_64;
+benchmark_function_t benchmark_interleaver_128;
+benchmark_function_t benchmark_interleaver_256;
+benchmark_function_t benchmark_interleaver_512;
+benchmark_function_t benchmark_interleaver_1024;
+benchmark_function_t benchmark_interleaver_soft_64;
+benchmark_function_t benchmark_interleaver_soft_256;
+benchmark_function_t benchmark_interleaver_soft_1024;
+// src/fec/bench/packetizer_decode_benchmark.c
+benchmark_function_t benchmark_packetizer_n16;
+benchmark_function_t benchmark_packetizer_n32;
+benchmark_function_t benchmark_packetizer_n64;
+benchmark_function_t benchmark_packetizer_n128;
+benchmark_function_t benchmark_packetizer_n256;
+benchmark_function_t benchmark_packetizer_n512;
+benchmark_function_t benchmark_packetizer_n1024;
+benchmark_function_t benchmark_packetizer_n256_crc32_h74;
+benchmark_function_t benchmark_packetizer_n256_crc32_g2412;
+// src/fft/bench/fft_composite_benchmark.c
+benchmark_function_t benchmark_fft_6;
+benchmark_function_t benchmark_fft_9;
+benchmark_function_t benchmark_fft_10;
+benchmark_function_t benchmark_fft_12;
+benchmark_function_t benchmark_fft_14;
+benchmark_function_t benchmark_fft_15;
+benchmark_function_t benchmark_fft_18;
+benchmark_function_t benchmark_fft_20;
+benchmark_function_t benchmark_fft_21;
+benchmark_function_t benchmark_fft_22;
+benchmark_function_t benchmark_fft_24;
+benchmark_function_t benchmark_fft_25;
+benchmark_function_t benchmark_fft_26;
+benchmark_function_t benchmark_fft_27;
+benchmark_function_t benchmark_fft_28;
+benchmark_function_t benchmark_fft_30;
+benchmark_function_t benchmark_fft_33;
+benchmark_function_t benchmark_fft_34;
+benchmark_function_t benchmark_fft_35;
+benchmark_function_t benchmark_fft_36;
+benchmark_function_t benchmark_fft_38;
+benchmark_function_t benchmark_fft_39;
+benchmark_function_t benchmark_fft_40;
+benchmark_function_t benchmark_fft_42;
+benchmark_function_t benchmark_fft_44;
+benchmark_function_t benchmark_fft_45;
+benchmark_function_t benchmark_fft_46;
+benchmark_function_t benchmark_fft_48;
+benchmark_function_t benchmark_fft_49;
+benchmark_function_t benchmark_fft_50;
+benchmark_function_t benchmark_fft_51;
+benchmark_function_t benchmark_fft_52;
+benchmark_function_t benchmark_fft_54;
+benchmark_function_t benchmark_fft_55;
+benchmark_function_t benchmark_fft_56;
+benchmark_function_t benchmark_fft_57;
+benchmark_function_t benchmark_fft_58;
+benchmark_function_t benchmark_fft_60;
+benchmark_function_t benchmark_fft_62;
+benchmark_function_t benchmark_fft_63;
+benchmark_function_t benchmark_fft_65;
+benchmark_function_t benchmark_fft_66;
+benchmark_function_t benchmark_fft_68;
+benchmark_function_t benchmark_fft_69;
+benchmark_function_t benchmark_fft_70;
+benchmark_function_t benchmark_fft_72;
+benchmark_function_t benchmark_fft_74;
+benchmark_function_t benchmark_fft_75;
+benchmark_function_t benchmark_fft_76;
+benchmark_function_t benchmark_fft_77;
+benchmark_function_t benchmark_fft_78;
+benchmark_function_t benchmark_fft_80;
+benchmark_function_t benchmark_fft_81;
+benchmark_function_t benchmark_fft_82;
+benchmark_function_t benchmark_fft_84;
+benchmark_function_t benchmark_fft_85;
+benchmark_function_t benchmark_fft_86;
+benchmark_function_t benchmark_fft_87;
+benchmark_function_t benchmark_fft_88;
+benchmark_function_t benchmark_fft_90;
+benchmark_function_t benchmark_fft_91;
+benchmark_function_t benchmark_fft_92;
+benchmark_function_t benchmark_fft_93;
+benchmark_function_t benchmark_fft_94;
+benchmark_function_t benchmark_fft_95;
+benchmark_function_t benchmark_fft_96;
+benchmark_function_t benchmark_fft_98;
+benchmark_function_t benchmark_fft_99;
+benchmark_function_t benchmark_fft_100;
+benchmark_function_t benchmark_fft_102;
+benchmark_function_t benchmark_fft_104;
+benchmark_function_t benchmark_fft_105;
+benchmark_function_t benchmark_fft_106;
+benchmark_function_t benchmark_fft_108;
+benchmark_function_t benchmark_fft_110;
+benchmark_function_t benchmark_fft_111;
+benchmark_function_t benchmark_fft_112;
+benchmark_function_t benchmark_fft_114;
+benchmark_function_t benchmark_fft_115;
+benchmark_function_t benchmark_fft_116;
+benchmark_function_t benchmark_fft_117;
+benchmark_function_t benchmark_fft_118;
+benchmark_function_t benchmark_fft_119;
+benchmark_function_t benchmark_fft_120;
+benchmark_function_t benchmark_fft_121;
+benchmark_function_t benchmark_fft_122;
+benchmark_function_t benchmark_fft_123;
+benchmark_function_t benchmark_fft_124;
+benchmark_function_t benchmark_fft_125;
+benchmark_function_t benchmark_fft_126;
+benchmark_function_t benchmark_fft_129;
+benchmark_function_t benchmark_fft_130;
+benchmark_function_t benchmark_fft_132;
+benchmark_function_t benchmark_fft_133;
+benchmark_function_t benchmark_fft_134;
+benchmark_function_t benchmark_fft_135;
+benchmark_function_t benchmark_fft_136;
+benchmark_function_t benchmark_fft_138;
+benchmark_function_t benchmark_fft_140;
+benchmark_function_t benchmark_fft_141;
+benchmark_function_t benchmark_fft_142;
+benchmark_function_t benchmark_fft_143;
+benchmark_function_t benchmark_fft_144;
+benchmark_function_t benchmark_fft_145;
+benchmark_function_t benchmark_fft_146;
+benchmark_function_t benchmark_fft_147;
+benchmark_function_t benchmark_fft_148;
+benchmark_function_t benchmark_fft_150;
+benchmark_function_t benchmark_fft_152;
+benchmark_function_t benchmark_fft_153;
+benchmark_function_t benchmark_fft_154;
+benchmark_function_t benchmark_fft_155;
+benchmark_function_t benchmark_fft_156;
+benchmark_function_t benchmark_fft_158;
+benchmark_function_t benchmark_fft_159;
+benchmark_function_t benchmark_fft_160;
+benchmark_function_t benchmark_fft_161;
+benchmark_function_t benchmark_fft_162;
+benchmark_function_t benchmark_fft_164;
+benchmark_function_t benchmark_fft_165;
+benchmark_function_t benchmark_fft_166;
+benchmark_function_t benchmark_fft_168;
+benchmark_function_t benchmark_fft_169;
+benchmark_function_t benchmark_fft_170;
+benchmark_function_t benchmark_fft_171;
+benchmark_function_t benchmark_fft_172;
+benchmark_function_t benchmark_fft_174;
+benchmark_function_t benchmark_fft_175;
+benchmark_function_t benchmark_fft_176;
+benchmark_function_t benchmark_fft_177;
+benchmark_function_t benchmark_fft_178;
+benchmark_function_t benchmark_fft_180;
+benchmark_function_t benchmark_fft_182;
+benchmark_function_t benchmark_fft_183;
+benchmark_function_t benchmark_fft_184;
+benchmark_function_t benchmark_fft_185;
+benchmark_function_t benchmark_fft_186;
+benchmark_function_t benchmark_fft_187;
+benchmark_function_t benchmark_fft_188;
+benchmark_function_t benchmark_fft_189;
+benchmark_function_t benchmark_fft_190;
+benchmark_function_t benchmark_fft_192;
+benchmark_function_t benchmark_fft_194;
+benchmark_function_t benchmark_fft_195;
+benchmark_function_t benchmark_fft_196;
+benchmark_function_t benchmark_fft_198;
+benchmark_function_t benchmark_fft_200;
+benchmark_function_t benchmark_fft_201;
+benchmark_function_t benchmark_fft_202;
+benchmark_function_t benchmark_fft_203;
+benchmark_function_t benchmark_fft_204;
+benchmark_function_t benchmark_fft_205;
+benchmark_function_t benchmark_fft_206;
+benchmark_function_t benchmark_fft_207;
+benchmark_function_t benchmark_fft_208;
+benchmark_function_t benchmark_fft_209;
+benchmark_function_t benchmark_fft_210;
+benchmark_function_t benchmark_fft_212;
+benchmark_function_t benchmark_fft_213;
+benchmark_function_t benchmark_fft_214;
+benchmark_function_t benchmark_fft_215;
+benchmark_function_t benchmark_fft_216;
+benchmark_function_t benchmark_fft_217;
+benchmark_function_t benchmark_fft_218;
+benchmark_function_t benchmark_fft_219;
+benchmark_function_t benchmark_fft_220;
+benchmark_function_t benchmark_fft_221;
+benchmark_function_t benchmark_fft_222;
+benchmark_function_t benchmark_fft_224;
+benchmark_function_t benchmark_fft_225;
+benchmark_function_t benchmark_fft_226;
+benchmark_function_t benchmark_fft_228;
+benchmark_function_t benchmark_fft_230;
+benchmark_function_t benchmark_fft_231;
+benchmark_function_t benchmark_fft_232;
+benchmark_function_t benchmark_fft_234;
+benchmark_function_t benchmark_fft_235;
+benchmark_function_t benchmark_fft_236;
+benchmark_function_t benchmark_fft_237;
+benchmark_function_t benchmark_fft_238;
+benchmark_function_t benchmark_fft_240;
+benchmark_function_t benchmark_fft_242;
+benchmark_function_t benchmark_fft_243;
+benchmark_function_t benchmark_fft_244;
+benchmark_function_t benchmark_fft_245;
+benchmark_function_t benchmark_fft_246;
+benchmark_function_t benchmark_fft_247;
+benchmark_function_t benchmark_fft_248;
+benchmark_function_t benchmark_fft_249;
+benchmark_function_t benchmark_fft_250;
+benchmark_function_t benchmark_fft_252;
+benchmark_function_t benchmark_fft_253;
+benchmark_function_t benchmark_fft_254;
+benchmark_function_t benchmark_fft_255;
+// src/fft/bench/fft_prime_benchmark.c
+benchmark_function_t benchmark_fft_3;
+benchmark_function_t benchmark_fft_5;
+benchmark_function_t benchmark_fft_7;
+benchmark_function_t benchmark_fft_11;
+benchmark_function_t benchmark_fft_13;
+benchmark_function_t benchmark_fft_17;
+benchmark_function_t benchmark_fft_19;
+benchmark_function_t benchmark_fft_23;
+benchmark_function_t benchmark_fft_29;
+benchmark_function_t benchmark_fft_31;
+benchmark_function_t benchmark_fft_37;
+benchmark_function_t benchmark_fft_41;
+benchmark_function_t benchmark_fft_43;
+benchmark_function_t benchmark_fft_47;
+benchmark_function_t benchmark_fft_53;
+benchmark_function_t benchmark_fft_59;
+benchmark_function_t benchmark_fft_61;
+benchmark_function_t benchmark_fft_67;
+benchmark_function_t benchmark_fft_71;
+benchmark_function_t benchmark_fft_73;
+benchmark_function_t benchmark_fft_79;
+benchmark_function_t benchmark_fft_83;
+benchmark_function_t benchmark_fft_89;
+benchmark_function_t benchmark_fft_97;
+benchmark_function_t benchmark_fft_101;
+benchmark_function_t benchmark_fft_103;
+benchmark_function_t benchmark_fft_107;
+benchmark_function_t benchmark_fft_109;
+benchmark_function_t benchmark_fft_113;
+benchmark_function_t benchmark_fft_127;
+benchmark_function_t benchmark_fft_131;
+benchmark_function_t benchmark_fft_137;
+benchmark_function_t benchmark_fft_139;
+benchmark_function_t benchmark_fft_149;
+benchmark_function_t benchmark_fft_151;
+benchmark_function_t benchmark_fft_157;
+benchmark_function_t benchmark_fft_163;
+benchmark_function_t benchmark_fft_167;
+benchmark_function_t benchmark_fft_173;
+benchmark_function_t benchmark_fft_179;
+benchmark_function_t benchmark_fft_181;
+benchmark_function_t benchmark_fft_191;
+benchmark_function_t benchmark_fft_193;
+benchmark_function_t benchmark_fft_197;
+benchmark_function_t benchmark_fft_199;
+benchmark_function_t benchmark_fft_211;
+benchmark_function_t benchmark_fft_223;
+benchmark_function_t benchmark_fft_227;
+benchmark_function_t benchmark_fft_229;
+benchmark_function_t benchmark_fft_233;
+benchmark_function_t benchmark_fft_239;
+benchmark_function_t benchmark_fft_241;
+benchmark_function_t benchmark_fft_251;
+benchmark_function_t benchmark_fft_257;
+benchmark_function_t benchmark_fft_263;
+benchmark_function_t benchmark_fft_269;
+benchmark_function_t benchmark_fft_271;
+benchmark_function_t benchmark_fft_277;
+benchmark_function_t benchmark_fft_281;
+benchmark_function_t benchmark_fft_283;
+benchmark_function_t benchmark_fft_293;
+benchmark_function_t benchmark_fft_307;
+benchmark_function_t benchmark_fft_311;
+benchmark_function_t benchmark_fft_313;
+benchmark_function_t benchmark_fft_317;
+benchmark_function_t benchmark_fft_331;
+benchmark_function_t benchmark_fft_337;
+benchmark_function_t benchmark_fft_347;
+benchmark_function_t benchmark_fft_349;
+benchmark_function_t benchmark_fft_353;
+benchmark_function_t benchmark_fft_359;
+benchmark_function_t benchmark_fft_367;
+benchmark_function_t benchmark_fft_373;
+benchmark_function_t benchmark_fft_379;
+benchmark_function_t benchmark_fft_383;
+benchmark_function_t benchmark_fft_389;
+benchmark_function_t benchmark_fft_397;
+benchmark_function_t benchmark_fft_401;
+benchmark_function_t benchmark_fft_409;
+benchmark_function_t benchmark_fft_419;
+benchmark_function_t benchmark_fft_421;
+benchmark_function_t benchmark_fft_431;
+benchmark_function_t benchmark_fft_433;
+benchmark_function_t benchmark_fft_439;
+benchmark_function_t benchmark_fft_443;
+benchmark_function_t benchmark_fft_449;
+benchmark_function_t benchmark_fft_457;
+benchmark_function_t benchmark_fft_461;
+benchmark_function_t benchmark_fft_463;
+benchmark_function_t benchmark_fft_467;
+benchmark_function_t benchmark_fft_479;
+benchmark_function_t benchmark_fft_487;
+benchmark_function_t benchmark_fft_491;
+benchmark_function_t benchmark_fft_499;
+benchmark_function_t benchmark_fft_503;
+benchmark_function_t benchmark_fft_509;
+// src/fft/bench/fft_radix2_benchmark.c
+benchmark_function_t benchmark_fft_2;
+benchmark_function_t benchmark_fft_4;
+benchmark_function_t benchmark_fft_8;
+benchmark_function_t benchmark_fft_16;
+benchmark_function_t benchmark_fft_32;
+benchmark_function_t benchmark_fft_64;
+benchmark_function_t benchmark_fft_128;
+benchmark_function_t benchmark_fft_256;
+benchmark_function_t benchmark_fft_512;
+benchmark_function_t benchmark_fft_1024;
+benchmark_function_t benchmark_fft_2048;
+benchmark_function_t benchmark_fft_4096;
+benchmark_function_t benchmark_fft_8192;
+benchmark_function_t benchmark_fft_16384;
+benchmark_function_t benchmark_fft_32768;
+// src/fft/bench/fft_r2r_benchmark.c
+benchmark_function_t benchmark_fft_REDFT00_128;
+benchmark_function_t benchmark_fft_REDFT01_128;
+benchmark_function_t benchmark_fft_REDFT10_128;
+benchmark_function_t benchmark_fft_REDFT11_128;
+benchmark_function_t benchmark_fft_RODFT00_128;
+benchmark_function_t benchmark_fft_RODFT01_128;
+benchmark_function_t benchmark_fft_RODFT10_128;
+benchmark_function_t benchmark_fft_RODFT11_128;
+benchmark_function_t benchmark_fft_REDFT00_127;
+benchmark_function_t benchmark_fft_REDFT01_127;
+benchmark_function_t benchmark_fft_REDFT10_127;
+benchmark_function_t benchmark_fft_REDFT11_127;
+benchmark_function_t benchmark_fft_RODFT00_127;
+benchmark_function_t benchmark_fft_RODFT01_127;
+benchmark_function_t benchmark_fft_RODFT10_127;
+benchmark_function_t benchmark_fft_RODFT11_127;
+// src/fft/bench/spgramcf_benchmark.c
+benchmark_function_t benchmark_spgramcf_1200;
+benchmark_function_t benchmark_spgramcf_9600;
+benchmark_function_t benchmark_spgramcf_76800;
+benchmark_function_t benchmark_spgramcf_614400;
+// src/filter/bench/fftfilt_crcf_benchmark.c
+benchmark_function_t benchmark_fftfilt_crcf_4;
+benchmark_function_t benchmark_fftfilt_crcf_8;
+benchmark_function_t benchmark_fftfilt_crcf_16;
+benchmark_function_t benchmark_fftfilt_crcf_32;
+benchmark_function_t benchmark_fftfilt_crcf_64;
+// src/filter/bench/firdecim_crcf_benchmark.c
+benchmark_function_t benchmark_firdecim_crcf_m2_h8;
+benchmark_function_t benchmark_firdecim_crcf_m4_h16;
+benchmark_function_t benchmark_firdecim_crcf_m8_h32;
+benchmark_function_t benchmark_firdecim_crcf_m16_h64;
+benchmark_function_t benchmark_firdecim_cccf_m32_h128;
+// src/filter/bench/firdespm_benchmark.c
+benchmark_function_t benchmark_firdespm_n51;
+benchmark_function_t benchmark_firdespm_n101;
+benchmark_function_t benchmark_firdespm_n251;
+benchmark_function_t benchmark_firdespm_n501;
+benchmark_function_t benchmark_firdespm_n1001;
+benchmark_function_t benchmark_firdespm_n2001;
+benchmark_function_t benchmark_firdespm_n2001_w4;
+// src/filter/bench/firhilb_benchmark.c
+benchmark_function_t benchmark_firhilbf_decim_m3;
+benchmark_function_t benchmark_firhilbf_decim_m5;
+benchmark_function_t benchmark_firhilbf_decim_m9;
+benchmark_function_t benchmark_firhilbf_decim_m13;
+benchmark_function_t benchmark_firhilbf_c2r_m13;
+benchmark_function_t benchmark_firhilbf_c2r_m25;
+benchmark_function_t benchmark_firhilbf_c2r_block_m13;
+benchmark_function_t benchmark_firhilbf_c2r_block_m25;
+// src/filter/bench/firinterp_crcf_benchmark.c
+benchmark_function_t benchmark_firinterp_crcf_m2_h8;
+benchmark_function_t benchmark_firinterp_crcf_m4_h16;
+benchmark_function_t benchmark_firinterp_crcf_m8_h32;
+benchmark_function_t benchmark_firinterp_crcf_m16_h64;
+benchmark_function_t benchmark_firinterp_crcf_m32_h128;
+// src/filter/bench/firfilt_crcf_benchmark.c
+benchmark_function_t benchmark_firfilt_crcf_4;
+benchmark_function_t benchmark_firfilt_crcf_8;
+benchmark_function_t benchmark_firfilt_crcf_16;
+benchmark_function_t benchmark_firfilt_crcf_32;
+benchmark_function_t benchmark_firfilt_crcf_64;
+// src/filter/bench/iirdecim_crcf_benchmark.c
+benchmark_function_t benchmark_iirdecim_crcf_M2;
+benchmark_function_t benchmark_iirdecim_crcf_M4;
+benchmark_function_t benchmark_iirdecim_crcf_M8;
+benchmark_function_t benchmark_iirdecim_crcf_M16;
+benchmark_function_t benchmark_iirdecim_cccf_M32;
+// src/filter/bench/iirfilt_crcf_benchmark.c
+benchmark_function_t benchmark_iirfilt_crcf_4;
+benchmark_function_t benchmark_iirfilt_crcf_8;
+benchmark_function_t benchmark_iirfilt_crcf_16;
+benchmark_function_t benchmark_iirfilt_crcf_32;
+benchmark_function_t benchmark_iirfilt_crcf_64;
+benchmark_function_t benchmark_iirfilt_crcf_sos_4;
+benchmark_function_t benchmark_iirfilt_crcf_sos_8;
+benchmark_function_t benchmark_iirfilt_crcf_sos_16;
+benchmark_function_t benchmark_iirfilt_crcf_sos_32;
+benchmark_function_t benchmark_iirfilt_crcf_sos_64;
+benchmark_function_t benchmark_irfilt_crcf_dcblock;
+// src/filter/bench/iirfiltbank_crcf_benchmark.c
+benchmark_function_t benchmark_iirfiltbank_crcf_M64_n4;
+benchmark_function_t benchmark_iirfiltbank_crcf_M256_n4;
+benchmark_function_t benchmark_iirfiltbank_crcf_M512_n4;
+benchmark_function_t benchmark_iirfiltbank_crcf_M1_n4;
+benchmark_function_t benchmark_iirfiltbank_crcf_M1_n8;
+// src/filter/bench/iirinterp_crcf_benchmark.c
+benchmark_function_t benchmark_iirinterp_crcf_M2;
+benchmark_function_t benchmark_iirinterp_crcf_M4;
+benchmark_function_t benchmark_iirinterp_crcf_M8;
+benchmark_function_t benchmark_iirinterp_crcf_M16;
+benchmark_function_t benchmark_iirinterp_crcf_M32;
+// src/filter/bench/rresamp_crcf_benchmark.c
+benchmark_function_t benchmark_rresamp_crcf_P17_Q1;
+benchmark_function_t benchmark_rresamp_crcf_P17_Q2;
+benchmark_function_t benchmark_rresamp_crcf_P17_Q4;
+benchmark_function_t benchmark_rresamp_crcf_P17_Q8;
+benchmark_function_t benchmark_rresamp_crcf_P17_Q16;
+benchmark_function_t benchmark_rresamp_crcf_P17_Q32;
+benchmark_function_t benchmark_rresamp_crcf_P17_Q64;
+benchmark_function_t benchmark_rresamp_crcf_P17_Q128;
+benchmark_function_t benchmark_rresamp_crcf_P17_Q256;
+// src/filter/bench/resamp_crcf_benchmark.c
+benchmark_function_t benchmark_resamp_crcf_P17_Q1;
+benchmark_function_t benchmark_resamp_crcf_P17_Q2;
+benchmark_function_t benchmark_resamp_crcf_P17_Q4;
+benchmark_function_t benchmark_resamp_crcf_P17_Q8;
+benchmark_function_t benchmark_resamp_crcf_P17_Q16;
+benchmark_function_t benchmark_resamp_crcf_P17_Q32;
+benchmark_function_t benchmark_resamp_crcf_P17_Q64;
+benchmark_function_t benchmark_resamp_crcf_P17_Q128;
+benchmark_function_t benchmark_resamp_crcf_P17_Q256;
+// src/filter/bench/resamp2_crcf_benchmark.c
+benchmark_function_t benchmark_resamp2_crcf_decim_m2;
+benchmark_function_t benchmark_resamp2_crcf_decim_m4;
+benchmark_function_t benchmark_resamp2_crcf_decim_m8;
+benchmark_function_t benchmark_resamp2_crcf_decim_m16;
+benchmark_function_t benchmark_resamp2_crcf_decim_m32;
+benchmark_function_t benchmark_resamp2_crcf_decim_m64;
+benchmark_function_t benchmark_resamp2_crcf_decim_m128;
+benchmark_function_t benchmark_resamp2_crcf_decim_m256;
+benchmark_function_t benchmark_resamp2_crcf_interp_m2;
+benchmark_function_t benchmark_resamp2_crcf_interp_m4;
+benchmark_function_t benchmark_resamp2_crcf_interp_m8;
+benchmark_function_t benchmark_resamp2_crcf_interp_m16;
+benchmark_function_t benchmark_resamp2_crcf_interp_m32;
+benchmark_function_t benchmark_resamp2_crcf_interp_m64;
+benchmark_function_t benchmark_resamp2_crcf_interp_m128;
+benchmark_function_t benchmark_resamp2_crcf_interp_m256;
+// src/filter/bench/symsync_crcf_benchmark.c
+benchmark_function_t benchmark_symsync_crcf_k2_m2;
+benchmark_function_t benchmark_symsync_crcf_k2_m4;
+benchmark_function_t benchmark_symsync_crcf_k2_m8;
+benchmark_function_t benchmark_symsync_crcf_k2_m16;
+// src/framing/bench/presync_benchmark.c
+benchmark_function_t benchmark_presync_cccf_16;
+benchmark_function_t benchmark_presync_cccf_32;
+benchmark_function_t benchmark_presync_cccf_64;
+benchmark_function_t benchmark_presync_cccf_128;
+benchmark_function_t benchmark_presync_cccf_256;
+benchmark_function_t benchmark_presync_cccf_m32_64;
+benchmark_function_t benchmark_presync_cccf_m32_256;
+benchmark_function_t benchmark_presync_cccf_fft_16;
+benchmark_function_t benchmark_presync_cccf_fft_32;
+benchmark_function_t benchmark_presync_cccf_fft_64;
+benchmark_function_t benchmark_presync_cccf_fft_128;
+benchmark_function_t benchmark_presync_cccf_fft_256;
+// src/framing/bench/bpacketsync_benchmark.c
+benchmark_function_t benchmark_bpacketsync;
+// src/framing/bench/bpresync_benchmark.c
+benchmark_function_t benchmark_bpresync_cccf_16;
+benchmark_function_t benchmark_bpresync_cccf_32;
+benchmark_function_t benchmark_bpresync_cccf_64;
+benchmark_function_t benchmark_bpresync_cccf_128;
+benchmark_function_t benchmark_bpresync_cccf_256;
+// src/framing/bench/bsync_benchmark.c
+benchmark_function_t benchmark_bsync_cccf_16;
+benchmark_function_t benchmark_bsync_cccf_32;
+benchmark_function_t benchmark_bsync_cccf_64;
+benchmark_function_t benchmark_bsync_cccf_128;
+benchmark_function_t benchmark_bsync_cccf_256;
+// src/framing/bench/detector_benchmark.c
+benchmark_function_t benchmark_detector_cccf_16;
+benchmark_function_t benchmark_detector_cccf_32;
+benchmark_function_t benchmark_detector_cccf_64;
+benchmark_function_t benchmark_detector_cccf_128;
+benchmark_function_t benchmark_detector_cccf_256;
+// src/framing/bench/flexframesync_benchmark.c
+benchmark_function_t benchmark_flexframesync;
+// src/framing/bench/framesync64_benchmark.c
+benchmark_function_t benchmark_framesync64;
+// src/framing/bench/gmskframesync_benchmark.c
+benchmark_function_t benchmark_gmskframesync;
+benchmark_function_t benchmark_gmskframesync_noise;
+// src/framing/bench/qdetector_benchmark.c
+benchmark_function_t benchmark_qdetector_cccf_16;
+benchmark_function_t benchmark_qdetector_cccf_32;
+benchmark_function_t benchmark_qdetector_cccf_64;
+benchmark_function_t benchmark_qdetector_cccf_128;
+benchmark_function_t benchmark_qdetector_cccf_256;
+benchmark_function_t benchmark_qdetector_cccf_512;
+benchmark_function_t benchmark_qdetector_cccf_1024;
+benchmark_function_t benchmark_qdetector_cccf_2048;
+benchmark_function_t benchmark_qdetector_cccf_4096;
+benchmark_function_t benchmark_qdetector_cccf_8192;
+// src/framing/bench/rxchain_benchmark.c
+benchmark_function_t benchmark_rxchain_framesync64_awgn;
+benchmark_function_t benchmark_rxchain_framesync64_cfo;
+benchmark_function_t benchmark_rxchain_framesync64_multipath;
+benchmark_function_t benchmark_rxchain_framesync64_all;
+benchmark_function_t benchmark_rxchain_flexframesync_awgn;
+benchmark_function_t benchmark_rxchain_flexframesync_cfo;
+benchmark_function_t benchmark_rxchain_flexframesync_multipath;
+benchmark_function_t benchmark_rxchain_flexframesync_all;
+benchmark_function_t benchmark_rxchain_ofdmflexframesync_awgn;
+benchmark_function_t benchmark_rxchain_ofdmflexframesync_cfo;
+benchmark_function_t benchmark_rxchain_ofdmflexframesync_multipath;
+benchmark_function_t benchmark_rxchain_ofdmflexframesync_all;
+// src/math/bench/math_fast_benchmark.c
+benchmark_function_t benchmark_vmath_sincos_exact;
+benchmark_function_t benchmark_vmath_sincos_precise;
+benchmark_function_t benchmark_vmath_sincos_fast;
+benchmark_function_t benchmark_vmath_cexpj_exact;
+benchmark_function_t benchmark_vmath_cexpj_precise;
+benchmark_function_t benchmark_vmath_cexpj_fast;
+benchmark_function_t benchmark_vmath_atan2_exact;
+benchmark_function_t benchmark_vmath_atan2_precise;
+benchmark_function_t benchmark_vmath_atan2_fast;
+benchmark_function_t benchmark_vmath_exp_exact;
+benchmark_function_t benchmark_vmath_exp_precise;
+benchmark_function_t benchmark_vmath_exp_fast;
+benchmark_function_t benchmark_vmath_log_exact;
+benchmark_function_t benchmark_vmath_log_precise;
+benchmark_function_t benchmark_vmath_log_fast;
+benchmark_function_t benchmark_vmath_log10_exact;
+benchmark_function_t benchmark_vmath_log10_precise;
+benchmark_function_t benchmark_vmath_log10_fast;
+// src/math/bench/polyfit_benchmark.c
+benchmark_function_t benchmark_polyf_fit_q3_n8;
+benchmark_function_t benchmark_polyf_fit_q3_n16;
+benchmark_function_t benchmark_polyf_fit_q3_n32;
+benchmark_function_t benchmark_polyf_fit_q3_n64;
+benchmark_function_t benchmark_polyf_fit_q3_n128;
+// src/matrix/bench/matrixcf_mul_benchmark.c
+benchmark_function_t benchmark_matrixcf_mul_n8;
+benchmark_function_t benchmark_matrixcf_mul_n16;
+benchmark_function_t benchmark_matrixcf_mul_n32;
+benchmark_function_t benchmark_matrixcf_mul_n64;
+benchmark_function_t benchmark_matrixcf_mul_ref_n8;
+benchmark_function_t benchmark_matrixcf_mul_ref_n16;
+benchmark_function_t benchmark_matrixcf_mul_ref_n32;
+benchmark_function_t benchmark_matrixcf_mul_ref_n64;
+benchmark_function_t benchmark_matrixcf_transpose_mul_n16;
+benchmark_function_t benchmark_matrixcf_transpose_mul_n64;
+benchmark_function_t benchmark_matrixcf_mulv_n16;
+benchmark_function_t benchmark_matrixcf_mulv_n32;
+benchmark_function_t benchmark_matrixcf_mulv_n64;
+benchmark_function_t benchmark_matrixcf_mulv_ref_n16;
+benchmark_function_t benchmark_matrixcf_mulv_ref_n32;
+benchmark_function_t benchmark_matrixcf_mulv_ref_n64;
+// src/matrix/bench/matrixf_inv_benchmark.c
+benchmark_function_t benchmark_matrixf_inv_n2;
+benchmark_function_t benchmark_matrixf_inv_n4;
+benchmark_function_t benchmark_matrixf_inv_n8;
+benchmark_function_t benchmark_matrixf_inv_n16;
+benchmark_function_t benchmark_matrixf_inv_n32;
+benchmark_function_t benchmark_matrixf_inv_n64;
+// src/matrix/bench/matrixf_linsolve_benchmark.c
+benchmark_function_t benchmark_matrixf_linsolve_n2;
+benchmark_function_t benchmark_matrixf_linsolve_n4;
+benchmark_function_t benchmark_matrixf_linsolve_n8;
+benchmark_function_t benchmark_matrixf_linsolve_n16;
+benchmark_function_t benchmark_matrixf_linsolve_n32;
+benchmark_function_t benchmark_matrixf_linsolve_n64;
+// src/matrix/bench/matrixf_lusolve_benchmark.c
+benchmark_function_t benchmark_matrixf_lusolve_n16;
+benchmark_function_t benchmark_matrixf_lusolve_n32;
+benchmark_function_t benchmark_matrixf_lusolve_n64;
+benchmark_function_t benchmark_matrixf_gjelim_n16;
+benchmark_function_t benchmark_matrixf_gjelim_n32;
+benchmark_function_t benchmark_matrixf_gjelim_n64;
+benchmark_function_t benchmark_matrixf_cholsolve_n16;
+benchmark_function_t benchmark_matrixf_cholsolve_n32;
+benchmark_function_t benchmark_matrixf_cholsolve_n64;
+// src/matrix/bench/matrixf_mul_benchmark.c
+benchmark_function_t benchmark_matrixf_mul_n2;
+benchmark_function_t benchmark_matrixf_mul_n4;
+benchmark_function_t benchmark_matrixf_mul_n8;
+benchmark_function_t benchmark_matrixf_mul_n16;
+benchmark_function_t benchmark_matrixf_mul_n32;
+benchmark_function_t benchmark_matrixf_mul_n64;
+// src/matrix/bench/smatrixf_mul_benchmark.c
+benchmark_function_t benchmark_smatrixf_mul_n32;
+benchmark_function_t benchmark_smatrixf_mul_n64;
+benchmark_function_t benchmark_smatrixf_mul_n128;
+benchmark_function_t benchmark_smatrixf_mul_n256;
+benchmark_function_t benchmark_smatrixf_mul_n512;
+// src/modem/bench/ampmodem_benchmark.c
+benchmark_function_t benchmark_ampmodem_demod_usb_sc;
+benchmark_function_t benchmark_ampmodem_demod_usb_sc_block;
+benchmark_function_t benchmark_ampmodem_demod_usb;
+benchmark_function_t benchmark_ampmodem_demod_usb_block;
+// src/modem/bench/cpfskdem_benchmark.c
+benchmark_function_t benchmark_cpfskdem_noncoherent;
+benchmark_function_t benchmark_cpfskdem_noncoherent_block;
+benchmark_function_t benchmark_cpfskdem_coherent;
+benchmark_function_t benchmark_cpfskdem_coherent_block;
+// src/modem/bench/freqdem_benchmark.c
+benchmark_function_t benchmark_freqdem;
+benchmark_function_t benchmark_freqdem_block_exact;
+benchmark_function_t benchmark_freqdem_block_terms3;
+benchmark_function_t benchmark_freqdem_block_terms5;
+benchmark_function_t benchmark_freqdem_block_terms7;
+// src/modem/bench/freqmod_benchmark.c
+benchmark_function_t benchmark_freqmod;
+// src/modem/bench/fskdem_benchmark.c
+benchmark_function_t benchmark_fskdem_norm_M2;
+benchmark_function_t benchmark_fskdem_norm_M4;
+benchmark_function_t benchmark_fskdem_norm_M8;
+benchmark_function_t benchmark_fskdem_norm_M16;
+benchmark_function_t benchmark_fskdem_norm_M32;
+benchmark_function_t benchmark_fskdem_norm_M64;
+benchmark_function_t benchmark_fskdem_norm_M128;
+benchmark_function_t benchmark_fskdem_norm_M256;
+benchmark_function_t benchmark_fskdem_norm_M512;
+benchmark_function_t benchmark_fskdem_norm_M1024;
+benchmark_function_t benchmark_fskdem_misc_M2;
+benchmark_function_t benchmark_fskdem_misc_M4;
+benchmark_function_t benchmark_fskdem_misc_M8;
+benchmark_function_t benchmark_fskdem_misc_M16;
+benchmark_function_t benchmark_fskdem_misc_M32;
+benchmark_function_t benchmark_fskdem_misc_M64;
+benchmark_function_t benchmark_fskdem_misc_M128;
+benchmark_function_t benchmark_fskdem_misc_M256;
+benchmark_function_t benchmark_fskdem_misc_M512;
+benchmark_function_t benchmark_fskdem_misc_M1024;
+benchmark_function_t benchmark_fskdem_block_fft_M2;
+benchmark_function_t benchmark_fskdem_block_fft_M4;
+benchmark_function_t benchmark_fskdem_block_fft_M8;
+benchmark_function_t benchmark_fskdem_block_pruned_M2;
+benchmark_function_t benchmark_fskdem_block_pruned_M4;
+benchmark_function_t benchmark_fskdem_block_pruned_M8;
+// src/modem/bench/fskmod_benchmark.c
+benchmark_function_t benchmark_fskmod_norm_M2;
+benchmark_function_t benchmark_fskmod_norm_M4;
+benchmark_function_t benchmark_fskmod_norm_M8;
+benchmark_function_t benchmark_fskmod_norm_M16;
+benchmark_function_t benchmark_fskmod_norm_M32;
+benchmark_function_t benchmark_fskmod_norm_M64;
+benchmark_function_t benchmark_fskmod_norm_M128;
+benchmark_function_t benchmark_fskmod_norm_M256;
+benchmark_function_t benchmark_fskmod_norm_M512;
+benchmark_function_t benchmark_fskmod_norm_M1024;
+benchmark_function_t benchmark_fskmod_misc_M2;
+benchmark_function_t benchmark_fskmod_misc_M4;
+benchmark_function_t benchmark_fskmod_misc_M8;
+benchmark_function_t benchmark_fskmod_misc_M16;
+benchmark_function_t benchmark_fskmod_misc_M32;
+benchmark_function_t benchmark_fskmod_misc_M64;
+benchmark_function_t benchmark_fskmod_misc_M128;
+benchmark_function_t benchmark_fskmod_misc_M256;
+benchmark_function_t benchmark_fskmod_misc_M512;
+benchmark_function_t benchmark_fskmod_misc_M1024;
+// src/modem/bench/gmskmodem_benchmark.c
+benchmark_function_t benchmark_gmskmodem_modulate;
+benchmark_function_t benchmark_gmskmodem_demodulate;
+benchmark_function_t benchmark_gmskmodem_demodulate_block;
+// src/modem/bench/modem_modulate_benchmark.c
+benchmark_function_t benchmark_modulate_bpsk;
+benchmark_function_t benchmark_modulate_qpsk;
+benchmark_function_t benchmark_modulate_ook;
+benchmark_function_t benchmark_modulate_sqam32;
+benchmark_function_t benchmark_modulate_sqam128;
+benchmark_function_t benchmark_modulate_ask2;
+benchmark_function_t benchmark_modulate_ask4;
+benchmark_function_t benchmark_modulate_ask8;
+benchmark_function_t benchmark_modulate_ask16;
+benchmark_function_t benchmark_modulate_psk2;
+benchmark_function_t benchmark_modulate_psk4;
+benchmark_function_t benchmark_modulate_psk8;
+benchmark_function_t benchmark_modulate_psk16;
+benchmark_function_t benchmark_modulate_psk32;
+benchmark_function_t benchmark_modulate_psk64;
+benchmark_function_t benchmark_modulate_dpsk2;
+benchmark_function_t benchmark_modulate_dpsk4;
+benchmark_function_t benchmark_modulate_dpsk8;
+benchmark_function_t benchmark_modulate_dpsk16;
+benchmark_function_t benchmark_modulate_dpsk32;
+benchmark_function_t benchmark_modulate_dpsk64;
+benchmark_function_t benchmark_modulate_qam4;
+benchmark_function_t benchmark_modulate_qam8;
+benchmark_function_t benchmark_modulate_qam16;
+benchmark_function_t benchmark_modulate_qam32;
+benchmark_function_t benchmark_modulate_qam64;
+benchmark_function_t benchmark_modulate_qam128;
+benchmark_function_t benchmark_modulate_qam256;
+benchmark_function_t benchmark_modulate_apsk4;
+benchmark_function_t benchmark_modulate_apsk8;
+benchmark_function_t benchmark_modulate_apsk16;
+benchmark_function_t benchmark_modulate_apsk32;
+benchmark_function_t benchmark_modulate_apsk64;
+benchmark_function_t benchmark_modulate_apsk128;
+benchmark_function_t benchmark_modulate_apsk256;
+benchmark_function_t benchmark_modulate_arbV29;
+benchmark_function_t benchmark_modulate_arb16opt;
+benchmark_function_t benchmark_modulate_arb32opt;
+benchmark_function_t benchmark_modulate_arb64opt;
+benchmark_function_t benchmark_modulate_arb128opt;
+benchmark_function_t benchmark_modulate_arb256opt;
+benchmark_function_t benchmark_modulate_arb64vt;
+// src/modem/bench/modem_demodulate_benchmark.c
+benchmark_function_t benchmark_demodulate_bpsk;
+benchmark_function_t benchmark_demodulate_qpsk;
+benchmark_function_t benchmark_demodulate_ook;
+benchmark_function_t benchmark_demodulate_sqam32;
+benchmark_function_t benchmark_demodulate_sqam128;
+benchmark_function_t benchmark_demodulate_ask2;
+benchmark_function_t benchmark_demodulate_ask4;
+benchmark_function_t benchmark_demodulate_ask8;
+benchmark_function_t benchmark_demodulate_ask16;
+benchmark_function_t benchmark_demodulate_psk2;
+benchmark_function_t benchmark_demodulate_psk4;
+benchmark_function_t benchmark_demodulate_psk8;
+benchmark_function_t benchmark_demodulate_psk16;
+benchmark_function_t benchmark_demodulate_psk32;
+benchmark_function_t benchmark_demodulate_psk64;
+benchmark_function_t benchmark_demodulate_dpsk2;
+benchmark_function_t benchmark_demodulate_dpsk4;
+benchmark_function_t benchmark_demodulate_dpsk8;
+benchmark_function_t benchmark_demodulate_dpsk16;
+benchmark_function_t benchmark_demodulate_dpsk32;
+benchmark_function_t benchmark_demodulate_dpsk64;
+benchmark_function_t benchmark_demodulate_qam4;
+benchmark_function_t benchmark_demodulate_qam8;
+benchmark_function_t benchmark_demodulate_qam16;
+benchmark_function_t benchmark_demodulate_qam32;
+benchmark_function_t benchmark_demodulate_qam64;
+benchmark_function_t benchmark_demodulate_qam128;
+benchmark_function_t benchmark_demodulate_qam256;
+benchmark_function_t benchmark_demodulate_apsk4;
+benchmark_function_t benchmark_demodulate_apsk8;
+benchmark_function_t benchmark_demodulate_apsk16;
+benchmark_function_t benchmark_demodulate_apsk32;
+benchmark_function_t benchmark_demodulate_apsk64;
+benchmark_function_t benchmark_demodulate_apsk128;
+benchmark_function_t benchmark_demodulate_apsk256;
+benchmark_function_t benchmark_demodulate_arbV29;
+benchmark_function_t benchmark_demodulate_arb16opt;
+benchmark_function_t benchmark_demodulate_arb32opt;
+benchmark_function_t benchmark_demodulate_arb64opt;
+benchmark_function_t benchmark_demodulate_arb128opt;
+benchmark_function_t benchmark_demodulate_arb256opt;
+benchmark_function_t benchmark_demodulate_arb64vt;
+// src/modem/bench/modem_demodulate_block_benchmark.c
+benchmark_function_t benchmark_demodulate_block_bpsk;
+benchmark_function_t benchmark_demodulate_block_qpsk;
+benchmark_function_t benchmark_demodulate_block_ask16;
+benchmark_function_t benchmark_demodulate_block_psk8;
+benchmark_function_t benchmark_demodulate_block_dpsk8;
+benchmark_function_t benchmark_demodulate_block_qam16;
+benchmark_function_t benchmark_demodulate_block_qam64;
+benchmark_function_t benchmark_demodulate_block_qam256;
+benchmark_function_t benchmark_demodulate_block_apsk64;
+// src/modem/bench/modem_demodsoft_benchmark.c
+benchmark_function_t benchmark_demodsoft_bpsk;
+benchmark_function_t benchmark_demodsoft_qpsk;
+benchmark_function_t benchmark_demodsoft_ook;
+benchmark_function_t benchmark_demodsoft_sqam32;
+benchmark_function_t benchmark_demodsoft_sqam128;
+benchmark_function_t benchmark_demodsoft_ask2;
+benchmark_function_t benchmark_demodsoft_ask4;
+benchmark_function_t benchmark_demodsoft_ask8;
+benchmark_function_t benchmark_demodsoft_ask16;
+benchmark_function_t benchmark_demodsoft_psk2;
+benchmark_function_t benchmark_demodsoft_psk4;
+benchmark_function_t benchmark_demodsoft_psk8;
+benchmark_function_t benchmark_demodsoft_psk16;
+benchmark_function_t benchmark_demodsoft_psk32;
+benchmark_function_t benchmark_demodsoft_psk64;
+benchmark_function_t benchmark_demodsoft_dpsk2;
+benchmark_function_t benchmark_demodsoft_dpsk4;
+benchmark_function_t benchmark_demodsoft_dpsk8;
+benchmark_function_t benchmark_demodsoft_dpsk16;
+benchmark_function_t benchmark_demodsoft_dpsk32;
+benchmark_function_t benchmark_demodsoft_dpsk64;
+benchmark_function_t benchmark_demodsoft_qam4;
+benchmark_function_t benchmark_demodsoft_qam8;
+benchmark_function_t benchmark_demodsoft_qam16;
+benchmark_function_t benchmark_demodsoft_qam32;
+benchmark_function_t benchmark_demodsoft_qam64;
+benchmark_function_t benchmark_demodsoft_qam128;
+benchmark_function_t benchmark_demodsoft_qam256;
+benchmark_function_t benchmark_demodsoft_apsk4;
+benchmark_function_t benchmark_demodsoft_apsk8;
+benchmark_function_t benchmark_demodsoft_apsk16;
+benchmark_function_t benchmark_demodsoft_apsk32;
+benchmark_function_t benchmark_demodsoft_apsk64;
+benchmark_function_t benchmark_demodsoft_apsk128;
+benchmark_function_t benchmark_demodsoft_apsk256;
+benchmark_function_t benchmark_demodsoft_arbV29;
+benchmark_function_t benchmark_demodsoft_arb16opt;
+benchmark_function_t benchmark_demodsoft_arb32opt;
+benchmark_function_t benchmark_demodsoft_arb64opt;
+benchmark_function_t benchmark_demodsoft_arb128opt;
+benchmark_function_t benchmark_demodsoft_arb256opt;
+benchmark_function_t benchmark_demodsoft_arb64vt;
+// src/multichannel/bench/firpfbch_crcf_benchmark.c
+benchmark_function_t benchmark_firpfbch_crcf_a4;
+benchmark_function_t benchmark_firpfbch_crcf_a16;
+benchmark_function_t benchmark_firpfbch_crcf_a64;
+benchmark_function_t benchmark_firpfbch_crcf_a256;
+benchmark_function_t benchmark_firpfbch_crcf_a512;
+benchmark_function_t benchmark_firpfbch_crcf_a1024;
+// src/multichannel/bench/firpfbch2_crcf_benchmark.c
+benchmark_function_t benchmark_firpfbch2_crcf_a4;
+benchmark_function_t benchmark_firpfbch2_crcf_a16;
+benchmark_function_t benchmark_firpfbch2_crcf_a64;
+benchmark_function_t benchmark_firpfbch2_crcf_a256;
+benchmark_function_t benchmark_firpfbch2_crcf_a512;
+benchmark_function_t benchmark_firpfbch2_crcf_a1024;
+benchmark_function_t benchmark_firpfbch2_crcf_s4;
+benchmark_function_t benchmark_firpfbch2_crcf_s16;
+benchmark_function_t benchmark_firpfbch2_crcf_s64;
+benchmark_function_t benchmark_firpfbch2_crcf_s256;
+benchmark_function_t benchmark_firpfbch2_crcf_s512;
+benchmark_function_t benchmark_firpfbch2_crcf_s1024;
+// src/multichannel/bench/firpfbchr_crcf_benchmark.c
+benchmark_function_t benchmark_firpfbchr_crcf_M0064_P0063;
+benchmark_function_t benchmark_firpfbchr_crcf_M0128_P0127;
+benchmark_function_t benchmark_firpfbchr_crcf_M0256_P0255;
+benchmark_function_t benchmark_firpfbchr_crcf_M0512_P0511;
+benchmark_function_t benchmark_firpfbchr_crcf_M1024_P1023;
+benchmark_function_t benchmark_firpfbchr_crcf_M2048_P2047;
+benchmark_function_t benchmark_firpfbchr_crcf_M4096_P4095;
+// src/multichannel/bench/ofdmframesync_acquire_benchmark.c
+benchmark_function_t benchmark_ofdmframesync_acquire_n64;
+benchmark_function_t benchmark_ofdmframesync_acquire_n128;
+benchmark_function_t benchmark_ofdmframesync_acquire_n256;
+benchmark_function_t benchmark_ofdmframesync_acquire_n512;
+// src/multichannel/bench/ofdmframesync_rxsymbol_benchmark.c
+benchmark_function_t benchmark_ofdmframesync_rxsymbol_n64;
+benchmark_function_t benchmark_ofdmframesync_rxsymbol_n128;
+benchmark_function_t benchmark_ofdmframesync_rxsymbol_n256;
+benchmark_function_t benchmark_ofdmframesync_rxsymbol_n512;
+benchmark_function_t benchmark_ofdmframesync_rxsymbol_n1024;
+benchmark_function_t benchmark_ofdmframesync_rxsymbol_n2048;
+benchmark_function_t benchmark_ofdmframesync_rxsymbol_n4096;
+// src/nco/bench/nco_benchmark.c
+benchmark_function_t benchmark_nco_sincos;
+benchmark_function_t benchmark_nco_mix_up;
+benchmark_function_t benchmark_nco_mix_block_up;
+// src/nco/bench/vco_benchmark.c
+benchmark_function_t benchmark_vco_sincos;
+benchmark_function_t benchmark_vco_mix_up;
+benchmark_function_t benchmark_vco_mix_block_up;
+// src/quantization/bench/quantizer_benchmark.c
+benchmark_function_t benchmark_quantize_adc;
+benchmark_function_t benchmark_quantize_dac;
+// src/quantization/bench/compander_benchmark.c
+benchmark_function_t benchmark_compress_mulaw;
+benchmark_function_t benchmark_expand_mulaw;
+// src/random/bench/random_benchmark.c
+benchmark_function_t benchmark_random_uniform;
+benchmark_function_t benchmark_random_normal;
+benchmark_function_t benchmark_random_complex_normal;
+benchmark_function_t benchmark_random_weibull;
+benchmark_function_t benchmark_random_ricek;
+// src/sequence/bench/bsequence_benchmark.c
+benchmark_function_t benchmark_bsequence_xcorr_n16;
+benchmark_function_t benchmark_bsequence_xcorr_n64;
+benchmark_function_t benchmark_bsequence_xcorr_n256;
+benchmark_function_t benchmark_bsequence_xcorr_n1024;
+// src/utility/bench/byte_utilities_benchmark.c
+benchmark_function_t benchmark_count_ones;
+
+// array of scripts
+benchmark_t scripts[NUM_AUTOSCRIPTS] = {
+    {.id =    0, .api = &benchmark_null,                                .name = "null"},
+    {.id =    1, .api = &benchmark_agc_crcf,                            .name = "agc_crcf"},
+    {.id =    2, .api = &benchmark_cvsd_encode,                         .name = "cvsd_encode"},
+    {.id =    3, .api = &benchmark_cvsd_decode,                         .name = "cvsd_decode"},
+    {.id =    4, .api = &benchmark_cbuffercf_n16,                       .name = "cbuffercf_n16"},
+    {.id =    5, .api = &benchmark_cbuffercf_n32,                       .name = "cbuffercf_n32"},
+    {.id =    6, .api = &benchmark_cbuffercf_n64,                       .name = "cbuffercf_n64"},
+    {.id =    7, .api = &benchmark_cbuffercf_n128,                      .name = "cbuffercf_n128"},
+    {.id =    8, .api = &benchmark_cbuffercf_n256,                      .name = "cbuffercf_n256"},
+    {.id =    9, .api = &benchmark_cbuffercf_n512,                      .name = "cbuffercf_n512"},
+    {.id =   10, .api = &benchmark_cbuffercf_n1024,                     .name = "cbuffercf_n1024"},
+    {.id =   11, .api = &benchmark_windowcf_push_n16,                   .name = "windowcf_push_n16"},
+    {.id =   12, .api = &benchmark_windowcf_push_n32,                   .name = "windowcf_push_n32"},
+    {.id =   13, .api = &benchmark_windowcf_push_n64,                   .name = "windowcf_push_n64"},
+    {.id =   14, .api = &benchmark_windowcf_push_n128,                  .name = "windowcf_push_n128"},
+    {.id =   15, .api = &benchmark_windowcf_push_n256,                  .name = "windowcf_push_n256"},
+    {.id =   16, .api = &benchmark_windowcf_read_n16,                   .name = "windowcf_read_n16"},
+    {.id =   17, .api = &benchmark_windowcf_read_n32,                   .name = "windowcf_read_n32"},
+    {.id =   18, .api = &benchmark_windowcf_read_n64,                   .name = "windowcf_read_n64"},
+    {.id =   19, .api = &benchmark_windowcf_read_n128,                  .name = "windowcf_read_n128"},
+    {.id =   20, .api = &benchmark_windowcf_read_n256,                  .name = "windowcf_read_n256"},
+    {.id =   21, .api = &benchmark_dotprod_cccf_4,                      .name = "dotprod_cccf_4"},
+    {.id =   22, .api = &benchmark_dotprod_cccf_16,                     .name = "dotprod_cccf_16"},
+    {.id =   23, .api = &benchmark_dotprod_cccf_64,                     .name = "dotprod_cccf_64"},
+    {.id =   24, .api = &benchmark_dotprod_cccf_256,                    .name = "dotprod_cccf_256"},
+    {.id =   25, .api = &benchmark_dotprod_crcf_4,                      .name = "dotprod_crcf_4"},
+    {.id =   26, .api = &benchmark_dotprod_crcf_16,                     .name = "dotprod_crcf_16"},
+    {.id =   27, .api = &benchmark_dotprod_crcf_64,                     .name = "dotprod_crcf_64"},
+    {.id =   28, .api = &benchmark_dotprod_crcf_256,                    .name = "dotprod_crcf_256"},
+    {.id =   29, .api = &benchmark_dotprod_rrrf_4,                      .name = "dotprod_rrrf_4"},
+    {.id =   30, .api = &benchmark_dotprod_rrrf_16,                     .name = "dotprod_rrrf_16"},
+    {.id =   31, .api = &benchmark_dotprod_rrrf_64,                     .name = "dotprod_rrrf_64"},
+    {.id =   32, .api = &benchmark_dotprod_rrrf_256,                    .name = "dotprod_rrrf_256"},
+    {.id =   33, .api = &benchmark_sumsqf_4,                            .name = "sumsqf_4"},
+    {.id =   34, .api = &benchmark_sumsqf_16,                           .name = "sumsqf_16"},
+    {.id =   35, .api = &benchmark_sumsqf_64,                           .name = "sumsqf_64"},
+    {.id =   36, .api = &benchmark_sumsqf_256,                          .name = "sumsqf_256"},
+    {.id =   37, .api = &benchmark_sumsqcf_4,                           .name = "sumsqcf_4"},
+    {.id =   38, .api = &benchmark_sumsqcf_16,                          .name = "sumsqcf_16"},
+    {.id =   39, .api = &benchmark_sumsqcf_64,                          .name = "sumsqcf_64"},
+    {.id =   40, .api = &benchmark_sumsqcf_256,                         .name = "sumsqcf_256"},
+    {.id =   41, .api = &benchmark_eqlms_cccf_n4,                       .name = "eqlms_cccf_n4"},
+    {.id =   42, .api = &benchmark_eqlms_cccf_n8,                       .name = "eqlms_cccf_n8"},
+    {.id =   43, .api = &benchmark_eqlms_cccf_n16,                      .name = "eqlms_cccf_n16"},
+    {.id =   44, .api = &benchmark_eqlms_cccf_n32,                      .name = "eqlms_cccf_n32"},
+    {.id =   45, .api = &benchmark_eqlms_cccf_n64,                      .name = "eqlms_cccf_n64"},
+    {.id =   46, .api = &benchmark_eqrls_cccf_n4,                       .name = "eqrls_cccf_n4"},
+    {.id =   47, .api = &benchmark_eqrls_cccf_n8,                       .name = "eqrls_cccf_n8"},
+    {.id =   48, .api = &benchmark_eqrls_cccf_n16,                      .name = "eqrls_cccf_n16"},
+    {.id =   49, .api = &benchmark_eqrls_cccf_n32,                      .name = "eqrls_cccf_n32"},
+    {.id =   50, .api = &benchmark_eqrls_cccf_n64,                      .name = "eqrls_cccf_n64"},
+    {.id =   51, .api = &benchmark_eqrls_cccf_invqr_n16,                .name = "eqrls_cccf_invqr_n16"},
+    {.id =   52, .api = &benchmark_eqrls_cccf_invqr_n64,                .name = "eqrls_cccf_invqr_n64"},
+    {.id =   53, .api = &benchmark_eqrls_cccf_ftf_n16,                  .name = "eqrls_cccf_ftf_n16"},
+    {.id =   54, .api = &benchmark_eqrls_cccf_ftf_n64,                  .name = "eqrls_cccf_ftf_n64"},
+    {.id =   55, .api = &benchmark_eqrls_cccf_ftf_n256,                 .name = "eqrls_cccf_ftf_n256"},
+    {.id =   56, .api = &benchmark_crc_checksum_n256,                   .name = "crc_checksum_n256"},
+    {.id =   57, .api = &benchmark_crc_crc8_n256,                       .name = "crc_crc8_n256"},
+    {.id =   58, .api = &benchmark_crc_crc16_n256,                      .name = "crc_crc16_n256"},
+    {.id =   59, .api = &benchmark_crc_crc24_n256,                      .name = "crc_crc24_n256"},
+    {.id =   60, .api = &benchmark_crc_crc32_n256,                      .name = "crc_crc32_n256"},
+    {.id =   61, .api = &benchmark_fec_enc_none_n64,                    .name = "fec_enc_none_n64"},
+    {.id =   62, .api = &benchmark_fec_enc_rep3_n64,                    .name = "fec_enc_rep3_n64"},
+    {.id =   63, .api = &benchmark_fec_enc_rep5_n64,                    .name = "fec_enc_rep5_n64"},
+    {.id =   64, .api = &benchmark_fec_enc_hamming74_n64,               .name = "fec_enc_hamming74_n64"},
+    {.id =   65, .api = &benchmark_fec_enc_hamming84_n64,               .name = "fec_enc_hamming84_n64"},
+    {.id =   66, .api = &benchmark_fec_enc_hamming128_n64,              .name = "fec_enc_hamming128_n64"},
+    {.id =   67, .api = &benchmark_fec_enc_secded2216_n64,              .name = "fec_enc_secded2216_n64"},
+    {.id =   68, .api = &benchmark_fec_enc_secded3932_n64,              .name = "fec_enc_secded3932_n64"},
+    {.id =   69, .api = &benchmark_fec_enc_secded7264_n64,              .name = "fec_enc_secded7264_n64"},
+    {.id =   70, .api = &benchmark_fec_enc_golay2412_n64,               .name = "fec_enc_golay2412_n64"},
+    {.id =   71, .api = &benchmark_fec_enc_conv27_n64,                  .name = "fec_enc_conv27_n64"},
+    {.id =   72, .api = &benchmark_fec_enc_conv29_n64,                  .name = "fec_enc_conv29_n64"},
+    {.id =   73, .api = &benchmark_fec_enc_conv39_n64,                  .name = "fec_enc_conv39_n64"},
+    {.id =   74, .api = &benchmark_fec_enc_conv615_n64,                 .name = "fec_enc_conv615_n64"},
+    {.id =   75, .api = &benchmark_fec_enc_conv27p23_n64,               .name = "fec_enc_conv27p23_n64"},
+    {.id =   76, .api = &benchmark_fec_enc_conv27p34_n64,               .name = "fec_enc_conv27p34_n64"},
+    {.id =   77, .api = &benchmark_fec_enc_conv27p45_n64,               .name = "fec_enc_conv27p45_n64"},
+    {.id =   78, .api = &benchmark_fec_enc_rs8_n64,                     .name = "fec_enc_rs8_n64"},
+    {.id =   79, .api = &benchmark_fec_enc_rs8_n223,                    .name = "fec_enc_rs8_n223"},
+    {.id =   80, .api = &benchmark_fec_enc_rs8_n1024,                   .name = "fec_enc_rs8_n1024"},
+    {.id =   81, .api = &benchmark_fec_enc_ldpc12_n64,                  .name = "fec_enc_ldpc12_n64"},
+    {.id =   82, .api = &benchmark_fec_enc_ldpc12_n144,                 .name = "fec_enc_ldpc12_n144"},
+    {.id =   83, .api = &benchmark_fec_enc_ldpc34_n216,                 .name = "fec_enc_ldpc34_n216"},
+    {.id =   84, .api = &benchmark_fec_dec_none_n64,                    .name = "fec_dec_none_n64"},
+    {.id =   85, .api = &benchmark_fec_dec_rep3_n64,                    .name = "fec_dec_rep3_n64"},
+    {.id =   86, .api = &benchmark_fec_dec_rep5_n64,                    .name = "fec_dec_rep5_n64"},
+    {.id =   87, .api = &benchmark_fec_dec_hamming74_n64,               .name = "fec_dec_hamming74_n64"},
+    {.id =   88, .api = &benchmark_fec_dec_hamming84_n64,               .name = "fec_dec_hamming84_n64"},
+    {.id =   89, .api = &benchmark_fec_dec_hamming128_n64,              .name = "fec_dec_hamming128_n64"},
+    {.id =   90, .api = &benchmark_fec_dec_secded2216_n64,              .name = "fec_dec_secded2216_n64"},
+    {.id =   91, .api = &benchmark_fec_dec_secded3932_n64,              .name = "fec_dec_secded3932_n64"},
+    {.id =   92, .api = &benchmark_fec_dec_secded7264_n64,              .name = "fec_dec_secded7264_n64"},
+    {.id =   93, .api = &benchmark_fec_dec_golay2412_n64,               .name = "fec_dec_golay2412_n64"},
+    {.id =   94, .api = &benchmark_fec_dec_conv27_n64,                  .name = "fec_dec_conv27_n64"},
+    {.id =   95, .api = &benchmark_fec_dec_conv29_n64,                  .name = "fec_dec_conv29_n64"},
+    {.id =   96, .api = &benchmark_fec_dec_conv39_n64,                  .name = "fec_dec_conv39_n64"},
+    {.id =   97, .api = &benchmark_fec_dec_conv615_n64,                 .name = "fec_dec_conv615_n64"},
+    {.id =   98, .api = &benchmark_fec_dec_conv27p23_n64,               .name = "fec_dec_conv27p23_n64"},
+    {.id =   99, .api = &benchmark_fec_dec_conv27p34_n64,               .name = "fec_dec_conv27p34_n64"},
+    {.id =  100, .api = &benchmark_fec_dec_conv27p45_n64,               .name = "fec_dec_conv27p45_n64"},
+    {.id =  101, .api = &benchmark_fec_dec_conv27p56_n64,               .name = "fec_dec_conv27p56_n64"},
+    {.id =  102, .api = &benchmark_fec_dec_conv27p67_n64,               .name = "fec_dec_conv27p67_n64"},
+    {.id =  103, .api = &benchmark_fec_dec_conv27p78_n64,               .name = "fec_dec_conv27p78_n64"},
+    {.id =  104, .api = &benchmark_fec_dec_conv29p23_n64,               .name = "fec_dec_conv29p23_n64"},
+    {.id =  105, .api = &benchmark_fec_dec_conv29p34_n64,               .name = "fec_dec_conv29p34_n64"},
+    {.id =  106, .api = &benchmark_fec_dec_conv29p45_n64,               .name = "fec_dec_conv29p45_n64"},
+    {.id =  107, .api = &benchmark_fec_dec_conv29p56_n64,               .name = "fec_dec_conv29p56_n64"},
+    {.id =  108, .api = &benchmark_fec_dec_conv29p67_n64,               .name = "fec_dec_conv29p67_n64"},
+    {.id =  109, .api = &benchmark_fec_dec_conv29p78_n64,               .name = "fec_dec_conv29p78_n64"},
+    {.id =  110, .api = &benchmark_fec_dec_rs8_n64,                     .name = "fec_dec_rs8_n64"},
+    {.id =  111, .api = &benchmark_fec_dec_rs8_n223,                    .name = "fec_dec_rs8_n223"},
+    {.id =  112, .api = &benchmark_fec_dec_rs8_n1024,                   .name = "fec_dec_rs8_n1024"},
+    {.id =  113, .api = &benchmark_fec_dec_ldpc12_n64,                  .name = "fec_dec_ldpc12_n64"},
+    {.id =  114, .api = &benchmark_fec_dec_ldpc12_n144,                 .name = "fec_dec_ldpc12_n144"},
+    {.id =  115, .api = &benchmark_fecsoft_dec_none_n64,                .name = "fecsoft_dec_none_n64"},
+    {.id =  116, .api = &benchmark_fecsoft_dec_rep3_n64,                .name = "fecsoft_dec_rep3_n64"},
+    {.id =  117, .api = &benchmark_fecsoft_dec_rep5_n64,                .name = "fecsoft_dec_rep5_n64"},
+    {.id =  118, .api = &benchmark_fecsoft_dec_hamming74_n64,           .name = "fecsoft_dec_hamming74_n64"},
+    {.id =  119, .api = &benchmark_fecsoft_dec_hamming84_n64,           .name = "fecsoft_dec_hamming84_n64"},
+    {.id =  120, .api = &benchmark_fecsoft_dec_hamming128_n64,          .name = "fecsoft_dec_hamming128_n64"},
+    {.id =  121, .api = &benchmark_fecsoft_dec_conv27_n64,              .name = "fecsoft_dec_conv27_n64"},
+    {.id =  122, .api = &benchmark_fecsoft_dec_conv29_n64,              .name = "fecsoft_dec_conv29_n64"},
+    {.id =  123, .api = &benchmark_fecsoft_dec_conv39_n64,              .name = "fecsoft_dec_conv39_n64"},
+    {.id =  124, .api = &benchmark_fecsoft_dec_conv615_n64,             .name = "fecsoft_dec_conv615_n64"},
+    {.id =  125, .api = &benchmark_fecsoft_dec_conv27p23_n64,           .name = "fecsoft_dec_conv27p23_n64"},
+    {.id =  126, .api = &benchmark_fecsoft_dec_conv27p34_n64,           .name = "fecsoft_dec_conv27p34_n64"},
+    {.id =  127, .api = &benchmark_fecsoft_dec_conv27p45_n64,           .name = "fecsoft_dec_conv27p45_n64"},
+    {.id =  128, .api = &benchmark_fecsoft_dec_conv27p56_n64,           .name = "fecsoft_dec_conv27p56_n64"},
+    {.id =  129, .api = &benchmark_fecsoft_dec_conv27p67_n64,           .name = "fecsoft_dec_conv27p67_n64"},
+    {.id =  130, .api = &benchmark_fecsoft_dec_conv27p78_n64,           .name = "fecsoft_dec_conv27p78_n64"},
+    {.id =  131, .api = &benchmark_fecsoft_dec_conv29p23_n64,           .name = "fecsoft_dec_conv29p23_n64"},
+    {.id =  132, .api = &benchmark_fecsoft_dec_conv29p34_n64,           .name = "fecsoft_dec_conv29p34_n64"},
+    {.id =  133, .api = &benchmark_fecsoft_dec_conv29p45_n64,           .name = "fecsoft_dec_conv29p45_n64"},
+    {.id =  134, .api = &benchmark_fecsoft_dec_conv29p56_n64,           .name = "fecsoft_dec_conv29p56_n64"},
+    {.id =  135, .api = &benchmark_fecsoft_dec_conv29p67_n64,           .name = "fecsoft_dec_conv29p67_n64"},
+    {.id =  136, .api = &benchmark_fecsoft_dec_conv29p78_n64,           .name = "fecsoft_dec_conv29p78_n64"},
+    {.id =  137, .api = &benchmark_fecsoft_dec_rs8_n64,                 .name = "fecsoft_dec_rs8_n64"},
+    {.id =  138, .api = &benchmark_fecsoft_dec_ldpc12_n64,              .name = "fecsoft_dec_ldpc12_n64"},
+    {.id =  139, .api = &benchmark_fecsoft_dec_ldpc12_n144,             .name = "fecsoft_dec_ldpc12_n144"},
+    {.id =  140, .api = &benchmark_fecsoft_dec_ldpc34_n216,             .name = "fecsoft_dec_ldpc34_n216"},
+    {.id =  141, .api = &benchmark_sumproduct_m16,                      .name = "sumproduct_m16"},
+    {.id =  142, .api = &benchmark_sumproduct_m32,                      .name = "sumproduct_m32"},
+    {.id =  143, .api = &benchmark_sumproduct_m64,                      .name = "sumproduct_m64"},
+    {.id =  144, .api = &benchmark_sumproduct_m128,                     .name = "sumproduct_m128"},
+    {.id =  145, .api = &benchmark_interleaver_8,                       .name = "interleaver_8"},
+    {.id =  146, .api = &benchmark_interleaver_16,                      .name = "interleaver_16"},
+    {.id =  147, .api = &benchmark_interleaver_32,                      .name = "interleaver_32"},
+    {.id =  148, .api = &benchmark_interleaver_64,                      .name = "interleaver_64"},
+    {.id =  149, .api = &benchmark_interleaver_128,                     .name = "interleaver_128"},
+    {.id =  150, .api = &benchmark_interleaver_256,                     .name = "interleaver_256"},
+    {.id =  151, .api = &benchmark_interleaver_512,                     .name = "interleaver_512"},
+    {.id =  152, .api = &benchmark_interleaver_1024,                    .name = "interleaver_1024"},
+    {.id =  153, .api = &benchmark_interleaver_soft_64,                 .name = "interleaver_soft_64"},
+    {.id =  154, .api = &benchmark_interleaver_soft_256,                .name = "interleaver_soft_256"},
+    {.id =  155, .api = &benchmark_interleaver_soft_1024,               .name = "interleaver_soft_1024"},
+    {.id =  156, .api = &benchmark_packetizer_n16,                      .name = "packetizer_n16"},
+    {.id =  157, .api = &benchmark_packetizer_n32,                      .name = "packetizer_n32"},
+    {.id =  158, .api = &benchmark_packetizer_n64,                      .name = "packetizer_n64"},
+    {.id =  159, .api = &benchmark_packetizer_n128,                     .name = "packetizer_n128"},
+    {.id =  160, .api = &benchmark_packetizer_n256,                     .name = "packetizer_n256"},
+    {.id =  161, .api = &benchmark_packetizer_n512,                     .name = "packetizer_n512"},
+    {.id =  162, .api = &benchmark_packetizer_n1024,                    .name = "packetizer_n1024"},
+    {.id =  163, .api = &benchmark_packetizer_n256_crc32_h74,           .name = "packetizer_n256_crc32_h74"},
+    {.id =  164, .api = &benchmark_packetizer_n256_crc32_g2412,         .name = "packetizer_n256_crc32_g2412"},
+    {.id =  165, .api = &benchmark_fft_6,                               .name = "fft_6"},
+    {.id =  166, .api = &benchmark_fft_9,                               .name = "fft_9"},
+    {.id =  167, .api = &benchmark_fft_10,                              .name = "fft_10"},
+    {.id =  168, .api = &benchmark_fft_12,                              .name = "fft_12"},
+    {.id =  169, .api = &benchmark_fft_14,                              .name = "fft_14"},
+    {.id =  170, .api = &benchmark_fft_15,                              .name = "fft_15"},
+    {.id =  171, .api = &benchmark_fft_18,                              .name = "fft_18"},
+    {.id =  172, .api = &benchmark_fft_20,                              .name = "fft_20"},
+    {.id =  173, .api = &benchmark_fft_21,                              .name = "fft_21"},
+    {.id =  174, .api = &benchmark_fft_22,                              .name = "fft_22"},
+    {.id =  175, .api = &benchmark_fft_24,                              .name = "fft_24"},
+    {.id =  176, .api = &benchmark_fft_25,                              .name = "fft_25"},
+    {.id =  177, .api = &benchmark_fft_26,                              .name = "fft_26"},
+    {.id =  178, .api = &benchmark_fft_27,                              .name = "fft_27"},
+    {.id =  179, .api = &benchmark_fft_28,                              .name = "fft_28"},
+    {.id =  180, .api = &benchmark_fft_30,                              .name = "fft_30"},
+    {.id =  181, .api = &benchmark_fft_33,                              .name = "fft_33"},
+    {.id =  182, .api = &benchmark_fft_34,                              .name = "fft_34"},
+    {.id =  183, .api = &benchmark_fft_35,                              .name = "fft_35"},
+    {.id =  184, .api = &benchmark_fft_36,                              .name = "fft_36"},
+    {.id =  185, .api = &benchmark_fft_38,                              .name = "fft_38"},
+    {.id =  186, .api = &benchmark_fft_39,                              .name = "fft_39"},
+    {.id =  187, .api = &benchmark_fft_40,                              .name = "fft_40"},
+    {.id =  188, .api = &benchmark_fft_42,                              .name = "fft_42"},
+    {.id =  189, .api = &benchmark_fft_44,                              .name = "fft_44"},
+    {.id =  190, .api = &benchmark_fft_45,                              .name = "fft_45"},
+    {.id =  191, .api = &benchmark_fft_46,                              .name = "fft_46"},
+    {.id =  192, .api = &benchmark_fft_48,                              .name = "fft_48"},
+    {.id =  193, .api = &benchmark_fft_49,                              .name = "fft_49"},
+    {.id =  194, .api = &benchmark_fft_50,                              .name = "fft_50"},
+    {.id =  195, .api = &benchmark_fft_51,                              .name = "fft_51"},
+    {.id =  196, .api = &benchmark_fft_52,                              .name = "fft_52"},
+    {.id =  197, .api = &benchmark_fft_54,                              .name = "fft_54"},
+    {.id =  198, .api = &benchmark_fft_55,                              .name = "fft_55"},
+    {.id =  199, .api = &benchmark_fft_56,                              .name = "fft_56"},
+    {.id =  200, .api = &benchmark_fft_57,                              .name = "fft_57"},
+    {.id =  201, .api = &benchmark_fft_58,                              .name = "fft_58"},
+    {.id =  202, .api = &benchmark_fft_60,                              .name = "fft_60"},
+    {.id =  203, .api = &benchmark_fft_62,                              .name = "fft_62"},
+    {.id =  204, .api = &benchmark_fft_63,                              .name = "fft_63"},
+    {.id =  205, .api = &benchmark_fft_65,                              .name = "fft_65"},
+    {.id =  206, .api = &benchmark_fft_66,                              .name = "fft_66"},
+    {.id =  207, .api = &benchmark_fft_68,                              .name = "fft_68"},
+    {.id =  208, .api = &benchmark_fft_69,                              .name = "fft_69"},
+    {.id =  209, .api = &benchmark_fft_70,                              .name = "fft_70"},
+    {.id =  210, .api = &benchmark_fft_72,                              .name = "fft_72"},
+    {.id =  211, .api = &benchmark_fft_74,                              .name = "fft_74"},
+    {.id =  212, .api = &benchmark_fft_75,                              .name = "fft_75"},
+    {.id =  213, .api = &benchmark_fft_76,                              .name = "fft_76"},
+    {.id =  214, .api = &benchmark_fft_77,                              .name = "fft_77"},
+    {.id =  215, .api = &benchmark_fft_78,                              .name = "fft_78"},
+    {.id =  216, .api = &benchmark_fft_80,                              .name = "fft_80"},
+    {.id =  217, .api = &benchmark_fft_81,                              .name = "fft_81"},
+    {.id =  218, .api = &benchmark_fft_82,                              .name = "fft_82"},
+    {.id =  219, .api = &benchmark_fft_84,                              .name = "fft_84"},
+    {.id =  220, .api = &benchmark_fft_85,                              .name = "fft_85"},
+    {.id =  221, .api = &benchmark_fft_86,                              .name = "fft_86"},
+    {.id =  222, .api = &benchmark_fft_87,                              .name = "fft_87"},
+    {.id =  223, .api = &benchmark_fft_88,                              .name = "fft_88"},
+    {.id =  224, .api = &benchmark_fft_90,                              .name = "fft_90"},
+    {.id =  225, .api = &benchmark_fft_91,                              .name = "fft_91"},
+    {.id =  226, .api = &benchmark_fft_92,                              .name = "fft_92"},
+    {.id =  227, .api = &benchmark_fft_93,                              .name = "fft_93"},
+    {.id =  228, .api = &benchmark_fft_94,                              .name = "fft_94"},
+    {.id =  229, .api = &benchmark_fft_95,                              .name = "fft_95"},
+    {.id =  230, .api = &benchmark_fft_96,                              .name = "fft_96"},
+    {.id =  231, .api = &benchmark_fft_98,                              .name = "fft_98"},
+    {.id =  232, .api = &benchmark_fft_99,                              .name = "fft_99"},
+    {.id =  233, .api = &benchmark_fft_100,                             .name = "fft_100"},
+    {.id =  234, .api = &benchmark_fft_102,                             .name = "fft_102"},
+    {.id =  235, .api = &benchmark_fft_104,                             .name = "fft_104"},
+    {.id =  236, .api = &benchmark_fft_105,                             .name = "fft_105"},
+    {.id =  237, .api = &benchmark_fft_106,                             .name = "fft_106"},
+    {.id =  238, .api = &benchmark_fft_108,                             .name = "fft_108"},
+    {.id =  239, .api = &benchmark_fft_110,                             .name = "fft_110"},
+    {.id =  240, .api = &benchmark_fft_111,                             .name = "fft_111"},
+    {.id =  241, .api = &benchmark_fft_112,                             .name = "fft_112"},
+    {.id =  242, .api = &benchmark_fft_114,                             .name = "fft_114"},
+    {.id =  243, .api = &benchmark_fft_115,                             .name = "fft_115"},
+    {.id =  244, .api = &benchmark_fft_116,                             .name = "fft_116"},
+    {.id =  245, .api = &benchmark_fft_117,                             .name = "fft_117"},
+    {.id =  246, .api = &benchmark_fft_118,                             .name = "fft_118"},
+    {.id =  247, .api = &benchmark_fft_119,                             .name = "fft_119"},
+    {.id =  248, .api = &benchmark_fft_120,                             .name = "fft_120"},
+    {.id =  249, .api = &benchmark_fft_121,                             .name = "fft_121"},
+    {.id =  250, .api = &benchmark_fft_122,                             .name = "fft_122"},
+    {.id =  251, .api = &benchmark_fft_123,                             .name = "fft_123"},
+    {.id =  252, .api = &benchmark_fft_124,                             .name = "fft_124"},
+    {.id =  253, .api = &benchmark_fft_125,                             .name = "fft_125"},
+    {.id =  254, .api = &benchmark_fft_126,                             .name = "fft_126"},
+    {.id =  255, .api = &benchmark_fft_129,                             .name = "fft_129"},
+    {.id =  256, .api = &benchmark_fft_130,                             .name = "fft_130"},
+    {.id =  257, .api = &benchmark_fft_132,                             .name = "fft_132"},
+    {.id =  258, .api = &benchmark_fft_133,                             .name = "fft_133"},
+    {.id =  259, .api = &benchmark_fft_134,                             .name = "fft_134"},
+    {.id =  260, .api = &benchmark_fft_135,                             .name = "fft_135"},
+    {.id =  261, .api = &benchmark_fft_136,                             .name = "fft_136"},
+    {.id =  262, .api = &benchmark_fft_138,                             .name = "fft_138"},
+    {.id =  263, .api = &benchmark_fft_140,                             .name = "fft_140"},
+    {.id =  264, .api = &benchmark_fft_141,                             .name = "fft_141"},
+    {.id =  265, .api = &benchmark_fft_142,                             .name = "fft_142"},
+    {.id =  266, .api = &benchmark_fft_143,                             .name = "fft_143"},
+    {.id =  267, .api = &benchmark_fft_144,                             .name = "fft_144"},
+    {.id =  268, .api = &benchmark_fft_145,                             .name = "fft_145"},
+    {.id =  269, .api = &benchmark_fft_146,                             .name = "fft_146"},
+    {.id =  270, .api = &benchmark_fft_147,                             .name = "fft_147"},
+    {.id =  271, .api = &benchmark_fft_148,                             .name = "fft_148"},
+    {.id =  272, .api = &benchmark_fft_150,                             .name = "fft_150"},
+    {.id =  273, .api = &benchmark_fft_152,                             .name = "fft_152"},
+    {.id =  274, .api = &benchmark_fft_153,                             .name = "fft_153"},
+    {.id =  275, .api = &benchmark_fft_154,                             .name = "fft_154"},
+    {.id =  276, .api = &benchmark_fft_155,                             .name = "fft_155"},
+    {.id =  277, .api = &benchmark_fft_156,                             .name = "fft_156"},
+    {.id =  278, .api = &benchmark_fft_158,                             .name = "fft_158"},
+    {.id =  279, .api = &benchmark_fft_159,                             .name = "fft_159"},
+    {.id =  280, .api = &benchmark_fft_160,                             .name = "fft_160"},
+    {.id =  281, .api = &benchmark_fft_161,                             .name = "fft_161"},
+    {.id =  282, .api = &benchmark_fft_162,                             .name = "fft_162"},
+    {.id =  283, .api = &benchmark_fft_164,                             .name = "fft_164"},
+    {.id =  284, .api = &benchmark_fft_165,                             .name = "fft_165"},
+    {.id =  285, .api = &benchmark_fft_166,                             .name = "fft_166"},
+    {.id =  286, .api = &benchmark_fft_168,                             .name = "fft_168"},
+    {.id =  287, .api = &benchmark_fft_169,                             .name = "fft_169"},
+    {.id =  288, .api = &benchmark_fft_170,                             .name = "fft_170"},
+    {.id =  289, .api = &benchmark_fft_171,                             .name = "fft_171"},
+    {.id =  290, .api = &benchmark_fft_172,                             .name = "fft_172"},
+    {.id =  291, .api = &benchmark_fft_174,                             .name = "fft_174"},
+    {.id =  292, .api = &benchmark_fft_175,                             .name = "fft_175"},
+    {.id =  293, .api = &benchmark_fft_176,                             .name = "fft_176"},
+    {.id =  294, .api = &benchmark_fft_177,                             .name = "fft_177"},
+    {.id =  295, .api = &benchmark_fft_178,                             .name = "fft_178"},
+    {.id =  296, .api = &benchmark_fft_180,                             .name = "fft_180"},
+    {.id =  297, .api = &benchmark_fft_182,                             .name = "fft_182"},
+    {.id =  298, .api = &benchmark_fft_183,                             .name = "fft_183"},
+    {.id =  299, .api = &benchmark_fft_184,                             .name = "fft_184"},
+    {.id =  300, .api = &benchmark_fft_185,                             .name = "fft_185"},
+    {.id =  301, .api = &benchmark_fft_186,                             .name = "fft_186"},
+    {.id =  302, .api = &benchmark_fft_187,                             .name = "fft_187"},
+    {.id =  303, .api = &benchmark_fft_188,                             .name = "fft_188"},
+    {.id =  304, .api = &benchmark_fft_189,                             .name = "fft_189"},
+    {.id =  305, .api = &benchmark_fft_190,                             .name = "fft_190"},
+    {.id =  306, .api = &benchmark_fft_192,                             .name = "fft_192"},
+    {.id =  307, .api = &benchmark_fft_194,                             .name = "fft_194"},
+    {.id =  308, .api = &benchmark_fft_195,                             .name = "fft_195"},
+    {.id =  309, .api = &benchmark_fft_196,                             .name = "fft_196"},
+    {.id =  310, .api = &benchmark_fft_198,                             .name = "fft_198"},
+    {.id =  311, .api = &benchmark_fft_200,                             .name = "fft_200"},
+    {.id =  312, .api = &benchmark_fft_201,                             .name = "fft_201"},
+    {.id =  313, .api = &benchmark_fft_202,                             .name = "fft_202"},
+    {.id =  314, .api = &benchmark_fft_203,                             .name = "fft_203"},
+    {.id =  315, .api = &benchmark_fft_204,                             .name = "fft_204"},
+    {.id =  316, .api = &benchmark_fft_205,                             .name = "fft_205"},
+    {.id =  317, .api = &benchmark_fft_206,                             .name = "fft_206"},
+    {.id =  318, .api = &benchmark_fft_207,                             .name = "fft_207"},
+    {.id =  319, .api = &benchmark_fft_208,                             .name = "fft_208"},
+    {.id =  320, .api = &benchmark_fft_209,                             .name = "fft_209"},
+    {.id =  321, .api = &benchmark_fft_210,                             .name = "fft_210"},
+    {.id =  322, .api = &benchmark_fft_212,                             .name = "fft_212"},
+    {.id =  323, .api = &benchmark_fft_213,                             .name = "fft_213"},
+    {.id =  324, .api = &benchmark_fft_214,                             .name = "fft_214"},
+    {.id =  325, .api = &benchmark_fft_215,                             .name = "fft_215"},
+    {.id =  326, .api = &benchmark_fft_216,                             .name = "fft_216"},
+    {.id =  327, .api = &benchmark_fft_217,                             .name = "fft_217"},
+    {.id =  328, .api = &benchmark_fft_218,                             .name = "fft_218"},
+    {.id =  329, .api = &benchmark_fft_219,                             .name = "fft_219"},
+    {.id =  330, .api = &benchmark_fft_220,                             .name = "fft_220"},
+    {.id =  331, .api = &benchmark_fft_221,                             .name = "fft_221"},
+    {.id =  332, .api = &benchmark_fft_222,                             .name = "fft_222"},
+    {.id =  333, .api = &benchmark_fft_224,                             .name = "fft_224"},
+    {.id =  334, .api = &benchmark_fft_225,                             .name = "fft_225"},
+    {.id =  335, .api = &benchmark_fft_226,                             .name = "fft_226"},
+    {.id =  336, .api = &benchmark_fft_228,                             .name = "fft_228"},
+    {.id =  337, .api = &benchmark_fft_230,                             .name = "fft_230"},
+    {.id =  338, .api = &benchmark_fft_231,                             .name = "fft_231"},
+    {.id =  339, .api = &benchmark_fft_232,                             .name = "fft_232"},
+    {.id =  340, .api = &benchmark_fft_234,                             .name = "fft_234"},
+    {.id =  341, .api = &benchmark_fft_235,                             .name = "fft_235"},
+    {.id =  342, .api = &benchmark_fft_236,                             .name = "fft_236"},
+    {.id =  343, .api = &benchmark_fft_237,                             .name = "fft_237"},
+    {.id =  344, .api = &benchmark_fft_238,                             .name = "fft_238"},
+    {.id =  345, .api = &benchmark_fft_240,                             .name = "fft_240"},
+    {.id =  346, .api = &benchmark_fft_242,                             .name = "fft_242"},
+    {.id =  347, .api = &benchmark_fft_243,                             .name = "fft_243"},
+    {.id =  348, .api = &benchmark_fft_244,                             .name = "fft_244"},
+    {.id =  349, .api = &benchmark_fft_245,                             .name = "fft_245"},
+    {.id =  350, .api = &benchmark_fft_246,                             .name = "fft_246"},
+    {.id =  351, .api = &benchmark_fft_247,                             .name = "fft_247"},
+    {.id =  352, .api = &benchmark_fft_248,                             .name = "fft_248"},
+    {.id =  353, .api = &benchmark_fft_249,                             .name = "fft_249"},
+    {.id =  354, .api = &benchmark_fft_250,                             .name = "fft_250"},
+    {.id =  355, .api = &benchmark_fft_252,                             .name = "fft_252"},
+    {.id =  356, .api = &benchmark_fft_253,                             .name = "fft_253"},
+    {.id =  357, .api = &benchmark_fft_254,                             .name = "fft_254"},
+    {.id =  358, .api = &benchmark_fft_255,                             .name = "fft_255"},
+    {.id =  359, .api = &benchmark_fft_3,                               .name = "fft_3"},
+    {.id =  360, .api = &benchmark_fft_5,                               .name = "fft_5"},
+    {.id =  361, .api = &benchmark_fft_7,                               .name = "fft_7"},
+    {.id =  362, .api = &benchmark_fft_11,                              .name = "fft_11"},
+    {.id =  363, .api = &benchmark_fft_13,                              .name = "fft_13"},
+    {.id =  364, .api = &benchmark_fft_17,                              .name = "fft_17"},
+    {.id =  365, .api = &benchmark_fft_19,                              .name = "fft_19"},
+    {.id =  366, .api = &benchmark_fft_23,                              .name = "fft_23"},
+    {.id =  367, .api = &benchmark_fft_29,                              .name = "fft_29"},
+    {.id =  368, .api = &benchmark_fft_31,                              .name = "fft_31"},
+    {.id =  369, .api = &benchmark_fft_37,                              .name = "fft_37"},
+    {.id =  370, .api = &benchmark_fft_41,                              .name = "fft_41"},
+    {.id =  371, .api = &benchmark_fft_43,                              .name = "fft_43"},
+    {.id =  372, .api = &benchmark_fft_47,                              .name = "fft_47"},
+    {.id =  373, .api = &benchmark_fft_53,                              .name = "fft_53"},
+    {.id =  374, .api = &benchmark_fft_59,                              .name = "fft_59"},
+    {.id =  375, .api = &benchmark_fft_61,                              .name = "fft_61"},
+    {.id =  376, .api = &benchmark_fft_67,                              .name = "fft_67"},
+    {.id =  377, .api = &benchmark_fft_71,                              .name = "fft_71"},
+    {.id =  378, .api = &benchmark_fft_73,                              .name = "fft_73"},
+    {.id =  379, .api = &benchmark_fft_79,                              .name = "fft_79"},
+    {.id =  380, .api = &benchmark_fft_83,                              .name = "fft_83"},
+    {.id =  381, .api = &benchmark_fft_89,                              .name = "fft_89"},
+    {.id =  382, .api = &benchmark_fft_97,                              .name = "fft_97"},
+    {.id =  383, .api = &benchmark_fft_101,                             .name = "fft_101"},
+    {.id =  384, .api = &benchmark_fft_103,                             .name = "fft_103"},
+    {.id =  385, .api = &benchmark_fft_107,                             .name = "fft_107"},
+    {.id =  386, .api = &benchmark_fft_109,                             .name = "fft_109"},
+    {.id =  387, .api = &benchmark_fft_113,                             .name = "fft_113"},
+    {.id =  388, .api = &benchmark_fft_127,                             .name = "fft_127"},
+    {.id =  389, .api = &benchmark_fft_131,                             .name = "fft_131"},
+    {.id =  390, .api = &benchmark_fft_137,                             .name = "fft_137"},
+    {.id =  391, .api = &benchmark_fft_139,                             .name = "fft_139"},
+    {.id =  392, .api = &benchmark_fft_149,                             .name = "fft_149"},
+    {.id =  393, .api = &benchmark_fft_151,                             .name = "fft_151"},
+    {.id =  394, .api = &benchmark_fft_157,                             .name = "fft_157"},
+    {.id =  395, .api = &benchmark_fft_163,                             .name = "fft_163"},
+    {.id =  396, .api = &benchmark_fft_167,                             .name = "fft_167"},
+    {.id =  397, .api = &benchmark_fft_173,                             .name = "fft_173"},
+    {.id =  398, .api = &benchmark_fft_179,                             .name = "fft_179"},
+    {.id =  399, .api = &benchmark_fft_181,                             .name = "fft_181"},
+    {.id =  400, .api = &benchmark_fft_191,                             .name = "fft_191"},
+    {.id =  401, .api = &benchmark_fft_193,                             .name = "fft_193"},
+    {.id =  402, .api = &benchmark_fft_197,                             .name = "fft_197"},
+    {.id =  403, .api = &benchmark_fft_199,                             .name = "fft_199"},
+    {.id =  404, .api = &benchmark_fft_211,                             .name = "fft_211"},
+    {.id =  405, .api = &benchmark_fft_223,                             .name = "fft_223"},
+    {.id =  406, .api = &benchmark_fft_227,                             .name = "fft_227"},
+    {.id =  407, .api = &benchmark_fft_229,                             .name = "fft_229"},
+    {.id =  408, .api = &benchmark_fft_233,                             .name = "fft_233"},
+    {.id =  409, .api = &benchmark_fft_239,                             .name = "fft_239"},
+    {.id =  410, .api = &benchmark_fft_241,                             .name = "fft_241"},
+    {.id =  411, .api = &benchmark_fft_251,                             .name = "fft_251"},
+    {.id =  412, .api = &benchmark_fft_257,                             .name = "fft_257"},
+    {.id =  413, .api = &benchmark_fft_263,                             .name = "fft_263"},
+    {.id =  414, .api = &benchmark_fft_269,                             .name = "fft_269"},
+    {.id =  415, .api = &benchmark_fft_271,                             .name = "fft_271"},
+    {.id =  416, .api = &benchmark_fft_277,                             .name = "fft_277"},
+    {.id =  417, .api = &benchmark_fft_281,                             .name = "fft_281"},
+    {.id =  418, .api = &benchmark_fft_283,                             .name = "fft_283"},
+    {.id =  419, .api = &benchmark_fft_293,                             .name = "fft_293"},
+    {.id =  420, .api = &benchmark_fft_307,                             .name = "fft_307"},
+    {.id =  421, .api = &benchmark_fft_311,                             .name = "fft_311"},
+    {.id =  422, .api = &benchmark_fft_313,                             .name = "fft_313"},
+    {.id =  423, .api = &benchmark_fft_317,                             .name = "fft_317"},
+    {.id =  424, .api = &benchmark_fft_331,                             .name = "fft_331"},
+    {.id =  425, .api = &benchmark_fft_337,                             .name = "fft_337"},
+    {.id =  426, .api = &benchmark_fft_347,                             .name = "fft_347"},
+    {.id =  427, .api = &benchmark_fft_349,                             .name = "fft_349"},
+    {.id =  428, .api = &benchmark_fft_353,                             .name = "fft_353"},
+    {.id =  429, .api = &benchmark_fft_359,                             .name = "fft_359"},
+    {.id =  430, .api = &benchmark_fft_367,                             .name = "fft_367"},
+    {.id =  431, .api = &benchmark_fft_373,                             .name = "fft_373"},
+    {.id =  432, .api = &benchmark_fft_379,                             .name = "fft_379"},
+    {.id =  433, .api = &benchmark_fft_383,                             .name = "fft_383"},
+    {.id =  434, .api = &benchmark_fft_389,                             .name = "fft_389"},
+    {.id =  435, .api = &benchmark_fft_397,                             .name = "fft_397"},
+    {.id =  436, .api = &benchmark_fft_401,                             .name = "fft_401"},
+    {.id =  437, .api = &benchmark_fft_409,                             .name = "fft_409"},
+    {.id =  438, .api = &benchmark_fft_419,                             .name = "fft_419"},
+    {.id =  439, .api = &benchmark_fft_421,                             .name = "fft_421"},
+    {.id =  440, .api = &benchmark_fft_431,                             .name = "fft_431"},
+    {.id =  441, .api = &benchmark_fft_433,                             .name = "fft_433"},
+    {.id =  442, .api = &benchmark_fft_439,                             .name = "fft_439"},
+    {.id =  443, .api = &benchmark_fft_443,                             .name = "fft_443"},
+    {.id =  444, .api = &benchmark_fft_449,                             .name = "fft_449"},
+    {.id =  445, .api = &benchmark_fft_457,                             .name = "fft_457"},
+    {.id =  446, .api = &benchmark_fft_461,                             .name = "fft_461"},
+    {.id =  447, .api = &benchmark_fft_463,                             .name = "fft_463"},
+    {.id =  448, .api = &benchmark_fft_467,                             .name = "fft_467"},
+    {.id =  449, .api = &benchmark_fft_479,                             .name = "fft_479"},
+    {.id =  450, .api = &benchmark_fft_487,                             .name = "fft_487"},
+    {.id =  451, .api = &benchmark_fft_491,                             .name = "fft_491"},
+    {.id =  452, .api = &benchmark_fft_499,                             .name = "fft_499"},
+    {.id =  453, .api = &benchmark_fft_503,                             .name = "fft_503"},
+    {.id =  454, .api = &benchmark_fft_509,                             .name = "fft_509"},
+    {.id =  455, .api = &benchmark_fft_2,                               .name = "fft_2"},
+    {.id =  456, .api = &benchmark_fft_4,                               .name = "fft_4"},
+    {.id =  457, .api = &benchmark_fft_8,                               .name = "fft_8"},
+    {.id =  458, .api = &benchmark_fft_16,                              .name = "fft_16"},
+    {.id =  459, .api = &benchmark_fft_32,                              .name = "fft_32"},
+    {.id =  460, .api = &benchmark_fft_64,                              .name = "fft_64"},
+    {.id =  461, .api = &benchmark_fft_128,                             .name = "fft_128"},
+    {.id =  462, .api = &benchmark_fft_256,                             .name = "fft_256"},
+    {.id =  463, .api = &benchmark_fft_512,                             .name = "fft_512"},
+    {.id =  464, .api = &benchmark_fft_1024,                            .name = "fft_1024"},
+    {.id =  465, .api = &benchmark_fft_2048,                            .name = "fft_2048"},
+    {.id =  466, .api = &benchmark_fft_4096,                            .name = "fft_4096"},
+    {.id =  467, .api = &benchmark_fft_8192,                            .name = "fft_8192"},
+    {.id =  468, .api = &benchmark_fft_16384,                           .name = "fft_16384"},
+    {.id =  469, .api = &benchmark_fft_32768,                           .name = "fft_32768"},
+    {.id =  470, .api = &benchmark_fft_REDFT00_128,                     .name = "fft_REDFT00_128"},
+    {.id =  471, .api = &benchmark_fft_REDFT01_128,                     .name = "fft_REDFT01_128"},
+    {.id =  472, .api = &benchmark_fft_REDFT10_128,                     .name = "fft_REDFT10_128"},
+    {.id =  473, .api = &benchmark_fft_REDFT11_128,                     .name = "fft_REDFT11_128"},
+    {.id =  474, .api = &benchmark_fft_RODFT00_128,                     .name = "fft_RODFT00_128"},
+    {.id =  475, .api = &benchmark_fft_RODFT01_128,                     .name = "fft_RODFT01_128"},
+    {.id =  476, .api = &benchmark_fft_RODFT10_128,                     .name = "fft_RODFT10_128"},
+    {.id =  477, .api = &benchmark_fft_RODFT11_128,                     .name = "fft_RODFT11_128"},
+    {.id =  478, .api = &benchmark_fft_REDFT00_127,                     .name = "fft_REDFT00_127"},
+    {.id =  479, .api = &benchmark_fft_REDFT01_127,                     .name = "fft_REDFT01_127"},
+    {.id =  480, .api = &benchmark_fft_REDFT10_127,                     .name = "fft_REDFT10_127"},
+    {.id =  481, .api = &benchmark_fft_REDFT11_127,                     .name = "fft_REDFT11_127"},
+    {.id =  482, .api = &benchmark_fft_RODFT00_127,                     .name = "fft_RODFT00_127"},
+    {.id =  483, .api = &benchmark_fft_RODFT01_127,                     .name = "fft_RODFT01_127"},
+    {.id =  484, .api = &benchmark_fft_RODFT10_127,                     .name = "fft_RODFT10_127"},
+    {.id =  485, .api = &benchmark_fft_RODFT11_127,                     .name = "fft_RODFT11_127"},
+    {.id =  486, .api = &benchmark_spgramcf_1200,                       .name = "spgramcf_1200"},
+    {.id =  487, .api = &benchmark_spgramcf_9600,                       .name = "spgramcf_9600"},
+    {.id =  488, .api = &benchmark_spgramcf_76800,                      .name = "spgramcf_76800"},
+    {.id =  489, .api = &benchmark_spgramcf_614400,                     .name = "spgramcf_614400"},
+    {.id =  490, .api = &benchmark_fftfilt_crcf_4,                      .name = "fftfilt_crcf_4"},
+    {.id =  491, .api = &benchmark_fftfilt_crcf_8,                      .name = "fftfilt_crcf_8"},
+    {.id =  492, .api = &benchmark_fftfilt_crcf_16,                     .name = "fftfilt_crcf_16"},
+    {.id =  493, .api = &benchmark_fftfilt_crcf_32,                     .name = "fftfilt_crcf_32"},
+    {.id =  494, .api = &benchmark_fftfilt_crcf_64,                     .name = "fftfilt_crcf_64"},
+    {.id =  495, .api = &benchmark_firdecim_crcf_m2_h8,                 .name = "firdecim_crcf_m2_h8"},
+    {.id =  496, .api = &benchmark_firdecim_crcf_m4_h16,                .name = "firdecim_crcf_m4_h16"},
+    {.id =  497, .api = &benchmark_firdecim_crcf_m8_h32,                .name = "firdecim_crcf_m8_h32"},
+    {.id =  498, .api = &benchmark_firdecim_crcf_m16_h64,               .name = "firdecim_crcf_m16_h64"},
+    {.id =  499, .api = &benchmark_firdecim_cccf_m32_h128,              .name = "firdecim_cccf_m32_h128"},
+    {.id =  500, .api = &benchmark_firdespm_n51,                        .name = "firdespm_n51"},
+    {.id =  501, .api = &benchmark_firdespm_n101,                       .name = "firdespm_n101"},
+    {.id =  502, .api = &benchmark_firdespm_n251,                       .name = "firdespm_n251"},
+    {.id =  503, .api = &benchmark_firdespm_n501,                       .name = "firdespm_n501"},
+    {.id =  504, .api = &benchmark_firdespm_n1001,                      .name = "firdespm_n1001"},
+    {.id =  505, .api = &benchmark_firdespm_n2001,                      .name = "firdespm_n2001"},
+    {.id =  506, .api = &benchmark_firdespm_n2001_w4,                   .name = "firdespm_n2001_w4"},
+    {.id =  507, .api = &benchmark_firhilbf_decim_m3,                   .name = "firhilbf_decim_m3"},
+    {.id =  508, .api = &benchmark_firhilbf_decim_m5,                   .name = "firhilbf_decim_m5"},
+    {.id =  509, .api = &benchmark_firhilbf_decim_m9,                   .name = "firhilbf_decim_m9"},
+    {.id =  510, .api = &benchmark_firhilbf_decim_m13,                  .name = "firhilbf_decim_m13"},
+    {.id =  511, .api = &benchmark_firhilbf_c2r_m13,                    .name = "firhilbf_c2r_m13"},
+    {.id =  512, .api = &benchmark_firhilbf_c2r_m25,                    .name = "firhilbf_c2r_m25"},
+    {.id =  513, .api = &benchmark_firhilbf_c2r_block_m13,              .name = "firhilbf_c2r_block_m13"},
+    {.id =  514, .api = &benchmark_firhilbf_c2r_block_m25,              .name = "firhilbf_c2r_block_m25"},
+    {.id =  515, .api = &benchmark_firinterp_crcf_m2_h8,                .name = "firinterp_crcf_m2_h8"},
+    {.id =  516, .api = &benchmark_firinterp_crcf_m4_h16,               .name = "firinterp_crcf_m4_h16"},
+    {.id =  517, .api = &benchmark_firinterp_crcf_m8_h32,               .name = "firinterp_crcf_m8_h32"},
+    {.id =  518, .api = &benchmark_firinterp_crcf_m16_h64,              .name = "firinterp_crcf_m16_h64"},
+    {.id =  519, .api = &benchmark_firinterp_crcf_m32_h128,             .name = "firinterp_crcf_m32_h128"},
+    {.id =  520, .api = &benchmark_firfilt_crcf_4,                      .name = "firfilt_crcf_4"},
+    {.id =  521, .api = &benchmark_firfilt_crcf_8,                      .name = "firfilt_crcf_8"},
+    {.id =  522, .api = &benchmark_firfilt_crcf_16,                     .name = "firfilt_crcf_16"},
+    {.id =  523, .api = &benchmark_firfilt_crcf_32,                     .name = "firfilt_crcf_32"},
+    {.id =  524, .api = &benchmark_firfilt_crcf_64,                     .name = "firfilt_crcf_64"},
+    {.id =  525, .api = &benchmark_iirdecim_crcf_M2,                    .name = "iirdecim_crcf_M2"},
+    {.id =  526, .api = &benchmark_iirdecim_crcf_M4,                    .name = "iirdecim_crcf_M4"},
+    {.id =  527, .api = &benchmark_iirdecim_crcf_M8,                    .name = "iirdecim_crcf_M8"},
+    {.id =  528, .api = &benchmark_iirdecim_crcf_M16,                   .name = "iirdecim_crcf_M16"},
+    {.id =  529, .api = &benchmark_iirdecim_cccf_M32,                   .name = "iirdecim_cccf_M32"},
+    {.id =  530, .api = &benchmark_iirfilt_crcf_4,                      .name = "iirfilt_crcf_4"},
+    {.id =  531, .api = &benchmark_iirfilt_crcf_8,                      .name = "iirfilt_crcf_8"},
+    {.id =  532, .api = &benchmark_iirfilt_crcf_16,                     .name = "iirfilt_crcf_16"},
+    {.id =  533, .api = &benchmark_iirfilt_crcf_32,                     .name = "iirfilt_crcf_32"},
+    {.id =  534, .api = &benchmark_iirfilt_crcf_64,                     .name = "iirfilt_crcf_64"},
+    {.id =  535, .api = &benchmark_iirfilt_crcf_sos_4,                  .name = "iirfilt_crcf_sos_4"},
+    {.id =  536, .api = &benchmark_iirfilt_crcf_sos_8,                  .name = "iirfilt_crcf_sos_8"},
+    {.id =  537, .api = &benchmark_iirfilt_crcf_sos_16,                 .name = "iirfilt_crcf_sos_16"},
+    {.id =  538, .api = &benchmark_iirfilt_crcf_sos_32,                 .name = "iirfilt_crcf_sos_32"},
+    {.id =  539, .api = &benchmark_iirfilt_crcf_sos_64,                 .name = "iirfilt_crcf_sos_64"},
+    {.id =  540, .api = &benchmark_irfilt_crcf_dcblock,                 .name = "irfilt_crcf_dcblock"},
+    {.id =  541, .api = &benchmark_iirfiltbank_crcf_M64_n4,             .name = "iirfiltbank_crcf_M64_n4"},
+    {.id =  542, .api = &benchmark_iirfiltbank_crcf_M256_n4,            .name = "iirfiltbank_crcf_M256_n4"},
+    {.id =  543, .api = &benchmark_iirfiltbank_crcf_M512_n4,            .name = "iirfiltbank_crcf_M512_n4"},
+    {.id =  544, .api = &benchmark_iirfiltbank_crcf_M1_n4,              .name = "iirfiltbank_crcf_M1_n4"},
+    {.id =  545, .api = &benchmark_iirfiltbank_crcf_M1_n8,              .name = "iirfiltbank_crcf_M1_n8"},
+    {.id =  546, .api = &benchmark_iirinterp_crcf_M2,                   .name = "iirinterp_crcf_M2"},
+    {.id =  547, .api = &benchmark_iirinterp_crcf_M4,                   .name = "iirinterp_crcf_M4"},
+    {.id =  548, .api = &benchmark_iirinterp_crcf_M8,                   .name = "iirinterp_crcf_M8"},
+    {.id =  549, .api = &benchmark_iirinterp_crcf_M16,                  .name = "iirinterp_crcf_M16"},
+    {.id =  550, .api = &benchmark_iirinterp_crcf_M32,                  .name = "iirinterp_crcf_M32"},
+    {.id =  551, .api = &benchmark_rresamp_crcf_P17_Q1,                 .name = "rresamp_crcf_P17_Q1"},
+    {.id =  552, .api = &benchmark_rresamp_crcf_P17_Q2,                 .name = "rresamp_crcf_P17_Q2"},
+    {.id =  553, .api = &benchmark_rresamp_crcf_P17_Q4,                 .name = "rresamp_crcf_P17_Q4"},
+    {.id =  554, .api = &benchmark_rresamp_crcf_P17_Q8,                 .name = "rresamp_crcf_P17_Q8"},
+    {.id =  555, .api = &benchmark_rresamp_crcf_P17_Q16,                .name = "rresamp_crcf_P17_Q16"},
+    {.id =  556, .api = &benchmark_rresamp_crcf_P17_Q32,                .name = "rresamp_crcf_P17_Q32"},
+    {.id =  557, .api = &benchmark_rresamp_crcf_P17_Q64,                .name = "rresamp_crcf_P17_Q64"},
+    {.id =  558, .api = &benchmark_rresamp_crcf_P17_Q128,               .name = "rresamp_crcf_P17_Q128"},
+    {.id =  559, .api = &benchmark_rresamp_crcf_P17_Q256,               .name = "rresamp_crcf_P17_Q256"},
+    {.id =  560, .api = &benchmark_resamp_crcf_P17_Q1,                  .name = "resamp_crcf_P17_Q1"},
+    {.id =  561, .api = &benchmark_resamp_crcf_P17_Q2,                  .name = "resamp_crcf_P17_Q2"},
+    {.id =  562, .api = &benchmark_resamp_crcf_P17_Q4,                  .name = "resamp_crcf_P17_Q4"},
+    {.id =  563, .api = &benchmark_resamp_crcf_P17_Q8,                  .name = "resamp_crcf_P17_Q8"},
+    {.id =  564, .api = &benchmark_resamp_crcf_P17_Q16,                 .name = "resamp_crcf_P17_Q16"},
+    {.id =  565, .api = &benchmark_resamp_crcf_P17_Q32,                 .name = "resamp_crcf_P17_Q32"},
+    {.id =  566, .api = &benchmark_resamp_crcf_P17_Q64,                 .name = "resamp_crcf_P17_Q64"},
+    {.id =  567, .api = &benchmark_resamp_crcf_P17_Q128,                .name = "resamp_crcf_P17_Q128"},
+    {.id =  568, .api = &benchmark_resamp_crcf_P17_Q256,                .name = "resamp_crcf_P17_Q256"},
+    {.id =  569, .api = &benchmark_resamp2_crcf_decim_m2,               .name = "resamp2_crcf_decim_m2"},
+    {.id =  570, .api = &benchmark_resamp2_crcf_decim_m4,               .name = "resamp2_crcf_decim_m4"},
+    {.id =  571, .api = &benchmark_resamp2_crcf_decim_m8,               .name = "resamp2_crcf_decim_m8"},
+    {.id =  572, .api = &benchmark_resamp2_crcf_decim_m16,              .name = "resamp2_crcf_decim_m16"},
+    {.id =  573, .api = &benchmark_resamp2_crcf_decim_m32,              .name = "resamp2_crcf_decim_m32"},
+    {.id =  574, .api = &benchmark_resamp2_crcf_decim_m64,              .name = "resamp2_crcf_decim_m64"},
+    {.id =  575, .api = &benchmark_resamp2_crcf_decim_m128,             .name = "resamp2_crcf_decim_m128"},
+    {.id =  576, .api = &benchmark_resamp2_crcf_decim_m256,             .name = "resamp2_crcf_decim_m256"},
+    {.id =  577, .api = &benchmark_resamp2_crcf_interp_m2,              .name = "resamp2_crcf_interp_m2"},
+    {.id =  578, .api = &benchmark_resamp2_crcf_interp_m4,              .name = "resamp2_crcf_interp_m4"},
+    {.id =  579, .api = &benchmark_resamp2_crcf_interp_m8,              .name = "resamp2_crcf_interp_m8"},
+    {.id =  580, .api = &benchmark_resamp2_crcf_interp_m16,             .name = "resamp2_crcf_interp_m16"},
+    {.id =  581, .api = &benchmark_resamp2_crcf_interp_m32,             .name = "resamp2_crcf_interp_m32"},
+    {.id =  582, .api = &benchmark_resamp2_crcf_interp_m64,             .name = "resamp2_crcf_interp_m64"},
+    {.id =  583, .api = &benchmark_resamp2_crcf_interp_m128,            .name = "resamp2_crcf_interp_m128"},
+    {.id =  584, .api = &benchmark_resamp2_crcf_interp_m256,            .name = "resamp2_crcf_interp_m256"},
+    {.id =  585, .api = &benchmark_symsync_crcf_k2_m2,                  .name = "symsync_crcf_k2_m2"},
+    {.id =  586, .api = &benchmark_symsync_crcf_k2_m4,                  .name = "symsync_crcf_k2_m4"},
+    {.id =  587, .api = &benchmark_symsync_crcf_k2_m8,                  .name = "symsync_crcf_k2_m8"},
+    {.id =  588, .api = &benchmark_symsync_crcf_k2_m16,                 .name = "symsync_crcf_k2_m16"},
+    {.id =  589, .api = &benchmark_presync_cccf_16,                     .name = "presync_cccf_16"},
+    {.id =  590, .api = &benchmark_presync_cccf_32,                     .name = "presync_cccf_32"},
+    {.id =  591, .api = &benchmark_presync_cccf_64,                     .name = "presync_cccf_64"},
+    {.id =  592, .api = &benchmark_presync_cccf_128,                    .name = "presync_cccf_128"},
+    {.id =  593, .api = &benchmark_presync_cccf_256,                    .name = "presync_cccf_256"},
+    {.id =  594, .api = &benchmark_presync_cccf_m32_64,                 .name = "presync_cccf_m32_64"},
+    {.id =  595, .api = &benchmark_presync_cccf_m32_256,                .name = "presync_cccf_m32_256"},
+    {.id =  596, .api = &benchmark_presync_cccf_fft_16,                 .name = "presync_cccf_fft_16"},
+    {.id =  597, .api = &benchmark_presync_cccf_fft_32,                 .name = "presync_cccf_fft_32"},
+    {.id =  598, .api = &benchmark_presync_cccf_fft_64,                 .name = "presync_cccf_fft_64"},
+    {.id =  599, .api = &benchmark_presync_cccf_fft_128,                .name = "presync_cccf_fft_128"},
+    {.id =  600, .api = &benchmark_presync_cccf_fft_256,                .name = "presync_cccf_fft_256"},
+    {.id =  601, .api = &benchmark_bpacketsync,                         .name = "bpacketsync"},
+    {.id =  602, .api = &benchmark_bpresync_cccf_16,                    .name = "bpresync_cccf_16"},
+    {.id =  603, .api = &benchmark_bpresync_cccf_32,                    .name = "bpresync_cccf_32"},
+    {.id =  604, .api = &benchmark_bpresync_cccf_64,                    .name = "bpresync_cccf_64"},
+    {.id =  605, .api = &benchmark_bpresync_cccf_128,                   .name = "bpresync_cccf_128"},
+    {.id =  606, .api = &benchmark_bpresync_cccf_256,                   .name = "bpresync_cccf_256"},
+    {.id =  607, .api = &benchmark_bsync_cccf_16,                       .name = "bsync_cccf_16"},
+    {.id =  608, .api = &benchmark_bsync_cccf_32,                       .name = "bsync_cccf_32"},
+    {.id =  609, .api = &benchmark_bsync_cccf_64,                       .name = "bsync_cccf_64"},
+    {.id =  610, .api = &benchmark_bsync_cccf_128,                      .name = "bsync_cccf_128"},
+    {.id =  611, .api = &benchmark_bsync_cccf_256,                      .name = "bsync_cccf_256"},
+    {.id =  612, .api = &benchmark_detector_cccf_16,                    .name = "detector_cccf_16"},
+    {.id =  613, .api = &benchmark_detector_cccf_32,                    .name = "detector_cccf_32"},
+    {.id =  614, .api = &benchmark_detector_cccf_64,                    .name = "detector_cccf_64"},
+    {.id =  615, .api = &benchmark_detector_cccf_128,                   .name = "detector_cccf_128"},
+    {.id =  616, .api = &benchmark_detector_cccf_256,                   .name = "detector_cccf_256"},
+    {.id =  617, .api = &benchmark_flexframesync,                       .name = "flexframesync"},
+    {.id =  618, .api = &benchmark_framesync64,                         .name = "framesync64"},
+    {.id =  619, .api = &benchmark_gmskframesync,                       .name = "gmskframesync"},
+    {.id =  620, .api = &benchmark_gmskframesync_noise,                 .name = "gmskframesync_noise"},
+    {.id =  621, .api = &benchmark_qdetector_cccf_16,                   .name = "qdetector_cccf_16"},
+    {.id =  622, .api = &benchmark_qdetector_cccf_32,                   .name = "qdetector_cccf_32"},
+    {.id =  623, .api = &benchmark_qdetector_cccf_64,                   .name = "qdetector_cccf_64"},
+    {.id =  624, .api = &benchmark_qdetector_cccf_128,                  .name = "qdetector_cccf_128"},
+    {.id =  625, .api = &benchmark_qdetector_cccf_256,                  .name = "qdetector_cccf_256"},
+    {.id =  626, .api = &benchmark_qdetector_cccf_512,                  .name = "qdetector_cccf_512"},
+    {.id =  627, .api = &benchmark_qdetector_cccf_1024,                 .name = "qdetector_cccf_1024"},
+    {.id =  628, .api = &benchmark_qdetector_cccf_2048,                 .name = "qdetector_cccf_2048"},
+    {.id =  629, .api = &benchmark_qdetector_cccf_4096,                 .name = "qdetector_cccf_4096"},
+    {.id =  630, .api = &benchmark_qdetector_cccf_8192,                 .name = "qdetector_cccf_8192"},
+    {.id =  631, .api = &benchmark_rxchain_framesync64_awgn,            .name = "rxchain_framesync64_awgn"},
+    {.id =  632, .api = &benchmark_rxchain_framesync64_cfo,             .name = "rxchain_framesync64_cfo"},
+    {.id =  633, .api = &benchmark_rxchain_framesync64_multipath,       .name = "rxchain_framesync64_multipath"},
+    {.id =  634, .api = &benchmark_rxchain_framesync64_all,             .name = "rxchain_framesync64_all"},
+    {.id =  635, .api = &benchmark_rxchain_flexframesync_awgn,          .name = "rxchain_flexframesync_awgn"},
+    {.id =  636, .api = &benchmark_rxchain_flexframesync_cfo,           .name = "rxchain_flexframesync_cfo"},
+    {.id =  637, .api = &benchmark_rxchain_flexframesync_multipath,     .name = "rxchain_flexframesync_multipath"},
+    {.id =  638, .api = &benchmark_rxchain_flexframesync_all,           .name = "rxchain_flexframesync_all"},
+    {.id =  639, .api = &benchmark_rxchain_ofdmflexframesync_awgn,      .name = "rxchain_ofdmflexframesync_awgn"},
+    {.id =  640, .api = &benchmark_rxchain_ofdmflexframesync_cfo,       .name = "rxchain_ofdmflexframesync_cfo"},
+    {.id =  641, .api = &benchmark_rxchain_ofdmflexframesync_multipath, .name = "rxchain_ofdmflexframesync_multipath"},
+    {.id =  642, .api = &benchmark_rxchain_ofdmflexframesync_all,       .name = "rxchain_ofdmflexframesync_all"},
+    {.id =  643, .api = &benchmark_vmath_sincos_exact,                  .name = "vmath_sincos_exact"},
+    {.id =  644, .api = &benchmark_vmath_sincos_precise,                .name = "vmath_sincos_precise"},
+    {.id =  645, .api = &benchmark_vmath_sincos_fast,                   .name = "vmath_sincos_fast"},
+    {.id =  646, .api = &benchmark_vmath_cexpj_exact,                   .name = "vmath_cexpj_exact"},
+    {.id =  647, .api = &benchmark_vmath_cexpj_precise,                 .name = "vmath_cexpj_precise"},
+    {.id =  648, .api = &benchmark_vmath_cexpj_fast,                    .name = "vmath_cexpj_fast"},
+    {.id =  649, .api = &benchmark_vmath_atan2_exact,                   .name = "vmath_atan2_exact"},
+    {.id =  650, .api = &benchmark_vmath_atan2_precise,                 .name = "vmath_atan2_precise"},
+    {.id =  651, .api = &benchmark_vmath_atan2_fast,                    .name = "vmath_atan2_fast"},
+    {.id =  652, .api = &benchmark_vmath_exp_exact,                     .name = "vmath_exp_exact"},
+    {.id =  653, .api = &benchmark_vmath_exp_precise,                   .name = "vmath_exp_precise"},
+    {.id =  654, .api = &benchmark_vmath_exp_fast,                      .name = "vmath_exp_fast"},
+    {.id =  655, .api = &benchmark_vmath_log_exact,                     .name = "vmath_log_exact"},
+    {.id =  656, .api = &benchmark_vmath_log_precise,                   .name = "vmath_log_precise"},
+    {.id =  657, .api = &benchmark_vmath_log_fast,                      .name = "vmath_log_fast"},
+    {.id =  658, .api = &benchmark_vmath_log10_exact,                   .name = "vmath_log10_exact"},
+    {.id =  659, .api = &benchmark_vmath_log10_precise,                 .name = "vmath_log10_precise"},
+    {.id =  660, .api = &benchmark_vmath_log10_fast,                    .name = "vmath_log10_fast"},
+    {.id =  661, .api = &benchmark_polyf_fit_q3_n8,                     .name = "polyf_fit_q3_n8"},
+    {.id =  662, .api = &benchmark_polyf_fit_q3_n16,                    .name = "polyf_fit_q3_n16"},
+    {.id =  663, .api = &benchmark_polyf_fit_q3_n32,                    .name = "polyf_fit_q3_n32"},
+    {.id =  664, .api = &benchmark_polyf_fit_q3_n64,                    .name = "polyf_fit_q3_n64"},
+    {.id =  665, .api = &benchmark_polyf_fit_q3_n128,                   .name = "polyf_fit_q3_n128"},
+    {.id =  666, .api = &benchmark_matrixcf_mul_n8,                     .name = "matrixcf_mul_n8"},
+    {.id =  667, .api = &benchmark_matrixcf_mul_n16,                    .name = "matrixcf_mul_n16"},
+    {.id =  668, .api = &benchmark_matrixcf_mul_n32,                    .name = "matrixcf_mul_n32"},
+    {.id =  669, .api = &benchmark_matrixcf_mul_n64,                    .name = "matrixcf_mul_n64"},
+    {.id =  670, .api = &benchmark_matrixcf_mul_ref_n8,                 .name = "matrixcf_mul_ref_n8"},
+    {.id =  671, .api = &benchmark_matrixcf_mul_ref_n16,                .name = "matrixcf_mul_ref_n16"},
+    {.id =  672, .api = &benchmark_matrixcf_mul_ref_n32,                .name = "matrixcf_mul_ref_n32"},
+    {.id =  673, .api = &benchmark_matrixcf_mul_ref_n64,                .name = "matrixcf_mul_ref_n64"},
+    {.id =  674, .api = &benchmark_matrixcf_transpose_mul_n16,          .name = "matrixcf_transpose_mul_n16"},
+    {.id =  675, .api = &benchmark_matrixcf_transpose_mul_n64,          .name = "matrixcf_transpose_mul_n64"},
+    {.id =  676, .api = &benchmark_matrixcf_mulv_n16,                   .name = "matrixcf_mulv_n16"},
+    {.id =  677, .api = &benchmark_matrixcf_mulv_n32,                   .name = "matrixcf_mulv_n32"},
+    {.id =  678, .api = &benchmark_matrixcf_mulv_n64,                   .name = "matrixcf_mulv_n64"},
+    {.id =  679, .api = &benchmark_matrixcf_mulv_ref_n16,               .name = "matrixcf_mulv_ref_n16"},
+    {.id =  680, .api = &benchmark_matrixcf_mulv_ref_n32,               .name = "matrixcf_mulv_ref_n32"},
+    {.id =  681, .api = &benchmark_matrixcf_mulv_ref_n64,               .name = "matrixcf_mulv_ref_n64"},
+    {.id =  682, .api = &benchmark_matrixf_inv_n2,                      .name = "matrixf_inv_n2"},
+    {.id =  683, .api = &benchmark_matrixf_inv_n4,                      .name = "matrixf_inv_n4"},
+    {.id =  684, .api = &benchmark_matrixf_inv_n8,                      .name = "matrixf_inv_n8"},
+    {.id =  685, .api = &benchmark_matrixf_inv_n16,                     .name = "matrixf_inv_n16"},
+    {.id =  686, .api = &benchmark_matrixf_inv_n32,                     .name = "matrixf_inv_n32"},
+    {.id =  687, .api = &benchmark_matrixf_inv_n64,                     .name = "matrixf_inv_n64"},
+    {.id =  688, .api = &benchmark_matrixf_linsolve_n2,                 .name = "matrixf_linsolve_n2"},
+    {.id =  689, .api = &benchmark_matrixf_linsolve_n4,                 .name = "matrixf_linsolve_n4"},
+    {.id =  690, .api = &benchmark_matrixf_linsolve_n8,                 .name = "matrixf_linsolve_n8"},
+    {.id =  691, .api = &benchmark_matrixf_linsolve_n16,                .name = "matrixf_linsolve_n16"},
+    {.id =  692, .api = &benchmark_matrixf_linsolve_n32,                .name = "matrixf_linsolve_n32"},
+    {.id =  693, .api = &benchmark_matrixf_linsolve_n64,                .name = "matrixf_linsolve_n64"},
+    {.id =  694, .api = &benchmark_matrixf_lusolve_n16,                 .name = "matrixf_lusolve_n16"},
+    {.id =  695, .api = &benchmark_matrixf_lusolve_n32,                 .name = "matrixf_lusolve_n32"},
+    {.id =  696, .api = &benchmark_matrixf_lusolve_n64,                 .name = "matrixf_lusolve_n64"},
+    {.id =  697, .api = &benchmark_matrixf_gjelim_n16,                  .name = "matrixf_gjelim_n16"},
+    {.id =  698, .api = &benchmark_matrixf_gjelim_n32,                  .name = "matrixf_gjelim_n32"},
+    {.id =  699, .api = &benchmark_matrixf_gjelim_n64,                  .name = "matrixf_gjelim_n64"},
+    {.id =  700, .api = &benchmark_matrixf_cholsolve_n16,               .name = "matrixf_cholsolve_n16"},
+    {.id =  701, .api = &benchmark_matrixf_cholsolve_n32,               .name = "matrixf_cholsolve_n32"},
+    {.id =  702, .api = &benchmark_matrixf_cholsolve_n64,               .name = "matrixf_cholsolve_n64"},
+    {.id =  703, .api = &benchmark_matrixf_mul_n2,                      .name = "matrixf_mul_n2"},
+    {.id =  704, .api = &benchmark_matrixf_mul_n4,                      .name = "matrixf_mul_n4"},
+    {.id =  705, .api = &benchmark_matrixf_mul_n8,                      .name = "matrixf_mul_n8"},
+    {.id =  706, .api = &benchmark_matrixf_mul_n16,                     .name = "matrixf_mul_n16"},
+    {.id =  707, .api = &benchmark_matrixf_mul_n32,                     .name = "matrixf_mul_n32"},
+    {.id =  708, .api = &benchmark_matrixf_mul_n64,                     .name = "matrixf_mul_n64"},
+    {.id =  709, .api = &benchmark_smatrixf_mul_n32,                    .name = "smatrixf_mul_n32"},
+    {.id =  710, .api = &benchmark_smatrixf_mul_n64,                    .name = "smatrixf_mul_n64"},
+    {.id =  711, .api = &benchmark_smatrixf_mul_n128,                   .name = "smatrixf_mul_n128"},
+    {.id =  712, .api = &benchmark_smatrixf_mul_n256,                   .name = "smatrixf_mul_n256"},
+    {.id =  713, .api = &benchmark_smatrixf_mul_n512,                   .name = "smatrixf_mul_n512"},
+    {.id =  714, .api = &benchmark_ampmodem_demod_usb_sc,               .name = "ampmodem_demod_usb_sc"},
+    {.id =  715, .api = &benchmark_ampmodem_demod_usb_sc_block,         .name = "ampmodem_demod_usb_sc_block"},
+    {.id =  716, .api = &benchmark_ampmodem_demod_usb,                  .name = "ampmodem_demod_usb"},
+    {.id =  717, .api = &benchmark_ampmodem_demod_usb_block,            .name = "ampmodem_demod_usb_block"},
+    {.id =  718, .api = &benchmark_cpfskdem_noncoherent,                .name = "cpfskdem_noncoherent"},
+    {.id =  719, .api = &benchmark_cpfskdem_noncoherent_block,          .name = "cpfskdem_noncoherent_block"},
+    {.id =  720, .api = &benchmark_cpfskdem_coherent,                   .name = "cpfskdem_coherent"},
+    {.id =  721, .api = &benchmark_cpfskdem_coherent_block,             .name = "cpfskdem_coherent_block"},
+    {.id =  722, .api = &benchmark_freqdem,                             .name = "freqdem"},
+    {.id =  723, .api = &benchmark_freqdem_block_exact,                 .name = "freqdem_block_exact"},
+    {.id =  724, .api = &benchmark_freqdem_block_terms3,                .name = "freqdem_block_terms3"},
+    {.id =  725, .api = &benchmark_freqdem_block_terms5,                .name = "freqdem_block_terms5"},
+    {.id =  726, .api = &benchmark_freqdem_block_terms7,                .name = "freqdem_block_terms7"},
+    {.id =  727, .api = &benchmark_freqmod,                             .name = "freqmod"},
+    {.id =  728, .api = &benchmark_fskdem_norm_M2,                      .name = "fskdem_norm_M2"},
+    {.id =  729, .api = &benchmark_fskdem_norm_M4,                      .name = "fskdem_norm_M4"},
+    {.id =  730, .api = &benchmark_fskdem_norm_M8,                      .name = "fskdem_norm_M8"},
+    {.id =  731, .api = &benchmark_fskdem_norm_M16,                     .name = "fskdem_norm_M16"},
+    {.id =  732, .api = &benchmark_fskdem_norm_M32,                     .name = "fskdem_norm_M32"},
+    {.id =  733, .api = &benchmark_fskdem_norm_M64,                     .name = "fskdem_norm_M64"},
+    {.id =  734, .api = &benchmark_fskdem_norm_M128,                    .name = "fskdem_norm_M128"},
+    {.id =  735, .api = &benchmark_fskdem_norm_M256,                    .name = "fskdem_norm_M256"},
+    {.id =  736, .api = &benchmark_fskdem_norm_M512,                    .name = "fskdem_norm_M512"},
+    {.id =  737, .api = &benchmark_fskdem_norm_M1024,                   .name = "fskdem_norm_M1024"},
+    {.id =  738, .api = &benchmark_fskdem_misc_M2,                      .name = "fskdem_misc_M2"},
+    {.id =  739, .api = &benchmark_fskdem_misc_M4,                      .name = "fskdem_misc_M4"},
+    {.id =  740, .api = &benchmark_fskdem_misc_M8,                      .name = "fskdem_misc_M8"},
+    {.id =  741, .api = &benchmark_fskdem_misc_M16,                     .name = "fskdem_misc_M16"},
+    {.id =  742, .api = &benchmark_fskdem_misc_M32,                     .name = "fskdem_misc_M32"},
+    {.id =  743, .api = &benchmark_fskdem_misc_M64,                     .name = "fskdem_misc_M64"},
+    {.id =  744, .api = &benchmark_fskdem_misc_M128,                    .name = "fskdem_misc_M128"},
+    {.id =  745, .api = &benchmark_fskdem_misc_M256,                    .name = "fskdem_misc_M256"},
+    {.id =  746, .api = &benchmark_fskdem_misc_M512,                    .name = "fskdem_misc_M512"},
+    {.id =  747, .api = &benchmark_fskdem_misc_M1024,                   .name = "fskdem_misc_M1024"},
+    {.id =  748, .api = &benchmark_fskdem_block_fft_M2,                 .name = "fskdem_block_fft_M2"},
+    {.id =  749, .api = &benchmark_fskdem_block_fft_M4,                 .name = "fskdem_block_fft_M4"},
+    {.id =  750, .api = &benchmark_fskdem_block_fft_M8,                 .name = "fskdem_block_fft_M8"},
+    {.id =  751, .api = &benchmark_fskdem_block_pruned_M2,              .name = "fskdem_block_pruned_M2"},
+    {.id =  752, .api = &benchmark_fskdem_block_pruned_M4,              .name = "fskdem_block_pruned_M4"},
+    {.id =  753, .api = &benchmark_fskdem_block_pruned_M8,              .name = "fskdem_block_pruned_M8"},
+    {.id =  754, .api = &benchmark_fskmod_norm_M2,                      .name = "fskmod_norm_M2"},
+    {.id =  755, .api = &benchmark_fskmod_norm_M4,                      .name = "fskmod_norm_M4"},
+    {.id =  756, .api = &benchmark_fskmod_norm_M8,                      .name = "fskmod_norm_M8"},
+    {.id =  757, .api = &benchmark_fskmod_norm_M16,                     .name = "fskmod_norm_M16"},
+    {.id =  758, .api = &benchmark_fskmod_norm_M32,                     .name = "fskmod_norm_M32"},
+    {.id =  759, .api = &benchmark_fskmod_norm_M64,                     .name = "fskmod_norm_M64"},
+    {.id =  760, .api = &benchmark_fskmod_norm_M128,                    .name = "fskmod_norm_M128"},
+    {.id =  761, .api = &benchmark_fskmod_norm_M256,                    .name = "fskmod_norm_M256"},
+    {.id =  762, .api = &benchmark_fskmod_norm_M512,                    .name = "fskmod_norm_M512"},
+    {.id =  763, .api = &benchmark_fskmod_norm_M1024,                   .name = "fskmod_norm_M1024"},
+    {.id =  764, .api = &benchmark_fskmod_misc_M2,                      .name = "fskmod_misc_M2"},
+    {.id =  765, .api = &benchmark_fskmod_misc_M4,                      .name = "fskmod_misc_M4"},
+    {.id =  766, .api = &benchmark_fskmod_misc_M8,                      .name = "fskmod_misc_M8"},
+    {.id =  767, .api = &benchmark_fskmod_misc_M16,                     .name = "fskmod_misc_M16"},
+    {.id =  768, .api = &benchmark_fskmod_misc_M32,                     .name = "fskmod_misc_M32"},
+    {.id =  769, .api = &benchmark_fskmod_misc_M64,                     .name = "fskmod_misc_M64"},
+    {.id =  770, .api = &benchmark_fskmod_misc_M128,                    .name = "fskmod_misc_M128"},
+    {.id =  771, .api = &benchmark_fskmod_misc_M256,                    .name = "fskmod_misc_M256"},
+    {.id =  772, .api = &benchmark_fskmod_misc_M512,                    .name = "fskmod_misc_M512"},
+    {.id =  773, .api = &benchmark_fskmod_misc_M1024,                   .name = "fskmod_misc_M1024"},
+    {.id =  774, .api = &benchmark_gmskmodem_modulate,                  .name = "gmskmodem_modulate"},
+    {.id =  775, .api = &benchmark_gmskmodem_demodulate,                .name = "gmskmodem_demodulate"},
+    {.id =  776, .api = &benchmark_gmskmodem_demodulate_block,          .name = "gmskmodem_demodulate_block"},
+    {.id =  777, .api = &benchmark_modulate_bpsk,                       .name = "modulate_bpsk"},
+    {.id =  778, .api = &benchmark_modulate_qpsk,                       .name = "modulate_qpsk"},
+    {.id =  779, .api = &benchmark_modulate_ook,                        .name = "modulate_ook"},
+    {.id =  780, .api = &benchmark_modulate_sqam32,                     .name = "modulate_sqam32"},
+    {.id =  781, .api = &benchmark_modulate_sqam128,                    .name = "modulate_sqam128"},
+    {.id =  782, .api = &benchmark_modulate_ask2,                       .name = "modulate_ask2"},
+    {.id =  783, .api = &benchmark_modulate_ask4,                       .name = "modulate_ask4"},
+    {.id =  784, .api = &benchmark_modulate_ask8,                       .name = "modulate_ask8"},
+    {.id =  785, .api = &benchmark_modulate_ask16,                      .name = "modulate_ask16"},
+    {.id =  786, .api = &benchmark_modulate_psk2,                       .name = "modulate_psk2"},
+    {.id =  787, .api = &benchmark_modulate_psk4,                       .name = "modulate_psk4"},
+    {.id =  788, .api = &benchmark_modulate_psk8,                       .name = "modulate_psk8"},
+    {.id =  789, .api = &benchmark_modulate_psk16,                      .name = "modulate_psk16"},
+    {.id =  790, .api = &benchmark_modulate_psk32,                      .name = "modulate_psk32"},
+    {.id =  791, .api = &benchmark_modulate_psk64,                      .name = "modulate_psk64"},
+    {.id =  792, .api = &benchmark_modulate_dpsk2,                      .name = "modulate_dpsk2"},
+    {.id =  793, .api = &benchmark_modulate_dpsk4,                      .name = "modulate_dpsk4"},
+    {.id =  794, .api = &benchmark_modulate_dpsk8,                      .name = "modulate_dpsk8"},
+    {.id =  795, .api = &benchmark_modulate_dpsk16,                     .name = "modulate_dpsk16"},
+    {.id =  796, .api = &benchmark_modulate_dpsk32,                     .name = "modulate_dpsk32"},
+    {.id =  797, .api = &benchmark_modulate_dpsk64,                     .name = "modulate_dpsk64"},
+    {.id =  798, .api = &benchmark_modulate_qam4,                       .name = "modulate_qam4"},
+    {.id =  799, .api = &benchmark_modulate_qam8,                       .name = "modulate_qam8"},
+    {.id =  800, .api = &benchmark_modulate_qam16,                      .name = "modulate_qam16"},
+    {.id =  801, .api = &benchmark_modulate_qam32,                      .name = "modulate_qam32"},
+    {.id =  802, .api = &benchmark_modulate_qam64,                      .name = "modulate_qam64"},
+    {.id =  803, .api = &benchmark_modulate_qam128,                     .name = "modulate_qam128"},
+    {.id =  804, .api = &benchmark_modulate_qam256,                     .name = "modulate_qam256"},
+    {.id =  805, .api = &benchmark_modulate_apsk4,                      .name = "modulate_apsk4"},
+    {.id =  806, .api = &benchmark_modulate_apsk8,                      .name = "modulate_apsk8"},
+    {.id =  807, .api = &benchmark_modulate_apsk16,                     .name = "modulate_apsk16"},
+    {.id =  808, .api = &benchmark_modulate_apsk32,                     .name = "modulate_apsk32"},
+    {.id =  809, .api = &benchmark_modulate_apsk64,                     .name = "modulate_apsk64"},
+    {.id =  810, .api = &benchmark_modulate_apsk128,                    .name = "modulate_apsk128"},
+    {.id =  811, .api = &benchmark_modulate_apsk256,                    .name = "modulate_apsk256"},
+    {.id =  812, .api = &benchmark_modulate_arbV29,                     .name = "modulate_arbV29"},
+    {.id =  813, .api = &benchmark_modulate_arb16opt,                   .name = "modulate_arb16opt"},
+    {.id =  814, .api = &benchmark_modulate_arb32opt,                   .name = "modulate_arb32opt"},
+    {.id =  815, .api = &benchmark_modulate_arb64opt,                   .name = "modulate_arb64opt"},
+    {.id =  816, .api = &benchmark_modulate_arb128opt,                  .name = "modulate_arb128opt"},
+    {.id =  817, .api = &benchmark_modulate_arb256opt,                  .name = "modulate_arb256opt"},
+    {.id =  818, .api = &benchmark_modulate_arb64vt,                    .name = "modulate_arb64vt"},
+    {.id =  819, .api = &benchmark_demodulate_bpsk,                     .name = "demodulate_bpsk"},
+    {.id =  820, .api = &benchmark_demodulate_qpsk,                     .name = "demodulate_qpsk"},
+    {.id =  821, .api = &benchmark_demodulate_ook,                      .name = "demodulate_ook"},
+    {.id =  822, .api = &benchmark_demodulate_sqam32,                   .name = "demodulate_sqam32"},
+    {.id =  823, .api = &benchmark_demodulate_sqam128,                  .name = "demodulate_sqam128"},
+    {.id =  824, .api = &benchmark_demodulate_ask2,                     .name = "demodulate_ask2"},
+    {.id =  825, .api = &benchmark_demodulate_ask4,                     .name = "demodulate_ask4"},
+    {.id =  826, .api = &benchmark_demodulate_ask8,                     .name = "demodulate_ask8"},
+    {.id =  827, .api = &benchmark_demodulate_ask16,                    .name = "demodulate_ask16"},
+    {.id =  828, .api = &benchmark_demodulate_psk2,                     .name = "demodulate_psk2"},
+    {.id =  829, .api = &benchmark_demodulate_psk4,                     .name = "demodulate_psk4"},
+    {.id =  830, .api = &benchmark_demodulate_psk8,                     .name = "demodulate_psk8"},
+    {.id =  831, .api = &benchmark_demodulate_psk16,                    .name = "demodulate_psk16"},
+    {.id =  832, .api = &benchmark_demodulate_psk32,                    .name = "demodulate_psk32"},
+    {.id =  833, .api = &benchmark_demodulate_psk64,                    .name = "demodulate_psk64"},
+    {.id =  834, .api = &benchmark_demodulate_dpsk2,                    .name = "demodulate_dpsk2"},
+    {.id =  835, .api = &benchmark_demodulate_dpsk4,                    .name = "demodulate_dpsk4"},
+    {.id =  836, .api = &benchmark_demodulate_dpsk8,                    .name = "demodulate_dpsk8"},
+    {.id =  837, .api = &benchmark_demodulate_dpsk16,                   .name = "demodulate_dpsk16"},
+    {.id =  838, .api = &benchmark_demodulate_dpsk32,                   .name = "demodulate_dpsk32"},
+    {.id =  839, .api = &benchmark_demodulate_dpsk64,                   .name = "demodulate_dpsk64"},
+    {.id =  840, .api = &benchmark_demodulate_qam4,                     .name = "demodulate_qam4"},
+    {.id =  841, .api = &benchmark_demodulate_qam8,                     .name = "demodulate_qam8"},
+    {.id =  842, .api = &benchmark_demodulate_qam16,                    .name = "demodulate_qam16"},
+    {.id =  843, .api = &benchmark_demodulate_qam32,                    .name = "demodulate_qam32"},
+    {.id =  844, .api = &benchmark_demodulate_qam64,                    .name = "demodulate_qam64"},
+    {.id =  845, .api = &benchmark_demodulate_qam128,                   .name = "demodulate_qam128"},
+    {.id =  846, .api = &benchmark_demodulate_qam256,                   .name = "demodulate_qam256"},
+    {.id =  847, .api = &benchmark_demodulate_apsk4,                    .name = "demodulate_apsk4"},
+    {.id =  848, .api = &benchmark_demodulate_apsk8,                    .name = "demodulate_apsk8"},
+    {.id =  849, .api = &benchmark_demodulate_apsk16,                   .name = "demodulate_apsk16"},
+    {.id =  850, .api = &benchmark_demodulate_apsk32,                   .name = "demodulate_apsk32"},
+    {.id =  851, .api = &benchmark_demodulate_apsk64,                   .name = "demodulate_apsk64"},
+    {.id =  852, .api = &benchmark_demodulate_apsk128,                  .name = "demodulate_apsk128"},
+    {.id =  853, .api = &benchmark_demodulate_apsk256,                  .name = "demodulate_apsk256"},
+    {.id =  854, .api = &benchmark_demodulate_arbV29,                   .name = "demodulate_arbV29"},
+    {.id =  855, .api = &benchmark_demodulate_arb16opt,                 .name = "demodulate_arb16opt"},
+    {.id =  856, .api = &benchmark_demodulate_arb32opt,                 .name = "demodulate_arb32opt"},
+    {.id =  857, .api = &benchmark_demodulate_arb64opt,                 .name = "demodulate_arb64opt"},
+    {.id =  858, .api = &benchmark_demodulate_arb128opt,                .name = "demodulate_arb128opt"},
+    {.id =  859, .api = &benchmark_demodulate_arb256opt,                .name = "demodulate_arb256opt"},
+    {.id =  860, .api = &benchmark_demodulate_arb64vt,                  .name = "demodulate_arb64vt"},
+    {.id =  861, .api = &benchmark_demodulate_block_bpsk,               .name = "demodulate_block_bpsk"},
+    {.id =  862, .api = &benchmark_demodulate_block_qpsk,               .name = "demodulate_block_qpsk"},
+    {.id =  863, .api = &benchmark_demodulate_block_ask16,              .name = "demodulate_block_ask16"},
+    {.id =  864, .api = &benchmark_demodulate_block_psk8,               .name = "demodulate_block_psk8"},
+    {.id =  865, .api = &benchmark_demodulate_block_dpsk8,              .name = "demodulate_block_dpsk8"},
+    {.id =  866, .api = &benchmark_demodulate_block_qam16,              .name = "demodulate_block_qam16"},
+    {.id =  867, .api = &benchmark_demodulate_block_qam64,              .name = "demodulate_block_qam64"},
+    {.id =  868, .api = &benchmark_demodulate_block_qam256,             .name = "demodulate_block_qam256"},
+    {.id =  869, .api = &benchmark_demodulate_block_apsk64,             .name = "demodulate_block_apsk64"},
+    {.id =  870, .api = &benchmark_demodsoft_bpsk,                      .name = "demodsoft_bpsk"},
+    {.id =  871, .api = &benchmark_demodsoft_qpsk,                      .name = "demodsoft_qpsk"},
+    {.id =  872, .api = &benchmark_demodsoft_ook,                       .name = "demodsoft_ook"},
+    {.id =  873, .api = &benchmark_demodsoft_sqam32,                    .name = "demodsoft_sqam32"},
+    {.id =  874, .api = &benchmark_demodsoft_sqam128,                   .name = "demodsoft_sqam128"},
+    {.id =  875, .api = &benchmark_demodsoft_ask2,                      .name = "demodsoft_ask2"},
+    {.id =  876, .api = &benchmark_demodsoft_ask4,                      .name = "demodsoft_ask4"},
+    {.id =  877, .api = &benchmark_demodsoft_ask8,                      .name = "demodsoft_ask8"},
+    {.id =  878, .api = &benchmark_demodsoft_ask16,                     .name = "demodsoft_ask16"},
+    {.id =  879, .api = &benchmark_demodsoft_psk2,                      .name = "demodsoft_psk2"},
+    {.id =  880, .api = &benchmark_demodsoft_psk4,                      .name = "demodsoft_psk4"},
+    {.id =  881, .api = &benchmark_demodsoft_psk8,                      .name = "demodsoft_psk8"},
+    {.id =  882, .api = &benchmark_demodsoft_psk16,                     .name = "demodsoft_psk16"},
+    {.id =  883, .api = &benchmark_demodsoft_psk32,                     .name = "demodsoft_psk32"},
+    {.id =  884, .api = &benchmark_demodsoft_psk64,                     .name = "demodsoft_psk64"},
+    {.id =  885, .api = &benchmark_demodsoft_dpsk2,                     .name = "demodsoft_dpsk2"},
+    {.id =  886, .api = &benchmark_demodsoft_dpsk4,                     .name = "demodsoft_dpsk4"},
+    {.id =  887, .api = &benchmark_demodsoft_dpsk8,                     .name = "demodsoft_dpsk8"},
+    {.id =  888, .api = &benchmark_demodsoft_dpsk16,                    .name = "demodsoft_dpsk16"},
+    {.id =  889, .api = &benchmark_demodsoft_dpsk32,                    .name = "demodsoft_dpsk32"},
+    {.id =  890, .api = &benchmark_demodsoft_dpsk64,                    .name = "demodsoft_dpsk64"},
+    {.id =  891, .api = &benchmark_demodsoft_qam4,                      .name = "demodsoft_qam4"},
+    {.id =  892, .api = &benchmark_demodsoft_qam8,                      .name = "demodsoft_qam8"},
+    {.id =  893, .api = &benchmark_demodsoft_qam16,                     .name = "demodsoft_qam16"},
+    {.id =  894, .api = &benchmark_demodsoft_qam32,                     .name = "demodsoft_qam32"},
+    {.id =  895, .api = &benchmark_demodsoft_qam64,                     .name = "demodsoft_qam64"},
+    {.id =  896, .api = &benchmark_demodsoft_qam128,                    .name = "demodsoft_qam128"},
+    {.id =  897, .api = &benchmark_demodsoft_qam256,                    .name = "demodsoft_qam256"},
+    {.id =  898, .api = &benchmark_demodsoft_apsk4,                     .name = "demodsoft_apsk4"},
+    {.id =  899, .api = &benchmark_demodsoft_apsk8,                     .name = "demodsoft_apsk8"},
+    {.id =  900, .api = &benchmark_demodsoft_apsk16,                    .name = "demodsoft_apsk16"},
+    {.id =  901, .api = &benchmark_demodsoft_apsk32,                    .name = "demodsoft_apsk32"},
+    {.id =  902, .api = &benchmark_demodsoft_apsk64,                    .name = "demodsoft_apsk64"},
+    {.id =  903, .api = &benchmark_demodsoft_apsk128,                   .name = "demodsoft_apsk128"},
+    {.id =  904, .api = &benchmark_demodsoft_apsk256,                   .name = "demodsoft_apsk256"},
+    {.id =  905, .api = &benchmark_demodsoft_arbV29,                    .name = "demodsoft_arbV29"},
+    {.id =  906, .api = &benchmark_demodsoft_arb16opt,                  .name = "demodsoft_arb16opt"},
+    {.id =  907, .api = &benchmark_demodsoft_arb32opt,                  .name = "demodsoft_arb32opt"},
+    {.id =  908, .api = &benchmark_demodsoft_arb64opt,                  .name = "demodsoft_arb64opt"},
+    {.id =  909, .api = &benchmark_demodsoft_arb128opt,                 .name = "demodsoft_arb128opt"},
+    {.id =  910, .api = &benchmark_demodsoft_arb256opt,                 .name = "demodsoft_arb256opt"},
+    {.id =  911, .api = &benchmark_demodsoft_arb64vt,                   .name = "demodsoft_arb64vt"},
+    {.id =  912, .api = &benchmark_firpfbch_crcf_a4,                    .name = "firpfbch_crcf_a4"},
+    {.id =  913, .api = &benchmark_firpfbch_crcf_a16,                   .name = "firpfbch_crcf_a16"},
+    {.id =  914, .api = &benchmark_firpfbch_crcf_a64,                   .name = "firpfbch_crcf_a64"},
+    {.id =  915, .api = &benchmark_firpfbch_crcf_a256,                  .name = "firpfbch_crcf_a256"},
+    {.id =  916, .api = &benchmark_firpfbch_crcf_a512,                  .name = "firpfbch_crcf_a512"},
+    {.id =  917, .api = &benchmark_firpfbch_crcf_a1024,                 .name = "firpfbch_crcf_a1024"},
+    {.id =  918, .api = &benchmark_firpfbch2_crcf_a4,                   .name = "firpfbch2_crcf_a4"},
+    {.id =  919, .api = &benchmark_firpfbch2_crcf_a16,                  .name = "firpfbch2_crcf_a16"},
+    {.id =  920, .api = &benchmark_firpfbch2_crcf_a64,                  .name = "firpfbch2_crcf_a64"},
+    {.id =  921, .api = &benchmark_firpfbch2_crcf_a256,                 .name = "firpfbch2_crcf_a256"},
+    {.id =  922, .api = &benchmark_firpfbch2_crcf_a512,                 .name = "firpfbch2_crcf_a512"},
+    {.id =  923, .api = &benchmark_firpfbch2_crcf_a1024,                .name = "firpfbch2_crcf_a1024"},
+    {.id =  924, .api = &benchmark_firpfbch2_crcf_s4,                   .name = "firpfbch2_crcf_s4"},
+    {.id =  925, .api = &benchmark_firpfbch2_crcf_s16,                  .name = "firpfbch2_crcf_s16"},
+    {.id =  926, .api = &benchmark_firpfbch2_crcf_s64,                  .name = "firpfbch2_crcf_s64"},
+    {.id =  927, .api = &benchmark_firpfbch2_crcf_s256,                 .name = "firpfbch2_crcf_s256"},
+    {.id =  928, .api = &benchmark_firpfbch2_crcf_s512,                 .name = "firpfbch2_crcf_s512"},
+    {.id =  929, .api = &benchmark_firpfbch2_crcf_s1024,                .name = "firpfbch2_crcf_s1024"},
+    {.id =  930, .api = &benchmark_firpfbchr_crcf_M0064_P0063,          .name = "firpfbchr_crcf_M0064_P0063"},
+    {.id =  931, .api = &benchmark_firpfbchr_crcf_M0128_P0127,          .name = "firpfbchr_crcf_M0128_P0127"},
+    {.id =  932, .api = &benchmark_firpfbchr_crcf_M0256_P0255,          .name = "firpfbchr_crcf_M0256_P0255"},
+    {.id =  933, .api = &benchmark_firpfbchr_crcf_M0512_P0511,          .name = "firpfbchr_crcf_M0512_P0511"},
+    {.id =  934, .api = &benchmark_firpfbchr_crcf_M1024_P1023,          .name = "firpfbchr_crcf_M1024_P1023"},
+    {.id =  935, .api = &benchmark_firpfbchr_crcf_M2048_P2047,          .name = "firpfbchr_crcf_M2048_P2047"},
+    {.id =  936, .api = &benchmark_firpfbchr_crcf_M4096_P4095,          .name = "firpfbchr_crcf_M4096_P4095"},
+    {.id =  937, .api = &benchmark_ofdmframesync_acquire_n64,           .name = "ofdmframesync_acquire_n64"},
+    {.id =  938, .api = &benchmark_ofdmframesync_acquire_n128,          .name = "ofdmframesync_acquire_n128"},
+    {.id =  939, .api = &benchmark_ofdmframesync_acquire_n256,          .name = "ofdmframesync_acquire_n256"},
+    {.id =  940, .api = &benchmark_ofdmframesync_acquire_n512,          .name = "ofdmframesync_acquire_n512"},
+    {.id =  941, .api = &benchmark_ofdmframesync_rxsymbol_n64,          .name = "ofdmframesync_rxsymbol_n64"},
+    {.id =  942, .api = &benchmark_ofdmframesync_rxsymbol_n128,         .name = "ofdmframesync_rxsymbol_n128"},
+    {.id =  943, .api = &benchmark_ofdmframesync_rxsymbol_n256,         .name = "ofdmframesync_rxsymbol_n256"},
+    {.id =  944, .api = &benchmark_ofdmframesync_rxsymbol_n512,         .name = "ofdmframesync_rxsymbol_n512"},
+    {.id =  945, .api = &benchmark_ofdmframesync_rxsymbol_n1024,        .name = "ofdmframesync_rxsymbol_n1024"},
+    {.id =  946, .api = &benchmark_ofdmframesync_rxsymbol_n2048,        .name = "ofdmframesync_rxsymbol_n2048"},
+    {.id =  947, .api = &benchmark_ofdmframesync_rxsymbol_n4096,        .name = "ofdmframesync_rxsymbol_n4096"},
+    {.id =  948, .api = &benchmark_nco_sincos,                          .name = "nco_sincos"},
+    {.id =  949, .api = &benchmark_nco_mix_up,                          .name = "nco_mix_up"},
+    {.id =  950, .api = &benchmark_nco_mix_block_up,                    .name = "nco_mix_block_up"},
+    {.id =  951, .api = &benchmark_vco_sincos,                          .name = "vco_sincos"},
+    {.id =  952, .api = &benchmark_vco_mix_up,                          .name = "vco_mix_up"},
+    {.id =  953, .api = &benchmark_vco_mix_block_up,                    .name = "vco_mix_block_up"},
+    {.id =  954, .api = &benchmark_quantize_adc,                        .name = "quantize_adc"},
+    {.id =  955, .api = &benchmark_quantize_dac,                        .name = "quantize_dac"},
+    {.id =  956, .api = &benchmark_compress_mulaw,                      .name = "compress_mulaw"},
+    {.id =  957, .api = &benchmark_expand_mulaw,                        .name = "expand_mulaw"},
+    {.id =  958, .api = &benchmark_random_uniform,                      .name = "random_uniform"},
+    {.id =  959, .api = &benchmark_random_normal,                       .name = "random_normal"},
+    {.id =  960, .api = &benchmark_random_complex_normal,               .name = "random_complex_normal"},
+    {.id =  961, .api = &benchmark_random_weibull,                      .name = "random_weibull"},
+    {.id =  962, .api = &benchmark_random_ricek,                        .name = "random_ricek"},
+    {.id =  963, .api = &benchmark_bsequence_xcorr_n16,                 .name = "bsequence_xcorr_n16"},
+    {.id =  964, .api = &benchmark_bsequence_xcorr_n64,                 .name = "bsequence_xcorr_n64"},
+    {.id =  965, .api = &benchmark_bsequence_xcorr_n256,                .name = "bsequence_xcorr_n256"},
+    {.id =  966, .api = &benchmark_bsequence_xcorr_n1024,               .name = "bsequence_xcorr_n1024"},
+    {.id =  967, .api = &benchmark_count_ones,                          .name = "count_ones"}
+};
+
+// array of packages
+package_t packages[NUM_PACKAGES] = {
+    {.id =    0, .index =    0, .num_scripts =    1, .name = "null"},
+    {.id =    1, .index =    1, .num_scripts =    1, .name = "agc_crcf"},
+    {.id =    2, .index =    2, .num_scripts =    2, .name = "cvsd"},
+    {.id =    3, .index =    4, .num_scripts =    7, .name = "cbuffercf"},
+    {.id =    4, .index =   11, .num_scripts =    5, .name = "window_push"},
+    {.id =    5, .index =   16, .num_scripts =    5, .name = "window_read"},
+    {.id =    6, .index =   21, .num_scripts =    4, .name = "dotprod_cccf"},
+    {.id =    7, .index =   25, .num_scripts =    4, .name = "dotprod_crcf"},
+    {.id =    8, .index =   29, .num_scripts =    4, .name = "dotprod_rrrf"},
+    {.id =    9, .index =   33, .num_scripts =    4, .name = "sumsqf"},
+    {.id =   10, .index =   37, .num_scripts =    4, .name = "sumsqcf"},
+    {.id =   11, .index =   41, .num_scripts =    5, .name = "eqlms_cccf"},
+    {.id =   12, .index =   46, .num_scripts =   10, .name = "eqrls_cccf"},
+    {.id =   13, .index =   56, .num_scripts =    5, .name = "crc"},
+    {.id =   14, .index =   61, .num_scripts =   23, .name = "fec_encode"},
+    {.id =   15, .index =   84, .num_scripts =   31, .name = "fec_decode"},
+    {.id =   16, .index =  115, .num_scripts =   26, .name = "fecsoft_decode"},
+    {.id =   17, .index =  141, .num_scripts =    4, .name = "sumproduct"},
+    {.id =   18, .index =  145, .num_scripts =   11, .name = "interleaver"},
+    {.id =   19, .index =  156, .num_scripts =    9, .name = "packetizer_decode"},
+    {.id =   20, .index =  165, .num_scripts =  194, .name = "fft_composite"},
+    {.id =   21, .index =  359, .num_scripts =   96, .name = "fft_prime"},
+    {.id =   22, .index =  455, .num_scripts =   15, .name = "fft_radix2"},
+    {.id =   23, .index =  470, .num_scripts =   16, .name = "fft_r2r"},
+    {.id =   24, .index =  486, .num_scripts =    4, .name = "spgramcf"},
+    {.id =   25, .index =  490, .num_scripts =    5, .name = "fftfilt_crcf"},
+    {.id =   26, .index =  495, .num_scripts =    5, .name = "firdecim_crcf"},
+    {.id =   27, .index =  500, .num_scripts =    7, .name = "firdespm"},
+    {.id =   28, .index =  507, .num_scripts =    8, .name = "firhilb"},
+    {.id =   29, .index =  515, .num_scripts =    5, .name = "firinterp_crcf"},
+    {.id =   30, .index =  520, .num_scripts =    5, .name = "firfilt_crcf"},
+    {.id =   31, .index =  525, .num_scripts =    5, .name = "iirdecim_crcf"},
+    {.id =   32, .index =  530, .num_scripts =   11, .name = "iirfilt_crcf"},
+    {.id =   33, .index =  541, .num_scripts =    5, .name = "iirfiltbank_crcf"},
+    {.id =   34, .index =  546, .num_scripts =    5, .name = "iirinterp_crcf"},
+    {.id =   35, .index =  551, .num_scripts =    9, .name = "rresamp_crcf"},
+    {.id =   36, .index =  560, .num_scripts =    9, .name = "resamp_crcf"},
+    {.id =   37, .index =  569, .num_scripts =   16, .name = "resamp2_crcf"},
+    {.id =   38, .index =  585, .num_scripts =    4, .name = "symsync_crcf"},
+    {.id =   39, .index =  589, .num_scripts =   12, .name = "presync"},
+    {.id =   40, .index =  601, .num_scripts =    1, .name = "bpacketsync"},
+    {.id =   41, .index =  602, .num_scripts =    5, .name = "bpresync"},
+    {.id =   42, .index =  607, .num_scripts =    5, .name = "bsync"},
+    {.id =   43, .index =  612, .num_scripts =    5, .name = "detector"},
+    {.id =   44, .index =  617, .num_scripts =    1, .name = "flexframesync"},
+    {.id =   45, .index =  618, .num_scripts =    1, .name = "framesync64"},
+    {.id =   46, .index =  619, .num_scripts =    2, .name = "gmskframesync"},
+    {.id =   47, .index =  621, .num_scripts =   10, .name = "qdetector"},
+    {.id =   48, .index =  631, .num_scripts =   12, .name = "rxchain"},
+    {.id =   49, .index =  643, .num_scripts =   18, .name = "math_fast"},
+    {.id =   50, .index =  661, .num_scripts =    5, .name = "polyfit"},
+    {.id =   51, .index =  666, .num_scripts =   16, .name = "matrixcf_mul"},
+    {.id =   52, .index =  682, .num_scripts =    6, .name = "matrixf_inv"},
+    {.id =   53, .index =  688, .num_scripts =    6, .name = "matrixf_linsolve"},
+    {.id =   54, .index =  694, .num_scripts =    9, .name = "matrixf_lusolve"},
+    {.id =   55, .index =  703, .num_scripts =    6, .name = "matrixf_mul"},
+    {.id =   56, .index =  709, .num_scripts =    5, .name = "smatrixf_mul"},
+    {.id =   57, .index =  714, .num_scripts =    4, .name = "ampmodem"},
+    {.id =   58, .index =  718, .num_scripts =    4, .name = "cpfskdem"},
+    {.id =   59, .index =  722, .num_scripts =    5, .name = "freqdem"},
+    {.id =   60, .index =  727, .num_scripts =    1, .name = "freqmod"},
+    {.id =   61, .index =  728, .num_scripts =   26, .name = "fskdem"},
+    {.id =   62, .index =  754, .num_scripts =   20, .name = "fskmod"},
+    {.id =   63, .index =  774, .num_scripts =    3, .name = "gmskmodem"},
+    {.id =   64, .index =  777, .num_scripts =   42, .name = "modem_modulate"},
+    {.id =   65, .index =  819, .num_scripts =   42, .name = "modem_demodulate"},
+    {.id =   66, .index =  861, .num_scripts =    9, .name = "modem_demodulate_block"},
+    {.id =   67, .index =  870, .num_scripts =   42, .name = "modem_demodsoft"},
+    {.id =   68, .index =  912, .num_scripts =    6, .name = "firpfbch_crcf"},
+    {.id =   69, .index =  918, .num_scripts =   12, .name = "firpfbch2_crcf"},
+    {.id =   70, .index =  930, .num_scripts =    7, .name = "firpfbchr_crcf"},
+    {.id =   71, .index =  937, .num_scripts =    4, .name = "ofdmframesync_acquire"},
+    {.id =   72, .index =  941, .num_scripts =    7, .name = "ofdmframesync_rxsymbol"},
+    {.id =   73, .index =  948, .num_scripts =    3, .name = "nco"},
+    {.id =   74, .index =  951, .num_scripts =    3, .name = "vco"},
+    {.id =   75, .index =  954, .num_scripts =    2, .name = "quantizer"},
+    {.id =   76, .index =  956, .num_scripts =    2, .name = "compander"},
+    {.id =   77, .index =  958, .num_scripts =    5, .name = "random"},
+    {.id =   78, .index =  963, .num_scripts =    4, .name = "bsequence"},
+    {.id =   79, .index =  967, .num_scripts =    1, .name = "byte_utilities"}
+};
+
+#endif // __LIQUID_AUTOSCRIPT_INCLUDE_H__
+
@@ -0,0 +1,1211 @@
+clear all; close all; nfft=1200; f=[0:(nfft-1)]/nfft-0.5; psd=zeros(1,nfft);
+idx = [];
+psd(     1) =    -0.226781;
+psd(     2) =    -0.167015;
+psd(     3) =    -0.116351;
+psd(     4) =    -0.124172;
+psd(     5) =    -0.159920;
+psd(     6) =    -0.168050;
+psd(     7) =    -0.104999;
+psd(     8) =    -0.006072;
+psd(     9) =     0.002959;
+psd(    10) =    -0.067081;
+psd(    11) =    -0.078633;
+psd(    12) =    -0.028422;
+psd(    13) =     0.011902;
+psd(    14) =     0.012731;
+psd(    15) =    -0.039639;
+psd(    16) =    -0.061305;
+psd(    17) =     0.002621;
+psd(    18) =     0.012469;
+psd(    19) =    -0.086100;
+psd(    20) =    -0.153966;
+psd(    21) =    -0.153741;
+psd(    22) =    -0.178528;
+psd(    23) =    -0.219150;
+psd(    24) =    -0.207032;
+psd(    25) =    -0.178980;
+psd(    26) =    -0.197892;
+psd(    27) =    -0.227972;
+psd(    28) =    -0.191985;
+psd(    29) =    -0.077519;
+psd(    30) =     0.042292;
+psd(    31) =     0.110535;
+psd(    32) =     0.149651;
+psd(    33) =     0.141425;
+psd(    34) =     0.022529;
+psd(    35) =    -0.151458;
+psd(    36) =    -0.243387;
+psd(    37) =    -0.245443;
+psd(    38) =    -0.250706;
+psd(    39) =    -0.255651;
+psd(    40) =    -0.225541;
+psd(    41) =    -0.184418;
+psd(    42) =    -0.143929;
+psd(    43) =    -0.121316;
+psd(    44) =    -0.095562;
+psd(    45) =    -0.025488;
+psd(    46) =     0.063855;
+psd(    47) =     0.166758;
+psd(    48) =     0.227885;
+psd(    49) =     0.150686;
+psd(    50) =     0.016329;
+psd(    51) =    -0.031511;
+psd(    52) =    -0.001426;
+psd(    53) =     0.037867;
+psd(    54) =     0.030890;
+psd(    55) =    -0.031722;
+psd(    56) =    -0.074104;
+psd(    57) =    -0.078161;
+psd(    58) =    -0.136956;
+psd(    59) =    -0.235795;
+psd(    60) =    -0.225548;
+psd(    61) =    -0.098456;
+psd(    62) =    -0.025470;
+psd(    63) =    -0.075283;
+psd(    64) =    -0.105254;
+psd(    65) =     0.013672;
+psd(    66) =     0.184085;
+psd(    67) =     0.253482;
+psd(    68) =     0.224396;
+psd(    69) =     0.177687;
+psd(    70) =     0.140099;
+psd(    71) =     0.096348;
+psd(    72) =     0.048004;
+psd(    73) =     0.011002;
+psd(    74) =    -0.028261;
+psd(    75) =    -0.066927;
+psd(    76) =    -0.058127;
+psd(    77) =     0.008069;
+psd(    78) =     0.116558;
+psd(    79) =     0.236411;
+psd(    80) =     0.279403;
+psd(    81) =     0.195633;
+psd(    82) =     0.046916;
+psd(    83) =    -0.095936;
+psd(    84) =    -0.181086;
+psd(    85) =    -0.107873;
+psd(    86) =     0.085142;
+psd(    87) =     0.151374;
+psd(    88) =    -0.032768;
+psd(    89) =    -0.288167;
+psd(    90) =    -0.355758;
+psd(    91) =    -0.222454;
+psd(    92) =    -0.034289;
+psd(    93) =     0.092048;
+psd(    94) =     0.090528;
+psd(    95) =    -0.005960;
+psd(    96) =    -0.085271;
+psd(    97) =    -0.065628;
+psd(    98) =     0.012928;
+psd(    99) =     0.058407;
+psd(   100) =     0.096721;
+psd(   101) =     0.192094;
+psd(   102) =     0.255020;
+psd(   103) =     0.166774;
+psd(   104) =    -0.013010;
+psd(   105) =    -0.122986;
+psd(   106) =    -0.112320;
+psd(   107) =    -0.070070;
+psd(   108) =    -0.075853;
+psd(   109) =    -0.111374;
+psd(   110) =    -0.126241;
+psd(   111) =    -0.088183;
+psd(   112) =     0.000100;
+psd(   113) =     0.038916;
+psd(   114) =    -0.045116;
+psd(   115) =    -0.127958;
+psd(   116) =    -0.065299;
+psd(   117) =     0.073415;
+psd(   118) =     0.158916;
+psd(   119) =     0.155731;
+psd(   120) =     0.079473;
+psd(   121) =     0.006898;
+psd(   122) =     0.017786;
+psd(   123) =     0.062201;
+psd(   124) =     0.081397;
+psd(   125) =     0.075889;
+psd(   126) =     0.020531;
+psd(   127) =    -0.047280;
+psd(   128) =    -0.049814;
+psd(   129) =    -0.020469;
+psd(   130) =    -0.032745;
+psd(   131) =    -0.099248;
+psd(   132) =    -0.177336;
+psd(   133) =    -0.221848;
+psd(   134) =    -0.246514;
+psd(   135) =    -0.278536;
+psd(   136) =    -0.275506;
+psd(   137) =    -0.195608;
+psd(   138) =    -0.109966;
+psd(   139) =    -0.080111;
+psd(   140) =    -0.024141;
+psd(   141) =     0.114225;
+psd(   142) =     0.236123;
+psd(   143) =     0.268369;
+psd(   144) =     0.240144;
+psd(   145) =     0.170928;
+psd(   146) =     0.073473;
+psd(   147) =    -0.024221;
+psd(   148) =    -0.123271;
+psd(   149) =    -0.204289;
+psd(   150) =    -0.231013;
+psd(   151) =    -0.208971;
+psd(   152) =    -0.169821;
+psd(   153) =    -0.165985;
+psd(   154) =    -0.203596;
+psd(   155) =    -0.201425;
+psd(   156) =    -0.125342;
+psd(   157) =    -0.072927;
+psd(   158) =    -0.118938;
+psd(   159) =    -0.204690;
+psd(   160) =    -0.267583;
+psd(   161) =    -0.276969;
+psd(   162) =    -0.185879;
+psd(   163) =    -0.051075;
+psd(   164) =     0.025832;
+psd(   165) =     0.052098;
+psd(   166) =     0.054660;
+psd(   167) =    -0.001811;
+psd(   168) =    -0.097446;
+psd(   169) =    -0.126521;
+psd(   170) =    -0.081626;
+psd(   171) =    -0.060825;
+psd(   172) =    -0.091581;
+psd(   173) =    -0.132687;
+psd(   174) =    -0.162711;
+psd(   175) =    -0.191359;
+psd(   176) =    -0.203501;
+psd(   177) =    -0.174941;
+psd(   178) =    -0.158651;
+psd(   179) =    -0.204996;
+psd(   180) =    -0.274447;
+psd(   181) =    -0.297767;
+psd(   182) =    -0.244712;
+psd(   183) =    -0.178122;
+psd(   184) =    -0.186325;
+psd(   185) =    -0.232530;
+psd(   186) =    -0.192639;
+psd(   187) =    -0.073956;
+psd(   188) =    -0.018193;
+psd(   189) =    -0.028151;
+psd(   190) =     0.026691;
+psd(   191) =     0.109753;
+psd(   192) =     0.075284;
+psd(   193) =    -0.055534;
+psd(   194) =    -0.150213;
+psd(   195) =    -0.202142;
+psd(   196) =    -0.296497;
+psd(   197) =    -0.404050;
+psd(   198) =    -0.440168;
+psd(   199) =    -0.434654;
+psd(   200) =    -0.417050;
+psd(   201) =    -0.329082;
+psd(   202) =    -0.218432;
+psd(   203) =    -0.203329;
+psd(   204) =    -0.246144;
+psd(   205) =    -0.259354;
+psd(   206) =    -0.217617;
+psd(   207) =    -0.111680;
+psd(   208) =    -0.044314;
+psd(   209) =    -0.099830;
+psd(   210) =    -0.161713;
+psd(   211) =    -0.140860;
+psd(   212) =    -0.109494;
+psd(   213) =    -0.117357;
+psd(   214) =    -0.173622;
+psd(   215) =    -0.270573;
+psd(   216) =    -0.303670;
+psd(   217) =    -0.217960;
+psd(   218) =    -0.119129;
+psd(   219) =    -0.048055;
+psd(   220) =     0.032401;
+psd(   221) =     0.091109;
+psd(   222) =     0.106758;
+psd(   223) =     0.088018;
+psd(   224) =     0.031717;
+psd(   225) =    -0.022019;
+psd(   226) =    -0.049452;
+psd(   227) =    -0.086866;
+psd(   228) =    -0.141347;
+psd(   229) =    -0.199235;
+psd(   230) =    -0.231861;
+psd(   231) =    -0.210124;
+psd(   232) =    -0.200837;
+psd(   233) =    -0.267828;
+psd(   234) =    -0.316203;
+psd(   235) =    -0.214516;
+psd(   236) =    -0.060821;
+psd(   237) =    -0.052801;
+psd(   238) =    -0.142189;
+psd(   239) =    -0.167933;
+psd(   240) =    -0.158613;
+psd(   241) =    -0.165287;
+psd(   242) =    -0.160015;
+psd(   243) =    -0.153590;
+psd(   244) =    -0.134377;
+psd(   245) =    -0.097618;
+psd(   246) =    -0.055146;
+psd(   247) =     0.036256;
+psd(   248) =     0.119626;
+psd(   249) =     0.093575;
+psd(   250) =     0.012165;
+psd(   251) =    -0.040924;
+psd(   252) =    -0.075883;
+psd(   253) =    -0.141464;
+psd(   254) =    -0.243891;
+psd(   255) =    -0.272364;
+psd(   256) =    -0.189853;
+psd(   257) =    -0.163538;
+psd(   258) =    -0.234603;
+psd(   259) =    -0.253128;
+psd(   260) =    -0.188164;
+psd(   261) =    -0.121728;
+psd(   262) =    -0.067003;
+psd(   263) =    -0.004675;
+psd(   264) =     0.034514;
+psd(   265) =     0.027478;
+psd(   266) =     0.030185;
+psd(   267) =     0.094908;
+psd(   268) =     0.163151;
+psd(   269) =     0.108178;
+psd(   270) =    -0.063231;
+psd(   271) =    -0.142995;
+psd(   272) =    -0.039034;
+psd(   273) =     0.118745;
+psd(   274) =     0.238072;
+psd(   275) =     0.289242;
+psd(   276) =     0.262811;
+psd(   277) =     0.165822;
+psd(   278) =    -0.011931;
+psd(   279) =    -0.248164;
+psd(   280) =    -0.445554;
+psd(   281) =    -0.494030;
+psd(   282) =    -0.385680;
+psd(   283) =    -0.231049;
+psd(   284) =    -0.124324;
+psd(   285) =    -0.075358;
+psd(   286) =    -0.070050;
+psd(   287) =    -0.098570;
+psd(   288) =    -0.147962;
+psd(   289) =    -0.201074;
+psd(   290) =    -0.223637;
+psd(   291) =    -0.193027;
+psd(   292) =    -0.112459;
+psd(   293) =    -0.015238;
+psd(   294) =     0.014617;
+psd(   295) =    -0.057742;
+psd(   296) =    -0.136426;
+psd(   297) =    -0.131396;
+psd(   298) =    -0.053330;
+psd(   299) =     0.064917;
+psd(   300) =     0.131096;
+psd(   301) =     0.040807;
+psd(   302) =    -0.091393;
+psd(   303) =    -0.045087;
+psd(   304) =     0.110227;
+psd(   305) =     0.167689;
+psd(   306) =     0.134010;
+psd(   307) =     0.091998;
+psd(   308) =     0.038295;
+psd(   309) =    -0.016065;
+psd(   310) =    -0.072267;
+psd(   311) =    -0.127063;
+psd(   312) =    -0.125798;
+psd(   313) =    -0.129775;
+psd(   314) =    -0.209268;
+psd(   315) =    -0.272529;
+psd(   316) =    -0.238689;
+psd(   317) =    -0.152285;
+psd(   318) =    -0.110145;
+psd(   319) =    -0.135583;
+psd(   320) =    -0.171496;
+psd(   321) =    -0.210445;
+psd(   322) =    -0.253643;
+psd(   323) =    -0.263525;
+psd(   324) =    -0.264222;
+psd(   325) =    -0.304175;
+psd(   326) =    -0.337789;
+psd(   327) =    -0.284192;
+psd(   328) =    -0.164241;
+psd(   329) =    -0.052746;
+psd(   330) =    -0.006049;
+psd(   331) =    -0.067775;
+psd(   332) =    -0.173847;
+psd(   333) =    -0.179241;
+psd(   334) =    -0.104112;
+psd(   335) =    -0.061710;
+psd(   336) =    -0.020432;
+psd(   337) =     0.040922;
+psd(   338) =     0.012815;
+psd(   339) =    -0.101491;
+psd(   340) =    -0.150463;
+psd(   341) =    -0.119525;
+psd(   342) =    -0.103043;
+psd(   343) =    -0.087098;
+psd(   344) =    -0.058442;
+psd(   345) =    -0.068277;
+psd(   346) =    -0.113955;
+psd(   347) =    -0.191898;
+psd(   348) =    -0.323527;
+psd(   349) =    -0.437204;
+psd(   350) =    -0.437098;
+psd(   351) =    -0.354738;
+psd(   352) =    -0.268019;
+psd(   353) =    -0.207128;
+psd(   354) =    -0.192932;
+psd(   355) =    -0.201684;
+psd(   356) =    -0.140772;
+psd(   357) =    -0.019836;
+psd(   358) =     0.013121;
+psd(   359) =    -0.102195;
+psd(   360) =    -0.257183;
+psd(   361) =    -0.346274;
+psd(   362) =    -0.390999;
+psd(   363) =    -0.421597;
+psd(   364) =    -0.411699;
+psd(   365) =    -0.401863;
+psd(   366) =    -0.462729;
+psd(   367) =    -0.505486;
+psd(   368) =    -0.374693;
+psd(   369) =    -0.162936;
+psd(   370) =    -0.112578;
+psd(   371) =    -0.251135;
+psd(   372) =    -0.389420;
+psd(   373) =    -0.399474;
+psd(   374) =    -0.318647;
+psd(   375) =    -0.248149;
+psd(   376) =    -0.223872;
+psd(   377) =    -0.175620;
+psd(   378) =    -0.077542;
+psd(   379) =    -0.015479;
+psd(   380) =    -0.069218;
+psd(   381) =    -0.232728;
+psd(   382) =    -0.382278;
+psd(   383) =    -0.402653;
+psd(   384) =    -0.383291;
+psd(   385) =    -0.418547;
+psd(   386) =    -0.394404;
+psd(   387) =    -0.240838;
+psd(   388) =    -0.100433;
+psd(   389) =    -0.101455;
+psd(   390) =    -0.184756;
+psd(   391) =    -0.186103;
+psd(   392) =    -0.082318;
+psd(   393) =     0.002564;
+psd(   394) =     0.024294;
+psd(   395) =     0.008319;
+psd(   396) =    -0.068845;
+psd(   397) =    -0.225917;
+psd(   398) =    -0.387318;
+psd(   399) =    -0.400005;
+psd(   400) =    -0.222353;
+psd(   401) =    -0.053103;
+psd(   402) =    -0.078619;
+psd(   403) =    -0.213961;
+psd(   404) =    -0.246786;
+psd(   405) =    -0.170498;
+psd(   406) =    -0.106646;
+psd(   407) =    -0.070344;
+psd(   408) =    -0.061265;
+psd(   409) =    -0.130947;
+psd(   410) =    -0.246201;
+psd(   411) =    -0.307001;
+psd(   412) =    -0.307343;
+psd(   413) =    -0.298333;
+psd(   414) =    -0.269305;
+psd(   415) =    -0.196306;
+psd(   416) =    -0.152070;
+psd(   417) =    -0.219803;
+psd(   418) =    -0.315399;
+psd(   419) =    -0.285500;
+psd(   420) =    -0.174700;
+psd(   421) =    -0.100728;
+psd(   422) =    -0.021547;
+psd(   423) =     0.065011;
+psd(   424) =     0.050601;
+psd(   425) =    -0.059698;
+psd(   426) =    -0.185802;
+psd(   427) =    -0.271235;
+psd(   428) =    -0.304761;
+psd(   429) =    -0.349322;
+psd(   430) =    -0.395300;
+psd(   431) =    -0.359538;
+psd(   432) =    -0.297988;
+psd(   433) =    -0.295978;
+psd(   434) =    -0.278337;
+psd(   435) =    -0.213768;
+psd(   436) =    -0.187243;
+psd(   437) =    -0.170870;
+psd(   438) =    -0.139829;
+psd(   439) =    -0.214500;
+psd(   440) =    -0.421115;
+psd(   441) =    -0.611376;
+psd(   442) =    -0.655074;
+psd(   443) =    -0.539419;
+psd(   444) =    -0.368981;
+psd(   445) =    -0.274930;
+psd(   446) =    -0.255919;
+psd(   447) =    -0.272761;
+psd(   448) =    -0.364324;
+psd(   449) =    -0.441125;
+psd(   450) =    -0.352240;
+psd(   451) =    -0.204788;
+psd(   452) =    -0.170347;
+psd(   453) =    -0.266139;
+psd(   454) =    -0.435528;
+psd(   455) =    -0.577994;
+psd(   456) =    -0.581983;
+psd(   457) =    -0.461943;
+psd(   458) =    -0.362225;
+psd(   459) =    -0.362378;
+psd(   460) =    -0.407498;
+psd(   461) =    -0.447908;
+psd(   462) =    -0.493900;
+psd(   463) =    -0.550311;
+psd(   464) =    -0.610954;
+psd(   465) =    -0.665195;
+psd(   466) =    -0.709768;
+psd(   467) =    -0.748123;
+psd(   468) =    -0.755626;
+psd(   469) =    -0.732046;
+psd(   470) =    -0.712626;
+psd(   471) =    -0.680313;
+psd(   472) =    -0.600691;
+psd(   473) =    -0.475808;
+psd(   474) =    -0.326357;
+psd(   475) =    -0.236344;
+psd(   476) =    -0.302395;
+psd(   477) =    -0.497284;
+psd(   478) =    -0.688928;
+psd(   479) =    -0.760332;
+psd(   480) =    -0.701835;
+psd(   481) =    -0.598902;
+psd(   482) =    -0.515711;
+psd(   483) =    -0.454106;
+psd(   484) =    -0.420108;
+psd(   485) =    -0.457533;
+psd(   486) =    -0.577341;
+psd(   487) =    -0.720392;
+psd(   488) =    -0.809594;
+psd(   489) =    -0.775259;
+psd(   490) =    -0.619506;
+psd(   491) =    -0.451446;
+psd(   492) =    -0.381233;
+psd(   493) =    -0.436290;
+psd(   494) =    -0.557289;
+psd(   495) =    -0.664044;
+psd(   496) =    -0.705988;
+psd(   497) =    -0.644248;
+psd(   498) =    -0.492284;
+psd(   499) =    -0.360073;
+psd(   500) =    -0.379046;
+psd(   501) =    -0.580739;
+psd(   502) =    -0.805596;
+psd(   503) =    -0.859789;
+psd(   504) =    -0.838535;
+psd(   505) =    -0.914642;
+psd(   506) =    -0.998091;
+psd(   507) =    -0.952362;
+psd(   508) =    -0.866247;
+psd(   509) =    -0.889817;
+psd(   510) =    -1.004826;
+psd(   511) =    -1.069371;
+psd(   512) =    -1.046106;
+psd(   513) =    -1.033610;
+psd(   514) =    -1.088457;
+psd(   515) =    -1.154376;
+psd(   516) =    -1.149225;
+psd(   517) =    -1.107907;
+psd(   518) =    -1.117437;
+psd(   519) =    -1.129151;
+psd(   520) =    -1.046335;
+psd(   521) =    -0.932202;
+psd(   522) =    -0.908065;
+psd(   523) =    -0.962247;
+psd(   524) =    -1.039050;
+psd(   525) =    -1.180872;
+psd(   526) =    -1.390758;
+psd(   527) =    -1.479226;
+psd(   528) =    -1.361570;
+psd(   529) =    -1.276267;
+psd(   530) =    -1.332284;
+psd(   531) =    -1.381428;
+psd(   532) =    -1.426360;
+psd(   533) =    -1.562764;
+psd(   534) =    -1.683721;
+psd(   535) =    -1.690769;
+psd(   536) =    -1.665657;
+psd(   537) =    -1.684102;
+psd(   538) =    -1.727228;
+psd(   539) =    -1.735634;
+psd(   540) =    -1.739489;
+psd(   541) =    -1.817144;
+psd(   542) =    -1.894193;
+psd(   543) =    -1.877708;
+psd(   544) =    -1.868617;
+psd(   545) =    -1.960852;
+psd(   546) =    -2.095466;
+psd(   547) =    -2.207581;
+psd(   548) =    -2.255061;
+psd(   549) =    -2.225012;
+psd(   550) =    -2.270447;
+psd(   551) =    -2.489622;
+psd(   552) =    -2.676251;
+psd(   553) =    -2.656419;
+psd(   554) =    -2.569407;
+psd(   555) =    -2.565367;
+psd(   556) =    -2.663541;
+psd(   557) =    -2.825516;
+psd(   558) =    -2.978521;
+psd(   559) =    -3.086132;
+psd(   560) =    -3.187945;
+psd(   561) =    -3.312953;
+psd(   562) =    -3.444185;
+psd(   563) =    -3.587782;
+psd(   564) =    -3.754363;
+psd(   565) =    -3.954083;
+psd(   566) =    -4.257135;
+psd(   567) =    -4.611306;
+psd(   568) =    -4.765366;
+psd(   569) =    -4.703285;
+psd(   570) =    -4.720142;
+psd(   571) =    -4.938018;
+psd(   572) =    -5.211477;
+psd(   573) =    -5.430172;
+psd(   574) =    -5.596616;
+psd(   575) =    -5.726423;
+psd(   576) =    -5.916146;
+psd(   577) =    -6.197929;
+psd(   578) =    -6.444881;
+psd(   579) =    -6.656629;
+psd(   580) =    -6.952415;
+psd(   581) =    -7.328663;
+psd(   582) =    -7.720502;
+psd(   583) =    -8.134578;
+psd(   584) =    -8.635007;
+psd(   585) =    -9.218225;
+psd(   586) =    -9.756588;
+psd(   587) =   -10.199117;
+psd(   588) =   -10.666447;
+psd(   589) =   -11.259996;
+psd(   590) =   -11.983314;
+psd(   591) =   -12.796817;
+psd(   592) =   -13.668104;
+psd(   593) =   -14.599907;
+psd(   594) =   -15.644902;
+psd(   595) =   -16.905169;
+psd(   596) =   -18.441748;
+psd(   597) =   -20.246141;
+psd(   598) =   -22.430984;
+psd(   599) =   -25.278400;
+psd(   600) =   -28.870047;
+psd(   601) =   -31.437771;
+psd(   602) =   -29.154272;
+psd(   603) =   -25.336449;
+psd(   604) =   -22.281034;
+psd(   605) =   -20.061789;
+psd(   606) =   -18.438190;
+psd(   607) =   -17.158009;
+psd(   608) =   -16.038147;
+psd(   609) =   -14.952332;
+psd(   610) =   -13.877558;
+psd(   611) =   -12.906480;
+psd(   612) =   -12.122244;
+psd(   613) =   -11.494960;
+psd(   614) =   -10.904159;
+psd(   615) =   -10.280443;
+psd(   616) =    -9.672228;
+psd(   617) =    -9.114640;
+psd(   618) =    -8.595741;
+psd(   619) =    -8.164412;
+psd(   620) =    -7.857945;
+psd(   621) =    -7.572734;
+psd(   622) =    -7.203094;
+psd(   623) =    -6.835434;
+psd(   624) =    -6.581932;
+psd(   625) =    -6.367146;
+psd(   626) =    -6.064853;
+psd(   627) =    -5.711777;
+psd(   628) =    -5.424857;
+psd(   629) =    -5.224529;
+psd(   630) =    -5.040006;
+psd(   631) =    -4.814718;
+psd(   632) =    -4.576938;
+psd(   633) =    -4.398439;
+psd(   634) =    -4.271743;
+psd(   635) =    -4.131658;
+psd(   636) =    -3.988320;
+psd(   637) =    -3.893361;
+psd(   638) =    -3.820339;
+psd(   639) =    -3.688440;
+psd(   640) =    -3.506407;
+psd(   641) =    -3.366437;
+psd(   642) =    -3.240396;
+psd(   643) =    -3.031435;
+psd(   644) =    -2.809172;
+psd(   645) =    -2.688908;
+psd(   646) =    -2.664254;
+psd(   647) =    -2.671364;
+psd(   648) =    -2.644991;
+psd(   649) =    -2.555453;
+psd(   650) =    -2.414236;
+psd(   651) =    -2.254423;
+psd(   652) =    -2.173888;
+psd(   653) =    -2.214131;
+psd(   654) =    -2.220647;
+psd(   655) =    -2.094211;
+psd(   656) =    -1.953705;
+psd(   657) =    -1.874840;
+psd(   658) =    -1.835220;
+psd(   659) =    -1.814759;
+psd(   660) =    -1.757520;
+psd(   661) =    -1.663634;
+psd(   662) =    -1.635259;
+psd(   663) =    -1.660974;
+psd(   664) =    -1.641853;
+psd(   665) =    -1.591609;
+psd(   666) =    -1.550047;
+psd(   667) =    -1.495753;
+psd(   668) =    -1.429594;
+psd(   669) =    -1.379342;
+psd(   670) =    -1.353584;
+psd(   671) =    -1.355495;
+psd(   672) =    -1.349040;
+psd(   673) =    -1.242917;
+psd(   674) =    -1.072963;
+psd(   675) =    -0.994180;
+psd(   676) =    -1.034888;
+psd(   677) =    -1.124194;
+psd(   678) =    -1.227205;
+psd(   679) =    -1.342145;
+psd(   680) =    -1.465596;
+psd(   681) =    -1.541472;
+psd(   682) =    -1.501573;
+psd(   683) =    -1.349898;
+psd(   684) =    -1.185672;
+psd(   685) =    -1.129920;
+psd(   686) =    -1.125292;
+psd(   687) =    -1.018336;
+psd(   688) =    -0.891574;
+psd(   689) =    -0.921827;
+psd(   690) =    -1.056929;
+psd(   691) =    -1.109573;
+psd(   692) =    -1.013492;
+psd(   693) =    -0.857170;
+psd(   694) =    -0.746544;
+psd(   695) =    -0.712938;
+psd(   696) =    -0.741180;
+psd(   697) =    -0.778559;
+psd(   698) =    -0.751188;
+psd(   699) =    -0.676327;
+psd(   700) =    -0.648974;
+psd(   701) =    -0.690941;
+psd(   702) =    -0.701783;
+psd(   703) =    -0.658813;
+psd(   704) =    -0.672168;
+psd(   705) =    -0.716503;
+psd(   706) =    -0.686317;
+psd(   707) =    -0.601519;
+psd(   708) =    -0.548112;
+psd(   709) =    -0.628350;
+psd(   710) =    -0.791878;
+psd(   711) =    -0.810393;
+psd(   712) =    -0.709143;
+psd(   713) =    -0.700951;
+psd(   714) =    -0.752860;
+psd(   715) =    -0.736867;
+psd(   716) =    -0.681931;
+psd(   717) =    -0.639291;
+psd(   718) =    -0.593399;
+psd(   719) =    -0.536273;
+psd(   720) =    -0.479925;
+psd(   721) =    -0.436406;
+psd(   722) =    -0.450394;
+psd(   723) =    -0.566981;
+psd(   724) =    -0.708062;
+psd(   725) =    -0.743747;
+psd(   726) =    -0.695228;
+psd(   727) =    -0.630598;
+psd(   728) =    -0.565024;
+psd(   729) =    -0.516056;
+psd(   730) =    -0.441279;
+psd(   731) =    -0.353878;
+psd(   732) =    -0.363655;
+psd(   733) =    -0.402635;
+psd(   734) =    -0.334937;
+psd(   735) =    -0.254716;
+psd(   736) =    -0.278595;
+psd(   737) =    -0.357081;
+psd(   738) =    -0.427000;
+psd(   739) =    -0.502689;
+psd(   740) =    -0.579250;
+psd(   741) =    -0.594599;
+psd(   742) =    -0.533700;
+psd(   743) =    -0.442171;
+psd(   744) =    -0.343370;
+psd(   745) =    -0.247167;
+psd(   746) =    -0.176219;
+psd(   747) =    -0.158647;
+psd(   748) =    -0.177549;
+psd(   749) =    -0.170725;
+psd(   750) =    -0.149895;
+psd(   751) =    -0.172803;
+psd(   752) =    -0.249850;
+psd(   753) =    -0.352370;
+psd(   754) =    -0.389562;
+psd(   755) =    -0.326490;
+psd(   756) =    -0.282037;
+psd(   757) =    -0.303230;
+psd(   758) =    -0.293273;
+psd(   759) =    -0.234953;
+psd(   760) =    -0.231011;
+psd(   761) =    -0.313127;
+psd(   762) =    -0.388314;
+psd(   763) =    -0.400749;
+psd(   764) =    -0.386797;
+psd(   765) =    -0.347633;
+psd(   766) =    -0.256717;
+psd(   767) =    -0.126804;
+psd(   768) =    -0.029707;
+psd(   769) =    -0.065964;
+psd(   770) =    -0.218112;
+psd(   771) =    -0.345621;
+psd(   772) =    -0.349721;
+psd(   773) =    -0.236199;
+psd(   774) =    -0.135127;
+psd(   775) =    -0.178219;
+psd(   776) =    -0.299736;
+psd(   777) =    -0.332651;
+psd(   778) =    -0.224714;
+psd(   779) =    -0.070823;
+psd(   780) =     0.008824;
+psd(   781) =     0.024911;
+psd(   782) =     0.039992;
+psd(   783) =    -0.001256;
+psd(   784) =    -0.141317;
+psd(   785) =    -0.282990;
+psd(   786) =    -0.333784;
+psd(   787) =    -0.320537;
+psd(   788) =    -0.301106;
+psd(   789) =    -0.283420;
+psd(   790) =    -0.262285;
+psd(   791) =    -0.247696;
+psd(   792) =    -0.251682;
+psd(   793) =    -0.281103;
+psd(   794) =    -0.306035;
+psd(   795) =    -0.283933;
+psd(   796) =    -0.235310;
+psd(   797) =    -0.207209;
+psd(   798) =    -0.197718;
+psd(   799) =    -0.175328;
+psd(   800) =    -0.137872;
+psd(   801) =    -0.135157;
+psd(   802) =    -0.194358;
+psd(   803) =    -0.248931;
+psd(   804) =    -0.265898;
+psd(   805) =    -0.293983;
+psd(   806) =    -0.316576;
+psd(   807) =    -0.303981;
+psd(   808) =    -0.284779;
+psd(   809) =    -0.250687;
+psd(   810) =    -0.174992;
+psd(   811) =    -0.116438;
+psd(   812) =    -0.181706;
+psd(   813) =    -0.334419;
+psd(   814) =    -0.385792;
+psd(   815) =    -0.292465;
+psd(   816) =    -0.214838;
+psd(   817) =    -0.247702;
+psd(   818) =    -0.318020;
+psd(   819) =    -0.310685;
+psd(   820) =    -0.199453;
+psd(   821) =    -0.061042;
+psd(   822) =    -0.023945;
+psd(   823) =    -0.137097;
+psd(   824) =    -0.286271;
+psd(   825) =    -0.340213;
+psd(   826) =    -0.321877;
+psd(   827) =    -0.281144;
+psd(   828) =    -0.213164;
+psd(   829) =    -0.211680;
+psd(   830) =    -0.329663;
+psd(   831) =    -0.398248;
+psd(   832) =    -0.335297;
+psd(   833) =    -0.260603;
+psd(   834) =    -0.179076;
+psd(   835) =    -0.044421;
+psd(   836) =     0.063463;
+psd(   837) =     0.102276;
+psd(   838) =     0.107422;
+psd(   839) =     0.057768;
+psd(   840) =    -0.046395;
+psd(   841) =    -0.083651;
+psd(   842) =     0.010120;
+psd(   843) =     0.104346;
+psd(   844) =     0.060518;
+psd(   845) =    -0.080013;
+psd(   846) =    -0.189465;
+psd(   847) =    -0.240958;
+psd(   848) =    -0.257623;
+psd(   849) =    -0.249709;
+psd(   850) =    -0.229784;
+psd(   851) =    -0.184365;
+psd(   852) =    -0.148473;
+psd(   853) =    -0.172908;
+psd(   854) =    -0.195904;
+psd(   855) =    -0.148995;
+psd(   856) =    -0.088730;
+psd(   857) =    -0.116982;
+psd(   858) =    -0.241030;
+psd(   859) =    -0.311713;
+psd(   860) =    -0.213482;
+psd(   861) =    -0.090470;
+psd(   862) =    -0.117593;
+psd(   863) =    -0.245755;
+psd(   864) =    -0.327753;
+psd(   865) =    -0.328642;
+psd(   866) =    -0.310065;
+psd(   867) =    -0.301583;
+psd(   868) =    -0.278998;
+psd(   869) =    -0.210728;
+psd(   870) =    -0.095555;
+psd(   871) =    -0.003449;
+psd(   872) =    -0.014829;
+psd(   873) =    -0.108497;
+psd(   874) =    -0.191850;
+psd(   875) =    -0.230889;
+psd(   876) =    -0.262191;
+psd(   877) =    -0.270291;
+psd(   878) =    -0.191393;
+psd(   879) =    -0.074055;
+psd(   880) =    -0.022192;
+psd(   881) =    -0.034752;
+psd(   882) =    -0.125007;
+psd(   883) =    -0.315568;
+psd(   884) =    -0.439813;
+psd(   885) =    -0.373907;
+psd(   886) =    -0.259344;
+psd(   887) =    -0.189060;
+psd(   888) =    -0.117488;
+psd(   889) =    -0.076513;
+psd(   890) =    -0.133632;
+psd(   891) =    -0.205527;
+psd(   892) =    -0.175481;
+psd(   893) =    -0.098923;
+psd(   894) =    -0.075972;
+psd(   895) =    -0.123633;
+psd(   896) =    -0.199563;
+psd(   897) =    -0.229994;
+psd(   898) =    -0.220102;
+psd(   899) =    -0.251633;
+psd(   900) =    -0.294751;
+psd(   901) =    -0.237884;
+psd(   902) =    -0.119197;
+psd(   903) =    -0.074118;
+psd(   904) =    -0.140116;
+psd(   905) =    -0.233495;
+psd(   906) =    -0.219914;
+psd(   907) =    -0.108908;
+psd(   908) =    -0.056911;
+psd(   909) =    -0.071662;
+psd(   910) =    -0.036882;
+psd(   911) =     0.028986;
+psd(   912) =     0.027878;
+psd(   913) =    -0.038197;
+psd(   914) =    -0.075625;
+psd(   915) =    -0.050414;
+psd(   916) =    -0.037594;
+psd(   917) =    -0.051043;
+psd(   918) =    -0.048749;
+psd(   919) =    -0.103226;
+psd(   920) =    -0.243336;
+psd(   921) =    -0.306194;
+psd(   922) =    -0.215502;
+psd(   923) =    -0.118016;
+psd(   924) =    -0.135053;
+psd(   925) =    -0.197938;
+psd(   926) =    -0.137390;
+psd(   927) =     0.024387;
+psd(   928) =     0.090897;
+psd(   929) =     0.016744;
+psd(   930) =    -0.079432;
+psd(   931) =    -0.128661;
+psd(   932) =    -0.155693;
+psd(   933) =    -0.156213;
+psd(   934) =    -0.113983;
+psd(   935) =    -0.074344;
+psd(   936) =    -0.040972;
+psd(   937) =     0.039496;
+psd(   938) =     0.141527;
+psd(   939) =     0.165318;
+psd(   940) =     0.100160;
+psd(   941) =     0.020835;
+psd(   942) =    -0.071858;
+psd(   943) =    -0.179775;
+psd(   944) =    -0.215441;
+psd(   945) =    -0.143706;
+psd(   946) =    -0.052676;
+psd(   947) =    -0.043716;
+psd(   948) =    -0.111929;
+psd(   949) =    -0.150877;
+psd(   950) =    -0.114245;
+psd(   951) =    -0.066116;
+psd(   952) =    -0.034200;
+psd(   953) =    -0.045676;
+psd(   954) =    -0.143018;
+psd(   955) =    -0.222919;
+psd(   956) =    -0.193621;
+psd(   957) =    -0.169673;
+psd(   958) =    -0.214952;
+psd(   959) =    -0.215617;
+psd(   960) =    -0.141101;
+psd(   961) =    -0.074675;
+psd(   962) =    -0.004237;
+psd(   963) =     0.075547;
+psd(   964) =     0.085677;
+psd(   965) =    -0.002160;
+psd(   966) =    -0.139754;
+psd(   967) =    -0.222993;
+psd(   968) =    -0.190217;
+psd(   969) =    -0.105723;
+psd(   970) =    -0.048952;
+psd(   971) =    -0.063648;
+psd(   972) =    -0.123375;
+psd(   973) =    -0.129823;
+psd(   974) =    -0.094814;
+psd(   975) =    -0.087642;
+psd(   976) =    -0.046808;
+psd(   977) =     0.015395;
+psd(   978) =    -0.026896;
+psd(   979) =    -0.108750;
+psd(   980) =    -0.121647;
+psd(   981) =    -0.168007;
+psd(   982) =    -0.261298;
+psd(   983) =    -0.215957;
+psd(   984) =    -0.045442;
+psd(   985) =     0.037818;
+psd(   986) =    -0.010651;
+psd(   987) =    -0.071459;
+psd(   988) =    -0.079759;
+psd(   989) =    -0.099256;
+psd(   990) =    -0.208926;
+psd(   991) =    -0.349066;
+psd(   992) =    -0.353746;
+psd(   993) =    -0.198463;
+psd(   994) =    -0.045418;
+psd(   995) =     0.003067;
+psd(   996) =    -0.021695;
+psd(   997) =    -0.074243;
+psd(   998) =    -0.125708;
+psd(   999) =    -0.147235;
+psd(  1000) =    -0.169630;
+psd(  1001) =    -0.257475;
+psd(  1002) =    -0.376633;
+psd(  1003) =    -0.412129;
+psd(  1004) =    -0.341661;
+psd(  1005) =    -0.208827;
+psd(  1006) =    -0.036430;
+psd(  1007) =     0.066090;
+psd(  1008) =     0.004552;
+psd(  1009) =    -0.118243;
+psd(  1010) =    -0.191189;
+psd(  1011) =    -0.250403;
+psd(  1012) =    -0.282525;
+psd(  1013) =    -0.222457;
+psd(  1014) =    -0.128684;
+psd(  1015) =    -0.096218;
+psd(  1016) =    -0.117750;
+psd(  1017) =    -0.114554;
+psd(  1018) =    -0.050120;
+psd(  1019) =     0.013853;
+psd(  1020) =     0.018713;
+psd(  1021) =    -0.002695;
+psd(  1022) =    -0.002341;
+psd(  1023) =     0.005248;
+psd(  1024) =    -0.016193;
+psd(  1025) =    -0.043255;
+psd(  1026) =    -0.005890;
+psd(  1027) =     0.072447;
+psd(  1028) =     0.093491;
+psd(  1029) =     0.048670;
+psd(  1030) =     0.006211;
+psd(  1031) =     0.022618;
+psd(  1032) =     0.093405;
+psd(  1033) =     0.125244;
+psd(  1034) =     0.069354;
+psd(  1035) =     0.009529;
+psd(  1036) =     0.004904;
+psd(  1037) =    -0.004754;
+psd(  1038) =    -0.057002;
+psd(  1039) =    -0.079877;
+psd(  1040) =    -0.058225;
+psd(  1041) =    -0.071966;
+psd(  1042) =    -0.087089;
+psd(  1043) =    -0.051794;
+psd(  1044) =    -0.040452;
+psd(  1045) =    -0.063073;
+psd(  1046) =    -0.059052;
+psd(  1047) =    -0.035939;
+psd(  1048) =    -0.016454;
+psd(  1049) =    -0.030545;
+psd(  1050) =    -0.117097;
+psd(  1051) =    -0.204443;
+psd(  1052) =    -0.181863;
+psd(  1053) =    -0.119079;
+psd(  1054) =    -0.145621;
+psd(  1055) =    -0.215508;
+psd(  1056) =    -0.219363;
+psd(  1057) =    -0.172335;
+psd(  1058) =    -0.118156;
+psd(  1059) =    -0.068987;
+psd(  1060) =    -0.075650;
+psd(  1061) =    -0.117639;
+psd(  1062) =    -0.109320;
+psd(  1063) =    -0.098762;
+psd(  1064) =    -0.142758;
+psd(  1065) =    -0.181591;
+psd(  1066) =    -0.148775;
+psd(  1067) =    -0.029840;
+psd(  1068) =     0.084438;
+psd(  1069) =     0.077708;
+psd(  1070) =    -0.026262;
+psd(  1071) =    -0.072746;
+psd(  1072) =     0.008144;
+psd(  1073) =     0.083615;
+psd(  1074) =     0.056950;
+psd(  1075) =    -0.015361;
+psd(  1076) =    -0.067764;
+psd(  1077) =    -0.059149;
+psd(  1078) =     0.021061;
+psd(  1079) =     0.082341;
+psd(  1080) =     0.053505;
+psd(  1081) =     0.029263;
+psd(  1082) =     0.097601;
+psd(  1083) =     0.132037;
+psd(  1084) =     0.032592;
+psd(  1085) =    -0.065791;
+psd(  1086) =    -0.067011;
+psd(  1087) =    -0.070752;
+psd(  1088) =    -0.124249;
+psd(  1089) =    -0.146617;
+psd(  1090) =    -0.096052;
+psd(  1091) =    -0.052370;
+psd(  1092) =    -0.056420;
+psd(  1093) =    -0.042634;
+psd(  1094) =    -0.016949;
+psd(  1095) =    -0.026615;
+psd(  1096) =    -0.011776;
+psd(  1097) =     0.086179;
+psd(  1098) =     0.183709;
+psd(  1099) =     0.154572;
+psd(  1100) =     0.007710;
+psd(  1101) =    -0.165266;
+psd(  1102) =    -0.297896;
+psd(  1103) =    -0.301228;
+psd(  1104) =    -0.170204;
+psd(  1105) =    -0.026642;
+psd(  1106) =     0.057069;
+psd(  1107) =     0.071911;
+psd(  1108) =     0.027036;
+psd(  1109) =    -0.028659;
+psd(  1110) =    -0.035329;
+psd(  1111) =    -0.018390;
+psd(  1112) =    -0.065255;
+psd(  1113) =    -0.175004;
+psd(  1114) =    -0.279369;
+psd(  1115) =    -0.336008;
+psd(  1116) =    -0.276248;
+psd(  1117) =    -0.124914;
+psd(  1118) =    -0.100251;
+psd(  1119) =    -0.244186;
+psd(  1120) =    -0.296516;
+psd(  1121) =    -0.194986;
+psd(  1122) =    -0.126908;
+psd(  1123) =    -0.115430;
+psd(  1124) =    -0.116401;
+psd(  1125) =    -0.166586;
+psd(  1126) =    -0.235456;
+psd(  1127) =    -0.230045;
+psd(  1128) =    -0.185336;
+psd(  1129) =    -0.220856;
+psd(  1130) =    -0.284606;
+psd(  1131) =    -0.192941;
+psd(  1132) =     0.007759;
+psd(  1133) =     0.091476;
+psd(  1134) =     0.024957;
+psd(  1135) =    -0.046566;
+psd(  1136) =    -0.051036;
+psd(  1137) =    -0.015948;
+psd(  1138) =     0.022045;
+psd(  1139) =     0.021664;
+psd(  1140) =    -0.028996;
+psd(  1141) =    -0.081643;
+psd(  1142) =    -0.067783;
+psd(  1143) =     0.019852;
+psd(  1144) =     0.083781;
+psd(  1145) =     0.039862;
+psd(  1146) =    -0.067156;
+psd(  1147) =    -0.123560;
+psd(  1148) =    -0.074807;
+psd(  1149) =     0.010206;
+psd(  1150) =     0.040355;
+psd(  1151) =     0.032278;
+psd(  1152) =     0.032978;
+psd(  1153) =     0.024398;
+psd(  1154) =    -0.025741;
+psd(  1155) =    -0.120013;
+psd(  1156) =    -0.206663;
+psd(  1157) =    -0.242142;
+psd(  1158) =    -0.255134;
+psd(  1159) =    -0.240780;
+psd(  1160) =    -0.167699;
+psd(  1161) =    -0.074183;
+psd(  1162) =    -0.024811;
+psd(  1163) =    -0.030639;
+psd(  1164) =    -0.036581;
+psd(  1165) =    -0.010612;
+psd(  1166) =    -0.006316;
+psd(  1167) =    -0.067523;
+psd(  1168) =    -0.138715;
+psd(  1169) =    -0.169411;
+psd(  1170) =    -0.179136;
+psd(  1171) =    -0.127634;
+psd(  1172) =    -0.009938;
+psd(  1173) =     0.024807;
+psd(  1174) =    -0.075092;
+psd(  1175) =    -0.193044;
+psd(  1176) =    -0.265810;
+psd(  1177) =    -0.276857;
+psd(  1178) =    -0.184076;
+psd(  1179) =    -0.053164;
+psd(  1180) =    -0.020423;
+psd(  1181) =    -0.092588;
+psd(  1182) =    -0.152229;
+psd(  1183) =    -0.141303;
+psd(  1184) =    -0.100380;
+psd(  1185) =    -0.063848;
+psd(  1186) =    -0.030531;
+psd(  1187) =     0.008037;
+psd(  1188) =     0.037876;
+psd(  1189) =     0.025073;
+psd(  1190) =    -0.054131;
+psd(  1191) =    -0.176626;
+psd(  1192) =    -0.258450;
+psd(  1193) =    -0.254225;
+psd(  1194) =    -0.218527;
+psd(  1195) =    -0.186407;
+psd(  1196) =    -0.124936;
+psd(  1197) =    -0.037317;
+psd(  1198) =    -0.014802;
+psd(  1199) =    -0.106620;
+psd(  1200) =    -0.212912;
+figure; xlabel('f/F_s'); ylabel('PSD [dB]'); hold on;
+  plot([-0.500000,-0.200000],[-0.700000,-0.700000],'Color',[0.5 0 0]);
+  plot([-0.500000,-0.200000],[0.700000,0.700000],'Color',[0 0.5 0]);
+  plot([-0.002000,0.002000],[-20.000000,-20.000000],'Color',[0 0.5 0]);
+  plot([0.200000,0.500000],[-0.700000,-0.700000],'Color',[0.5 0 0]);
+  plot([0.200000,0.500000],[0.700000,0.700000],'Color',[0 0.5 0]);
+  plot(f,psd,'LineWidth',2,'Color',[0 0.3 0.5]);
+  plot(f(idx),psd(idx),'xr');
+hold off; grid on; xlim([-0.5 0.5]);
@@ -1087,6 +1087,13 @@ LIQUID_EQLMS_DEFINE_API(LIQUID_EQLMS_MANGLE_RRRF, float)
 LIQUID_EQLMS_DEFINE_API(LIQUID_EQLMS_MANGLE_CCCF, liquid_float_complex)
 
 
+// recursive least-squares (RLS) update algorithms
+typedef enum {
+    LIQUID_EQRLS_CONVENTIONAL=0,// inverse correlation matrix, O(p^2) per update
+    LIQUID_EQRLS_INVQR,         // inverse QR with Givens rotations, O(p^2)
+    LIQUID_EQRLS_FTF            // stabilized fast transversal filter, O(p)
+} liquid_eqrls_alg;
+
 // recursive least-squares (RLS)
 #define LIQUID_EQRLS_MANGLE_RRRF(name) LIQUID_CONCAT(eqrls_rrrf,name)
 #define LIQUID_EQRLS_MANGLE_CCCF(name) LIQUID_CONCAT(eqrls_cccf,name)
@@ -1105,6 +1112,22 @@ typedef struct EQRLS(_s) * EQRLS();                                         \
 EQRLS() EQRLS(_create)(T *          _h,                                     \
                        unsigned int _n);                                    \
                                                                             \
+/* Create RLS EQ with a particular update algorithm. The conventional   */  \
+/* algorithm (as used by create()) propagates the inverse correlation   */  \
+/* matrix; the inverse QR algorithm propagates its Cholesky factor with */  \
+/* Givens rotations for improved numerical robustness; the fast         */  \
+/* transversal filter uses forward/backward linear prediction to reduce */  \
+/* complexity to O(_n) per update and is best suited to forgetting      */  \
+/* factors close to unity (lambda > 1 - 1/(3 _n)); it restarts its      */  \
+/* predictors whenever numerical drift is detected, and when more than  */  \
+/* one sample has been pushed between calls to step().                  */  \
+/*  _h   : filter coefficients (NULL for {1,0,0...}), [size: _n x 1]    */  \
+/*  _n   : filter length                                                */  \
+/*  _alg : update algorithm, e.g. LIQUID_EQRLS_FTF                      */  \
+EQRLS() EQRLS(_create_alg)(T *              _h,                             \
+                           unsigned int     _n,                             \
+                           liquid_eqrls_alg _alg);                          \
+                                                                            \
 /* Re-create EQ initialized with external coefficients                  */  \
 /*  _q :   equalizer object                                             */  \
 /*  _h :   filter coefficients (NULL for {1,0,0...}), [size: _n x 1]    */  \
@@ -1246,7 +1269,7 @@ unsigned int crc_sizeof_key(crc_scheme _scheme);
 
 
 // available FEC schemes
-#define LIQUID_FEC_NUM_SCHEMES  28
+#define LIQUID_FEC_NUM_SCHEMES  31
 typedef enum {
     LIQUID_FEC_UNKNOWN=0,       // unknown/unsupported scheme
     LIQUID_FEC_NONE,            // no error-correction
@@ -1283,7 +1306,12 @@ typedef enum {
     LIQUID_FEC_CONV_V29P78,     // r7/8, K=9, dfree=4
 
     // Reed-Solomon codes
-    LIQUID_FEC_RS_M8            // m=8, n=255, k=223
+    LIQUID_FEC_RS_M8,           // m=8, n=255, k=223
+
+    // low-density parity check codes (quasi-cyclic, n<=2304)
+    LIQUID_FEC_LDPC_R12,        // r1/2
+    LIQUID_FEC_LDPC_R23,        // r2/3
+    LIQUID_FEC_LDPC_R34         // r3/4
 } fec_scheme;
 
 // pretty names for fec schemes
@@ -1460,6 +1488,43 @@ int packetizer_decode_soft(packetizer            _p,
                            const unsigned char * _pkt,
                            unsigned char *       _msg);
 
+// Execute the packetizer on a batch of equal-length messages
+//  _p      :   packetizer object
+//  _msg    :   input messages (uncoded bytes), [size: _num x dec_msg_len]
+//  _num    :   number of messages
+//  _pkt    :   encoded output packets, [size: _num x enc_msg_len]
+int packetizer_encode_batch(packetizer            _p,
+                            const unsigned char * _msg,
+                            unsigned int          _num,
+                            unsigned char *       _pkt);
+
+// Execute the packetizer to decode a batch of equal-length packets,
+// returning the number of packets which pass the validity check
+//  _p      :   packetizer object
+//  _pkt    :   input packets (coded bytes), [size: _num x enc_msg_len]
+//  _num    :   number of packets
+//  _msg    :   decoded output messages, [size: _num x dec_msg_len]
+//  _valid  :   validity of each packet (ignored if NULL), [size: _num x 1]
+int packetizer_decode_batch(packetizer            _p,
+                            const unsigned char * _pkt,
+                            unsigned int          _num,
+                            unsigned char *       _msg,
+                            int *                 _valid);
+
+// Execute the packetizer to decode a batch of equal-length packets of
+// soft bits, returning the number of packets which pass the validity
+// check
+//  _p      :   packetizer object
+//  _pkt    :   input packets (coded soft bits), [size: _num x 8*enc_msg_len]
+//  _num    :   number of packets
+//  _msg    :   decoded output messages, [size: _num x dec_msg_len]
+//  _valid  :   validity of each packet (ignored if NULL), [size: _num x 1]
+int packetizer_decode_soft_batch(packetizer            _p,
+                                 const unsigned char * _pkt,
+                                 unsigned int          _num,
+                                 unsigned char *       _msg,
+                                 int *                 _valid);
+
 
 //
 // interleaver
@@ -2099,6 +2164,29 @@ int liquid_firdes_prototype(liquid_firfilt_type _type,
                             float               _dt,
                             float *             _h);
 
+// Enable memoizing cache for filter designs (disabled by default). The
+// designs behind liquid_firdes_kaiser(), liquid_firdes_prototype(),
+// firdespm_run() and liquid_iirdes(), and thus objects created from them,
+// are stored keyed on their parameters and copied on subsequent requests
+// rather than re-designed. The cache is thread-safe; once full, the least
+// recently used design is evicted.
+//  _max_entries    :   maximum number of stored designs, _max_entries > 0
+int liquid_design_cache_enable(unsigned int _max_entries);
+
+// Disable filter design cache, releasing all stored designs
+int liquid_design_cache_disable();
+
+// Clear all stored designs and reset hit/miss counters
+int liquid_design_cache_clear();
+
+// Get filter design cache statistics (any output may be NULL)
+//  _num_hits       :   number of designs served from cache
+//  _num_misses     :   number of designs computed while enabled
+//  _num_entries    :   number of stored designs
+int liquid_design_cache_get_stats(unsigned long * _num_hits,
+                                  unsigned long * _num_misses,
+                                  unsigned int *  _num_entries);
+
 // pretty names for filter design types
 extern const char * liquid_firfilt_type_str[LIQUID_FIRFILT_NUM_TYPES][2];
 
@@ -2228,6 +2316,13 @@ int firdespm_destroy(firdespm _q);
 // print firdespm object internals
 int firdespm_print(firdespm _q);
 
+// Set number of threads evaluating the weighted error on the dense
+// frequency grid at each Remez iteration; a user-defined callback is
+// only invoked while creating the grid and need not be thread-safe
+//  _q          :   filter design object
+//  _num_workers:   number of worker threads, _num_workers > 0
+int firdespm_set_workers(firdespm _q, unsigned int _num_workers);
+
 // execute filter design, storing result in _h
 int firdespm_execute(firdespm _q, float * _h);
 
@@ -3101,6 +3196,33 @@ int FIRHILB(_c2r_execute)(FIRHILB() _q,                                     \
                           T *       _y0,                                    \
                           T *       _y1);                                   \
                                                                             \
+/* Execute Hilbert transform (real to complex) on a block of samples    */  \
+/* using a polyphase decomposition which exploits the alternating zero  */  \
+/* taps of the half-band filter. Output is identical to invoking        */  \
+/* r2c_execute() on each sample.                                        */  \
+/*  _q      :   Hilbert transform object                                */  \
+/*  _x      :   real-valued input array, [size: _n x 1]                 */  \
+/*  _n      :   number of input, output samples                         */  \
+/*  _y      :   complex-valued output array, [size: _n x 1]             */  \
+int FIRHILB(_r2c_execute_block)(FIRHILB()    _q,                            \
+                                T *          _x,                            \
+                                unsigned int _n,                            \
+                                TC *         _y);                           \
+                                                                            \
+/* Execute Hilbert transform (complex to real) on a block of samples    */  \
+/* using a polyphase decomposition. Output is identical to invoking     */  \
+/* c2r_execute() on each sample.                                        */  \
+/*  _q      :   Hilbert transform object                                */  \
+/*  _x      :   complex-valued input array, [size: _n x 1]              */  \
+/*  _n      :   number of input, output samples                         */  \
+/*  _y0     :   real-valued output array, lower side-band retained      */  \
+/*  _y1     :   real-valued output array, upper side-band retained      */  \
+int FIRHILB(_c2r_execute_block)(FIRHILB()    _q,                            \
+                                TC *         _x,                            \
+                                unsigned int _n,                            \
+                                T *          _y0,                           \
+                                T *          _y1);                          \
+                                                                            \
 /* Execute Hilbert transform decimator (real to complex)                */  \
 /*  _q      :   Hilbert transform object                                */  \
 /*  _x      :   real-valued input array, [size: 2 x 1]                  */  \
@@ -3595,6 +3717,119 @@ LIQUID_IIRFILTSOS_DEFINE_API(LIQUID_IIRFILTSOS_MANGLE_CCCF,
                                       liquid_float_complex,
                                       liquid_float_complex)
 
+//
+// iirfiltbank : bank of identical infinite impulse response filters
+//
+#define LIQUID_IIRFILTBANK_MANGLE_RRRF(name) LIQUID_CONCAT(iirfiltbank_rrrf,name)
+#define LIQUID_IIRFILTBANK_MANGLE_CRCF(name) LIQUID_CONCAT(iirfiltbank_crcf,name)
+#define LIQUID_IIRFILTBANK_MANGLE_CCCF(name) LIQUID_CONCAT(iirfiltbank_cccf,name)
+
+#define LIQUID_IIRFILTBANK_DEFINE_API(IIRFILTBANK,TO,TC,TI)                 \
+                                                                            \
+/* Bank of infinite impulse response filters sharing one second-order  */  \
+/* sections design and applying it to many independent channels. The   */  \
+/* internal state is stored with channels interleaved so that all       */  \
+/* channels are processed in a single vectorizable pass per section.   */  \
+typedef struct IIRFILTBANK(_s) * IIRFILTBANK();                             \
+                                                                            \
+/* Create filter bank from external second-order sections coefficients  */  \
+/*  _b      : feed-forward coefficients, [size: _nsos x 3]              */  \
+/*  _a      : feed-back coefficients,    [size: _nsos x 3]              */  \
+/*  _nsos   : number of second-order sections (sos), _nsos > 0          */  \
+/*  _M      : number of channels, _M > 0                                */  \
+IIRFILTBANK() IIRFILTBANK(_create_sos)(TC *         _b,                     \
+                                       TC *         _a,                     \
+                                       unsigned int _nsos,                  \
+                                       unsigned int _M);                    \
+                                                                            \
+/* Create filter bank from design template using second-order sections  */  \
+/*  _ftype  : filter type (e.g. LIQUID_IIRDES_BUTTER)                   */  \
+/*  _btype  : band type (e.g. LIQUID_IIRDES_BANDPASS)                   */  \
+/*  _order  : filter order, _order > 0                                  */  \
+/*  _fc     : low-pass prototype cut-off frequency, 0 <= _fc <= 0.5     */  \
+/*  _f0     : center frequency (band-pass, band-stop), 0 <= _f0 <= 0.5  */  \
+/*  _ap     : pass-band ripple in dB, _ap > 0                           */  \
+/*  _as     : stop-band ripple in dB, _as > 0                           */  \
+/*  _M      : number of channels, _M > 0                                */  \
+IIRFILTBANK() IIRFILTBANK(_create_prototype)(                               \
+            liquid_iirdes_filtertype _ftype,                                \
+            liquid_iirdes_bandtype   _btype,                                \
+            unsigned int             _order,                                \
+            float                    _fc,                                   \
+            float                    _f0,                                   \
+            float                    _ap,                                   \
+            float                    _as,                                   \
+            unsigned int             _M);                                   \
+                                                                            \
+/* Create bank of simple first-order DC-blocking filters with transfer  */  \
+/* function \( H(z) = \frac{1 - z^{-1}}{1 - (1-\alpha)z^{-1}} \)        */  \
+/*  _alpha  : normalized filter bandwidth, _alpha > 0                   */  \
+/*  _M      : number of channels, _M > 0                                */  \
+IIRFILTBANK() IIRFILTBANK(_create_dc_blocker)(float        _alpha,          \
+                                              unsigned int _M);             \
+                                                                            \
+/* Copy object including all internal objects and state                 */  \
+IIRFILTBANK() IIRFILTBANK(_copy)(IIRFILTBANK() _q);                         \
+                                                                            \
+/* Destroy filter bank object, freeing all internal memory              */  \
+int IIRFILTBANK(_destroy)(IIRFILTBANK() _q);                                \
+                                                                            \
+/* Print filter bank object properties to stdout                        */  \
+int IIRFILTBANK(_print)(IIRFILTBANK() _q);                                  \
+                                                                            \
+/* Reset internal state of all channels                                 */  \
+int IIRFILTBANK(_reset)(IIRFILTBANK() _q);                                  \
+                                                                            \
+/* Set output scaling for all channels                                  */  \
+int IIRFILTBANK(_set_scale)(IIRFILTBANK() _q, TC _scale);                   \
+                                                                            \
+/* Get output scaling for all channels                                  */  \
+int IIRFILTBANK(_get_scale)(IIRFILTBANK() _q, TC * _scale);                 \
+                                                                            \
+/* Get number of channels in the bank                                   */  \
+unsigned int IIRFILTBANK(_get_num_channels)(IIRFILTBANK() _q);              \
+                                                                            \
+/* Get number of second-order sections in the filter design             */  \
+unsigned int IIRFILTBANK(_get_num_sections)(IIRFILTBANK() _q);              \
+                                                                            \
+/* Execute filter bank on a single sample from each channel; in-place   */  \
+/* operation is permitted                                               */  \
+/*  _q      : filter bank object                                        */  \
+/*  _x      : input samples, one per channel, [size: _M x 1]            */  \
+/*  _y      : output samples, one per channel, [size: _M x 1]           */  \
+int IIRFILTBANK(_execute)(IIRFILTBANK() _q,                                 \
+                          TI *          _x,                                 \
+                          TO *          _y);                                \
+                                                                            \
+/* Execute filter bank on a block of samples from each channel, stored  */  \
+/* interleaved such that sample k of channel m is at index k*_M + m;    */  \
+/* in-place operation is permitted. For a single-channel bank and long  */  \
+/* blocks the recursion is evaluated in parallel segments using a       */  \
+/* look-ahead (state-space) decomposition.                              */  \
+/*  _q      : filter bank object                                        */  \
+/*  _x      : input samples, [size: _n x _M]                            */  \
+/*  _n      : number of samples per channel                             */  \
+/*  _y      : output samples, [size: _n x _M]                           */  \
+int IIRFILTBANK(_execute_block)(IIRFILTBANK() _q,                           \
+                                TI *          _x,                           \
+                                unsigned int  _n,                           \
+                                TO *          _y);                          \
+
+LIQUID_IIRFILTBANK_DEFINE_API(LIQUID_IIRFILTBANK_MANGLE_RRRF,
+                              float,
+                              float,
+                              float)
+
+LIQUID_IIRFILTBANK_DEFINE_API(LIQUID_IIRFILTBANK_MANGLE_CRCF,
+                              liquid_float_complex,
+                              float,
+                              liquid_float_complex)
+
+LIQUID_IIRFILTBANK_DEFINE_API(LIQUID_IIRFILTBANK_MANGLE_CCCF,
+                              liquid_float_complex,
+                              liquid_float_complex,
+                              liquid_float_complex)
+
 //
 // FIR Polyphase filter bank
 //
@@ -5537,6 +5772,20 @@ int framesync64_execute(framesync64            _q,
                         liquid_float_complex * _x,
                         unsigned int           _n);
 
+// search stored capture for frames, splitting the input into overlapping
+// chunks which are processed by independent copies of the synchronizer
+// across a pool of worker threads (sequentially if threads are not
+// available); frames are de-duplicated and delivered to the callback in
+// sample order. The internal state of _q is not modified.
+//  _q              :   frame synchronizer object (configuration template)
+//  _x              :   input samples, [size: _n x 1]
+//  _n              :   number of input samples
+//  _num_workers    :   number of worker threads, _num_workers > 0
+int framesync64_execute_batch(framesync64            _q,
+                              liquid_float_complex * _x,
+                              unsigned int           _n,
+                              unsigned int           _num_workers);
+
 DEPRECATED("debugging enabled by default; return non-zero value to export file",
 int framesync64_debug_enable(framesync64 _q);
 )
@@ -5659,6 +5908,9 @@ typedef struct flexframesync_s * flexframesync;
 flexframesync flexframesync_create(framesync_callback _callback,
                                    void *             _userdata);
 
+// copy object
+flexframesync flexframesync_copy(flexframesync _q);
+
 // destroy frame synchronizer
 int flexframesync_destroy(flexframesync _q);
 
@@ -5668,6 +5920,10 @@ int flexframesync_print(flexframesync _q);
 // reset frame synchronizer internal state
 int flexframesync_reset(flexframesync _q);
 
+// set the callback and userdata fields
+int flexframesync_set_callback(flexframesync _q, framesync_callback _callback);
+int flexframesync_set_userdata(flexframesync _q, void *             _userdata);
+
 // has frame been detected?
 int flexframesync_is_frame_open(flexframesync _q);
 
@@ -5695,6 +5951,24 @@ int flexframesync_execute(flexframesync          _q,
                           liquid_float_complex * _x,
                           unsigned int           _n);
 
+// search stored capture for frames using overlapping chunks across a pool
+// of worker threads; frames are de-duplicated and delivered to the
+// callback in sample order. The internal state of _q is not modified.
+//  _q              :   frame synchronizer object (configuration template)
+//  _x              :   input samples, [size: _n x 1]
+//  _n              :   number of input samples
+//  _max_frame_len  :   maximum length of any frame in capture (samples)
+//  _num_workers    :   number of worker threads, _num_workers > 0
+int flexframesync_execute_batch(flexframesync          _q,
+                                liquid_float_complex * _x,
+                                unsigned int           _n,
+                                unsigned int           _max_frame_len,
+                                unsigned int           _num_workers);
+
+// get/set detection threshold
+float flexframesync_get_threshold(flexframesync _q);
+int   flexframesync_set_threshold(flexframesync _q, float _threshold);
+
 // frame data statistics
 int              flexframesync_reset_framedatastats(flexframesync _q);
 framedatastats_s flexframesync_get_framedatastats  (flexframesync _q);
@@ -6306,6 +6580,17 @@ PRESYNC() PRESYNC(_create)(TC *         _v,                                 \
                            float        _dphi_max,                          \
                            unsigned int _m);                                \
                                                                             \
+/* Create pre-demod synchronizer which evaluates all frequency          */  \
+/* hypotheses at once: partial correlations over short segments of the */  \
+/* sequence are combined with an FFT across segments, so the cost does  */  \
+/* not grow with the frequency search range                             */  \
+/*  _v          : baseband sequence, [size: _n x 1]                     */  \
+/*  _n          : baseband sequence length, _n > 0                      */  \
+/*  _dphi_max   : maximum absolute frequency deviation, in [0,pi]       */  \
+PRESYNC() PRESYNC(_create_fft)(TC *         _v,                             \
+                               unsigned int _n,                             \
+                               float        _dphi_max);                     \
+                                                                            \
 /* Destroy pre-demod synchronizer, freeing all internal memory          */  \
 int PRESYNC(_destroy)(PRESYNC() _q);                                        \
                                                                             \
@@ -6328,6 +6613,19 @@ int PRESYNC(_push)(PRESYNC() _q,                                            \
 int PRESYNC(_execute)(PRESYNC() _q,                                         \
                        TO *      _rxy,                                      \
                        float *   _dphi_hat);                                \
+                                                                            \
+/* Push block of samples, correlating after each; this is a convenience */  \
+/* wrapper around push() and execute() for each sample                  */  \
+/*  _q          : pre-demod synchronizer object                         */  \
+/*  _x          : input samples, [size: _n x 1]                         */  \
+/*  _n          : number of input samples                               */  \
+/*  _rxy        : output cross correlation, [size: _n x 1]              */  \
+/*  _dphi_hat   : output frequency offset estimates, [size: _n x 1]     */  \
+int PRESYNC(_execute_block)(PRESYNC()    _q,                                \
+                            TI *         _x,                                \
+                            unsigned int _n,                                \
+                            TO *         _rxy,                              \
+                            float *      _dphi_hat);                        \
 
 // non-binary pre-demodulation synchronizer
 LIQUID_PRESYNC_DEFINE_API(LIQUID_PRESYNC_MANGLE_CCCF,
@@ -7159,6 +7457,111 @@ unsigned int liquid_nextpow2(unsigned int _x);
 // (n choose k) = n! / ( k! (n-k)! )
 float liquid_nchoosek(unsigned int _n, unsigned int _k);
 
+//
+// Vectorized math functions
+//
+
+// accuracy tiers for vectorized math functions
+typedef enum {
+    LIQUID_VMATH_EXACT=0,   // scalar C math library
+    LIQUID_VMATH_PRECISE,   // polynomial kernels, within a few ulp
+    LIQUID_VMATH_FAST,      // low-order polynomial kernels, ~1e-4
+} liquid_vmath_tier;
+
+// vectorized math functions (used for error table look-up)
+typedef enum {
+    LIQUID_VMATH_SINCOS=0,  // liquid_vsincosf()
+    LIQUID_VMATH_CEXPJ,     // liquid_vcexpjf()
+    LIQUID_VMATH_ATAN2,     // liquid_vatan2f()
+    LIQUID_VMATH_EXP,       // liquid_vexpf()
+    LIQUID_VMATH_LOG,       // liquid_vlogf()
+    LIQUID_VMATH_LOG10,     // liquid_vlog10f()
+} liquid_vmath_func;
+
+// Get maximum error of vectorized math function for a given accuracy
+// tier, verified by the autotests over the following domains:
+//
+//   function   error           domain          PRECISE  FAST
+//   sincos     absolute        |x| <= 8192     2.4e-7   1.4e-5
+//   cexpj      absolute        |x| <= 8192     2.4e-7   1.4e-5
+//   atan2      absolute        all x, y        4.8e-7   9.0e-5
+//   exp        relative        |y| normal      2.4e-7   1.1e-4
+//   log        abs/relative*   x > 0           2.4e-7   1.3e-4
+//   log10      abs/relative*   x > 0           2.4e-7   6.0e-5
+//
+// (*) absolute error where |y| < 1, relative error otherwise. The
+// EXACT tier inherits the accuracy of the C math library. Inputs
+// outside the domain (e.g. large angles) fall back to the C library
+// and special values (0, inf, NaN) follow the C library conventions.
+//  _func   :   math function, e.g. LIQUID_VMATH_SINCOS
+//  _tier   :   accuracy tier, e.g. LIQUID_VMATH_FAST
+float liquid_vmath_get_max_error(int _func,
+                                 int _tier);
+
+// Compute sine and cosine of each element: s[i] = sin(x[i]), c[i] = cos(x[i])
+//  _x      :   input array [size: _n x 1]
+//  _n      :   array length
+//  _sin    :   output sine array [size: _n x 1]
+//  _cos    :   output cosine array [size: _n x 1]
+//  _tier   :   accuracy tier, e.g. LIQUID_VMATH_PRECISE
+int liquid_vsincosf(const float * _x,
+                    unsigned int  _n,
+                    float *       _sin,
+                    float *       _cos,
+                    int           _tier);
+
+// Compute complex phase rotation of each element: y[i] = exp{j theta[i]}
+//  _theta  :   input phase array [size: _n x 1]
+//  _n      :   array length
+//  _y      :   output array [size: _n x 1]
+//  _tier   :   accuracy tier, e.g. LIQUID_VMATH_PRECISE
+int liquid_vcexpjf(const float *          _theta,
+                   unsigned int           _n,
+                   liquid_float_complex * _y,
+                   int                    _tier);
+
+// Compute four-quadrant arctangent of each element: theta[i] = atan2(y[i], x[i])
+//  _y      :   input numerator (imaginary) array [size: _n x 1]
+//  _x      :   input denominator (real) array [size: _n x 1]
+//  _n      :   array length
+//  _theta  :   output angle array [size: _n x 1]
+//  _tier   :   accuracy tier, e.g. LIQUID_VMATH_PRECISE
+int liquid_vatan2f(const float * _y,
+                   const float * _x,
+                   unsigned int  _n,
+                   float *       _theta,
+                   int           _tier);
+
+// Compute exponential of each element: y[i] = exp(x[i])
+//  _x      :   input array [size: _n x 1]
+//  _n      :   array length
+//  _y      :   output array [size: _n x 1]
+//  _tier   :   accuracy tier, e.g. LIQUID_VMATH_PRECISE
+int liquid_vexpf(const float * _x,
+                 unsigned int  _n,
+                 float *       _y,
+                 int           _tier);
+
+// Compute natural logarithm of each element: y[i] = ln(x[i])
+//  _x      :   input array [size: _n x 1]
+//  _n      :   array length
+//  _y      :   output array [size: _n x 1]
+//  _tier   :   accuracy tier, e.g. LIQUID_VMATH_PRECISE
+int liquid_vlogf(const float * _x,
+                 unsigned int  _n,
+                 float *       _y,
+                 int           _tier);
+
+// Compute base-10 logarithm of each element: y[i] = log10(x[i])
+//  _x      :   input array [size: _n x 1]
+//  _n      :   array length
+//  _y      :   output array [size: _n x 1]
+//  _tier   :   accuracy tier, e.g. LIQUID_VMATH_PRECISE
+int liquid_vlog10f(const float * _x,
+                   unsigned int  _n,
+                   float *       _y,
+                   int           _tier);
+
 //
 // Windowing functions
 //
@@ -7831,6 +8234,32 @@ int MATRIX(_ludecomp_doolittle)(T *          _x,                            \
                                 T *          _u,                            \
                                 T *          _p);                           \
                                                                             \
+/* Compute L/U factorization with partial pivoting in place such that   */  \
+/* \(\vec{P}\vec{A} = \vec{L}\vec{U}\), where \(\vec{L}\) is unit lower */  \
+/* triangular (stored below the diagonal) and \(\vec{U}\) is upper      */  \
+/* triangular. Row \(i\) was exchanged with row _piv[i].                */  \
+/*  _a      : input/output square matrix, [size: _n x _n]               */  \
+/*  _n      : matrix dimension                                          */  \
+/*  _piv    : output pivot indices, [size: _n x 1]                      */  \
+int MATRIX(_lufactor)(T *            _a,                                    \
+                      unsigned int   _n,                                    \
+                      unsigned int * _piv);                                 \
+                                                                            \
+/* Solve \(\vec{A}\vec{X} = \vec{B}\) given the factorization of        */  \
+/* \(\vec{A}\) from lufactor()                                          */  \
+/*  _lu     : L/U factors, [size: _n x _n]                              */  \
+/*  _n      : system size                                               */  \
+/*  _piv    : pivot indices, [size: _n x 1]                             */  \
+/*  _b      : right-hand side, [size: _n x _k]                          */  \
+/*  _k      : number of right-hand sides                                */  \
+/*  _x      : solution, [size: _n x _k], may be the same as _b          */  \
+int MATRIX(_lusolve)(T *            _lu,                                    \
+                     unsigned int   _n,                                     \
+                     unsigned int * _piv,                                   \
+                     T *            _b,                                     \
+                     unsigned int   _k,                                     \
+                     T *            _x);                                    \
+                                                                            \
 /* Perform orthnormalization using the Gram-Schmidt algorithm           */  \
 /*  _A      : input matrix, [size: _r x _c]                             */  \
 /*  _r      : rows                                                      */  \
@@ -7865,6 +8294,19 @@ int MATRIX(_qrdecomp_gramschmidt)(T *          _a,                          \
 int MATRIX(_chol)(T *          _a,                                          \
                   unsigned int _n,                                          \
                   T *          _l);                                         \
+                                                                            \
+/* Solve \(\vec{A}\vec{X} = \vec{B}\) given the Cholesky factor         */  \
+/* \(\vec{L}\) of \(\vec{A}\) from chol()                               */  \
+/*  _l      : lower-triangular factor, [size: _n x _n]                  */  \
+/*  _n      : system dimension                                          */  \
+/*  _b      : right-hand side, [size: _n x _k]                          */  \
+/*  _k      : number of right-hand sides                                */  \
+/*  _x      : solution, [size: _n x _k], may be the same as _b          */  \
+int MATRIX(_cholsolve)(T *          _l,                                     \
+                       unsigned int _n,                                     \
+                       T *          _b,                                     \
+                       unsigned int _k,                                     \
+                       T *          _x);                                    \
 
 #define matrix_access(X,R,C,r,c) ((X)[(r)*(C)+(c)])
 
@@ -8249,6 +8691,41 @@ int MODEM(_demodulate_soft)(MODEM()         _q,                             \
                             unsigned int  * _s,                             \
                             unsigned char * _soft_bits);                    \
                                                                             \
+/* Modulate block of input symbols, dispatching on modulation scheme    */  \
+/* once per block                                                       */  \
+/*  _q  : modem object                                                  */  \
+/*  _s  : input symbols, 0 <= _s[i] <= M-1, [size: _n x 1]              */  \
+/*  _n  : number of symbols                                             */  \
+/*  _y  : output complex samples [size: _n x 1]                         */  \
+int MODEM(_modulate_block)(MODEM()        _q,                               \
+                           unsigned int * _s,                               \
+                           unsigned int   _n,                               \
+                           TC *           _y);                              \
+                                                                            \
+/* Demodulate block of input samples (hard decision). Linear schemes    */  \
+/* (PSK, QAM, ASK, APSK) slice all samples in a single pass; the        */  \
+/* demodulator state reflects the last sample.                          */  \
+/*  _q  : modem object                                                  */  \
+/*  _x  : input samples [size: _n x 1]                                  */  \
+/*  _n  : number of samples                                             */  \
+/*  _s  : output hard symbols [size: _n x 1]                            */  \
+int MODEM(_demodulate_block)(MODEM()        _q,                             \
+                             TC *           _x,                             \
+                             unsigned int   _n,                             \
+                             unsigned int * _s);                            \
+                                                                            \
+/* Demodulate block of input samples with soft bits output              */  \
+/*  _q          : modem object                                          */  \
+/*  _x          : input samples [size: _n x 1]                          */  \
+/*  _n          : number of samples                                     */  \
+/*  _s          : output hard symbols [size: _n x 1]                    */  \
+/*  _soft_bits  : output soft bits, [size: _n*log2(M) x 1]              */  \
+int MODEM(_demodulate_soft_block)(MODEM()         _q,                       \
+                                  TC *            _x,                       \
+                                  unsigned int    _n,                       \
+                                  unsigned int  * _s,                       \
+                                  unsigned char * _soft_bits);              \
+                                                                            \
 /* Get demodulator's estimated transmit sample                          */  \
 int MODEM(_get_demodulator_sample)(MODEM() _q,                              \
                                    TC *    _x_hat);                         \
@@ -8307,6 +8784,16 @@ int gmskdem_demodulate(gmskdem                _q,
                        liquid_float_complex * _y,
                        unsigned int *         _sym);
 
+// demodulate block of symbols
+//  _q      :   gmskdem object
+//  _y      :   input sample array, [size: _n*_k x 1]
+//  _n      :   number of symbols
+//  _sym    :   output symbols, [size: _n x 1]
+int gmskdem_demodulate_block(gmskdem                _q,
+                             liquid_float_complex * _y,
+                             unsigned int           _n,
+                             unsigned int *         _sym);
+
 //
 // continuous phase frequency-shift keying (CP-FSK) modems
 //
@@ -8419,6 +8906,23 @@ CPFSKDEM() CPFSKDEM(_create)(unsigned int _bps,                             \
                              float        _beta,                            \
                              int          _type);                           \
                                                                             \
+/* create coherent demodulator object. Rather than a discriminator,     */  \
+/* this uses a reduced-state sequence estimator over the CPM trellis,   */  \
+/* tracking phase and older symbols per survivor. This improves         */  \
+/* sensitivity but assumes carrier phase and symbol timing are known.   */  \
+/*  _bps    :   bits per symbol, _bps > 0                               */  \
+/*  _h      :   modulation index, _h > 0                                */  \
+/*  _k      :   samples/symbol, _k > 1, _k even                         */  \
+/*  _m      :   filter delay (symbols), _m > 0                          */  \
+/*  _beta   :   filter bandwidth parameter, _beta > 0                   */  \
+/*  _type   :   filter type (e.g. LIQUID_CPFSK_SQUARE)                  */  \
+CPFSKDEM() CPFSKDEM(_create_coherent)(unsigned int _bps,                    \
+                                      float        _h,                      \
+                                      unsigned int _k,                      \
+                                      unsigned int _m,                      \
+                                      float        _beta,                   \
+                                      int          _type);                  \
+                                                                            \
 /* create demodulator object for minimum-shift keying                   */  \
 /*  _k      : samples/symbol, _k > 1, _k even                           */  \
 CPFSKDEM() CPFSKDEM(_create_msk)(unsigned int _k);                          \
@@ -8467,7 +8971,15 @@ int CPFSKDEM(_get_type)(CPFSKDEM() _q);                                     \
 unsigned int CPFSKDEM(_demodulate)(CPFSKDEM() _q,                           \
                                    TC *       _y);                          \
                                                                             \
-/* demodulate_block */                                                      \
+/* demodulate block of symbols, assuming perfect timing                 */  \
+/*  _q      :   continuous-phase frequency demodulator object           */  \
+/*  _y      :   input sample array, [size: _n*_k x 1]                   */  \
+/*  _n      :   number of symbols                                       */  \
+/*  _s      :   output symbols, [size: _n x 1]                          */  \
+int CPFSKDEM(_demodulate_block)(CPFSKDEM()     _q,                          \
+                                TC *           _y,                          \
+                                unsigned int   _n,                          \
+                                unsigned int * _s);                         \
 
 // define cpfskmod APIs
 LIQUID_CPFSKDEM_DEFINE_API(LIQUID_CPFSKDEM_MANGLE_FLOAT,float,liquid_float_complex)
@@ -8532,12 +9044,54 @@ int fskdem_print(fskdem _q);
 // reset state
 int fskdem_reset(fskdem _q);
 
+// Enable/disable pruned transform. When enabled, the demodulator
+// correlates each symbol against only the M tone frequencies rather
+// than computing the full K-point FFT. This is selected automatically
+// at creation when cheaper than the full transform (small M, large k).
+//  _q      :   fskdem object
+//  _pruned :   use pruned transform (1) or full FFT (0)
+int fskdem_set_pruned(fskdem _q,
+                      int    _pruned);
+
+// get flag indicating if pruned transform is used
+int fskdem_get_pruned(fskdem _q);
+
 // demodulate symbol, assuming perfect symbol timing
 //  _q      :   fskdem object
 //  _y      :   input sample array, [size: _k x 1]
 unsigned int fskdem_demodulate(fskdem                 _q,
                                liquid_float_complex * _y);
 
+// demodulate block of symbols, assuming perfect symbol timing
+//  _q      :   fskdem object
+//  _y      :   input sample array, [size: _n*_k x 1]
+//  _n      :   number of symbols
+//  _s      :   output symbols, [size: _n x 1]
+int fskdem_demodulate_block(fskdem                 _q,
+                            liquid_float_complex * _y,
+                            unsigned int           _n,
+                            unsigned int *         _s);
+
+// demodulate block of symbols with soft outputs, assuming perfect
+// symbol timing; the energy of each of the M tones is written for
+// every symbol
+//  _q      :   fskdem object
+//  _y      :   input sample array, [size: _n*_k x 1]
+//  _n      :   number of symbols
+//  _s      :   output symbols, [size: _n x 1]
+//  _energy :   output tone energies (ignored if NULL), [size: _n*M x 1]
+int fskdem_demodulate_soft_block(fskdem                 _q,
+                                 liquid_float_complex * _y,
+                                 unsigned int           _n,
+                                 unsigned int *         _s,
+                                 float *                _energy);
+
+// get energy of each tone for last demodulated symbol
+//  _q      :   fskdem object
+//  _energy :   output tone energies, [size: M x 1]
+int fskdem_get_tone_energy(fskdem  _q,
+                           float * _energy);
+
 // get demodulator frequency error
 float fskdem_get_frequency_error(fskdem _q);
 
@@ -8615,6 +9169,9 @@ typedef struct FREQDEM(_s) * FREQDEM();                                     \
 /*  _kf      :   modulation factor                                      */  \
 FREQDEM() FREQDEM(_create)(float _kf);                                      \
                                                                             \
+/* Copy object including all internal objects and state                 */  \
+FREQDEM() FREQDEM(_copy)(FREQDEM() _q);                                     \
+                                                                            \
 /* Destroy freqdem object                                               */  \
 int FREQDEM(_destroy)(FREQDEM() _q);                                        \
                                                                             \
@@ -8632,6 +9189,24 @@ int FREQDEM(_demodulate)(FREQDEM() _q,                                      \
                          TC        _r,                                      \
                          T *       _m);                                     \
                                                                             \
+/* Set arctangent approximation used by block demodulation. The         */  \
+/* vectorized arctangent (see liquid_vatan2f) replaces the exact one;   */  \
+/* 2 to 4 terms select its fast tier (peak phase error near 1e-4        */  \
+/* radians) and 5 to 7 terms (default) its precise tier (near 1e-6      */  \
+/* radians). Setting _terms to 0 selects the exact, sample-by-sample    */  \
+/* demodulator.                                                         */  \
+/*  _q      :   frequency demodulator object                            */  \
+/*  _terms  :   number of polynomial terms, 0 or in [2,7]               */  \
+int FREQDEM(_set_atan_terms)(FREQDEM()    _q,                               \
+                             unsigned int _terms);                          \
+                                                                            \
+/* Get number of arctangent polynomial terms used by block demodulation */  \
+unsigned int FREQDEM(_get_atan_terms)(FREQDEM() _q);                        \
+                                                                            \
+/* Get bound on the absolute difference between the output of block     */  \
+/* and sample-by-sample demodulation for the current configuration      */  \
+float FREQDEM(_get_block_error)(FREQDEM() _q);                              \
+                                                                            \
 /* Demodulate block of samples                                          */  \
 /*  _q      :   frequency demodulator object                            */  \
 /*  _r      :   received signal r(t) [size: _n x 1]                     */  \
@@ -9343,6 +9918,30 @@ typedef float (*utility_function)(void *       _userdata,
                                   float *      _v,
                                   unsigned int _n);
 
+// batched utility function pointer definition, evaluating utility at
+// several points in a single call
+//  _userdata   :   user-defined data structure
+//  _v          :   input points, one per row, [size: _k x _n]
+//  _n          :   input vector size
+//  _k          :   number of points
+//  _u          :   output utilities, [size: _k x 1]
+typedef int (*utility_function_batch)(void *       _userdata,
+                                      float *      _v,
+                                      unsigned int _n,
+                                      unsigned int _k,
+                                      float *      _u);
+
+// gradient function pointer definition, computing the gradient of the
+// utility function analytically
+//  _userdata   :   user-defined data structure
+//  _v          :   input vector, [size: _n x 1]
+//  _n          :   input vector size
+//  _gradient   :   output gradient of utility, [size: _n x 1]
+typedef int (*gradient_function)(void *       _userdata,
+                                 float *      _v,
+                                 unsigned int _n,
+                                 float *      _gradient);
+
 // One-dimensional utility function pointer definition
 typedef float (*liquid_utility_1d)(float  _v,
                                    void * _userdata);
@@ -9415,6 +10014,27 @@ float gradsearch_execute(gradsearch   _q,
                          unsigned int _max_iterations,
                          float        _target_utility);
 
+// Set batched utility function used to evaluate finite-difference
+// gradients, e.g. to distribute evaluations across processors
+//  _q          :   gradient search object
+//  _batch      :   batched utility function (NULL to disable)
+int gradsearch_set_batch(gradsearch             _q,
+                         utility_function_batch _batch);
+
+// Set analytic gradient function, replacing finite differences
+//  _q          :   gradient search object
+//  _gradient   :   gradient function (NULL to disable)
+int gradsearch_set_gradient(gradsearch        _q,
+                            gradient_function _gradient);
+
+// Set number of threads evaluating finite-difference gradients with the
+// utility function (if no batched function is set); the utility must be
+// thread-safe for more than one worker
+//  _q          :   gradient search object
+//  _num_workers:   number of worker threads
+int gradsearch_set_workers(gradsearch   _q,
+                           unsigned int _num_workers);
+
 
 // Quadsection search in one dimension...
 //  
@@ -9476,6 +10096,21 @@ float qnsearch_execute(qnsearch _g,
                        unsigned int _max_iterations,
                        float _target_utility);
 
+// Set batched utility function used to evaluate finite-difference
+// gradient and Hessian estimates
+int qnsearch_set_batch(qnsearch               _g,
+                       utility_function_batch _batch);
+
+// Set analytic gradient function; gradient is then computed directly and
+// Hessian from differences of gradients
+int qnsearch_set_gradient(qnsearch          _g,
+                          gradient_function _gradient);
+
+// Set number of threads evaluating finite-difference estimates with the
+// utility function (if no batched function is set)
+int qnsearch_set_workers(qnsearch     _g,
+                         unsigned int _num_workers);
+
 //
 // chromosome (for genetic algorithm search)
 //
@@ -9607,6 +10242,46 @@ int gasearch_getopt(gasearch   _q,
                     chromosome _c,
                     float *    _utility_opt);
 
+// user data clone callback for parallel evaluation; the worker index
+// may be used to seed an independent random stream for each worker
+typedef void * (*gasearch_userdata_clone)(void * _userdata, unsigned int _worker);
+
+// user data destroy callback for parallel evaluation
+typedef void (*gasearch_userdata_destroy)(void * _userdata);
+
+// Set number of workers evaluating the utility function. Each worker
+// evaluates a fixed subset of the population (index modulo number of
+// workers) on its own thread (if available) with its own user data
+// clone, so results do not depend on thread scheduling. If _clone is
+// NULL the user data is shared and the utility must be thread-safe.
+// Note that rand() and the liquid random functions built upon it are
+// not thread-safe.
+//  _q              :   ga search object
+//  _num_workers    :   number of workers, 1 for sequential evaluation
+//  _clone          :   user data clone callback (NULL to share)
+//  _destroy        :   user data destroy callback (NULL to ignore)
+int gasearch_set_workers(gasearch                  _q,
+                         unsigned int              _num_workers,
+                         gasearch_userdata_clone   _clone,
+                         gasearch_userdata_destroy _destroy);
+
+// Seed internal random number generator used for crossover, mutation,
+// and random chromosomes; by default it is seeded from rand() when the
+// object is created
+//  _q              :   ga search object
+//  _seed           :   generator seed
+int gasearch_set_seed(gasearch     _q,
+                      unsigned int _seed);
+
+// Enable/disable caching of utility values, skipping evaluation of
+// chromosomes unchanged since the previous generation (the elite). This
+// should be disabled for noisy utilities which benefit from being
+// re-evaluated.
+//  _q              :   ga search object
+//  _cache          :   enable (1) or disable (0) caching
+int gasearch_set_cache(gasearch _q,
+                       int      _cache);
+
 //
 // MODULE : quantization
 //
@@ -10104,6 +10779,62 @@ int liquid_get_scale(float   _val,
                      char *  _unit,
                      float * _scale);
 
+//
+// Profiling: counters for calls, samples processed and cumulative
+// cycles of each object instance, collected in a global registry.
+// Instrumentation is only compiled in when the library is configured
+// with --enable-profiling; otherwise it is removed entirely and the
+// methods below report no objects. Instrumented objects: firfilt,
+// resamp, fftplan, framesync64, flexframesync.
+//
+
+// profiling statistics of an object instance or of all instances of
+// an object type
+typedef struct {
+    const char *       type;            // object type, e.g. "firfilt_crcf"
+    unsigned long int  id;              // instance id (0 for type totals)
+    unsigned int       num_instances;   // instances created (type totals)
+    unsigned long long num_calls;       // calls to instrumented methods
+    unsigned long long num_samples;     // samples processed
+    unsigned long long num_cycles;      // cumulative cycles (time-stamp
+                                        // counter on x86, ns otherwise)
+} liquid_profile_s;
+
+// callback for exporting profiling statistics
+//  _stats      :   statistics of instance or type
+//  _userdata   :   user-defined data pointer
+typedef int (*liquid_profile_callback)(const liquid_profile_s * _stats,
+                                       void *                   _userdata);
+
+// is profiling compiled into the library?
+int liquid_profile_is_enabled(void);
+
+// reset counters of all instances and types
+int liquid_profile_reset(void);
+
+// get totals of all instances of object type, including destroyed
+// instances; returns LIQUID_EIVAL if no instance has been created
+//  _type   :   object type, e.g. "firfilt_crcf"
+//  _stats  :   output statistics
+int liquid_profile_get(const char *       _type,
+                       liquid_profile_s * _stats);
+
+// invoke callback with statistics of each live object instance
+int liquid_profile_foreach(liquid_profile_callback _callback,
+                           void *                  _userdata);
+
+// invoke callback with totals of each object type
+int liquid_profile_foreach_type(liquid_profile_callback _callback,
+                                void *                  _userdata);
+
+// set callback invoked with final statistics of each instance when it
+// is destroyed, e.g. to export to a telemetry system (NULL to disable)
+int liquid_profile_set_callback(liquid_profile_callback _callback,
+                                void *                  _userdata);
+
+// write statistics of all types and live instances as JSON
+int liquid_profile_print_json(FILE * _fid);
+
 //
 // MODULE : vector
 //
@@ -105,6 +105,12 @@ unsigned int crc16_generate_key(unsigned char * _msg, unsigned int _msg_len);
 unsigned int crc24_generate_key(unsigned char * _msg, unsigned int _msg_len);
 unsigned int crc32_generate_key(unsigned char * _msg, unsigned int _msg_len);
 
+// byte-wise look-up tables for cyclic redundancy checks
+extern const unsigned int crc8_gentab[256];
+extern const unsigned int crc16_gentab[256];
+extern const unsigned int crc24_gentab[256];
+extern const unsigned int crc32_gentab[256];
+
 
 // fec : basic object
 struct fec_s {
@@ -145,18 +151,31 @@ struct fec_s {
     unsigned int rspad; // number of implicit padded symbols
     int nn;         // 2^symsize - 1
     int kk;         // nn - nroots
-    void * rs;      // Reed-Solomon internal object
+    void * rs;      // Reed-Solomon internal codec tables
 
-    // Reed-Solomon decoder
+    // Reed-Solomon block layout
     unsigned int num_blocks;    // number of blocks: ceil(dec_msg_len / nn)
     unsigned int dec_block_len; // number of decoded bytes per block: 
     unsigned int enc_block_len; // number of encoded bytes per block: 
     unsigned int res_block_len; // residual bytes in last block
     unsigned int pad;           // padding for each block
-    unsigned char * tblock;     // decoder input sequence, [size: 1 x n]
-    int * errlocs;              // error locations, [size: 1 x n]
-    int * derrlocs;             // decoded error locations, [size: 1 x n]
-    int erasures;               // number of erasures
+    unsigned char * tblock;     // encoder shift register, [size: 1 x (n+1)]
+
+    // LDPC (quasi-cyclic, layered min-sum decoding)
+    const short *   ldpc_Hb;    // base matrix shifts at maximum lifting size, -1 for zero block
+    unsigned int    ldpc_mb;    // number of rows in base matrix
+    unsigned int    ldpc_kb;    // number of information columns in base matrix
+    unsigned int    ldpc_z;     // lifting size for current message length
+    unsigned int    ldpc_nnz;   // number of non-zero blocks in base matrix
+    unsigned int    ldpc_dmax;  // maximum base matrix row degree
+    unsigned int *  ldpc_row;   // start of each base row in edge list, [size: mb+1 x 1]
+    unsigned int *  ldpc_col;   // edge base column, [size: nnz x 1]
+    unsigned int *  ldpc_shift; // edge cyclic shift at current lifting size, [size: nnz x 1]
+    short *         ldpc_L;     // posterior log-likelihood ratios, [size: nb*z x 1]
+    signed char *   ldpc_R;     // check-to-variable messages, [size: nnz*z x 1]
+    short *         ldpc_Q;     // layer working buffer, [size: (dmax+5)*z x 1]
+    unsigned char * ldpc_bits;  // codeword bits, [size: nb*z x 1]
+    unsigned int    ldpc_max_iterations;
 
     // encode function pointer
     int (*encode_func)(fec _q,
@@ -183,6 +202,7 @@ int fec_scheme_is_punctured(fec_scheme _scheme);
 int fec_scheme_is_reedsolomon(fec_scheme _scheme);
 int fec_scheme_is_hamming(fec_scheme _scheme);
 int fec_scheme_is_repeat(fec_scheme _scheme);
+int fec_scheme_is_ldpc(fec_scheme _scheme);
 
 // Pass
 fec fec_pass_create(void *_opts);
@@ -593,6 +613,51 @@ int fec_rs_decode(fec _q,
                   unsigned int _dec_msg_len,
                   unsigned char * _msg_enc,
                   unsigned char * _msg_dec);
+int fec_rs_encode_block(fec _q,
+                        unsigned char * _data,
+                        unsigned char * _parity);
+int fec_rs_decode_block(fec _q,
+                        unsigned char * _r,
+                        unsigned char * _data,
+                        unsigned int _num_data);
+
+// LDPC
+
+// compute encoded message length for LDPC codes
+//  _dec_msg_len    :   decoded message length (bytes)
+//  _mb             :   number of rows in base matrix
+unsigned int fec_ldpc_get_enc_msg_len(unsigned int _dec_msg_len,
+                                      unsigned int _mb);
+
+fec fec_ldpc_create(fec_scheme _fs);
+int fec_ldpc_destroy(fec _q);
+int fec_ldpc_setlength(fec _q,
+                       unsigned int _dec_msg_len);
+int fec_ldpc_encode(fec _q,
+                    unsigned int _dec_msg_len,
+                    unsigned char * _msg_dec,
+                    unsigned char * _msg_enc);
+int fec_ldpc_decode_hard(fec _q,
+                         unsigned int _dec_msg_len,
+                         unsigned char * _msg_enc,
+                         unsigned char * _msg_dec);
+int fec_ldpc_decode_soft(fec _q,
+                         unsigned int _dec_msg_len,
+                         unsigned char * _msg_enc,
+                         unsigned char * _msg_dec);
+
+// encode block of information bits in place, computing parity bits
+//  _q      :   fec object
+//  _v      :   codeword bits, information bits set on input [size: nb*z x 1]
+int fec_ldpc_encode_block(fec _q,
+                          unsigned char * _v);
+
+// decode block using layered normalized min-sum, returning 1 if all parity
+// checks are satisfied, 0 otherwise
+//  _q      :   fec object
+//  _L      :   channel log-likelihood ratios (positive for '0') [size: nb*z x 1]
+int fec_ldpc_decode_block(fec _q,
+                          short * _L);
 
 // phi(x) = -logf( tanhf( x/2 ) )
 float sumproduct_phi(float _x);
@@ -675,6 +740,7 @@ typedef int (FFT(_destroy_t))(FFT(plan) _q);                    \
 typedef int (FFT(_execute_t))(FFT(plan) _q);                    \
                                                                 \
 /* FFT create methods */                                        \
+FFT(_create_t) FFT(_create_plan_method);                        \
 FFT(_create_t) FFT(_create_plan_dft);                           \
 FFT(_create_t) FFT(_create_plan_radix2);                        \
 FFT(_create_t) FFT(_create_plan_mixed_radix);                   \
@@ -784,6 +850,51 @@ float estimate_req_filter_len_Herrmann(float _df,
                                        float _as);
 
 
+// filter design cache identifiers
+typedef enum {
+    LIQUID_DESIGN_CACHE_KAISER=0,   // liquid_firdes_kaiser()
+    LIQUID_DESIGN_CACHE_PROTOTYPE,  // liquid_firdes_prototype()
+    LIQUID_DESIGN_CACHE_FIRDESPM,   // firdespm_run()
+    LIQUID_DESIGN_CACHE_IIRDES,     // liquid_iirdes()
+} liquid_design_cache_id;
+
+// look up filter design in cache, returning 1 (and copying coefficients
+// to _v) on hit, 0 on miss or if cache is disabled
+//  _id         :   design function identifier
+//  _key        :   design parameters
+//  _key_len    :   length of _key (bytes)
+//  _v          :   output coefficients [size: _n x 1]
+//  _n          :   number of coefficients
+int liquid_design_cache_lookup(int          _id,
+                               const void * _key,
+                               unsigned int _key_len,
+                               float *      _v,
+                               unsigned int _n);
+
+// insert filter design into cache (ignored if cache is disabled)
+int liquid_design_cache_insert(int           _id,
+                               const void *  _key,
+                               unsigned int  _key_len,
+                               const float * _v,
+                               unsigned int  _n);
+
+// design functions which bypass the cache, used by iterative designs so
+// that intermediate trials are neither stored nor counted as misses;
+// see liquid_firdes_kaiser() and firdespm_run() for arguments
+int liquid_firdes_kaiser_uncached(unsigned int _n,
+                                  float        _fc,
+                                  float        _as,
+                                  float        _mu,
+                                  float *      _h);
+int firdespm_run_uncached(unsigned int            _h_len,
+                          unsigned int            _num_bands,
+                          float *                 _bands,
+                          float *                 _des,
+                          float *                 _weights,
+                          liquid_firdespm_wtype * _wtype,
+                          liquid_firdespm_btype   _btype,
+                          float *                 _h);
+
 // firdes : finite impulse response filter design
 
 // Find approximate bandwidth adjustment factor rho based on
@@ -1001,6 +1112,89 @@ void bpacketgen_assemble_header(bpacketgen _q);
 #define DSSSFRAME_H_FEC0         (LIQUID_FEC_GOLAY2412)
 #define DSSSFRAME_H_FEC1         (LIQUID_FEC_NONE)
 
+//
+// segcorr : segmented correlator for coarse frequency search; partial
+//           correlations over short segments of the sequence are
+//           transformed with an FFT across segments, evaluating all
+//           frequency hypotheses at once
+//
+
+typedef struct segcorr_s * segcorr;
+
+// create segmented correlator
+//  _v          :   baseband sequence, [size: _n x 1]
+//  _n          :   baseband sequence length, _n > 0
+//  _dphi_max   :   maximum absolute frequency deviation, _dphi_max >= 0
+segcorr segcorr_create(float complex * _v,
+                       unsigned int    _n,
+                       float           _dphi_max);
+
+// destroy object
+int segcorr_destroy(segcorr _q);
+
+// print object
+int segcorr_print(segcorr _q);
+
+// correlate received buffer against sequence over all frequency hypotheses
+// within +/- _dphi_max, returning peak correlation and frequency estimate
+//  _q          :   segmented correlator
+//  _r          :   received samples, oldest first, [size: _n x 1]
+//  _rxy        :   output cross correlation (normalized by _n)
+//  _dphi_hat   :   output frequency offset estimate
+int segcorr_execute(segcorr         _q,
+                    float complex * _r,
+                    float complex * _rxy,
+                    float *         _dphi_hat);
+
+//
+// framesync batch : offline frame search over a stored capture
+//
+
+// number of samples prepended to each chunk (in addition to the maximum
+// frame length) so the detector has settled before the owned region
+#define FRAMESYNC_BATCH_WARMUP (1024)
+
+// create worker synchronizer from template, invoking _callback on frames
+typedef void * (*framesync_batch_create_fcn)(void *             _template,
+                                             framesync_callback _callback,
+                                             void *             _userdata);
+
+// push samples through worker synchronizer
+typedef int (*framesync_batch_execute_fcn)(void *          _q,
+                                           float complex * _x,
+                                           unsigned int    _n);
+
+// destroy worker synchronizer
+typedef int (*framesync_batch_destroy_fcn)(void * _q);
+
+// run frame search over capture split into overlapping chunks; frames
+// are owned by the chunk in which they complete, de-duplicated by sample
+// index, and delivered to _callback in sample order
+//  _template       :   synchronizer object used as configuration template
+//  _create         :   worker create method
+//  _execute        :   worker execute method
+//  _destroy        :   worker destroy method
+//  _header_len     :   length of decoded header passed to callback (bytes)
+//  _max_frame_len  :   maximum frame length (samples)
+//  _min_spacing    :   minimum spacing between frame ends (samples)
+//  _callback       :   user callback
+//  _userdata       :   user data passed to callback
+//  _x              :   input samples, [size: _n x 1]
+//  _n              :   number of input samples
+//  _num_workers    :   number of worker threads
+int framesync_batch_execute(void *                      _template,
+                            framesync_batch_create_fcn  _create,
+                            framesync_batch_execute_fcn _execute,
+                            framesync_batch_destroy_fcn _destroy,
+                            unsigned int                _header_len,
+                            unsigned int                _max_frame_len,
+                            unsigned int                _min_spacing,
+                            framesync_callback          _callback,
+                            void *                      _userdata,
+                            float complex *             _x,
+                            unsigned int                _n,
+                            unsigned int                _num_workers);
+
 //
 // multi-signal source for testing (no meaningful data, just signals)
 //
@@ -1120,6 +1314,26 @@ void  liquid_sincosf(float _x,
 float liquid_expf(float _x);
 float liquid_logf(float _x);
 
+//
+// vectorized math kernels with input/output strides
+//
+
+// sine and cosine, e.g. _sin = _cos + 1 with stride 2 for complex output
+int liquid_vsincosf_strided(const float * _x,
+                            unsigned int  _n,
+                            float *       _sin,
+                            float *       _cos,
+                            unsigned int  _stride,
+                            int           _tier);
+
+// four-quadrant arctangent, e.g. _y = _x + 1 with stride 2 for complex input
+int liquid_vatan2f_strided(const float * _y,
+                           const float * _x,
+                           unsigned int  _stride,
+                           unsigned int  _n,
+                           float *       _theta,
+                           int           _tier);
+
 // 
 // complex math operations
 //
@@ -1193,13 +1407,41 @@ int liquid_poly_sort_roots_compare(const void * _a,
 // MODULE : matrix
 //
 
+// operand options for internal matrix multiply
+#define LIQUID_MATRIX_GEMM_N        (0)     // use operand as is
+#define LIQUID_MATRIX_GEMM_T        (1)     // transpose
+#define LIQUID_MATRIX_GEMM_H        (2)     // Hermitian (conjugate) transpose
+
+// output options for internal matrix multiply
+#define LIQUID_MATRIX_GEMM_SUB      (1<<0)  // subtract product from output
+#define LIQUID_MATRIX_GEMM_LOWER    (1<<1)  // lower triangle of output only
+
 // large macro
 //   MATRIX : name-mangling macro
 //   T      : data type
 #define LIQUID_MATRIX_DEFINE_INTERNAL_API(MATRIX,T)             \
 T    MATRIX(_det2x2)(T * _x,                                    \
                      unsigned int _rx,                          \
-                     unsigned int _cx);
+                     unsigned int _cx);                         \
+                                                                \
+/* blocked multiply on row-major operands with leading    */    \
+/* dimensions _lda, _ldb, _ldc: C = op(A)*op(B), or       */    \
+/* C -= op(A)*op(B) with LIQUID_MATRIX_GEMM_SUB           */    \
+/*  _m, _n, _k : rows of C, columns of C, inner size      */    \
+/*  _opa, _opb : operand option, LIQUID_MATRIX_GEMM_N/T/H */    \
+/*  _flags     : output options                           */    \
+int  MATRIX(_gemm)(unsigned int _m,                             \
+                   unsigned int _n,                             \
+                   unsigned int _k,                             \
+                   T *          _a,                             \
+                   unsigned int _lda,                           \
+                   int          _opa,                           \
+                   T *          _b,                             \
+                   unsigned int _ldb,                           \
+                   int          _opb,                           \
+                   T *          _c,                             \
+                   unsigned int _ldc,                           \
+                   int          _flags);
 
 
 LIQUID_MATRIX_DEFINE_INTERNAL_API(LIQUID_MATRIX_MANGLE_FLOAT,   float)
@@ -1336,6 +1578,20 @@ int MODEM(_demodulate_sqam32) ( MODEM(), TC, unsigned int *);   \
 int MODEM(_demodulate_sqam128)( MODEM(), TC, unsigned int *);   \
 int MODEM(_demodulate_pi4dqpsk)(MODEM(), TC, unsigned int *);   \
                                                                 \
+/* modem block demodulate routines */                           \
+int MODEM(_demodulate_block_ask) (MODEM(), TC *, unsigned int,  \
+                                  unsigned int *);              \
+int MODEM(_demodulate_block_qam) (MODEM(), TC *, unsigned int,  \
+                                  unsigned int *);              \
+int MODEM(_demodulate_block_psk) (MODEM(), TC *, unsigned int,  \
+                                  unsigned int *);              \
+int MODEM(_demodulate_block_apsk)(MODEM(), TC *, unsigned int,  \
+                                  unsigned int *);              \
+int MODEM(_demodulate_block_bpsk)(MODEM(), TC *, unsigned int,  \
+                                  unsigned int *);              \
+int MODEM(_demodulate_block_qpsk)(MODEM(), TC *, unsigned int,  \
+                                  unsigned int *);              \
+                                                                \
 /* modem demodulate (soft) routines */                          \
 int MODEM(_demodulate_soft_bpsk)(MODEM()         _q,            \
                                  TC              _x,            \
@@ -1377,6 +1633,21 @@ int MODEM(_demodulate_linear_array_ref)(T              _v,      \
                                         T *            _ref,    \
                                         unsigned int * _s,      \
                                         T *            _res);   \
+                                                                \
+/* Demodulate block of values on a linearly-spaced array    */  \
+/* by successive approximation, matching array_ref exactly  */  \
+/*  _v      :   input values [stride: _stride]  */              \
+/*  _stride :   input stride                    */              \
+/*  _n      :   number of values                */              \
+/*  _m      :   bits per symbol                 */              \
+/*  _ref    :   array of thresholds [size: _m]  */              \
+/*  _k      :   output indices (Gray decoded)   */              \
+int MODEM(_demodulate_linear_block)(const T *      _v,          \
+                                    unsigned int   _stride,     \
+                                    unsigned int   _n,          \
+                                    unsigned int   _m,          \
+                                    const T *      _ref,        \
+                                    unsigned int * _k);         \
 
 
 
@@ -1488,6 +1759,45 @@ int optim_threshold_switch(float _u0,
                            float _u1,
                            int _minimize);
 
+// utility evaluator shared by gradient-based search methods
+struct optim_eval_s {
+    utility_function       utility;     // utility function
+    utility_function_batch batch;       // batched utility function (optional)
+    gradient_function      gradient;    // analytic gradient (optional)
+    void *                 userdata;    // user data passed to callbacks
+    unsigned int           num_workers; // threads for utility evaluation
+};
+
+// evaluate utility at multiple points, using batched function if set,
+// otherwise utility function on worker threads (if available)
+//  _e          :   utility evaluator
+//  _v          :   input points, one per row, [size: _k x _n]
+//  _n          :   dimensionality of search
+//  _k          :   number of points
+//  _u          :   output utilities, [size: _k x 1]
+int optim_eval_batch(struct optim_eval_s * _e,
+                     float *               _v,
+                     unsigned int          _n,
+                     unsigned int          _k,
+                     float *               _u);
+
+// compute gradient at a particular point using analytic gradient if set,
+// otherwise forward differences evaluated as a single batch
+//  _e          :   utility evaluator
+//  _x          :   operating point, [size: _n x 1]
+//  _n          :   dimensionality of search
+//  _u0         :   utility at operating point
+//  _delta      :   step value for which to compute gradient
+//  _work       :   scratch memory for finite-difference points, [size: _n x _n]
+//  _gradient   :   resulting gradient, [size: _n x 1]
+int optim_eval_gradient(struct optim_eval_s * _e,
+                        float *               _x,
+                        unsigned int          _n,
+                        float                 _u0,
+                        float                 _delta,
+                        float *               _work,
+                        float *               _gradient);
+
 // compute the gradient of a function at a particular point
 //  _utility    :   user-defined function
 //  _userdata   :   user-defined data object
@@ -1566,6 +1876,16 @@ struct gasearch_s {
     gasearch_utility get_utility;       // utility function pointer
     void * userdata;                    // object to optimize
     int minimize;                       // minimize/maximize utility (search direction)
+
+    // parallel evaluation
+    unsigned int num_workers;           // number of workers evaluating utility
+    gasearch_userdata_clone   clone;    // user data clone callback (NULL to share)
+    gasearch_userdata_destroy destroy;  // user data destroy callback
+    void ** worker_userdata;            // per-worker user data [size: num_workers x 1]
+
+    unsigned int rng_state;             // internal random number generator state
+    int cache;                          // skip evaluating unchanged chromosomes?
+    unsigned char * dirty;              // chromosome changed since evaluation
 };
 
 //
@@ -1584,6 +1904,17 @@ int gasearch_mutate(gasearch _q);
 // rank population by fitness
 int gasearch_rank(gasearch _q);
 
+// evaluate fitness of chromosomes assigned to worker (index modulo
+// number of workers) using the worker's user data
+int gasearch_evaluate_worker(gasearch _q, unsigned int _worker);
+
+// internal random number generators (xorshift), independent of rand()
+unsigned int gasearch_rand (gasearch _q);
+float        gasearch_randf(gasearch _q);
+
+// initialize chromosome with random values from internal generator
+int gasearch_init_random(gasearch _q, chromosome _c);
+
 // sort values by index
 //  _v          :   input values, [size: _len x 1]
 //  _rank       :   output rank array (indices) [size: _len x 1]
@@ -1621,6 +1952,47 @@ float randgammaf_delta(float _delta);
 // MODULE : utility
 //
 
+// Profiling hooks (see liquid_profile_* in liquid.h). Instrumented
+// objects declare LIQUID_PROFILE_MEMBER in their struct, register with
+// LIQUID_PROFILE_CREATE() when created or copied, unregister with
+// LIQUID_PROFILE_DESTROY(), and bracket processing methods with
+// LIQUID_PROFILE_BEGIN()/LIQUID_PROFILE_END(). Nested instrumented calls
+// on the same object (e.g. execute_block calling execute) are counted
+// once. Without LIQUID_PROFILE all hooks expand to nothing.
+#if LIQUID_PROFILE
+typedef struct liquid_profile_node_s * liquid_profile_node;
+
+// register new instance of object type (_type must be a string literal)
+liquid_profile_node liquid_profile_register(const char * _type);
+
+// unregister instance, accumulating its counters into the type totals
+void liquid_profile_unregister(liquid_profile_node _q);
+
+// start measurement, returning start time (NULL node is ignored)
+unsigned long long liquid_profile_begin(liquid_profile_node _q);
+
+// end measurement, recording one call processing _num_samples samples
+void liquid_profile_end(liquid_profile_node _q,
+                        unsigned long long  _t0,
+                        unsigned long long  _num_samples);
+
+#  define LIQUID_PROFILE_STR(s)         #s
+#  define LIQUID_PROFILE_TYPE(s)        LIQUID_PROFILE_STR(s)
+#  define LIQUID_PROFILE_MEMBER         liquid_profile_node profile;
+#  define LIQUID_PROFILE_CREATE(q,type) (q)->profile = liquid_profile_register(type)
+#  define LIQUID_PROFILE_CLEAR(q)       (q)->profile = NULL
+#  define LIQUID_PROFILE_DESTROY(q)     liquid_profile_unregister((q)->profile)
+#  define LIQUID_PROFILE_BEGIN(q)       unsigned long long liquid_profile_t0 = liquid_profile_begin((q)->profile)
+#  define LIQUID_PROFILE_END(q,n)       liquid_profile_end((q)->profile, liquid_profile_t0, (n))
+#else
+#  define LIQUID_PROFILE_MEMBER
+#  define LIQUID_PROFILE_CREATE(q,type) do {} while (0)
+#  define LIQUID_PROFILE_CLEAR(q)       do {} while (0)
+#  define LIQUID_PROFILE_DESTROY(q)     do {} while (0)
+#  define LIQUID_PROFILE_BEGIN(q)       do {} while (0)
+#  define LIQUID_PROFILE_END(q,n)       do {} while (0)
+#endif
+
 // number of ones in a byte
 //  0   0000 0000   :   0
 //  1   0000 0001   :   1
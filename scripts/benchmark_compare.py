@@ -18,14 +18,23 @@ b0 = {v['name']:v for v in v0['benchmarks']}
 b1 = {v['name']:v for v in v1['benchmarks']}
 set_common = set(b0.keys()).intersection(set(b1.keys()))
 
-# iterate over common benchmarks and print results
-for key in set_common:
+# iterate over common benchmarks and print results; when both files contain
+# repeated runs (-r option) the median time per trial is compared and the
+# change is labelled only when the 95% confidence intervals of the medians
+# do not overlap; otherwise the unlabelled rate ratio is printed as before
+for key in sorted(set_common):
     r0,r1 = b0[key], b1[key]
     if 0 in (r0['trials'],r1['trials']):
         continue
-    rate = r1['rate'] / r0['rate']
+    if 'time_median' in r0 and 'time_median' in r1 and r1['time_median'] > 0:
+        rate = r0['time_median'] / r1['time_median']
+        ci0, ci1 = r0['time_ci95'], r1['time_ci95']
+        significant = ci1[1] < ci0[0] or ci1[0] > ci0[1]
+        status = '' if not significant else (' improvement' if rate > 1 else ' REGRESSION')
+    else:
+        rate = r1['rate'] / r0['rate']
+        status = ''
     if np.exp(np.abs(np.log(rate))) < args.thresh:
         continue
 
-    print(' %32s, rate = %12.8f' % (key, rate))
-
+    print(' %32s, rate = %12.8f%s' % (key, rate, status))
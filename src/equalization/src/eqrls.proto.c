@@ -21,44 +21,99 @@
  */
 
 // Recursive least-squares (RLS) equalizer
+//
+// The update can be computed with one of several algorithms, selected
+// when the object is created:
+//  conventional : propagates the inverse correlation matrix P, O(p^2)
+//  inverse QR   : propagates the lower-triangular square root of P with
+//                 Givens rotations, O(p^2) but numerically robust
+//  FTF          : stabilized fast transversal filter (Slock & Kailath)
+//                 using forward/backward prediction, O(p)
+//
+// All algorithms minimize the same exponentially-weighted cost with the
+// equalizer output computed as y = w^T x and the gain k = P conj(x)/zeta.
 
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
+#include <math.h>
 
 //#define DEBUG
 
+#if T_COMPLEX
+#  define EQRLS_CONJ(X)     conjf(X)
+#  define EQRLS_ABS2(X)     (crealf(X)*crealf(X) + cimagf(X)*cimagf(X))
+#else
+#  define EQRLS_CONJ(X)     (X)
+#  define EQRLS_ABS2(X)     ((X)*(X))
+#endif
+
+// FTF stabilization constants for mixing the two computations of the
+// backward prediction error (Slock & Kailath)
+#define EQRLS_FTF_K1        (1.5f)
+#define EQRLS_FTF_K2        (2.5f)
+
+// FTF rescue tolerance on invariant [gamma zf / (lambda^p zb) = 1]
+#define EQRLS_FTF_TOL       (0.5f)
+
 struct EQRLS(_s) {
     unsigned int p;     // filter order
     float lambda;       // RLS forgetting factor
     float delta;        // RLS initialization factor
+    liquid_eqrls_alg alg; // update algorithm
 
     // internal matrices
     T * h0;             // initial coefficients
-    T * w0, * w1;       // weights [px1]
-    T * P0, * P1;       // recursion matrix [pxp]
-    T * g;              // gain vector [px1]
+    T * w0;             // weights [px1]
+    T * P0;             // recursion matrix [pxp] (conventional), or
+                        // square root of recursion matrix (inverse QR)
+    T * g;              // gain vector [(p+1)x1]
 
     // temporary matrices
     T * xP0;            // [1xp]
     T zeta;             // constant
 
-    T * gxl;            // [pxp]
-    T * gxlP0;          // [pxp]
+    // fast transversal filter state
+    T * wf;             // forward prediction coefficients [px1]
+    T * wb;             // backward prediction coefficients [px1]
+    float zf;           // forward prediction error energy
+    float zb;           // backward prediction error energy
+    float gamma;        // conversion factor
 
-    unsigned int n;     // input counter
-    WINDOW() buffer;    // input buffer
+    unsigned int n;     // number of samples pushed since last update
+    WINDOW() buffer;    // input buffer, including one extra sample [(p+1)x1]
 };
 
+// update methods
+int EQRLS(_step_conventional)(EQRLS() _q, T * _x, T _alpha);
+int EQRLS(_step_invqr)       (EQRLS() _q, T * _x, T _alpha);
+int EQRLS(_step_ftf)         (EQRLS() _q, T * _x, T _alpha);
+
+// reset fast transversal filter predictors
+int EQRLS(_reset_ftf)(EQRLS() _q);
 
 // create recursive least-squares (RLS) equalizer object
 //  _h      :   initial coefficients [size: _p x 1], default if NULL
 //  _p      :   equalizer length (number of taps)
 EQRLS() EQRLS(_create)(T *          _h,
                        unsigned int _p)
+{
+    return EQRLS(_create_alg)(_h, _p, LIQUID_EQRLS_CONVENTIONAL);
+}
+
+// create recursive least-squares (RLS) equalizer object with specific
+// update algorithm
+//  _h      :   initial coefficients [size: _p x 1], default if NULL
+//  _p      :   equalizer length (number of taps)
+//  _alg    :   update algorithm
+EQRLS() EQRLS(_create_alg)(T *              _h,
+                           unsigned int     _p,
+                           liquid_eqrls_alg _alg)
 {
     if (_p==0)
         return liquid_error_config("eqrls_%s_create(), equalier length must be greater than 0",EXTENSION_FULL);
+    if (_alg != LIQUID_EQRLS_CONVENTIONAL && _alg != LIQUID_EQRLS_INVQR && _alg != LIQUID_EQRLS_FTF)
+        return liquid_error_config("eqrls_%s_create(), invalid update algorithm (%d)",EXTENSION_FULL,_alg);
 
     EQRLS() q = (EQRLS()) malloc(sizeof(struct EQRLS(_s)));
 
@@ -66,20 +121,24 @@ EQRLS() EQRLS(_create)(T *          _h,
     q->p      = _p;     // filter order
     q->lambda = 0.99f;  // learning rate
     q->delta  = 0.1f;   // initialization factor
+    q->alg    = _alg;   // update algorithm
 
     // allocate memory for matrices
-    q->h0 = (T*) malloc((q->p)*sizeof(T));
-    q->w0 = (T*) malloc((q->p)*sizeof(T));
-    q->w1 = (T*) malloc((q->p)*sizeof(T));
-    q->P0 = (T*) malloc((q->p)*(q->p)*sizeof(T));
-    q->P1 = (T*) malloc((q->p)*(q->p)*sizeof(T));
-    q->g  = (T*) malloc((q->p)*sizeof(T));
-
-    q->xP0 =   (T*) malloc((q->p)*sizeof(T));
-    q->gxl =   (T*) malloc((q->p)*(q->p)*sizeof(T));
-    q->gxlP0 = (T*) malloc((q->p)*(q->p)*sizeof(T));
+    q->h0  = (T*) malloc((q->p)*sizeof(T));
+    q->w0  = (T*) malloc((q->p)*sizeof(T));
+    q->g   = (T*) malloc((q->p+1)*sizeof(T));
+    q->xP0 = (T*) malloc((q->p)*sizeof(T));
+    if (q->alg == LIQUID_EQRLS_FTF) {
+        q->P0 = NULL;
+        q->wf = (T*) malloc((q->p)*sizeof(T));
+        q->wb = (T*) malloc((q->p)*sizeof(T));
+    } else {
+        q->P0 = (T*) malloc((q->p)*(q->p)*sizeof(T));
+        q->wf = NULL;
+        q->wb = NULL;
+    }
 
-    q->buffer = WINDOW(_create)(q->p);
+    q->buffer = WINDOW(_create)(q->p+1);
 
     // copy coefficients (if not NULL)
     if (_h == NULL) {
@@ -118,10 +177,11 @@ EQRLS() EQRLS(_recreate)(EQRLS()      _q,
     }
 
     // completely destroy old equalizer object
+    liquid_eqrls_alg alg = _q->alg;
     EQRLS(_destroy)(_q);
 
     // create new one and return
-    return EQRLS(_create)(_h,_p);
+    return EQRLS(_create_alg)(_h,_p,alg);
 }
 
 // copy object
@@ -139,13 +199,14 @@ EQRLS() EQRLS(_copy)(EQRLS() q_orig)
     unsigned int p = q_copy->p; // filter order (for convenience)
     q_copy->h0    = (T*) liquid_malloc_copy(q_orig->h0,   p,   sizeof(T));
     q_copy->w0    = (T*) liquid_malloc_copy(q_orig->w0,   p,   sizeof(T));
-    q_copy->w1    = (T*) liquid_malloc_copy(q_orig->w1,   p,   sizeof(T));
-    q_copy->P0    = (T*) liquid_malloc_copy(q_orig->P0,   p*p, sizeof(T));
-    q_copy->P1    = (T*) liquid_malloc_copy(q_orig->P1,   p*p, sizeof(T));
-    q_copy->g     = (T*) liquid_malloc_copy(q_orig->g,    p,   sizeof(T));
+    q_copy->g     = (T*) liquid_malloc_copy(q_orig->g,    p+1, sizeof(T));
     q_copy->xP0   = (T*) liquid_malloc_copy(q_orig->xP0,  p,   sizeof(T));
-    q_copy->gxl   = (T*) liquid_malloc_copy(q_orig->gxl,  p*p, sizeof(T));
-    q_copy->gxlP0 = (T*) liquid_malloc_copy(q_orig->gxlP0,p*p, sizeof(T));
+    if (q_orig->alg == LIQUID_EQRLS_FTF) {
+        q_copy->wf = (T*) liquid_malloc_copy(q_orig->wf,  p,   sizeof(T));
+        q_copy->wb = (T*) liquid_malloc_copy(q_orig->wb,  p,   sizeof(T));
+    } else {
+        q_copy->P0 = (T*) liquid_malloc_copy(q_orig->P0,  p*p, sizeof(T));
+    }
 
     // copy window and buffer objects
     q_copy->buffer = WINDOW(_copy)(q_orig->buffer);
@@ -159,14 +220,11 @@ int EQRLS(_destroy)(EQRLS() _q)
     // free vectors and matrices
     free(_q->h0);
     free(_q->w0);
-    free(_q->w1);
     free(_q->P0);
-    free(_q->P1);
     free(_q->g);
-
     free(_q->xP0);
-    free(_q->gxl);
-    free(_q->gxlP0);
+    free(_q->wf);
+    free(_q->wb);
 
     // destroy window buffer
     WINDOW(_destroy)(_q->buffer);
@@ -179,8 +237,9 @@ int EQRLS(_destroy)(EQRLS() _q)
 // print eqrls object internals
 int EQRLS(_print)(EQRLS() _q)
 {
-    printf("<liquid.eqrls_%s, order=%u, lambda=%g, delta=%g>\n",
-        EXTENSION_FULL, _q->p, _q->lambda, _q->delta);
+    const char * alg_str[3] = {"conventional", "invqr", "ftf"};
+    printf("<liquid.eqrls_%s, order=%u, lambda=%g, delta=%g, alg=\"%s\">\n",
+        EXTENSION_FULL, _q->p, _q->lambda, _q->delta, alg_str[_q->alg]);
     return LIQUID_OK;
 }
 
@@ -191,12 +250,28 @@ int EQRLS(_reset)(EQRLS() _q)
     _q->n = 0;
 
     unsigned int i, j;
-    // initialize...
-    for (i=0; i<_q->p; i++) {
-        for (j=0; j<_q->p; j++) {
-            if (i==j)   _q->P0[(_q->p)*i + j] = 1 / (_q->delta);
-            else        _q->P0[(_q->p)*i + j] = 0;
+    switch (_q->alg) {
+    case LIQUID_EQRLS_CONVENTIONAL:
+        // P0 = I / delta
+        for (i=0; i<_q->p; i++) {
+            for (j=0; j<_q->p; j++) {
+                if (i==j)   _q->P0[(_q->p)*i + j] = 1 / (_q->delta);
+                else        _q->P0[(_q->p)*i + j] = 0;
+            }
+        }
+        break;
+    case LIQUID_EQRLS_INVQR:
+        // square root of P0 = I / sqrt(delta)
+        for (i=0; i<_q->p; i++) {
+            for (j=0; j<_q->p; j++) {
+                if (i==j)   _q->P0[(_q->p)*i + j] = 1 / sqrtf(_q->delta);
+                else        _q->P0[(_q->p)*i + j] = 0;
+            }
         }
+        break;
+    default:
+        _q->zf = 0;
+        EQRLS(_reset_ftf)(_q);
     }
 
     // copy default coefficients
@@ -235,6 +310,7 @@ int EQRLS(_push)(EQRLS() _q,
 {
     // push value into buffer
     WINDOW(_push)(_q->buffer, _x);
+    _q->n++;
     return LIQUID_OK;
 }
 
@@ -244,10 +320,10 @@ int EQRLS(_push)(EQRLS() _q,
 int EQRLS(_execute)(EQRLS() _q,
                     T *     _y)
 {
-    // compute vector dot product
+    // compute vector dot product (skipping oldest sample in buffer)
     T * r;      // read buffer
     WINDOW(_read)(_q->buffer, &r);
-    DOTPROD(_run)(_q->w0, r, _q->p, _y);
+    DOTPROD(_run)(_q->w0, r+1, _q->p, _y);
     return LIQUID_OK;
 }
 
@@ -260,103 +336,241 @@ int EQRLS(_step)(EQRLS() _q,
                  T       _d,
                  T       _d_hat)
 {
-    unsigned int i,r,c;
-    unsigned int p=_q->p;
-
     // compute error (a priori)
     T alpha = _d - _d_hat;
 
-    // read buffer
+    // read buffer; x[0] is the sample which has just left the regressor
     T * x;
     WINDOW(_read)(_q->buffer, &x);
 
-    // compute gain vector
-    for (c=0; c<p; c++) {
-        _q->xP0[c] = 0;
-        for (r=0; r<p; r++) {
-            _q->xP0[c] += x[r] * matrix_access(_q->P0,p,p,r,c);
-        }
-    }
-
 #ifdef DEBUG
-    printf("x: ");
-    for (i=0; i<p; i++)
-        PRINTVAL(x[i]);
-    printf("\n");
-
     DEBUG_PRINTF_CFLOAT(stdout,"    d",0,_d);
     DEBUG_PRINTF_CFLOAT(stdout,"_d_hat",0,_d_hat);
     DEBUG_PRINTF_CFLOAT(stdout,"error",0,alpha);
+#endif
+
+    unsigned int n = _q->n;
+    _q->n = 0;
+    switch (_q->alg) {
+    case LIQUID_EQRLS_CONVENTIONAL: return EQRLS(_step_conventional)(_q, x, alpha);
+    case LIQUID_EQRLS_INVQR:        return EQRLS(_step_invqr)       (_q, x, alpha);
+    default:;
+    }
+
+    // the fast transversal filter relies on the regressor shifting by
+    // exactly one sample between updates; restart predictors otherwise
+    if (n != 1)
+        EQRLS(_reset_ftf)(_q);
+    return EQRLS(_step_ftf)(_q, x, alpha);
+}
 
-    printf("xP0: ");
+// conventional RLS update of inverse correlation matrix
+//  _q      :   equalizer object
+//  _x      :   extended regressor [size: p+1 x 1], oldest sample first
+//  _alpha  :   a priori error
+int EQRLS(_step_conventional)(EQRLS() _q,
+                              T *     _x,
+                              T       _alpha)
+{
+    unsigned int i,r,c;
+    unsigned int p=_q->p;
+    T * x = _x + 1;
+
+    // compute gain vector
     for (c=0; c<p; c++)
-        PRINTVAL(_q->xP0[c]);
-    printf("\n");
-#endif
+        _q->xP0[c] = 0;
+    for (r=0; r<p; r++) {
+        T * P0 = &matrix_access(_q->P0,p,p,r,0);
+        for (c=0; c<p; c++)
+            _q->xP0[c] += x[r] * P0[c];
+    }
+
     // zeta = lambda + [x.']*[P0]*[conj(x)]
     _q->zeta = 0;
-    for (c=0; c<p; c++) {
-        T sum = _q->xP0[c] * conj(x[c]);
-        _q->zeta += sum;
-    }
+    for (c=0; c<p; c++)
+        _q->zeta += _q->xP0[c] * EQRLS_CONJ(x[c]);
     _q->zeta += _q->lambda;
-#ifdef DEBUG
-    printf("zeta : ");
-    PRINTVAL(_q->zeta);
-    printf("\n");
-#endif
+
+    T zeta_inv = 1 / _q->zeta;
     for (r=0; r<p; r++) {
-        _q->g[r] = 0;
-        for (c=0; c<p; c++) {
-            T sum = matrix_access(_q->P0,p,p,r,c) * conj(x[c]);
-            _q->g[r] += sum;
-        }
-        _q->g[r] /= _q->zeta;
+        T * P0 = &matrix_access(_q->P0,p,p,r,0);
+        T sum = 0;
+        for (c=0; c<p; c++)
+            sum += P0[c] * EQRLS_CONJ(x[c]);
+        _q->g[r] = sum * zeta_inv;
     }
 #ifdef DEBUG
     printf("g: ");
     for (i=0; i<p; i++)
         PRINTVAL(_q->g[i]);
-        //printf("%6.3f ", _q->g[i]);
     printf("\n");
 #endif
 
-    // update recursion matrix
+    // update recursion matrix with rank-one correction:
+    //   P1 = (P0 - [g]*[x.']*[P0]) / lambda
+    float lambda_inv = 1.0f / _q->lambda;
     for (r=0; r<p; r++) {
-        for (c=0; c<p; c++) {
-            // gxl = [g] * [x.'] / lambda
-            matrix_access(_q->gxl,p,p,r,c) = _q->g[r] * x[c] / _q->lambda;
-        }
+        T * P0 = &matrix_access(_q->P0,p,p,r,0);
+        T g_r = _q->g[r];
+        for (c=0; c<p; c++)
+            P0[c] = (P0[c] - g_r * _q->xP0[c]) * lambda_inv;
     }
-    // multiply two [pxp] matrices: gxlP0 = gxl * P0
-    MATRIX(_mul)(_q->gxl,  p,p,
-                 _q->P0,   p,p,
-                 _q->gxlP0,p,p);
-
-    for (i=0; i<p*p; i++)
-        _q->P1[i] = _q->P0[i] / _q->lambda - _q->gxlP0[i];
 
     // update weighting vector
     for (i=0; i<p; i++)
-        _q->w1[i] = _q->w0[i] + alpha*(_q->g[i]);
+        _q->w0[i] += _alpha*(_q->g[i]);
+    return LIQUID_OK;
+}
 
-#ifdef DEBUG
-    printf("w0: \n");
-    for (i=0; i<p; i++) {
-        PRINTVAL(_q->w0[i]);
-        printf("\n");
-    }
-    printf("w1: \n");
-    for (i=0; i<p; i++) {
-        PRINTVAL(_q->w1[i]);
-        printf("\n");
-    EQRLS(_print)(_q);
+// inverse QR-RLS update: rotate pre-array
+//      [ 1   lambda^(-1/2) x.' L ]
+//      [ 0   lambda^(-1/2)     L ]
+// to lower-triangular form with Givens rotations, annihilating the top
+// row from the right so that L retains its structure; the first column
+// becomes [sqrt(zeta/lambda); g*sqrt(zeta/lambda)]. The lower-triangular
+// square root L (P = L L^H) is stored column-wise in P0.
+//  _q      :   equalizer object
+//  _x      :   extended regressor [size: p+1 x 1], oldest sample first
+//  _alpha  :   a priori error
+int EQRLS(_step_invqr)(EQRLS() _q,
+                       T *     _x,
+                       T       _alpha)
+{
+    unsigned int i,j;
+    unsigned int p=_q->p;
+    T * x = _x + 1;
+    T * g = _q->g;
+    float s_lambda = 1.0f / sqrtf(_q->lambda);
+
+    for (i=0; i<p; i++)
+        g[i] = 0;
+
+    float a = 1.0f;     // running (real) value of upper-left element
+    for (j=p; j>0; j--) {
+        // column j-1 of L, non-zero from row j-1
+        T * l = _q->P0 + (j-1)*p;
+
+        // scale column and compute top-row element e = x.' L(:,j-1)
+        T e = 0;
+        for (i=j-1; i<p; i++) {
+            l[i] *= s_lambda;
+            e += x[i] * l[i];
+        }
+
+        // rotation which annihilates e against a
+        float r = sqrtf(a*a + EQRLS_ABS2(e));
+        if (r == 0.0f)
+            continue;
+        float c = a / r;
+        T     s = EQRLS_CONJ(e) / r;
+        T     s_conj = e / r;
+        for (i=j-1; i<p; i++) {
+            T g_i = g[i];
+            g[i] =  c*g_i + s*l[i];
+            l[i] = -s_conj*g_i + c*l[i];
+        }
+        a = r;
     }
-#endif
 
-    // copy old values
-    memmove(_q->w0, _q->w1,   p*sizeof(T));
-    memmove(_q->P0, _q->P1, p*p*sizeof(T));
+    // update weighting vector using gain g / a
+    T v = _alpha / a;
+    for (i=0; i<p; i++)
+        _q->w0[i] += v*g[i];
+    _q->zeta = a*a*_q->lambda;
+    return LIQUID_OK;
+}
+
+// reset fast transversal filter predictors and gain, keeping weights
+int EQRLS(_reset_ftf)(EQRLS() _q)
+{
+    memset(_q->wf,  0x00, (_q->p)*sizeof(T));
+    memset(_q->wb,  0x00, (_q->p)*sizeof(T));
+    memset(_q->xP0, 0x00, (_q->p)*sizeof(T));
+    _q->gamma = 1.0f;
+
+    // prediction error energies consistent with a diagonal initial
+    // correlation matrix, keeping forward energy if valid
+    if (!(_q->zf > 0) || !isfinite(_q->zf))
+        _q->zf = _q->delta * powf(_q->lambda, _q->p);
+    _q->zb = _q->zf * powf(_q->lambda, -(float)(_q->p));
+    return LIQUID_OK;
+}
+
+// stabilized fast transversal filter update; the a priori gain vector
+// [k = P0 conj(x) / lambda] is stored in xP0 and the extended gain in g
+//  _q      :   equalizer object
+//  _x      :   extended regressor [size: p+1 x 1], oldest sample first
+//  _alpha  :   a priori error
+int EQRLS(_step_ftf)(EQRLS() _q,
+                     T *     _x,
+                     T       _alpha)
+{
+    unsigned int i;
+    unsigned int p=_q->p;
+    float lambda = _q->lambda;
+    T * k  = _q->xP0;   // a priori gain, p x 1
+    T * ke = _q->g;     // extended a priori gain, (p+1) x 1
+    T * wf = _q->wf;
+    T * wb = _q->wb;
+
+    // forward prediction error (a priori), predicting newest sample
+    // from previous regressor _x[0..p-1]
+    T ef = _x[p];
+    for (i=0; i<p; i++)
+        ef -= _x[i] * wf[i];
+
+    // extend gain vector: ke = [k; 0] + conj(ef)/(lambda zf) [-wf; 1]
+    T cf = EQRLS_CONJ(ef) / (lambda * _q->zf);
+    for (i=0; i<p; i++)
+        ke[i] = k[i] - cf * wf[i];
+    ke[p] = cf;
+    float gamma_inv = 1.0f / _q->gamma + crealf(cf * ef);
+
+    // update forward predictor and error energy using previous gain
+    T vf = _q->gamma * ef;
+    for (i=0; i<p; i++)
+        wf[i] += vf * k[i];
+    _q->zf = lambda * _q->zf + _q->gamma * EQRLS_ABS2(ef);
+
+    // backward prediction error (a priori), predicting sample leaving the
+    // regressor from current regressor _x[1..p], computed both directly
+    // and from the extended gain; the two are mixed to stabilize the
+    // propagation of numerical errors
+    T eb1 = _x[0];
+    for (i=0; i<p; i++)
+        eb1 -= _x[i+1] * wb[i];
+    T eb2 = EQRLS_CONJ(ke[0]) * lambda * _q->zb;
+    T eb_k1 = EQRLS_FTF_K1 * eb1 + (1.0f - EQRLS_FTF_K1) * eb2;
+    T eb_k2 = EQRLS_FTF_K2 * eb1 + (1.0f - EQRLS_FTF_K2) * eb2;
+
+    // shrink gain vector: k = ke[1..p] + ke[0] wb
+    for (i=0; i<p; i++)
+        k[i] = ke[i+1] + ke[0] * wb[i];
+    gamma_inv -= crealf(ke[0] * eb1);
+
+    // rescue: restart predictors if conversion factor is out of range
+    if (!(gamma_inv >= 1.0f) || !isfinite(gamma_inv) ||
+        !(_q->zf > 0) || !isfinite(_q->zf) ||
+        !(_q->zb > 0) || !isfinite(_q->zb))
+        return EQRLS(_reset_ftf)(_q);
+    _q->gamma = 1.0f / gamma_inv;
+
+    // update backward predictor and error energy
+    T vb = _q->gamma * eb_k1;
+    for (i=0; i<p; i++)
+        wb[i] += vb * k[i];
+    _q->zb = lambda * _q->zb + _q->gamma * EQRLS_ABS2(eb_k2);
+
+    // rescue: restart predictors (before corrupting weights) if the
+    // exact-arithmetic invariant gamma = lambda^p zb / zf has drifted
+    float r = powf(lambda, p) * _q->zb / _q->zf * gamma_inv;
+    if (!(fabsf(r - 1.0f) < EQRLS_FTF_TOL))
+        return EQRLS(_reset_ftf)(_q);
+
+    // update weighting vector
+    T v = _q->gamma * _alpha;
+    for (i=0; i<p; i++)
+        _q->w0[i] += v * k[i];
     return LIQUID_OK;
 }
 
@@ -369,7 +583,7 @@ int EQRLS(_get_weights)(EQRLS() _q,
     // copy output weight vector, reversing order
     unsigned int i;
     for (i=0; i<_q->p; i++)
-        _w[i] = _q->w1[_q->p-i-1];
+        _w[i] = _q->w0[_q->p-i-1];
     return LIQUID_OK;
 }
 
@@ -411,3 +625,9 @@ int EQRLS(_train)(EQRLS()      _q,
     // copy output weight vector
     return EQRLS(_get_weights)(_q, _w);
 }
+
+#undef EQRLS_CONJ
+#undef EQRLS_ABS2
+#undef EQRLS_FTF_K1
+#undef EQRLS_FTF_K2
+#undef EQRLS_FTF_TOL
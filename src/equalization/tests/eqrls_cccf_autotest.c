@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2007 - 2022 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+// identify complex channel from known QPSK input using the given update
+// algorithm; the equalizer weights should converge to the channel taps
+void eqrls_cccf_test_sysid(liquid_eqrls_alg _alg, float _lambda)
+{
+    float tol = 5e-3f;      // error tolerance
+    unsigned int p = 7;     // equalizer order (matches channel length)
+    unsigned int n = 1200;  // number of training symbols
+    float nstd = 0.001f;    // noise standard deviation
+
+    // unknown complex channel
+    float complex h[7] = { 1.00f+0.20f*_Complex_I, -0.30f+0.40f*_Complex_I,
+                           0.15f-0.10f*_Complex_I,  0.00f+0.05f*_Complex_I,
+                          -0.08f+0.02f*_Complex_I,  0.03f-0.06f*_Complex_I,
+                          -0.02f+0.00f*_Complex_I,};
+    firfilt_cccf fc = firfilt_cccf_create(h,p);
+
+    eqrls_cccf q = eqrls_cccf_create_alg(NULL, p, _alg);
+    eqrls_cccf_set_bw(q, _lambda);
+
+    unsigned int i;
+    float complex x, d, y;
+    for (i=0; i<n; i++) {
+        // random QPSK input and noisy channel output
+        x = ((rand() & 1) ? M_SQRT1_2 : -M_SQRT1_2) +
+            ((rand() & 1) ? M_SQRT1_2 : -M_SQRT1_2) * _Complex_I;
+        firfilt_cccf_execute_one(fc, x, &d);
+        d += nstd*(randnf() + _Complex_I*randnf())*M_SQRT1_2;
+
+        eqrls_cccf_push   (q, x);
+        eqrls_cccf_execute(q, &y);
+        eqrls_cccf_step   (q, d, y);
+    }
+
+    // compare weights to channel
+    float complex w[p];
+    eqrls_cccf_get_weights(q, w);
+    for (i=0; i<p; i++) {
+        CONTEND_DELTA(crealf(w[i]), crealf(h[i]), tol);
+        CONTEND_DELTA(cimagf(w[i]), cimagf(h[i]), tol);
+    }
+
+    firfilt_cccf_destroy(fc);
+    eqrls_cccf_destroy(q);
+}
+
+void autotest_eqrls_cccf_sysid()          { eqrls_cccf_test_sysid(LIQUID_EQRLS_CONVENTIONAL, 0.99f ); }
+void autotest_eqrls_cccf_sysid_invqr()    { eqrls_cccf_test_sysid(LIQUID_EQRLS_INVQR,        0.99f ); }
+void autotest_eqrls_cccf_sysid_ftf()      { eqrls_cccf_test_sysid(LIQUID_EQRLS_FTF,          0.99f ); }
+void autotest_eqrls_cccf_sysid_ftf_slow() { eqrls_cccf_test_sysid(LIQUID_EQRLS_FTF,          0.999f); }
+
+// check alternate update algorithm against conventional RLS when
+// equalizing a complex channel
+void eqrls_cccf_test_alg(liquid_eqrls_alg _alg, float _lambda)
+{
+    float tol = 1e-3f;      // error tolerance
+    unsigned int p = 12;    // equalizer order
+    unsigned int n = 2400;  // number of training symbols
+    float nstd = 0.01f;     // noise standard deviation
+
+    // create equalizers
+    eqrls_cccf q0 = eqrls_cccf_create(NULL, p);
+    eqrls_cccf q1 = eqrls_cccf_create_alg(NULL, p, _alg);
+    eqrls_cccf_set_bw(q0, _lambda);
+    eqrls_cccf_set_bw(q1, _lambda);
+
+    // create channel filter
+    float complex hc[5] = { 1.00f+0.00f*_Complex_I, -0.12f+0.25f*_Complex_I,
+                            0.08f-0.04f*_Complex_I,  0.02f+0.05f*_Complex_I,
+                           -0.03f-0.01f*_Complex_I,};
+    firfilt_cccf fc = firfilt_cccf_create(hc,5);
+
+    unsigned int i;
+    float complex d, v, y0, y1;
+    for (i=0; i<n; i++) {
+        d = ((rand() & 1) ? M_SQRT1_2 : -M_SQRT1_2) +
+            ((rand() & 1) ? M_SQRT1_2 : -M_SQRT1_2) * _Complex_I;
+        firfilt_cccf_execute_one(fc, d, &v);
+        v += nstd*(randnf() + _Complex_I*randnf())*M_SQRT1_2;
+
+        eqrls_cccf_push   (q0, v);
+        eqrls_cccf_push   (q1, v);
+        eqrls_cccf_execute(q0, &y0);
+        eqrls_cccf_execute(q1, &y1);
+        eqrls_cccf_step   (q0, d, y0);
+        eqrls_cccf_step   (q1, d, y1);
+    }
+
+    // compare weights
+    float complex w0[p], w1[p];
+    eqrls_cccf_get_weights(q0, w0);
+    eqrls_cccf_get_weights(q1, w1);
+    for (i=0; i<p; i++) {
+        CONTEND_DELTA(crealf(w1[i]), crealf(w0[i]), tol);
+        CONTEND_DELTA(cimagf(w1[i]), cimagf(w0[i]), tol);
+    }
+
+    firfilt_cccf_destroy(fc);
+    eqrls_cccf_destroy(q0);
+    eqrls_cccf_destroy(q1);
+}
+
+void autotest_eqrls_cccf_invqr()     { eqrls_cccf_test_alg(LIQUID_EQRLS_INVQR, 0.99f ); }
+void autotest_eqrls_cccf_ftf()       { eqrls_cccf_test_alg(LIQUID_EQRLS_FTF,   0.99f ); }
+void autotest_eqrls_cccf_ftf_slow()  { eqrls_cccf_test_alg(LIQUID_EQRLS_FTF,   0.999f); }
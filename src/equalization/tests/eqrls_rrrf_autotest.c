@@ -147,3 +147,91 @@ void autotest_eqrls_rrrf_copy()
     eqrls_rrrf_destroy(q1);
 }
 
+
+// check alternate update algorithm against conventional RLS
+void eqrls_rrrf_test_alg(liquid_eqrls_alg _alg, float _lambda)
+{
+    float tol = 1e-3f;      // error tolerance
+    unsigned int p = 12;    // equalizer order
+    unsigned int n = 2400;  // number of training symbols
+
+    // create equalizers
+    eqrls_rrrf q0 = eqrls_rrrf_create(NULL, p);
+    eqrls_rrrf q1 = eqrls_rrrf_create_alg(NULL, p, _alg);
+    eqrls_rrrf_set_bw(q0, _lambda);
+    eqrls_rrrf_set_bw(q1, _lambda);
+
+    // create channel filter
+    float hc[7] = {1.0f,-0.08f, 0.32f, 0.01f,-0.06f, 0.07f,-0.03f,};
+    firfilt_rrrf fc = firfilt_rrrf_create(hc,7);
+
+    unsigned int i;
+    float v, y0, y1, nstd = 0.01f;
+    float * d = (float*)eqrls_rrrf_autotest_data_sequence;
+    for (i=0; i<n; i++) {
+        firfilt_rrrf_execute_one(fc, d[i%64], &v);
+        v += nstd*randnf();
+
+        eqrls_rrrf_push   (q0, v);
+        eqrls_rrrf_push   (q1, v);
+        eqrls_rrrf_execute(q0, &y0);
+        eqrls_rrrf_execute(q1, &y1);
+        eqrls_rrrf_step   (q0, d[i%64], y0);
+        eqrls_rrrf_step   (q1, d[i%64], y1);
+    }
+
+    // compare weights
+    float w0[p], w1[p];
+    eqrls_rrrf_get_weights(q0, w0);
+    eqrls_rrrf_get_weights(q1, w1);
+    for (i=0; i<p; i++)
+        CONTEND_DELTA(w1[i], w0[i], tol);
+
+    // destroy objects
+    firfilt_rrrf_destroy(fc);
+    eqrls_rrrf_destroy(q0);
+    eqrls_rrrf_destroy(q1);
+}
+
+void autotest_eqrls_rrrf_invqr()     { eqrls_rrrf_test_alg(LIQUID_EQRLS_INVQR, 0.99f ); }
+void autotest_eqrls_rrrf_ftf()       { eqrls_rrrf_test_alg(LIQUID_EQRLS_FTF,   0.99f ); }
+void autotest_eqrls_rrrf_ftf_slow()  { eqrls_rrrf_test_alg(LIQUID_EQRLS_FTF,   0.999f); }
+
+void autotest_eqrls_rrrf_config()
+{
+#if LIQUID_STRICT_EXIT
+    AUTOTEST_WARN("skipping eqrls_rrrf config test with strict exit enabled\n");
+    return;
+#endif
+#if !LIQUID_SUPPRESS_ERROR_OUTPUT
+    fprintf(stderr,"warning: ignore potential errors here; checking for invalid configurations\n");
+#endif
+    CONTEND_ISNULL(eqrls_rrrf_create(NULL, 0));
+    CONTEND_ISNULL(eqrls_rrrf_create_alg(NULL, 8, (liquid_eqrls_alg)7));
+}
+
+// copy FTF object mid-stream and check outputs match
+void autotest_eqrls_rrrf_copy_ftf()
+{
+    eqrls_rrrf q0 = eqrls_rrrf_create_alg(NULL, 8, LIQUID_EQRLS_FTF);
+    unsigned int i;
+    float y0, y1;
+    float * d = (float*)eqrls_rrrf_autotest_data_sequence;
+    for (i=0; i<64; i++) {
+        eqrls_rrrf_push   (q0, d[i] + 0.1f*d[(i+63)%64]);
+        eqrls_rrrf_execute(q0, &y0);
+        eqrls_rrrf_step   (q0, d[i], y0);
+    }
+    eqrls_rrrf q1 = eqrls_rrrf_copy(q0);
+    for (i=0; i<64; i++) {
+        eqrls_rrrf_push   (q0, d[i] + 0.1f*d[(i+63)%64]);
+        eqrls_rrrf_push   (q1, d[i] + 0.1f*d[(i+63)%64]);
+        eqrls_rrrf_execute(q0, &y0);
+        eqrls_rrrf_execute(q1, &y1);
+        CONTEND_EQUALITY(y0, y1);
+        eqrls_rrrf_step   (q0, d[i], y0);
+        eqrls_rrrf_step   (q1, d[i], y1);
+    }
+    eqrls_rrrf_destroy(q0);
+    eqrls_rrrf_destroy(q1);
+}
@@ -58,10 +58,9 @@ void fec_encode_bench(
          _fs == LIQUID_FEC_CONV_V29P45 ||
          _fs == LIQUID_FEC_CONV_V29P56 ||
          _fs == LIQUID_FEC_CONV_V29P67 ||
-         _fs == LIQUID_FEC_CONV_V29P78 ||
-         _fs == LIQUID_FEC_RS_M8)
+         _fs == LIQUID_FEC_CONV_V29P78)
     {
-        liquid_error(LIQUID_EUMODE,"convolutional, Reed-Solomon codes unavailable (install libfec)");
+        liquid_error(LIQUID_EUMODE,"convolutional codes unavailable (install libfec)");
         getrusage(RUSAGE_SELF, _start);
         memmove((void*)_finish,(void*)_start,sizeof(struct rusage));
         return;
@@ -163,4 +162,10 @@ void benchmark_fec_enc_conv27p34_n64    FEC_ENCODE_BENCH_API(LIQUID_FEC_CONV_V27
 void benchmark_fec_enc_conv27p45_n64    FEC_ENCODE_BENCH_API(LIQUID_FEC_CONV_V27P45,64, NULL)
 
 void benchmark_fec_enc_rs8_n64          FEC_ENCODE_BENCH_API(LIQUID_FEC_RS_M8,     64,  NULL)
+void benchmark_fec_enc_rs8_n223         FEC_ENCODE_BENCH_API(LIQUID_FEC_RS_M8,     223, NULL)
+void benchmark_fec_enc_rs8_n1024        FEC_ENCODE_BENCH_API(LIQUID_FEC_RS_M8,    1024, NULL)
+
+void benchmark_fec_enc_ldpc12_n64       FEC_ENCODE_BENCH_API(LIQUID_FEC_LDPC_R12,  64,  NULL)
+void benchmark_fec_enc_ldpc12_n144      FEC_ENCODE_BENCH_API(LIQUID_FEC_LDPC_R12,  144, NULL)
+void benchmark_fec_enc_ldpc34_n216      FEC_ENCODE_BENCH_API(LIQUID_FEC_LDPC_R34,  216, NULL)
 
@@ -64,10 +64,9 @@ void fecsoft_decode_bench(
          _fs == LIQUID_FEC_CONV_V29P45 ||
          _fs == LIQUID_FEC_CONV_V29P56 ||
          _fs == LIQUID_FEC_CONV_V29P67 ||
-         _fs == LIQUID_FEC_CONV_V29P78 ||
-         _fs == LIQUID_FEC_RS_M8)
+         _fs == LIQUID_FEC_CONV_V29P78)
     {
-        liquid_error(LIQUID_EUMODE,"convolutional, Reed-Solomon codes unavailable (install libfec)");
+        liquid_error(LIQUID_EUMODE,"convolutional codes unavailable (install libfec)");
         getrusage(RUSAGE_SELF, _start);
         memmove((void*)_finish,(void*)_start,sizeof(struct rusage));
         return;
@@ -188,3 +187,7 @@ void benchmark_fecsoft_dec_conv29p78_n64  FECSOFT_DECODE_BENCH_API(LIQUID_FEC_CO
 
 void benchmark_fecsoft_dec_rs8_n64        FECSOFT_DECODE_BENCH_API(LIQUID_FEC_RS_M8,      64, NULL)
 
+void benchmark_fecsoft_dec_ldpc12_n64     FECSOFT_DECODE_BENCH_API(LIQUID_FEC_LDPC_R12,   64, NULL)
+void benchmark_fecsoft_dec_ldpc12_n144    FECSOFT_DECODE_BENCH_API(LIQUID_FEC_LDPC_R12,  144, NULL)
+void benchmark_fecsoft_dec_ldpc34_n216    FECSOFT_DECODE_BENCH_API(LIQUID_FEC_LDPC_R34,  216, NULL)
+
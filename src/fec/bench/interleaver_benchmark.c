@@ -31,6 +31,12 @@
     unsigned long int *_num_iterations) \
 { interleaver_bench(_start, _finish, _num_iterations, N); }
 
+#define INTERLEAVER_SOFT_BENCH_API(N)   \
+(   struct rusage *_start,              \
+    struct rusage *_finish,             \
+    unsigned long int *_num_iterations) \
+{ interleaver_soft_bench(_start, _finish, _num_iterations, N); }
+
 // Helper function to keep code base small
 void interleaver_bench(struct rusage *_start,
                        struct rusage *_finish,
@@ -67,6 +73,41 @@ void interleaver_bench(struct rusage *_start,
     interleaver_destroy(q);
 }
 
+// Helper function to keep code base small (soft bits)
+void interleaver_soft_bench(struct rusage *_start,
+                            struct rusage *_finish,
+                            unsigned long int *_num_iterations,
+                            unsigned int _n)
+{
+    // scale number of iterations by block size
+    *_num_iterations /= 0.7f*expf( -0.883 + 0.708*logf(8*_n) );
+
+    // initialize interleaver
+    interleaver q = interleaver_create(_n);
+    interleaver_set_depth(q, 4);
+
+    unsigned char x[8*_n];
+    unsigned char y[8*_n];
+
+    unsigned long int i;
+    for (i=0; i<8*_n; i++)
+        x[i] = rand() & 0xff;
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++) {
+        interleaver_decode_soft(q, x, y);
+        interleaver_decode_soft(q, x, y);
+        interleaver_decode_soft(q, x, y);
+        interleaver_decode_soft(q, x, y);
+    }
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= 4;
+
+    // destroy interleaver object
+    interleaver_destroy(q);
+}
+
 void benchmark_interleaver_8    INTERLEAVER_BENCH_API(8     )
 void benchmark_interleaver_16   INTERLEAVER_BENCH_API(16    )
 void benchmark_interleaver_32   INTERLEAVER_BENCH_API(32    )
@@ -76,3 +117,6 @@ void benchmark_interleaver_256  INTERLEAVER_BENCH_API(256   )
 void benchmark_interleaver_512  INTERLEAVER_BENCH_API(512   )
 void benchmark_interleaver_1024 INTERLEAVER_BENCH_API(1024  )
 
+void benchmark_interleaver_soft_64   INTERLEAVER_SOFT_BENCH_API(64    )
+void benchmark_interleaver_soft_256  INTERLEAVER_SOFT_BENCH_API(256   )
+void benchmark_interleaver_soft_1024 INTERLEAVER_SOFT_BENCH_API(1024  )
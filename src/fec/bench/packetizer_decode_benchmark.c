@@ -52,6 +52,8 @@ void packetizer_decode_bench(struct rusage *     _start,
     // TODO: adjust iterations based on encoder types
     *_num_iterations *= 1000;
     *_num_iterations /= 221 + 1.6125*msg_dec_len;
+    if (_fec0 != LIQUID_FEC_NONE || _fec1 != LIQUID_FEC_NONE)
+        *_num_iterations /= 50;
 
     unsigned char msg_rec[msg_enc_len];
     unsigned char msg_dec[msg_dec_len];
@@ -96,3 +98,5 @@ void benchmark_packetizer_n256  PACKETIZER_DECODE_BENCH_API(256,  LIQUID_CRC_NON
 void benchmark_packetizer_n512  PACKETIZER_DECODE_BENCH_API(512,  LIQUID_CRC_NONE, LIQUID_FEC_NONE, LIQUID_FEC_NONE)
 void benchmark_packetizer_n1024 PACKETIZER_DECODE_BENCH_API(1024, LIQUID_CRC_NONE, LIQUID_FEC_NONE, LIQUID_FEC_NONE)
 
+void benchmark_packetizer_n256_crc32_h74   PACKETIZER_DECODE_BENCH_API(256,  LIQUID_CRC_32, LIQUID_FEC_NONE, LIQUID_FEC_HAMMING74)
+void benchmark_packetizer_n256_crc32_g2412 PACKETIZER_DECODE_BENCH_API(256,  LIQUID_CRC_32, LIQUID_FEC_GOLAY2412, LIQUID_FEC_NONE)
@@ -239,7 +239,7 @@ unsigned int checksum_generate_key(unsigned char *_data,
 
 // generate 8-bit cyclic redundancy check key.
 //
-// slow method, operates one bit at a time
+// operates one byte at a time using a look-up table of the bit-wise
 // algorithm from: http://www.hackersdelight.org/crc.pdf
 //
 //  _msg    :   input data message [size: _n x 1]
@@ -247,16 +247,9 @@ unsigned int checksum_generate_key(unsigned char *_data,
 unsigned int crc8_generate_key(unsigned char *_msg,
                                unsigned int _n)
 {
-    unsigned int i, j, b, mask, key8=~0;
-    unsigned int poly = liquid_reverse_byte_gentab[CRC8_POLY];
-    for (i=0; i<_n; i++) {
-        b = _msg[i];
-        key8 ^= b;
-        for (j=0; j<8; j++) {
-            mask = -(key8 & 1);
-            key8 = (key8>>1) ^ (poly & mask);
-        }
-    }
+    unsigned int i, key8=~0;
+    for (i=0; i<_n; i++)
+        key8 = (key8 >> 8) ^ crc8_gentab[(key8 ^ _msg[i]) & 0xff];
     return (~key8) & 0xff;
 }
 
@@ -267,7 +260,7 @@ unsigned int crc8_generate_key(unsigned char *_msg,
 
 // generate 16-bit cyclic redundancy check key.
 //
-// slow method, operates one bit at a time
+// operates one byte at a time using a look-up table of the bit-wise
 // algorithm from: http://www.hackersdelight.org/crc.pdf
 //
 //  _msg    :   input data message [size: _n x 1]
@@ -275,16 +268,9 @@ unsigned int crc8_generate_key(unsigned char *_msg,
 unsigned int crc16_generate_key(unsigned char *_msg,
                                 unsigned int _n)
 {
-    unsigned int i, j, b, mask, key16=~0;
-    unsigned int poly = liquid_reverse_uint16(CRC16_POLY);
-    for (i=0; i<_n; i++) {
-        b = _msg[i];
-        key16 ^= b;
-        for (j=0; j<8; j++) {
-            mask = -(key16 & 1);
-            key16 = (key16>>1) ^ (poly & mask);
-        }
-    }
+    unsigned int i, key16=~0;
+    for (i=0; i<_n; i++)
+        key16 = (key16 >> 8) ^ crc16_gentab[(key16 ^ _msg[i]) & 0xff];
     return (~key16) & 0xffff;
 }
 
@@ -295,7 +281,7 @@ unsigned int crc16_generate_key(unsigned char *_msg,
 
 // generate 24-bit cyclic redundancy check key.
 //
-// slow method, operates one bit at a time
+// operates one byte at a time using a look-up table of the bit-wise
 // algorithm from: http://www.hackersdelight.org/crc.pdf
 //
 //  _msg    :   input data message [size: _n x 1]
@@ -303,16 +289,9 @@ unsigned int crc16_generate_key(unsigned char *_msg,
 unsigned int crc24_generate_key(unsigned char *_msg,
                                 unsigned int _n)
 {
-    unsigned int i, j, b, mask, key24=~0;
-    unsigned int poly = liquid_reverse_uint24(CRC24_POLY);
-    for (i=0; i<_n; i++) {
-        b = _msg[i];
-        key24 ^= b;
-        for (j=0; j<8; j++) {
-            mask = -(key24 & 1);
-            key24 = (key24>>1) ^ (poly & mask);
-        }
-    }
+    unsigned int i, key24=~0;
+    for (i=0; i<_n; i++)
+        key24 = (key24 >> 8) ^ crc24_gentab[(key24 ^ _msg[i]) & 0xff];
     return (~key24) & 0xffffff;
 }
 
@@ -323,7 +302,7 @@ unsigned int crc24_generate_key(unsigned char *_msg,
 
 // generate 32-bit cyclic redundancy check key.
 //
-// slow method, operates one bit at a time
+// operates one byte at a time using a look-up table of the bit-wise
 // algorithm from: http://www.hackersdelight.org/crc.pdf
 //
 //  _msg    :   input data message [size: _n x 1]
@@ -331,16 +310,9 @@ unsigned int crc24_generate_key(unsigned char *_msg,
 unsigned int crc32_generate_key(unsigned char *_msg,
                                 unsigned int _n)
 {
-    unsigned int i, j, b, mask, key32=~0;
-    unsigned int poly = liquid_reverse_uint32(CRC32_POLY);
-    for (i=0; i<_n; i++) {
-        b = _msg[i];
-        key32 ^= b;
-        for (j=0; j<8; j++) {
-            mask = -(key32 & 1);
-            key32 = (key32>>1) ^ (poly & mask);
-        }
-    }
+    unsigned int i, key32=~0;
+    for (i=0; i<_n; i++)
+        key32 = (key32 >> 8) ^ crc32_gentab[(key32 ^ _msg[i]) & 0xff];
     return (~key32) & 0xffffffff;
 }
 
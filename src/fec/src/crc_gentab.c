@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2007 - 2022 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// cyclic redundancy check byte-wise look-up tables; entry i holds
+// the register after shifting the byte i through eight bit-wise steps
+// of the reflected polynomial (see crc.c)
+//
+
+// CRC-8
+const unsigned int crc8_gentab[256] = {
+    0x00000000, 0x00000091, 0x000000e3, 0x00000072, 0x00000007, 0x00000096, 0x000000e4, 0x00000075,
+    0x0000000e, 0x0000009f, 0x000000ed, 0x0000007c, 0x00000009, 0x00000098, 0x000000ea, 0x0000007b,
+    0x0000001c, 0x0000008d, 0x000000ff, 0x0000006e, 0x0000001b, 0x0000008a, 0x000000f8, 0x00000069,
+    0x00000012, 0x00000083, 0x000000f1, 0x00000060, 0x00000015, 0x00000084, 0x000000f6, 0x00000067,
+    0x00000038, 0x000000a9, 0x000000db, 0x0000004a, 0x0000003f, 0x000000ae, 0x000000dc, 0x0000004d,
+    0x00000036, 0x000000a7, 0x000000d5, 0x00000044, 0x00000031, 0x000000a0, 0x000000d2, 0x00000043,
+    0x00000024, 0x000000b5, 0x000000c7, 0x00000056, 0x00000023, 0x000000b2, 0x000000c0, 0x00000051,
+    0x0000002a, 0x000000bb, 0x000000c9, 0x00000058, 0x0000002d, 0x000000bc, 0x000000ce, 0x0000005f,
+    0x00000070, 0x000000e1, 0x00000093, 0x00000002, 0x00000077, 0x000000e6, 0x00000094, 0x00000005,
+    0x0000007e, 0x000000ef, 0x0000009d, 0x0000000c, 0x00000079, 0x000000e8, 0x0000009a, 0x0000000b,
+    0x0000006c, 0x000000fd, 0x0000008f, 0x0000001e, 0x0000006b, 0x000000fa, 0x00000088, 0x00000019,
+    0x00000062, 0x000000f3, 0x00000081, 0x00000010, 0x00000065, 0x000000f4, 0x00000086, 0x00000017,
+    0x00000048, 0x000000d9, 0x000000ab, 0x0000003a, 0x0000004f, 0x000000de, 0x000000ac, 0x0000003d,
+    0x00000046, 0x000000d7, 0x000000a5, 0x00000034, 0x00000041, 0x000000d0, 0x000000a2, 0x00000033,
+    0x00000054, 0x000000c5, 0x000000b7, 0x00000026, 0x00000053, 0x000000c2, 0x000000b0, 0x00000021,
+    0x0000005a, 0x000000cb, 0x000000b9, 0x00000028, 0x0000005d, 0x000000cc, 0x000000be, 0x0000002f,
+    0x000000e0, 0x00000071, 0x00000003, 0x00000092, 0x000000e7, 0x00000076, 0x00000004, 0x00000095,
+    0x000000ee, 0x0000007f, 0x0000000d, 0x0000009c, 0x000000e9, 0x00000078, 0x0000000a, 0x0000009b,
+    0x000000fc, 0x0000006d, 0x0000001f, 0x0000008e, 0x000000fb, 0x0000006a, 0x00000018, 0x00000089,
+    0x000000f2, 0x00000063, 0x00000011, 0x00000080, 0x000000f5, 0x00000064, 0x00000016, 0x00000087,
+    0x000000d8, 0x00000049, 0x0000003b, 0x000000aa, 0x000000df, 0x0000004e, 0x0000003c, 0x000000ad,
+    0x000000d6, 0x00000047, 0x00000035, 0x000000a4, 0x000000d1, 0x00000040, 0x00000032, 0x000000a3,
+    0x000000c4, 0x00000055, 0x00000027, 0x000000b6, 0x000000c3, 0x00000052, 0x00000020, 0x000000b1,
+    0x000000ca, 0x0000005b, 0x00000029, 0x000000b8, 0x000000cd, 0x0000005c, 0x0000002e, 0x000000bf,
+    0x00000090, 0x00000001, 0x00000073, 0x000000e2, 0x00000097, 0x00000006, 0x00000074, 0x000000e5,
+    0x0000009e, 0x0000000f, 0x0000007d, 0x000000ec, 0x00000099, 0x00000008, 0x0000007a, 0x000000eb,
+    0x0000008c, 0x0000001d, 0x0000006f, 0x000000fe, 0x0000008b, 0x0000001a, 0x00000068, 0x000000f9,
+    0x00000082, 0x00000013, 0x00000061, 0x000000f0, 0x00000085, 0x00000014, 0x00000066, 0x000000f7,
+    0x000000a8, 0x00000039, 0x0000004b, 0x000000da, 0x000000af, 0x0000003e, 0x0000004c, 0x000000dd,
+    0x000000a6, 0x00000037, 0x00000045, 0x000000d4, 0x000000a1, 0x00000030, 0x00000042, 0x000000d3,
+    0x000000b4, 0x00000025, 0x00000057, 0x000000c6, 0x000000b3, 0x00000022, 0x00000050, 0x000000c1,
+    0x000000ba, 0x0000002b, 0x00000059, 0x000000c8, 0x000000bd, 0x0000002c, 0x0000005e, 0x000000cf,
+};
+
+// CRC-16
+const unsigned int crc16_gentab[256] = {
+    0x00000000, 0x0000c0c1, 0x0000c181, 0x00000140, 0x0000c301, 0x000003c0, 0x00000280, 0x0000c241,
+    0x0000c601, 0x000006c0, 0x00000780, 0x0000c741, 0x00000500, 0x0000c5c1, 0x0000c481, 0x00000440,
+    0x0000cc01, 0x00000cc0, 0x00000d80, 0x0000cd41, 0x00000f00, 0x0000cfc1, 0x0000ce81, 0x00000e40,
+    0x00000a00, 0x0000cac1, 0x0000cb81, 0x00000b40, 0x0000c901, 0x000009c0, 0x00000880, 0x0000c841,
+    0x0000d801, 0x000018c0, 0x00001980, 0x0000d941, 0x00001b00, 0x0000dbc1, 0x0000da81, 0x00001a40,
+    0x00001e00, 0x0000dec1, 0x0000df81, 0x00001f40, 0x0000dd01, 0x00001dc0, 0x00001c80, 0x0000dc41,
+    0x00001400, 0x0000d4c1, 0x0000d581, 0x00001540, 0x0000d701, 0x000017c0, 0x00001680, 0x0000d641,
+    0x0000d201, 0x000012c0, 0x00001380, 0x0000d341, 0x00001100, 0x0000d1c1, 0x0000d081, 0x00001040,
+    0x0000f001, 0x000030c0, 0x00003180, 0x0000f141, 0x00003300, 0x0000f3c1, 0x0000f281, 0x00003240,
+    0x00003600, 0x0000f6c1, 0x0000f781, 0x00003740, 0x0000f501, 0x000035c0, 0x00003480, 0x0000f441,
+    0x00003c00, 0x0000fcc1, 0x0000fd81, 0x00003d40, 0x0000ff01, 0x00003fc0, 0x00003e80, 0x0000fe41,
+    0x0000fa01, 0x00003ac0, 0x00003b80, 0x0000fb41, 0x00003900, 0x0000f9c1, 0x0000f881, 0x00003840,
+    0x00002800, 0x0000e8c1, 0x0000e981, 0x00002940, 0x0000eb01, 0x00002bc0, 0x00002a80, 0x0000ea41,
+    0x0000ee01, 0x00002ec0, 0x00002f80, 0x0000ef41, 0x00002d00, 0x0000edc1, 0x0000ec81, 0x00002c40,
+    0x0000e401, 0x000024c0, 0x00002580, 0x0000e541, 0x00002700, 0x0000e7c1, 0x0000e681, 0x00002640,
+    0x00002200, 0x0000e2c1, 0x0000e381, 0x00002340, 0x0000e101, 0x000021c0, 0x00002080, 0x0000e041,
+    0x0000a001, 0x000060c0, 0x00006180, 0x0000a141, 0x00006300, 0x0000a3c1, 0x0000a281, 0x00006240,
+    0x00006600, 0x0000a6c1, 0x0000a781, 0x00006740, 0x0000a501, 0x000065c0, 0x00006480, 0x0000a441,
+    0x00006c00, 0x0000acc1, 0x0000ad81, 0x00006d40, 0x0000af01, 0x00006fc0, 0x00006e80, 0x0000ae41,
+    0x0000aa01, 0x00006ac0, 0x00006b80, 0x0000ab41, 0x00006900, 0x0000a9c1, 0x0000a881, 0x00006840,
+    0x00007800, 0x0000b8c1, 0x0000b981, 0x00007940, 0x0000bb01, 0x00007bc0, 0x00007a80, 0x0000ba41,
+    0x0000be01, 0x00007ec0, 0x00007f80, 0x0000bf41, 0x00007d00, 0x0000bdc1, 0x0000bc81, 0x00007c40,
+    0x0000b401, 0x000074c0, 0x00007580, 0x0000b541, 0x00007700, 0x0000b7c1, 0x0000b681, 0x00007640,
+    0x00007200, 0x0000b2c1, 0x0000b381, 0x00007340, 0x0000b101, 0x000071c0, 0x00007080, 0x0000b041,
+    0x00005000, 0x000090c1, 0x00009181, 0x00005140, 0x00009301, 0x000053c0, 0x00005280, 0x00009241,
+    0x00009601, 0x000056c0, 0x00005780, 0x00009741, 0x00005500, 0x000095c1, 0x00009481, 0x00005440,
+    0x00009c01, 0x00005cc0, 0x00005d80, 0x00009d41, 0x00005f00, 0x00009fc1, 0x00009e81, 0x00005e40,
+    0x00005a00, 0x00009ac1, 0x00009b81, 0x00005b40, 0x00009901, 0x000059c0, 0x00005880, 0x00009841,
+    0x00008801, 0x000048c0, 0x00004980, 0x00008941, 0x00004b00, 0x00008bc1, 0x00008a81, 0x00004a40,
+    0x00004e00, 0x00008ec1, 0x00008f81, 0x00004f40, 0x00008d01, 0x00004dc0, 0x00004c80, 0x00008c41,
+    0x00004400, 0x000084c1, 0x00008581, 0x00004540, 0x00008701, 0x000047c0, 0x00004680, 0x00008641,
+    0x00008201, 0x000042c0, 0x00004380, 0x00008341, 0x00004100, 0x000081c1, 0x00008081, 0x00004040,
+};
+
+// CRC-24
+const unsigned int crc24_gentab[256] = {
+    0x00000000, 0x0033d776, 0x0067aeec, 0x0054799a, 0x00cf5dd8, 0x00fc8aae, 0x00a8f334, 0x009b2442,
+    0x0039d6c5, 0x000a01b3, 0x005e7829, 0x006daf5f, 0x00f68b1d, 0x00c55c6b, 0x009125f1, 0x00a2f287,
+    0x0073ad8a, 0x00407afc, 0x00140366, 0x0027d410, 0x00bcf052, 0x008f2724, 0x00db5ebe, 0x00e889c8,
+    0x004a7b4f, 0x0079ac39, 0x002dd5a3, 0x001e02d5, 0x00852697, 0x00b6f1e1, 0x00e2887b, 0x00d15f0d,
+    0x00e75b14, 0x00d48c62, 0x0080f5f8, 0x00b3228e, 0x002806cc, 0x001bd1ba, 0x004fa820, 0x007c7f56,
+    0x00de8dd1, 0x00ed5aa7, 0x00b9233d, 0x008af44b, 0x0011d009, 0x0022077f, 0x00767ee5, 0x0045a993,
+    0x0094f69e, 0x00a721e8, 0x00f35872, 0x00c08f04, 0x005bab46, 0x00687c30, 0x003c05aa, 0x000fd2dc,
+    0x00ad205b, 0x009ef72d, 0x00ca8eb7, 0x00f959c1, 0x00627d83, 0x0051aaf5, 0x0005d36f, 0x00360419,
+    0x0069db5d, 0x005a0c2b, 0x000e75b1, 0x003da2c7, 0x00a68685, 0x009551f3, 0x00c12869, 0x00f2ff1f,
+    0x00500d98, 0x0063daee, 0x0037a374, 0x00047402, 0x009f5040, 0x00ac8736, 0x00f8feac, 0x00cb29da,
+    0x001a76d7, 0x0029a1a1, 0x007dd83b, 0x004e0f4d, 0x00d52b0f, 0x00e6fc79, 0x00b285e3, 0x00815295,
+    0x0023a012, 0x00107764, 0x00440efe, 0x0077d988, 0x00ecfdca, 0x00df2abc, 0x008b5326, 0x00b88450,
+    0x008e8049, 0x00bd573f, 0x00e92ea5, 0x00daf9d3, 0x0041dd91, 0x00720ae7, 0x0026737d, 0x0015a40b,
+    0x00b7568c, 0x008481fa, 0x00d0f860, 0x00e32f16, 0x00780b54, 0x004bdc22, 0x001fa5b8, 0x002c72ce,
+    0x00fd2dc3, 0x00cefab5, 0x009a832f, 0x00a95459, 0x0032701b, 0x0001a76d, 0x0055def7, 0x00660981,
+    0x00c4fb06, 0x00f72c70, 0x00a355ea, 0x0090829c, 0x000ba6de, 0x003871a8, 0x006c0832, 0x005fdf44,
+    0x00d3b6ba, 0x00e061cc, 0x00b41856, 0x0087cf20, 0x001ceb62, 0x002f3c14, 0x007b458e, 0x004892f8,
+    0x00ea607f, 0x00d9b709, 0x008dce93, 0x00be19e5, 0x00253da7, 0x0016ead1, 0x0042934b, 0x0071443d,
+    0x00a01b30, 0x0093cc46, 0x00c7b5dc, 0x00f462aa, 0x006f46e8, 0x005c919e, 0x0008e804, 0x003b3f72,
+    0x0099cdf5, 0x00aa1a83, 0x00fe6319, 0x00cdb46f, 0x0056902d, 0x0065475b, 0x00313ec1, 0x0002e9b7,
+    0x0034edae, 0x00073ad8, 0x00534342, 0x00609434, 0x00fbb076, 0x00c86700, 0x009c1e9a, 0x00afc9ec,
+    0x000d3b6b, 0x003eec1d, 0x006a9587, 0x005942f1, 0x00c266b3, 0x00f1b1c5, 0x00a5c85f, 0x00961f29,
+    0x00474024, 0x00749752, 0x0020eec8, 0x001339be, 0x00881dfc, 0x00bbca8a, 0x00efb310, 0x00dc6466,
+    0x007e96e1, 0x004d4197, 0x0019380d, 0x002aef7b, 0x00b1cb39, 0x00821c4f, 0x00d665d5, 0x00e5b2a3,
+    0x00ba6de7, 0x0089ba91, 0x00ddc30b, 0x00ee147d, 0x0075303f, 0x0046e749, 0x00129ed3, 0x002149a5,
+    0x0083bb22, 0x00b06c54, 0x00e415ce, 0x00d7c2b8, 0x004ce6fa, 0x007f318c, 0x002b4816, 0x00189f60,
+    0x00c9c06d, 0x00fa171b, 0x00ae6e81, 0x009db9f7, 0x00069db5, 0x00354ac3, 0x00613359, 0x0052e42f,
+    0x00f016a8, 0x00c3c1de, 0x0097b844, 0x00a46f32, 0x003f4b70, 0x000c9c06, 0x0058e59c, 0x006b32ea,
+    0x005d36f3, 0x006ee185, 0x003a981f, 0x00094f69, 0x00926b2b, 0x00a1bc5d, 0x00f5c5c7, 0x00c612b1,
+    0x0064e036, 0x00573740, 0x00034eda, 0x003099ac, 0x00abbdee, 0x00986a98, 0x00cc1302, 0x00ffc474,
+    0x002e9b79, 0x001d4c0f, 0x00493595, 0x007ae2e3, 0x00e1c6a1, 0x00d211d7, 0x0086684d, 0x00b5bf3b,
+    0x00174dbc, 0x00249aca, 0x0070e350, 0x00433426, 0x00d81064, 0x00ebc712, 0x00bfbe88, 0x008c69fe,
+};
+
+// CRC-32
+const unsigned int crc32_gentab[256] = {
+    0x00000000, 0x77073096, 0xee0e612c, 0x990951ba, 0x076dc419, 0x706af48f, 0xe963a535, 0x9e6495a3,
+    0x0edb8832, 0x79dcb8a4, 0xe0d5e91e, 0x97d2d988, 0x09b64c2b, 0x7eb17cbd, 0xe7b82d07, 0x90bf1d91,
+    0x1db71064, 0x6ab020f2, 0xf3b97148, 0x84be41de, 0x1adad47d, 0x6ddde4eb, 0xf4d4b551, 0x83d385c7,
+    0x136c9856, 0x646ba8c0, 0xfd62f97a, 0x8a65c9ec, 0x14015c4f, 0x63066cd9, 0xfa0f3d63, 0x8d080df5,
+    0x3b6e20c8, 0x4c69105e, 0xd56041e4, 0xa2677172, 0x3c03e4d1, 0x4b04d447, 0xd20d85fd, 0xa50ab56b,
+    0x35b5a8fa, 0x42b2986c, 0xdbbbc9d6, 0xacbcf940, 0x32d86ce3, 0x45df5c75, 0xdcd60dcf, 0xabd13d59,
+    0x26d930ac, 0x51de003a, 0xc8d75180, 0xbfd06116, 0x21b4f4b5, 0x56b3c423, 0xcfba9599, 0xb8bda50f,
+    0x2802b89e, 0x5f058808, 0xc60cd9b2, 0xb10be924, 0x2f6f7c87, 0x58684c11, 0xc1611dab, 0xb6662d3d,
+    0x76dc4190, 0x01db7106, 0x98d220bc, 0xefd5102a, 0x71b18589, 0x06b6b51f, 0x9fbfe4a5, 0xe8b8d433,
+    0x7807c9a2, 0x0f00f934, 0x9609a88e, 0xe10e9818, 0x7f6a0dbb, 0x086d3d2d, 0x91646c97, 0xe6635c01,
+    0x6b6b51f4, 0x1c6c6162, 0x856530d8, 0xf262004e, 0x6c0695ed, 0x1b01a57b, 0x8208f4c1, 0xf50fc457,
+    0x65b0d9c6, 0x12b7e950, 0x8bbeb8ea, 0xfcb9887c, 0x62dd1ddf, 0x15da2d49, 0x8cd37cf3, 0xfbd44c65,
+    0x4db26158, 0x3ab551ce, 0xa3bc0074, 0xd4bb30e2, 0x4adfa541, 0x3dd895d7, 0xa4d1c46d, 0xd3d6f4fb,
+    0x4369e96a, 0x346ed9fc, 0xad678846, 0xda60b8d0, 0x44042d73, 0x33031de5, 0xaa0a4c5f, 0xdd0d7cc9,
+    0x5005713c, 0x270241aa, 0xbe0b1010, 0xc90c2086, 0x5768b525, 0x206f85b3, 0xb966d409, 0xce61e49f,
+    0x5edef90e, 0x29d9c998, 0xb0d09822, 0xc7d7a8b4, 0x59b33d17, 0x2eb40d81, 0xb7bd5c3b, 0xc0ba6cad,
+    0xedb88320, 0x9abfb3b6, 0x03b6e20c, 0x74b1d29a, 0xead54739, 0x9dd277af, 0x04db2615, 0x73dc1683,
+    0xe3630b12, 0x94643b84, 0x0d6d6a3e, 0x7a6a5aa8, 0xe40ecf0b, 0x9309ff9d, 0x0a00ae27, 0x7d079eb1,
+    0xf00f9344, 0x8708a3d2, 0x1e01f268, 0x6906c2fe, 0xf762575d, 0x806567cb, 0x196c3671, 0x6e6b06e7,
+    0xfed41b76, 0x89d32be0, 0x10da7a5a, 0x67dd4acc, 0xf9b9df6f, 0x8ebeeff9, 0x17b7be43, 0x60b08ed5,
+    0xd6d6a3e8, 0xa1d1937e, 0x38d8c2c4, 0x4fdff252, 0xd1bb67f1, 0xa6bc5767, 0x3fb506dd, 0x48b2364b,
+    0xd80d2bda, 0xaf0a1b4c, 0x36034af6, 0x41047a60, 0xdf60efc3, 0xa867df55, 0x316e8eef, 0x4669be79,
+    0xcb61b38c, 0xbc66831a, 0x256fd2a0, 0x5268e236, 0xcc0c7795, 0xbb0b4703, 0x220216b9, 0x5505262f,
+    0xc5ba3bbe, 0xb2bd0b28, 0x2bb45a92, 0x5cb36a04, 0xc2d7ffa7, 0xb5d0cf31, 0x2cd99e8b, 0x5bdeae1d,
+    0x9b64c2b0, 0xec63f226, 0x756aa39c, 0x026d930a, 0x9c0906a9, 0xeb0e363f, 0x72076785, 0x05005713,
+    0x95bf4a82, 0xe2b87a14, 0x7bb12bae, 0x0cb61b38, 0x92d28e9b, 0xe5d5be0d, 0x7cdcefb7, 0x0bdbdf21,
+    0x86d3d2d4, 0xf1d4e242, 0x68ddb3f8, 0x1fda836e, 0x81be16cd, 0xf6b9265b, 0x6fb077e1, 0x18b74777,
+    0x88085ae6, 0xff0f6a70, 0x66063bca, 0x11010b5c, 0x8f659eff, 0xf862ae69, 0x616bffd3, 0x166ccf45,
+    0xa00ae278, 0xd70dd2ee, 0x4e048354, 0x3903b3c2, 0xa7672661, 0xd06016f7, 0x4969474d, 0x3e6e77db,
+    0xaed16a4a, 0xd9d65adc, 0x40df0b66, 0x37d83bf0, 0xa9bcae53, 0xdebb9ec5, 0x47b2cf7f, 0x30b5ffe9,
+    0xbdbdf21c, 0xcabac28a, 0x53b39330, 0x24b4a3a6, 0xbad03605, 0xcdd70693, 0x54de5729, 0x23d967bf,
+    0xb3667a2e, 0xc4614ab8, 0x5d681b02, 0x2a6f2b94, 0xb40bbe37, 0xc30c8ea1, 0x5a05df1b, 0x2d02ef8d,
+};
@@ -61,7 +61,10 @@ const char * fec_scheme_str[LIQUID_FEC_NUM_SCHEMES][2] = {
     {"v29p56",      "convolutional r5/6 K=9 (punctured)"},
     {"v29p67",      "convolutional r6/7 K=9 (punctured)"},
     {"v29p78",      "convolutional r7/8 K=9 (punctured)"},
-    {"rs8",         "Reed-Solomon, 223/255"}
+    {"rs8",         "Reed-Solomon, 223/255"},
+    {"ldpc12",      "LDPC r1/2"},
+    {"ldpc23",      "LDPC r2/3"},
+    {"ldpc34",      "LDPC r3/4"}
 };
 
 // Print compact list of existing and available fec schemes
@@ -74,7 +77,7 @@ int liquid_print_fec_schemes()
     printf("          ");
     for (i=0; i<LIQUID_FEC_NUM_SCHEMES; i++) {
 #if !LIBFEC_ENABLED
-        if ( fec_scheme_is_convolutional(i) || fec_scheme_is_reedsolomon(i) )
+        if ( fec_scheme_is_convolutional(i) )
             continue;
 #endif
         printf("%s", fec_scheme_str[i][0]);
@@ -175,6 +178,19 @@ int fec_scheme_is_reedsolomon(fec_scheme _scheme)
     return 0;
 }
 
+// is scheme LDPC?
+int fec_scheme_is_ldpc(fec_scheme _scheme)
+{
+    switch (_scheme) {
+    case LIQUID_FEC_LDPC_R12:
+    case LIQUID_FEC_LDPC_R23:
+    case LIQUID_FEC_LDPC_R34:
+        return 1;
+    default:;
+    }
+    return 0;
+}
+
 // is scheme Hamming?
 int fec_scheme_is_hamming(fec_scheme _scheme)
 {
@@ -221,6 +237,14 @@ unsigned int fec_get_enc_msg_length(fec_scheme   _scheme,
     case LIQUID_FEC_SECDED3932:     return _msg_len + _msg_len/4 + ((_msg_len%4) ? 1 : 0);
     case LIQUID_FEC_SECDED7264:     return _msg_len + _msg_len/8 + ((_msg_len%8) ? 1 : 0);
 
+    // low-density parity check codes
+    case LIQUID_FEC_LDPC_R12:       return fec_ldpc_get_enc_msg_len(_msg_len,12);
+    case LIQUID_FEC_LDPC_R23:       return fec_ldpc_get_enc_msg_len(_msg_len, 8);
+    case LIQUID_FEC_LDPC_R34:       return fec_ldpc_get_enc_msg_len(_msg_len, 6);
+
+    // Reed-Solomon codes
+    case LIQUID_FEC_RS_M8:          return fec_rs_get_enc_msg_len(_msg_len,32,255,223);
+
 #if LIBFEC_ENABLED
     // convolutional codes
     case LIQUID_FEC_CONV_V27:       return 2*_msg_len + 2;  // (K-1)/r=12, round up to 2 bytes
@@ -241,8 +265,6 @@ unsigned int fec_get_enc_msg_length(fec_scheme   _scheme,
     case LIQUID_FEC_CONV_V29P67:    return fec_conv_get_enc_msg_len(_msg_len,9,6);
     case LIQUID_FEC_CONV_V29P78:    return fec_conv_get_enc_msg_len(_msg_len,9,7);
 
-    // Reed-Solomon codes
-    case LIQUID_FEC_RS_M8:          return fec_rs_get_enc_msg_len(_msg_len,32,255,223);
 #else
     case LIQUID_FEC_CONV_V27:
     case LIQUID_FEC_CONV_V29:
@@ -263,8 +285,6 @@ unsigned int fec_get_enc_msg_length(fec_scheme   _scheme,
     case LIQUID_FEC_CONV_V29P67:
     case LIQUID_FEC_CONV_V29P78:
         liquid_error(LIQUID_EUMODE,"fec_get_enc_msg_length(), convolutional codes unavailable (install libfec)");
-    case LIQUID_FEC_RS_M8:
-        liquid_error(LIQUID_EUMODE,"fec_get_enc_msg_length(), Reed-Solomon codes unavailable (install libfec)");
 #endif
     default:
         liquid_error(LIQUID_EIMODE,"fec_get_enc_msg_length(), unknown/unsupported scheme: %d\n", _scheme);
@@ -410,6 +430,14 @@ float fec_get_rate(fec_scheme _scheme)
     case LIQUID_FEC_SECDED3932:     return 4./5.;   // ultimately 32/39 ~ 0.82051
     case LIQUID_FEC_SECDED7264:     return 8./9.;
 
+    // low-density parity check codes
+    case LIQUID_FEC_LDPC_R12:       return 1./2.;
+    case LIQUID_FEC_LDPC_R23:       return 2./3.;
+    case LIQUID_FEC_LDPC_R34:       return 3./4.;
+
+    // Reed-Solomon codes
+    case LIQUID_FEC_RS_M8:          return 223./255.;
+
     // convolutional codes
 #if LIBFEC_ENABLED
     case LIQUID_FEC_CONV_V27:       return 1./2.;
@@ -429,8 +457,6 @@ float fec_get_rate(fec_scheme _scheme)
     case LIQUID_FEC_CONV_V29P67:    return 6./7.;
     case LIQUID_FEC_CONV_V29P78:    return 7./8.;
 
-    // Reed-Solomon codes
-    case LIQUID_FEC_RS_M8:          return 223./255.;
 #else
     case LIQUID_FEC_CONV_V27:
     case LIQUID_FEC_CONV_V29:
@@ -452,9 +478,6 @@ float fec_get_rate(fec_scheme _scheme)
     case LIQUID_FEC_CONV_V29P78:
         liquid_error(LIQUID_EUMODE,"fec_get_rate(), convolutional codes unavailable (install libfec)");
         return 0.0f;
-    case LIQUID_FEC_RS_M8:
-        liquid_error(LIQUID_EUMODE,"fec_get_rate(), Reed-Solomon codes unavailable (install libfec)");
-        return 0.0f;
 #endif
 
     default:
@@ -486,6 +509,16 @@ fec fec_create(fec_scheme _scheme, void *_opts)
     case LIQUID_FEC_SECDED3932: return fec_secded3932_create(_opts);
     case LIQUID_FEC_SECDED7264: return fec_secded7264_create(_opts);
 
+    // low-density parity check codes
+    case LIQUID_FEC_LDPC_R12:
+    case LIQUID_FEC_LDPC_R23:
+    case LIQUID_FEC_LDPC_R34:
+        return fec_ldpc_create(_scheme);
+
+    // Reed-Solomon codes
+    case LIQUID_FEC_RS_M8:
+        return fec_rs_create(_scheme);
+
     // convolutional codes
 #if LIBFEC_ENABLED
     case LIQUID_FEC_CONV_V27:
@@ -510,9 +543,6 @@ fec fec_create(fec_scheme _scheme, void *_opts)
     case LIQUID_FEC_CONV_V29P78:
         return fec_conv_punctured_create(_scheme);
 
-    // Reed-Solomon codes
-    case LIQUID_FEC_RS_M8:
-        return fec_rs_create(_scheme);
 #else
     case LIQUID_FEC_CONV_V27:
     case LIQUID_FEC_CONV_V29:
@@ -534,9 +564,6 @@ fec fec_create(fec_scheme _scheme, void *_opts)
     case LIQUID_FEC_CONV_V29P78:
         liquid_error(LIQUID_EUMODE,"fec_create(), convolutional codes unavailable (install libfec)");
         return NULL;
-    case LIQUID_FEC_RS_M8:
-        liquid_error(LIQUID_EUMODE,"fec_create(), Reed-Solomon codes unavailable (install libfec)");
-        return NULL;
 #endif
     default:
         liquid_error(LIQUID_EIMODE,"fec_create(), unknown/unsupported scheme: %d", _scheme);
@@ -596,6 +623,16 @@ int fec_destroy(fec _q)
     case LIQUID_FEC_SECDED3932: return fec_secded3932_destroy(_q);
     case LIQUID_FEC_SECDED7264: return fec_secded7264_destroy(_q);
 
+    // low-density parity check codes
+    case LIQUID_FEC_LDPC_R12:
+    case LIQUID_FEC_LDPC_R23:
+    case LIQUID_FEC_LDPC_R34:
+        return fec_ldpc_destroy(_q);
+
+    // Reed-Solomon codes
+    case LIQUID_FEC_RS_M8:
+        return fec_rs_destroy(_q);
+
     // convolutional codes
 #if LIBFEC_ENABLED
     case LIQUID_FEC_CONV_V27:
@@ -619,9 +656,6 @@ int fec_destroy(fec _q)
     case LIQUID_FEC_CONV_V29P78:
         return fec_conv_punctured_destroy(_q);
 
-    // Reed-Solomon codes
-    case LIQUID_FEC_RS_M8:
-        return fec_rs_destroy(_q);
 #else
     case LIQUID_FEC_CONV_V27:
     case LIQUID_FEC_CONV_V29:
@@ -640,8 +674,6 @@ int fec_destroy(fec _q)
     case LIQUID_FEC_CONV_V29P67:
     case LIQUID_FEC_CONV_V29P78:
         return liquid_error(LIQUID_EUMODE,"fec_destroy(), convolutional codes unavailable (install libfec)");
-    case LIQUID_FEC_RS_M8:
-        return liquid_error(LIQUID_EUMODE,"fec_destroy(), Reed-Solomon codes unavailable (install libfec)");
 #endif
     default:
         return liquid_error(LIQUID_EUMODE,"fec_destroy(), unknown/unsupported scheme: %d\n", _q->scheme);
@@ -0,0 +1,554 @@
+/*
+ * Copyright (c) 2007 - 2024 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Low-density parity check (LDPC) codes
+//
+// Quasi-cyclic codes defined by a 24-column base matrix whose entries are
+// cyclic shifts of a z x z identity matrix (or zero blocks). The parity
+// portion of the base matrix has the dual-diagonal structure popularized
+// by IEEE 802.11n/802.16e which allows linear-time encoding directly from
+// the parity-check matrix. Decoding uses layered normalized min-sum with
+// 16-bit posterior values and 8-bit check-to-variable messages, processing
+// all z rows of a layer together, and terminates as soon as all parity
+// checks are satisfied.
+//
+// Messages longer than a single code block are split into several blocks
+// of equal size; short blocks are shortened by implicitly padding the
+// information bits with (untransmitted) zeros. The lifting size z is
+// chosen per message length from {8, 16, ..., 96} with base-matrix shifts
+// scaled from the maximum lifting size. The base matrices are free of
+// 4-cycles for lifting sizes of 64 and above; scaling the shifts down to
+// smaller lifting sizes introduces a few (at most 11 for rate 3/4, z=8).
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#include "liquid.internal.h"
+
+#define VERBOSE_FEC_LDPC    0
+
+// number of columns in base matrix
+#define FEC_LDPC_NB         (24)
+
+// maximum lifting size (shifts in tables are defined at this size)
+#define FEC_LDPC_ZMAX       (96)
+
+// maximum number of decoding iterations
+#define FEC_LDPC_MAX_ITERATIONS (20)
+
+// rate 1/2 base matrix [12 x 24]
+static const short fec_ldpc_r12_Hb[12*FEC_LDPC_NB] = {
+     57, -1, -1, -1,  5, -1, -1, -1, 14, -1, -1, -1,  1,  0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, 63, -1, 85, -1, -1, -1, 70, -1, -1, 54, -1, -1,  0,  0, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, 70, -1, -1, -1, 73, -1, -1, 79, -1, -1, -1, -1, -1,  0,  0, -1, -1, -1, -1, -1, -1, -1, -1,
+     34, -1, 92, -1, -1, -1, -1, -1, -1, 43, -1, -1, -1, -1, -1,  0,  0, -1, -1, -1, -1, -1, -1, -1,
+     -1, 44, -1, 53, -1, -1, 46, -1, -1, -1, -1, 27, -1, -1, -1, -1,  0,  0, -1, -1, -1, -1, -1, -1,
+     29, 86, -1, -1, -1, -1, -1, 74, -1, -1, -1, 16, -1, -1, -1, -1, -1,  0,  0, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, 90, 58, -1, -1, -1, -1, -1, -1,  0, -1, -1, -1, -1, -1,  0,  0, -1, -1, -1, -1,
+     -1, 29, 64, -1, -1, -1, -1, -1, 34, -1, 86, -1, -1, -1, -1, -1, -1, -1, -1,  0,  0, -1, -1, -1,
+     89, -1, -1, -1, -1, 45, -1, -1, -1, 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  0,  0, -1, -1,
+      0, -1, -1, -1, 39, -1,  7, -1, -1, -1, 64, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  0,  0, -1,
+     -1, 29, 91, -1, -1, -1, -1, 22, -1, 24, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  0,  0,
+     92, -1, -1, 51, -1, -1, 61, -1, -1, -1, -1, 38,  1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  0,
+};
+
+// rate 2/3 base matrix [8 x 24]
+static const short fec_ldpc_r23_Hb[8*FEC_LDPC_NB] = {
+     12, -1, -1, 15, -1, -1,  5, -1, 65, -1, -1, 35, -1, -1, 69, -1,  1,  0, -1, -1, -1, -1, -1, -1,
+     -1, 83, 86, -1, -1, 86, -1, -1, -1, 45, -1,  1, -1, -1, 28, -1, -1,  0,  0, -1, -1, -1, -1, -1,
+     -1,  3, 44, -1, -1, -1, 60, -1, 16, -1, -1, 31, 91, -1, -1, -1, -1, -1,  0,  0, -1, -1, -1, -1,
+     62, -1, -1, 92, 63, -1, -1, 29, -1, 53, -1, -1, -1, 93, -1, 80, -1, -1, -1,  0,  0, -1, -1, -1,
+     -1, -1, 29, -1, -1, 70, -1, 69, -1, -1, -1, -1, 82, -1, 54, 54,  0, -1, -1, -1,  0,  0, -1, -1,
+      3,  1, -1, -1, -1, -1, 39, 51, -1, -1, 74, -1, 37, -1, -1, 84, -1, -1, -1, -1, -1,  0,  0, -1,
+     49, -1, -1, -1, 36, 89, -1, -1, -1, 62, 11, -1, -1, 77, -1, -1, -1, -1, -1, -1, -1, -1,  0,  0,
+     -1, 69, -1, 37, 75, -1, -1, -1, 94, -1, 23, -1, -1, 65, -1, -1,  1, -1, -1, -1, -1, -1, -1,  0,
+};
+
+// rate 3/4 base matrix [6 x 24]
+static const short fec_ldpc_r34_Hb[6*FEC_LDPC_NB] = {
+     83, 29, -1, -1, 12, 54, -1, -1,  5, -1, 70, 26, -1, -1,  9, -1, 58, -1,  1,  0, -1, -1, -1, -1,
+     -1, 34, 87, 86, -1, 85, -1, 11, -1, -1, 93, -1, 53, -1, 86, 37, -1, 32, -1,  0,  0, -1, -1, -1,
+     12, 92, -1, 44, -1, 64, -1, 47, -1, 70, -1, -1, 45, -1, 10, -1, 89, 65, -1, -1,  0,  0, -1, -1,
+     -1, 75, -1, -1, 82, -1, 61, 56, -1, -1,  0, -1,  0, 74, -1, 44, -1, -1,  0, -1, -1,  0,  0, -1,
+     26, -1, 48, -1, 23, -1, 95, -1, 60,  1, -1, 54, -1, 22, -1, 23, -1, -1, -1, -1, -1, -1,  0,  0,
+     48, -1, 27, 29, -1, -1,  4, -1, 90, 69, -1, 71, -1, 70, -1, -1, 41, 93,  1, -1, -1, -1, -1,  0,
+};
+
+// posterior limit, leaving headroom for 8-bit messages in 16-bit arithmetic
+#define FEC_LDPC_LMAX       (32767-128)
+
+// number of lanes processed together (lifting size is a multiple of this)
+#define FEC_LDPC_LANES      (8)
+
+fec fec_ldpc_create(fec_scheme _fs)
+{
+    fec q = (fec) malloc(sizeof(struct fec_s));
+
+    q->scheme = _fs;
+    q->rate = fec_get_rate(q->scheme);
+
+    q->encode_func      = &fec_ldpc_encode;
+    q->decode_func      = &fec_ldpc_decode_hard;
+    q->decode_soft_func = &fec_ldpc_decode_soft;
+
+    switch (q->scheme) {
+    case LIQUID_FEC_LDPC_R12: q->ldpc_Hb = fec_ldpc_r12_Hb; q->ldpc_mb = 12; break;
+    case LIQUID_FEC_LDPC_R23: q->ldpc_Hb = fec_ldpc_r23_Hb; q->ldpc_mb =  8; break;
+    case LIQUID_FEC_LDPC_R34: q->ldpc_Hb = fec_ldpc_r34_Hb; q->ldpc_mb =  6; break;
+    default:
+        free(q);
+        return liquid_error_config("fec_ldpc_create(), invalid type");
+    }
+    q->ldpc_kb = FEC_LDPC_NB - q->ldpc_mb;
+
+    // count non-zero blocks in base matrix and build row-major edge list
+    unsigned int r, c;
+    q->ldpc_nnz  = 0;
+    q->ldpc_dmax = 0;
+    for (r=0; r<q->ldpc_mb; r++) {
+        unsigned int d = 0;
+        for (c=0; c<FEC_LDPC_NB; c++)
+            d += q->ldpc_Hb[r*FEC_LDPC_NB + c] >= 0 ? 1 : 0;
+        q->ldpc_nnz += d;
+        q->ldpc_dmax = d > q->ldpc_dmax ? d : q->ldpc_dmax;
+    }
+    q->ldpc_row   = (unsigned int*) malloc((q->ldpc_mb+1)*sizeof(unsigned int));
+    q->ldpc_col   = (unsigned int*) malloc(q->ldpc_nnz*sizeof(unsigned int));
+    q->ldpc_shift = (unsigned int*) malloc(q->ldpc_nnz*sizeof(unsigned int));
+    unsigned int e = 0;
+    for (r=0; r<q->ldpc_mb; r++) {
+        q->ldpc_row[r] = e;
+        for (c=0; c<FEC_LDPC_NB; c++) {
+            if (q->ldpc_Hb[r*FEC_LDPC_NB + c] >= 0)
+                q->ldpc_col[e++] = c;
+        }
+    }
+    q->ldpc_row[q->ldpc_mb] = e;
+
+    // allocate decoder memory for maximum lifting size
+    unsigned int zmax = FEC_LDPC_ZMAX;
+    q->ldpc_L    = (short*)         malloc(FEC_LDPC_NB*zmax*sizeof(short));
+    q->ldpc_R    = (signed char*)   malloc(q->ldpc_nnz*zmax*sizeof(signed char));
+    q->ldpc_Q    = (short*)         malloc((q->ldpc_dmax+5)*zmax*sizeof(short));
+    q->ldpc_bits = (unsigned char*) malloc(FEC_LDPC_NB*zmax*sizeof(unsigned char));
+    q->ldpc_max_iterations = FEC_LDPC_MAX_ITERATIONS;
+
+    // lengths
+    q->num_dec_bytes = 0;
+    q->ldpc_z        = 0;
+    return q;
+}
+
+int fec_ldpc_destroy(fec _q)
+{
+    free(_q->ldpc_row);
+    free(_q->ldpc_col);
+    free(_q->ldpc_shift);
+    free(_q->ldpc_L);
+    free(_q->ldpc_R);
+    free(_q->ldpc_Q);
+    free(_q->ldpc_bits);
+    free(_q);
+    return LIQUID_OK;
+}
+
+// compute encoded message length for LDPC codes
+//  _dec_msg_len    :   decoded message length (bytes)
+//  _mb             :   number of rows in base matrix
+unsigned int fec_ldpc_get_enc_msg_len(unsigned int _dec_msg_len,
+                                      unsigned int _mb)
+{
+    if (_dec_msg_len == 0)
+        return 0;
+
+    // maximum number of information bytes per block
+    unsigned int kb   = FEC_LDPC_NB - _mb;
+    unsigned int kmax = kb*FEC_LDPC_ZMAX/8;
+
+    // number of blocks, bytes per block, and lifting size
+    unsigned int num_blocks    = (_dec_msg_len + kmax - 1) / kmax;
+    unsigned int dec_block_len = (_dec_msg_len + num_blocks - 1) / num_blocks;
+    unsigned int z             = 8*((dec_block_len + kb - 1) / kb);
+
+    // each block adds mb*z parity bits
+    return _dec_msg_len + num_blocks*(_mb*z/8);
+}
+
+// Set dec_msg_len, computing block partitioning and lifting size, and
+// scaling base-matrix shifts accordingly
+int fec_ldpc_setlength(fec _q, unsigned int _dec_msg_len)
+{
+    // return if length has not changed
+    if (_dec_msg_len == _q->num_dec_bytes)
+        return LIQUID_OK;
+
+    _q->num_dec_bytes = _dec_msg_len;
+
+    // compute block partitioning (see fec_ldpc_get_enc_msg_len())
+    unsigned int kb   = _q->ldpc_kb;
+    unsigned int kmax = kb*FEC_LDPC_ZMAX/8;
+    _q->num_blocks    = (_dec_msg_len + kmax - 1) / kmax;
+    _q->dec_block_len = (_dec_msg_len + _q->num_blocks - 1) / _q->num_blocks;
+    _q->res_block_len = _q->num_blocks*_q->dec_block_len - _dec_msg_len;
+    _q->ldpc_z        = 8*((_q->dec_block_len + kb - 1) / kb);
+    _q->enc_block_len = _q->dec_block_len + _q->ldpc_mb*_q->ldpc_z/8;
+    _q->num_enc_bytes = _dec_msg_len + _q->num_blocks*(_q->ldpc_mb*_q->ldpc_z/8);
+
+    // scale shifts to lifting size; the parity portion of the base matrix
+    // retains its (unit) shifts to preserve the encoding structure
+    unsigned int r, e;
+    for (r=0; r<_q->ldpc_mb; r++) {
+        for (e=_q->ldpc_row[r]; e<_q->ldpc_row[r+1]; e++) {
+            unsigned int c = _q->ldpc_col[e];
+            unsigned int s = _q->ldpc_Hb[r*FEC_LDPC_NB + c];
+            _q->ldpc_shift[e] = c < kb ? (s * _q->ldpc_z) / FEC_LDPC_ZMAX : s;
+        }
+    }
+
+#if VERBOSE_FEC_LDPC
+    printf("dec_msg_len     :   %u\n", _q->num_dec_bytes);
+    printf("num_blocks      :   %u\n", _q->num_blocks);
+    printf("dec_block_len   :   %u\n", _q->dec_block_len);
+    printf("enc_block_len   :   %u\n", _q->enc_block_len);
+    printf("res_block_len   :   %u\n", _q->res_block_len);
+    printf("lifting size    :   %u\n", _q->ldpc_z);
+    printf("enc_msg_len     :   %u\n", _q->num_enc_bytes);
+#endif
+    return LIQUID_OK;
+}
+
+// encode block of information bits in place
+//  _q      :   fec object
+//  _v      :   codeword bits, information bits set on input [size: nb*z x 1]
+int fec_ldpc_encode_block(fec             _q,
+                          unsigned char * _v)
+{
+    unsigned int mb = _q->ldpc_mb;
+    unsigned int kb = _q->ldpc_kb;
+    unsigned int z  = _q->ldpc_z;
+    unsigned int r, e, t;
+
+    // compute per-row syndrome of information bits, lambda[r] = sum P^s u,
+    // accumulated into the parity blocks p[1..mb-1] and p[0] (scratch)
+    unsigned char * lambda = (unsigned char*) _q->ldpc_Q;   // [mb*z] scratch
+    memset(lambda, 0x00, mb*z*sizeof(unsigned char));
+    for (r=0; r<mb; r++) {
+        unsigned char * lr = &lambda[r*z];
+        for (e=_q->ldpc_row[r]; e<_q->ldpc_row[r+1]; e++) {
+            unsigned int c = _q->ldpc_col[e];
+            if (c >= kb) break;
+            unsigned int s = _q->ldpc_shift[e];
+            const unsigned char * u = &_v[c*z];
+            for (t=0; t<z-s; t++) lr[t] ^= u[t+s];
+            for (   ; t<z;   t++) lr[t] ^= u[t+s-z];
+        }
+    }
+
+    // find shift of first parity column (rows 0 and mb-1) and its middle
+    // row (unit shift)
+    unsigned int s0 = 0;
+    unsigned int x  = 0;
+    for (e=_q->ldpc_row[0]; e<_q->ldpc_row[1]; e++) {
+        if (_q->ldpc_col[e] == kb) s0 = _q->ldpc_shift[e];
+    }
+    for (r=1; r<mb-1; r++) {
+        if (_q->ldpc_Hb[r*FEC_LDPC_NB + kb] >= 0) x = r;
+    }
+
+    // p[0] = sum of lambda over all rows
+    unsigned char * p0 = &_v[kb*z];
+    memset(p0, 0x00, z*sizeof(unsigned char));
+    for (r=0; r<mb; r++) {
+        for (t=0; t<z; t++) p0[t] ^= lambda[r*z+t];
+    }
+
+    // p[1] = lambda[0] + P^s0 p[0]
+    unsigned char * p = &_v[(kb+1)*z];
+    for (t=0; t<z-s0; t++) p[t] = lambda[t] ^ p0[t+s0];
+    for (   ; t<z;    t++) p[t] = lambda[t] ^ p0[t+s0-z];
+
+    // p[r+1] = p[r] + lambda[r] (+ p[0] if r == x)
+    for (r=1; r<mb-1; r++) {
+        unsigned char * pr = &_v[(kb+r)*z];
+        unsigned char * pn = &_v[(kb+r+1)*z];
+        for (t=0; t<z; t++)
+            pn[t] = pr[t] ^ lambda[r*z+t] ^ (r == x ? p0[t] : 0);
+    }
+    return LIQUID_OK;
+}
+
+// decode block using layered normalized min-sum, returning 1 if all parity
+// checks are satisfied and 0 otherwise; hard decisions are written into
+// the object's bit buffer
+//  _q      :   fec object
+//  _L      :   channel log-likelihood ratios (positive for '0') [size: nb*z x 1]
+int fec_ldpc_decode_block(fec     _q,
+                          short * _L)
+{
+    unsigned int mb = _q->ldpc_mb;
+    unsigned int z  = _q->ldpc_z;
+    unsigned int n  = FEC_LDPC_NB*z;
+    unsigned int r, e, k, t, j, it;
+
+    // layer working buffers; the lifting size is always a multiple of the
+    // number of lanes, so all element-wise loops below run in fixed-width
+    // chunks over contiguous (rotated) buffers
+    short * Q    = _q->ldpc_Q;                          // [dmax*z]
+    short * min1 = &_q->ldpc_Q[(_q->ldpc_dmax+0)*z];    // [z]
+    short * min2 = &_q->ldpc_Q[(_q->ldpc_dmax+1)*z];    // [z]
+    short * idx  = &_q->ldpc_Q[(_q->ldpc_dmax+2)*z];    // [z] index of min1
+    short * sgn  = &_q->ldpc_Q[(_q->ldpc_dmax+3)*z];    // [z] sign product
+    short * T    = &_q->ldpc_Q[(_q->ldpc_dmax+4)*z];    // [z] rotated posterior
+    signed char * R = _q->ldpc_R;
+
+    // limit posterior so that L - R cannot overflow
+    for (t=0; t<n; t++)
+        _L[t] = _L[t] > FEC_LDPC_LMAX ? FEC_LDPC_LMAX : (_L[t] < -FEC_LDPC_LMAX ? -FEC_LDPC_LMAX : _L[t]);
+
+    // clear check-to-variable messages
+    memset(R, 0x00, _q->ldpc_nnz*z*sizeof(signed char));
+
+    int parity_pass = 0;
+    for (it=0; it<_q->ldpc_max_iterations && !parity_pass; it++) {
+        for (r=0; r<mb; r++) {
+            unsigned int e0 = _q->ldpc_row[r];
+            unsigned int d  = _q->ldpc_row[r+1] - e0;
+
+            for (t=0; t<z; t++) {
+                min1[t] = FEC_LDPC_LMAX;
+                min2[t] = FEC_LDPC_LMAX;
+                idx[t]  = 0;
+                sgn[t]  = 0;
+            }
+
+            // variable-to-check messages: Q = L - R, aligned to the layer;
+            // track two smallest magnitudes, index of smallest, and sign
+            for (k=0; k<d; k++) {
+                e = e0 + k;
+                unsigned int s = _q->ldpc_shift[e];
+                const short * Lc = &_L[_q->ldpc_col[e]*z];
+                const signed char * Re = &R[e*z];
+                short * Qk = &Q[k*z];
+                memmove(T,     &Lc[s], (z-s)*sizeof(short));
+                memmove(&T[z-s], Lc,    s   *sizeof(short));
+                for (t=0; t<z; t+=FEC_LDPC_LANES) {
+                    for (j=t; j<t+FEC_LDPC_LANES; j++) {
+                        short q  = T[j] - Re[j];
+                        short a  = q < 0 ? -q : q;
+                        short m1 = min1[j];
+                        short m2 = min2[j];
+                        Qk[j]   = q;
+                        min2[j] = a < m1 ? m1 : (a < m2 ? a : m2);
+                        min1[j] = a < m1 ? a  : m1;
+                        idx[j]  = a < m1 ? (short)k : idx[j];
+                        sgn[j] ^= q < 0 ? 1 : 0;
+                    }
+                }
+            }
+
+            // normalize (scale by 3/4) and limit to 8-bit message range
+            for (t=0; t<z; t+=FEC_LDPC_LANES) {
+                for (j=t; j<t+FEC_LDPC_LANES; j++) {
+                    short m1 = (3*min1[j]) >> 2;
+                    short m2 = (3*min2[j]) >> 2;
+                    min1[j] = m1 > 127 ? 127 : m1;
+                    min2[j] = m2 > 127 ? 127 : m2;
+                }
+            }
+
+            // check-to-variable messages and posterior update: L = Q + R
+            for (k=0; k<d; k++) {
+                e = e0 + k;
+                unsigned int s = _q->ldpc_shift[e];
+                short * Lc = &_L[_q->ldpc_col[e]*z];
+                signed char * Re = &R[e*z];
+                const short * Qk = &Q[k*z];
+                for (t=0; t<z; t+=FEC_LDPC_LANES) {
+                    for (j=t; j<t+FEC_LDPC_LANES; j++) {
+                        short mag = idx[j] == (short)k ? min2[j] : min1[j];
+                        short neg = sgn[j] ^ (Qk[j] < 0 ? 1 : 0);
+                        short rv  = neg ? -mag : mag;
+                        int   lv  = Qk[j] + rv;
+                        Re[j] = (signed char)rv;
+                        T[j]  = lv > FEC_LDPC_LMAX ? FEC_LDPC_LMAX : (lv < -FEC_LDPC_LMAX ? -FEC_LDPC_LMAX : lv);
+                    }
+                }
+                memmove(&Lc[s], T,        (z-s)*sizeof(short));
+                memmove(Lc,     &T[z-s],  s   *sizeof(short));
+            }
+        }
+
+        // hard decisions and parity check (early termination)
+        for (t=0; t<n; t++)
+            _q->ldpc_bits[t] = _L[t] < 0 ? 1 : 0;
+        parity_pass = 1;
+        unsigned char * syn = (unsigned char*) T;   // [z]
+        unsigned char * rot = (unsigned char*) Q;   // [z]
+        for (r=0; r<mb && parity_pass; r++) {
+            memset(syn, 0x00, z*sizeof(unsigned char));
+            for (e=_q->ldpc_row[r]; e<_q->ldpc_row[r+1]; e++) {
+                unsigned int s = _q->ldpc_shift[e];
+                const unsigned char * v = &_q->ldpc_bits[_q->ldpc_col[e]*z];
+                memmove(rot,       &v[s], (z-s)*sizeof(unsigned char));
+                memmove(&rot[z-s], v,     s   *sizeof(unsigned char));
+                for (t=0; t<z; t+=FEC_LDPC_LANES) {
+                    for (j=t; j<t+FEC_LDPC_LANES; j++)
+                        syn[j] ^= rot[j];
+                }
+            }
+            unsigned char any = 0;
+            for (t=0; t<z; t+=FEC_LDPC_LANES) {
+                for (j=t; j<t+FEC_LDPC_LANES; j++)
+                    any |= syn[j];
+            }
+            parity_pass = any ? 0 : 1;
+        }
+    }
+    return parity_pass;
+}
+
+int fec_ldpc_encode(fec             _q,
+                    unsigned int    _dec_msg_len,
+                    unsigned char * _msg_dec,
+                    unsigned char * _msg_enc)
+{
+    // validate input
+    if (_dec_msg_len == 0)
+        return liquid_error(LIQUID_EICONFIG,"fec_ldpc_encode(), input length must be > 0");
+
+    // re-allocate resources if necessary
+    fec_ldpc_setlength(_q, _dec_msg_len);
+
+    unsigned int z = _q->ldpc_z;
+    unsigned int num_parity_bytes = _q->ldpc_mb*z/8;
+    unsigned int num_written;
+
+    unsigned int i;
+    unsigned int n0=0;  // input index
+    unsigned int n1=0;  // output index
+    unsigned int block_size = _q->dec_block_len;
+    for (i=0; i<_q->num_blocks; i++) {
+        // the last block is smaller by the residual block length
+        if (i == _q->num_blocks-1)
+            block_size -= _q->res_block_len;
+
+        // unpack information bits, padding remainder with zeros
+        memset(_q->ldpc_bits, 0x00, _q->ldpc_kb*z*sizeof(unsigned char));
+        liquid_unpack_bytes(&_msg_dec[n0], block_size, _q->ldpc_bits, 8*block_size, &num_written);
+
+        // compute parity bits
+        fec_ldpc_encode_block(_q, _q->ldpc_bits);
+
+        // write systematic bytes followed by parity bytes
+        memmove(&_msg_enc[n1], &_msg_dec[n0], block_size*sizeof(unsigned char));
+        liquid_pack_bytes(&_q->ldpc_bits[_q->ldpc_kb*z], 8*num_parity_bytes,
+                          &_msg_enc[n1+block_size], num_parity_bytes, &num_written);
+
+        // increment counters
+        n0 += block_size;
+        n1 += block_size + num_parity_bytes;
+    }
+
+    // sanity check
+    assert( n0 == _q->num_dec_bytes );
+    assert( n1 == _q->num_enc_bytes );
+    return LIQUID_OK;
+}
+
+int fec_ldpc_decode_hard(fec             _q,
+                         unsigned int    _dec_msg_len,
+                         unsigned char * _msg_enc,
+                         unsigned char * _msg_dec)
+{
+    // validate input
+    if (_dec_msg_len == 0)
+        return liquid_error(LIQUID_EICONFIG,"fec_ldpc_decode_hard(), input length must be > 0");
+
+    // expand to soft bits and decode
+    unsigned int enc_msg_len = fec_get_enc_msg_length(_q->scheme, _dec_msg_len);
+    unsigned char * msg_soft = (unsigned char*) malloc(8*enc_msg_len*sizeof(unsigned char));
+    unsigned int i;
+    for (i=0; i<8*enc_msg_len; i++)
+        msg_soft[i] = (_msg_enc[i/8] >> (7-(i%8))) & 1 ? LIQUID_SOFTBIT_1 : LIQUID_SOFTBIT_0;
+    int rc = fec_ldpc_decode_soft(_q, _dec_msg_len, msg_soft, _msg_dec);
+    free(msg_soft);
+    return rc;
+}
+
+int fec_ldpc_decode_soft(fec             _q,
+                         unsigned int    _dec_msg_len,
+                         unsigned char * _msg_enc,
+                         unsigned char * _msg_dec)
+{
+    // validate input
+    if (_dec_msg_len == 0)
+        return liquid_error(LIQUID_EICONFIG,"fec_ldpc_decode_soft(), input length must be > 0");
+
+    // re-allocate resources if necessary
+    fec_ldpc_setlength(_q, _dec_msg_len);
+
+    unsigned int z  = _q->ldpc_z;
+    unsigned int kz = _q->ldpc_kb*z;
+    unsigned int num_parity_bits = _q->ldpc_mb*z;
+    unsigned int num_written;
+    short * L = _q->ldpc_L;
+
+    unsigned int i;
+    unsigned int j;
+    unsigned int n0=0;  // input index (soft bits)
+    unsigned int n1=0;  // output index (bytes)
+    unsigned int block_size = _q->dec_block_len;
+    for (i=0; i<_q->num_blocks; i++) {
+        // the last block is smaller by the residual block length
+        if (i == _q->num_blocks-1)
+            block_size -= _q->res_block_len;
+
+        // convert soft bits to log-likelihood ratios (positive for '0');
+        // shortened information bits are known zeros
+        unsigned int num_info_bits = 8*block_size;
+        for (j=0; j<num_info_bits; j++)
+            L[j] = 127 - (short)_msg_enc[n0 + j];
+        for (   ; j<kz; j++)
+            L[j] = FEC_LDPC_LMAX;
+        for (j=0; j<num_parity_bits; j++)
+            L[kz+j] = 127 - (short)_msg_enc[n0 + num_info_bits + j];
+
+        // run decoder
+        fec_ldpc_decode_block(_q, L);
+
+        // pack information bits
+        liquid_pack_bytes(_q->ldpc_bits, num_info_bits, &_msg_dec[n1], block_size, &num_written);
+
+        // increment counters
+        n0 += num_info_bits + num_parity_bits;
+        n1 += block_size;
+    }
+
+    // sanity check
+    assert( n0 == 8*_q->num_enc_bytes );
+    assert( n1 == _q->num_dec_bytes );
+    return LIQUID_OK;
+}
@@ -21,7 +21,20 @@
  */
 
 //
-// Reed-Solomon (macros)
+// Reed-Solomon codec
+//
+// In-tree implementation of the shortened RS(255,223) code over GF(2^8)
+// with the same conventions as libfec (field polynomial 0x11d, first
+// consecutive root alpha^1, data followed by parity) so encoded blocks
+// are interchangeable. All field tables are computed once when the
+// object is created; changing the message length only recomputes the
+// block layout.
+//
+// Multiplication by a variable symbol c is split over its nibbles,
+//      c*x = c*(x & 0x0f) ^ c*(x & 0xf0),
+// so that the encoder (fixed generator coefficients) and the syndrome
+// computation (fixed powers of alpha) each reduce to 16-entry table
+// look-ups that map directly onto byte shuffles.
 //
 
 #include <stdio.h>
@@ -29,12 +42,101 @@
 #include <string.h>
 #include <assert.h>
 
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
+
 #include "liquid.internal.h"
 
 #define VERBOSE_FEC_RS    0
 
-#if LIBFEC_ENABLED
-#include "fec.h"
+// number of parity symbols for each block
+#define FEC_RS_NROOTS   (32)
+
+// internal codec tables
+struct fec_rs_codec_s {
+    unsigned char alpha_to[256];                // antilog table: alpha^i
+    unsigned char index_of[256];                // log table (index_of[0] = nn)
+    unsigned char genpoly[FEC_RS_NROOTS+1];     // generator polynomial (index form)
+    unsigned char enc_lo[16][FEC_RS_NROOTS];    // (n   ) * genpoly, reversed
+    unsigned char enc_hi[16][FEC_RS_NROOTS];    // (n<<4) * genpoly, reversed
+    unsigned char mul_lo[256][16];              // c * (n   )
+    unsigned char mul_hi[256][16];              // c * (n<<4)
+    unsigned char syn_pow[255][FEC_RS_NROOTS];  // alpha^((fcs+j)*k) for syndrome j, degree k
+};
+
+// compute (_a + _b) mod 255 for _a, _b in [0,255)
+#define FEC_RS_MODNN(X) ((X) >= 255 ? (X) - 255 : (X))
+
+// multiply two field elements (normal form)
+static unsigned char fec_rs_mul(struct fec_rs_codec_s * _c,
+                                unsigned char           _a,
+                                unsigned char           _b)
+{
+    if (_a == 0 || _b == 0)
+        return 0;
+    return _c->alpha_to[FEC_RS_MODNN(_c->index_of[_a] + _c->index_of[_b])];
+}
+
+// initialize codec tables from object parameters
+static int fec_rs_codec_init(fec _q)
+{
+    struct fec_rs_codec_s * c = (struct fec_rs_codec_s *) _q->rs;
+    unsigned int nn = _q->nn;
+    unsigned int i, j;
+
+    // generate Galois field lookup tables
+    unsigned int sr = 1;
+    c->index_of[0]  = nn;   // log(zero) = -inf
+    c->alpha_to[nn] = 0;    // alpha^-inf = zero
+    for (i=0; i<nn; i++) {
+        c->index_of[sr] = i;
+        c->alpha_to[i]  = sr;
+        sr <<= 1;
+        if (sr & (1 << _q->symsize))
+            sr ^= _q->genpoly;
+        sr &= nn;
+    }
+    if (sr != 1)
+        return liquid_error(LIQUID_EICONFIG,"fec_rs_codec_init(), field polynomial is not primitive");
+
+    // form generator polynomial from its roots, alpha^(fcs+i)
+    unsigned char g[FEC_RS_NROOTS+1];
+    g[0] = 1;
+    for (i=0; i<FEC_RS_NROOTS; i++) {
+        unsigned char root = c->alpha_to[(_q->fcs + i) % nn];
+        g[i+1] = 1;
+        for (j=i; j>0; j--)
+            g[j] = g[j-1] ^ fec_rs_mul(c, g[j], root);
+        g[0] = fec_rs_mul(c, g[0], root);
+    }
+    for (i=0; i<=FEC_RS_NROOTS; i++)
+        c->genpoly[i] = c->index_of[g[i]];
+
+    // encoder feedback tables: entry t holds the product with the
+    // coefficient applied to parity register t+1, g[nroots-1-t]
+    for (i=0; i<16; i++) {
+        for (j=0; j<FEC_RS_NROOTS; j++) {
+            c->enc_lo[i][j] = fec_rs_mul(c, i,    g[FEC_RS_NROOTS-1-j]);
+            c->enc_hi[i][j] = fec_rs_mul(c, i<<4, g[FEC_RS_NROOTS-1-j]);
+        }
+    }
+
+    // nibble multiplication tables
+    for (i=0; i<256; i++) {
+        for (j=0; j<16; j++) {
+            c->mul_lo[i][j] = fec_rs_mul(c, i, j);
+            c->mul_hi[i][j] = fec_rs_mul(c, i, j<<4);
+        }
+    }
+
+    // syndrome evaluation tables
+    for (i=0; i<nn; i++) {
+        for (j=0; j<FEC_RS_NROOTS; j++)
+            c->syn_pow[i][j] = c->alpha_to[((_q->fcs + j)*i) % nn];
+    }
+    return LIQUID_OK;
+}
 
 fec fec_rs_create(fec_scheme _fs)
 {
@@ -49,7 +151,9 @@ fec fec_rs_create(fec_scheme _fs)
 
     switch (q->scheme) {
     case LIQUID_FEC_RS_M8: fec_rs_init_p8(q); break;
-    default: return liquid_error_config("fec_rs_create(), invalid type");
+    default:
+        free(q);
+        return liquid_error_config("fec_rs_create(), invalid type");
     }
 
     // initialize basic parameters
@@ -58,27 +162,24 @@ fec fec_rs_create(fec_scheme _fs)
 
     // lengths
     q->num_dec_bytes = 0;
-    q->rs = NULL;
 
-    // allocate memory for arrays
-    q->tblock   = (unsigned char*) malloc(q->nn*sizeof(unsigned char));
-    q->errlocs  = (int *) malloc(q->nn*sizeof(int));
-    q->derrlocs = (int *) malloc(q->nn*sizeof(int));
+    // build codec tables; these do not depend on the message length
+    q->rs = malloc(sizeof(struct fec_rs_codec_s));
+    if (fec_rs_codec_init(q) != LIQUID_OK) {
+        fec_rs_destroy(q);
+        return liquid_error_config("fec_rs_create(), could not initialize codec");
+    }
 
+    // allocate memory for arrays: parity shift register
+    q->tblock = (unsigned char*) malloc((q->nn+1)*sizeof(unsigned char));
     return q;
 }
 
 int fec_rs_destroy(fec _q)
 {
-    // delete internal Reed-Solomon decoder object
-    if (_q->rs != NULL) {
-        free_rs_char(_q->rs);
-    }
-
-    // delete internal memory arrays
+    // delete internal codec tables and memory arrays
+    free(_q->rs);
     free(_q->tblock);
-    free(_q->errlocs);
-    free(_q->derrlocs);
 
     // delete fec object
     free(_q);
@@ -94,7 +195,7 @@ int fec_rs_encode(fec             _q,
     if (_dec_msg_len == 0)
         return liquid_error(LIQUID_EICONFIG,"fec_rs_encode(), input length must be > 0");
 
-    // re-allocate resources if necessary
+    // update block layout if necessary
     fec_rs_setlength(_q, _dec_msg_len);
 
     unsigned int i;
@@ -107,17 +208,12 @@ int fec_rs_encode(fec             _q,
         if (i == _q->num_blocks-1)
             block_size -= _q->res_block_len;
 
-        // copy sequence
-        memmove(_q->tblock, &_msg_dec[n0], block_size*sizeof(unsigned char));
-
-        // last block: we could pad end with zeros, but it's not really
-        // necessary as these bits are going to be thrown away anyway
+        // copy data to output, padding the last block with zeros
+        memmove(&_msg_enc[n1], &_msg_dec[n0], block_size*sizeof(unsigned char));
+        memset(&_msg_enc[n1+block_size], 0x00, (_q->dec_block_len-block_size)*sizeof(unsigned char));
 
-        // encode data, appending parity bits to end of sequence
-        encode_rs_char(_q->rs, _q->tblock, &_q->tblock[_q->dec_block_len]);
-
-        // copy result to output
-        memmove(&_msg_enc[n1], _q->tblock, _q->enc_block_len*sizeof(unsigned char));
+        // encode data, appending parity symbols to end of sequence
+        fec_rs_encode_block(_q, &_msg_enc[n1], &_msg_enc[n1+_q->dec_block_len]);
 
         // increment counters
         n0 += block_size;
@@ -138,39 +234,24 @@ int fec_rs_decode(fec             _q,
 {
     // validate input
     if (_dec_msg_len == 0)
-        return liquid_error(LIQUID_EICONFIG,"fec_rs_encode(), input length must be > 0");
+        return liquid_error(LIQUID_EICONFIG,"fec_rs_decode(), input length must be > 0");
 
-    // re-allocate resources if necessary
+    // update block layout if necessary
     fec_rs_setlength(_q, _dec_msg_len);
 
-    // set erasures, error locations to zero
-    memset(_q->errlocs,  0x00, _q->nn*sizeof(unsigned char));
-    memset(_q->derrlocs, 0x00, _q->nn*sizeof(unsigned char));
-    _q->erasures = 0;
-
     unsigned int i;
     unsigned int n0=0;
     unsigned int n1=0;
     unsigned int block_size = _q->dec_block_len;
-    //int derrors; // number of decoder errors
     for (i=0; i<_q->num_blocks; i++) {
 
         // the last block is smaller by the residual block length
         if (i == _q->num_blocks-1)
             block_size -= _q->res_block_len;
 
-        // copy sequence
-        memmove(_q->tblock, &_msg_enc[n0], _q->enc_block_len*sizeof(unsigned char));
-
-        // decode block
-        //derrors = 
-        decode_rs_char(_q->rs,
-                       _q->tblock,
-                       _q->derrlocs,
-                       _q->erasures);
-
-        // copy result
-        memmove(&_msg_dec[n1], _q->tblock, block_size*sizeof(unsigned char));
+        // copy data and correct in place
+        memmove(&_msg_dec[n1], &_msg_enc[n0], block_size*sizeof(unsigned char));
+        fec_rs_decode_block(_q, &_msg_enc[n0], &_msg_dec[n1], block_size);
 
         // increment counters
         n0 += _q->enc_block_len;
@@ -183,9 +264,10 @@ int fec_rs_decode(fec             _q,
     return LIQUID_OK;
 }
 
-// Set dec_msg_len, re-allocating resources as necessary.  Effectively, it
-// divides the input message into several blocks and allows the decoder to
-// pad each block appropriately.
+// Set dec_msg_len, updating the block layout as necessary.  Effectively,
+// it divides the input message into several blocks and allows the decoder
+// to pad each block appropriately. The codec tables are independent of the
+// length so switching between packet sizes only recomputes these values.
 //
 // For example : if we are using the 8-bit code,
 //      nroots  = 32
@@ -210,10 +292,11 @@ int fec_rs_decode(fec             _q,
 //
 // Thus, the 1024-byte input message is broken into 5 blocks, the first
 // four have a length 205, and the last block has a length 204 (which is
-// externally padded to 205, e.g. res_block_len = 1). This code adds 32
-// parity symbols, so each block is extended to 237 bytes. libfec auto-
-// matically extends the internal data to 255 bytes by padding with 18
-// symbols.  Therefore, the final output length is 237 * 5 = 1185 symbols.
+// padded with a zero to 205, e.g. res_block_len = 1). This code adds 32
+// parity symbols, so each block is extended to 237 bytes. The code is
+// shortened by implicitly extending the internal data to 255 bytes with
+// 18 leading zero symbols.  Therefore, the final output length is
+// 237 * 5 = 1185 symbols.
 int fec_rs_setlength(fec _q, unsigned int _dec_msg_len)
 {
     // return if length has not changed
@@ -240,7 +323,7 @@ int fec_rs_setlength(fec _q, unsigned int _dec_msg_len)
     // mod(num_blocks*dec_block_len, num_dec_bytes)
     _q->res_block_len = (_q->num_blocks*_q->dec_block_len) % _q->num_dec_bytes;
 
-    // compute the internal libfec padding factor: kk - dec_block_len
+    // compute the shortening factor: kk - dec_block_len
     _q->pad = _q->kk - _q->dec_block_len;
 
     // compute the final encoded block length: enc_block_len * num_blocks
@@ -255,63 +338,279 @@ int fec_rs_setlength(fec _q, unsigned int _dec_msg_len)
     printf("pad             :   %u\n", _q->pad);
     printf("enc_msg_len     :   %u\n", _q->num_enc_bytes);
 #endif
-
-    // delete old decoder if necessary
-    if (_q->rs != NULL)
-        free_rs_char(_q->rs);
-
-    // Reed-Solomon specific decoding
-    _q->rs = init_rs_char(_q->symsize,
-                          _q->genpoly,
-                          _q->fcs,
-                          _q->prim,
-                          _q->nroots,
-                          _q->pad);
     return LIQUID_OK;
 }
 
-// 
-// internal
-//
-
-int fec_rs_init_p8(fec _q)
+// encode single block
+//  _q      :   fec object with block layout set
+//  _data   :   data symbols, [size: dec_block_len x 1]
+//  _parity :   output parity symbols, [size: nroots x 1]
+int fec_rs_encode_block(fec             _q,
+                        unsigned char * _data,
+                        unsigned char * _parity)
 {
-    _q->symsize = 8;
-    _q->genpoly = 0x11d;
-    _q->fcs = 1;
-    _q->prim = 1;
-    _q->nroots = 32;
-    return LIQUID_OK;
-}
+    struct fec_rs_codec_s * c = (struct fec_rs_codec_s *) _q->rs;
+    unsigned int k = _q->dec_block_len;
 
-#else   // LIBFEC_ENABLED
+    // systematic encoder: divide data polynomial by the generator with a
+    // linear feedback shift register of nroots symbols
+    unsigned int i;
+#if defined(__SSSE3__)
+    // keep the register in two vectors, shifting one symbol per step
+    __m128i r0 = _mm_setzero_si128();
+    __m128i r1 = _mm_setzero_si128();
+    for (i=0; i<k; i++) {
+        unsigned char feedback = _data[i] ^ (unsigned char)_mm_cvtsi128_si32(r0);
+        const unsigned char * lo = c->enc_lo[feedback & 0x0f];
+        const unsigned char * hi = c->enc_hi[feedback >> 4  ];
+        __m128i g0 = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(lo   )),
+                                   _mm_loadu_si128((const __m128i*)(hi   )));
+        __m128i g1 = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(lo+16)),
+                                   _mm_loadu_si128((const __m128i*)(hi+16)));
+        r0 = _mm_xor_si128(_mm_alignr_epi8(r1, r0, 1), g0);
+        r1 = _mm_xor_si128(_mm_srli_si128(r1, 1),      g1);
+    }
+    _mm_storeu_si128((__m128i*)(_parity   ), r0);
+    _mm_storeu_si128((__m128i*)(_parity+16), r1);
+#else
+    // Run the shift register over a sliding window of the working buffer
+    // rather than shifting the register itself: at step i the register
+    // occupies r[i..i+nroots-1].
+    unsigned char * r = _q->tblock;
+    memset(r, 0x00, (k+FEC_RS_NROOTS)*sizeof(unsigned char));
+
+    unsigned int j;
+    for (i=0; i<k; i++) {
+        unsigned char feedback = _data[i] ^ r[i];
+        const unsigned char * lo = c->enc_lo[feedback & 0x0f];
+        const unsigned char * hi = c->enc_hi[feedback >> 4  ];
+        unsigned char * v = &r[i+1];
+        for (j=0; j<FEC_RS_NROOTS; j++)
+            v[j] ^= lo[j] ^ hi[j];
+    }
 
-fec fec_rs_create(fec_scheme _fs)
-{
-    return liquid_error_config("fec_rs_create(), libfec not installed");
+    memmove(_parity, &r[k], FEC_RS_NROOTS*sizeof(unsigned char));
+#endif
+    return LIQUID_OK;
 }
 
-int fec_rs_destroy(fec _q)
+// compute syndromes of received block
+//  _q      :   fec object
+//  _r      :   received block, [size: _n x 1]
+//  _n      :   block length
+//  _s      :   output syndromes (normal form), [size: nroots x 1]
+static void fec_rs_syndromes(fec             _q,
+                             unsigned char * _r,
+                             unsigned int    _n,
+                             unsigned char * _s)
 {
-    return liquid_error(LIQUID_EUMODE,"fec_rs_destroy(), libfec not installed");
-}
+    struct fec_rs_codec_s * c = (struct fec_rs_codec_s *) _q->rs;
+    unsigned int i;
 
-int fec_rs_encode(fec _q,
-                   unsigned int _dec_msg_len,
-                   unsigned char *_msg_dec,
-                   unsigned char *_msg_enc)
-{
-    return liquid_error(LIQUID_EUMODE,"fec_rs_encode(), libfec not installed");
+    // S_j = sum_i r[i] alpha^((fcs+j)*(n-1-i)); symbol r[i] scales the
+    // row of root powers for its degree, one shuffle per nibble
+#if defined(__SSSE3__)
+    __m128i mask = _mm_set1_epi8(0x0f);
+    __m128i s0   = _mm_setzero_si128();
+    __m128i s1   = _mm_setzero_si128();
+    for (i=0; i<_n; i++) {
+        unsigned char v = _r[i];
+        if (v == 0)
+            continue;
+        __m128i tlo = _mm_loadu_si128((const __m128i*) c->mul_lo[v]);
+        __m128i thi = _mm_loadu_si128((const __m128i*) c->mul_hi[v]);
+        const unsigned char * p = c->syn_pow[_n-1-i];
+        __m128i p0 = _mm_loadu_si128((const __m128i*)(p   ));
+        __m128i p1 = _mm_loadu_si128((const __m128i*)(p+16));
+        s0 = _mm_xor_si128(s0, _mm_shuffle_epi8(tlo, _mm_and_si128(p0, mask)));
+        s0 = _mm_xor_si128(s0, _mm_shuffle_epi8(thi, _mm_and_si128(_mm_srli_epi16(p0,4), mask)));
+        s1 = _mm_xor_si128(s1, _mm_shuffle_epi8(tlo, _mm_and_si128(p1, mask)));
+        s1 = _mm_xor_si128(s1, _mm_shuffle_epi8(thi, _mm_and_si128(_mm_srli_epi16(p1,4), mask)));
+    }
+    _mm_storeu_si128((__m128i*)(_s   ), s0);
+    _mm_storeu_si128((__m128i*)(_s+16), s1);
+#else
+    unsigned int j;
+    memset(_s, 0x00, FEC_RS_NROOTS*sizeof(unsigned char));
+    for (i=0; i<_n; i++) {
+        unsigned char v = _r[i];
+        if (v == 0)
+            continue;
+        const unsigned char * tlo = c->mul_lo[v];
+        const unsigned char * thi = c->mul_hi[v];
+        const unsigned char * p   = c->syn_pow[_n-1-i];
+        for (j=0; j<FEC_RS_NROOTS; j++)
+            _s[j] ^= tlo[p[j] & 0x0f] ^ thi[p[j] >> 4];
+    }
+#endif
 }
 
-//unsigned int
-int fec_rs_decode(fec _q,
-                   unsigned int _dec_msg_len,
-                   unsigned char *_msg_enc,
-                   unsigned char *_msg_dec)
+// decode single block, correcting data symbols in place
+//  _q          :   fec object with block layout set
+//  _r          :   received block, [size: enc_block_len x 1]
+//  _data       :   output data symbols to correct, [size: _num_data x 1]
+//  _num_data   :   number of data symbols to write (<= dec_block_len)
+//  returns number of corrected symbols, or -1 if block is uncorrectable
+int fec_rs_decode_block(fec             _q,
+                        unsigned char * _r,
+                        unsigned char * _data,
+                        unsigned int    _num_data)
 {
-    return liquid_error(LIQUID_EUMODE,"fec_rs_decode(), libfec not installed");
+    struct fec_rs_codec_s * c = (struct fec_rs_codec_s *) _q->rs;
+    const unsigned char * alpha_to = c->alpha_to;
+    const unsigned char * index_of = c->index_of;
+    unsigned int nn  = _q->nn;
+    unsigned int pad = _q->pad;
+    int A0 = nn;    // log of zero
+    int i, j;
+
+    // compute syndromes; nothing to do for a valid codeword
+    unsigned char syn[FEC_RS_NROOTS];
+    fec_rs_syndromes(_q, _r, _q->enc_block_len, syn);
+    unsigned char syn_or = 0;
+    for (i=0; i<FEC_RS_NROOTS; i++)
+        syn_or |= syn[i];
+    if (syn_or == 0)
+        return 0;
+
+    int s[FEC_RS_NROOTS];
+    for (i=0; i<FEC_RS_NROOTS; i++)
+        s[i] = index_of[syn[i]];
+
+    // Berlekamp-Massey: find error locator polynomial, lambda(x)
+    unsigned char lambda[FEC_RS_NROOTS+1];
+    unsigned char t[FEC_RS_NROOTS+1];
+    int b[FEC_RS_NROOTS+1];
+    memset(lambda, 0x00, sizeof(lambda));
+    lambda[0] = 1;
+    for (i=0; i<=FEC_RS_NROOTS; i++)
+        b[i] = index_of[lambda[i]];
+
+    int r  = 0;
+    int el = 0;
+    while (++r <= FEC_RS_NROOTS) {
+        // compute discrepancy at step r
+        unsigned char discr = 0;
+        for (i=0; i<r; i++) {
+            if (lambda[i] != 0 && s[r-i-1] != A0)
+                discr ^= alpha_to[(index_of[lambda[i]] + s[r-i-1]) % nn];
+        }
+        int discr_r = index_of[discr];
+        if (discr_r == A0) {
+            // B(x) <- x*B(x)
+            memmove(&b[1], b, FEC_RS_NROOTS*sizeof(int));
+            b[0] = A0;
+            continue;
+        }
+
+        // T(x) <- lambda(x) - discr*x*B(x)
+        t[0] = lambda[0];
+        for (i=0; i<FEC_RS_NROOTS; i++)
+            t[i+1] = b[i] != A0 ? lambda[i+1] ^ alpha_to[(discr_r + b[i]) % nn] : lambda[i+1];
+
+        if (2*el <= r-1) {
+            el = r - el;
+            // B(x) <- inv(discr) * lambda(x)
+            for (i=0; i<=FEC_RS_NROOTS; i++)
+                b[i] = lambda[i] == 0 ? A0 : (int)((index_of[lambda[i]] - discr_r + nn) % nn);
+        } else {
+            // B(x) <- x*B(x)
+            memmove(&b[1], b, FEC_RS_NROOTS*sizeof(int));
+            b[0] = A0;
+        }
+        memmove(lambda, t, sizeof(lambda));
+    }
+
+    // convert lambda to index form and find its degree
+    int lam[FEC_RS_NROOTS+1];
+    int deg_lambda = 0;
+    for (i=0; i<=FEC_RS_NROOTS; i++) {
+        lam[i] = index_of[lambda[i]];
+        if (lam[i] != A0)
+            deg_lambda = i;
+    }
+    if (deg_lambda == 0 || deg_lambda > FEC_RS_NROOTS/2)
+        return -1;
+
+    // Chien search for roots of lambda(x); only positions inside the
+    // shortened block are searched, so the register starts at step pad
+    int reg[FEC_RS_NROOTS+1];
+    int root[FEC_RS_NROOTS];
+    int loc [FEC_RS_NROOTS];
+    int count = 0;
+    for (j=1; j<=deg_lambda; j++)
+        reg[j] = lam[j] == A0 ? A0 : (int)((lam[j] + j*pad) % nn);
+    for (i=pad+1; i<=(int)nn; i++) {
+        unsigned char q = 1;
+        for (j=deg_lambda; j>0; j--) {
+            if (reg[j] != A0) {
+                reg[j] = FEC_RS_MODNN(reg[j] + j);
+                q ^= alpha_to[reg[j]];
+            }
+        }
+        if (q != 0)
+            continue;
+
+        // store root (index form) and error location in block
+        root[count] = i;
+        loc [count] = i - 1 - pad;
+        if (++count == deg_lambda)
+            break;
+    }
+
+    // uncorrectable: number of roots does not match degree of lambda
+    if (count != deg_lambda)
+        return -1;
+
+    // compute error evaluator polynomial omega(x) = s(x)*lambda(x) mod x^nroots
+    int omega[FEC_RS_NROOTS];
+    int deg_omega = deg_lambda - 1;
+    for (i=0; i<=deg_omega; i++) {
+        unsigned char tmp = 0;
+        for (j=i; j>=0; j--) {
+            if (s[i-j] != A0 && lam[j] != A0)
+                tmp ^= alpha_to[(s[i-j] + lam[j]) % nn];
+        }
+        omega[i] = index_of[tmp];
+    }
+
+    // Forney: compute error values and correct data symbols
+    for (j=count-1; j>=0; j--) {
+        unsigned char num1 = 0;
+        for (i=deg_omega; i>=0; i--) {
+            if (omega[i] != A0)
+                num1 ^= alpha_to[(omega[i] + i*root[j]) % nn];
+        }
+        if (num1 == 0 || loc[j] >= (int)_num_data)
+            continue;
+
+        unsigned char num2 = alpha_to[(root[j]*(_q->fcs-1) + nn) % nn];
+
+        // lambda[i+1] for even i is the formal derivative of lambda
+        unsigned char den = 0;
+        int imax = (deg_lambda < FEC_RS_NROOTS-1 ? deg_lambda : FEC_RS_NROOTS-1) & ~1;
+        for (i=imax; i>=0; i-=2) {
+            if (lam[i+1] != A0)
+                den ^= alpha_to[(lam[i+1] + i*root[j]) % nn];
+        }
+        if (den == 0)
+            return -1;
+
+        _data[loc[j]] ^= alpha_to[(index_of[num1] + index_of[num2] + nn - index_of[den]) % nn];
+    }
+    return count;
 }
 
-#endif  // LIBFEC_ENABLED
+// 
+// internal
+//
 
+int fec_rs_init_p8(fec _q)
+{
+    _q->symsize = 8;
+    _q->genpoly = 0x11d;
+    _q->fcs = 1;
+    _q->prim = 1;
+    _q->nroots = FEC_RS_NROOTS;
+    return LIQUID_OK;
+}
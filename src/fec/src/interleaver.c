@@ -25,10 +25,19 @@
 //
 // Create and initialize interleaver objects
 //
+// The interleaver applies up to four in-place permutation passes: a byte
+// swap followed by masked bit swaps (0x0f, 0x55, 0x33), each stepping
+// through the block in a different row/column order. Every pass keeps
+// bits at their position within a byte, so the composition of all passes
+// is a byte permutation for each group of bits that was never separated
+// by a mask (at most eight groups). These tables are computed once when
+// the depth is set, and encoding/decoding is then a single gather pass.
+//
 
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <stdint.h>
 #include <math.h>
 
 #include "liquid.internal.h"
@@ -37,31 +46,28 @@
 // internal methods
 //
 
-// permute one iteration
-int interleaver_permute(unsigned char * _x,
-                        unsigned int    _n,
-                        unsigned int    _M,
-                        unsigned int    _N);
-
-// permute one iteration (soft bit input)
-int interleaver_permute_soft(unsigned char * _x,
-                             unsigned int    _n,
-                             unsigned int    _M,
-                             unsigned int    _N);
-
-// permute one iteration with mask
-int interleaver_permute_mask(unsigned char * _x,
-                             unsigned int    _n,
-                             unsigned int    _M,
-                             unsigned int    _N,
-                             unsigned char   _mask);
-
-// permute one iteration (soft bit input) with mask
-int interleaver_permute_mask_soft(unsigned char * _x,
-                                  unsigned int    _n,
-                                  unsigned int    _M,
-                                  unsigned int    _N,
-                                  unsigned char   _mask);
+// compute swap index for each of the first _n/2 even bytes for one
+// permutation pass of size _M x _N
+int interleaver_permute_index(unsigned int   _n,
+                              unsigned int   _M,
+                              unsigned int   _N,
+                              unsigned int * _index);
+
+// compose permutation passes into per-group gather tables
+int interleaver_compile(interleaver _q);
+
+// gather bytes (hard) or groups of 8 soft bits (soft)
+int interleaver_gather(interleaver           _q,
+                       const unsigned int *  _perm,
+                       const unsigned char * _x,
+                       unsigned char *       _y);
+int interleaver_gather_soft(interleaver           _q,
+                            const unsigned int *  _perm,
+                            const unsigned char * _x,
+                            unsigned char *       _y);
+
+// maximum number of permutation passes
+#define INTERLEAVER_MAX_DEPTH   (4)
 
 // structured interleaver object
 struct interleaver_s {
@@ -72,6 +78,14 @@ struct interleaver_s {
 
     // interleaving depth (number of permutations)
     unsigned int depth;
+
+    // composed permutation
+    unsigned int   num_groups;      // number of bit groups moved together
+    unsigned char  mask[8];         // bits belonging to each group
+    uint64_t       mask_soft[8];    // soft bits belonging to each group
+    unsigned int * perm;            // encoder source byte, [size: n x num_groups]
+    unsigned int * iperm;           // decoder source byte, [size: n x num_groups]
+    unsigned char * buf;            // in-place operation buffer, [size: 8*n x 1]
 };
 
 // create interleaver of length _n input/output bytes
@@ -89,6 +103,11 @@ interleaver interleaver_create(unsigned int _n)
     q->N = q->n / q->M;
     while (q->n >= (q->M*q->N)) q->N++;  // ensures M*N >= n
 
+    // allocate memory for permutation tables and compute them
+    q->perm  = (unsigned int *)  malloc(8*q->n*sizeof(unsigned int));
+    q->iperm = (unsigned int *)  malloc(8*q->n*sizeof(unsigned int));
+    q->buf   = (unsigned char *) malloc(8*q->n*sizeof(unsigned char));
+    interleaver_compile(q);
     return q;
 }
 
@@ -99,12 +118,19 @@ interleaver interleaver_copy(interleaver q_orig)
     if (q_orig == NULL)
         return liquid_error_config("interleaver_copy(), object cannot be NULL");
 
-    return interleaver_create(q_orig->n);
+    interleaver q_copy = interleaver_create(q_orig->n);
+    interleaver_set_depth(q_copy, q_orig->depth);
+    return q_copy;
 }
 
 // destroy interleaver object
 int interleaver_destroy(interleaver _q)
 {
+    // free permutation tables
+    free(_q->perm);
+    free(_q->iperm);
+    free(_q->buf);
+
     // free main object memory
     free(_q);
     return LIQUID_OK;
@@ -125,7 +151,7 @@ int interleaver_set_depth(interleaver  _q,
                           unsigned int _depth)
 {
     _q->depth = _depth;
-    return LIQUID_OK;
+    return interleaver_compile(_q);
 }
 
 // execute forward interleaver (encoder)
@@ -136,15 +162,11 @@ int interleaver_encode(interleaver     _q,
                        unsigned char * _msg_dec,
                        unsigned char * _msg_enc)
 {
-    // copy data to output
-    memmove(_msg_enc, _msg_dec, _q->n);
-
-    if (_q->depth > 0) interleaver_permute(_msg_enc, _q->n, _q->M, _q->N);
-    if (_q->depth > 1) interleaver_permute_mask(_msg_enc, _q->n, _q->M, _q->N+2, 0x0f);
-    if (_q->depth > 2) interleaver_permute_mask(_msg_enc, _q->n, _q->M, _q->N+4, 0x55);
-    if (_q->depth > 3) interleaver_permute_mask(_msg_enc, _q->n, _q->M, _q->N+8, 0x33);
+    if (_msg_dec != _msg_enc)
+        return interleaver_gather(_q, _q->perm, _msg_dec, _msg_enc);
 
-    return LIQUID_OK;
+    memmove(_q->buf, _msg_dec, _q->n);
+    return interleaver_gather(_q, _q->perm, _q->buf, _msg_enc);
 }
 
 // execute forward interleaver (encoder) on soft bits
@@ -155,15 +177,11 @@ int interleaver_encode_soft(interleaver     _q,
                             unsigned char * _msg_dec,
                             unsigned char * _msg_enc)
 {
-    // copy data to output
-    memmove(_msg_enc, _msg_dec, 8*_q->n);
-
-    if (_q->depth > 0) interleaver_permute_soft(_msg_enc, _q->n, _q->M, _q->N);
-    if (_q->depth > 1) interleaver_permute_mask_soft(_msg_enc, _q->n, _q->M, _q->N+2, 0x0f);
-    if (_q->depth > 2) interleaver_permute_mask_soft(_msg_enc, _q->n, _q->M, _q->N+4, 0x55);
-    if (_q->depth > 3) interleaver_permute_mask_soft(_msg_enc, _q->n, _q->M, _q->N+8, 0x33);
+    if (_msg_dec != _msg_enc)
+        return interleaver_gather_soft(_q, _q->perm, _msg_dec, _msg_enc);
 
-    return LIQUID_OK;
+    memmove(_q->buf, _msg_dec, 8*_q->n);
+    return interleaver_gather_soft(_q, _q->perm, _q->buf, _msg_enc);
 }
 
 // execute reverse interleaver (decoder)
@@ -174,15 +192,11 @@ int interleaver_decode(interleaver     _q,
                        unsigned char * _msg_enc,
                        unsigned char * _msg_dec)
 {
-    // copy data to output
-    memmove(_msg_dec, _msg_enc, _q->n);
+    if (_msg_enc != _msg_dec)
+        return interleaver_gather(_q, _q->iperm, _msg_enc, _msg_dec);
 
-    if (_q->depth > 3) interleaver_permute_mask(_msg_dec, _q->n, _q->M, _q->N+8, 0x33);
-    if (_q->depth > 2) interleaver_permute_mask(_msg_dec, _q->n, _q->M, _q->N+4, 0x55);
-    if (_q->depth > 1) interleaver_permute_mask(_msg_dec, _q->n, _q->M, _q->N+2, 0x0f);
-    if (_q->depth > 0) interleaver_permute(_msg_dec, _q->n, _q->M, _q->N);
-
-    return LIQUID_OK;
+    memmove(_q->buf, _msg_enc, _q->n);
+    return interleaver_gather(_q, _q->iperm, _q->buf, _msg_dec);
 }
 
 // execute reverse interleaver (decoder) on soft bits
@@ -193,33 +207,29 @@ int interleaver_decode_soft(interleaver     _q,
                             unsigned char * _msg_enc,
                             unsigned char * _msg_dec)
 {
-    // copy data to output
-    memmove(_msg_dec, _msg_enc, 8*_q->n);
+    if (_msg_enc != _msg_dec)
+        return interleaver_gather_soft(_q, _q->iperm, _msg_enc, _msg_dec);
 
-    if (_q->depth > 3) interleaver_permute_mask_soft(_msg_dec, _q->n, _q->M, _q->N+8, 0x33);
-    if (_q->depth > 2) interleaver_permute_mask_soft(_msg_dec, _q->n, _q->M, _q->N+4, 0x55);
-    if (_q->depth > 1) interleaver_permute_mask_soft(_msg_dec, _q->n, _q->M, _q->N+2, 0x0f);
-    if (_q->depth > 0) interleaver_permute_soft(_msg_dec, _q->n, _q->M, _q->N);
-
-    return LIQUID_OK;
+    memmove(_q->buf, _msg_enc, 8*_q->n);
+    return interleaver_gather_soft(_q, _q->iperm, _q->buf, _msg_dec);
 }
 
 // 
 // internal permutation methods
 //
 
-// permute one iteration
-int interleaver_permute(unsigned char * _x,
-                        unsigned int    _n,
-                        unsigned int    _M,
-                        unsigned int    _N)
+// compute swap index for each of the first _n/2 even bytes for one
+// permutation pass of size _M x _N: byte 2*i is swapped with 2*_index[i]+1
+int interleaver_permute_index(unsigned int   _n,
+                              unsigned int   _M,
+                              unsigned int   _N,
+                              unsigned int * _index)
 {
     unsigned int i;
     unsigned int j;
     unsigned int m=0;
     unsigned int n=_n/3;
     unsigned int n2=_n/2;
-    unsigned char tmp;
     for (i=0; i<n2; i++) {
         //j = m*N + n; // input
         do {
@@ -231,120 +241,143 @@ int interleaver_permute(unsigned char * _x,
             }
         } while (j>=n2);
 
-        // swap indices
-        tmp = _x[2*j+1];
-        _x[2*j+1] = _x[2*i+0];
-        _x[2*i+0] = tmp;
+        _index[i] = j;
     }
-
     return LIQUID_OK;
 }
 
-// permute one iteration (soft bit input)
-int interleaver_permute_soft(unsigned char * _x,
-                             unsigned int    _n,
-                             unsigned int    _M,
-                             unsigned int    _N)
+// compose permutation passes into per-group gather tables
+int interleaver_compile(interleaver _q)
 {
-    unsigned int i;
-    unsigned int j;
-    unsigned int m=0;
-    unsigned int n=_n/3;
-    unsigned int n2=_n/2;
-    unsigned char tmp[8];
-    for (i=0; i<n2; i++) {
-        //j = m*N + n; // input
-        do {
-            j = m*_N + n; // output
-            m++;
-            if (m == _M) {
-                n = (n+1) % (_N);
-                m=0;
+    // permutation passes: column offset and bits swapped
+    const unsigned int  pass_offset[INTERLEAVER_MAX_DEPTH] = {0, 2, 4, 8};
+    const unsigned char pass_mask  [INTERLEAVER_MAX_DEPTH] = {0xff, 0x0f, 0x55, 0x33};
+    unsigned int depth = _q->depth < INTERLEAVER_MAX_DEPTH ? _q->depth : INTERLEAVER_MAX_DEPTH;
+    unsigned int n  = _q->n;
+    unsigned int n2 = n/2;
+
+    // group bit positions by the set of passes that move them
+    unsigned int d, i, k, g;
+    unsigned int lead[8];   // leading bit for each group
+    _q->num_groups = 0;
+    for (k=0; k<8; k++) {
+        unsigned int sig = 0;
+        for (d=0; d<depth; d++)
+            sig |= ((pass_mask[d] >> k) & 1) << d;
+
+        for (g=0; g<_q->num_groups; g++) {
+            unsigned int sig_g = 0;
+            for (d=0; d<depth; d++)
+                sig_g |= ((pass_mask[d] >> lead[g]) & 1) << d;
+            if (sig_g == sig)
+                break;
+        }
+        if (g == _q->num_groups) {
+            lead[g] = k;
+            _q->mask[g] = 0;
+            _q->num_groups++;
+        }
+        _q->mask[g] |= 1 << k;
+    }
+
+    // soft-bit masks (soft bit k holds bit 8-k-1 of byte)
+    for (g=0; g<_q->num_groups; g++) {
+        unsigned char m[8];
+        for (k=0; k<8; k++)
+            m[k] = ((_q->mask[g] >> (8-k-1)) & 0x01) ? 0xff : 0x00;
+        memmove(&_q->mask_soft[g], m, 8);
+    }
+
+    // track source byte for each position of each group through all
+    // passes, applying the same swaps as the in-place permutation
+    unsigned int G = _q->num_groups;
+    unsigned int * index = (unsigned int*) malloc((n2 > 0 ? n2 : 1)*sizeof(unsigned int));
+    for (i=0; i<n; i++) {
+        for (g=0; g<G; g++)
+            _q->perm[i*G+g] = i;
+    }
+    for (d=0; d<depth; d++) {
+        interleaver_permute_index(n, _q->M, _q->N + pass_offset[d], index);
+        for (g=0; g<G; g++) {
+            if ( (pass_mask[d] & _q->mask[g]) == 0 )
+                continue;
+            for (i=0; i<n2; i++) {
+                unsigned int * a = &_q->perm[(2*i         +0)*G + g];
+                unsigned int * b = &_q->perm[(2*index[i]+1)*G + g];
+                unsigned int tmp = *a;
+                *a = *b;
+                *b = tmp;
             }
-        } while (j>=n2);
-    
-        // swap soft bits at indices
-        memmove( tmp,            &_x[8*(2*j+1)], 8);
-        memmove( &_x[8*(2*j+1)], &_x[8*(2*i+0)], 8);
-        memmove( &_x[8*(2*i+0)], tmp,            8);
+        }
     }
-    //printf("\n");
+    free(index);
 
+    // invert permutations for decoder
+    for (i=0; i<n; i++) {
+        for (g=0; g<G; g++)
+            _q->iperm[_q->perm[i*G+g]*G+g] = i;
+    }
     return LIQUID_OK;
 }
 
-
-// permute one iteration with mask
-int interleaver_permute_mask(unsigned char * _x,
-                             unsigned int    _n,
-                             unsigned int    _M,
-                             unsigned int    _N,
-                             unsigned char   _mask)
+// gather bytes through permutation table, combining _G bit groups
+static inline void interleaver_gather_groups(const unsigned int *  _perm,
+                                             const unsigned char * _mask,
+                                             unsigned int          _G,
+                                             unsigned int          _n,
+                                             const unsigned char * _x,
+                                             unsigned char *       _y)
 {
-    unsigned int i;
-    unsigned int j;
-    unsigned int m=0;
-    unsigned int n=_n/3;
-    unsigned int n2=_n/2;
-    unsigned char tmp0;
-    unsigned char tmp1;
-    for (i=0; i<n2; i++) {
-        //j = m*N + n; // input
-        do {
-            j = m*_N + n; // output
-            m++;
-            if (m == _M) {
-                n = (n+1) % (_N);
-                m=0;
-            }
-        } while (j>=n2);
-
-        // swap indices, applying mask
-        tmp0 = (_x[2*i+0] & (~_mask)) | (_x[2*j+1] & ( _mask));
-        tmp1 = (_x[2*i+0] & ( _mask)) | (_x[2*j+1] & (~_mask));
-        _x[2*i+0] = tmp0;
-        _x[2*j+1] = tmp1;
+    unsigned int i, g;
+    for (i=0; i<_n; i++) {
+        const unsigned int * p = &_perm[i*_G];
+        unsigned char v = 0;
+        for (g=0; g<_G; g++)
+            v |= _x[p[g]] & _mask[g];
+        _y[i] = v;
     }
+}
 
+// gather bytes through permutation table
+int interleaver_gather(interleaver           _q,
+                       const unsigned int *  _perm,
+                       const unsigned char * _x,
+                       unsigned char *       _y)
+{
+    // expand for common group counts so inner loop is unrolled
+    switch (_q->num_groups) {
+    case 1:  interleaver_gather_groups(_perm, _q->mask, 1, _q->n, _x, _y); break;
+    case 2:  interleaver_gather_groups(_perm, _q->mask, 2, _q->n, _x, _y); break;
+    case 4:  interleaver_gather_groups(_perm, _q->mask, 4, _q->n, _x, _y); break;
+    case 8:  interleaver_gather_groups(_perm, _q->mask, 8, _q->n, _x, _y); break;
+    default: interleaver_gather_groups(_perm, _q->mask, _q->num_groups, _q->n, _x, _y);
+    }
     return LIQUID_OK;
 }
 
-// permute one iteration (soft bit input)
-int interleaver_permute_mask_soft(unsigned char * _x,
-                                  unsigned int    _n,
-                                  unsigned int    _M,
-                                  unsigned int    _N,
-                                  unsigned char   _mask)
+// gather groups of 8 soft bits through permutation table, masking
+// soft bits with 64-bit words
+int interleaver_gather_soft(interleaver           _q,
+                            const unsigned int *  _perm,
+                            const unsigned char * _x,
+                            unsigned char *       _y)
 {
-    unsigned int i;
-    unsigned int j;
-    unsigned int k;
-    unsigned int m=0;
-    unsigned int n=_n/3;
-    unsigned int n2=_n/2;
-    unsigned char tmp;
-    for (i=0; i<n2; i++) {
-        //j = m*N + n; // input
-        do {
-            j = m*_N + n; // output
-            m++;
-            if (m == _M) {
-                n = (n+1) % (_N);
-                m=0;
-            }
-        } while (j>=n2);
-
-        // swap bits matching the mask
-        for (k=0; k<8; k++) {
-            if ( (_mask >> (8-k-1)) & 0x01 ) {
-                tmp = _x[8*(2*j+1)+k];
-                _x[8*(2*j+1)+k] = _x[8*(2*i+0)+k];
-                _x[8*(2*i+0)+k] = tmp;
-            }
+    unsigned int i, g;
+    unsigned int G = _q->num_groups;
+    if (G == 1) {
+        for (i=0; i<_q->n; i++)
+            memmove(&_y[8*i], &_x[8*_perm[i]], 8);
+        return LIQUID_OK;
+    }
+    for (i=0; i<_q->n; i++) {
+        const unsigned int * p = &_perm[i*G];
+        uint64_t v = 0;
+        for (g=0; g<G; g++) {
+            uint64_t w;
+            memmove(&w, &_x[8*p[g]], 8);
+            v |= w & _q->mask_soft[g];
         }
+        memmove(&_y[8*i], &v, 8);
     }
-    //printf("\n");
-
     return LIQUID_OK;
 }
-
@@ -58,6 +58,9 @@ struct packetizer_s {
 // reallocate memory for buffers
 int packetizer_realloc_buffers(packetizer _p, unsigned int _len);
 
+// remove whitening, copy message and validate crc of decoded data
+int packetizer_finalize(packetizer _p, unsigned char * _msg);
+
 // computes the number of encoded bytes after packetizing
 //
 //  _n      :   number of uncoded input bytes
@@ -296,44 +299,55 @@ int packetizer_encode(packetizer            _p,
 {
     unsigned int i;
 
-    // copy input message to internal buffer[0] (or initialize to zeros)
+    // find last plan which modifies the data; pass-through plans (no
+    // error correction, zero interleaving depth) are skipped entirely
+    int last = -1;
+    for (i=0; i<_p->plan_len; i++) {
+        if (_p->plan[i].fs != LIQUID_FEC_NONE)
+            last = i;
+    }
+
+    // assemble message directly in output if there is nothing to encode
+    unsigned char * buf = last < 0 ? _pkt : _p->buffer_0;
+
+    // copy input message to buffer (or initialize to zeros)
     if (_msg != NULL) {
         // copy user-defined input
-        memmove(_p->buffer_0, _msg, _p->msg_len);
+        memmove(buf, _msg, _p->msg_len);
     } else {
         // initialize with zeros
-        memset(_p->buffer_0, 0x00, _p->msg_len);
+        memset(buf, 0x00, _p->msg_len);
     }
 
     // compute crc, append to buffer
-    unsigned int key = crc_generate_key(_p->check, _p->buffer_0, _p->msg_len);
+    unsigned int key = crc_generate_key(_p->check, buf, _p->msg_len);
     for (i=0; i<_p->crc_length; i++) {
         // append byte to buffer
-        _p->buffer_0[_p->msg_len+_p->crc_length-i-1] = key & 0xff;
+        buf[_p->msg_len+_p->crc_length-i-1] = key & 0xff;
 
         // shift key by 8 bits
         key >>= 8;
     }
 
     // whiten input sequence
-    scramble_data(_p->buffer_0, _p->msg_len + _p->crc_length);
+    scramble_data(buf, _p->msg_len + _p->crc_length);
 
-    // execute fec/interleaver plans
+    // execute fec/interleaver plans, last one writing to the output
     for (i=0; i<_p->plan_len; i++) {
+        if (_p->plan[i].fs == LIQUID_FEC_NONE)
+            continue;
+
         // run the encoder: buffer[0] > buffer[1]
         fec_encode(_p->plan[i].f,
                    _p->plan[i].dec_msg_len,
                    _p->buffer_0,
                    _p->buffer_1);
 
-        // run the interleaver: buffer[1] > buffer[0]
+        // run the interleaver: buffer[1] > buffer[0] (or output)
         interleaver_encode(_p->plan[i].q,
                            _p->buffer_1,
-                           _p->buffer_0);
+                           (int)i == last ? _pkt : _p->buffer_0);
     }
-
-    // copy result to output
-    memmove(_pkt, _p->buffer_0, _p->packet_len);
     return LIQUID_OK;
 }
 
@@ -347,15 +361,16 @@ int packetizer_decode(packetizer            _p,
                       const unsigned char * _pkt,
                       unsigned char *       _msg)
 {
-    // copy coded message to internal buffer[0]
-    memmove(_p->buffer_0, _pkt, _p->packet_len);
-
-    // execute fec/interleaver plans
+    // execute fec/interleaver plans, the first one reading the input
+    const unsigned char * src = _pkt;
     unsigned int i;
     for (i=_p->plan_len; i>0; i--) {
-        // run the de-interleaver: buffer[0] > buffer[1]
+        if (_p->plan[i-1].fs == LIQUID_FEC_NONE)
+            continue;
+
+        // run the de-interleaver: input (or buffer[0]) > buffer[1]
         interleaver_decode(_p->plan[i-1].q,
-                           _p->buffer_0,
+                           (unsigned char*)src,
                            _p->buffer_1);
 
         // run the decoder: buffer[1] > buffer[0]
@@ -363,27 +378,14 @@ int packetizer_decode(packetizer            _p,
                    _p->plan[i-1].dec_msg_len,
                    _p->buffer_1,
                    _p->buffer_0);
+        src = _p->buffer_0;
     }
 
-    // remove sequence whitening
-    unscramble_data(_p->buffer_0, _p->msg_len + _p->crc_length);
-
-    // strip crc, validate message
-    unsigned int key = 0;
-    for (i=0; i<_p->crc_length; i++) {
-        key <<= 8;
-
-        key |= _p->buffer_0[_p->msg_len+i];
-    }
+    // nothing was decoded; copy coded message to internal buffer[0]
+    if (src == _pkt)
+        memmove(_p->buffer_0, _pkt, _p->packet_len);
 
-    // copy result to output
-    memmove(_msg, _p->buffer_0, _p->msg_len);
-
-    // return crc validity
-    return crc_validate_message(_p->check,
-                                _p->buffer_0,
-                                _p->msg_len,
-                                key);
+    return packetizer_finalize(_p, _msg);
 }
 
 // Execute the packetizer to decode an input message, return validity
@@ -396,39 +398,142 @@ int packetizer_decode_soft(packetizer            _p,
                            const unsigned char * _pkt,
                            unsigned char *       _msg)
 {
-    // copy coded message to internal buffer[0]
-    memmove(_p->buffer_0, _pkt, 8*_p->packet_len);
-
     // 
     // decode outer level using soft decoding
     //
 
-    // run the de-interleaver: buffer[0] > buffer[1]
-    interleaver_decode_soft(_p->plan[1].q,
-                            _p->buffer_0,
-                            _p->buffer_1);
+    if (_p->plan[1].fs != LIQUID_FEC_NONE) {
+        // run the de-interleaver: input > buffer[1]
+        interleaver_decode_soft(_p->plan[1].q,
+                                (unsigned char*)_pkt,
+                                _p->buffer_1);
 
-    // run the decoder: buffer[1] > buffer[0]
-    fec_decode_soft(_p->plan[1].f,
-                    _p->plan[1].dec_msg_len,
-                    _p->buffer_1,
-                    _p->buffer_0);
+        // run the decoder: buffer[1] > buffer[0]
+        fec_decode_soft(_p->plan[1].f,
+                        _p->plan[1].dec_msg_len,
+                        _p->buffer_1,
+                        _p->buffer_0);
+    } else {
+        // no interleaving: pack soft bits directly from input
+        fec_decode_soft(_p->plan[1].f,
+                        _p->plan[1].dec_msg_len,
+                        (unsigned char*)_pkt,
+                        _p->buffer_0);
+    }
 
     // 
     // decode inner level using hard decoding
     //
 
-    // run the de-interleaver: buffer[0] > buffer[1]
-    interleaver_decode(_p->plan[0].q,
-                       _p->buffer_0,
-                       _p->buffer_1);
+    if (_p->plan[0].fs != LIQUID_FEC_NONE) {
+        // run the de-interleaver: buffer[0] > buffer[1]
+        interleaver_decode(_p->plan[0].q,
+                           _p->buffer_0,
+                           _p->buffer_1);
 
-    // run the decoder: buffer[1] > buffer[0]
-    fec_decode(_p->plan[0].f,
-               _p->plan[0].dec_msg_len,
-               _p->buffer_1,
-               _p->buffer_0);
+        // run the decoder: buffer[1] > buffer[0]
+        fec_decode(_p->plan[0].f,
+                   _p->plan[0].dec_msg_len,
+                   _p->buffer_1,
+                   _p->buffer_0);
+    }
 
+    return packetizer_finalize(_p, _msg);
+}
+
+// Execute the packetizer on a batch of equal-length messages
+//
+//  _p      :   packetizer object
+//  _msg    :   input messages (uncoded bytes), [size: _num x dec_msg_len]
+//  _num    :   number of messages
+//  _pkt    :   encoded output packets, [size: _num x enc_msg_len]
+int packetizer_encode_batch(packetizer            _p,
+                            const unsigned char * _msg,
+                            unsigned int          _num,
+                            unsigned char *       _pkt)
+{
+    unsigned int i;
+    for (i=0; i<_num; i++) {
+        packetizer_encode(_p,
+                          _msg == NULL ? NULL : &_msg[i*_p->msg_len],
+                          &_pkt[i*_p->packet_len]);
+    }
+    return LIQUID_OK;
+}
+
+// Execute the packetizer to decode a batch of equal-length packets,
+// returning the number of packets which pass the validity check
+//
+//  _p      :   packetizer object
+//  _pkt    :   input packets (coded bytes), [size: _num x enc_msg_len]
+//  _num    :   number of packets
+//  _msg    :   decoded output messages, [size: _num x dec_msg_len]
+//  _valid  :   validity of each packet (ignored if NULL), [size: _num x 1]
+int packetizer_decode_batch(packetizer            _p,
+                            const unsigned char * _pkt,
+                            unsigned int          _num,
+                            unsigned char *       _msg,
+                            int *                 _valid)
+{
+    unsigned int i;
+    int num_valid = 0;
+    for (i=0; i<_num; i++) {
+        int valid = packetizer_decode(_p,
+                                      &_pkt[i*_p->packet_len],
+                                      &_msg[i*_p->msg_len]);
+        if (_valid != NULL)
+            _valid[i] = valid;
+        num_valid += valid ? 1 : 0;
+    }
+    return num_valid;
+}
+
+// Execute the packetizer to decode a batch of equal-length packets of
+// soft bits, returning the number of packets which pass the validity
+// check
+//
+//  _p      :   packetizer object
+//  _pkt    :   input packets (coded soft bits), [size: _num x 8*enc_msg_len]
+//  _num    :   number of packets
+//  _msg    :   decoded output messages, [size: _num x dec_msg_len]
+//  _valid  :   validity of each packet (ignored if NULL), [size: _num x 1]
+int packetizer_decode_soft_batch(packetizer            _p,
+                                 const unsigned char * _pkt,
+                                 unsigned int          _num,
+                                 unsigned char *       _msg,
+                                 int *                 _valid)
+{
+    unsigned int i;
+    int num_valid = 0;
+    for (i=0; i<_num; i++) {
+        int valid = packetizer_decode_soft(_p,
+                                           &_pkt[8*i*_p->packet_len],
+                                           &_msg[i*_p->msg_len]);
+        if (_valid != NULL)
+            _valid[i] = valid;
+        num_valid += valid ? 1 : 0;
+    }
+    return num_valid;
+}
+
+// 
+// internal methods
+//
+
+int packetizer_realloc_buffers(packetizer   _p,
+                               unsigned int _len)
+{
+    _p->buffer_len = _len;
+    _p->buffer_0 = (unsigned char*) realloc(_p->buffer_0, _p->buffer_len);
+    _p->buffer_1 = (unsigned char*) realloc(_p->buffer_1, _p->buffer_len);
+    return LIQUID_OK;
+}
+
+// remove whitening from decoded data in buffer[0], copy message to
+// output and return crc validity
+int packetizer_finalize(packetizer      _p,
+                        unsigned char * _msg)
+{
     // remove sequence whitening
     unscramble_data(_p->buffer_0, _p->msg_len + _p->crc_length);
 
@@ -450,17 +555,3 @@ int packetizer_decode_soft(packetizer            _p,
                                 _p->msg_len,
                                 key);
 }
-
-// 
-// internal methods
-//
-
-int packetizer_realloc_buffers(packetizer   _p,
-                               unsigned int _len)
-{
-    _p->buffer_len = _len;
-    _p->buffer_0 = (unsigned char*) realloc(_p->buffer_0, _p->buffer_len);
-    _p->buffer_1 = (unsigned char*) realloc(_p->buffer_1, _p->buffer_len);
-    return LIQUID_OK;
-}
-
@@ -60,8 +60,9 @@ int fec_sumproduct(unsigned int    _m,
 
     // internal variables
     unsigned int num_iterations = 0;
-    float Lq[_m*_n];
-    float Lr[_m*_n];
+    // check-by-variable message arrays grow as m*n; keep them off the stack
+    float * Lq = (float*) malloc(_m*_n*sizeof(float));
+    float * Lr = (float*) malloc(_m*_n*sizeof(float));
     float Lc[_n];
     float LQ[_n];
     unsigned char parity[_m];
@@ -104,6 +105,8 @@ int fec_sumproduct(unsigned int    _m,
             continue_running = 0;
     }
 
+    free(Lq);
+    free(Lr);
     return parity_pass;
 }
 
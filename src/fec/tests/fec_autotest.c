@@ -46,8 +46,7 @@ void fec_test_codec(fec_scheme _fs, unsigned int _n, void * _opts)
     case LIQUID_FEC_CONV_V29P56:
     case LIQUID_FEC_CONV_V29P67:
     case LIQUID_FEC_CONV_V29P78:
-    case LIQUID_FEC_RS_M8:
-        AUTOTEST_WARN("convolutional, Reed-Solomon codes unavailable (install libfec)");
+        AUTOTEST_WARN("convolutional codes unavailable (install libfec)");
         return;
     default:;
     }
@@ -130,4 +129,9 @@ void autotest_fec_v29p78()  { fec_test_codec(LIQUID_FEC_CONV_V29P78,   64, NULL)
 // Reed-Solomon block codes
 void autotest_fec_rs8()     { fec_test_codec(LIQUID_FEC_RS_M8,         64, NULL); }
 
+// low-density parity check codes
+void autotest_fec_ldpc12()  { fec_test_codec(LIQUID_FEC_LDPC_R12,      64, NULL); }
+void autotest_fec_ldpc23()  { fec_test_codec(LIQUID_FEC_LDPC_R23,      64, NULL); }
+void autotest_fec_ldpc34()  { fec_test_codec(LIQUID_FEC_LDPC_R34,      64, NULL); }
+
 
@@ -86,6 +86,9 @@ void autotest_fec_str2fec()
     CONTEND_EQUALITY( liquid_getopt_str2fec("v29p67"),     LIQUID_FEC_CONV_V29P67);
     CONTEND_EQUALITY( liquid_getopt_str2fec("v29p78"),     LIQUID_FEC_CONV_V29P78);
     CONTEND_EQUALITY( liquid_getopt_str2fec("rs8"),        LIQUID_FEC_RS_M8);
+    CONTEND_EQUALITY( liquid_getopt_str2fec("ldpc12"),     LIQUID_FEC_LDPC_R12);
+    CONTEND_EQUALITY( liquid_getopt_str2fec("ldpc23"),     LIQUID_FEC_LDPC_R23);
+    CONTEND_EQUALITY( liquid_getopt_str2fec("ldpc34"),     LIQUID_FEC_LDPC_R34);
 }
 
 void autotest_fec_is_convolutional()
@@ -46,8 +46,7 @@ void fec_test_copy(fec_scheme _fs)
     case LIQUID_FEC_CONV_V29P56:
     case LIQUID_FEC_CONV_V29P67:
     case LIQUID_FEC_CONV_V29P78:
-    case LIQUID_FEC_RS_M8:
-        AUTOTEST_WARN("convolutional, Reed-Solomon codes unavailable (install libfec)");
+        AUTOTEST_WARN("convolutional codes unavailable (install libfec)");
         return;
     default:;
     }
@@ -138,3 +137,6 @@ void autotest_fec_copy_v29p78()  { fec_test_copy(LIQUID_FEC_CONV_V29P78   ); }
 // Reed-Solomon block codes
 void autotest_fec_copy_rs8()     { fec_test_copy(LIQUID_FEC_RS_M8         ); }
 
+// low-density parity check codes
+void autotest_fec_copy_ldpc12()  { fec_test_copy(LIQUID_FEC_LDPC_R12      ); }
+
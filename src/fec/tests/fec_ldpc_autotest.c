@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2007 - 2024 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <math.h>
+
+#include "autotest/autotest.h"
+#include "liquid.internal.h"
+
+// encode message, flip every _spacing-th encoded bit, decode, and
+// compare (helper function to keep code base small)
+void fec_ldpc_test_hard(fec_scheme   _fs,
+                        unsigned int _n,
+                        unsigned int _spacing)
+{
+    fec q = fec_create(_fs, NULL);
+
+    unsigned int n_enc = fec_get_enc_msg_length(_fs, _n);
+    unsigned char * msg     = (unsigned char*) malloc(_n*sizeof(unsigned char));
+    unsigned char * msg_enc = (unsigned char*) malloc(n_enc*sizeof(unsigned char));
+    unsigned char * msg_dec = (unsigned char*) malloc(_n*sizeof(unsigned char));
+
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        msg[i] = rand() & 0xff;
+
+    fec_encode(q, _n, msg, msg_enc);
+
+    // encoding is systematic: first block begins with the message
+    CONTEND_EQUALITY(msg_enc[0], msg[0]);
+
+    // channel: flip bits at regular spacing
+    for (i=_spacing/2; i<8*n_enc; i+=_spacing)
+        msg_enc[i/8] ^= 0x80 >> (i%8);
+
+    fec_decode(q, _n, msg_enc, msg_dec);
+    CONTEND_SAME_DATA(msg, msg_dec, _n);
+
+    free(msg);
+    free(msg_enc);
+    free(msg_dec);
+    fec_destroy(q);
+}
+
+// soft decoding in additive white Gaussian noise with BPSK
+void fec_ldpc_test_soft(fec_scheme   _fs,
+                        unsigned int _n,
+                        float        _SNRdB)
+{
+    fec q = fec_create(_fs, NULL);
+
+    unsigned int n_enc = fec_get_enc_msg_length(_fs, _n);
+    unsigned char * msg      = (unsigned char*) malloc(_n*sizeof(unsigned char));
+    unsigned char * msg_enc  = (unsigned char*) malloc(n_enc*sizeof(unsigned char));
+    unsigned char * msg_soft = (unsigned char*) malloc(8*n_enc*sizeof(unsigned char));
+    unsigned char * msg_dec  = (unsigned char*) malloc(_n*sizeof(unsigned char));
+
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        msg[i] = rand() & 0xff;
+
+    fec_encode(q, _n, msg, msg_enc);
+
+    // channel: add noise, computing quantized log-likelihood ratio
+    float nstd = powf(10.0f, -_SNRdB/20.0f);
+    for (i=0; i<8*n_enc; i++) {
+        float x   = ((msg_enc[i/8] >> (7-(i%8))) & 1) ? -1.0f : 1.0f;
+        float y   = x + nstd*randnf();
+        float llr = 2.0f*y/(nstd*nstd);
+        int   v   = (int)(127.5f - 8.0f*llr);
+        msg_soft[i] = v < 0 ? 0 : (v > 255 ? 255 : v);
+    }
+
+    fec_decode_soft(q, _n, msg_soft, msg_dec);
+    CONTEND_SAME_DATA(msg, msg_dec, _n);
+
+    free(msg);
+    free(msg_enc);
+    free(msg_soft);
+    free(msg_dec);
+    fec_destroy(q);
+}
+
+// hard-decision decoding; lengths cover shortened, full, and multiple blocks
+void autotest_fec_ldpc12_hard_n1()    { fec_ldpc_test_hard(LIQUID_FEC_LDPC_R12,    1,  50); }
+void autotest_fec_ldpc12_hard_n37()   { fec_ldpc_test_hard(LIQUID_FEC_LDPC_R12,   37,  50); }
+void autotest_fec_ldpc12_hard_n144()  { fec_ldpc_test_hard(LIQUID_FEC_LDPC_R12,  144,  50); }
+void autotest_fec_ldpc12_hard_n1000() { fec_ldpc_test_hard(LIQUID_FEC_LDPC_R12, 1000,  50); }
+void autotest_fec_ldpc23_hard_n192()  { fec_ldpc_test_hard(LIQUID_FEC_LDPC_R23,  192, 100); }
+void autotest_fec_ldpc23_hard_n500()  { fec_ldpc_test_hard(LIQUID_FEC_LDPC_R23,  500, 100); }
+void autotest_fec_ldpc34_hard_n216()  { fec_ldpc_test_hard(LIQUID_FEC_LDPC_R34,  216, 150); }
+void autotest_fec_ldpc34_hard_n777()  { fec_ldpc_test_hard(LIQUID_FEC_LDPC_R34,  777, 150); }
+
+// soft-decision decoding in noise
+void autotest_fec_ldpc12_soft_n144()  { fec_ldpc_test_soft(LIQUID_FEC_LDPC_R12,  144, 4.0f); }
+void autotest_fec_ldpc23_soft_n192()  { fec_ldpc_test_soft(LIQUID_FEC_LDPC_R23,  192, 5.5f); }
+void autotest_fec_ldpc34_soft_n216()  { fec_ldpc_test_soft(LIQUID_FEC_LDPC_R34,  216, 6.5f); }
+
+// encoded lengths: blocks are split evenly and lifting size is chosen
+// as the smallest multiple of 8 which holds each block
+void autotest_fec_ldpc_length()
+{
+    // single full-size block (z=96)
+    CONTEND_EQUALITY(fec_get_enc_msg_length(LIQUID_FEC_LDPC_R12,  144),  288);
+    CONTEND_EQUALITY(fec_get_enc_msg_length(LIQUID_FEC_LDPC_R23,  192),  288);
+    CONTEND_EQUALITY(fec_get_enc_msg_length(LIQUID_FEC_LDPC_R34,  216),  288);
+
+    // shortened block: 37 bytes fits within z=32 (48 bytes), 48 parity bytes
+    CONTEND_EQUALITY(fec_get_enc_msg_length(LIQUID_FEC_LDPC_R12,   37),   85);
+
+    // two blocks of 73 and 72 bytes (z=56), 84 parity bytes each
+    CONTEND_EQUALITY(fec_get_enc_msg_length(LIQUID_FEC_LDPC_R12,  145),  313);
+
+    // rates
+    CONTEND_EQUALITY(fec_get_rate(LIQUID_FEC_LDPC_R12), 0.5f);
+    CONTEND_DELTA   (fec_get_rate(LIQUID_FEC_LDPC_R23), 2.0f/3.0f, 1e-6f);
+    CONTEND_EQUALITY(fec_get_rate(LIQUID_FEC_LDPC_R34), 0.75f);
+}
+
+// count length-4 cycles in lifted parity-check matrix: two block rows
+// sharing block columns c0 and c1 close a 4-cycle whenever their shift
+// differences agree modulo the lifting size
+unsigned int fec_ldpc_test_count_4cycles(fec _q)
+{
+    unsigned int z = _q->ldpc_z;
+    unsigned int num_cycles = 0;
+    unsigned int r0, r1, e0, e1, f0, f1;
+    for (r0=0; r0<_q->ldpc_mb; r0++) {
+        for (r1=r0+1; r1<_q->ldpc_mb; r1++) {
+            for (e0=_q->ldpc_row[r0]; e0<_q->ldpc_row[r0+1]; e0++) {
+                for (e1=e0+1; e1<_q->ldpc_row[r0+1]; e1++) {
+                    // find the same pair of columns in second row
+                    for (f0=_q->ldpc_row[r1]; f0<_q->ldpc_row[r1+1]; f0++) {
+                        if (_q->ldpc_col[f0] != _q->ldpc_col[e0]) continue;
+                        for (f1=_q->ldpc_row[r1]; f1<_q->ldpc_row[r1+1]; f1++) {
+                            if (_q->ldpc_col[f1] != _q->ldpc_col[e1]) continue;
+                            unsigned int d = z*4 + _q->ldpc_shift[e0] - _q->ldpc_shift[e1]
+                                                 + _q->ldpc_shift[f1] - _q->ldpc_shift[f0];
+                            num_cycles += (d % z) == 0;
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return num_cycles;
+}
+
+// base-matrix shifts are free of 4-cycles at the larger lifting sizes;
+// scaling down to small lifting sizes introduces a few
+void fec_ldpc_test_girth(fec_scheme _fs)
+{
+    fec q = fec_create(_fs, NULL);
+    unsigned int z;
+    for (z=8; z<=96; z+=8) {
+        // single block which exactly fills the information bits
+        fec_ldpc_setlength(q, q->ldpc_kb*z/8);
+        CONTEND_EQUALITY(q->ldpc_z, z);
+
+        unsigned int num_cycles = fec_ldpc_test_count_4cycles(q);
+        if (liquid_autotest_verbose)
+            printf("  %-8s z=%2u : %u 4-cycles\n", fec_scheme_str[_fs][0], z, num_cycles);
+        if (z >= 64)
+            CONTEND_EQUALITY(num_cycles, 0);
+    }
+    fec_destroy(q);
+}
+void autotest_fec_ldpc12_girth() { fec_ldpc_test_girth(LIQUID_FEC_LDPC_R12); }
+void autotest_fec_ldpc23_girth() { fec_ldpc_test_girth(LIQUID_FEC_LDPC_R23); }
+void autotest_fec_ldpc34_girth() { fec_ldpc_test_girth(LIQUID_FEC_LDPC_R34); }
@@ -31,11 +31,6 @@
 //
 void autotest_reedsolomon_223_255()
 {
-#if !LIBFEC_ENABLED
-    liquid_error(LIQUID_EUMODE,"Reed-Solomon codes unavailable (install libfec)");
-    return;
-#endif
-
     unsigned int dec_msg_len = 223;
 
     // compute and test encoded message length
@@ -83,3 +78,43 @@ void autotest_reedsolomon_223_255()
     fec_destroy(q);
 }
 
+
+// test decoding multi-block, shortened messages at the error-correcting
+// limit, re-using the same object across message lengths
+void autotest_reedsolomon_lengths()
+{
+    unsigned int lengths[6] = {1, 37, 223, 224, 1000, 1024};
+
+    // create object
+    fec q = fec_create(LIQUID_FEC_RS_M8,NULL);
+
+    unsigned int i, j, k;
+    for (k=0; k<6; k++) {
+        unsigned int dec_msg_len = lengths[k];
+        unsigned int enc_msg_len = fec_get_enc_msg_length(LIQUID_FEC_RS_M8,dec_msg_len);
+
+        unsigned char msg_org[dec_msg_len]; // original message
+        unsigned char msg_enc[enc_msg_len]; // encoded message
+        unsigned char msg_dec[dec_msg_len]; // decoded message
+        for (i=0; i<dec_msg_len; i++)
+            msg_org[i] = rand() & 0xff;
+
+        // encode message
+        fec_encode(q, dec_msg_len, msg_org, msg_enc);
+
+        // corrupt 16 symbols in each encoded block (parity included)
+        unsigned int num_blocks    = q->num_blocks;
+        unsigned int enc_block_len = enc_msg_len / num_blocks;
+        for (i=0; i<num_blocks; i++) {
+            for (j=0; j<16; j++)
+                msg_enc[i*enc_block_len + (j*7) % enc_block_len] ^= 0x5a + j;
+        }
+
+        // decode message and validate
+        fec_decode(q, dec_msg_len, msg_enc, msg_dec);
+        CONTEND_SAME_DATA(msg_org, msg_dec, dec_msg_len);
+    }
+
+    // clean up objects
+    fec_destroy(q);
+}
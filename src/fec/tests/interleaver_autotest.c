@@ -21,6 +21,7 @@
  */
 
 #include <stdlib.h>
+#include <string.h>
 
 #include "autotest/autotest.h"
 #include "liquid.h"
@@ -85,3 +86,37 @@ void autotest_interleaver_soft_16()     { interleaver_test_soft(16  ); }
 void autotest_interleaver_soft_64()     { interleaver_test_soft(64  ); }
 void autotest_interleaver_soft_256()    { interleaver_test_soft(256 ); }
 
+// test all depths, including in-place operation
+void autotest_interleaver_depth()
+{
+    unsigned int n = 77;
+    unsigned int i, d;
+    unsigned char x[8*n];
+    unsigned char y[8*n];
+    unsigned char z[8*n];
+    for (i=0; i<8*n; i++)
+        x[i] = rand() & 0xFF;
+
+    // create interleaver object
+    interleaver q = interleaver_create(n);
+
+    for (d=0; d<=4; d++) {
+        interleaver_set_depth(q, d);
+
+        // hard: out of place, then in place
+        interleaver_encode(q,x,y);
+        memmove(z, x, n);
+        interleaver_encode(q,z,z);
+        CONTEND_SAME_DATA(y, z, n);
+        interleaver_decode(q,z,z);
+        CONTEND_SAME_DATA(x, z, n);
+
+        // soft
+        interleaver_encode_soft(q,x,y);
+        interleaver_decode_soft(q,y,z);
+        CONTEND_SAME_DATA(x, z, 8*n);
+    }
+
+    // destroy interleaver object
+    interleaver_destroy(q);
+}
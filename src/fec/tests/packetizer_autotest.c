@@ -20,6 +20,7 @@
  * THE SOFTWARE.
  */
 
+#include <string.h>
 #include "autotest/autotest.h"
 #include "liquid.h"
 
@@ -65,3 +66,60 @@ void autotest_packetizer_n16_0_0()  { packetizer_test_codec(16, LIQUID_CRC_32, L
 void autotest_packetizer_n16_0_1()  { packetizer_test_codec(16, LIQUID_CRC_32, LIQUID_FEC_NONE, LIQUID_FEC_REP3);       }
 void autotest_packetizer_n16_0_2()  { packetizer_test_codec(16, LIQUID_CRC_32, LIQUID_FEC_NONE, LIQUID_FEC_HAMMING74);  }
 
+
+// Help function to keep code base small (batch encode/decode)
+void packetizer_test_batch(unsigned int _n,
+                           unsigned int _num,
+                           crc_scheme   _crc,
+                           fec_scheme   _fec0,
+                           fec_scheme   _fec1)
+{
+    unsigned int pkt_len = packetizer_compute_enc_msg_len(_n,_crc,_fec0,_fec1);
+    unsigned char msg_tx[_num*_n];
+    unsigned char msg_rx[_num*_n];
+    unsigned char packet[_num*pkt_len];
+    unsigned char packet_soft[8*_num*pkt_len];
+    int valid[_num];
+
+    // create object
+    packetizer p = packetizer_create(_n,_crc,_fec0,_fec1);
+
+    // initialize data
+    unsigned int i;
+    for (i=0; i<_num*_n; i++)
+        msg_tx[i] = rand() & 0xff;
+
+    // encode all packets and compare with individual encoding
+    packetizer_encode_batch(p, msg_tx, _num, packet);
+    unsigned char packet_test[pkt_len];
+    packetizer_encode(p, &msg_tx[(_num-1)*_n], packet_test);
+    CONTEND_SAME_DATA(&packet[(_num-1)*pkt_len], packet_test, pkt_len);
+
+    // expand to soft bits
+    for (i=0; i<8*_num*pkt_len; i++)
+        packet_soft[i] = ((packet[i/8] >> (7-(i%8))) & 1) ? LIQUID_SOFTBIT_1 : LIQUID_SOFTBIT_0;
+
+    // corrupt first packet beyond repair
+    for (i=0; i<pkt_len; i++)
+        packet[i] ^= 0xff;
+
+    // decode all packets
+    int num_valid = packetizer_decode_batch(p, packet, _num, msg_rx, valid);
+    CONTEND_EQUALITY(num_valid, _num-1);
+    CONTEND_EQUALITY(valid[0], 0);
+    CONTEND_SAME_DATA(&msg_tx[_n], &msg_rx[_n], (_num-1)*_n);
+
+    // decode all packets (soft)
+    memset(msg_rx, 0x00, _num*_n);
+    num_valid = packetizer_decode_soft_batch(p, packet_soft, _num, msg_rx, NULL);
+    CONTEND_EQUALITY(num_valid, _num);
+    CONTEND_SAME_DATA(msg_tx, msg_rx, _num*_n);
+
+    // clean up objects
+    packetizer_destroy(p);
+}
+
+void autotest_packetizer_batch_0_0() { packetizer_test_batch(16, 5, LIQUID_CRC_32, LIQUID_FEC_NONE,      LIQUID_FEC_NONE);     }
+void autotest_packetizer_batch_0_1() { packetizer_test_batch(44, 4, LIQUID_CRC_32, LIQUID_FEC_NONE,      LIQUID_FEC_HAMMING74);}
+void autotest_packetizer_batch_1_0() { packetizer_test_batch(44, 4, LIQUID_CRC_32, LIQUID_FEC_GOLAY2412, LIQUID_FEC_NONE);     }
+void autotest_packetizer_batch_1_1() { packetizer_test_batch(64, 3, LIQUID_CRC_16, LIQUID_FEC_RS_M8,     LIQUID_FEC_LDPC_R12); }
@@ -98,6 +98,8 @@ struct FFT(plan_s)
             FFT(plan) ifft;     // sub-IFFT of size nfft_prime
         } rader2;
     } data;
+
+    LIQUID_PROFILE_MEMBER   // profiling counters (top-level plans only)
 };
 
 // allocate one-dimensional array 
@@ -126,6 +128,23 @@ FFT(plan) FFT(_create_plan)(unsigned int _nfft,
                             int          _dir,
                             int          _flags)
 {
+    FFT(plan) q = FFT(_create_plan_method)(_nfft, _x, _y, _dir, _flags);
+    if (q != NULL)
+        LIQUID_PROFILE_CREATE(q, "fftplan");
+    return q;
+}
+
+// create FFT plan using best method for transform size; sub-transforms
+// are created with this method directly so that they are not profiled
+// separately from the plan that owns them
+FFT(plan) FFT(_create_plan_method)(unsigned int _nfft,
+                                   TC *         _x,
+                                   TC *         _y,
+                                   int          _dir,
+                                   int          _flags)
+{
+    FFT(plan) q = NULL;
+
     // determine best method for execution
     // TODO : check flags and allow user override
     liquid_fft_method method = liquid_fft_estimate_method(_nfft);
@@ -134,33 +153,42 @@ FFT(plan) FFT(_create_plan)(unsigned int _nfft,
     switch (method) {
     case LIQUID_FFT_METHOD_RADIX2:
         // use radix-2 decimation-in-time method
-        return FFT(_create_plan_radix2)(_nfft, _x, _y, _dir, _flags);
+        q = FFT(_create_plan_radix2)(_nfft, _x, _y, _dir, _flags);
+        break;
 
     case LIQUID_FFT_METHOD_MIXED_RADIX:
         // use Cooley-Tukey mixed-radix algorithm
-        return FFT(_create_plan_mixed_radix)(_nfft, _x, _y, _dir, _flags);
+        q = FFT(_create_plan_mixed_radix)(_nfft, _x, _y, _dir, _flags);
+        break;
 
     case LIQUID_FFT_METHOD_RADER:
         // use Rader's algorithm for FFTs of prime length
-        return FFT(_create_plan_rader)(_nfft, _x, _y, _dir, _flags);
+        q = FFT(_create_plan_rader)(_nfft, _x, _y, _dir, _flags);
+        break;
 
     case LIQUID_FFT_METHOD_RADER2:
         // use Rader's algorithm for FFTs of prime length
-        return FFT(_create_plan_rader2)(_nfft, _x, _y, _dir, _flags);
+        q = FFT(_create_plan_rader2)(_nfft, _x, _y, _dir, _flags);
+        break;
 
     case LIQUID_FFT_METHOD_DFT:
         // use slow DFT
-        return FFT(_create_plan_dft)(_nfft, _x, _y, _dir, _flags);
+        q = FFT(_create_plan_dft)(_nfft, _x, _y, _dir, _flags);
+        break;
 
     case LIQUID_FFT_METHOD_UNKNOWN:
-    default:;
+    default:
+        return liquid_error_config("fft_create_plan(), unknown/invalid fft method (%u)", method);
     }
-    return liquid_error_config("fft_create_plan(), unknown/invalid fft method (%u)", method);
+    if (q != NULL)
+        LIQUID_PROFILE_CLEAR(q);
+    return q;
 }
 
 // destroy FFT plan
 int FFT(_destroy_plan)(FFT(plan) _q)
 {
+    LIQUID_PROFILE_DESTROY(_q);
     switch (_q->type) {
     // complex one-dimensional transforms
     case LIQUID_FFT_FORWARD:
@@ -291,7 +319,10 @@ int FFT(_print_plan_recursive)(FFT(plan)    _q,
 int FFT(_execute)(FFT(plan) _q)
 {
     // invoke internal function pointer
-    return _q->execute(_q);
+    LIQUID_PROFILE_BEGIN(_q);
+    int rc = _q->execute(_q);
+    LIQUID_PROFILE_END(_q, _q->nfft);
+    return rc;
 }
 
 // perform n-point FFT allocating plan internally
@@ -80,14 +80,14 @@ FFT(plan) FFT(_create_plan_mixed_radix)(unsigned int _nfft,
     q->data.mixedradix.x = (TC *) malloc(q->nfft * sizeof(TC));
 
     // create P-point FFT plan
-    q->data.mixedradix.fft_P = FFT(_create_plan)(q->data.mixedradix.P,
+    q->data.mixedradix.fft_P = FFT(_create_plan_method)(q->data.mixedradix.P,
                                                  q->data.mixedradix.t0,
                                                  q->data.mixedradix.t1,
                                                  q->direction,
                                                  q->flags);
 
     // create Q-point FFT plan
-    q->data.mixedradix.fft_Q = FFT(_create_plan)(q->data.mixedradix.Q,
+    q->data.mixedradix.fft_Q = FFT(_create_plan_method)(q->data.mixedradix.Q,
                                                  q->data.mixedradix.t0,
                                                  q->data.mixedradix.t1,
                                                  q->direction,
@@ -66,6 +66,7 @@ FFT(plan) FFT(_create_plan_r2r_1d)(unsigned int _nfft,
     default:
         return liquid_error_config("fft_create_plan_r2r_1d(), invalid type, %d", q->type);
     }
+    LIQUID_PROFILE_CREATE(q, "fftplan");
 
     return q;
 }
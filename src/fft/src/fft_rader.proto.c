@@ -68,14 +68,14 @@ FFT(plan) FFT(_create_plan_rader)(unsigned int _nfft,
     q->data.rader.X_prime = (TC*) FFT_MALLOC((q->nfft-1)*sizeof(TC));
 
     // create sub-FFT of size nfft-1
-    q->data.rader.fft = FFT(_create_plan)(q->nfft-1,
+    q->data.rader.fft = FFT(_create_plan_method)(q->nfft-1,
                                           q->data.rader.x_prime,
                                           q->data.rader.X_prime,
                                           LIQUID_FFT_FORWARD,
                                           q->flags);
 
     // create sub-IFFT of size nfft-1
-    q->data.rader.ifft = FFT(_create_plan)(q->nfft-1,
+    q->data.rader.ifft = FFT(_create_plan_method)(q->nfft-1,
                                            q->data.rader.X_prime,
                                            q->data.rader.x_prime,
                                            LIQUID_FFT_BACKWARD,
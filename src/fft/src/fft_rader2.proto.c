@@ -133,14 +133,14 @@ FFT(plan) FFT(_create_plan_rader2)(unsigned int _nfft,
     q->data.rader2.X_prime = (TC*) FFT_MALLOC((q->data.rader2.nfft_prime)*sizeof(TC));
 
     // create sub-FFT of size nfft-1
-    q->data.rader2.fft = FFT(_create_plan)(q->data.rader2.nfft_prime,
+    q->data.rader2.fft = FFT(_create_plan_method)(q->data.rader2.nfft_prime,
                                            q->data.rader2.x_prime,
                                            q->data.rader2.X_prime,
                                            LIQUID_FFT_FORWARD,
                                            q->flags);
 
     // create sub-IFFT of size nfft-1
-    q->data.rader2.ifft = FFT(_create_plan)(q->data.rader2.nfft_prime,
+    q->data.rader2.ifft = FFT(_create_plan_method)(q->data.rader2.nfft_prime,
                                             q->data.rader2.X_prime,
                                             q->data.rader2.x_prime,
                                             LIQUID_FFT_BACKWARD,
@@ -475,8 +475,9 @@ int SPGRAM(_get_psd)(SPGRAM() _q,
 
     // convert to dB
     unsigned int i;
+    liquid_vlog10f(_psd, _q->nfft, _psd, LIQUID_VMATH_PRECISE);
     for (i=0; i<_q->nfft; i++)
-        _psd[i] = 10*log10f(_psd[i]);
+        _psd[i] *= 10;
     return LIQUID_OK;
 }
 
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <sys/resource.h>
+#include "liquid.h"
+
+// Helper function to keep code base small
+void firdespm_bench(struct rusage *     _start,
+                    struct rusage *     _finish,
+                    unsigned long int * _num_iterations,
+                    unsigned int        _h_len,
+                    unsigned int        _num_workers)
+{
+    // normalize number of trials; design time grows with square of length
+    *_num_iterations = (*_num_iterations * 20) / (_h_len * _h_len);
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    // low-pass filter, transition band chosen for ~70 dB attenuation
+    float ft = 4.0f / (float)_h_len;
+    float bands[4]   = {0.0f, 0.2f, 0.2f + ft, 0.5f};
+    float des[2]     = {1.0f, 0.0f};
+    float weights[2] = {1.0f, 1.0f};
+    float h[_h_len];
+    unsigned long int i;
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++) {
+        firdespm q = firdespm_create(_h_len, 2, bands, des, weights, NULL,
+                                     LIQUID_FIRDESPM_BANDPASS);
+        firdespm_set_workers(q, _num_workers);
+        firdespm_execute(q, h);
+        firdespm_destroy(q);
+    }
+    getrusage(RUSAGE_SELF, _finish);
+}
+
+#define FIRDESPM_BENCHMARK_API(H_LEN,NUM_WORKERS)   \
+(   struct rusage *_start,                          \
+    struct rusage *_finish,                         \
+    unsigned long int *_num_iterations)             \
+{ firdespm_bench(_start, _finish, _num_iterations, H_LEN, NUM_WORKERS); }
+
+void benchmark_firdespm_n51     FIRDESPM_BENCHMARK_API(51,   1)
+void benchmark_firdespm_n101    FIRDESPM_BENCHMARK_API(101,  1)
+void benchmark_firdespm_n251    FIRDESPM_BENCHMARK_API(251,  1)
+void benchmark_firdespm_n501    FIRDESPM_BENCHMARK_API(501,  1)
+void benchmark_firdespm_n1001   FIRDESPM_BENCHMARK_API(1001, 1)
+void benchmark_firdespm_n2001   FIRDESPM_BENCHMARK_API(2001, 1)
+void benchmark_firdespm_n2001_w4 FIRDESPM_BENCHMARK_API(2001, 4)
+
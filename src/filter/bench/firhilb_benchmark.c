@@ -66,3 +66,54 @@ void benchmark_firhilbf_decim_m5    FIRHILB_DECIM_BENCHMARK_API(5)  // m=5
 void benchmark_firhilbf_decim_m9    FIRHILB_DECIM_BENCHMARK_API(9)  // m=9
 void benchmark_firhilbf_decim_m13   FIRHILB_DECIM_BENCHMARK_API(13) // m=13
 
+
+// Helper function to compare single-sample and block
+// complex-to-real transforms
+void firhilbf_c2r_bench(struct rusage *     _start,
+                        struct rusage *     _finish,
+                        unsigned long int * _num_iterations,
+                        unsigned int        _m,
+                        int                 _block)
+{
+    // normalize number of trials
+    *_num_iterations *= 20;
+    *_num_iterations /= liquid_nextpow2(_m+1);
+
+    // create hilbert transform object
+    firhilbf q = firhilbf_create(_m,60.0f);
+
+    float complex x[256];
+    float         y0[256], y1[256];
+    unsigned long int i;
+    unsigned int j;
+    for (j=0; j<256; j++)
+        x[j] = randnf() + _Complex_I*randnf();
+
+    // start trials
+    *_num_iterations /= 256;
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++) {
+        if (_block) {
+            firhilbf_c2r_execute_block(q, x, 256, y0, y1);
+        } else {
+            for (j=0; j<256; j++)
+                firhilbf_c2r_execute(q, x[j], &y0[j], &y1[j]);
+        }
+    }
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= 256;
+
+    firhilbf_destroy(q);
+}
+
+#define FIRHILB_C2R_BENCHMARK_API(M,BLOCK)  \
+(   struct rusage *_start,                  \
+    struct rusage *_finish,                 \
+    unsigned long int *_num_iterations)     \
+{ firhilbf_c2r_bench(_start, _finish, _num_iterations, M, BLOCK); }
+
+void benchmark_firhilbf_c2r_m13       FIRHILB_C2R_BENCHMARK_API(13, 0)
+void benchmark_firhilbf_c2r_m25       FIRHILB_C2R_BENCHMARK_API(25, 0)
+void benchmark_firhilbf_c2r_block_m13 FIRHILB_C2R_BENCHMARK_API(13, 1)
+void benchmark_firhilbf_c2r_block_m25 FIRHILB_C2R_BENCHMARK_API(25, 1)
+
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2007 - 2024 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <sys/resource.h>
+#include "liquid.h"
+
+// Helper function to keep code base small
+//  _M      : number of channels
+//  _order  : filter order
+//  _n      : number of samples per channel per block
+void iirfiltbank_crcf_bench(struct rusage *     _start,
+                            struct rusage *     _finish,
+                            unsigned long int * _num_iterations,
+                            unsigned int        _M,
+                            unsigned int        _order,
+                            unsigned int        _n)
+{
+    unsigned long int i;
+
+    // scale number of iterations to keep execution time reasonable
+    *_num_iterations = *_num_iterations * 32 / (_M * _n * _order) + 1;
+
+    // create filter bank object from prototype
+    iirfiltbank_crcf q = iirfiltbank_crcf_create_prototype(LIQUID_IIRDES_BUTTER,
+        LIQUID_IIRDES_LOWPASS, _order, 0.2f, 0.0f, 0.1f, 60.0f, _M);
+
+    // initialize input/output
+    float complex * x = (float complex*) malloc(_M*_n*sizeof(float complex));
+    for (i=0; i<_M*_n; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++)
+        iirfiltbank_crcf_execute_block(q, x, _n, x);
+    getrusage(RUSAGE_SELF, _finish);
+
+    // report number of samples processed across all channels
+    *_num_iterations *= _M * _n;
+
+    // destroy filter object
+    iirfiltbank_crcf_destroy(q);
+    free(x);
+}
+
+#define IIRFILTBANK_CRCF_BENCHMARK_API(M,ORDER,N)   \
+(   struct rusage *_start,                          \
+    struct rusage *_finish,                         \
+    unsigned long int *_num_iterations)             \
+{ iirfiltbank_crcf_bench(_start, _finish, _num_iterations, M, ORDER, N); }
+
+// multi-channel
+void benchmark_iirfiltbank_crcf_M64_n4     IIRFILTBANK_CRCF_BENCHMARK_API(64,  4, 64)
+void benchmark_iirfiltbank_crcf_M256_n4    IIRFILTBANK_CRCF_BENCHMARK_API(256, 4, 64)
+void benchmark_iirfiltbank_crcf_M512_n4    IIRFILTBANK_CRCF_BENCHMARK_API(512, 4, 16)
+
+// single channel, block-parallel (look-ahead) mode
+void benchmark_iirfiltbank_crcf_M1_n4      IIRFILTBANK_CRCF_BENCHMARK_API(1,   4, 4096)
+void benchmark_iirfiltbank_crcf_M1_n8      IIRFILTBANK_CRCF_BENCHMARK_API(1,   8, 4096)
+
@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) 2007 - 2023 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// design_cache.c
+//
+// Memoizing cache for filter designs. Designs are keyed by the design
+// function and its parameters; coefficients are stored once and copied
+// out on each hit. The cache is disabled by default, bounded in number
+// of entries (least-recently used entries are evicted first), and
+// protected by a mutex (if available) so that objects may be created
+// concurrently.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "liquid.internal.h"
+
+#if HAVE_LIBPTHREAD
+#include <pthread.h>
+static pthread_mutex_t liquid_design_cache_lock = PTHREAD_MUTEX_INITIALIZER;
+#  define LIQUID_DESIGN_CACHE_LOCK()   pthread_mutex_lock  (&liquid_design_cache_lock)
+#  define LIQUID_DESIGN_CACHE_UNLOCK() pthread_mutex_unlock(&liquid_design_cache_lock)
+#else
+#  define LIQUID_DESIGN_CACHE_LOCK()
+#  define LIQUID_DESIGN_CACHE_UNLOCK()
+#endif
+
+// cache entry, linked in order of most-recent use
+struct liquid_design_cache_entry_s {
+    struct liquid_design_cache_entry_s * prev;
+    struct liquid_design_cache_entry_s * next;
+    unsigned long   hash;       // hash of identifier and key
+    int             id;         // design function identifier
+    unsigned char * key;        // design parameters
+    unsigned int    key_len;    // length of key (bytes)
+    float *         v;          // coefficients (immutable once stored)
+    unsigned int    n;          // number of coefficients
+};
+
+// global cache state
+static struct {
+    struct liquid_design_cache_entry_s * head;  // most recently used
+    struct liquid_design_cache_entry_s * tail;  // least recently used
+    unsigned int  num_entries;
+    unsigned int  max_entries;  // zero when disabled
+    unsigned long num_hits;
+    unsigned long num_misses;
+} liquid_design_cache = {NULL, NULL, 0, 0, 0, 0};
+
+// hash identifier and key (FNV-1a)
+static unsigned long liquid_design_cache_hash(int          _id,
+                                              const void * _key,
+                                              unsigned int _key_len)
+{
+    unsigned long h = 2166136261UL ^ (unsigned long)_id;
+    const unsigned char * p = (const unsigned char *) _key;
+    unsigned int i;
+    for (i=0; i<_key_len; i++)
+        h = (h ^ p[i]) * 16777619UL;
+    return h;
+}
+
+// unlink entry from list
+static void liquid_design_cache_unlink(struct liquid_design_cache_entry_s * _e)
+{
+    if (_e->prev != NULL) _e->prev->next = _e->next;
+    else                  liquid_design_cache.head = _e->next;
+    if (_e->next != NULL) _e->next->prev = _e->prev;
+    else                  liquid_design_cache.tail = _e->prev;
+    liquid_design_cache.num_entries--;
+}
+
+// link entry at head of list
+static void liquid_design_cache_link(struct liquid_design_cache_entry_s * _e)
+{
+    _e->prev = NULL;
+    _e->next = liquid_design_cache.head;
+    if (liquid_design_cache.head != NULL)
+        liquid_design_cache.head->prev = _e;
+    liquid_design_cache.head = _e;
+    if (liquid_design_cache.tail == NULL)
+        liquid_design_cache.tail = _e;
+    liquid_design_cache.num_entries++;
+}
+
+// evict least-recently used entries until at most _n remain
+static void liquid_design_cache_evict(unsigned int _n)
+{
+    while (liquid_design_cache.num_entries > _n) {
+        struct liquid_design_cache_entry_s * e = liquid_design_cache.tail;
+        liquid_design_cache_unlink(e);
+        free(e->key);
+        free(e->v);
+        free(e);
+    }
+}
+
+// enable filter design cache
+int liquid_design_cache_enable(unsigned int _max_entries)
+{
+    if (_max_entries == 0)
+        return liquid_error(LIQUID_EICONFIG,"liquid_design_cache_enable(), maximum number of entries must be greater than zero");
+    LIQUID_DESIGN_CACHE_LOCK();
+    liquid_design_cache_evict(_max_entries);
+    liquid_design_cache.max_entries = _max_entries;
+    LIQUID_DESIGN_CACHE_UNLOCK();
+    return LIQUID_OK;
+}
+
+// disable filter design cache, releasing all entries
+int liquid_design_cache_disable()
+{
+    LIQUID_DESIGN_CACHE_LOCK();
+    liquid_design_cache_evict(0);
+    liquid_design_cache.max_entries = 0;
+    LIQUID_DESIGN_CACHE_UNLOCK();
+    return LIQUID_OK;
+}
+
+// clear all entries and reset counters
+int liquid_design_cache_clear()
+{
+    LIQUID_DESIGN_CACHE_LOCK();
+    liquid_design_cache_evict(0);
+    liquid_design_cache.num_hits   = 0;
+    liquid_design_cache.num_misses = 0;
+    LIQUID_DESIGN_CACHE_UNLOCK();
+    return LIQUID_OK;
+}
+
+// get cache statistics
+int liquid_design_cache_get_stats(unsigned long * _num_hits,
+                                  unsigned long * _num_misses,
+                                  unsigned int *  _num_entries)
+{
+    LIQUID_DESIGN_CACHE_LOCK();
+    if (_num_hits    != NULL) *_num_hits    = liquid_design_cache.num_hits;
+    if (_num_misses  != NULL) *_num_misses  = liquid_design_cache.num_misses;
+    if (_num_entries != NULL) *_num_entries = liquid_design_cache.num_entries;
+    LIQUID_DESIGN_CACHE_UNLOCK();
+    return LIQUID_OK;
+}
+
+// look up design in cache, copying coefficients on hit
+int liquid_design_cache_lookup(int          _id,
+                               const void * _key,
+                               unsigned int _key_len,
+                               float *      _v,
+                               unsigned int _n)
+{
+    unsigned long hash = liquid_design_cache_hash(_id, _key, _key_len);
+    int hit = 0;
+    LIQUID_DESIGN_CACHE_LOCK();
+    if (liquid_design_cache.max_entries > 0) {
+        struct liquid_design_cache_entry_s * e;
+        for (e=liquid_design_cache.head; e!=NULL; e=e->next) {
+            if (e->hash == hash && e->id == _id && e->key_len == _key_len &&
+                e->n == _n && memcmp(e->key, _key, _key_len) == 0)
+            {
+                memmove(_v, e->v, _n*sizeof(float));
+                // move to front
+                liquid_design_cache_unlink(e);
+                liquid_design_cache_link(e);
+                hit = 1;
+                break;
+            }
+        }
+        if (hit) liquid_design_cache.num_hits++;
+        else     liquid_design_cache.num_misses++;
+    }
+    LIQUID_DESIGN_CACHE_UNLOCK();
+    return hit;
+}
+
+// insert design into cache (if enabled)
+int liquid_design_cache_insert(int           _id,
+                               const void *  _key,
+                               unsigned int  _key_len,
+                               const float * _v,
+                               unsigned int  _n)
+{
+    unsigned long hash = liquid_design_cache_hash(_id, _key, _key_len);
+    LIQUID_DESIGN_CACHE_LOCK();
+    if (liquid_design_cache.max_entries > 0) {
+        // another thread may have inserted same design concurrently
+        struct liquid_design_cache_entry_s * e;
+        for (e=liquid_design_cache.head; e!=NULL; e=e->next) {
+            if (e->hash == hash && e->id == _id && e->key_len == _key_len &&
+                e->n == _n && memcmp(e->key, _key, _key_len) == 0)
+                break;
+        }
+        if (e == NULL) {
+            e = (struct liquid_design_cache_entry_s*) malloc(sizeof(struct liquid_design_cache_entry_s));
+            e->hash    = hash;
+            e->id      = _id;
+            e->key     = (unsigned char*) liquid_malloc_copy((void*)_key, _key_len, sizeof(unsigned char));
+            e->key_len = _key_len;
+            e->v       = (float*) liquid_malloc_copy((void*)_v, _n, sizeof(float));
+            e->n       = _n;
+            liquid_design_cache_evict(liquid_design_cache.max_entries-1);
+            liquid_design_cache_link(e);
+        }
+    }
+    LIQUID_DESIGN_CACHE_UNLOCK();
+    return LIQUID_OK;
+}
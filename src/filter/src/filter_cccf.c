@@ -40,6 +40,7 @@
 #define FIRPFB(name)        LIQUID_CONCAT(firpfb_cccf,name)
 #define IIRDECIM(name)      LIQUID_CONCAT(iirdecim_cccf,name)
 #define IIRFILT(name)       LIQUID_CONCAT(iirfilt_cccf,name)
+#define IIRFILTBANK(name)   LIQUID_CONCAT(iirfiltbank_cccf,name)
 #define IIRFILTSOS(name)    LIQUID_CONCAT(iirfiltsos_cccf,name)
 #define IIRINTERP(name)     LIQUID_CONCAT(iirinterp_cccf,name)
 #define NCO(name)           LIQUID_CONCAT(nco_crcf,name)
@@ -77,6 +78,7 @@
 #include "firpfb.proto.c"
 #include "iirdecim.proto.c"
 #include "iirfilt.proto.c"
+#include "iirfiltbank.proto.c"
 #include "iirfiltsos.proto.c"
 #include "iirinterp.proto.c"
 //#include "qmfb.proto.c"
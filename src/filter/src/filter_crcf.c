@@ -41,6 +41,7 @@
 #define FIRPFB(name)        LIQUID_CONCAT(firpfb_crcf,name)
 #define IIRDECIM(name)      LIQUID_CONCAT(iirdecim_crcf,name)
 #define IIRFILT(name)       LIQUID_CONCAT(iirfilt_crcf,name)
+#define IIRFILTBANK(name)   LIQUID_CONCAT(iirfiltbank_crcf,name)
 #define IIRFILTSOS(name)    LIQUID_CONCAT(iirfiltsos_crcf,name)
 #define IIRINTERP(name)     LIQUID_CONCAT(iirinterp_crcf,name)
 #define MSRESAMP(name)      LIQUID_CONCAT(msresamp_crcf,name)
@@ -78,6 +79,7 @@
 #include "firpfb.proto.c"
 #include "iirdecim.proto.c"
 #include "iirfilt.proto.c"
+#include "iirfiltbank.proto.c"
 #include "iirfiltsos.proto.c"
 #include "iirinterp.proto.c"
 #include "msresamp.proto.c"
@@ -42,6 +42,7 @@
 #define FIRPFB(name)        LIQUID_CONCAT(firpfb_rrrf,name)
 #define IIRDECIM(name)      LIQUID_CONCAT(iirdecim_rrrf,name)
 #define IIRFILT(name)       LIQUID_CONCAT(iirfilt_rrrf,name)
+#define IIRFILTBANK(name)   LIQUID_CONCAT(iirfiltbank_rrrf,name)
 #define IIRFILTSOS(name)    LIQUID_CONCAT(iirfiltsos_rrrf,name)
 #define IIRHILB(name)       LIQUID_CONCAT(iirhilbf,name)
 #define IIRINTERP(name)     LIQUID_CONCAT(iirinterp_rrrf,name)
@@ -81,6 +82,7 @@
 #include "firpfb.proto.c"
 #include "iirdecim.proto.c"
 #include "iirfilt.proto.c"
+#include "iirfiltbank.proto.c"
 #include "iirfiltsos.proto.c"
 #include "iirhilb.proto.c"
 #include "iirinterp.proto.c"
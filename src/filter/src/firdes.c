@@ -316,6 +316,23 @@ int liquid_firdes_kaiser(unsigned int _n,
     if (_n == 0)
         return liquid_error(LIQUID_EICONFIG,"liquid_firdes_kaiser(), filter length must be greater than zero");
 
+    // check design cache
+    float key[4] = {(float)_n, _fc, _as, _mu};
+    if (liquid_design_cache_lookup(LIQUID_DESIGN_CACHE_KAISER, key, sizeof(key), _h, _n))
+        return LIQUID_OK;
+
+    liquid_firdes_kaiser_uncached(_n, _fc, _as, _mu, _h);
+    return liquid_design_cache_insert(LIQUID_DESIGN_CACHE_KAISER, key, sizeof(key), _h, _n);
+}
+
+// Design FIR using kaiser window, bypassing the design cache (for
+// iterative designs); inputs are not validated
+int liquid_firdes_kaiser_uncached(unsigned int _n,
+                                  float        _fc,
+                                  float        _as,
+                                  float        _mu,
+                                  float *      _h)
+{
     // choose kaiser beta parameter (approximate)
     float beta = kaiser_beta_As(_as);
 
@@ -417,31 +434,41 @@ int liquid_firdes_prototype(liquid_firfilt_type _type,
                                         LIQUID_FIRDESPM_FLATWEIGHT,
                                         LIQUID_FIRDESPM_FLATWEIGHT};
 
+    // check design cache; Kaiser and Parks-McClellan designs are cached
+    // by their own design functions
+    int cache = _type != LIQUID_FIRFILT_KAISER && _type != LIQUID_FIRFILT_PM;
+    float key[5] = {(float)_type, (float)_k, (float)_m, _beta, _dt};
+    if (cache && liquid_design_cache_lookup(LIQUID_DESIGN_CACHE_PROTOTYPE, key, sizeof(key), _h, h_len))
+        return LIQUID_OK;
+
+    int rc;
     switch (_type) {
     // Nyquist filter prototypes
     case LIQUID_FIRFILT_KAISER:     return liquid_firdes_kaiser   (h_len, fc, as, _dt, _h);
     case LIQUID_FIRFILT_PM:
         // NOTE: input timing offset is ignored here
         return firdespm_run(h_len, 3, bands, des, weights, wtype, LIQUID_FIRDESPM_BANDPASS, _h);
-    case LIQUID_FIRFILT_RCOS:       return liquid_firdes_rcos     (_k, _m, _beta, _dt, _h);
-    case LIQUID_FIRFILT_FEXP:       return liquid_firdes_fexp     (_k, _m, _beta, _dt, _h);
-    case LIQUID_FIRFILT_FSECH:      return liquid_firdes_fsech    (_k, _m, _beta, _dt, _h);
-    case LIQUID_FIRFILT_FARCSECH:   return liquid_firdes_farcsech (_k, _m, _beta, _dt, _h);
+    case LIQUID_FIRFILT_RCOS:       rc = liquid_firdes_rcos     (_k, _m, _beta, _dt, _h); break;
+    case LIQUID_FIRFILT_FEXP:       rc = liquid_firdes_fexp     (_k, _m, _beta, _dt, _h); break;
+    case LIQUID_FIRFILT_FSECH:      rc = liquid_firdes_fsech    (_k, _m, _beta, _dt, _h); break;
+    case LIQUID_FIRFILT_FARCSECH:   rc = liquid_firdes_farcsech (_k, _m, _beta, _dt, _h); break;
 
     // root-Nyquist filter prototypes
-    case LIQUID_FIRFILT_ARKAISER:   return liquid_firdes_arkaiser (_k, _m, _beta, _dt, _h);
-    case LIQUID_FIRFILT_RKAISER:    return liquid_firdes_rkaiser  (_k, _m, _beta, _dt, _h);
-    case LIQUID_FIRFILT_RRC:        return liquid_firdes_rrcos    (_k, _m, _beta, _dt, _h);
-    case LIQUID_FIRFILT_hM3:        return liquid_firdes_hM3      (_k, _m, _beta, _dt, _h);
-    case LIQUID_FIRFILT_GMSKTX:     return liquid_firdes_gmsktx   (_k, _m, _beta, _dt, _h);
-    case LIQUID_FIRFILT_GMSKRX:     return liquid_firdes_gmskrx   (_k, _m, _beta, _dt, _h);
-    case LIQUID_FIRFILT_RFEXP:      return liquid_firdes_rfexp    (_k, _m, _beta, _dt, _h);
-    case LIQUID_FIRFILT_RFSECH:     return liquid_firdes_rfsech   (_k, _m, _beta, _dt, _h);
-    case LIQUID_FIRFILT_RFARCSECH:  return liquid_firdes_rfarcsech(_k, _m, _beta, _dt, _h);
+    case LIQUID_FIRFILT_ARKAISER:   rc = liquid_firdes_arkaiser (_k, _m, _beta, _dt, _h); break;
+    case LIQUID_FIRFILT_RKAISER:    rc = liquid_firdes_rkaiser  (_k, _m, _beta, _dt, _h); break;
+    case LIQUID_FIRFILT_RRC:        rc = liquid_firdes_rrcos    (_k, _m, _beta, _dt, _h); break;
+    case LIQUID_FIRFILT_hM3:        rc = liquid_firdes_hM3      (_k, _m, _beta, _dt, _h); break;
+    case LIQUID_FIRFILT_GMSKTX:     rc = liquid_firdes_gmsktx   (_k, _m, _beta, _dt, _h); break;
+    case LIQUID_FIRFILT_GMSKRX:     rc = liquid_firdes_gmskrx   (_k, _m, _beta, _dt, _h); break;
+    case LIQUID_FIRFILT_RFEXP:      rc = liquid_firdes_rfexp    (_k, _m, _beta, _dt, _h); break;
+    case LIQUID_FIRFILT_RFSECH:     rc = liquid_firdes_rfsech   (_k, _m, _beta, _dt, _h); break;
+    case LIQUID_FIRFILT_RFARCSECH:  rc = liquid_firdes_rfarcsech(_k, _m, _beta, _dt, _h); break;
     default:
         return liquid_error(LIQUID_EICONFIG,"liquid_firdes_prototype(), filter type '%d'", _type);
     }
-    return LIQUID_OK;
+    if (rc != LIQUID_OK)
+        return rc;
+    return liquid_design_cache_insert(LIQUID_DESIGN_CACHE_PROTOTYPE, key, sizeof(key), _h, h_len);
 }
 
 
@@ -55,6 +55,10 @@
 
 #include "liquid.internal.h"
 
+#if HAVE_LIBPTHREAD
+#include <pthread.h>
+#endif
+
 #define LIQUID_FIRDESPM_DEBUG       0
 #define LIQUID_FIRDESPM_DEBUG_PRINT 0
 
@@ -73,13 +77,35 @@ int firdespm_init_memory(firdespm     _q,
 // initialize the frequency grid on the disjoint bounded set
 int firdespm_init_grid(firdespm _q);
 
+// initial guess of extremal frequencies; long filters scale the
+// converged extremal set of a filter about half the length
+int firdespm_init_iext(firdespm _q);
+
+// run Remez exchange iterations from current extremal set
+int firdespm_iterate(firdespm _q);
+
 // compute interpolating polynomial
 int firdespm_compute_interp(firdespm _q);
 
+// compute barycentric weights for all Chebyshev points
+int firdespm_compute_weights(firdespm _q);
+
+// update barycentric weights after moving Chebyshev point _m to _xm,
+// returning non-zero if the update could not be applied
+int firdespm_update_weights(firdespm _q, unsigned int _m, double _xm);
+
+// evaluate interpolating polynomial at a single point
+double firdespm_evaluate(firdespm _q, double _x0);
+
 // compute error signal from actual response (interpolator
 // output), desired response, and weights
 int firdespm_compute_error(firdespm _q);
 
+// compute error signal on grid points [_i0,_i1)
+int firdespm_compute_error_block(firdespm     _q,
+                                 unsigned int _i0,
+                                 unsigned int _i1);
+
 // search error curve for _r+1 extremal indices
 int firdespm_iext_search(firdespm _q);
 
@@ -115,11 +141,17 @@ struct firdespm_s {
     double * D;                 // desired response
     double * W;                 // weight
     double * E;                 // error
+    double * X;                 // Chebyshev abscissae : cos(2*pi*F)
+    unsigned int * grid_band;   // index of first grid point in each band
 
     double * x;                 // Chebyshev points : cos(2*pi*f)
     double * alpha;             // Lagrange interpolating polynomial
     double * c;                 // interpolants
+    double * ac;                // alpha*c
     double rho;                 // extremal weighted error
+    int      alpha_valid;       // barycentric weights match Chebyshev points
+
+    unsigned int num_workers;   // number of threads evaluating error
 
     unsigned int * iext;        // indices of extrema
     unsigned int num_exchanges; // number of changes in extrema
@@ -149,16 +181,50 @@ int firdespm_run(unsigned int            _h_len,
                  liquid_firdespm_wtype * _wtype,
                  liquid_firdespm_btype   _btype,
                  float *                 _h)
+{
+    // check design cache, keyed on all parameters (with defaults applied)
+    unsigned int key_len = 2 + 5*_num_bands;
+    float key[key_len];
+    unsigned int i;
+    key[0] = (float)_h_len;
+    key[1] = (float)_btype;
+    for (i=0; i<_num_bands; i++) {
+        key[2+5*i+0] = _bands[2*i+0];
+        key[2+5*i+1] = _bands[2*i+1];
+        key[2+5*i+2] = _des[i];
+        key[2+5*i+3] = _weights == NULL ? 1.0f : _weights[i];
+        key[2+5*i+4] = _wtype   == NULL ? (float)LIQUID_FIRDESPM_FLATWEIGHT : (float)_wtype[i];
+    }
+    if (liquid_design_cache_lookup(LIQUID_DESIGN_CACHE_FIRDESPM, key, key_len*sizeof(float), _h, _h_len))
+        return LIQUID_OK;
+
+    int rc = firdespm_run_uncached(_h_len,_num_bands,_bands,_des,_weights,_wtype,_btype,_h);
+    if (rc != LIQUID_OK)
+        return rc;
+    return liquid_design_cache_insert(LIQUID_DESIGN_CACHE_FIRDESPM, key, key_len*sizeof(float), _h, _h_len);
+}
+
+// run filter design, bypassing the design cache (for iterative designs)
+int firdespm_run_uncached(unsigned int            _h_len,
+                          unsigned int            _num_bands,
+                          float *                 _bands,
+                          float *                 _des,
+                          float *                 _weights,
+                          liquid_firdespm_wtype * _wtype,
+                          liquid_firdespm_btype   _btype,
+                          float *                 _h)
 {
     // create object
     firdespm q = firdespm_create(_h_len,_num_bands,_bands,_des,_weights,_wtype,_btype);
+    if (q == NULL)
+        return liquid_error(LIQUID_EICONFIG,"firdespm_run(), invalid configuration");
 
     // execute
-    firdespm_execute(q,_h);
+    int rc = firdespm_execute(q,_h);
 
     // destroy
     firdespm_destroy(q);
-    return LIQUID_OK;
+    return rc;
 }
 
 // run filter design for basic low-pass filter
@@ -258,6 +324,9 @@ firdespm firdespm_create(unsigned int            _h_len,
     q->x     = (double*) malloc((q->r+1)*sizeof(double));
     q->alpha = (double*) malloc((q->r+1)*sizeof(double));
     q->c     = (double*) malloc((q->r+1)*sizeof(double));
+    q->ac    = (double*) malloc((q->r+1)*sizeof(double));
+    q->alpha_valid = 0;
+    q->num_workers = 1;
 
     // allocate memory for arrays
     q->num_bands = _num_bands;
@@ -301,6 +370,8 @@ firdespm firdespm_create(unsigned int            _h_len,
     q->D = (double*) malloc(q->grid_size*sizeof(double));
     q->W = (double*) malloc(q->grid_size*sizeof(double));
     q->E = (double*) malloc(q->grid_size*sizeof(double));
+    q->X = (double*) malloc(q->grid_size*sizeof(double));
+    q->grid_band = (unsigned int*) malloc((q->num_bands+1)*sizeof(unsigned int));
     q->callback = NULL;
     q->userdata = NULL;
     firdespm_init_grid(q);
@@ -361,6 +432,9 @@ firdespm firdespm_create_callback(unsigned int          _h_len,
     q->x     = (double*) malloc((q->r+1)*sizeof(double));
     q->alpha = (double*) malloc((q->r+1)*sizeof(double));
     q->c     = (double*) malloc((q->r+1)*sizeof(double));
+    q->ac    = (double*) malloc((q->r+1)*sizeof(double));
+    q->alpha_valid = 0;
+    q->num_workers = 1;
 
     // allocate memory for arrays
     q->num_bands = _num_bands;
@@ -393,6 +467,8 @@ firdespm firdespm_create_callback(unsigned int          _h_len,
     q->D = (double*) malloc(q->grid_size*sizeof(double));
     q->W = (double*) malloc(q->grid_size*sizeof(double));
     q->E = (double*) malloc(q->grid_size*sizeof(double));
+    q->X = (double*) malloc(q->grid_size*sizeof(double));
+    q->grid_band = (unsigned int*) malloc((q->num_bands+1)*sizeof(unsigned int));
     firdespm_init_grid(q);
     // TODO : fix grid, weights according to filter type
 
@@ -422,12 +498,15 @@ firdespm firdespm_copy(firdespm q_orig)
     q_copy->D = (double*) liquid_malloc_copy(q_copy->D, q_orig->grid_size, sizeof(double));
     q_copy->W = (double*) liquid_malloc_copy(q_copy->W, q_orig->grid_size, sizeof(double));
     q_copy->E = (double*) liquid_malloc_copy(q_copy->E, q_orig->grid_size, sizeof(double));
+    q_copy->X = (double*) liquid_malloc_copy(q_copy->X, q_orig->grid_size, sizeof(double));
+    q_copy->grid_band = (unsigned int*) liquid_malloc_copy(q_copy->grid_band, q_orig->num_bands+1, sizeof(unsigned int));
 
     // copy memory for extremal frequency set, interpolating polynomial
     q_copy->iext  = (unsigned int*) liquid_malloc_copy(q_copy->iext, q_orig->r+1,sizeof(unsigned int));
     q_copy->x     = (double*)       liquid_malloc_copy(q_copy->x,    q_orig->r+1,sizeof(double));
     q_copy->alpha = (double*)       liquid_malloc_copy(q_copy->alpha,q_orig->r+1,sizeof(double));
     q_copy->c     = (double*)       liquid_malloc_copy(q_copy->c,    q_orig->r+1,sizeof(double));
+    q_copy->ac    = (double*)       liquid_malloc_copy(q_copy->ac,   q_orig->r+1,sizeof(double));
 
     return q_copy;
 }
@@ -444,12 +523,15 @@ int firdespm_destroy(firdespm _q)
     free(_q->x);
     free(_q->alpha);
     free(_q->c);
+    free(_q->ac);
 
     // free dense grid elements
     free(_q->F);
     free(_q->D);
     free(_q->W);
     free(_q->E);
+    free(_q->X);
+    free(_q->grid_band);
 
     // free band description elements
     free(_q->bands);
@@ -488,46 +570,28 @@ int firdespm_print(firdespm _q)
     return LIQUID_OK;
 }
 
+// set number of threads evaluating the error on the dense grid
+int firdespm_set_workers(firdespm _q, unsigned int _num_workers)
+{
+    if (_num_workers == 0)
+        return liquid_error(LIQUID_EICONFIG,"firdespm_set_workers(), number of workers must be greater than zero");
+    _q->num_workers = _num_workers;
+    return LIQUID_OK;
+}
+
 // execute filter design, storing result in _h
 int firdespm_execute(firdespm _q, float * _h)
 {
-    unsigned int i;
-
-    // initial guess of extremal frequencies evenly spaced on F
-    // TODO : guarantee at least one extremal frequency lies in each band
-    for (i=0; i<_q->r+1; i++) {
-        _q->iext[i] = (i * (_q->grid_size-1)) / _q->r;
-#if LIQUID_FIRDESPM_DEBUG_PRINT
-        printf("iext_guess[%3u] = %u\n", i, _q->iext[i]);
-#endif
-    }
+    // initial guess of extremal frequencies
+    firdespm_init_iext(_q);
 
     // iterate over the Remez exchange algorithm
-    unsigned int p;
-    unsigned int max_iterations = 40;
-    for (p=0; p<max_iterations; p++) {
-        // compute interpolator
-        firdespm_compute_interp(_q);
-
-        // compute error
-        firdespm_compute_error(_q);
-
-        // search for new extremal frequencies
-        firdespm_iext_search(_q);
-
-        // check stopping criteria
-        if (firdespm_is_search_complete(_q))
-            break;
-    }
-#if LIQUID_FIRDESPM_DEBUG_PRINT
-    printf("search complete in %u iterations\n", p);
-#endif
+    firdespm_iterate(_q);
 
     // compute filter taps
     return firdespm_compute_taps(_q, _h);
 }
 
-
 // 
 // internal methods
 //
@@ -591,6 +655,7 @@ int firdespm_init_grid(firdespm _q)
 
         // ensure at least one point per band
         if (num_points < 1) num_points = 1;
+        _q->grid_band[i] = n;
 
         //printf("band : [%12.8f %12.8f] %3u points\n",f0,f1,num_points);
 
@@ -622,6 +687,7 @@ int firdespm_init_grid(firdespm _q)
         _q->F[n-1] = f1;   // according to Janovetz
     }
     _q->grid_size = n;
+    _q->grid_band[_q->num_bands] = n;
 
     // take care of special symmetry conditions here
     if (_q->btype == LIQUID_FIRDESPM_BANDPASS) {
@@ -650,35 +716,177 @@ int firdespm_init_grid(firdespm _q)
             }
         }
     }
+
+    // Chebyshev abscissae, computed once for all iterations
+    for (i=0; i<_q->grid_size; i++)
+        _q->X[i] = cos(2*M_PI*_q->F[i]);
     return LIQUID_OK;
 }
 
-// compute interpolating polynomial
-int firdespm_compute_interp(firdespm _q)
+// initial guess of extremal frequencies; long filters scale the
+// converged extremal set of a filter about half the length, which
+// avoids starting from a reference whose weighted error is at the
+// level of machine precision (reference scaling)
+int firdespm_init_iext(firdespm _q)
 {
-    unsigned int i;
+    unsigned int i, b;
+    _q->alpha_valid = 0;
+
+    // design shorter filter with the same specification
+    firdespm p = NULL;
+    if (_q->r >= 512 && (_q->btype == LIQUID_FIRDESPM_BANDPASS || _q->s == 1)) {
+        float bands[2*_q->num_bands];
+        float des[_q->num_bands];
+        float weights[_q->num_bands];
+        for (i=0; i<2*_q->num_bands; i++)
+            bands[i] = _q->bands[i];
+        for (i=0; i<_q->num_bands; i++) {
+            des[i]     = _q->des[i];
+            weights[i] = _q->weights[i];
+        }
+        unsigned int h_len = 2*(_q->n/2) + _q->s;
+        p = _q->callback == NULL ?
+            firdespm_create(h_len, _q->num_bands, bands, des, weights, _q->wtype, _q->btype) :
+            firdespm_create_callback(h_len, _q->num_bands, bands, _q->btype, _q->callback, _q->userdata);
+    }
+    if (p != NULL) {
+        p->num_workers = _q->num_workers;
+        firdespm_init_iext(p);
+        firdespm_iterate(p);
+
+        // distribute extremal frequencies among bands in proportion
+        // to those of the shorter filter
+        unsigned int n = _q->r+1;
+        unsigned int nb = _q->num_bands;
+        unsigned int kp[nb];   // number in each band, short filter
+        unsigned int kq[nb];   // number in each band, this filter
+        unsigned int ip[nb];   // index of first in each band, short filter
+        unsigned int num_assigned = 0;
+        unsigned int bmax = 0;
+        for (b=0; b<nb; b++) {
+            kp[b] = 0;
+            ip[b] = 0;
+            for (i=0; i<p->r+1; i++) {
+                if (p->iext[i] >= p->grid_band[b] && p->iext[i] < p->grid_band[b+1]) {
+                    if (kp[b] == 0) ip[b] = i;
+                    kp[b]++;
+                }
+            }
+            kq[b] = (unsigned int)( (double)kp[b] * n / (p->r+1) + 0.5 );
+            num_assigned += kq[b];
+            if (kp[b] > kp[bmax]) bmax = b;
+        }
+        if (num_assigned != n && kq[bmax] + n > num_assigned)
+            kq[bmax] += n - num_assigned;
+
+        // interpolate frequencies within each band, rounding to the
+        // nearest grid point and keeping indices strictly increasing
+        int valid = 1;
+        unsigned int m = 0;
+        double df = 0.5/(_q->grid_density*_q->r);
+        for (b=0; b<nb && valid; b++) {
+            unsigned int g0 = _q->grid_band[b];
+            unsigned int g1 = _q->grid_band[b+1];
+            for (i=0; i<kq[b]; i++) {
+                double f;
+                if (kp[b] == 0 || kq[b] == 1) {
+                    f = _q->F[g0] + (i+0.5)*(_q->F[g1-1] - _q->F[g0]) / kq[b];
+                } else {
+                    double u  = (double)i * (kp[b]-1) / (kq[b]-1);
+                    unsigned int j = (unsigned int)u;
+                    if (j >= kp[b]-1) j = kp[b]-2;
+                    double f0 = p->F[p->iext[ip[b]+j  ]];
+                    double f1 = p->F[p->iext[ip[b]+j+1]];
+                    f = f0 + (u - j)*(f1 - f0);
+                }
+                double v = (f - _q->F[g0]) / df + 0.5;
+                unsigned int k = g0 + (v < 0 ? 0 : (unsigned int)v);
+                if (k > g1-1) k = g1-1;
+                if (m > 0 && k <= _q->iext[m-1]) k = _q->iext[m-1] + 1;
+                if (k >= g1 || m >= n) {
+                    valid = 0;
+                    break;
+                }
+                _q->iext[m++] = k;
+            }
+        }
+        firdespm_destroy(p);
+        if (valid && m == n)
+            return LIQUID_OK;
+    }
 
-    // compute Chebyshev points on F[iext[]] : cos(2*pi*f)
+    // evenly spaced on F
+    // TODO : guarantee at least one extremal frequency lies in each band
     for (i=0; i<_q->r+1; i++) {
-        _q->x[i] = cos(2*M_PI*_q->F[_q->iext[i]]);
+        _q->iext[i] = (i * (_q->grid_size-1)) / _q->r;
+#if LIQUID_FIRDESPM_DEBUG_PRINT
+        printf("iext_guess[%3u] = %u\n", i, _q->iext[i]);
+#endif
+    }
+    return LIQUID_OK;
+}
+
+// run Remez exchange iterations from current extremal set
+int firdespm_iterate(firdespm _q)
+{
+    unsigned int p;
+    unsigned int max_iterations = 40;
+    for (p=0; p<max_iterations; p++) {
+        // compute interpolator
+        firdespm_compute_interp(_q);
+
+        // compute error
+        firdespm_compute_error(_q);
+
+        // search for new extremal frequencies
+        firdespm_iext_search(_q);
+
+        // check stopping criteria
+        if (firdespm_is_search_complete(_q))
+            break;
+    }
 #if LIQUID_FIRDESPM_DEBUG_PRINT
-        printf("x[%3u] = %12.8f\n", i, _q->x[i]);
+    printf("search complete in %u iterations\n", p);
 #endif
+    return LIQUID_OK;
+}
+
+// compute interpolating polynomial
+int firdespm_compute_interp(firdespm _q)
+{
+    unsigned int i;
+    unsigned int n = _q->r+1;
+
+    // Chebyshev points on F[iext[]] : cos(2*pi*f); count how many
+    // have moved since the barycentric weights were last computed
+    unsigned int num_moved = 0;
+    if (_q->alpha_valid) {
+        for (i=0; i<n; i++)
+            num_moved += _q->x[i] != _q->X[_q->iext[i]] ? 1 : 0;
     }
-    //printf("\n");
 
-    // compute Lagrange interpolating polynomial
-    poly_fit_lagrange_barycentric(_q->x,_q->r+1,_q->alpha);
+    // update weights incrementally (O(r) per point) when only a few
+    // points have moved, otherwise recompute all (O(r^2))
+    int recompute = !_q->alpha_valid || num_moved > n/8;
+    for (i=0; i<n && !recompute; i++) {
+        if (_q->x[i] != _q->X[_q->iext[i]])
+            recompute = firdespm_update_weights(_q, i, _q->X[_q->iext[i]]);
+    }
+    if (recompute) {
+        for (i=0; i<n; i++)
+            _q->x[i] = _q->X[_q->iext[i]];
+        firdespm_compute_weights(_q);
+    }
+    _q->alpha_valid = 1;
 #if LIQUID_FIRDESPM_DEBUG_PRINT
-    for (i=0; i<_q->r+1; i++)
-        printf("a[%3u] = %12.8f\n", i, _q->alpha[i]);
+    for (i=0; i<n; i++)
+        printf("x[%3u] = %12.8f, a[%3u] = %12.8f\n", i, _q->x[i], i, _q->alpha[i]);
 #endif
 
     // compute rho
     double t0 = 0.0;    // numerator
     double t1 = 0.0;    // denominator
-    for (i=0; i<_q->r+1; i++) {
-        //printf("D[%3u] = %16.8e, W[%3u] = %16.8e\n", i, _q->D[_q->iext[i]], i, _q->W[_q->iext[i]]);
+    for (i=0; i<n; i++) {
         t0 += _q->alpha[i] * _q->D[_q->iext[i]];
         t1 += _q->alpha[i] / _q->W[_q->iext[i]] * (i % 2 ? -1.0 : 1.0);
     }
@@ -689,8 +897,9 @@ int firdespm_compute_interp(firdespm _q)
 #endif
 
     // compute polynomial values (interpolants)
-    for (i=0; i<_q->r+1; i++) {
-        _q->c[i] = _q->D[_q->iext[i]] - (i % 2 ? -1 : 1) * _q->rho / _q->W[_q->iext[i]];
+    for (i=0; i<n; i++) {
+        _q->c[i]  = _q->D[_q->iext[i]] - (i % 2 ? -1 : 1) * _q->rho / _q->W[_q->iext[i]];
+        _q->ac[i] = _q->alpha[i] * _q->c[i];
 #if LIQUID_FIRDESPM_DEBUG_PRINT
         printf("c[%3u] = %16.8e\n", i, _q->c[i]);
 #endif
@@ -698,23 +907,186 @@ int firdespm_compute_interp(firdespm _q)
     return LIQUID_OK;
 }
 
-int firdespm_compute_error(firdespm _q)
+// compute barycentric weights for all Chebyshev points,
+//   alpha[j] = 1 / prod_{k != j} 2(x[j] - x[k]),
+// keeping the exponent separate while accumulating the product; the
+// unscaled product under- or overflows for long filters
+int firdespm_compute_weights(firdespm _q)
 {
-    unsigned int i;
+    unsigned int j, k;
+    unsigned int n = _q->r+1;
+    int e[n];
+    int emax = 0;
+    for (j=0; j<n; j++) {
+        double p = 1.0;
+        int t;
+        e[j] = 0;
+        for (k=0; k<n; k++) {
+            if (k == j) continue;
+            p *= 2.0*(_q->x[j] - _q->x[k]);
+
+            // renormalize periodically; 16 terms cannot leave range
+            if ((k & 15) == 15) {
+                p = frexp(p, &t);
+                e[j] -= t;
+            }
+        }
+        p = frexp(p, &t);
+        e[j] -= t;
+
+        // coincident points (touching bands) : add minuscule margin
+        if (p == 0.0) p = 1.0e-9;
+        _q->alpha[j] = 1.0 / p;
+        if (j == 0 || e[j] > emax)
+            emax = e[j];
+    }
 
-    double xf;
-    double H;
-    for (i=0; i<_q->grid_size; i++) {
-        // compute actual response
-        xf = cos(2*M_PI*_q->F[i]);
-        H = poly_val_lagrange_barycentric(_q->x,_q->c,_q->alpha,xf,_q->r+1);
+    // normalize so the largest weight is of order one
+    for (j=0; j<n; j++)
+        _q->alpha[j] = ldexp(_q->alpha[j], e[j] - emax);
+    return LIQUID_OK;
+}
 
-        // compute error
-        _q->E[i] = _q->W[i] * (_q->D[i] - H);
+// update barycentric weights after moving Chebyshev point _m to _xm,
+// returning non-zero if the update could not be applied
+int firdespm_update_weights(firdespm _q, unsigned int _m, double _xm)
+{
+    unsigned int k;
+    unsigned int n = _q->r+1;
+    double xo = _q->x[_m];
+
+    // new point must not coincide with any other point in the set
+    for (k=0; k<n; k++) {
+        if (k != _m && _q->x[k] == _xm)
+            return 1;
+    }
+
+    // each weight picks up the ratio of old and new distances to the
+    // moved point; the moved point's weight picks up their product
+    double p = 1.0;
+    int e = 0, t;
+    for (k=0; k<n; k++) {
+        if (k == _m) continue;
+        double d = _q->x[k];
+        _q->alpha[k] *= (d - xo) / (d - _xm);
+        p *= (xo - d) / (_xm - d);
+        if ((k & 15) == 15) {
+            p = frexp(p, &t);
+            e += t;
+        }
+    }
+    _q->alpha[_m] *= ldexp(p, e);
+    _q->x[_m] = _xm;
+    return isfinite(_q->alpha[_m]) && _q->alpha[_m] != 0.0 ? 0 : 1;
+}
+
+// evaluate interpolating polynomial at a single point
+double firdespm_evaluate(firdespm _q, double _x0)
+{
+    double t0 = 0.0;    // numerator sum
+    double t1 = 0.0;    // denominator sum
+    unsigned int k;
+    for (k=0; k<_q->r+1; k++) {
+        double g = _x0 - _q->x[k];
+
+        // test for exact fit
+        if (g == 0.0)
+            return _q->c[k];
+
+        t0 += _q->ac[k]    / g;
+        t1 += _q->alpha[k] / g;
+    }
+    return t0 / t1;
+}
+
+// compute error signal on grid points [_i0,_i1)
+int firdespm_compute_error_block(firdespm     _q,
+                                 unsigned int _i0,
+                                 unsigned int _i1)
+{
+    const double * x  = _q->x;
+    const double * a  = _q->alpha;
+    const double * ac = _q->ac;
+    unsigned int n = _q->r+1;
+    unsigned int i, j, k;
+
+    // evaluate barycentric form at four grid points at once with
+    // independent accumulators; points coinciding with a Chebyshev
+    // point evaluate to NaN here and are resolved below
+    for (i=_i0; i<_i1; i+=4) {
+        unsigned int b = _i1 - i < 4 ? _i1 - i : 4;
+        double xf[4];
+        double t0[4] = {0.0, 0.0, 0.0, 0.0};
+        double t1[4] = {0.0, 0.0, 0.0, 0.0};
+        for (j=0; j<4; j++)
+            xf[j] = _q->X[j < b ? i+j : i];
+        for (k=0; k<n; k++) {
+            for (j=0; j<4; j++) {
+                double g = 1.0 / (xf[j] - x[k]);
+                t0[j] += ac[k] * g;
+                t1[j] += a[k]  * g;
+            }
+        }
+        for (j=0; j<b; j++)
+            _q->E[i+j] = _q->W[i+j] * (_q->D[i+j] - t0[j]/t1[j]);
+    }
+
+    // resolve exact fits
+    for (i=_i0; i<_i1; i++) {
+        if (!isfinite(_q->E[i]))
+            _q->E[i] = _q->W[i] * (_q->D[i] - firdespm_evaluate(_q, _q->X[i]));
     }
     return LIQUID_OK;
 }
 
+#if HAVE_LIBPTHREAD
+// worker thread context for computing error on block of grid points
+struct firdespm_worker_s {
+    firdespm     q;
+    unsigned int i0;
+    unsigned int i1;
+};
+
+// worker thread: compute error on block of grid points
+void * firdespm_error_worker(void * _context)
+{
+    struct firdespm_worker_s * c = (struct firdespm_worker_s*) _context;
+    firdespm_compute_error_block(c->q, c->i0, c->i1);
+    return NULL;
+}
+#endif
+
+int firdespm_compute_error(firdespm _q)
+{
+#if HAVE_LIBPTHREAD
+    // split grid into contiguous blocks, evaluating first on this thread
+    unsigned int i;
+    unsigned int num_workers = _q->num_workers;
+    if (num_workers > _q->grid_size / 256)
+        num_workers = _q->grid_size / 256;
+    if (num_workers > 1) {
+        pthread_t                threads[num_workers];
+        struct firdespm_worker_s context[num_workers];
+        int                      started[num_workers];
+        for (i=0; i<num_workers; i++) {
+            context[i].q  = _q;
+            context[i].i0 = (i  *_q->grid_size) / num_workers;
+            context[i].i1 = ((i+1)*_q->grid_size) / num_workers;
+            started[i] = i > 0 &&
+                pthread_create(&threads[i], NULL, firdespm_error_worker, &context[i]) == 0;
+        }
+        for (i=0; i<num_workers; i++) {
+            if (started[i])
+                pthread_join(threads[i], NULL);
+            else
+                firdespm_error_worker(&context[i]);
+        }
+        return LIQUID_OK;
+    }
+#endif
+    return firdespm_compute_error_block(_q, 0, _q->grid_size);
+}
+
 // search error curve for r+1 extremal indices
 // TODO : return number of values which have changed (stopping criteria)
 int firdespm_iext_search(firdespm _q)
@@ -904,7 +1276,7 @@ int firdespm_compute_taps(firdespm _q, float * _h)
     for (i=0; i<p; i++) {
         double f = (double)(i) / (double)(_q->h_len);
         double xf = cos(2*M_PI*f);
-        double cf = poly_val_lagrange_barycentric(_q->x,_q->c,_q->alpha,xf,_q->r+1);
+        double cf = firdespm_evaluate(_q, xf);
         double g=1.0;
 
         if (_q->btype == LIQUID_FIRDESPM_BANDPASS && _q->s==1) {
@@ -928,14 +1300,26 @@ int firdespm_compute_taps(firdespm _q, float * _h)
     // TODO : flesh out computation for other filter types
     unsigned int j;
     if (_q->btype == LIQUID_FIRDESPM_BANDPASS) {
-        // odd filter length, even symmetry
+        // odd filter length, even symmetry; every argument 2*pi*f*j is a
+        // multiple of pi/h_len so cosines are read from a table
+        unsigned int N = 2*_q->h_len;
+        double * T = (double*) malloc(N*sizeof(double));
+        for (i=0; i<N; i++)
+            T[i] = cos(M_PI*(double)i/(double)(_q->h_len));
         for (i=0; i<_q->h_len; i++) {
             double v = G[0];
-            double f = ((double)i - (double)(p-1) + 0.5*(1-_q->s)) / (double)(_q->h_len);
-            for (j=1; j<_q->r; j++)
-                v += 2.0 * G[j] * cos(2*M_PI*f*j);
+            // 2*f*h_len, reduced modulo N
+            long m = (2*(long)i - 2*(long)(p-1) + (1-(long)_q->s)) % (long)N;
+            unsigned int step = (unsigned int)(m < 0 ? m + N : m);
+            unsigned int k = 0;
+            for (j=1; j<_q->r; j++) {
+                k += step;
+                if (k >= N) k -= N;
+                v += 2.0 * G[j] * T[k];
+            }
             _h[i] = v / (double)(_q->h_len);
         }
+        free(T);
     } else if (_q->btype != LIQUID_FIRDESPM_BANDPASS && _q->s==1) {
         // odd filter length, odd symmetry
         return liquid_error(LIQUID_EINT,"firdespm_compute_taps(), filter configuration not yet supported");
@@ -26,7 +26,7 @@
 #include <math.h>
 #include <assert.h>
 
-#include "liquid.h"
+#include "liquid.internal.h"
 
 // structured data type
 struct firdespm_halfband_s {
@@ -57,7 +57,7 @@ float firdespm_halfband_utility(float _gamma, void * _userdata)
     float weights[2] = {1.0f, 1.0f}; // best with {1, 1}
     liquid_firdespm_wtype wtype[2] = { // best with {flat, flat}
         LIQUID_FIRDESPM_FLATWEIGHT, LIQUID_FIRDESPM_FLATWEIGHT,};
-    firdespm_run(q->h_len, 2, bands, des, weights, wtype,
+    firdespm_run_uncached(q->h_len, 2, bands, des, weights, wtype,
         LIQUID_FIRDESPM_BANDPASS, q->h);
 
     // compute utility; copy ideal non-zero coefficients and compute transform
@@ -55,6 +55,7 @@ struct FIRFILT(_s) {
 #endif
     DOTPROD() dp;           // dot product object
     TC scale;               // output scaling factor
+    LIQUID_PROFILE_MEMBER   // profiling counters
 };
 
 // create firfilt object
@@ -94,6 +95,7 @@ FIRFILT() FIRFILT(_create)(TC * _h,
 
     // reset filter state (clear buffer)
     FIRFILT(_reset)(q);
+    LIQUID_PROFILE_CREATE(q, LIQUID_PROFILE_TYPE(FIRFILT()));
 
     return q;
 }
@@ -314,12 +316,14 @@ FIRFILT() FIRFILT(_copy)(FIRFILT() q_orig)
 
     // copy dot product object and return
     q_copy->dp    = DOTPROD(_copy)(q_orig->dp);
+    LIQUID_PROFILE_CREATE(q_copy, LIQUID_PROFILE_TYPE(FIRFILT()));
     return q_copy;
 }
 
 // destroy firfilt object
 int FIRFILT(_destroy)(FIRFILT() _q)
 {
+    LIQUID_PROFILE_DESTROY(_q);
 #if LIQUID_FIRFILT_USE_WINDOW
     WINDOW(_destroy)(_q->w);
 #else
@@ -425,6 +429,8 @@ int FIRFILT(_write)(FIRFILT()    _q,
 int FIRFILT(_execute)(FIRFILT() _q,
                       TO *      _y)
 {
+    LIQUID_PROFILE_BEGIN(_q);
+
     // read buffer (retrieve pointer to aligned memory array)
 #if LIQUID_FIRFILT_USE_WINDOW
     TI *r;
@@ -438,6 +444,7 @@ int FIRFILT(_execute)(FIRFILT() _q,
 
     // apply scaling factor
     *_y *= _q->scale;
+    LIQUID_PROFILE_END(_q, 1);
     return LIQUID_OK;
 }
 
@@ -461,6 +468,7 @@ int FIRFILT(_execute_block)(FIRFILT()    _q,
                             unsigned int _n,
                             TO *         _y)
 {
+    LIQUID_PROFILE_BEGIN(_q);
     unsigned int i;
     for (i=0; i<_n; i++) {
         // push sample into filter
@@ -469,6 +477,7 @@ int FIRFILT(_execute_block)(FIRFILT()    _q,
         // compute output sample
         FIRFILT(_execute)(_q, &_y[i]);
     }
+    LIQUID_PROFILE_END(_q, _n);
     return LIQUID_OK;
 }
 
@@ -27,6 +27,10 @@
 #include <stdlib.h>
 #include <math.h>
 
+// number of samples per polyphase branch processed in each iteration of
+// the block methods
+#define FIRHILB_BLOCK_LEN   (128)
+
 struct FIRHILB(_s) {
     T * h;                  // filter coefficients
     T complex * hc;         // filter coefficients (complex)
@@ -52,8 +56,28 @@ struct FIRHILB(_s) {
 
     // regular real-to-complex/complex-to-real operation
     unsigned int toggle;
+
+    // linearized polyphase branch buffers for block operations, each
+    // holding the window contents followed by the new branch samples
+    T * b0;
+    T * b1;
+    T * b2;
+    T * b3;
+    unsigned int b_len;     // branch buffer length (2*m + FIRHILB_BLOCK_LEN)
 };
 
+// load window contents into head of polyphase branch buffer
+static int FIRHILB(_block_load)(FIRHILB() _q,
+                                WINDOW()  _w,
+                                T *       _b);
+
+// store most recent branch samples back into window after _n new
+// samples have been appended to the branch buffer
+static int FIRHILB(_block_store)(FIRHILB()    _q,
+                                 WINDOW()     _w,
+                                 T *          _b,
+                                 unsigned int _n);
+
 // create firhilb object
 //  _m      :   filter semi-length (delay: 2*m+1)
 //  _as     :   stop-band attenuation [dB]
@@ -103,6 +127,13 @@ FIRHILB() FIRHILB(_create)(unsigned int _m,
     // create internal dot product object
     q->dpq = DOTPROD(_create)(q->hq, q->hq_len);
 
+    // allocate polyphase branch buffers for block operations
+    q->b_len = q->hq_len + FIRHILB_BLOCK_LEN;
+    q->b0 = (T *) malloc(q->b_len*sizeof(T));
+    q->b1 = (T *) malloc(q->b_len*sizeof(T));
+    q->b2 = (T *) malloc(q->b_len*sizeof(T));
+    q->b3 = (T *) malloc(q->b_len*sizeof(T));
+
     // reset internal state and return object
     FIRHILB(_reset)(q);
     return q;
@@ -123,6 +154,12 @@ FIRHILB() FIRHILB(_copy)(FIRHILB() q_orig)
     q_copy->hc = (T complex*) liquid_malloc_copy(q_orig->hc, q_orig->h_len,  sizeof(T complex));
     q_copy->hq = (T *)        liquid_malloc_copy(q_orig->hq, q_orig->hq_len, sizeof(T));
 
+    // allocate polyphase branch buffers (contents are not retained between calls)
+    q_copy->b0 = (T *) malloc(q_orig->b_len*sizeof(T));
+    q_copy->b1 = (T *) malloc(q_orig->b_len*sizeof(T));
+    q_copy->b2 = (T *) malloc(q_orig->b_len*sizeof(T));
+    q_copy->b3 = (T *) malloc(q_orig->b_len*sizeof(T));
+
     // copy objects and return
     q_copy->w0  = WINDOW (_copy)(q_orig->w0 );
     q_copy->w1  = WINDOW (_copy)(q_orig->w1 );
@@ -148,6 +185,10 @@ int FIRHILB(_destroy)(FIRHILB() _q)
     free(_q->h);
     free(_q->hc);
     free(_q->hq);
+    free(_q->b0);
+    free(_q->b1);
+    free(_q->b2);
+    free(_q->b3);
 
     // free main object memory
     free(_q);
@@ -268,6 +309,127 @@ int FIRHILB(_c2r_execute)(FIRHILB() _q,
     return LIQUID_OK;
 }
 
+// execute Hilbert transform (real to complex) on a block of samples
+//  _q      :   firhilb object
+//  _x      :   real-valued input array [size: _n x 1]
+//  _n      :   number of input, output samples
+//  _y      :   complex-valued output array [size: _n x 1]
+int FIRHILB(_r2c_execute_block)(FIRHILB()    _q,
+                                T *          _x,
+                                unsigned int _n,
+                                T complex *  _y)
+{
+    unsigned int i, k;
+    T yq;
+    while (_n > 0) {
+        // number of input samples processed in this iteration
+        unsigned int n = _n < 2*FIRHILB_BLOCK_LEN ? _n : 2*FIRHILB_BLOCK_LEN;
+
+        // index of first sample in each branch
+        unsigned int i0 = _q->toggle;
+        unsigned int i1 = 1 - _q->toggle;
+
+        // linearize window contents and de-interleave input into branches
+        FIRHILB(_block_load)(_q, _q->w0, _q->b0);
+        FIRHILB(_block_load)(_q, _q->w1, _q->b1);
+        unsigned int n0 = 0, n1 = 0;
+        for (i=i0; i<n; i+=2) _q->b0[_q->hq_len + n0++] = _x[i];
+        for (i=i1; i<n; i+=2) _q->b1[_q->hq_len + n1++] = _x[i];
+
+        // upper branch samples: delay from b0, filter over b1
+        for (i=i0, k=0; i<n; i+=2, k++) {
+            DOTPROD(_execute)(_q->dpq, _q->b1 + i0 + k, &yq);
+            _y[i] = _q->b0[k + _q->m] + _Complex_I * yq;
+        }
+
+        // lower branch samples: delay from b1, filter over b0
+        for (i=i1, k=0; i<n; i+=2, k++) {
+            DOTPROD(_execute)(_q->dpq, _q->b0 + i1 + k, &yq);
+            _y[i] = _q->b1[k + _q->m] + _Complex_I * yq;
+        }
+
+        // restore window state
+        FIRHILB(_block_store)(_q, _q->w0, _q->b0, n0);
+        FIRHILB(_block_store)(_q, _q->w1, _q->b1, n1);
+        _q->toggle ^= (n & 1);
+
+        // update pointers
+        _x += n;
+        _y += n;
+        _n -= n;
+    }
+    return LIQUID_OK;
+}
+
+// execute Hilbert transform (complex to real) on a block of samples
+//  _q      :   firhilb object
+//  _x      :   complex-valued input array [size: _n x 1]
+//  _n      :   number of input, output samples
+//  _y0     :   real-valued output array, lower side-band retained [size: _n x 1]
+//  _y1     :   real-valued output array, upper side-band retained [size: _n x 1]
+int FIRHILB(_c2r_execute_block)(FIRHILB()    _q,
+                                T complex *  _x,
+                                unsigned int _n,
+                                T *          _y0,
+                                T *          _y1)
+{
+    unsigned int i, k;
+    T yi, yq;
+    while (_n > 0) {
+        // number of input samples processed in this iteration
+        unsigned int n = _n < 2*FIRHILB_BLOCK_LEN ? _n : 2*FIRHILB_BLOCK_LEN;
+
+        // index of first sample in each branch
+        unsigned int i0 = _q->toggle;
+        unsigned int i1 = 1 - _q->toggle;
+
+        // linearize window contents and de-interleave input into branches
+        FIRHILB(_block_load)(_q, _q->w0, _q->b0);
+        FIRHILB(_block_load)(_q, _q->w1, _q->b1);
+        FIRHILB(_block_load)(_q, _q->w2, _q->b2);
+        FIRHILB(_block_load)(_q, _q->w3, _q->b3);
+        unsigned int n0 = 0, n1 = 0;
+        for (i=i0; i<n; i+=2, n0++) {
+            _q->b0[_q->hq_len + n0] = crealf(_x[i]);
+            _q->b1[_q->hq_len + n0] = cimagf(_x[i]);
+        }
+        for (i=i1; i<n; i+=2, n1++) {
+            _q->b2[_q->hq_len + n1] = crealf(_x[i]);
+            _q->b3[_q->hq_len + n1] = cimagf(_x[i]);
+        }
+
+        // upper branch samples: delay from b0, filter over b3
+        for (i=i0, k=0; i<n; i+=2, k++) {
+            yi = _q->b0[k + _q->m];
+            DOTPROD(_execute)(_q->dpq, _q->b3 + i0 + k, &yq);
+            _y0[i] = yi + yq;
+            _y1[i] = yi - yq;
+        }
+
+        // lower branch samples: delay from b2, filter over b1
+        for (i=i1, k=0; i<n; i+=2, k++) {
+            yi = _q->b2[k + _q->m];
+            DOTPROD(_execute)(_q->dpq, _q->b1 + i1 + k, &yq);
+            _y0[i] = yi + yq;
+            _y1[i] = yi - yq;
+        }
+
+        // restore window state
+        FIRHILB(_block_store)(_q, _q->w0, _q->b0, n0);
+        FIRHILB(_block_store)(_q, _q->w1, _q->b1, n0);
+        FIRHILB(_block_store)(_q, _q->w2, _q->b2, n1);
+        FIRHILB(_block_store)(_q, _q->w3, _q->b3, n1);
+        _q->toggle ^= (n & 1);
+
+        // update pointers
+        _x  += n;
+        _y0 += n;
+        _y1 += n;
+        _n  -= n;
+    }
+    return LIQUID_OK;
+}
+
 // execute Hilbert transform decimator (real to complex)
 //  _q      :   firhilb object
 //  _x      :   real-valued input array [size: 2 x 1]
@@ -310,10 +472,36 @@ int FIRHILB(_decim_execute_block)(FIRHILB()    _q,
                                   T complex *  _y)
 {
     unsigned int i;
-    for (i=0; i<_n; i++) {
-        FIRHILB(_decim_execute)(_q, &_x[2*i], &_y[i]);
+    T yq;
+    while (_n > 0) {
+        // number of output samples computed in this iteration
+        unsigned int n = _n < FIRHILB_BLOCK_LEN ? _n : FIRHILB_BLOCK_LEN;
+
+        // linearize window contents and de-interleave input into branches
+        FIRHILB(_block_load)(_q, _q->w0, _q->b0);
+        FIRHILB(_block_load)(_q, _q->w1, _q->b1);
+        for (i=0; i<n; i++) {
+            _q->b1[_q->hq_len + i] = _x[2*i+0];
+            _q->b0[_q->hq_len + i] = _x[2*i+1];
+        }
+
+        // compute filter branch, add delay branch, and alternate sign
+        for (i=0; i<n; i++) {
+            DOTPROD(_execute)(_q->dpq, _q->b1 + i + 1, &yq);
+            T complex v = _q->b0[i + _q->m] + _Complex_I * yq;
+            _y[i] = ((_q->toggle + i) & 1) ? -v : v;
+        }
+
+        // restore window state
+        FIRHILB(_block_store)(_q, _q->w0, _q->b0, n);
+        FIRHILB(_block_store)(_q, _q->w1, _q->b1, n);
+        _q->toggle ^= (n & 1);
+
+        // update pointers
+        _x += 2*n;
+        _y += n;
+        _n -= n;
     }
-
     return LIQUID_OK;
 }
 
@@ -357,9 +545,60 @@ int FIRHILB(_interp_execute_block)(FIRHILB()    _q,
                                    T *          _y)
 {
     unsigned int i;
-    for (i=0; i<_n; i++) {
-        FIRHILB(_interp_execute)(_q, _x[i], &_y[2*i]);
+    while (_n > 0) {
+        // number of input samples processed in this iteration
+        unsigned int n = _n < FIRHILB_BLOCK_LEN ? _n : FIRHILB_BLOCK_LEN;
+
+        // linearize window contents and append input, alternating sign
+        FIRHILB(_block_load)(_q, _q->w0, _q->b0);
+        FIRHILB(_block_load)(_q, _q->w1, _q->b1);
+        for (i=0; i<n; i++) {
+            int neg = (_q->toggle + i) & 1;
+            _q->b0[_q->hq_len + i] = neg ? -cimagf(_x[i]) : cimagf(_x[i]);
+            _q->b1[_q->hq_len + i] = neg ? -crealf(_x[i]) : crealf(_x[i]);
+        }
+
+        // compute delay and filter branches
+        for (i=0; i<n; i++) {
+            _y[2*i+0] = _q->b0[i + _q->m];
+            DOTPROD(_execute)(_q->dpq, _q->b1 + i + 1, &_y[2*i+1]);
+        }
+
+        // restore window state
+        FIRHILB(_block_store)(_q, _q->w0, _q->b0, n);
+        FIRHILB(_block_store)(_q, _q->w1, _q->b1, n);
+        _q->toggle ^= (n & 1);
+
+        // update pointers
+        _x += n;
+        _y += 2*n;
+        _n -= n;
     }
+    return LIQUID_OK;
+}
 
+//
+// internal methods
+//
+
+// load window contents into head of polyphase branch buffer
+static int FIRHILB(_block_load)(FIRHILB() _q,
+                                WINDOW()  _w,
+                                T *       _b)
+{
+    T * r;
+    WINDOW(_read)(_w, &r);
+    memmove(_b, r, _q->hq_len*sizeof(T));
     return LIQUID_OK;
 }
+
+// store most recent branch samples back into window after _n new
+// samples have been appended to the branch buffer
+static int FIRHILB(_block_store)(FIRHILB()    _q,
+                                 WINDOW()     _w,
+                                 T *          _b,
+                                 unsigned int _n)
+{
+    // window retains only the last 2*m samples
+    return WINDOW(_write)(_w, _b + _n, _q->hq_len);
+}
@@ -79,7 +79,7 @@ int liquid_firdes_hM3(unsigned int _k,
 
     //unsigned int i;
     float h[n];
-    firdespm_run(n,num_bands,bands,des,weights,wtype,btype,h);
+    firdespm_run_uncached(n,num_bands,bands,des,weights,wtype,btype,h);
     // copy results
     memmove(_h, h, n*sizeof(float));
 
@@ -96,7 +96,7 @@ int liquid_firdes_hM3(unsigned int _k,
         bands[1] = fp;
 
         // execute filter design
-        firdespm_run(n,num_bands,bands,des,weights,wtype,btype,h);
+        firdespm_run_uncached(n,num_bands,bands,des,weights,wtype,btype,h);
 
         // compute inter-symbol interference (MSE, max)
         liquid_filter_isi(h,_k,_m,&isi_rms,&isi_max);
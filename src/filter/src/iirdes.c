@@ -591,16 +591,16 @@ int iirdes_dzpk_lp2bp(liquid_float_complex * _zd,
 //  _as         :   stop-band ripple in dB
 //  _b          :   numerator
 //  _a          :   denominator
-int liquid_iirdes(liquid_iirdes_filtertype _ftype,
-                  liquid_iirdes_bandtype   _btype,
-                  liquid_iirdes_format     _format,
-                  unsigned int             _n,
-                  float                    _fc,
-                  float                    _f0,
-                  float                    _ap,
-                  float                    _as,
-                  float *                  _b,
-                  float *                  _a)
+static int liquid_iirdes_design(liquid_iirdes_filtertype _ftype,
+                                liquid_iirdes_bandtype   _btype,
+                                liquid_iirdes_format     _format,
+                                unsigned int             _n,
+                                float                    _fc,
+                                float                    _f0,
+                                float                    _ap,
+                                float                    _as,
+                                float *                  _b,
+                                float *                  _a)
 {
     // validate input
     if (_fc <= 0 || _fc >= 0.5)
@@ -785,6 +785,44 @@ int liquid_iirdes(liquid_iirdes_filtertype _ftype,
     return LIQUID_OK;
 }
 
+int liquid_iirdes(liquid_iirdes_filtertype _ftype,
+                  liquid_iirdes_bandtype   _btype,
+                  liquid_iirdes_format     _format,
+                  unsigned int             _n,
+                  float                    _fc,
+                  float                    _f0,
+                  float                    _ap,
+                  float                    _as,
+                  float *                  _b,
+                  float *                  _a)
+{
+    // number of output coefficients in each of _b, _a; band-pass and
+    // band-stop designs double the effective filter order
+    unsigned int n = (_btype == LIQUID_IIRDES_BANDPASS ||
+                      _btype == LIQUID_IIRDES_BANDSTOP) ? 2*_n : _n;
+    unsigned int len = _format == LIQUID_IIRDES_TF ? n + 1 : 3*(n/2 + n%2);
+
+    // check design cache; both coefficient sets are stored in one entry
+    float key[8] = {(float)_ftype, (float)_btype, (float)_format, (float)_n,
+                    _fc, _f0, _ap, _as};
+    float v[2*len+1];
+    if (liquid_design_cache_lookup(LIQUID_DESIGN_CACHE_IIRDES, key, sizeof(key), v, 2*len)) {
+        memmove(_b, v,     len*sizeof(float));
+        memmove(_a, v+len, len*sizeof(float));
+        return LIQUID_OK;
+    }
+
+    // run design
+    int rc = liquid_iirdes_design(_ftype,_btype,_format,_n,_fc,_f0,_ap,_as,_b,_a);
+    if (rc != LIQUID_OK)
+        return rc;
+
+    // store result
+    memmove(v,     _b, len*sizeof(float));
+    memmove(v+len, _a, len*sizeof(float));
+    return liquid_design_cache_insert(LIQUID_DESIGN_CACHE_IIRDES, key, sizeof(key), v, 2*len);
+}
+
 // checks stability of iir filter
 //  _b      :   feed-forward coefficients [size: _n x 1]
 //  _a      :   feed-back coefficients [size: _n x 1]
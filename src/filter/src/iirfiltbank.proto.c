@@ -0,0 +1,476 @@
+/*
+ * Copyright (c) 2007 - 2024 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// iirfiltbank : bank of identical infinite impulse response filters
+//
+// A single second-order sections design is applied to many independent
+// channels. The filter state is stored as a structure of arrays with the
+// channel index varying fastest so that the recursion for each section
+// runs across all channels in a single (vectorizable) inner loop.
+//
+// For a single channel operating on long blocks the recursion is broken
+// up using a look-ahead (state-space) decomposition: the block is split
+// into segments which are filtered in parallel from a zero initial state,
+// after which the zero-input response of the true initial state is added
+// to each segment in sequence.
+//
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+// defined:
+//  IIRFILTBANK()   name-mangling macro
+//  TO              output type
+//  TC              coefficients type
+//  TI              input type
+//  PRINTVAL()      print macro(s)
+
+// number of parallel segments (lanes) for single-channel look-ahead mode
+#define IIRFILTBANK_LOOKAHEAD_LANES     (16)
+
+// minimum segment length for single-channel look-ahead mode
+#define IIRFILTBANK_LOOKAHEAD_MIN_LEN   (32)
+
+//
+// forward declaration of internal methods
+//
+
+// run single section across _n interleaved lanes for one time step,
+// operating in place on _v (transposed direct form II)
+int IIRFILTBANK(_section_step)(TC *         _b,
+                               TC *         _a,
+                               TO *         _s1,
+                               TO *         _s2,
+                               TO *         _v,
+                               unsigned int _n);
+
+// compute zero-input responses for segments of length _L
+int IIRFILTBANK(_set_segment_length)(IIRFILTBANK() _q,
+                                     unsigned int  _L);
+
+// execute single-channel block using look-ahead decomposition
+int IIRFILTBANK(_execute_lookahead)(IIRFILTBANK() _q,
+                                    TO *          _y,
+                                    unsigned int  _n);
+
+struct IIRFILTBANK(_s) {
+    unsigned int nsos;  // number of second-order sections
+    unsigned int M;     // number of channels
+    TC * b;             // feed-forward coefficients [size: nsos x 3]
+    TC * a;             // feed-back coefficients    [size: nsos x 3]
+    TO * s;             // filter state              [size: nsos x 2 x M]
+    TC scale;           // output scaling factor
+
+    // single-channel look-ahead mode
+    unsigned int L;     // segment length of zero-input responses (0 if unset)
+    TC * g;             // zero-input responses      [size: nsos x 2 x L]
+    TC * phi;           // segment state transition  [size: nsos x 4]
+    TO * buf;           // segment buffer            [size: L x lanes]
+    TO * zs;            // segment final states      [size: 2 x lanes]
+};
+
+// create bank of filters from second-order sections
+//  _b      : feed-forward coefficients [size: _nsos x 3]
+//  _a      : feed-back coefficients    [size: _nsos x 3]
+//  _nsos   : number of second-order sections
+//  _M      : number of channels
+IIRFILTBANK() IIRFILTBANK(_create_sos)(TC *         _b,
+                                       TC *         _a,
+                                       unsigned int _nsos,
+                                       unsigned int _M)
+{
+    // validate input
+    if (_nsos == 0)
+        return liquid_error_config("iirfiltbank_%s_create_sos(), number of second-order sections must be greater than zero", EXTENSION_FULL);
+    if (_M == 0)
+        return liquid_error_config("iirfiltbank_%s_create_sos(), number of channels must be greater than zero", EXTENSION_FULL);
+
+    // create object and initialize
+    IIRFILTBANK() q = (IIRFILTBANK()) malloc(sizeof(struct IIRFILTBANK(_s)));
+    q->nsos  = _nsos;
+    q->M     = _M;
+    q->scale = 1;
+
+    // copy coefficients, normalizing each section to a0
+    q->b = (TC *) malloc(3*q->nsos*sizeof(TC));
+    q->a = (TC *) malloc(3*q->nsos*sizeof(TC));
+    unsigned int i;
+    for (i=0; i<q->nsos; i++) {
+        TC a0 = _a[3*i+0];
+        q->b[3*i+0] = _b[3*i+0] / a0;
+        q->b[3*i+1] = _b[3*i+1] / a0;
+        q->b[3*i+2] = _b[3*i+2] / a0;
+        q->a[3*i+0] = 1;
+        q->a[3*i+1] = _a[3*i+1] / a0;
+        q->a[3*i+2] = _a[3*i+2] / a0;
+    }
+
+    // allocate state
+    q->s = (TO *) malloc(2*q->nsos*q->M*sizeof(TO));
+
+    // look-ahead buffers are allocated on demand
+    q->L   = 0;
+    q->g   = NULL;
+    q->phi = (TC *) malloc(4*q->nsos*sizeof(TC));
+    q->buf = NULL;
+    q->zs  = (TO *) malloc(2*IIRFILTBANK_LOOKAHEAD_LANES*sizeof(TO));
+
+    // reset and return main object
+    IIRFILTBANK(_reset)(q);
+    return q;
+}
+
+// create bank of filters from design template; the filter is always
+// realized with second-order sections
+//  _ftype  : filter type (e.g. LIQUID_IIRDES_BUTTER)
+//  _btype  : band type (e.g. LIQUID_IIRDES_BANDPASS)
+//  _order  : filter order
+//  _fc     : low-pass prototype cut-off frequency
+//  _f0     : center frequency (band-pass, band-stop)
+//  _ap     : pass-band ripple in dB
+//  _as     : stop-band ripple in dB
+//  _M      : number of channels
+IIRFILTBANK() IIRFILTBANK(_create_prototype)(liquid_iirdes_filtertype _ftype,
+                                             liquid_iirdes_bandtype   _btype,
+                                             unsigned int             _order,
+                                             float                    _fc,
+                                             float                    _f0,
+                                             float                    _ap,
+                                             float                    _as,
+                                             unsigned int             _M)
+{
+    if (_order == 0)
+        return liquid_error_config("iirfiltbank_%s_create_prototype(), filter order must be greater than zero", EXTENSION_FULL);
+
+    // derived values : compute number of second-order sections; order
+    // effectively doubles for band-pass and band-stop filters
+    unsigned int N = _order;
+    if (_btype == LIQUID_IIRDES_BANDPASS ||
+        _btype == LIQUID_IIRDES_BANDSTOP)
+    {
+        N *= 2;
+    }
+    unsigned int r = N%2;       // odd/even order
+    unsigned int L = (N-r)/2;   // filter semi-length
+    unsigned int h_len = 3*(L+r);
+
+    // design filter (compute coefficients)
+    float B[h_len];
+    float A[h_len];
+    if (liquid_iirdes(_ftype, _btype, LIQUID_IIRDES_SOS, _order, _fc, _f0, _ap, _as, B, A) != LIQUID_OK)
+        return liquid_error_config("iirfiltbank_%s_create_prototype(), could not design filter", EXTENSION_FULL);
+
+    // move coefficients to type-specific arrays
+    TC Bc[h_len];
+    TC Ac[h_len];
+    unsigned int i;
+    for (i=0; i<h_len; i++) {
+        Bc[i] = B[i];
+        Ac[i] = A[i];
+    }
+    return IIRFILTBANK(_create_sos)(Bc, Ac, L+r, _M);
+}
+
+// create bank of first-order DC-blocking filters with transfer function
+// H(z) = (1 - z^-1) / (1 - (1-alpha)z^-1)
+//  _alpha  : normalized filter bandwidth, _alpha > 0
+//  _M      : number of channels
+IIRFILTBANK() IIRFILTBANK(_create_dc_blocker)(float        _alpha,
+                                              unsigned int _M)
+{
+    if (_alpha <= 0.0f)
+        return liquid_error_config("iirfiltbank_%s_create_dc_blocker(), filter bandwidth must be greater than zero", EXTENSION_FULL);
+
+    // first-order section embedded into second-order section
+    TC b[3] = {1.0f, -1.0f,          0.0f};
+    TC a[3] = {1.0f, -1.0f + _alpha, 0.0f};
+    IIRFILTBANK() q = IIRFILTBANK(_create_sos)(b, a, 1, _M);
+    if (q == NULL)
+        return NULL;
+
+    // adjust scale to maintain consistent gain across the band
+    IIRFILTBANK(_set_scale)(q, sqrtf(1-_alpha));
+    return q;
+}
+
+// copy object including all internal objects and state
+IIRFILTBANK() IIRFILTBANK(_copy)(IIRFILTBANK() q_orig)
+{
+    // validate input
+    if (q_orig == NULL)
+        return liquid_error_config("iirfiltbank_%s_copy(), object cannot be NULL", EXTENSION_FULL);
+
+    // create object, copy internal memory, overwrite with specific values
+    IIRFILTBANK() q_copy = (IIRFILTBANK()) malloc(sizeof(struct IIRFILTBANK(_s)));
+    memmove(q_copy, q_orig, sizeof(struct IIRFILTBANK(_s)));
+
+    q_copy->b   = (TC *) liquid_malloc_copy(q_orig->b,   3*q_orig->nsos,          sizeof(TC));
+    q_copy->a   = (TC *) liquid_malloc_copy(q_orig->a,   3*q_orig->nsos,          sizeof(TC));
+    q_copy->s   = (TO *) liquid_malloc_copy(q_orig->s,   2*q_orig->nsos*q_orig->M, sizeof(TO));
+    q_copy->phi = (TC *) liquid_malloc_copy(q_orig->phi, 4*q_orig->nsos,          sizeof(TC));
+    q_copy->zs  = (TO *) malloc(2*IIRFILTBANK_LOOKAHEAD_LANES*sizeof(TO));
+
+    // look-ahead responses are re-computed on demand
+    q_copy->L   = 0;
+    q_copy->g   = NULL;
+    q_copy->buf = NULL;
+    return q_copy;
+}
+
+// destroy object, freeing all internal memory
+int IIRFILTBANK(_destroy)(IIRFILTBANK() _q)
+{
+    free(_q->b);
+    free(_q->a);
+    free(_q->s);
+    free(_q->phi);
+    free(_q->zs);
+    free(_q->g);
+    free(_q->buf);
+    free(_q);
+    return LIQUID_OK;
+}
+
+// print object properties to stdout
+int IIRFILTBANK(_print)(IIRFILTBANK() _q)
+{
+    printf("<liquid.iirfiltbank_%s", EXTENSION_FULL);
+    printf(", nsos=%u", _q->nsos);
+    printf(", channels=%u", _q->M);
+    printf(">\n");
+    return LIQUID_OK;
+}
+
+// reset internal state of all channels
+int IIRFILTBANK(_reset)(IIRFILTBANK() _q)
+{
+    unsigned int i;
+    for (i=0; i<2*_q->nsos*_q->M; i++)
+        _q->s[i] = 0;
+    return LIQUID_OK;
+}
+
+// set output scaling for all channels
+int IIRFILTBANK(_set_scale)(IIRFILTBANK() _q,
+                            TC            _scale)
+{
+    _q->scale = _scale;
+    return LIQUID_OK;
+}
+
+// get output scaling
+int IIRFILTBANK(_get_scale)(IIRFILTBANK() _q,
+                            TC *          _scale)
+{
+    *_scale = _q->scale;
+    return LIQUID_OK;
+}
+
+// get number of channels
+unsigned int IIRFILTBANK(_get_num_channels)(IIRFILTBANK() _q)
+{
+    return _q->M;
+}
+
+// get number of second-order sections
+unsigned int IIRFILTBANK(_get_num_sections)(IIRFILTBANK() _q)
+{
+    return _q->nsos;
+}
+
+// run single section across _n interleaved lanes for one time step
+int IIRFILTBANK(_section_step)(TC *         _b,
+                               TC *         _a,
+                               TO *         _s1,
+                               TO *         _s2,
+                               TO *         _v,
+                               unsigned int _n)
+{
+    TC b0 = _b[0], b1 = _b[1], b2 = _b[2];
+    TC a1 = _a[1], a2 = _a[2];
+    unsigned int m;
+    for (m=0; m<_n; m++) {
+        TO x = _v[m];
+        TO y = b0*x + _s1[m];
+        _s1[m] = b1*x - a1*y + _s2[m];
+        _s2[m] = b2*x - a2*y;
+        _v[m]  = y;
+    }
+    return LIQUID_OK;
+}
+
+// execute filter bank on one sample from each channel; in-place
+// operation is permitted
+//  _q      : filter bank object
+//  _x      : input samples, [size: M x 1]
+//  _y      : output samples, [size: M x 1]
+int IIRFILTBANK(_execute)(IIRFILTBANK() _q,
+                          TI *          _x,
+                          TO *          _y)
+{
+    unsigned int i;
+    if ((void*)_x != (void*)_y) {
+        for (i=0; i<_q->M; i++)
+            _y[i] = _x[i];
+    }
+
+    // run each section across all channels
+    for (i=0; i<_q->nsos; i++) {
+        TO * s1 = _q->s + (2*i+0)*_q->M;
+        TO * s2 = _q->s + (2*i+1)*_q->M;
+        IIRFILTBANK(_section_step)(_q->b + 3*i, _q->a + 3*i, s1, s2, _y, _q->M);
+    }
+
+    // apply output scaling
+    for (i=0; i<_q->M; i++)
+        _y[i] *= _q->scale;
+    return LIQUID_OK;
+}
+
+// execute filter bank on a block of samples from each channel; samples
+// are interleaved by channel such that sample k of channel m is stored
+// at index k*M + m; in-place operation is permitted
+//  _q      : filter bank object
+//  _x      : input samples, [size: _n x M]
+//  _n      : number of samples per channel
+//  _y      : output samples, [size: _n x M]
+int IIRFILTBANK(_execute_block)(IIRFILTBANK() _q,
+                                TI *          _x,
+                                unsigned int  _n,
+                                TO *          _y)
+{
+    unsigned int i;
+
+    // single channel with long block: use look-ahead decomposition
+    if (_q->M == 1 && _n >= IIRFILTBANK_LOOKAHEAD_LANES*IIRFILTBANK_LOOKAHEAD_MIN_LEN) {
+        if ((void*)_x != (void*)_y) {
+            for (i=0; i<_n; i++)
+                _y[i] = _x[i];
+        }
+        return IIRFILTBANK(_execute_lookahead)(_q, _y, _n);
+    }
+
+    for (i=0; i<_n; i++)
+        IIRFILTBANK(_execute)(_q, _x + i*_q->M, _y + i*_q->M);
+    return LIQUID_OK;
+}
+
+// compute zero-input responses and state transitions of each section
+// for segments of length _L
+int IIRFILTBANK(_set_segment_length)(IIRFILTBANK() _q,
+                                     unsigned int  _L)
+{
+    if (_q->L == _L)
+        return LIQUID_OK;
+
+    _q->L   = _L;
+    _q->g   = (TC *) realloc(_q->g,   2*_q->nsos*_L*sizeof(TC));
+    _q->buf = (TO *) realloc(_q->buf, IIRFILTBANK_LOOKAHEAD_LANES*_L*sizeof(TO));
+
+    unsigned int i, j, k;
+    for (i=0; i<_q->nsos; i++) {
+        TC a1 = _q->a[3*i+1];
+        TC a2 = _q->a[3*i+2];
+        // response to unit initial value of each state variable
+        for (j=0; j<2; j++) {
+            TC * g = _q->g + (2*i+j)*_L;
+            TC s1 = (j==0) ? 1 : 0;
+            TC s2 = (j==1) ? 1 : 0;
+            for (k=0; k<_L; k++) {
+                TC y = s1;
+                s1 = s2 - a1*y;
+                s2 =    - a2*y;
+                g[k] = y;
+            }
+            // final state is column j of transition matrix
+            _q->phi[4*i + 0 + j] = s1;
+            _q->phi[4*i + 2 + j] = s2;
+        }
+    }
+    return LIQUID_OK;
+}
+
+// execute single-channel block in place using look-ahead decomposition
+int IIRFILTBANK(_execute_lookahead)(IIRFILTBANK() _q,
+                                    TO *          _y,
+                                    unsigned int  _n)
+{
+    unsigned int P = IIRFILTBANK_LOOKAHEAD_LANES;
+    unsigned int L = _n / P;
+    IIRFILTBANK(_set_segment_length)(_q, L);
+
+    unsigned int i, k, p;
+    TO * zs1 = _q->zs;
+    TO * zs2 = _q->zs + P;
+    for (i=0; i<_q->nsos; i++) {
+        TC * b = _q->b + 3*i;
+        TC * a = _q->a + 3*i;
+
+        // transpose segments into lanes and filter from zero state
+        for (k=0; k<L; k++) {
+            for (p=0; p<P; p++)
+                _q->buf[k*P + p] = _y[p*L + k];
+        }
+        for (p=0; p<P; p++) {
+            zs1[p] = 0;
+            zs2[p] = 0;
+        }
+        for (k=0; k<L; k++)
+            IIRFILTBANK(_section_step)(b, a, zs1, zs2, _q->buf + k*P, P);
+        for (k=0; k<L; k++) {
+            for (p=0; p<P; p++)
+                _y[p*L + k] = _q->buf[k*P + p];
+        }
+
+        // add zero-input response of each segment's true initial state
+        TC * g1  = _q->g + (2*i+0)*L;
+        TC * g2  = _q->g + (2*i+1)*L;
+        TC * phi = _q->phi + 4*i;
+        TO s1 = _q->s[2*i+0];
+        TO s2 = _q->s[2*i+1];
+        for (p=0; p<P; p++) {
+            TO * v = _y + p*L;
+            for (k=0; k<L; k++)
+                v[k] += s1*g1[k] + s2*g2[k];
+
+            TO t1 = zs1[p] + phi[0]*s1 + phi[1]*s2;
+            TO t2 = zs2[p] + phi[2]*s1 + phi[3]*s2;
+            s1 = t1;
+            s2 = t2;
+        }
+
+        // run remaining samples sequentially
+        for (k=P*L; k<_n; k++)
+            IIRFILTBANK(_section_step)(b, a, &s1, &s2, _y + k, 1);
+
+        _q->s[2*i+0] = s1;
+        _q->s[2*i+1] = s2;
+    }
+
+    // apply output scaling
+    for (k=0; k<_n; k++)
+        _y[k] *= _q->scale;
+    return LIQUID_OK;
+}
+
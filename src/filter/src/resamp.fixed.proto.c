@@ -43,6 +43,8 @@ struct RESAMP(_s) {
     unsigned int    bits_index;
     unsigned int    npfb;   // 256
     FIRPFB()        pfb;    // filter bank
+
+    LIQUID_PROFILE_MEMBER   // profiling counters
 };
 
 // create arbitrary resampler
@@ -106,6 +108,7 @@ RESAMP() RESAMP(_create)(float        _rate,
 
     // reset object and return
     RESAMP(_reset)(q);
+    LIQUID_PROFILE_CREATE(q, LIQUID_PROFILE_TYPE(RESAMP()));
     return q;
 }
 
@@ -144,6 +147,7 @@ RESAMP() RESAMP(_copy)(RESAMP() q_orig)
 
     // copy filter bank
     q_copy->pfb = FIRPFB(_copy)(q_orig->pfb);
+    LIQUID_PROFILE_CREATE(q_copy, LIQUID_PROFILE_TYPE(RESAMP()));
 
     // return object
     return q_copy;
@@ -152,6 +156,8 @@ RESAMP() RESAMP(_copy)(RESAMP() q_orig)
 // free arbitrary resampler object
 int RESAMP(_destroy)(RESAMP() _q)
 {
+    LIQUID_PROFILE_DESTROY(_q);
+
     // free polyphase filterbank
     FIRPFB(_destroy)(_q->pfb);
 
@@ -285,6 +291,8 @@ int RESAMP(_execute)(RESAMP()       _q,
                      TO *           _y,
                      unsigned int * _num_written)
 {
+    LIQUID_PROFILE_BEGIN(_q);
+
     // push input
     FIRPFB(_push)(_q->pfb, _x);
 
@@ -302,6 +310,7 @@ int RESAMP(_execute)(RESAMP()       _q,
 
     // error checking for now
     *_num_written = n;
+    LIQUID_PROFILE_END(_q, 1);
     return LIQUID_OK;
 }
 
@@ -317,6 +326,8 @@ int RESAMP(_execute_block)(RESAMP()       _q,
                            TO *           _y,
                            unsigned int * _ny)
 {
+    LIQUID_PROFILE_BEGIN(_q);
+
     // initialize number of output samples to zero
     unsigned int ny = 0;
 
@@ -335,6 +346,7 @@ int RESAMP(_execute_block)(RESAMP()       _q,
 
     // set return value for number of output samples written
     *_ny = ny;
+    LIQUID_PROFILE_END(_q, _nx);
     return LIQUID_OK;
 }
 
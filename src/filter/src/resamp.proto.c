@@ -68,6 +68,8 @@ struct RESAMP(_s) {
         RESAMP_STATE_BOUNDARY, // boundary between input samples
         RESAMP_STATE_INTERP,   // regular interpolation
     } state;
+
+    LIQUID_PROFILE_MEMBER   // profiling counters
 };
 
 // create arbitrary resampler
@@ -127,6 +129,7 @@ RESAMP() RESAMP(_create)(float        _rate,
 
     // reset object and return
     RESAMP(_reset)(q);
+    LIQUID_PROFILE_CREATE(q, LIQUID_PROFILE_TYPE(RESAMP()));
     return q;
 }
 
@@ -165,6 +168,7 @@ RESAMP() RESAMP(_copy)(RESAMP() q_orig)
 
     // copy filter bank
     q_copy->f = FIRPFB(_copy)(q_orig->f);
+    LIQUID_PROFILE_CREATE(q_copy, LIQUID_PROFILE_TYPE(RESAMP()));
 
     // return object
     return q_copy;
@@ -173,6 +177,8 @@ RESAMP() RESAMP(_copy)(RESAMP() q_orig)
 // free arbitrary resampler object
 int RESAMP(_destroy)(RESAMP() _q)
 {
+    LIQUID_PROFILE_DESTROY(_q);
+
     // free polyphase filterbank
     FIRPFB(_destroy)(_q->f);
 
@@ -312,6 +318,8 @@ int RESAMP(_execute)(RESAMP()       _q,
                      TO *           _y,
                      unsigned int * _num_written)
 {
+    LIQUID_PROFILE_BEGIN(_q);
+
     // push input sample into filterbank
     FIRPFB(_push)(_q->f, _x);
     unsigned int n=0;
@@ -361,6 +369,7 @@ int RESAMP(_execute)(RESAMP()       _q,
             }
             break;
         default:
+            LIQUID_PROFILE_END(_q, 1);
             return liquid_error(LIQUID_EICONFIG,"resamp_%s_execute(), invalid/unknown state", EXTENSION_FULL);
         }
     }
@@ -372,6 +381,7 @@ int RESAMP(_execute)(RESAMP()       _q,
 
     // specify number of samples written
     *_num_written = n;
+    LIQUID_PROFILE_END(_q, 1);
     return LIQUID_OK;
 }
 
@@ -387,6 +397,8 @@ int RESAMP(_execute_block)(RESAMP()       _q,
                            TO *           _y,
                            unsigned int * _ny)
 {
+    LIQUID_PROFILE_BEGIN(_q);
+
     // initialize number of output samples to zero
     unsigned int ny = 0;
 
@@ -405,6 +417,7 @@ int RESAMP(_execute_block)(RESAMP()       _q,
 
     // set return value for number of output samples written
     *_ny = ny;
+    LIQUID_PROFILE_END(_q, _nx);
     return LIQUID_OK;
 }
 
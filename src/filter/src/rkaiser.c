@@ -116,7 +116,7 @@ int liquid_firdes_arkaiser(unsigned int _k,
 #endif
 
     // compute filter coefficients
-    liquid_firdes_kaiser(n,fc,as,_dt,_h);
+    liquid_firdes_kaiser_uncached(n,fc,as,_dt,_h);
 
     // normalize coefficients
     float e2 = 0.0f;
@@ -476,7 +476,7 @@ float liquid_firdes_rkaiser_internal_isi(unsigned int _k,
     float isi_rms;
 
     // compute filter
-    liquid_firdes_kaiser(n,fc,as,_dt,_h);
+    liquid_firdes_kaiser_uncached(n,fc,as,_dt,_h);
 
     // compute filter ISI
     liquid_filter_isi(_h,_k,_m,&isi_rms,&isi_max);
@@ -61,6 +61,20 @@ int SYMSYNC(_advance_internal_loop)(SYMSYNC() _q,
                                     TO        _mf,
                                     TO        _dmf);
 
+// compute matched and (optionally) derivative matched filter outputs
+// in a single pass over the shared input history
+//  _q      : synchronizer object
+//  _b      : filterbank index
+//  _mf     : matched filter output
+//  _dmf    : derivative matched filter output (ignored if NULL)
+int SYMSYNC(_execute_fused)(SYMSYNC()    _q,
+                            unsigned int _b,
+                            TO *         _mf,
+                            TO *         _dmf);
+
+// number of interleaved lanes for fused filterbank evaluation
+#define SYMSYNC_LANES (8)
+
 // internal structure
 struct SYMSYNC(_s) {
     unsigned int h_len;         // matched filter length
@@ -88,8 +102,15 @@ struct SYMSYNC(_s) {
     float rate_adjustment;      // internal rate adjustment factor
 
     unsigned int npfb;          // number of filters in the bank
-    FIRPFB()      mf;           // matched filter
-    FIRPFB()     dmf;           // derivative matched filter
+
+    // The matched and derivative matched filterbanks share a single input
+    // history buffer. Their coefficients are interleaved so that both
+    // outputs are accumulated in one pass: the input history is treated as
+    // an array of floats split into chunks of SYMSYNC_LANES values, with
+    // coefficients stored as [mf chunk][dmf chunk] pairs.
+    WINDOW()     w;             // input history buffer
+    unsigned int num_chunks;    // number of lane chunks per filter
+    TC *         hdh;           // interleaved filterbank coefficients
 };
 
 // create synchronizer object from external coefficients
@@ -147,8 +168,30 @@ SYMSYNC() SYMSYNC(_create)(unsigned int _k,
     for (i=0; i<_h_len; i++)
         dh[i] *= 0.06f / hdh_max;
 
-    q->mf  = FIRPFB(_create)(q->npfb, _h, _h_len);
-    q->dmf = FIRPFB(_create)(q->npfb, dh, _h_len);
+    // interleave matched and derivative matched filter coefficients for each
+    // filter in the bank, reversing order to align with the input history
+    unsigned int b, n;
+    unsigned int nf = TI_COMPLEX ? 2 : 1;   // float values per input sample
+    q->num_chunks = (nf*q->h_len + SYMSYNC_LANES - 1) / SYMSYNC_LANES;
+    unsigned int hdh_len = 2*SYMSYNC_LANES*q->num_chunks;
+    q->hdh = (TC *) calloc(q->npfb*hdh_len, sizeof(TC));
+    for (b=0; b<q->npfb; b++) {
+        TC * hdh = q->hdh + b*hdh_len;
+        for (n=0; n<q->h_len; n++) {
+            unsigned int p = q->h_len - n - 1;
+            unsigned int c;
+            for (c=0; c<nf; c++) {
+                unsigned int j = nf*p + c;  // index into float input
+                unsigned int k = j / SYMSYNC_LANES;
+                unsigned int l = j % SYMSYNC_LANES;
+                hdh[2*SYMSYNC_LANES*k +                l] = _h[b + n*q->npfb];
+                hdh[2*SYMSYNC_LANES*k + SYMSYNC_LANES + l] =  dh[b + n*q->npfb];
+            }
+        }
+    }
+
+    // create shared input history buffer
+    q->w = WINDOW(_create)(q->h_len);
 
     // reset state and initialize loop filter
     q->A[0] = 1.0f;     q->B[0] = 0.0f;
@@ -261,9 +304,9 @@ SYMSYNC() SYMSYNC(_copy)(SYMSYNC() q_orig)
     // copy phased-locked loop
     q_copy->pll = iirfiltsos_rrrf_copy(q_orig->pll);
 
-    // copy filter banks
-    q_copy->mf  = FIRPFB(_copy)(q_orig->mf);
-    q_copy->dmf = FIRPFB(_copy)(q_orig->dmf);
+    // copy input history and filterbank coefficients
+    q_copy->w = WINDOW(_copy)(q_orig->w);
+    q_copy->hdh = (TC *) liquid_malloc_copy(q_orig->hdh, 2*SYMSYNC_LANES*q_orig->npfb*q_orig->num_chunks, sizeof(TC));
 
     // return object
     return q_copy;
@@ -272,9 +315,9 @@ SYMSYNC() SYMSYNC(_copy)(SYMSYNC() q_orig)
 // destroy symsync object, freeing all internal memory
 int SYMSYNC(_destroy)(SYMSYNC() _q)
 {
-    // destroy filterbank objects
-    FIRPFB(_destroy)(_q->mf);
-    FIRPFB(_destroy)(_q->dmf);
+    // destroy input history and filterbank coefficients
+    WINDOW(_destroy)(_q->w);
+    free(_q->hdh);
 
     // destroy timing phase-locked loop filter
     iirfiltsos_rrrf_destroy(_q->pll);
@@ -287,16 +330,16 @@ int SYMSYNC(_destroy)(SYMSYNC() _q)
 // print symsync object's parameters
 int SYMSYNC(_print)(SYMSYNC() _q)
 {
-    printf("<liquid.symsync_%s, rate=%g, k_in=%u, k_out=%u>\n",
-        EXTENSION_FULL, _q->rate, _q->k, _q->k_out);
-    return FIRPFB(_print)(_q->mf);
+    printf("<liquid.symsync_%s, rate=%g, k_in=%u, k_out=%u, npfb=%u, h_len=%u>\n",
+        EXTENSION_FULL, _q->rate, _q->k, _q->k_out, _q->npfb, _q->h_len);
+    return LIQUID_OK;
 }
 
 // reset symsync internal state
 int SYMSYNC(_reset)(SYMSYNC() _q)
 {
-    // reset polyphase filterbank
-    FIRPFB(_reset)(_q->mf);
+    // reset input history shared by filterbanks
+    WINDOW(_reset)(_q->w);
 
     // reset counters, etc.
     _q->rate          = (float)_q->k / (float)_q->k_out;
@@ -425,9 +468,8 @@ int SYMSYNC(_step)(SYMSYNC()      _q,
                    TO *           _y,
                    unsigned int * _ny)
 {
-    // push sample into MF and dMF filterbanks
-    FIRPFB(_push)(_q->mf,  _x);
-    FIRPFB(_push)(_q->dmf, _x);
+    // push sample into history buffer shared by MF and dMF filterbanks
+    WINDOW(_push)(_q->w, _x);
 
     // matched and derivative matched-filter outputs
     TO  mf; // matched filter output
@@ -438,14 +480,17 @@ int SYMSYNC(_step)(SYMSYNC()      _q,
     // continue loop until filterbank index rolls over
     while (_q->b < _q->npfb) {
 
-        // compute filterbank output
-        FIRPFB(_execute)(_q->mf, _q->b, &mf);
+        // check output count and determine if this is 'ideal' timing output
+        int update = _q->decim_counter == _q->k_out;
+
+        // compute filterbank outputs, evaluating dMF only when it is needed
+        // to update the timing loop
+        SYMSYNC(_execute_fused)(_q, _q->b, &mf, (update && !_q->is_locked) ? &dmf : NULL);
 
         // scale output by samples/symbol
         _y[n] = mf / (float)(_q->k);
 
-        // check output count and determine if this is 'ideal' timing output
-        if (_q->decim_counter == _q->k_out) {
+        if (update) {
             // reset counter
             _q->decim_counter = 0;
 
@@ -453,9 +498,6 @@ int SYMSYNC(_step)(SYMSYNC()      _q,
             if (_q->is_locked)
                 continue;
 
-            // compute dMF output
-            FIRPFB(_execute)(_q->dmf, _q->b, &dmf);
-
             // update internal state
             SYMSYNC(_advance_internal_loop)(_q, mf, dmf);
             _q->tau_decim = _q->tau;    // save return value
@@ -511,3 +553,84 @@ int SYMSYNC(_advance_internal_loop)(SYMSYNC() _q,
     return LIQUID_OK;
 }
 
+
+// compute matched and (optionally) derivative matched filter outputs
+// in a single pass over the shared input history
+//  _q      : synchronizer object
+//  _b      : filterbank index
+//  _mf     : matched filter output
+//  _dmf    : derivative matched filter output (ignored if NULL)
+int SYMSYNC(_execute_fused)(SYMSYNC()    _q,
+                            unsigned int _b,
+                            TO *         _mf,
+                            TO *         _dmf)
+{
+    // read input history
+    TI * r;
+    WINDOW(_read)(_q->w, &r);
+
+    // treat input as array of floats; accumulate each lane independently
+    // so the inner loops map directly onto vector registers
+    unsigned int nf  = TI_COMPLEX ? 2 : 1;
+    unsigned int len = nf*_q->h_len;    // number of input floats
+    unsigned int nc  = len / SYMSYNC_LANES;
+    float * x   = (float*) r;
+    TC *    hdh = _q->hdh + 2*SYMSYNC_LANES*_b*_q->num_chunks;
+    float   amf [SYMSYNC_LANES] = {0};
+    float   admf[SYMSYNC_LANES] = {0};
+
+    // zero-padded copy of input tail
+    float xt[SYMSYNC_LANES] = {0};
+    unsigned int i, l;
+    for (i=nc*SYMSYNC_LANES; i<len; i++)
+        xt[i - nc*SYMSYNC_LANES] = x[i];
+
+    if (_dmf == NULL) {
+        for (i=0; i<nc; i++) {
+            for (l=0; l<SYMSYNC_LANES; l++)
+                amf[l] += hdh[2*SYMSYNC_LANES*i + l] * x[SYMSYNC_LANES*i + l];
+        }
+        if (nc < _q->num_chunks) {
+            for (l=0; l<SYMSYNC_LANES; l++)
+                amf[l] += hdh[2*SYMSYNC_LANES*nc + l] * xt[l];
+        }
+    } else {
+        for (i=0; i<nc; i++) {
+            for (l=0; l<SYMSYNC_LANES; l++) {
+                amf [l] += hdh[2*SYMSYNC_LANES*i                 + l] * x[SYMSYNC_LANES*i + l];
+                admf[l] += hdh[2*SYMSYNC_LANES*i + SYMSYNC_LANES + l] * x[SYMSYNC_LANES*i + l];
+            }
+        }
+        if (nc < _q->num_chunks) {
+            for (l=0; l<SYMSYNC_LANES; l++) {
+                amf [l] += hdh[2*SYMSYNC_LANES*nc                 + l] * xt[l];
+                admf[l] += hdh[2*SYMSYNC_LANES*nc + SYMSYNC_LANES + l] * xt[l];
+            }
+        }
+    }
+
+    // reduce lanes; for complex input, even lanes hold the real component
+    // and odd lanes hold the imaginary component
+#if TI_COMPLEX
+    float mf_i  = 0.0f, mf_q  = 0.0f;
+    float dmf_i = 0.0f, dmf_q = 0.0f;
+    for (l=0; l<SYMSYNC_LANES; l+=2) {
+        mf_i  += amf [l];   mf_q  += amf [l+1];
+        dmf_i += admf[l];   dmf_q += admf[l+1];
+    }
+    *_mf = mf_i + _Complex_I*mf_q;
+    if (_dmf != NULL)
+        *_dmf = dmf_i + _Complex_I*dmf_q;
+#else
+    float mf = 0.0f, dmf = 0.0f;
+    for (l=0; l<SYMSYNC_LANES; l++) {
+        mf  += amf [l];
+        dmf += admf[l];
+    }
+    *_mf = mf;
+    if (_dmf != NULL)
+        *_dmf = dmf;
+#endif
+    return LIQUID_OK;
+}
+
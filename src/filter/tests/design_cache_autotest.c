@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2007 - 2023 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "autotest/autotest.h"
+#include "liquid.internal.h"
+
+// check cache hit/miss counters and that cached designs are identical
+void autotest_design_cache_kaiser()
+{
+    liquid_design_cache_disable();
+    liquid_design_cache_clear();
+    liquid_design_cache_enable(4);
+
+    unsigned int n = 51;
+    float h0[n], h1[n];
+    liquid_firdes_kaiser(n, 0.2f, 60.0f, 0.0f, h0);
+    liquid_firdes_kaiser(n, 0.2f, 60.0f, 0.0f, h1);
+
+    unsigned long hits, misses;
+    unsigned int  entries;
+    liquid_design_cache_get_stats(&hits, &misses, &entries);
+    CONTEND_EQUALITY(hits,    1);
+    CONTEND_EQUALITY(misses,  1);
+    CONTEND_EQUALITY(entries, 1);
+    CONTEND_SAME_DATA(h0, h1, n*sizeof(float));
+
+    // different parameters must not hit
+    liquid_firdes_kaiser(n, 0.2f, 60.0f, 0.1f, h1);
+    liquid_design_cache_get_stats(&hits, &misses, &entries);
+    CONTEND_EQUALITY(hits,    1);
+    CONTEND_EQUALITY(misses,  2);
+    CONTEND_EQUALITY(entries, 2);
+
+    liquid_design_cache_disable();
+    liquid_design_cache_clear();
+}
+
+// check least-recently used entries are evicted first
+void autotest_design_cache_evict()
+{
+    liquid_design_cache_disable();
+    liquid_design_cache_clear();
+    liquid_design_cache_enable(4);
+
+    unsigned int i, n = 21;
+    float h[n];
+    for (i=0; i<6; i++)
+        liquid_firdes_kaiser(n, 0.05f*(i+1), 60.0f, 0.0f, h);
+
+    unsigned long hits, misses;
+    unsigned int  entries;
+    liquid_design_cache_get_stats(&hits, &misses, &entries);
+    CONTEND_EQUALITY(hits,    0);
+    CONTEND_EQUALITY(misses,  6);
+    CONTEND_EQUALITY(entries, 4);
+
+    // most recent design is retained, first design was evicted
+    liquid_firdes_kaiser(n, 0.30f, 60.0f, 0.0f, h);
+    liquid_design_cache_get_stats(&hits, &misses, NULL);
+    CONTEND_EQUALITY(hits,   1);
+    CONTEND_EQUALITY(misses, 6);
+    liquid_firdes_kaiser(n, 0.05f, 60.0f, 0.0f, h);
+    liquid_design_cache_get_stats(&hits, &misses, &entries);
+    CONTEND_EQUALITY(hits,    1);
+    CONTEND_EQUALITY(misses,  7);
+    CONTEND_EQUALITY(entries, 4);
+
+    // shrinking the cache evicts entries
+    liquid_design_cache_enable(2);
+    liquid_design_cache_get_stats(NULL, NULL, &entries);
+    CONTEND_EQUALITY(entries, 2);
+
+    // disabling releases all entries
+    liquid_design_cache_disable();
+    liquid_design_cache_get_stats(NULL, NULL, &entries);
+    CONTEND_EQUALITY(entries, 0);
+    liquid_design_cache_clear();
+}
+
+// check cached prototype, Parks-McClellan, and IIR designs match originals
+void autotest_design_cache_designs()
+{
+    liquid_design_cache_disable();
+    liquid_design_cache_clear();
+
+    // reference designs with cache disabled
+    unsigned int k=2, m=7, h_len = 2*k*m+1;
+    float h_rrc[h_len], h_pm[h_len];
+    liquid_firdes_prototype(LIQUID_FIRFILT_RRC, k, m, 0.3f, 0.0f, h_rrc);
+    liquid_firdes_prototype(LIQUID_FIRFILT_PM,  k, m, 0.3f, 0.0f, h_pm);
+    float b_tf[9], a_tf[9], b_sos[12], a_sos[12];
+    liquid_iirdes(LIQUID_IIRDES_ELLIP, LIQUID_IIRDES_BANDPASS, LIQUID_IIRDES_TF,
+                  4, 0.1f, 0.25f, 1.0f, 40.0f, b_tf, a_tf);
+    liquid_iirdes(LIQUID_IIRDES_CHEBY1, LIQUID_IIRDES_LOWPASS, LIQUID_IIRDES_SOS,
+                  7, 0.1f, 0.0f, 1.0f, 40.0f, b_sos, a_sos);
+
+    unsigned long hits, misses;
+    liquid_design_cache_get_stats(&hits, &misses, NULL);
+    CONTEND_EQUALITY(hits,   0);
+    CONTEND_EQUALITY(misses, 0);
+
+    // run each design twice with cache enabled; second is a hit
+    liquid_design_cache_enable(16);
+    unsigned int i;
+    for (i=0; i<2; i++) {
+        float h[h_len], b0[12], a0[12];
+        liquid_firdes_prototype(LIQUID_FIRFILT_RRC, k, m, 0.3f, 0.0f, h);
+        CONTEND_SAME_DATA(h, h_rrc, h_len*sizeof(float));
+        liquid_firdes_prototype(LIQUID_FIRFILT_PM,  k, m, 0.3f, 0.0f, h);
+        CONTEND_SAME_DATA(h, h_pm, h_len*sizeof(float));
+        liquid_iirdes(LIQUID_IIRDES_ELLIP, LIQUID_IIRDES_BANDPASS, LIQUID_IIRDES_TF,
+                      4, 0.1f, 0.25f, 1.0f, 40.0f, b0, a0);
+        CONTEND_SAME_DATA(b0, b_tf, 9*sizeof(float));
+        CONTEND_SAME_DATA(a0, a_tf, 9*sizeof(float));
+        liquid_iirdes(LIQUID_IIRDES_CHEBY1, LIQUID_IIRDES_LOWPASS, LIQUID_IIRDES_SOS,
+                      7, 0.1f, 0.0f, 1.0f, 40.0f, b0, a0);
+        CONTEND_SAME_DATA(b0, b_sos, 12*sizeof(float));
+        CONTEND_SAME_DATA(a0, a_sos, 12*sizeof(float));
+    }
+    liquid_design_cache_get_stats(&hits, &misses, NULL);
+    CONTEND_EQUALITY(hits,   4);
+    CONTEND_EQUALITY(misses, 4);
+
+    // objects created from cached designs
+    firfilt_crcf q0 = firfilt_crcf_create_rnyquist(LIQUID_FIRFILT_RRC, k, m, 0.3f, 0.0f);
+    firfilt_crcf q1 = firfilt_crcf_create_rnyquist(LIQUID_FIRFILT_RRC, k, m, 0.3f, 0.0f);
+    float complex y0, y1;
+    firfilt_crcf_push(q0, 1.0f); firfilt_crcf_execute(q0, &y0);
+    firfilt_crcf_push(q1, 1.0f); firfilt_crcf_execute(q1, &y1);
+    CONTEND_EQUALITY(y0, y1);
+    firfilt_crcf_destroy(q0);
+    firfilt_crcf_destroy(q1);
+
+    liquid_design_cache_disable();
+    liquid_design_cache_clear();
+}
+
+// iterative designs cache only the final result: one top-level design adds
+// exactly one entry, with none of its intermediate trials stored
+void design_cache_test_single_entry(liquid_firfilt_type _type)
+{
+    liquid_design_cache_disable();
+    liquid_design_cache_clear();
+    liquid_design_cache_enable(64);
+
+    unsigned int k=2, m=5, h_len = 2*k*m+1;
+    float h0[h_len], h1[h_len];
+    liquid_firdes_prototype(_type, k, m, 0.3f, 0.0f, h0);
+
+    unsigned long hits, misses;
+    unsigned int  entries;
+    liquid_design_cache_get_stats(&hits, &misses, &entries);
+    CONTEND_EQUALITY(hits,    0);
+    CONTEND_EQUALITY(misses,  1);
+    CONTEND_EQUALITY(entries, 1);
+
+    // repeated design is a hit
+    liquid_firdes_prototype(_type, k, m, 0.3f, 0.0f, h1);
+    liquid_design_cache_get_stats(&hits, &misses, &entries);
+    CONTEND_EQUALITY(hits,    1);
+    CONTEND_EQUALITY(misses,  1);
+    CONTEND_EQUALITY(entries, 1);
+    CONTEND_SAME_DATA(h0, h1, h_len*sizeof(float));
+
+    liquid_design_cache_disable();
+    liquid_design_cache_clear();
+}
+void autotest_design_cache_single_rkaiser()  { design_cache_test_single_entry(LIQUID_FIRFILT_RKAISER ); }
+void autotest_design_cache_single_arkaiser() { design_cache_test_single_entry(LIQUID_FIRFILT_ARKAISER); }
+void autotest_design_cache_single_hM3()      { design_cache_test_single_entry(LIQUID_FIRFILT_hM3     ); }
+
+// half-band search does not populate cache with its trial designs
+void autotest_design_cache_halfband()
+{
+    liquid_design_cache_disable();
+    liquid_design_cache_clear();
+    liquid_design_cache_enable(64);
+
+    float h[4*7+1];
+    liquid_firdespm_halfband_ft(7, 0.1f, h);
+
+    unsigned long hits, misses;
+    unsigned int  entries;
+    liquid_design_cache_get_stats(&hits, &misses, &entries);
+    CONTEND_EQUALITY(hits,    0);
+    CONTEND_EQUALITY(misses,  0);
+    CONTEND_EQUALITY(entries, 0);
+
+    liquid_design_cache_disable();
+    liquid_design_cache_clear();
+}
+
+void autotest_design_cache_config()
+{
+#if LIQUID_STRICT_EXIT
+    AUTOTEST_WARN("skipping design_cache config test with strict exit enabled\n");
+    return;
+#endif
+#if !LIQUID_SUPPRESS_ERROR_OUTPUT
+    fprintf(stderr,"warning: ignore potential errors here; checking for invalid configurations\n");
+#endif
+    CONTEND_INEQUALITY(LIQUID_OK, liquid_design_cache_enable(0));
+    CONTEND_EQUALITY  (LIQUID_OK, liquid_design_cache_disable());
+    CONTEND_EQUALITY  (LIQUID_OK, liquid_design_cache_clear());
+}
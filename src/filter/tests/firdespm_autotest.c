@@ -241,6 +241,45 @@ void autotest_firdespm_halfband_m20_ft050() { testbench_firdespm_halfband_ft(20,
 void autotest_firdespm_halfband_m40_ft050() { testbench_firdespm_halfband_ft(40, 0.050f); }
 void autotest_firdespm_halfband_m80_ft010() { testbench_firdespm_halfband_ft(80, 0.010f); }
 
+// long filters start from the extremal set of a shorter design
+void autotest_firdespm_lowpass_long()
+{
+    // design filter
+    unsigned int n  = 2001;
+    float        ft = 4.0f / (float)n;
+    float bands[4]   = {0.0f, 0.2f, 0.2f+ft, 0.5f};
+    float des[2]     = {1.0f, 0.0f};
+    float weights[2] = {1.0f, 1.0f};
+    float h[n];
+    firdespm_run(n,2,bands,des,weights,NULL,LIQUID_FIRDESPM_BANDPASS,h);
+
+    // verify resulting spectrum
+    autotest_psd_s regions[] = {
+      {.fmin=-0.5,   .fmax=-0.205, .pmin= 0,    .pmax=-65,   .test_lo=0, .test_hi=1},
+      {.fmin=-0.195, .fmax=+0.195, .pmin=-0.01, .pmax=+0.01, .test_lo=1, .test_hi=1},
+      {.fmin= 0.205, .fmax=+0.5,   .pmin= 0,    .pmax=-65,   .test_lo=0, .test_hi=1},
+    };
+    liquid_autotest_validate_psd_signalf(h, n, regions, 3,
+        liquid_autotest_verbose ? "autotest/logs/firdespm_lowpass_long.m" : NULL);
+}
+
+// evaluating the error on multiple threads must not change the design
+void autotest_firdespm_workers()
+{
+    unsigned int n = 301;
+    float bands[6]   = {0.0f, 0.1f, 0.12f, 0.3f, 0.32f, 0.5f};
+    float des[3]     = {0.0f, 1.0f, 0.0f};
+    float weights[3] = {1.0f, 1.0f, 1.0f};
+    float h0[n], h1[n];
+
+    firdespm q = firdespm_create(n, 3, bands, des, weights, NULL, LIQUID_FIRDESPM_BANDPASS);
+    firdespm_execute(q, h0);
+    CONTEND_EQUALITY(LIQUID_OK, firdespm_set_workers(q, 4));
+    firdespm_execute(q, h1);
+    firdespm_destroy(q);
+    CONTEND_SAME_DATA(h0, h1, n*sizeof(float));
+}
+
 void autotest_firdespm_copy()
 {
     // create valid object
@@ -294,6 +333,7 @@ void autotest_firdespm_config()
     liquid_firdespm_wtype wtype[2] = {LIQUID_FIRDESPM_FLATWEIGHT, LIQUID_FIRDESPM_FLATWEIGHT};
     firdespm q = firdespm_create(51, 2, bands, des, w, wtype, LIQUID_FIRDESPM_BANDPASS);
     CONTEND_EQUALITY(   LIQUID_OK, firdespm_print(q) )
+    CONTEND_INEQUALITY( LIQUID_OK, firdespm_set_workers(q, 0) )
     firdespm_destroy(q);
 
     // invalid bands & weights
@@ -264,3 +264,157 @@ void autotest_firhilbf_copy_decim()
     firhilbf_destroy(q1);
 }
 
+
+// test block methods against their single-sample counterparts, using
+// irregular block sizes to exercise internal buffering
+struct firhilbf_block_s {
+    firhilbf q;     // object under test
+    void *   x;     // input buffer
+    void *   y0;    // first output buffer
+    void *   y1;    // second output buffer (c2r only)
+};
+
+// run block method on [_i, _i+_n) of the buffers in _s
+typedef void (*firhilbf_block_callback)(struct firhilbf_block_s * _s,
+                                        unsigned int              _i,
+                                        unsigned int              _n);
+
+// split _num_samples into irregular chunks and invoke _callback on each
+static void firhilbf_test_blocks(struct firhilbf_block_s * _s,
+                                 unsigned int              _num_samples,
+                                 firhilbf_block_callback   _callback)
+{
+    unsigned int block_sizes[] = {1, 7, 300, 513, 2, 1000};
+    unsigned int i, n, k=0;
+    for (i=0; i<_num_samples; i+=n) {
+        n = block_sizes[k++ % 6];
+        n = i + n > _num_samples ? _num_samples - i : n;
+        _callback(_s, i, n);
+    }
+}
+
+static void firhilbf_r2c_chunk(struct firhilbf_block_s * _s, unsigned int _i, unsigned int _n)
+    { firhilbf_r2c_execute_block(_s->q, (float*)_s->x + _i, _n, (float complex*)_s->y0 + _i); }
+
+static void firhilbf_c2r_chunk(struct firhilbf_block_s * _s, unsigned int _i, unsigned int _n)
+    { firhilbf_c2r_execute_block(_s->q, (float complex*)_s->x + _i, _n, (float*)_s->y0 + _i, (float*)_s->y1 + _i); }
+
+static void firhilbf_decim_chunk(struct firhilbf_block_s * _s, unsigned int _i, unsigned int _n)
+    { firhilbf_decim_execute_block(_s->q, (float*)_s->x + 2*_i, _n, (float complex*)_s->y0 + _i); }
+
+static void firhilbf_interp_chunk(struct firhilbf_block_s * _s, unsigned int _i, unsigned int _n)
+    { firhilbf_interp_execute_block(_s->q, (float complex*)_s->x + _i, _n, (float*)_s->y0 + 2*_i); }
+
+void autotest_firhilbf_r2c_block()
+{
+    unsigned int m = 13, num_samples = 4000;
+    firhilbf q0 = firhilbf_create(m,80.0f);
+    firhilbf q1 = firhilbf_create(m,80.0f);
+
+    unsigned int i;
+    float         x [num_samples];
+    float complex y0[num_samples];
+    float complex y1[num_samples];
+    for (i=0; i<num_samples; i++)
+        x[i] = randnf();
+
+    // run single-sample and block methods
+    for (i=0; i<num_samples; i++)
+        firhilbf_r2c_execute(q0, x[i], &y0[i]);
+    struct firhilbf_block_s s = {q1, x, y1, NULL};
+    firhilbf_test_blocks(&s, num_samples, firhilbf_r2c_chunk);
+
+    for (i=0; i<num_samples; i++) {
+        CONTEND_DELTA(crealf(y0[i]), crealf(y1[i]), 1e-6f);
+        CONTEND_DELTA(cimagf(y0[i]), cimagf(y1[i]), 1e-6f);
+    }
+
+    // destroy objects
+    firhilbf_destroy(q0);
+    firhilbf_destroy(q1);
+}
+
+void autotest_firhilbf_c2r_block()
+{
+    unsigned int m = 13, num_samples = 4000;
+    firhilbf q0 = firhilbf_create(m,80.0f);
+    firhilbf q1 = firhilbf_create(m,80.0f);
+
+    unsigned int i;
+    float complex x[num_samples];
+    float y00[num_samples], y01[num_samples];
+    float y10[num_samples], y11[num_samples];
+    for (i=0; i<num_samples; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // run single-sample and block methods
+    for (i=0; i<num_samples; i++)
+        firhilbf_c2r_execute(q0, x[i], &y00[i], &y01[i]);
+    struct firhilbf_block_s s = {q1, x, y10, y11};
+    firhilbf_test_blocks(&s, num_samples, firhilbf_c2r_chunk);
+
+    for (i=0; i<num_samples; i++) {
+        CONTEND_DELTA(y00[i], y10[i], 1e-6f);
+        CONTEND_DELTA(y01[i], y11[i], 1e-6f);
+    }
+
+    // destroy objects
+    firhilbf_destroy(q0);
+    firhilbf_destroy(q1);
+}
+
+void autotest_firhilbf_decim_block()
+{
+    unsigned int m = 13, num_samples = 2000;
+    firhilbf q0 = firhilbf_create(m,80.0f);
+    firhilbf q1 = firhilbf_create(m,80.0f);
+
+    unsigned int i;
+    float         x [2*num_samples];
+    float complex y0[num_samples];
+    float complex y1[num_samples];
+    for (i=0; i<2*num_samples; i++)
+        x[i] = randnf();
+
+    // run single-sample and block methods
+    for (i=0; i<num_samples; i++)
+        firhilbf_decim_execute(q0, &x[2*i], &y0[i]);
+    struct firhilbf_block_s s = {q1, x, y1, NULL};
+    firhilbf_test_blocks(&s, num_samples, firhilbf_decim_chunk);
+
+    for (i=0; i<num_samples; i++) {
+        CONTEND_DELTA(crealf(y0[i]), crealf(y1[i]), 1e-6f);
+        CONTEND_DELTA(cimagf(y0[i]), cimagf(y1[i]), 1e-6f);
+    }
+
+    // destroy objects
+    firhilbf_destroy(q0);
+    firhilbf_destroy(q1);
+}
+
+void autotest_firhilbf_interp_block()
+{
+    unsigned int m = 13, num_samples = 2000;
+    firhilbf q0 = firhilbf_create(m,80.0f);
+    firhilbf q1 = firhilbf_create(m,80.0f);
+
+    unsigned int i;
+    float complex x[num_samples];
+    float y0[2*num_samples];
+    float y1[2*num_samples];
+    for (i=0; i<num_samples; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // run single-sample and block methods
+    for (i=0; i<num_samples; i++)
+        firhilbf_interp_execute(q0, x[i], &y0[2*i]);
+    struct firhilbf_block_s s = {q1, x, y1, NULL};
+    firhilbf_test_blocks(&s, num_samples, firhilbf_interp_chunk);
+
+    for (i=0; i<2*num_samples; i++)
+        CONTEND_DELTA(y0[i], y1[i], 1e-6f);
+
+    // destroy objects
+    firhilbf_destroy(q0);
+    firhilbf_destroy(q1);
+}
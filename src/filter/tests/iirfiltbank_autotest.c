@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2007 - 2024 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "autotest/autotest.h"
+#include "liquid.internal.h"
+
+// compare filter bank output on each channel against individual iirfilt objects
+void autotest_iirfiltbank_crcf_channels()
+{
+    unsigned int M         = 7;     // number of channels
+    unsigned int order     = 5;     // filter order
+    unsigned int num_samples = 200; // samples per channel
+    float        tol       = 1e-4f;
+
+    // create filter bank and reference filters from same design
+    iirfiltbank_crcf q = iirfiltbank_crcf_create_prototype(
+        LIQUID_IIRDES_CHEBY2, LIQUID_IIRDES_LOWPASS, order, 0.1f, 0.0f, 1.0f, 60.0f, M);
+    iirfilt_crcf f[M];
+    unsigned int i, m;
+    for (m=0; m<M; m++) {
+        f[m] = iirfilt_crcf_create_prototype(LIQUID_IIRDES_CHEBY2, LIQUID_IIRDES_LOWPASS,
+            LIQUID_IIRDES_SOS, order, 0.1f, 0.0f, 1.0f, 60.0f);
+    }
+    CONTEND_EQUALITY(iirfiltbank_crcf_get_num_channels(q), M);
+    CONTEND_EQUALITY(iirfiltbank_crcf_get_num_sections(q), 3);
+
+    // run samples through filters and compare
+    float complex x[M], y[M], y_test;
+    for (i=0; i<num_samples; i++) {
+        for (m=0; m<M; m++)
+            x[m] = randnf() + _Complex_I*randnf();
+        iirfiltbank_crcf_execute(q, x, y);
+        for (m=0; m<M; m++) {
+            iirfilt_crcf_execute(f[m], x[m], &y_test);
+            CONTEND_DELTA(crealf(y[m]), crealf(y_test), tol);
+            CONTEND_DELTA(cimagf(y[m]), cimagf(y_test), tol);
+        }
+    }
+
+    // destroy objects
+    iirfiltbank_crcf_destroy(q);
+    for (m=0; m<M; m++)
+        iirfilt_crcf_destroy(f[m]);
+}
+
+// compare block execution (interleaved) against DC-blocking filters
+void autotest_iirfiltbank_rrrf_dcblock_block()
+{
+    unsigned int M   = 64;  // number of channels
+    unsigned int n   = 50;  // samples per channel
+    float        tol = 1e-5f;
+
+    iirfiltbank_rrrf q = iirfiltbank_rrrf_create_dc_blocker(0.05f, M);
+    iirfilt_rrrf     f = iirfilt_rrrf_create_dc_blocker(0.05f);
+
+    // generate interleaved input with DC offset on each channel
+    float x[n*M], y[n*M];
+    unsigned int i, m;
+    for (i=0; i<n*M; i++)
+        x[i] = 1.0f + 0.1f*randnf();
+
+    // run block in place
+    memmove(y, x, n*M*sizeof(float));
+    iirfiltbank_rrrf_execute_block(q, y, n, y);
+
+    // compare each channel to reference
+    float y_test;
+    for (m=0; m<M; m++) {
+        iirfilt_rrrf_reset(f);
+        for (i=0; i<n; i++) {
+            iirfilt_rrrf_execute(f, x[i*M+m], &y_test);
+            CONTEND_DELTA(y[i*M+m], y_test, tol);
+        }
+    }
+
+    iirfiltbank_rrrf_destroy(q);
+    iirfilt_rrrf_destroy(f);
+}
+
+// single-channel look-ahead decomposition against sequential filter
+void iirfiltbank_crcf_lookahead_test(unsigned int _order,
+                                     float        _fc,
+                                     unsigned int _n)
+{
+    float tol = 2e-3f;
+    iirfiltbank_crcf q = iirfiltbank_crcf_create_prototype(
+        LIQUID_IIRDES_BUTTER, LIQUID_IIRDES_LOWPASS, _order, _fc, 0.0f, 1.0f, 60.0f, 1);
+    iirfilt_crcf f = iirfilt_crcf_create_prototype(LIQUID_IIRDES_BUTTER,
+        LIQUID_IIRDES_LOWPASS, LIQUID_IIRDES_SOS, _order, _fc, 0.0f, 1.0f, 60.0f);
+
+    float complex x[_n], y[_n], y_test;
+    unsigned int i, j;
+    // run several blocks to ensure state is carried across calls
+    for (j=0; j<3; j++) {
+        for (i=0; i<_n; i++)
+            x[i] = randnf() + _Complex_I*randnf();
+        iirfiltbank_crcf_execute_block(q, x, _n, y);
+        for (i=0; i<_n; i++) {
+            iirfilt_crcf_execute(f, x[i], &y_test);
+            CONTEND_DELTA(crealf(y[i]), crealf(y_test), tol);
+            CONTEND_DELTA(cimagf(y[i]), cimagf(y_test), tol);
+        }
+    }
+    iirfiltbank_crcf_destroy(q);
+    iirfilt_crcf_destroy(f);
+}
+void autotest_iirfiltbank_crcf_lookahead_n4_1024()  { iirfiltbank_crcf_lookahead_test(4, 0.20f, 1024); }
+void autotest_iirfiltbank_crcf_lookahead_n7_1500()  { iirfiltbank_crcf_lookahead_test(7, 0.10f, 1500); }
+void autotest_iirfiltbank_crcf_lookahead_n3_4099()  { iirfiltbank_crcf_lookahead_test(3, 0.02f, 4099); }
+
+void autotest_iirfiltbank_copy()
+{
+    unsigned int M = 5;
+    iirfiltbank_cccf q0 = iirfiltbank_cccf_create_prototype(
+        LIQUID_IIRDES_ELLIP, LIQUID_IIRDES_BANDPASS, 3, 0.1f, 0.2f, 1.0f, 60.0f, M);
+
+    // run input through filter
+    unsigned int i, m, num_samples = 80;
+    float complex x[M], y0[M], y1[M];
+    for (i=0; i<num_samples; i++) {
+        for (m=0; m<M; m++)
+            x[m] = randnf() + _Complex_I*randnf();
+        iirfiltbank_cccf_execute(q0, x, y0);
+    }
+
+    // copy object
+    iirfiltbank_cccf q1 = iirfiltbank_cccf_copy(q0);
+
+    // continue running through both objects
+    for (i=0; i<num_samples; i++) {
+        for (m=0; m<M; m++)
+            x[m] = randnf() + _Complex_I*randnf();
+        iirfiltbank_cccf_execute(q0, x, y0);
+        iirfiltbank_cccf_execute(q1, x, y1);
+        CONTEND_SAME_DATA(y0, y1, M*sizeof(float complex));
+    }
+
+    iirfiltbank_cccf_destroy(q0);
+    iirfiltbank_cccf_destroy(q1);
+}
+
+void autotest_iirfiltbank_config()
+{
+#if LIQUID_STRICT_EXIT
+    AUTOTEST_WARN("skipping iirfiltbank config test with strict exit enabled\n");
+    return;
+#endif
+#if !LIQUID_SUPPRESS_ERROR_OUTPUT
+    fprintf(stderr,"warning: ignore potential errors here; checking for invalid configurations\n");
+#endif
+    float b[3] = {1.0f, 2.0f, 1.0f};
+    float a[3] = {1.0f, 0.0f, 0.0f};
+
+    // test copying/creating invalid objects
+    CONTEND_ISNULL( iirfiltbank_rrrf_copy(NULL) );
+    CONTEND_ISNULL( iirfiltbank_rrrf_create_sos(b, a, 0, 4) );
+    CONTEND_ISNULL( iirfiltbank_rrrf_create_sos(b, a, 1, 0) );
+    CONTEND_ISNULL( iirfiltbank_rrrf_create_dc_blocker(0.0f, 4) );
+    CONTEND_ISNULL( iirfiltbank_rrrf_create_prototype(
+        LIQUID_IIRDES_BUTTER, LIQUID_IIRDES_LOWPASS, 0, 0.1f, 0.0f, 1.0f, 60.0f, 4) );
+
+    // create valid object and test configuration
+    iirfiltbank_rrrf q = iirfiltbank_rrrf_create_sos(b, a, 1, 4);
+    float scale = 0.0f;
+    CONTEND_EQUALITY(LIQUID_OK, iirfiltbank_rrrf_set_scale(q, 2.0f));
+    CONTEND_EQUALITY(LIQUID_OK, iirfiltbank_rrrf_get_scale(q, &scale));
+    CONTEND_EQUALITY(scale, 2.0f);
+    CONTEND_EQUALITY(LIQUID_OK, iirfiltbank_rrrf_print(q));
+    iirfiltbank_rrrf_destroy(q);
+}
+
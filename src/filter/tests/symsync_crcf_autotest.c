@@ -185,3 +185,76 @@ void autotest_symsync_crcf_scenario_5() { symsync_crcf_test("nyquist", 2, 7, 0.3
 void autotest_symsync_crcf_scenario_6() { symsync_crcf_test("nyquist", 2, 7, 0.35, -0.25, 1.0001f ); }
 void autotest_symsync_crcf_scenario_7() { symsync_crcf_test("nyquist", 2, 7, 0.35, -0.25, 0.9999f ); }
 
+
+// test matched filter output of locked synchronizer against polyphase
+// filterbank using the same coefficients (fused filterbank evaluation)
+void autotest_symsync_crcf_fused_mf()
+{
+    unsigned int k    = 2;      // samples/symbol
+    unsigned int m    = 5;      // filter delay (symbols)
+    float        beta = 0.3f;   // excess bandwidth factor
+    unsigned int npfb = 32;     // number of filters in the bank
+    unsigned int num_samples = 400;
+    float        tol  = 1e-5f;
+
+    // design prototype and create objects
+    unsigned int h_len = 2*npfb*k*m + 1;
+    float h[h_len];
+    liquid_firdes_prototype(LIQUID_FIRFILT_RRC, k*npfb, m, beta, 0, h);
+    symsync_crcf q = symsync_crcf_create(k, npfb, h, h_len);
+    firpfb_crcf  f = firpfb_crcf_create(npfb, h, h_len);
+    symsync_crcf_lock(q);
+
+    // run random samples through synchronizer
+    float complex x[num_samples], y[num_samples];
+    unsigned int i, ny;
+    for (i=0; i<num_samples; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+    symsync_crcf_execute(q, x, num_samples, y, &ny);
+    CONTEND_EQUALITY(ny, num_samples/k);
+
+    // locked synchronizer outputs filter 0 on every k-th input sample
+    float complex y_test;
+    for (i=0; i<num_samples; i++) {
+        firpfb_crcf_push(f, x[i]);
+        if (i % k)
+            continue;
+        firpfb_crcf_execute(f, 0, &y_test);
+        y_test /= (float)k;
+        CONTEND_DELTA(crealf(y[i/k]), crealf(y_test), tol);
+        CONTEND_DELTA(cimagf(y[i/k]), cimagf(y_test), tol);
+    }
+
+    symsync_crcf_destroy(q);
+    firpfb_crcf_destroy(f);
+}
+
+// test that executing block-wise and sample-wise give identical results
+void autotest_symsync_crcf_block()
+{
+    unsigned int num_samples = 1200;
+    symsync_crcf q0 = symsync_crcf_create_rnyquist(LIQUID_FIRFILT_ARKAISER, 2, 7, 0.25f, 32);
+    symsync_crcf q1 = symsync_crcf_create_rnyquist(LIQUID_FIRFILT_ARKAISER, 2, 7, 0.25f, 32);
+    symsync_crcf_set_output_rate(q0, 2);
+    symsync_crcf_set_output_rate(q1, 2);
+
+    float complex x [num_samples];
+    float complex y0[2*num_samples];
+    float complex y1[2*num_samples];
+    unsigned int i, n0, n1=0, nw;
+    for (i=0; i<num_samples; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // execute one block and one sample at a time
+    symsync_crcf_execute(q0, x, num_samples, y0, &n0);
+    for (i=0; i<num_samples; i++) {
+        symsync_crcf_execute(q1, &x[i], 1, &y1[n1], &nw);
+        n1 += nw;
+    }
+    CONTEND_EQUALITY(n0, n1);
+    CONTEND_SAME_DATA(y0, y1, n0*sizeof(float complex));
+    CONTEND_EQUALITY(symsync_crcf_get_tau(q0), symsync_crcf_get_tau(q1));
+
+    symsync_crcf_destroy(q0);
+    symsync_crcf_destroy(q1);
+}
@@ -28,6 +28,8 @@
 #include "liquid.internal.h"
 
 // Helper function to keep code base small
+//  _n  :   sequence length
+//  _m  :   number of correlators (0 for FFT search bank)
 void presync_cccf_bench(struct rusage *     _start,
                         struct rusage *     _finish,
                         unsigned long int * _num_iterations,
@@ -37,7 +39,7 @@ void presync_cccf_bench(struct rusage *     _start,
     // adjust number of iterations
     *_num_iterations *= 4;
     *_num_iterations /= _n;
-    *_num_iterations /= _m;
+    *_num_iterations /= _m > 0 ? _m : 1;
 
     // generate sequence (random)
     float complex h[_n];
@@ -48,7 +50,8 @@ void presync_cccf_bench(struct rusage *     _start,
     }
 
     // generate synchronizer
-    presync_cccf q = presync_cccf_create(h, _n, 0.1f, _m);
+    presync_cccf q = _m > 0 ? presync_cccf_create(h, _n, 0.1f, _m) :
+                              presync_cccf_create_fft(h, _n, 0.1f);
 
     // input sequence (random)
     float complex x[7];
@@ -91,3 +94,11 @@ void benchmark_presync_cccf_64   PRESYNC_CCCF_BENCHMARK_API(64,   6);
 void benchmark_presync_cccf_128  PRESYNC_CCCF_BENCHMARK_API(128,  6);
 void benchmark_presync_cccf_256  PRESYNC_CCCF_BENCHMARK_API(256,  6);
 
+// wide frequency search: many correlators vs. FFT search bank
+void benchmark_presync_cccf_m32_64     PRESYNC_CCCF_BENCHMARK_API(64,  32);
+void benchmark_presync_cccf_m32_256    PRESYNC_CCCF_BENCHMARK_API(256, 32);
+void benchmark_presync_cccf_fft_16     PRESYNC_CCCF_BENCHMARK_API(16,   0);
+void benchmark_presync_cccf_fft_32     PRESYNC_CCCF_BENCHMARK_API(32,   0);
+void benchmark_presync_cccf_fft_64     PRESYNC_CCCF_BENCHMARK_API(64,   0);
+void benchmark_presync_cccf_fft_128    PRESYNC_CCCF_BENCHMARK_API(128,  0);
+void benchmark_presync_cccf_fft_256    PRESYNC_CCCF_BENCHMARK_API(256,  0);
@@ -0,0 +1,311 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// End-to-end receive chain benchmarks: frames are generated, passed
+// through a channel and recovered by the matching frame synchronizer.
+// Each trial is one input sample so the rate is the input sample rate
+// of the full chain; frames/s and the time per sample spent in each
+// stage (source, channel, receiver) are reported as metrics. The random
+// seed is fixed so that every run processes the same signal.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <math.h>
+#include "liquid.h"
+#include "bench/bench.h"
+
+#define RXCHAIN_SEED        (1618033)   // random seed for all scenarios
+#define RXCHAIN_BLOCK_LEN   (4096)      // samples per processing block
+#define RXCHAIN_GAP_LEN     (400)       // samples between frames
+#define RXCHAIN_PAYLOAD_LEN (64)        // flexframe/ofdmflexframe payload
+
+// frame types
+#define RXCHAIN_FRAME64         (0)     // framegen64/framesync64
+#define RXCHAIN_FLEXFRAME       (1)     // flexframegen/flexframesync
+#define RXCHAIN_OFDMFLEXFRAME   (2)     // ofdmflexframegen/ofdmflexframesync
+
+// channel impairments (all scenarios include noise)
+#define RXCHAIN_AWGN        (0)         // noise only
+#define RXCHAIN_CFO         (1<<0)      // carrier frequency and phase offset
+#define RXCHAIN_MULTIPATH   (1<<1)      // multi-path fading
+#define RXCHAIN_INTERFERER  (1<<2)      // adjacent-channel interferer (msource)
+
+// OFDM parameters
+#define RXCHAIN_OFDM_M      (64)        // number of subcarriers
+#define RXCHAIN_OFDM_CP     (16)        // cyclic prefix length
+#define RXCHAIN_OFDM_TAPER  (4)         // taper length
+
+typedef struct {
+    unsigned int num_frames_tx;         // number of transmitted frames
+    unsigned int num_frames_detected;   // number of received frames (detected)
+    unsigned int num_frames_valid;      // number of valid payloads
+} rxchain_framedata;
+
+static int rxchain_callback(unsigned char *  _header,
+                            int              _header_valid,
+                            unsigned char *  _payload,
+                            unsigned int     _payload_len,
+                            int              _payload_valid,
+                            framesyncstats_s _stats,
+                            void *           _userdata)
+{
+    rxchain_framedata * fd = (rxchain_framedata*) _userdata;
+    fd->num_frames_detected += 1;
+    fd->num_frames_valid    += _payload_valid ? 1 : 0;
+    return 0;
+}
+
+// frame source: generates frames separated by gaps of zeros
+typedef struct {
+    int                 type;           // frame type
+    framegen64          fg64;           // frame64 generator
+    flexframegen        fg;             // flexframe generator
+    ofdmflexframegen    ofg;            // OFDM flexframe generator
+    float complex       frame64[LIQUID_FRAME64_LEN];
+    unsigned int        index;          // frame64 read index
+    int                 active;         // frame in progress?
+    unsigned int        gap;            // remaining gap samples
+    unsigned char       header[8];
+    unsigned char       payload[RXCHAIN_PAYLOAD_LEN];
+    unsigned int        num_frames;     // number of completed frames
+} rxchain_source;
+
+// start new frame with random payload
+static void rxchain_source_assemble(rxchain_source * _q)
+{
+    unsigned int i;
+    for (i=0; i<8; i++)
+        _q->header[i] = i;
+    for (i=0; i<RXCHAIN_PAYLOAD_LEN; i++)
+        _q->payload[i] = rand() & 0xff;
+
+    switch (_q->type) {
+    case RXCHAIN_FRAME64:
+        framegen64_execute(_q->fg64, _q->header, _q->payload, _q->frame64);
+        _q->index = 0;
+        break;
+    case RXCHAIN_FLEXFRAME:
+        flexframegen_assemble(_q->fg, _q->header, _q->payload, RXCHAIN_PAYLOAD_LEN);
+        break;
+    case RXCHAIN_OFDMFLEXFRAME:
+        ofdmflexframegen_assemble(_q->ofg, _q->header, _q->payload, RXCHAIN_PAYLOAD_LEN);
+        break;
+    default:;
+    }
+    _q->active = 1;
+}
+
+// write block of samples from frame source
+static void rxchain_source_write(rxchain_source * _q,
+                                 float complex *  _buf,
+                                 unsigned int     _buf_len)
+{
+    unsigned int i = 0;
+    while (i < _buf_len) {
+        unsigned int n = _buf_len - i;
+        if (!_q->active && _q->gap > 0) {
+            // write zeros between frames
+            n = n < _q->gap ? n : _q->gap;
+            memset(_buf + i, 0, n*sizeof(float complex));
+            _q->gap -= n;
+            i += n;
+            continue;
+        } else if (!_q->active) {
+            rxchain_source_assemble(_q);
+        }
+
+        // write frame samples; generators write zeros past the end of
+        // the frame which become part of the following gap
+        int complete = 0;
+        switch (_q->type) {
+        case RXCHAIN_FRAME64:
+            n = n < LIQUID_FRAME64_LEN - _q->index ? n : LIQUID_FRAME64_LEN - _q->index;
+            memmove(_buf + i, _q->frame64 + _q->index, n*sizeof(float complex));
+            _q->index += n;
+            complete = _q->index == LIQUID_FRAME64_LEN;
+            break;
+        case RXCHAIN_FLEXFRAME:
+            n = n < 256 ? n : 256;
+            complete = flexframegen_write_samples(_q->fg, _buf + i, n);
+            break;
+        case RXCHAIN_OFDMFLEXFRAME:
+            n = n < 256 ? n : 256;
+            complete = ofdmflexframegen_write(_q->ofg, _buf + i, n);
+            break;
+        default:;
+        }
+        i += n;
+        if (complete) {
+            _q->active = 0;
+            _q->gap    = RXCHAIN_GAP_LEN;
+            _q->num_frames++;
+        }
+    }
+}
+
+// execution time between two resource usage measurements (s)
+static double rxchain_time(struct rusage * _t0, struct rusage * _t1)
+{
+    return (double)(_t1->ru_utime.tv_sec  - _t0->ru_utime.tv_sec ) +
+           (double)(_t1->ru_utime.tv_usec - _t0->ru_utime.tv_usec) * 1e-6 +
+           (double)(_t1->ru_stime.tv_sec  - _t0->ru_stime.tv_sec ) +
+           (double)(_t1->ru_stime.tv_usec - _t0->ru_stime.tv_usec) * 1e-6;
+}
+
+// Helper function to keep code base small
+void rxchain_bench(struct rusage *     _start,
+                   struct rusage *     _finish,
+                   unsigned long int * _num_iterations,
+                   int                 _type,
+                   int                 _impairments)
+{
+    srand(RXCHAIN_SEED);
+    unsigned long int i;
+    unsigned long int num_blocks = (*_num_iterations + RXCHAIN_BLOCK_LEN - 1) / RXCHAIN_BLOCK_LEN;
+
+    // create frame source and matching synchronizer
+    rxchain_framedata fd = {0, 0, 0};
+    rxchain_source src;
+    memset(&src, 0, sizeof(src));
+    src.type = _type;
+    framesync64       fs64 = NULL;
+    flexframesync     fs   = NULL;
+    ofdmflexframesync ofs  = NULL;
+    switch (_type) {
+    case RXCHAIN_FRAME64:
+        src.fg64 = framegen64_create();
+        fs64     = framesync64_create(rxchain_callback, (void*)&fd);
+        break;
+    case RXCHAIN_FLEXFRAME:
+        src.fg = flexframegen_create(NULL);
+        fs     = flexframesync_create(rxchain_callback, (void*)&fd);
+        break;
+    case RXCHAIN_OFDMFLEXFRAME:
+        src.ofg = ofdmflexframegen_create(RXCHAIN_OFDM_M, RXCHAIN_OFDM_CP, RXCHAIN_OFDM_TAPER, NULL, NULL);
+        ofs     = ofdmflexframesync_create(RXCHAIN_OFDM_M, RXCHAIN_OFDM_CP, RXCHAIN_OFDM_TAPER, NULL,
+                                           rxchain_callback, (void*)&fd);
+        break;
+    default:
+        fprintf(stderr,"error: rxchain_bench(), invalid frame type\n");
+        exit(1);
+    }
+
+    // adjacent-channel interferer, 10 dB below the frame signal
+    msourcecf ms = NULL;
+    if (_impairments & RXCHAIN_INTERFERER) {
+        ms = msourcecf_create(64, 4, 60.0f);
+        msourcecf_add_modem(ms, 0.42f, 0.06f, -10.0f, LIQUID_MODEM_QPSK, 7, 0.25f);
+    }
+
+    // channel: noise at 20 dB SNR plus optional impairments
+    channel_cccf channel = channel_cccf_create();
+    channel_cccf_add_awgn(channel, -60.0f, 20.0f);
+    if (_impairments & RXCHAIN_CFO)
+        channel_cccf_add_carrier_offset(channel, 0.01f, 1.2f);
+    if (_impairments & RXCHAIN_MULTIPATH)
+        channel_cccf_add_multipath(channel, NULL, 6);
+
+    float complex buf_tx[RXCHAIN_BLOCK_LEN];
+    float complex buf_int[RXCHAIN_BLOCK_LEN];
+    float complex buf_rx[RXCHAIN_BLOCK_LEN];
+    double t_source = 0, t_channel = 0, t_rx = 0;
+    struct rusage t0, t1, t2, t3;
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<num_blocks; i++) {
+        // source: frames and interferer
+        getrusage(RUSAGE_SELF, &t0);
+        rxchain_source_write(&src, buf_tx, RXCHAIN_BLOCK_LEN);
+        if (ms != NULL) {
+            unsigned int k;
+            msourcecf_write_samples(ms, buf_int, RXCHAIN_BLOCK_LEN);
+            for (k=0; k<RXCHAIN_BLOCK_LEN; k++)
+                buf_tx[k] += buf_int[k];
+        }
+
+        // channel
+        getrusage(RUSAGE_SELF, &t1);
+        channel_cccf_execute_block(channel, buf_tx, RXCHAIN_BLOCK_LEN, buf_rx);
+
+        // receiver
+        getrusage(RUSAGE_SELF, &t2);
+        switch (_type) {
+        case RXCHAIN_FRAME64:       framesync64_execute      (fs64, buf_rx, RXCHAIN_BLOCK_LEN); break;
+        case RXCHAIN_FLEXFRAME:     flexframesync_execute    (fs,   buf_rx, RXCHAIN_BLOCK_LEN); break;
+        case RXCHAIN_OFDMFLEXFRAME: ofdmflexframesync_execute(ofs,  buf_rx, RXCHAIN_BLOCK_LEN); break;
+        default:;
+        }
+        getrusage(RUSAGE_SELF, &t3);
+
+        t_source  += rxchain_time(&t0, &t1);
+        t_channel += rxchain_time(&t1, &t2);
+        t_rx      += rxchain_time(&t2, &t3);
+    }
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations = num_blocks * RXCHAIN_BLOCK_LEN;
+
+    // report frame rate and per-stage time for each input sample
+    double t_total = rxchain_time(_start, _finish);
+    fd.num_frames_tx = src.num_frames;
+    benchmark_report("frames_per_s",  t_total > 0 ? fd.num_frames_valid / t_total : 0);
+    benchmark_report("frame_success", fd.num_frames_tx > 0 ? (double)fd.num_frames_valid / fd.num_frames_tx : 0);
+    benchmark_report("source_ns",     1e9 * t_source  / *_num_iterations);
+    benchmark_report("channel_ns",    1e9 * t_channel / *_num_iterations);
+    benchmark_report("rx_ns",         1e9 * t_rx      / *_num_iterations);
+
+    // destroy objects
+    if (ms != NULL) msourcecf_destroy(ms);
+    channel_cccf_destroy(channel);
+    if (src.fg64 != NULL) framegen64_destroy(src.fg64);
+    if (src.fg   != NULL) flexframegen_destroy(src.fg);
+    if (src.ofg  != NULL) ofdmflexframegen_destroy(src.ofg);
+    if (fs64     != NULL) framesync64_destroy(fs64);
+    if (fs       != NULL) flexframesync_destroy(fs);
+    if (ofs      != NULL) ofdmflexframesync_destroy(ofs);
+}
+
+#define RXCHAIN_BENCHMARK_API(TYPE,IMPAIRMENTS)     \
+(   struct rusage *_start,                          \
+    struct rusage *_finish,                         \
+    unsigned long int *_num_iterations)             \
+{ rxchain_bench(_start, _finish, _num_iterations, TYPE, IMPAIRMENTS); }
+
+#define RXCHAIN_ALL (RXCHAIN_CFO | RXCHAIN_MULTIPATH | RXCHAIN_INTERFERER)
+
+void benchmark_rxchain_framesync64_awgn           RXCHAIN_BENCHMARK_API(RXCHAIN_FRAME64,       RXCHAIN_AWGN     )
+void benchmark_rxchain_framesync64_cfo            RXCHAIN_BENCHMARK_API(RXCHAIN_FRAME64,       RXCHAIN_CFO      )
+void benchmark_rxchain_framesync64_multipath      RXCHAIN_BENCHMARK_API(RXCHAIN_FRAME64,       RXCHAIN_MULTIPATH)
+void benchmark_rxchain_framesync64_all            RXCHAIN_BENCHMARK_API(RXCHAIN_FRAME64,       RXCHAIN_ALL      )
+void benchmark_rxchain_flexframesync_awgn         RXCHAIN_BENCHMARK_API(RXCHAIN_FLEXFRAME,     RXCHAIN_AWGN     )
+void benchmark_rxchain_flexframesync_cfo          RXCHAIN_BENCHMARK_API(RXCHAIN_FLEXFRAME,     RXCHAIN_CFO      )
+void benchmark_rxchain_flexframesync_multipath    RXCHAIN_BENCHMARK_API(RXCHAIN_FLEXFRAME,     RXCHAIN_MULTIPATH)
+void benchmark_rxchain_flexframesync_all          RXCHAIN_BENCHMARK_API(RXCHAIN_FLEXFRAME,     RXCHAIN_ALL      )
+void benchmark_rxchain_ofdmflexframesync_awgn     RXCHAIN_BENCHMARK_API(RXCHAIN_OFDMFLEXFRAME, RXCHAIN_AWGN     )
+void benchmark_rxchain_ofdmflexframesync_cfo      RXCHAIN_BENCHMARK_API(RXCHAIN_OFDMFLEXFRAME, RXCHAIN_CFO      )
+void benchmark_rxchain_ofdmflexframesync_multipath RXCHAIN_BENCHMARK_API(RXCHAIN_OFDMFLEXFRAME, RXCHAIN_MULTIPATH)
+void benchmark_rxchain_ofdmflexframesync_all      RXCHAIN_BENCHMARK_API(RXCHAIN_OFDMFLEXFRAME, RXCHAIN_ALL      )
+
@@ -45,6 +45,10 @@ struct BPRESYNC(_s) {
     float * rxy;        // output correlation [size: m x 1]
 
     float n_inv;        // 1/n (pre-computed for speed)
+
+    // FFT search bank (created with _create_fft(), otherwise NULL)
+    windowcf rx;        // received samples
+    segcorr  fb;        // segmented correlator, FFT across segments
 };
 
 // correlate input sequence with particular sequence index
@@ -111,14 +115,61 @@ BPRESYNC() BPRESYNC(_create)(TC *         _v,
     // allocate memory for cross-correlation
     _q->rxy = (float*) malloc( _q->m*sizeof(float) );
 
+    // FFT search bank not used
+    _q->rx = NULL;
+    _q->fb = NULL;
+
     // reset object
     BPRESYNC(_reset)(_q);
 
     return _q;
 }
 
+// create pre-demod synchronizer evaluating all frequency hypotheses at once
+//  _v          :   baseband sequence
+//  _n          :   baseband sequence length
+//  _dphi_max   :   maximum absolute frequency deviation
+BPRESYNC() BPRESYNC(_create_fft)(TC *         _v,
+                                 unsigned int _n,
+                                 float        _dphi_max)
+{
+    // validate input
+    if (_n < 1)
+        return liquid_error_config("bpresync_%s_create_fft(), invalid input length", EXTENSION_FULL);
+    if (_dphi_max < 0.0f || _dphi_max > (float)M_PI)
+        return liquid_error_config("bpresync_%s_create_fft(), maximum frequency deviation must be in [0,pi]", EXTENSION_FULL);
+
+    // allocate main object memory and initialize
+    BPRESYNC() _q = (BPRESYNC()) malloc(sizeof(struct BPRESYNC(_s)));
+    _q->n      = _n;
+    _q->m      = 0;
+    _q->n_inv  = 1.0f / (float)(_q->n);
+    _q->dphi   = NULL;
+    _q->sync_i = NULL;
+    _q->sync_q = NULL;
+    _q->rxy    = NULL;
+
+    // create receive buffer and segmented correlator
+    _q->rx = windowcf_create(_q->n);
+
+    // hard-limit sequence to match quantized input
+    float complex v[_n];
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        v[i] = (crealf(_v[i]) > 0 ? 1.0f : -1.0f) + (cimagf(_v[i]) > 0 ? 1.0f : -1.0f)*_Complex_I;
+    _q->fb = segcorr_create(v, _n, _dphi_max);
+    return _q;
+}
+
 int BPRESYNC(_destroy)(BPRESYNC() _q)
 {
+    if (_q->fb != NULL) {
+        windowcf_destroy(_q->rx);
+        segcorr_destroy (_q->fb);
+        free(_q);
+        return LIQUID_OK;
+    }
+
     unsigned int i;
 
     // free received symbol buffers
@@ -152,6 +203,9 @@ int BPRESYNC(_print)(BPRESYNC() _q)
 
 int BPRESYNC(_reset)(BPRESYNC() _q)
 {
+    if (_q->fb != NULL)
+        return windowcf_reset(_q->rx);
+
     unsigned int i;
     for (i=0; i<_q->n; i++) {
         bsequence_push(_q->rx_i, (i+0) % 2);
@@ -166,6 +220,12 @@ int BPRESYNC(_reset)(BPRESYNC() _q)
 int BPRESYNC(_push)(BPRESYNC() _q,
                     TI         _x)
 {
+    // hard-limit input for FFT search bank
+    if (_q->fb != NULL) {
+        return windowcf_push(_q->rx, (REAL(_x) > 0 ? 1.0f : -1.0f) +
+                                     (IMAG(_x) > 0 ? 1.0f : -1.0f)*_Complex_I);
+    }
+
     // push symbol into buffers
     bsequence_push(_q->rx_i, REAL(_x)>0);
     bsequence_push(_q->rx_q, IMAG(_x)>0);
@@ -186,6 +246,14 @@ int BPRESYNC(_execute)(BPRESYNC() _q,
     float complex rxy0;
     float complex rxy1;
     float dphi_hat = 0.0f;
+
+    // evaluate all frequency hypotheses at once
+    if (_q->fb != NULL) {
+        float complex * r = NULL;
+        windowcf_read(_q->rx, &r);
+        return segcorr_execute(_q->fb, r, _rxy, _dphi_hat);
+    }
+
     for (i=0; i<_q->m; i++)  {
 
         BPRESYNC(_correlatex)(_q, i, &rxy0, &rxy1);
@@ -210,6 +278,27 @@ int BPRESYNC(_execute)(BPRESYNC() _q,
     return LIQUID_OK;
 }
 
+// push block of samples, correlating after each; this is a convenience
+// wrapper around push() and execute() for each sample
+//  _q          :   pre-demod synchronizer object
+//  _x          :   input samples [size: _n x 1]
+//  _n          :   number of input samples
+//  _rxy        :   output cross correlation [size: _n x 1]
+//  _dphi_hat   :   output frequency offset estimates [size: _n x 1]
+int BPRESYNC(_execute_block)(BPRESYNC()   _q,
+                             TI *         _x,
+                             unsigned int _n,
+                             TO *         _rxy,
+                             float *      _dphi_hat)
+{
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        BPRESYNC(_push)(_q, _x[i]);
+        BPRESYNC(_execute)(_q, &_rxy[i], &_dphi_hat[i]);
+    }
+    return LIQUID_OK;
+}
+
 //
 // internal methods
 //
@@ -69,6 +69,15 @@ int flexframesync_execute_rxheader(flexframesync _q,
 int flexframesync_execute_rxpayload(flexframesync _q,
                                     float complex _x);
 
+// batch search worker methods
+void * flexframesync_batch_create(void *             _template,
+                                  framesync_callback _callback,
+                                  void *             _userdata);
+int flexframesync_batch_execute(void *          _q,
+                                float complex * _x,
+                                unsigned int    _n);
+int flexframesync_batch_destroy(void * _q);
+
 static flexframegenprops_s flexframesyncprops_header_default = {
    FLEXFRAME_H_CRC,
    FLEXFRAME_H_FEC0,
@@ -149,6 +158,7 @@ struct flexframesync_s {
     int         debug_qdetector_flush;  // debug: flag to set if we are flushing detector
     windowcf    debug_x;                // debug: raw input samples
 #endif
+    LIQUID_PROFILE_MEMBER               // profiling counters
 };
 
 // create flexframesync object
@@ -239,12 +249,57 @@ flexframesync flexframesync_create(framesync_callback _callback,
 
     // reset state and return
     flexframesync_reset(q);
+    LIQUID_PROFILE_CREATE(q, "flexframesync");
     return q;
 }
 
+// copy object
+flexframesync flexframesync_copy(flexframesync q_orig)
+{
+    // validate input
+    if (q_orig == NULL)
+        return liquid_error_config("flexframesync_copy(), object cannot be NULL");
+
+    // allocate memory for new object
+    flexframesync q_copy = (flexframesync) malloc(sizeof(struct flexframesync_s));
+
+    // copy entire memory space over and overwrite values as needed
+    memmove(q_copy, q_orig, sizeof(struct flexframesync_s));
+
+    // copy objects
+    q_copy->detector         = qdetector_cccf_copy(q_orig->detector);
+    q_copy->mixer            = nco_crcf_copy      (q_orig->mixer);
+    q_copy->pll              = nco_crcf_copy      (q_orig->pll);
+    q_copy->mf               = firpfb_crcf_copy   (q_orig->mf);
+#if FLEXFRAMESYNC_ENABLE_EQ
+    q_copy->equalizer        = eqlms_cccf_copy    (q_orig->equalizer);
+#endif
+    q_copy->header_pilotsync = qpilotsync_copy    (q_orig->header_pilotsync);
+    q_copy->header_decoder   = qpacketmodem_copy  (q_orig->header_decoder);
+    q_copy->payload_demod    = modemcf_copy       (q_orig->payload_demod);
+    q_copy->payload_decoder  = qpacketmodem_copy  (q_orig->payload_decoder);
+
+    // copy memory arrays
+    q_copy->preamble_pn = (float complex *) liquid_malloc_copy(q_orig->preamble_pn, 64,                     sizeof(float complex));
+    q_copy->preamble_rx = (float complex *) liquid_malloc_copy(q_orig->preamble_rx, 64,                     sizeof(float complex));
+    q_copy->header_sym  = (float complex *) liquid_malloc_copy(q_orig->header_sym,  q_orig->header_sym_len,  sizeof(float complex));
+    q_copy->header_mod  = (float complex *) liquid_malloc_copy(q_orig->header_mod,  q_orig->header_mod_len,  sizeof(float complex));
+    q_copy->header_dec  = (unsigned char *) liquid_malloc_copy(q_orig->header_dec,  q_orig->header_dec_len,  sizeof(unsigned char));
+    q_copy->payload_sym = (float complex *) liquid_malloc_copy(q_orig->payload_sym, q_orig->payload_sym_len, sizeof(float complex));
+    q_copy->payload_dec = (unsigned char *) liquid_malloc_copy(q_orig->payload_dec, q_orig->payload_dec_len, sizeof(unsigned char));
+
+#if DEBUG_FLEXFRAMESYNC
+    if (q_orig->debug_objects_created)
+        q_copy->debug_x = windowcf_copy(q_orig->debug_x);
+#endif
+    LIQUID_PROFILE_CREATE(q_copy, "flexframesync");
+    return q_copy;
+}
+
 // destroy frame synchronizer object, freeing all internal memory
 int flexframesync_destroy(flexframesync _q)
 {
+    LIQUID_PROFILE_DESTROY(_q);
 #if DEBUG_FLEXFRAMESYNC
     // clean up debug objects (if created)
     if (_q->debug_objects_created)
@@ -308,6 +363,22 @@ int flexframesync_reset(flexframesync _q)
     return LIQUID_OK;
 }
 
+// set the callback function
+int flexframesync_set_callback(flexframesync      _q,
+                               framesync_callback _callback)
+{
+    _q->callback = _callback;
+    return LIQUID_OK;
+}
+
+// set the user-defined data field (context)
+int flexframesync_set_userdata(flexframesync _q,
+                               void *        _userdata)
+{
+    _q->userdata = _userdata;
+    return LIQUID_OK;
+}
+
 int flexframesync_is_frame_open(flexframesync _q)
 {
     return (_q->state == FLEXFRAMESYNC_STATE_DETECTFRAME) ? 0 : 1;
@@ -385,6 +456,7 @@ int flexframesync_execute(flexframesync   _q,
                           float complex * _x,
                           unsigned int    _n)
 {
+    LIQUID_PROFILE_BEGIN(_q);
     unsigned int i;
     for (i=0; i<_n; i++) {
 #if DEBUG_FLEXFRAMESYNC
@@ -411,12 +483,40 @@ int flexframesync_execute(flexframesync   _q,
             flexframesync_execute_rxpayload(_q, _x[i]);
             break;
         default:
+            LIQUID_PROFILE_END(_q, i);
             return liquid_error(LIQUID_EINT,"flexframesync_exeucte(), unknown/unsupported internal state");
         }
     }
+    LIQUID_PROFILE_END(_q, _n);
     return LIQUID_OK;
 }
 
+// search stored capture for frames across a pool of worker threads
+//  _q              :   frame synchronizer object (configuration template)
+//  _x              :   input sample array [size: _n x 1]
+//  _n              :   number of input samples
+//  _max_frame_len  :   maximum length of any frame in capture (samples)
+//  _num_workers    :   number of worker threads
+int flexframesync_execute_batch(flexframesync   _q,
+                                float complex * _x,
+                                unsigned int    _n,
+                                unsigned int    _max_frame_len,
+                                unsigned int    _num_workers)
+{
+    // shortest frame is preamble and header at 2 samples/symbol
+    unsigned int min_spacing = 64 + _q->header_sym_len;
+    return framesync_batch_execute(_q,
+                                   flexframesync_batch_create,
+                                   flexframesync_batch_execute,
+                                   flexframesync_batch_destroy,
+                                   _q->header_dec_len,
+                                   _max_frame_len,
+                                   min_spacing,
+                                   _q->callback,
+                                   _q->userdata,
+                                   _x, _n, _num_workers);
+}
+
 // 
 // internal methods
 //
@@ -816,6 +916,47 @@ int flexframesync_execute_rxpayload(flexframesync _q,
     return LIQUID_OK;
 }
 
+// create worker synchronizer for batch search from template
+void * flexframesync_batch_create(void *             _template,
+                                  framesync_callback _callback,
+                                  void *             _userdata)
+{
+    flexframesync q = flexframesync_copy((flexframesync)_template);
+    if (q == NULL)
+        return NULL;
+    q->callback = _callback;
+    q->userdata = _userdata;
+    flexframesync_reset(q);
+    return q;
+}
+
+// push samples through batch worker synchronizer
+int flexframesync_batch_execute(void *          _q,
+                                float complex * _x,
+                                unsigned int    _n)
+{
+    return flexframesync_execute((flexframesync)_q, _x, _n);
+}
+
+// destroy batch worker synchronizer
+int flexframesync_batch_destroy(void * _q)
+{
+    return flexframesync_destroy((flexframesync)_q);
+}
+
+// get detection threshold
+float flexframesync_get_threshold(flexframesync _q)
+{
+    return qdetector_cccf_get_threshold(_q->detector);
+}
+
+// set detection threshold
+int flexframesync_set_threshold(flexframesync _q,
+                                float         _threshold)
+{
+    return qdetector_cccf_set_threshold(_q->detector, _threshold);
+}
+
 // reset frame data statistics
 int flexframesync_reset_framedatastats(flexframesync _q)
 {
@@ -44,6 +44,15 @@ int framesync64_callback_internal(float complex * _buf,
 //  -3  : write with random extension
 int framesync64_debug_export(framesync64 _q, int _code, float complex * _payload_rx);
 
+// batch search worker methods
+void * framesync64_batch_create(void *             _template,
+                                framesync_callback _callback,
+                                void *             _userdata);
+int framesync64_batch_execute(void *          _q,
+                              float complex * _x,
+                              unsigned int    _n);
+int framesync64_batch_destroy(void * _q);
+
 // framesync64 object structure
 struct framesync64_s {
     // callback
@@ -72,6 +81,7 @@ struct framesync64_s {
     char *       prefix;                // debug: filename prefix
     char *       filename;              // debug: filename buffer
     unsigned int num_files_exported;    // debug: number of files exported
+    LIQUID_PROFILE_MEMBER               // profiling counters
 };
 
 // create framesync64 object
@@ -126,6 +136,7 @@ framesync64 framesync64_create(framesync_callback _callback,
 
     // reset state and return
     framesync64_reset(q);
+    LIQUID_PROFILE_CREATE(q, "framesync64");
     return q;
 }
 
@@ -160,6 +171,7 @@ framesync64 framesync64_copy(framesync64 q_orig)
     // update the context for the sync object to that detected frames will
     // apply to this new frame synchronizer object
     qdsync_cccf_set_context(q_copy->sync, q_copy);
+    LIQUID_PROFILE_CREATE(q_copy, "framesync64");
 
     return q_copy;
 }
@@ -167,6 +179,8 @@ framesync64 framesync64_copy(framesync64 q_orig)
 // destroy frame synchronizer object, freeing all internal memory
 int framesync64_destroy(framesync64 _q)
 {
+    LIQUID_PROFILE_DESTROY(_q);
+
     // destroy synchronization objects
     qdsync_cccf_destroy (_q->sync);      // frame detector/synchronizer
     qpacketmodem_destroy(_q->dec);       // payload demodulator
@@ -221,7 +235,32 @@ int framesync64_execute(framesync64     _q,
                         float complex * _x,
                         unsigned int    _n)
 {
-    return qdsync_cccf_execute(_q->sync, _x, _n);
+    LIQUID_PROFILE_BEGIN(_q);
+    int rc = qdsync_cccf_execute(_q->sync, _x, _n);
+    LIQUID_PROFILE_END(_q, _n);
+    return rc;
+}
+
+// search stored capture for frames across a pool of worker threads
+//  _q              :   frame synchronizer object (configuration template)
+//  _x              :   input sample array [size: _n x 1]
+//  _n              :   number of input samples
+//  _num_workers    :   number of worker threads
+int framesync64_execute_batch(framesync64     _q,
+                              float complex * _x,
+                              unsigned int    _n,
+                              unsigned int    _num_workers)
+{
+    return framesync_batch_execute(_q,
+                                   framesync64_batch_create,
+                                   framesync64_batch_execute,
+                                   framesync64_batch_destroy,
+                                   8,
+                                   LIQUID_FRAME64_LEN,
+                                   LIQUID_FRAME64_LEN/2,
+                                   _q->callback,
+                                   _q->userdata,
+                                   _x, _n, _num_workers);
 }
 
 //
@@ -281,6 +320,34 @@ int framesync64_callback_internal(float complex * _buf,
     return framesync64_reset(_q);
 }
 
+// create worker synchronizer for batch search from template
+void * framesync64_batch_create(void *             _template,
+                                framesync_callback _callback,
+                                void *             _userdata)
+{
+    framesync64 q = framesync64_copy((framesync64)_template);
+    if (q == NULL)
+        return NULL;
+    q->callback = _callback;
+    q->userdata = _userdata;
+    framesync64_reset(q);
+    return q;
+}
+
+// push samples through batch worker synchronizer
+int framesync64_batch_execute(void *          _q,
+                              float complex * _x,
+                              unsigned int    _n)
+{
+    return framesync64_execute((framesync64)_q, _x, _n);
+}
+
+// destroy batch worker synchronizer
+int framesync64_batch_destroy(void * _q)
+{
+    return framesync64_destroy((framesync64)_q);
+}
+
 // DEPRECATED: enable debugging
 int framesync64_debug_enable(framesync64 _q)
 {
@@ -0,0 +1,316 @@
+/*
+ * Copyright (c) 2007 - 2024 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// framesync_batch.c
+//
+// Offline frame search over a stored capture. The input is split into
+// overlapping chunks, each processed by an independent copy of the frame
+// synchronizer on a pool of worker threads (if available). Each chunk
+// owns the frames which complete within its region; frames are buffered
+// and delivered to the user callback in sample order.
+//
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <complex.h>
+
+#include "liquid.internal.h"
+
+#if HAVE_LIBPTHREAD
+#include <pthread.h>
+#endif
+
+// buffered frame
+struct framesync_batch_frame_s {
+    unsigned int     index;         // sample index at which frame completed
+    unsigned char *  header;        // decoded header
+    int              header_valid;  // header valid flag
+    unsigned char *  payload;       // decoded payload
+    unsigned int     payload_len;   // payload length (bytes)
+    int              payload_valid; // payload valid flag
+    framesyncstats_s stats;         // frame statistics (owns framesyms)
+};
+
+// chunk of input capture
+struct framesync_batch_chunk_s {
+    unsigned int start;         // first input sample (including overlap)
+    unsigned int own;           // first sample owned by this chunk
+    unsigned int end;           // one past last sample owned by this chunk
+    unsigned int index;         // index of sample currently being pushed
+    unsigned int header_len;    // length of decoded header (bytes)
+    struct framesync_batch_frame_s * frames;
+    unsigned int num_frames;    // number of buffered frames
+    unsigned int num_alloc;     // number of allocated frame slots
+    int          done;          // chunk has been processed
+};
+
+// batch search object
+struct framesync_batch_s {
+    void *                          template;
+    framesync_batch_create_fcn      create;
+    framesync_batch_execute_fcn     execute;
+    framesync_batch_destroy_fcn     destroy;
+    float complex *                 x;
+    struct framesync_batch_chunk_s *chunks;
+    unsigned int                    num_chunks;
+    unsigned int                    next_chunk;
+#if HAVE_LIBPTHREAD
+    pthread_mutex_t                 lock;
+    pthread_cond_t                  cond;
+#endif
+};
+
+// forward declaration of internal methods
+int framesync_batch_callback_internal(unsigned char *  _header,
+                                      int              _header_valid,
+                                      unsigned char *  _payload,
+                                      unsigned int     _payload_len,
+                                      int              _payload_valid,
+                                      framesyncstats_s _stats,
+                                      void *           _userdata);
+int framesync_batch_process_chunk(struct framesync_batch_s *       _q,
+                                  struct framesync_batch_chunk_s * _c);
+int framesync_batch_deliver_chunk(struct framesync_batch_chunk_s * _c,
+                                  unsigned int                     _min_spacing,
+                                  int *                            _have_last,
+                                  unsigned int *                   _last,
+                                  framesync_callback               _callback,
+                                  void *                           _userdata);
+#if HAVE_LIBPTHREAD
+void * framesync_batch_worker(void * _context);
+#endif
+
+int framesync_batch_execute(void *                      _template,
+                            framesync_batch_create_fcn  _create,
+                            framesync_batch_execute_fcn _execute,
+                            framesync_batch_destroy_fcn _destroy,
+                            unsigned int                _header_len,
+                            unsigned int                _max_frame_len,
+                            unsigned int                _min_spacing,
+                            framesync_callback          _callback,
+                            void *                      _userdata,
+                            float complex *             _x,
+                            unsigned int                _n,
+                            unsigned int                _num_workers)
+{
+    // validate input
+    if (_max_frame_len == 0)
+        return liquid_error(LIQUID_EICONFIG,"framesync_batch_execute(), maximum frame length must be greater than zero");
+    if (_num_workers == 0)
+        return liquid_error(LIQUID_EICONFIG,"framesync_batch_execute(), number of workers must be greater than zero");
+    if (_n == 0)
+        return LIQUID_OK;
+
+    // chunk length: long enough that the overlap is a small fraction of the
+    // work, short enough that the workers are kept busy
+    unsigned int overlap   = _max_frame_len + FRAMESYNC_BATCH_WARMUP;
+    unsigned int chunk_len = (_n + 4*_num_workers - 1) / (4*_num_workers);
+    if (chunk_len < 4*overlap)
+        chunk_len = 4*overlap;
+
+    struct framesync_batch_s q;
+    q.template   = _template;
+    q.create     = _create;
+    q.execute    = _execute;
+    q.destroy    = _destroy;
+    q.x          = _x;
+    q.num_chunks = (_n + chunk_len - 1) / chunk_len;
+    q.next_chunk = 0;
+    q.chunks     = (struct framesync_batch_chunk_s*) malloc(q.num_chunks*sizeof(struct framesync_batch_chunk_s));
+    unsigned int i;
+    for (i=0; i<q.num_chunks; i++) {
+        struct framesync_batch_chunk_s * c = &q.chunks[i];
+        c->own        = i*chunk_len;
+        c->start      = c->own > overlap ? c->own - overlap : 0;
+        c->end        = c->own + chunk_len < _n ? c->own + chunk_len : _n;
+        c->index      = c->start;
+        c->header_len = _header_len;
+        c->frames     = NULL;
+        c->num_frames = 0;
+        c->num_alloc  = 0;
+        c->done       = 0;
+    }
+
+    int          have_last = 0;
+    unsigned int last      = 0;
+    unsigned int num_threads = 0;
+#if HAVE_LIBPTHREAD
+    unsigned int num_workers = _num_workers < q.num_chunks ? _num_workers : q.num_chunks;
+    pthread_t threads[num_workers];
+    if (num_workers > 1) {
+        pthread_mutex_init(&q.lock, NULL);
+        pthread_cond_init (&q.cond, NULL);
+        for (i=0; i<num_workers; i++) {
+            if (pthread_create(&threads[num_threads], NULL, framesync_batch_worker, &q) == 0)
+                num_threads++;
+        }
+        if (num_threads == 0) {
+            pthread_mutex_destroy(&q.lock);
+            pthread_cond_destroy (&q.cond);
+        }
+    }
+
+    if (num_threads > 0) {
+        // deliver chunks in order as the workers complete them
+        for (i=0; i<q.num_chunks; i++) {
+            pthread_mutex_lock(&q.lock);
+            while (!q.chunks[i].done)
+                pthread_cond_wait(&q.cond, &q.lock);
+            pthread_mutex_unlock(&q.lock);
+            framesync_batch_deliver_chunk(&q.chunks[i], _min_spacing,
+                &have_last, &last, _callback, _userdata);
+        }
+        for (i=0; i<num_threads; i++)
+            pthread_join(threads[i], NULL);
+        pthread_mutex_destroy(&q.lock);
+        pthread_cond_destroy (&q.cond);
+    }
+#endif
+
+    // sequential fallback
+    if (num_threads == 0) {
+        for (i=0; i<q.num_chunks; i++) {
+            framesync_batch_process_chunk(&q, &q.chunks[i]);
+            framesync_batch_deliver_chunk(&q.chunks[i], _min_spacing,
+                &have_last, &last, _callback, _userdata);
+        }
+    }
+
+    free(q.chunks);
+    return LIQUID_OK;
+}
+
+//
+// internal methods
+//
+
+// worker synchronizer callback: buffer frame if owned by this chunk
+int framesync_batch_callback_internal(unsigned char *  _header,
+                                      int              _header_valid,
+                                      unsigned char *  _payload,
+                                      unsigned int     _payload_len,
+                                      int              _payload_valid,
+                                      framesyncstats_s _stats,
+                                      void *           _userdata)
+{
+    struct framesync_batch_chunk_s * c = (struct framesync_batch_chunk_s*) _userdata;
+
+    // frames completing in the overlap region belong to the previous chunk
+    if (c->index < c->own)
+        return 0;
+
+    // grow buffer as needed
+    if (c->num_frames == c->num_alloc) {
+        c->num_alloc = c->num_alloc == 0 ? 4 : 2*c->num_alloc;
+        c->frames = (struct framesync_batch_frame_s*) realloc(c->frames,
+            c->num_alloc*sizeof(struct framesync_batch_frame_s));
+    }
+
+    // copy frame contents
+    struct framesync_batch_frame_s * f = &c->frames[c->num_frames++];
+    f->index         = c->index;
+    f->header        = _header == NULL ? NULL :
+                       (unsigned char*) liquid_malloc_copy(_header, c->header_len, sizeof(unsigned char));
+    f->header_valid  = _header_valid;
+    f->payload       = _payload == NULL ? NULL :
+                       (unsigned char*) liquid_malloc_copy(_payload, _payload_len, sizeof(unsigned char));
+    f->payload_len   = _payload_len;
+    f->payload_valid = _payload_valid;
+    f->stats         = _stats;
+    f->stats.framesyms = _stats.framesyms == NULL ? NULL :
+        (float complex*) liquid_malloc_copy(_stats.framesyms, _stats.num_framesyms, sizeof(float complex));
+    return 0;
+}
+
+// run independent synchronizer over chunk
+int framesync_batch_process_chunk(struct framesync_batch_s *       _q,
+                                  struct framesync_batch_chunk_s * _c)
+{
+    void * sync = _q->create(_q->template, framesync_batch_callback_internal, _c);
+    if (sync == NULL)
+        return liquid_error(LIQUID_EINT,"framesync_batch_process_chunk(), could not create synchronizer");
+
+    // push one sample at a time so frames are tagged with exact sample index
+    for (_c->index=_c->start; _c->index<_c->end; _c->index++)
+        _q->execute(sync, &_q->x[_c->index], 1);
+
+    return _q->destroy(sync);
+}
+
+// invoke user callback on buffered frames, freeing memory
+int framesync_batch_deliver_chunk(struct framesync_batch_chunk_s * _c,
+                                  unsigned int                     _min_spacing,
+                                  int *                            _have_last,
+                                  unsigned int *                   _last,
+                                  framesync_callback               _callback,
+                                  void *                           _userdata)
+{
+    unsigned int i;
+    for (i=0; i<_c->num_frames; i++) {
+        struct framesync_batch_frame_s * f = &_c->frames[i];
+
+        // drop duplicate of frame reported by previous chunk with timing jitter
+        int duplicate = *_have_last && f->index < *_last + _min_spacing;
+        if (!duplicate) {
+            *_have_last = 1;
+            *_last      = f->index;
+            if (_callback != NULL) {
+                _callback(f->header, f->header_valid, f->payload,
+                          f->payload_len, f->payload_valid, f->stats, _userdata);
+            }
+        }
+
+        free(f->header);
+        free(f->payload);
+        free(f->stats.framesyms);
+    }
+    free(_c->frames);
+    _c->frames     = NULL;
+    _c->num_frames = 0;
+    return LIQUID_OK;
+}
+
+#if HAVE_LIBPTHREAD
+// worker thread: claim and process chunks until none remain
+void * framesync_batch_worker(void * _context)
+{
+    struct framesync_batch_s * q = (struct framesync_batch_s*) _context;
+    while (1) {
+        pthread_mutex_lock(&q->lock);
+        unsigned int i = q->next_chunk++;
+        pthread_mutex_unlock(&q->lock);
+        if (i >= q->num_chunks)
+            break;
+
+        framesync_batch_process_chunk(q, &q->chunks[i]);
+
+        pthread_mutex_lock(&q->lock);
+        q->chunks[i].done = 1;
+        pthread_cond_broadcast(&q->cond);
+        pthread_mutex_unlock(&q->lock);
+    }
+    return NULL;
+}
+#endif
@@ -45,6 +45,10 @@ struct PRESYNC(_s) {
     float * rxy;        // output correlation [size: m x 1]
 
     float n_inv;        // 1/n (pre-computed for speed)
+
+    // FFT search bank (created with _create_fft(), otherwise NULL)
+    windowcf rx;        // received samples
+    segcorr  fb;        // segmented correlator, FFT across segments
 };
 
 // correlate input sequence with particular sequence index
@@ -113,14 +117,55 @@ PRESYNC() PRESYNC(_create)(TC *         _v,
     // allocate memory for cross-correlation
     _q->rxy = (float*) malloc( _q->m*sizeof(float) );
 
+    // FFT search bank not used
+    _q->rx = NULL;
+    _q->fb = NULL;
+
     // reset object
     PRESYNC(_reset)(_q);
 
     return _q;
 }
 
+// create pre-demod synchronizer evaluating all frequency hypotheses at once
+//  _v          :   baseband sequence
+//  _n          :   baseband sequence length
+//  _dphi_max   :   maximum absolute frequency deviation
+PRESYNC() PRESYNC(_create_fft)(TC *         _v,
+                               unsigned int _n,
+                               float        _dphi_max)
+{
+    // validate input
+    if (_n < 1)
+        return liquid_error_config("presync_%s_create_fft(), invalid input length", EXTENSION_FULL);
+    if (_dphi_max < 0.0f || _dphi_max > (float)M_PI)
+        return liquid_error_config("presync_%s_create_fft(), maximum frequency deviation must be in [0,pi]", EXTENSION_FULL);
+
+    // allocate main object memory and initialize
+    PRESYNC() _q = (PRESYNC()) malloc(sizeof(struct PRESYNC(_s)));
+    _q->n      = _n;
+    _q->m      = 0;
+    _q->n_inv  = 1.0f / (float)(_q->n);
+    _q->dphi   = NULL;
+    _q->sync_i = NULL;
+    _q->sync_q = NULL;
+    _q->rxy    = NULL;
+
+    // create receive buffer and segmented correlator
+    _q->rx = windowcf_create(_q->n);
+    _q->fb = segcorr_create(_v, _n, _dphi_max);
+    return _q;
+}
+
 int PRESYNC(_destroy)(PRESYNC() _q)
 {
+    if (_q->fb != NULL) {
+        windowcf_destroy(_q->rx);
+        segcorr_destroy (_q->fb);
+        free(_q);
+        return LIQUID_OK;
+    }
+
     unsigned int i;
 
     // free received symbol buffers
@@ -154,6 +199,9 @@ int PRESYNC(_print)(PRESYNC() _q)
 
 int PRESYNC(_reset)(PRESYNC() _q)
 {
+    if (_q->fb != NULL)
+        return windowcf_reset(_q->rx);
+
     WINDOW(_reset)(_q->rx_i);
     WINDOW(_reset)(_q->rx_q);
     return LIQUID_OK;
@@ -165,9 +213,12 @@ int PRESYNC(_reset)(PRESYNC() _q)
 int PRESYNC(_push)(PRESYNC() _q,
                     TI        _x)
 {
+    if (_q->fb != NULL)
+        return windowcf_push(_q->rx, _x);
+
     // push symbol into buffers
     WINDOW(_push)(_q->rx_i, REAL(_x));
-    WINDOW(_push)(_q->rx_q, REAL(_x));
+    WINDOW(_push)(_q->rx_q, IMAG(_x));
     return LIQUID_OK;
 }
 
@@ -185,6 +236,14 @@ int PRESYNC(_execute)(PRESYNC() _q,
     float complex rxy0;
     float complex rxy1;
     float dphi_hat = 0.0f;
+
+    // evaluate all frequency hypotheses at once
+    if (_q->fb != NULL) {
+        float complex * r = NULL;
+        windowcf_read(_q->rx, &r);
+        return segcorr_execute(_q->fb, r, _rxy, _dphi_hat);
+    }
+
     for (i=0; i<_q->m; i++)  {
 
         PRESYNC(_correlate)(_q, i, &rxy0, &rxy1);
@@ -209,6 +268,27 @@ int PRESYNC(_execute)(PRESYNC() _q,
     return LIQUID_OK;
 }
 
+// push block of samples, correlating after each; this is a convenience
+// wrapper around push() and execute() for each sample
+//  _q          :   pre-demod synchronizer object
+//  _x          :   input samples [size: _n x 1]
+//  _n          :   number of input samples
+//  _rxy        :   output cross correlation [size: _n x 1]
+//  _dphi_hat   :   output frequency offset estimates [size: _n x 1]
+int PRESYNC(_execute_block)(PRESYNC()    _q,
+                            TI *         _x,
+                            unsigned int _n,
+                            TO *         _rxy,
+                            float *      _dphi_hat)
+{
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        PRESYNC(_push)(_q, _x[i]);
+        PRESYNC(_execute)(_q, &_rxy[i], &_dphi_hat[i]);
+    }
+    return LIQUID_OK;
+}
+
 //
 // internal methods
 //
@@ -677,9 +677,18 @@ int QDETECTOR(_execute_align)(QDETECTOR() _q, TI _x)
     // METHOD 2: compute metric by de-rotating signal and measuring resulting phase
     // NOTE: this is possibly more accurate than the above method but might also
     //       be more computationally complex
-    TI metric = 0;
-    for (i=0; i<_q->s_len; i++)
-        metric += _q->buf_time_0[i] * cexpf(-_Complex_I*_q->dphi_hat*i);
+    TI    metric = 0;
+    float theta[64];
+    TI    r[64];
+    unsigned int j;
+    for (i=0; i<_q->s_len; i+=64) {
+        unsigned int n = _q->s_len - i < 64 ? _q->s_len - i : 64;
+        for (j=0; j<n; j++)
+            theta[j] = -_q->dphi_hat*(i+j);
+        liquid_vcexpjf(theta, n, r, LIQUID_VMATH_PRECISE);
+        for (j=0; j<n; j++)
+            metric += _q->buf_time_0[i+j] * r[j];
+    }
     //printf("metric : %12.8f <%12.8f>\n", cabsf(metric), cargf(metric));
     _q->phi_hat = cargf(metric);
 #endif
@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2007 - 2024 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// segcorr.c
+//
+// Segmented correlator for coarse frequency search. The sequence is split
+// into segments of length L short enough that a frequency offset rotates
+// the phase very little within a segment; the partial correlations of the
+// segments are then combined for every frequency hypothesis at once with
+// a zero-padded FFT across segments. The cost per correlation is one
+// length-n dot product plus one small FFT, independent of the number of
+// hypotheses searched.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+#include <complex.h>
+
+#include "liquid.internal.h"
+
+struct segcorr_s {
+    unsigned int    n;          // sequence length
+    float           dphi_max;   // maximum frequency deviation
+    unsigned int    L;          // segment length
+    unsigned int    S;          // number of segments
+    dotprod_cccf *  seg;        // per-segment correlators, [size: S x 1]
+    unsigned int    nfft;       // transform size across segments
+    int             kmax;       // largest bin index within +/- dphi_max
+    float complex * buf_time;   // segment partial correlations
+    float complex * buf_freq;   // correlation per frequency bin
+    FFT_PLAN        fft;        // transform: buf_time > buf_freq
+};
+
+// create segmented correlator
+//  _v          :   baseband sequence, [size: _n x 1]
+//  _n          :   baseband sequence length, _n > 0
+//  _dphi_max   :   maximum absolute frequency deviation, _dphi_max >= 0
+segcorr segcorr_create(float complex * _v,
+                       unsigned int    _n,
+                       float           _dphi_max)
+{
+    // validate input
+    if (_n == 0)
+        return liquid_error_config("segcorr_create(), sequence length must be greater than zero");
+    if (_dphi_max < 0.0f || _dphi_max > (float)M_PI)
+        return liquid_error_config("segcorr_create(), maximum frequency deviation must be in [0,pi]");
+
+    segcorr q = (segcorr) malloc(sizeof(struct segcorr_s));
+    q->n        = _n;
+    q->dphi_max = _dphi_max;
+
+    // segment length: limit phase rotation across a segment to pi/2 at the
+    // edge of the search range (worst-case coherent loss of about 0.9 dB)
+    float L = _dphi_max > 0.0f ? floorf(0.5f*M_PI / _dphi_max) : (float)_n;
+    q->L = L < 1.0f ? 1 : (L > (float)_n ? _n : (unsigned int)L);
+    q->S = (q->n + q->L - 1) / q->L;
+
+    // per-segment correlators (conjugated sequence)
+    unsigned int i, k;
+    q->seg = (dotprod_cccf*) malloc(q->S*sizeof(dotprod_cccf));
+    float complex v[q->L];
+    for (i=0; i<q->S; i++) {
+        unsigned int len = (i+1)*q->L <= q->n ? q->L : q->n - i*q->L;
+        for (k=0; k<len; k++)
+            v[k] = conjf(_v[i*q->L + k]);
+        q->seg[i] = dotprod_cccf_create(v, len);
+    }
+
+    // transform across segments, zero-padded by at least 4 to reduce
+    // scalloping loss and bias of interpolated peak between bins
+    q->nfft     = 1 << liquid_nextpow2(4*q->S);
+    q->buf_time = (float complex*) FFT_MALLOC(q->nfft*sizeof(float complex));
+    q->buf_freq = (float complex*) FFT_MALLOC(q->nfft*sizeof(float complex));
+    memset(q->buf_time, 0x00, q->nfft*sizeof(float complex));
+    q->fft = FFT_CREATE_PLAN(q->nfft, q->buf_time, q->buf_freq, FFT_DIR_FORWARD, 0);
+
+    // bin k corresponds to frequency 2*pi*k/(nfft*L)
+    q->kmax = (int) floorf(_dphi_max * q->nfft * q->L / (2*M_PI));
+    if (q->kmax > (int)(q->nfft/2))
+        q->kmax = q->nfft/2;
+    return q;
+}
+
+// destroy object
+int segcorr_destroy(segcorr _q)
+{
+    unsigned int i;
+    for (i=0; i<_q->S; i++)
+        dotprod_cccf_destroy(_q->seg[i]);
+    free(_q->seg);
+    FFT_DESTROY_PLAN(_q->fft);
+    FFT_FREE(_q->buf_time);
+    FFT_FREE(_q->buf_freq);
+    free(_q);
+    return LIQUID_OK;
+}
+
+// print object
+int segcorr_print(segcorr _q)
+{
+    printf("<liquid.segcorr, n=%u, segments=%u, seglen=%u, nfft=%u, bins=%d>\n",
+        _q->n, _q->S, _q->L, _q->nfft, 2*_q->kmax+1);
+    return LIQUID_OK;
+}
+
+// correlate received buffer against sequence over all frequency hypotheses
+int segcorr_execute(segcorr         _q,
+                    float complex * _r,
+                    float complex * _rxy,
+                    float *         _dphi_hat)
+{
+    // partial correlation of each segment (remainder of buffer stays zero)
+    unsigned int i;
+    for (i=0; i<_q->S; i++)
+        dotprod_cccf_execute(_q->seg[i], _r + i*_q->L, &_q->buf_time[i]);
+
+    // combine segments for all frequency hypotheses
+    FFT_EXECUTE(_q->fft);
+
+    // find peak within search range
+    int   k;
+    int   k_hat   = 0;
+    float e2_max  = -1.0f;
+    int   nfft    = (int)_q->nfft;
+    for (k=-_q->kmax; k<=_q->kmax; k++) {
+        float complex X = _q->buf_freq[(k + nfft) % nfft];
+        float e2 = crealf(X)*crealf(X) + cimagf(X)*cimagf(X);
+        if (e2 > e2_max) {
+            e2_max = e2;
+            k_hat  = k;
+        }
+    }
+
+    // refine frequency estimate with parabolic fit across adjacent bins
+    float a = cabsf(_q->buf_freq[(k_hat - 1 + nfft) % nfft]);
+    float b = cabsf(_q->buf_freq[(k_hat     + nfft) % nfft]);
+    float c = cabsf(_q->buf_freq[(k_hat + 1 + nfft) % nfft]);
+    float d = a - 2*b + c;
+    float delta = d < 0.0f ? 0.5f*(a - c) / d : 0.0f;
+    if (delta < -0.5f) delta = -0.5f;
+    if (delta >  0.5f) delta =  0.5f;
+
+    // frequency of peak bin; compensate for mean rotation within segments
+    float scale = 2*M_PI / (float)(_q->nfft*_q->L);
+    float dphi  = scale * (float)k_hat;
+    *_rxy       = _q->buf_freq[(k_hat + nfft) % nfft] *
+                  cexpf(-_Complex_I*0.5f*dphi*(float)(_q->L-1)) / (float)(_q->n);
+    *_dphi_hat  = scale * ((float)k_hat + delta);
+
+    // keep estimate within search range
+    if (*_dphi_hat >  _q->dphi_max) *_dphi_hat =  _q->dphi_max;
+    if (*_dphi_hat < -_q->dphi_max) *_dphi_hat = -_q->dphi_max;
+    return LIQUID_OK;
+}
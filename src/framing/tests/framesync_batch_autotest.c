@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2007 - 2024 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+// frames recovered, in order of callback; false detections in the noise
+// between frames are counted but otherwise ignored
+struct framesync_batch_autotest_s {
+    unsigned int num_frames;
+    unsigned int num_invalid;
+    unsigned int id[64];
+};
+
+static int framesync_batch_autotest_callback(unsigned char *  _header,
+                                             int              _header_valid,
+                                             unsigned char *  _payload,
+                                             unsigned int     _payload_len,
+                                             int              _payload_valid,
+                                             framesyncstats_s _stats,
+                                             void *           _userdata)
+{
+    struct framesync_batch_autotest_s * r = (struct framesync_batch_autotest_s*)_userdata;
+    if (!_header_valid || !_payload_valid) {
+        r->num_invalid++;
+        return 0;
+    }
+    if (r->num_frames < 64)
+        r->id[r->num_frames] = _header[0];
+    r->num_frames++;
+    return 0;
+}
+
+// append random-length noise gap to capture
+static unsigned int framesync_batch_autotest_gap(float complex * _x)
+{
+    unsigned int i, n = 200 + (rand() % 2000);
+    for (i=0; i<n; i++)
+        _x[i] = 0.01f*(randnf() + _Complex_I*randnf()) * M_SQRT1_2;
+    return n;
+}
+
+// check that each frame in capture is recovered exactly once, in order
+static void framesync_batch_autotest_check(struct framesync_batch_autotest_s * _r,
+                                           unsigned int                        _num_frames)
+{
+    unsigned int i;
+    CONTEND_EQUALITY(_r->num_frames, _num_frames);
+    for (i=0; i<_num_frames && i<_r->num_frames; i++)
+        CONTEND_EQUALITY(_r->id[i], i);
+}
+
+// recover framesync64 frames from capture with batch search
+void testbench_framesync64_batch(unsigned int _num_workers)
+{
+    unsigned int i, num_frames = 24;
+
+    // generate capture: frames separated by random gaps
+    unsigned int    n = 0;
+    float complex * x = (float complex*) malloc(num_frames*(LIQUID_FRAME64_LEN+2200)*sizeof(float complex));
+    framegen64 fg = framegen64_create();
+    unsigned char header[8] = {0,0,0,0,0,0,0,0};
+    for (i=0; i<num_frames; i++) {
+        n += framesync_batch_autotest_gap(x+n);
+        header[0] = i;
+        framegen64_execute(fg, header, NULL, x+n);
+        n += LIQUID_FRAME64_LEN;
+    }
+    n += framesync_batch_autotest_gap(x+n);
+
+    // run batch search
+    struct framesync_batch_autotest_s r;
+    memset(&r, 0, sizeof(r));
+    framesync64 fs = framesync64_create(framesync_batch_autotest_callback, &r);
+    framesync64_set_threshold(fs, 0.7f); // reduce false alarms in noise gaps
+    framesync64_execute_batch(fs, x, n, _num_workers);
+    framesync_batch_autotest_check(&r, num_frames);
+
+    // template object should be untouched
+    framedatastats_s stats = framesync64_get_framedatastats(fs);
+    CONTEND_EQUALITY(stats.num_frames_detected, 0);
+
+    framegen64_destroy(fg);
+    framesync64_destroy(fs);
+    free(x);
+}
+
+void autotest_framesync64_batch_w1() { testbench_framesync64_batch(1); }
+void autotest_framesync64_batch_w4() { testbench_framesync64_batch(4); }
+
+// recover flexframesync frames from capture with batch search
+void testbench_flexframesync_batch(unsigned int _num_workers)
+{
+    unsigned int i, num_frames = 16, payload_len = 120;
+
+    flexframegenprops_s fgprops;
+    flexframegenprops_init_default(&fgprops);
+    fgprops.mod_scheme = LIQUID_MODEM_QPSK;
+    fgprops.check      = LIQUID_CRC_32;
+    flexframegen fg = flexframegen_create(&fgprops);
+    unsigned char header[14];
+    unsigned char payload[payload_len];
+    memset(header, 0, sizeof(header));
+    flexframegen_assemble(fg, header, payload, payload_len);
+    unsigned int frame_len = flexframegen_getframelen(fg);
+
+    // generate capture: frames separated by random gaps
+    unsigned int    n = 0;
+    float complex * x = (float complex*) malloc(num_frames*(frame_len+2200)*sizeof(float complex));
+    for (i=0; i<num_frames; i++) {
+        n += framesync_batch_autotest_gap(x+n);
+        header[0] = i;
+        unsigned int j;
+        for (j=0; j<payload_len; j++)
+            payload[j] = rand() & 0xff;
+        flexframegen_assemble(fg, header, payload, payload_len);
+        flexframegen_write_samples(fg, x+n, frame_len);
+        n += frame_len;
+    }
+    n += framesync_batch_autotest_gap(x+n);
+
+    // run batch search
+    struct framesync_batch_autotest_s r;
+    memset(&r, 0, sizeof(r));
+    flexframesync fs = flexframesync_create(framesync_batch_autotest_callback, &r);
+    flexframesync_set_threshold(fs, 0.7f); // reduce false alarms in noise gaps
+    flexframesync_execute_batch(fs, x, n, frame_len, _num_workers);
+    framesync_batch_autotest_check(&r, num_frames);
+
+    flexframegen_destroy(fg);
+    flexframesync_destroy(fs);
+    free(x);
+}
+
+void autotest_flexframesync_batch_w1() { testbench_flexframesync_batch(1); }
+void autotest_flexframesync_batch_w3() { testbench_flexframesync_batch(3); }
+
+// compare batch search against streaming synchronizer
+void autotest_framesync64_batch_streaming()
+{
+    unsigned int i, num_frames = 12;
+    unsigned int    n = 0;
+    float complex * x = (float complex*) malloc(num_frames*(LIQUID_FRAME64_LEN+2200)*sizeof(float complex));
+    framegen64 fg = framegen64_create();
+    unsigned char header[8] = {0,0,0,0,0,0,0,0};
+    for (i=0; i<num_frames; i++) {
+        n += framesync_batch_autotest_gap(x+n);
+        header[0] = i;
+        framegen64_execute(fg, header, NULL, x+n);
+        n += LIQUID_FRAME64_LEN;
+    }
+
+    struct framesync_batch_autotest_s r0, r1;
+    memset(&r0, 0, sizeof(r0));
+    memset(&r1, 0, sizeof(r1));
+    framesync64 fs = framesync64_create(framesync_batch_autotest_callback, &r0);
+    framesync64_set_threshold(fs, 0.7f);
+    framesync64_execute(fs, x, n);
+    framesync64_reset(fs);
+    framesync64_set_userdata(fs, &r1);
+    framesync64_execute_batch(fs, x, n, 2);
+
+    CONTEND_EQUALITY(r0.num_frames, r1.num_frames);
+    CONTEND_SAME_DATA(r0.id, r1.id, num_frames*sizeof(unsigned int));
+
+    framegen64_destroy(fg);
+    framesync64_destroy(fs);
+    free(x);
+}
+
+void autotest_framesync_batch_config()
+{
+#if LIQUID_STRICT_EXIT
+    AUTOTEST_WARN("skipping framesync batch config test with strict exit enabled\n");
+    return;
+#endif
+#if !LIQUID_SUPPRESS_ERROR_OUTPUT
+    fprintf(stderr,"warning: ignore potential errors here; checking for invalid configurations\n");
+#endif
+    float complex x[4] = {0,0,0,0};
+    framesync64   q64 = framesync64_create(NULL, NULL);
+    flexframesync qfx = flexframesync_create(NULL, NULL);
+    CONTEND_ISNULL(flexframesync_copy(NULL));
+    CONTEND_INEQUALITY(LIQUID_OK, framesync64_execute_batch  (q64, x, 4, 0));
+    CONTEND_INEQUALITY(LIQUID_OK, flexframesync_execute_batch(qfx, x, 4, 0, 1));
+    CONTEND_INEQUALITY(LIQUID_OK, flexframesync_execute_batch(qfx, x, 4, 1000, 0));
+    CONTEND_EQUALITY  (LIQUID_OK, flexframesync_execute_batch(qfx, x, 4, 1000, 2));
+    framesync64_destroy(q64);
+    flexframesync_destroy(qfx);
+}
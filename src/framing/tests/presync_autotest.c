@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2007 - 2024 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+// generate random sequence (QPSK or BPSK with the same energy)
+static void presync_autotest_sequence(float complex * _v,
+                                      unsigned int    _n,
+                                      int             _real)
+{
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        _v[i] = _real ? (rand() % 2 ? M_SQRT2 : -M_SQRT2) :
+                (rand() % 2 ? 1.0f : -1.0f) + (rand() % 2 ? 1.0f : -1.0f)*_Complex_I;
+    }
+}
+
+// push sequence with carrier offset through synchronizer and check estimate
+//  _binary     : use binary synchronizer?
+//  _fft        : use FFT search bank?
+//  _n          : sequence length
+//  _dphi_max   : maximum frequency deviation
+//  _dphi       : carrier frequency offset
+void testbench_presync(int          _binary,
+                       int          _fft,
+                       unsigned int _n,
+                       float        _dphi_max,
+                       float        _dphi)
+{
+    unsigned int i;
+    // bank of correlators assumes real-valued sequence when searching both
+    // positive and negative offsets; FFT bank handles complex sequences
+    float complex v[_n];
+    presync_autotest_sequence(v, _n, !_fft);
+
+    // bank of correlators spaced by 1/16 of the search range
+    unsigned int m = 17;
+    presync_cccf  q0 = NULL;
+    bpresync_cccf q1 = NULL;
+    if (_binary)
+        q1 = _fft ? bpresync_cccf_create_fft(v, _n, _dphi_max) : bpresync_cccf_create(v, _n, _dphi_max, m);
+    else
+        q0 = _fft ?  presync_cccf_create_fft(v, _n, _dphi_max) :  presync_cccf_create(v, _n, _dphi_max, m);
+
+    // push noise followed by sequence with offset, keeping final output
+    float complex rxy = 0, rxy_noise = 0;
+    float dphi_hat = 0, dphi_noise = 0;
+    for (i=0; i<2*_n; i++) {
+        float complex x = i < _n ? 0.5f*(randnf() + _Complex_I*randnf()) :
+                                   v[i-_n] * cexpf(_Complex_I*_dphi*(float)(i-_n));
+        if (_binary) {
+            bpresync_cccf_push(q1, x);
+            bpresync_cccf_execute(q1, &rxy, &dphi_hat);
+        } else {
+            presync_cccf_push(q0, x);
+            presync_cccf_execute(q0, &rxy, &dphi_hat);
+        }
+        if (i == _n-1) {
+            rxy_noise  = rxy;
+            dphi_noise = dphi_hat;
+        }
+    }
+    if (liquid_autotest_verbose) {
+        printf("presync%s(%s) n=%u, dphi=%8.5f: |rxy|=%6.3f (noise %6.3f), dphi-hat=%8.5f\n",
+            _binary ? "[b]" : "", _fft ? "fft" : "bank", _n, _dphi,
+            cabsf(rxy), cabsf(rxy_noise), dphi_hat);
+    }
+
+    // correlation peak (|v|^2 = 2) should stand well above noise; FFT
+    // estimate should be within a fraction of the correlation main lobe
+    // while bank resolution is limited by spacing of correlators
+    float tol = _fft ? 0.2f*M_PI/(float)_n : 0.5f*_dphi_max/(float)(m-1) + 1e-4f;
+    CONTEND_GREATER_THAN(cabsf(rxy), 1.4f);
+    CONTEND_LESS_THAN   (cabsf(rxy_noise), 0.5f*cabsf(rxy));
+    CONTEND_DELTA       (dphi_hat, _dphi, tol);
+    CONTEND_LESS_THAN   (fabsf(dphi_noise), _dphi_max + 1e-3f);
+
+    if (_binary) bpresync_cccf_destroy(q1);
+    else          presync_cccf_destroy(q0);
+}
+
+void autotest_presync_bank_n64()        { testbench_presync(0, 0,  64, 0.08f,  0.03f); }
+void autotest_presync_fft_n64()         { testbench_presync(0, 1,  64, 0.08f,  0.03f); }
+void autotest_presync_fft_n64_neg()     { testbench_presync(0, 1,  64, 0.08f, -0.061f); }
+void autotest_presync_fft_n256()        { testbench_presync(0, 1, 256, 0.20f,  0.137f); }
+void autotest_presync_fft_n256_zero()   { testbench_presync(0, 1, 256, 0.20f,  0.0f); }
+void autotest_bpresync_bank_n64()       { testbench_presync(1, 0,  64, 0.08f,  0.03f); }
+void autotest_bpresync_fft_n64()        { testbench_presync(1, 1,  64, 0.08f,  0.03f); }
+void autotest_bpresync_fft_n256_neg()   { testbench_presync(1, 1, 256, 0.20f, -0.11f); }
+
+// block execution should match sample-by-sample execution
+void autotest_presync_fft_block()
+{
+    unsigned int i, n = 48, num_samples = 200;
+    float complex v[n];
+    presync_autotest_sequence(v, n, 0);
+    presync_cccf q0 = presync_cccf_create_fft(v, n, 0.1f);
+    presync_cccf q1 = presync_cccf_create_fft(v, n, 0.1f);
+
+    float complex x[num_samples];
+    for (i=0; i<num_samples; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    float complex rxy0[num_samples], rxy1[num_samples];
+    float         dphi0[num_samples], dphi1[num_samples];
+    for (i=0; i<num_samples; i++) {
+        presync_cccf_push(q0, x[i]);
+        presync_cccf_execute(q0, &rxy0[i], &dphi0[i]);
+    }
+    presync_cccf_execute_block(q1, x, num_samples, rxy1, dphi1);
+    CONTEND_SAME_DATA(rxy0,  rxy1,  num_samples*sizeof(float complex));
+    CONTEND_SAME_DATA(dphi0, dphi1, num_samples*sizeof(float));
+
+    // reset and run again
+    presync_cccf_reset(q1);
+    presync_cccf_execute_block(q1, x, num_samples, rxy1, dphi1);
+    CONTEND_SAME_DATA(rxy0,  rxy1,  num_samples*sizeof(float complex));
+
+    presync_cccf_destroy(q0);
+    presync_cccf_destroy(q1);
+}
+
+void autotest_presync_config()
+{
+#if LIQUID_STRICT_EXIT
+    AUTOTEST_WARN("skipping presync config test with strict exit enabled\n");
+    return;
+#endif
+#if !LIQUID_SUPPRESS_ERROR_OUTPUT
+    fprintf(stderr,"warning: ignore potential errors here; checking for invalid configurations\n");
+#endif
+    float complex v[8] = {1,-1,1,1,-1,1,-1,-1};
+    CONTEND_ISNULL( presync_cccf_create    (v, 0, 0.1f, 4));
+    CONTEND_ISNULL( presync_cccf_create    (v, 8, 0.1f, 0));
+    CONTEND_ISNULL( presync_cccf_create_fft(v, 0, 0.1f));
+    CONTEND_ISNULL( presync_cccf_create_fft(v, 8, -0.1f));
+    CONTEND_ISNULL( presync_cccf_create_fft(v, 8, 4.0f));
+    CONTEND_ISNULL(bpresync_cccf_create_fft(v, 0, 0.1f));
+    CONTEND_ISNULL(bpresync_cccf_create_fft(v, 8, -0.1f));
+
+    // edge cases: no frequency search, full search range
+    presync_cccf q = presync_cccf_create_fft(v, 8, 0.0f);
+    CONTEND_EQUALITY(LIQUID_OK, presync_cccf_print(q));
+    presync_cccf_destroy(q);
+    q = presync_cccf_create_fft(v, 8, M_PI);
+    CONTEND_EQUALITY(LIQUID_OK, presync_cccf_print(q));
+    presync_cccf_destroy(q);
+}
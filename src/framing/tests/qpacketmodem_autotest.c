@@ -82,6 +82,8 @@ void autotest_qpacketmodem_sqam32() { qpacketmodem_modulated(400,LIQUID_CRC_32,L
 void autotest_qpacketmodem_qam64()  { qpacketmodem_modulated(400,LIQUID_CRC_32,LIQUID_FEC_NONE,LIQUID_FEC_NONE, LIQUID_MODEM_QAM64);   }
 void autotest_qpacketmodem_sqam128(){ qpacketmodem_modulated(400,LIQUID_CRC_32,LIQUID_FEC_NONE,LIQUID_FEC_NONE, LIQUID_MODEM_SQAM128); }
 void autotest_qpacketmodem_qam256() { qpacketmodem_modulated(400,LIQUID_CRC_32,LIQUID_FEC_NONE,LIQUID_FEC_NONE, LIQUID_MODEM_QAM256);  }
+void autotest_qpacketmodem_ldpc12() { qpacketmodem_modulated(400,LIQUID_CRC_32,LIQUID_FEC_LDPC_R12,LIQUID_FEC_NONE, LIQUID_MODEM_QPSK); }
+void autotest_qpacketmodem_ldpc34() { qpacketmodem_modulated(400,LIQUID_CRC_32,LIQUID_FEC_NONE,LIQUID_FEC_LDPC_R34, LIQUID_MODEM_QAM16); }
 
 // test error vector magnitude estimation
 void autotest_qpacketmodem_evm()
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2007 - 2021 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <math.h>
+#include <sys/resource.h>
+#include "liquid.h"
+
+// Helper function to keep code base small
+void liquid_vmath_bench(struct rusage *     _start,
+                        struct rusage *     _finish,
+                        unsigned long int * _num_iterations,
+                        int                 _func,
+                        int                 _tier)
+{
+    unsigned int i, n = 1024;
+    float x[n], y[n], v[n], w[n];
+    float complex z[n];
+    for (i=0; i<n; i++) {
+        x[i] = _func == LIQUID_VMATH_LOG || _func == LIQUID_VMATH_LOG10 ?
+            0.01f + 10.0f*randf() : 10.0f*randnf();
+        y[i] = randnf();
+    }
+
+    // start trials
+    *_num_iterations /= n / 4;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+    getrusage(RUSAGE_SELF, _start);
+    unsigned long int t;
+    for (t=0; t<(*_num_iterations); t++) {
+        switch (_func) {
+        case LIQUID_VMATH_SINCOS: liquid_vsincosf(x, n, v, w, _tier); break;
+        case LIQUID_VMATH_CEXPJ:  liquid_vcexpjf (x, n, z,    _tier); break;
+        case LIQUID_VMATH_ATAN2:  liquid_vatan2f (y, x, n, v, _tier); break;
+        case LIQUID_VMATH_EXP:    liquid_vexpf   (x, n, v,    _tier); break;
+        case LIQUID_VMATH_LOG:    liquid_vlogf   (x, n, v,    _tier); break;
+        case LIQUID_VMATH_LOG10:  liquid_vlog10f (x, n, v,    _tier); break;
+        default:;
+        }
+        x[t % n] += 1e-6f;
+    }
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= n;
+}
+
+#define LIQUID_VMATH_BENCHMARK_API(FUNC,TIER)   \
+(   struct rusage *_start,                      \
+    struct rusage *_finish,                     \
+    unsigned long int *_num_iterations)         \
+{ liquid_vmath_bench(_start, _finish, _num_iterations, FUNC, TIER); }
+
+void benchmark_vmath_sincos_exact   LIQUID_VMATH_BENCHMARK_API(LIQUID_VMATH_SINCOS, LIQUID_VMATH_EXACT  )
+void benchmark_vmath_sincos_precise LIQUID_VMATH_BENCHMARK_API(LIQUID_VMATH_SINCOS, LIQUID_VMATH_PRECISE)
+void benchmark_vmath_sincos_fast    LIQUID_VMATH_BENCHMARK_API(LIQUID_VMATH_SINCOS, LIQUID_VMATH_FAST   )
+void benchmark_vmath_cexpj_exact    LIQUID_VMATH_BENCHMARK_API(LIQUID_VMATH_CEXPJ,  LIQUID_VMATH_EXACT  )
+void benchmark_vmath_cexpj_precise  LIQUID_VMATH_BENCHMARK_API(LIQUID_VMATH_CEXPJ,  LIQUID_VMATH_PRECISE)
+void benchmark_vmath_cexpj_fast     LIQUID_VMATH_BENCHMARK_API(LIQUID_VMATH_CEXPJ,  LIQUID_VMATH_FAST   )
+void benchmark_vmath_atan2_exact    LIQUID_VMATH_BENCHMARK_API(LIQUID_VMATH_ATAN2,  LIQUID_VMATH_EXACT  )
+void benchmark_vmath_atan2_precise  LIQUID_VMATH_BENCHMARK_API(LIQUID_VMATH_ATAN2,  LIQUID_VMATH_PRECISE)
+void benchmark_vmath_atan2_fast     LIQUID_VMATH_BENCHMARK_API(LIQUID_VMATH_ATAN2,  LIQUID_VMATH_FAST   )
+void benchmark_vmath_exp_exact      LIQUID_VMATH_BENCHMARK_API(LIQUID_VMATH_EXP,    LIQUID_VMATH_EXACT  )
+void benchmark_vmath_exp_precise    LIQUID_VMATH_BENCHMARK_API(LIQUID_VMATH_EXP,    LIQUID_VMATH_PRECISE)
+void benchmark_vmath_exp_fast       LIQUID_VMATH_BENCHMARK_API(LIQUID_VMATH_EXP,    LIQUID_VMATH_FAST   )
+void benchmark_vmath_log_exact      LIQUID_VMATH_BENCHMARK_API(LIQUID_VMATH_LOG,    LIQUID_VMATH_EXACT  )
+void benchmark_vmath_log_precise    LIQUID_VMATH_BENCHMARK_API(LIQUID_VMATH_LOG,    LIQUID_VMATH_PRECISE)
+void benchmark_vmath_log_fast       LIQUID_VMATH_BENCHMARK_API(LIQUID_VMATH_LOG,    LIQUID_VMATH_FAST   )
+void benchmark_vmath_log10_exact    LIQUID_VMATH_BENCHMARK_API(LIQUID_VMATH_LOG10,  LIQUID_VMATH_EXACT  )
+void benchmark_vmath_log10_precise  LIQUID_VMATH_BENCHMARK_API(LIQUID_VMATH_LOG10,  LIQUID_VMATH_PRECISE)
+void benchmark_vmath_log10_fast     LIQUID_VMATH_BENCHMARK_API(LIQUID_VMATH_LOG10,  LIQUID_VMATH_FAST   )
@@ -0,0 +1,494 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Vectorized math functions with selectable accuracy tiers
+//
+// Each function gathers its input into fixed-length, zero-padded blocks
+// so that every kernel loop has a constant trip count and is vectorized
+// by the compiler; quadrant and special-value fix-ups are branch-free
+// selects. The PRECISE kernels follow the classic Cody-Waite reduction
+// and polynomials (as in the Cephes library); the FAST kernels are
+// minimax fits of lower order on the same reduced ranges.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+
+#include "liquid.internal.h"
+
+// number of values processed by each kernel pass
+#define LIQUID_VMATH_BLOCK_LEN (64)
+
+// largest angle for which sine/cosine are reduced internally
+#define LIQUID_VMATH_SINCOS_MAX (8192.0f)
+
+// round to nearest integer (valid for |x| < 2^22)
+#define LIQUID_VMATH_RINT(x) (((x) + 12582912.0f) - 12582912.0f)
+
+// maximum error table [function][tier], see liquid.h for definitions
+static const float liquid_vmath_error[6][3] = {
+    //  EXACT       PRECISE     FAST
+    {   1.2e-7f,    2.4e-7f,    1.4e-5f},   // sincos
+    {   1.2e-7f,    2.4e-7f,    1.4e-5f},   // cexpj
+    {   4.8e-7f,    4.8e-7f,    9.0e-5f},   // atan2
+    {   1.2e-7f,    2.4e-7f,    1.1e-4f},   // exp
+    {   1.2e-7f,    2.4e-7f,    1.3e-4f},   // log
+    {   1.2e-7f,    2.4e-7f,    6.0e-5f},   // log10
+};
+
+float liquid_vmath_get_max_error(int _func,
+                                 int _tier)
+{
+    if (_func < LIQUID_VMATH_SINCOS || _func > LIQUID_VMATH_LOG10) {
+        liquid_error(LIQUID_EICONFIG,"liquid_vmath_get_max_error(), invalid function (%d)", _func);
+        return 0.0f;
+    } else if (_tier < LIQUID_VMATH_EXACT || _tier > LIQUID_VMATH_FAST) {
+        liquid_error(LIQUID_EICONFIG,"liquid_vmath_get_max_error(), invalid accuracy tier (%d)", _tier);
+        return 0.0f;
+    }
+    return liquid_vmath_error[_func][_tier];
+}
+
+// validate accuracy tier
+static int liquid_vmath_validate(const char * _name,
+                                 int          _tier)
+{
+    if (_tier < LIQUID_VMATH_EXACT || _tier > LIQUID_VMATH_FAST)
+        return liquid_error(LIQUID_EICONFIG,"%s(), invalid accuracy tier (%d)", _name, _tier);
+    return LIQUID_OK;
+}
+
+//
+// sine/cosine
+//
+
+// reduce by multiples of pi/2 (three-part Cody-Waite constants) and
+// evaluate sine and cosine polynomials on [-pi/4, pi/4]
+static void liquid_vsincosf_block(const float * _x,
+                                  float *       _s,
+                                  float *       _c,
+                                  int           _fast)
+{
+    float r[LIQUID_VMATH_BLOCK_LEN];
+    float s[LIQUID_VMATH_BLOCK_LEN];
+    float c[LIQUID_VMATH_BLOCK_LEN];
+    int   q[LIQUID_VMATH_BLOCK_LEN];
+    unsigned int i;
+    for (i=0; i<LIQUID_VMATH_BLOCK_LEN; i++) {
+        float k = LIQUID_VMATH_RINT(_x[i] * 0.63661977236758134f);
+        q[i] = (int)k;
+        r[i] = ((_x[i] - k*1.5703125f) - k*4.837512969970703125e-4f) - k*7.54978995489188216e-8f;
+    }
+
+    // evaluate polynomials (tier selected outside of loop)
+    if (_fast) {
+        for (i=0; i<LIQUID_VMATH_BLOCK_LEN; i++) {
+            float x = r[i], z = x*x;
+            s[i] = x + x*z*(-1.6662834e-1f + z*8.15299e-3f);
+            c[i] = 1.0f + z*(-4.9977631e-1f + z*4.048893e-2f);
+        }
+    } else {
+        for (i=0; i<LIQUID_VMATH_BLOCK_LEN; i++) {
+            float x = r[i], z = x*x;
+            s[i] = x + x*z*(-1.6666654611e-1f + z*(8.3321608736e-3f + z*-1.9515295891e-4f));
+            c[i] = 1.0f - 0.5f*z + z*z*(4.166664568298827e-2f + z*(-1.388731625493765e-3f + z*2.443315711809948e-5f));
+        }
+    }
+
+    // select quadrant
+    for (i=0; i<LIQUID_VMATH_BLOCK_LEN; i++) {
+        int   swap = q[i] & 1;
+        float sq = swap ? c[i] : s[i];
+        float cq = swap ? s[i] : c[i];
+        _s[i] = (q[i]   & 2) ? -sq : sq;
+        _c[i] = ((q[i]+1) & 2) ? -cq : cq;
+    }
+}
+
+int liquid_vsincosf_strided(const float * _x,
+                            unsigned int  _n,
+                            float *       _sin,
+                            float *       _cos,
+                            unsigned int  _stride,
+                            int           _tier)
+{
+    if (liquid_vmath_validate("liquid_vsincosf", _tier) != LIQUID_OK)
+        return LIQUID_EICONFIG;
+
+    unsigned int i, j;
+    if (_tier == LIQUID_VMATH_EXACT) {
+        for (i=0; i<_n; i++) {
+            float x = _x[i];
+            _sin[i*_stride] = sinf(x);
+            _cos[i*_stride] = cosf(x);
+        }
+        return LIQUID_OK;
+    }
+
+    float x[LIQUID_VMATH_BLOCK_LEN];
+    float s[LIQUID_VMATH_BLOCK_LEN];
+    float c[LIQUID_VMATH_BLOCK_LEN];
+    for (i=0; i<_n; i+=LIQUID_VMATH_BLOCK_LEN) {
+        unsigned int n = _n - i < LIQUID_VMATH_BLOCK_LEN ? _n - i : LIQUID_VMATH_BLOCK_LEN;
+        memmove(x, &_x[i], n*sizeof(float));
+        for (j=n; j<LIQUID_VMATH_BLOCK_LEN; j++)
+            x[j] = 0.0f;
+
+        // check for values outside of reduction range (or NaN)
+        int outside = 0;
+        for (j=0; j<LIQUID_VMATH_BLOCK_LEN; j++)
+            outside |= !(fabsf(x[j]) <= LIQUID_VMATH_SINCOS_MAX);
+
+        liquid_vsincosf_block(x, s, c, _tier == LIQUID_VMATH_FAST);
+
+        // fall back to standard library
+        if (outside) {
+            for (j=0; j<n; j++) {
+                if (!(fabsf(x[j]) <= LIQUID_VMATH_SINCOS_MAX)) {
+                    s[j] = sinf(x[j]);
+                    c[j] = cosf(x[j]);
+                }
+            }
+        }
+
+        for (j=0; j<n; j++) {
+            _sin[(i+j)*_stride] = s[j];
+            _cos[(i+j)*_stride] = c[j];
+        }
+    }
+    return LIQUID_OK;
+}
+
+int liquid_vsincosf(const float * _x,
+                    unsigned int  _n,
+                    float *       _sin,
+                    float *       _cos,
+                    int           _tier)
+{
+    return liquid_vsincosf_strided(_x, _n, _sin, _cos, 1, _tier);
+}
+
+int liquid_vcexpjf(const float *   _theta,
+                   unsigned int    _n,
+                   float complex * _y,
+                   int             _tier)
+{
+    // interleaved output: real (cosine) followed by imaginary (sine)
+    float * y = (float*)_y;
+    return liquid_vsincosf_strided(_theta, _n, y+1, y, 2, _tier);
+}
+
+//
+// arctangent
+//
+
+// reduce to z = min(|x|,|y|)/max(|x|,|y|) in [0,1], evaluate arctangent
+// polynomial and unfold octant
+static void liquid_vatan2f_block(const float * _y,
+                                 const float * _x,
+                                 float *       _theta,
+                                 int           _fast)
+{
+    float z[LIQUID_VMATH_BLOCK_LEN];
+    float a[LIQUID_VMATH_BLOCK_LEN];
+    unsigned int i;
+    for (i=0; i<LIQUID_VMATH_BLOCK_LEN; i++) {
+        float ax = fabsf(_x[i]);
+        float ay = fabsf(_y[i]);
+        float mx = ax > ay ? ax : ay;
+        float mn = ax > ay ? ay : ax;
+        z[i] = mx > 0 ? (mn == mx ? 1.0f : mn / mx) : 0.0f;
+    }
+
+    // evaluate polynomials (tier selected outside of loop)
+    if (_fast) {
+        for (i=0; i<LIQUID_VMATH_BLOCK_LEN; i++) {
+            float zz = z[i]*z[i];
+            a[i] = z[i]*(9.9921381e-1f + zz*(-3.2117494e-1f + zz*(1.4626438e-1f + zz*-3.898646e-2f)));
+        }
+    } else {
+        for (i=0; i<LIQUID_VMATH_BLOCK_LEN; i++) {
+            // reduce further to [0, tan(pi/8)]
+            int   big = z[i] > 0.4142135623730950f;
+            float zr  = big ? (z[i] - 1.0f) / (z[i] + 1.0f) : z[i];
+            float zz  = zr*zr;
+            float v   = zr + zr*zz*(-3.33329491539e-1f + zz*(1.99777106478e-1f +
+                             zz*(-1.38776856032e-1f + zz*8.05374449538e-2f)));
+            a[i] = big ? v + 0.78539816339744831f : v;
+        }
+    }
+
+    // unfold octant and quadrant, propagate NaN
+    for (i=0; i<LIQUID_VMATH_BLOCK_LEN; i++) {
+        float v = fabsf(_y[i]) > fabsf(_x[i]) ? 1.5707963267948966f - a[i] : a[i];
+        v = signbit(_x[i]) ? 3.1415926535897932f - v : v;
+        v = signbit(_y[i]) ? -v : v;
+        _theta[i] = (_x[i] != _x[i] || _y[i] != _y[i]) ? _x[i] + _y[i] : v;
+    }
+}
+
+int liquid_vatan2f_strided(const float * _y,
+                           const float * _x,
+                           unsigned int  _stride,
+                           unsigned int  _n,
+                           float *       _theta,
+                           int           _tier)
+{
+    if (liquid_vmath_validate("liquid_vatan2f", _tier) != LIQUID_OK)
+        return LIQUID_EICONFIG;
+
+    unsigned int i, j;
+    if (_tier == LIQUID_VMATH_EXACT) {
+        for (i=0; i<_n; i++)
+            _theta[i] = atan2f(_y[i*_stride], _x[i*_stride]);
+        return LIQUID_OK;
+    }
+
+    float x[LIQUID_VMATH_BLOCK_LEN];
+    float y[LIQUID_VMATH_BLOCK_LEN];
+    float t[LIQUID_VMATH_BLOCK_LEN];
+    for (i=0; i<_n; i+=LIQUID_VMATH_BLOCK_LEN) {
+        unsigned int n = _n - i < LIQUID_VMATH_BLOCK_LEN ? _n - i : LIQUID_VMATH_BLOCK_LEN;
+        for (j=0; j<n; j++) {
+            x[j] = _x[(i+j)*_stride];
+            y[j] = _y[(i+j)*_stride];
+        }
+        for (j=n; j<LIQUID_VMATH_BLOCK_LEN; j++) {
+            x[j] = 0.0f;
+            y[j] = 0.0f;
+        }
+        liquid_vatan2f_block(y, x, t, _tier == LIQUID_VMATH_FAST);
+        memmove(&_theta[i], t, n*sizeof(float));
+    }
+    return LIQUID_OK;
+}
+
+int liquid_vatan2f(const float * _y,
+                   const float * _x,
+                   unsigned int  _n,
+                   float *       _theta,
+                   int           _tier)
+{
+    return liquid_vatan2f_strided(_y, _x, 1, _n, _theta, _tier);
+}
+
+//
+// exponential
+//
+
+// reduce by multiples of ln(2), evaluate polynomial on [-ln(2)/2, ln(2)/2]
+// and scale by 2^k in two steps so that the full output range (including
+// subnormal values) is covered without overflowing the exponent field
+static void liquid_vexpf_block(const float * _x,
+                               float *       _y,
+                               int           _fast)
+{
+    float r[LIQUID_VMATH_BLOCK_LEN];
+    float p[LIQUID_VMATH_BLOCK_LEN];
+    union { float f[LIQUID_VMATH_BLOCK_LEN]; int32_t i[LIQUID_VMATH_BLOCK_LEN]; } s0, s1;
+    unsigned int i;
+    for (i=0; i<LIQUID_VMATH_BLOCK_LEN; i++) {
+        float x = _x[i];
+        x = x >  89.0f ?  89.0f : x;
+        x = x < -104.0f ? -104.0f : x;
+        float k = LIQUID_VMATH_RINT(x * 1.44269504088896341f);
+        r[i] = (x - k*0.693359375f) - k*-2.12194440e-4f;
+        int32_t ki = (int32_t)k;
+        int32_t k0 = ki / 2;
+        s0.i[i] = (k0      + 127) << 23;
+        s1.i[i] = (ki - k0 + 127) << 23;
+    }
+
+    // evaluate polynomials (tier selected outside of loop)
+    if (_fast) {
+        for (i=0; i<LIQUID_VMATH_BLOCK_LEN; i++)
+            p[i] = 1.0f + r[i]*(1.00019584f + r[i]*(5.041304e-1f + r[i]*1.6517976e-1f));
+    } else {
+        for (i=0; i<LIQUID_VMATH_BLOCK_LEN; i++) {
+            float x = r[i], z = x*x;
+            p[i] = 1.0f + x + z*(5.0000001201e-1f + x*(1.6666665459e-1f + x*(4.1665795894e-2f +
+                   x*(8.3334519073e-3f + x*(1.3981999507e-3f + x*1.9875691500e-4f)))));
+        }
+    }
+
+    // scale and handle overflow, underflow, and NaN
+    for (i=0; i<LIQUID_VMATH_BLOCK_LEN; i++) {
+        float y = (p[i] * s0.f[i]) * s1.f[i];
+        y = _x[i] >  88.72283935546875f ? INFINITY : y;
+        y = _x[i] < -103.97208404541015f ? 0.0f : y;
+        _y[i] = _x[i] != _x[i] ? _x[i] : y;
+    }
+}
+
+int liquid_vexpf(const float * _x,
+                 unsigned int  _n,
+                 float *       _y,
+                 int           _tier)
+{
+    if (liquid_vmath_validate("liquid_vexpf", _tier) != LIQUID_OK)
+        return LIQUID_EICONFIG;
+
+    unsigned int i, j;
+    if (_tier == LIQUID_VMATH_EXACT) {
+        for (i=0; i<_n; i++)
+            _y[i] = expf(_x[i]);
+        return LIQUID_OK;
+    }
+
+    float x[LIQUID_VMATH_BLOCK_LEN];
+    float y[LIQUID_VMATH_BLOCK_LEN];
+    for (i=0; i<_n; i+=LIQUID_VMATH_BLOCK_LEN) {
+        unsigned int n = _n - i < LIQUID_VMATH_BLOCK_LEN ? _n - i : LIQUID_VMATH_BLOCK_LEN;
+        memmove(x, &_x[i], n*sizeof(float));
+        for (j=n; j<LIQUID_VMATH_BLOCK_LEN; j++)
+            x[j] = 0.0f;
+        liquid_vexpf_block(x, y, _tier == LIQUID_VMATH_FAST);
+        memmove(&_y[i], y, n*sizeof(float));
+    }
+    return LIQUID_OK;
+}
+
+//
+// logarithm
+//
+
+// split into exponent and mantissa in [sqrt(1/2), sqrt(2)), evaluate
+// log(1+f) polynomial and add exponent scaled by ln(2) (two-part constant)
+static void liquid_vlogf_block(const float * _x,
+                               float *       _y,
+                               int           _fast)
+{
+    union { float f[LIQUID_VMATH_BLOCK_LEN]; int32_t i[LIQUID_VMATH_BLOCK_LEN]; } b;
+    int32_t e[LIQUID_VMATH_BLOCK_LEN];
+    float   f[LIQUID_VMATH_BLOCK_LEN];
+    float   k[LIQUID_VMATH_BLOCK_LEN];
+    float   y[LIQUID_VMATH_BLOCK_LEN];
+    unsigned int i;
+
+    // scale subnormal values into normal range
+    for (i=0; i<LIQUID_VMATH_BLOCK_LEN; i++) {
+        int sub = _x[i] < 1.17549435e-38f;
+        b.f[i] = sub ? _x[i] * 8388608.0f : _x[i];
+        e  [i] = sub ? -23 : 0;
+    }
+
+    // extract exponent and mantissa
+    for (i=0; i<LIQUID_VMATH_BLOCK_LEN; i++) {
+        e  [i] += ((b.i[i] >> 23) & 0xff) - 127;
+        b.i[i]  = (b.i[i] & 0x007fffff) | 0x3f800000;
+    }
+    for (i=0; i<LIQUID_VMATH_BLOCK_LEN; i++) {
+        float m   = b.f[i];
+        int   big = m > 1.41421356237309505f;
+        f[i] = (big ? 0.5f*m : m) - 1.0f;
+        k[i] = (float)(e[i] + big);
+    }
+
+    // evaluate polynomials (tier selected outside of loop)
+    if (_fast) {
+        for (i=0; i<LIQUID_VMATH_BLOCK_LEN; i++) {
+            float x = f[i], z = x*x;
+            y[i] = x + z*(-5.0227804e-1f + x*(3.5154856e-1f + x*-2.2298538e-1f)) + k[i]*0.69314718055994531f;
+        }
+    } else {
+        for (i=0; i<LIQUID_VMATH_BLOCK_LEN; i++) {
+            float x = f[i], z = x*x;
+            float v = x*z*(3.3333331174e-1f + x*(-2.4999993993e-1f + x*(2.0000714765e-1f +
+                      x*(-1.6668057665e-1f + x*(1.4249322787e-1f + x*(-1.2420140846e-1f +
+                      x*(1.1676998740e-1f + x*(-1.1514610310e-1f + x*7.0376836292e-2f))))))));
+            v += k[i]*-2.12194440e-4f - 0.5f*z;
+            y[i] = (x + v) + k[i]*0.693359375f;
+        }
+    }
+
+    // special values: log(0) = -inf, log(x<0) = NaN, log(inf) = inf, log(NaN) = NaN
+    for (i=0; i<LIQUID_VMATH_BLOCK_LEN; i++) {
+        float x = _x[i];
+        float v = x == 0.0f ? -INFINITY : y[i];
+        v = x <  0.0f ? NAN : v;
+        v = x == INFINITY ? x : v;
+        _y[i] = x != x ? x : v;
+    }
+}
+
+// compute natural logarithm, optionally scaled
+static int liquid_vlogf_scaled(const float * _x,
+                               unsigned int  _n,
+                               float *       _y,
+                               float         _scale,
+                               int           _tier)
+{
+    unsigned int i, j;
+    float x[LIQUID_VMATH_BLOCK_LEN];
+    float y[LIQUID_VMATH_BLOCK_LEN];
+    for (i=0; i<_n; i+=LIQUID_VMATH_BLOCK_LEN) {
+        unsigned int n = _n - i < LIQUID_VMATH_BLOCK_LEN ? _n - i : LIQUID_VMATH_BLOCK_LEN;
+        memmove(x, &_x[i], n*sizeof(float));
+        for (j=n; j<LIQUID_VMATH_BLOCK_LEN; j++)
+            x[j] = 1.0f;
+        liquid_vlogf_block(x, y, _tier == LIQUID_VMATH_FAST);
+        if (_scale != 1.0f) {
+            for (j=0; j<LIQUID_VMATH_BLOCK_LEN; j++)
+                y[j] *= _scale;
+        }
+        memmove(&_y[i], y, n*sizeof(float));
+    }
+    return LIQUID_OK;
+}
+
+int liquid_vlogf(const float * _x,
+                 unsigned int  _n,
+                 float *       _y,
+                 int           _tier)
+{
+    if (liquid_vmath_validate("liquid_vlogf", _tier) != LIQUID_OK)
+        return LIQUID_EICONFIG;
+
+    if (_tier == LIQUID_VMATH_EXACT) {
+        unsigned int i;
+        for (i=0; i<_n; i++)
+            _y[i] = logf(_x[i]);
+        return LIQUID_OK;
+    }
+    return liquid_vlogf_scaled(_x, _n, _y, 1.0f, _tier);
+}
+
+int liquid_vlog10f(const float * _x,
+                   unsigned int  _n,
+                   float *       _y,
+                   int           _tier)
+{
+    if (liquid_vmath_validate("liquid_vlog10f", _tier) != LIQUID_OK)
+        return LIQUID_EICONFIG;
+
+    if (_tier == LIQUID_VMATH_EXACT) {
+        unsigned int i;
+        for (i=0; i<_n; i++)
+            _y[i] = log10f(_x[i]);
+        return LIQUID_OK;
+    }
+    return liquid_vlogf_scaled(_x, _n, _y, 0.43429448190325182f, _tier);
+}
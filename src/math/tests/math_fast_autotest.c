@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) 2007 - 2023 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <math.h>
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+// number of test points (not a multiple of the internal block length)
+#define VMATH_NUM_TEST_POINTS (20011)
+
+// compute maximum error of vectorized math function against
+// double-precision reference
+//  _func   :   math function, e.g. LIQUID_VMATH_SINCOS
+//  _tier   :   accuracy tier, e.g. LIQUID_VMATH_FAST
+float liquid_vmath_test_error(int _func, int _tier)
+{
+    unsigned int i, n = VMATH_NUM_TEST_POINTS;
+    float * x = (float*)malloc(n*sizeof(float));
+    float * y = (float*)malloc(n*sizeof(float));
+    float * v = (float*)malloc(n*sizeof(float));
+    float * w = (float*)malloc(n*sizeof(float));
+    float complex * z = (float complex*)malloc(n*sizeof(float complex));
+    double e_max = 0.0;
+
+    switch (_func) {
+    case LIQUID_VMATH_SINCOS:
+    case LIQUID_VMATH_CEXPJ:
+        // mix of small and large angles
+        for (i=0; i<n; i++)
+            x[i] = (2*randf() - 1) * (i % 2 ? 8192.0f : 8.0f);
+        if (_func == LIQUID_VMATH_SINCOS) {
+            CONTEND_EQUALITY(liquid_vsincosf(x, n, v, w, _tier), LIQUID_OK);
+        } else {
+            CONTEND_EQUALITY(liquid_vcexpjf(x, n, z, _tier), LIQUID_OK);
+            for (i=0; i<n; i++) {
+                v[i] = cimagf(z[i]);
+                w[i] = crealf(z[i]);
+            }
+        }
+        for (i=0; i<n; i++) {
+            e_max = fmax(e_max, fabs(v[i] - sin((double)x[i])));
+            e_max = fmax(e_max, fabs(w[i] - cos((double)x[i])));
+        }
+        break;
+    case LIQUID_VMATH_ATAN2:
+        // all quadrants over a wide dynamic range
+        for (i=0; i<n; i++) {
+            x[i] = randnf() * powf(10.0f, 8*randf() - 4);
+            y[i] = randnf() * powf(10.0f, 8*randf() - 4);
+        }
+        CONTEND_EQUALITY(liquid_vatan2f(y, x, n, v, _tier), LIQUID_OK);
+        for (i=0; i<n; i++)
+            e_max = fmax(e_max, fabs(v[i] - atan2((double)y[i], (double)x[i])));
+        break;
+    case LIQUID_VMATH_EXP:
+        // normal output range
+        for (i=0; i<n; i++)
+            x[i] = 176.0f*randf() - 87.3f;
+        CONTEND_EQUALITY(liquid_vexpf(x, n, v, _tier), LIQUID_OK);
+        for (i=0; i<n; i++) {
+            double r = exp((double)x[i]);
+            e_max = fmax(e_max, fabs(v[i] - r) / r);
+        }
+        break;
+    case LIQUID_VMATH_LOG:
+    case LIQUID_VMATH_LOG10:
+        // normal input range, concentrated near unity
+        for (i=0; i<n; i++)
+            x[i] = i % 3 ? expf(176.0f*randf() - 87.0f) : 1.0f + 0.01f*(randf() - 0.5f);
+        if (_func == LIQUID_VMATH_LOG) {
+            CONTEND_EQUALITY(liquid_vlogf(x, n, v, _tier), LIQUID_OK);
+        } else {
+            CONTEND_EQUALITY(liquid_vlog10f(x, n, v, _tier), LIQUID_OK);
+        }
+        for (i=0; i<n; i++) {
+            double r = _func == LIQUID_VMATH_LOG ? log((double)x[i]) : log10((double)x[i]);
+            e_max = fmax(e_max, fabs(v[i] - r) / fmax(1.0, fabs(r)));
+        }
+        break;
+    default:;
+    }
+
+    free(x);
+    free(y);
+    free(v);
+    free(w);
+    free(z);
+    return (float)e_max;
+}
+
+// check error is within documented bounds
+void liquid_vmath_test(int _func, int _tier)
+{
+    float e_max = liquid_vmath_test_error(_func, _tier);
+    float e_tol = liquid_vmath_get_max_error(_func, _tier);
+    if (liquid_autotest_verbose)
+        printf("  func: %d, tier: %d, max error: %12.4e (tolerance: %12.4e)\n", _func, _tier, e_max, e_tol);
+    CONTEND_LESS_THAN(e_max, e_tol);
+}
+
+void autotest_vmath_sincos_exact()  { liquid_vmath_test(LIQUID_VMATH_SINCOS, LIQUID_VMATH_EXACT  ); }
+void autotest_vmath_sincos_precise(){ liquid_vmath_test(LIQUID_VMATH_SINCOS, LIQUID_VMATH_PRECISE); }
+void autotest_vmath_sincos_fast()   { liquid_vmath_test(LIQUID_VMATH_SINCOS, LIQUID_VMATH_FAST   ); }
+void autotest_vmath_cexpj_exact()   { liquid_vmath_test(LIQUID_VMATH_CEXPJ,  LIQUID_VMATH_EXACT  ); }
+void autotest_vmath_cexpj_precise() { liquid_vmath_test(LIQUID_VMATH_CEXPJ,  LIQUID_VMATH_PRECISE); }
+void autotest_vmath_cexpj_fast()    { liquid_vmath_test(LIQUID_VMATH_CEXPJ,  LIQUID_VMATH_FAST   ); }
+void autotest_vmath_atan2_exact()   { liquid_vmath_test(LIQUID_VMATH_ATAN2,  LIQUID_VMATH_EXACT  ); }
+void autotest_vmath_atan2_precise() { liquid_vmath_test(LIQUID_VMATH_ATAN2,  LIQUID_VMATH_PRECISE); }
+void autotest_vmath_atan2_fast()    { liquid_vmath_test(LIQUID_VMATH_ATAN2,  LIQUID_VMATH_FAST   ); }
+void autotest_vmath_exp_exact()     { liquid_vmath_test(LIQUID_VMATH_EXP,    LIQUID_VMATH_EXACT  ); }
+void autotest_vmath_exp_precise()   { liquid_vmath_test(LIQUID_VMATH_EXP,    LIQUID_VMATH_PRECISE); }
+void autotest_vmath_exp_fast()      { liquid_vmath_test(LIQUID_VMATH_EXP,    LIQUID_VMATH_FAST   ); }
+void autotest_vmath_log_exact()     { liquid_vmath_test(LIQUID_VMATH_LOG,    LIQUID_VMATH_EXACT  ); }
+void autotest_vmath_log_precise()   { liquid_vmath_test(LIQUID_VMATH_LOG,    LIQUID_VMATH_PRECISE); }
+void autotest_vmath_log_fast()      { liquid_vmath_test(LIQUID_VMATH_LOG,    LIQUID_VMATH_FAST   ); }
+void autotest_vmath_log10_exact()   { liquid_vmath_test(LIQUID_VMATH_LOG10,  LIQUID_VMATH_EXACT  ); }
+void autotest_vmath_log10_precise() { liquid_vmath_test(LIQUID_VMATH_LOG10,  LIQUID_VMATH_PRECISE); }
+void autotest_vmath_log10_fast()    { liquid_vmath_test(LIQUID_VMATH_LOG10,  LIQUID_VMATH_FAST   ); }
+
+// special values follow C library conventions in all tiers
+void autotest_vmath_special()
+{
+    int tier;
+    for (tier=LIQUID_VMATH_EXACT; tier<=LIQUID_VMATH_FAST; tier++) {
+        float x[6] = {0.0f, INFINITY, -INFINITY, NAN, -1.0f, 1.0f};
+        float y[6];
+
+        // exponential
+        liquid_vexpf(x, 6, y, tier);
+        CONTEND_EQUALITY(y[0], 1.0f);
+        CONTEND_EQUALITY(y[1], INFINITY);
+        CONTEND_EQUALITY(y[2], 0.0f);
+        CONTEND_EXPRESSION(isnan(y[3]));
+
+        // exponential overflow and underflow
+        float xe[2] = {100.0f, -200.0f};
+        liquid_vexpf(xe, 2, y, tier);
+        CONTEND_EQUALITY(y[0], INFINITY);
+        CONTEND_EQUALITY(y[1], 0.0f);
+
+        // logarithm
+        liquid_vlogf(x, 6, y, tier);
+        CONTEND_EQUALITY(y[0], -INFINITY);
+        CONTEND_EQUALITY(y[1], INFINITY);
+        CONTEND_EXPRESSION(isnan(y[2]));
+        CONTEND_EXPRESSION(isnan(y[3]));
+        CONTEND_EXPRESSION(isnan(y[4]));
+        CONTEND_EQUALITY(y[5], 0.0f);
+
+        // logarithm of subnormal value
+        x[0] = 1e-40f;
+        liquid_vlogf(x, 1, y, tier);
+        CONTEND_DELTA(y[0], logf(1e-40f), 1e-4f);
+
+        // sine/cosine of non-finite values
+        float s[6], c[6];
+        liquid_vsincosf(x, 6, s, c, tier);
+        CONTEND_EXPRESSION(isnan(s[1]) && isnan(c[1]));
+        CONTEND_EXPRESSION(isnan(s[3]) && isnan(c[3]));
+
+        // arctangent: signed zeros, infinities, and NaN
+        float ay[8] = { 0.0f, -0.0f,  0.0f, -0.0f, INFINITY,  INFINITY, NAN, 1.0f};
+        float ax[8] = { 0.0f,  0.0f, -0.0f, -0.0f, INFINITY, -INFINITY, 1.0f, NAN};
+        float t[8];
+        liquid_vatan2f(ay, ax, 8, t, tier);
+        unsigned int i;
+        for (i=0; i<6; i++)
+            CONTEND_DELTA(t[i], atan2f(ay[i], ax[i]), 1e-4f);
+        CONTEND_EXPRESSION(signbit(t[1]) && signbit(t[3]));
+        CONTEND_EXPRESSION(isnan(t[6]) && isnan(t[7]));
+    }
+}
+
+// block processing is independent of array length and allows in-place operation
+void autotest_vmath_inplace()
+{
+    unsigned int i, n = 131;
+    float x[n], y[n];
+    for (i=0; i<n; i++)
+        x[i] = 10*randf();
+    liquid_vexpf(x, n, y, LIQUID_VMATH_PRECISE);
+    liquid_vexpf(x, n, x, LIQUID_VMATH_PRECISE);
+    CONTEND_SAME_DATA(x, y, n*sizeof(float));
+    liquid_vlogf(x, n, y, LIQUID_VMATH_PRECISE);
+    for (i=0; i<n; i++)
+        liquid_vlogf(&x[i], 1, &x[i], LIQUID_VMATH_PRECISE);
+    CONTEND_SAME_DATA(x, y, n*sizeof(float));
+}
+
+void autotest_vmath_config()
+{
+#if LIQUID_STRICT_EXIT
+    AUTOTEST_WARN("skipping vmath config test with strict exit enabled\n");
+    return;
+#endif
+#if !LIQUID_SUPPRESS_ERROR_OUTPUT
+    fprintf(stderr,"warning: ignore potential errors here; checking for invalid configurations\n");
+#endif
+    float x = 0.5f, y;
+    float complex z;
+    CONTEND_INEQUALITY(liquid_vsincosf(&x, 1, &y, &y, -1), LIQUID_OK);
+    CONTEND_INEQUALITY(liquid_vcexpjf (&x, 1, &z,      3), LIQUID_OK);
+    CONTEND_INEQUALITY(liquid_vatan2f (&x, &x, 1, &y,  3), LIQUID_OK);
+    CONTEND_INEQUALITY(liquid_vexpf   (&x, 1, &y,      3), LIQUID_OK);
+    CONTEND_INEQUALITY(liquid_vlogf   (&x, 1, &y,      3), LIQUID_OK);
+    CONTEND_INEQUALITY(liquid_vlog10f (&x, 1, &y,      3), LIQUID_OK);
+    CONTEND_EQUALITY  (liquid_vmath_get_max_error(-1, LIQUID_VMATH_FAST), 0.0f);
+    CONTEND_EQUALITY  (liquid_vmath_get_max_error(LIQUID_VMATH_EXP, 3),   0.0f);
+}
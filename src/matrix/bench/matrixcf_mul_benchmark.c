@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <sys/resource.h>
+#include "liquid.h"
+
+// reference (unblocked) multiplication for comparison
+static void matrixcf_mul_ref(float complex * _x,
+                             float complex * _y,
+                             float complex * _z,
+                             unsigned int    _n)
+{
+    unsigned int r, c, i;
+    for (r=0; r<_n; r++) {
+        for (c=0; c<_n; c++) {
+            float complex sum = 0;
+            for (i=0; i<_n; i++)
+                sum += _x[r*_n+i] * _y[i*_n+c];
+            _z[r*_n+c] = sum;
+        }
+    }
+}
+
+// reference (unblocked) matrix-vector multiplication for comparison
+static void matrixcf_mulv_ref(float complex * _x,
+                              float complex * _y,
+                              float complex * _z,
+                              unsigned int    _n)
+{
+    unsigned int r, i;
+    for (r=0; r<_n; r++) {
+        float complex sum = 0;
+        for (i=0; i<_n; i++)
+            sum += _x[r*_n+i] * _y[i];
+        _z[r] = sum;
+    }
+}
+
+// Helper function to keep code base small
+//  _type   :   0 = matrixcf_mul, 1 = reference, 2 = matrixcf_transpose_mul,
+//              3 = matrixcf_mul (matrix-vector), 4 = reference (matrix-vector)
+void matrixcf_mul_bench(struct rusage *     _start,
+                        struct rusage *     _finish,
+                        unsigned long int * _num_iterations,
+                        unsigned int        _n,
+                        int                 _type)
+{
+    // normalize number of iterations
+    // time ~ _n ^ 3 (_n ^ 2 for matrix-vector)
+    *_num_iterations /= _type < 3 ? _n * _n * _n : _n * _n;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    float complex a[_n*_n];
+    float complex b[_n*_n];
+    float complex c[_n*_n];
+    unsigned long int i;
+    for (i=0; i<_n*_n; i++) {
+        a[i] = randnf() + _Complex_I*randnf();
+        b[i] = randnf() + _Complex_I*randnf();
+    }
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    switch (_type) {
+    case 0:
+        for (i=0; i<(*_num_iterations); i++)
+            matrixcf_mul(a,_n,_n,  b,_n,_n,  c,_n,_n);
+        break;
+    case 1:
+        for (i=0; i<(*_num_iterations); i++)
+            matrixcf_mul_ref(a, b, c, _n);
+        break;
+    case 2:
+        for (i=0; i<(*_num_iterations); i++)
+            matrixcf_transpose_mul(a, _n, _n, c);
+        break;
+    case 3:
+        for (i=0; i<(*_num_iterations); i++)
+            matrixcf_mul(a,_n,_n,  b,_n,1,  c,_n,1);
+        break;
+    default:
+        for (i=0; i<(*_num_iterations); i++)
+            matrixcf_mulv_ref(a, b, c, _n);
+    }
+    getrusage(RUSAGE_SELF, _finish);
+}
+
+#define MATRIXCF_MUL_BENCHMARK_API(N,TYPE)  \
+(   struct rusage *_start,                  \
+    struct rusage *_finish,                 \
+    unsigned long int *_num_iterations)     \
+{ matrixcf_mul_bench(_start, _finish, _num_iterations, N, TYPE); }
+
+void benchmark_matrixcf_mul_n8              MATRIXCF_MUL_BENCHMARK_API( 8, 0)
+void benchmark_matrixcf_mul_n16             MATRIXCF_MUL_BENCHMARK_API(16, 0)
+void benchmark_matrixcf_mul_n32             MATRIXCF_MUL_BENCHMARK_API(32, 0)
+void benchmark_matrixcf_mul_n64             MATRIXCF_MUL_BENCHMARK_API(64, 0)
+
+void benchmark_matrixcf_mul_ref_n8          MATRIXCF_MUL_BENCHMARK_API( 8, 1)
+void benchmark_matrixcf_mul_ref_n16         MATRIXCF_MUL_BENCHMARK_API(16, 1)
+void benchmark_matrixcf_mul_ref_n32         MATRIXCF_MUL_BENCHMARK_API(32, 1)
+void benchmark_matrixcf_mul_ref_n64         MATRIXCF_MUL_BENCHMARK_API(64, 1)
+
+void benchmark_matrixcf_transpose_mul_n16   MATRIXCF_MUL_BENCHMARK_API(16, 2)
+void benchmark_matrixcf_transpose_mul_n64   MATRIXCF_MUL_BENCHMARK_API(64, 2)
+
+void benchmark_matrixcf_mulv_n16            MATRIXCF_MUL_BENCHMARK_API(16, 3)
+void benchmark_matrixcf_mulv_n32            MATRIXCF_MUL_BENCHMARK_API(32, 3)
+void benchmark_matrixcf_mulv_n64            MATRIXCF_MUL_BENCHMARK_API(64, 3)
+
+void benchmark_matrixcf_mulv_ref_n16        MATRIXCF_MUL_BENCHMARK_API(16, 4)
+void benchmark_matrixcf_mulv_ref_n32        MATRIXCF_MUL_BENCHMARK_API(32, 4)
+void benchmark_matrixcf_mulv_ref_n64        MATRIXCF_MUL_BENCHMARK_API(64, 4)
+
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+#include <sys/resource.h>
+#include "liquid.h"
+
+// Helper function to keep code base small
+//  _type   :   0 = L/U factor-solve, 1 = Gauss-Jordan elimination,
+//              2 = Cholesky factor-solve
+void matrixf_lusolve_bench(struct rusage *     _start,
+                           struct rusage *     _finish,
+                           unsigned long int * _num_iterations,
+                           unsigned int        _n,
+                           int                 _type)
+{
+    // normalize number of iterations
+    // time ~ _n ^ 3
+    *_num_iterations /= _n * _n * _n / 8;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    unsigned long int i;
+
+    // generate symmetric positive-definite system, A = X^T X + I
+    float X[_n*_n];
+    float A[_n*_n];
+    float M[_n*(_n+1)];
+    float L[_n*_n];
+    float b[_n];
+    float x[_n];
+    unsigned int piv[_n];
+    for (i=0; i<_n*_n; i++)
+        X[i] = randnf();
+    matrixf_transpose_mul(X, _n, _n, A);
+    for (i=0; i<_n; i++) {
+        A[i*_n+i] += 1.0f;
+        b[i] = randnf();
+    }
+
+    // start trials
+    unsigned int r;
+    getrusage(RUSAGE_SELF, _start);
+    switch (_type) {
+    case 0:
+        for (i=0; i<(*_num_iterations); i++) {
+            memmove(L, A, sizeof(L));
+            matrixf_lufactor(L, _n, piv);
+            matrixf_lusolve(L, _n, piv, b, 1, x);
+        }
+        break;
+    case 1:
+        for (i=0; i<(*_num_iterations); i++) {
+            for (r=0; r<_n; r++) {
+                memmove(&M[r*(_n+1)], &A[r*_n], _n*sizeof(float));
+                M[r*(_n+1)+_n] = b[r];
+            }
+            matrixf_gjelim(M, _n, _n+1);
+        }
+        break;
+    default:
+        for (i=0; i<(*_num_iterations); i++) {
+            matrixf_chol(A, _n, L);
+            matrixf_cholsolve(L, _n, b, 1, x);
+        }
+    }
+    getrusage(RUSAGE_SELF, _finish);
+}
+
+#define MATRIXF_LUSOLVE_BENCHMARK_API(N,TYPE)   \
+(   struct rusage *_start,                      \
+    struct rusage *_finish,                     \
+    unsigned long int *_num_iterations)         \
+{ matrixf_lusolve_bench(_start, _finish, _num_iterations, N, TYPE); }
+
+void benchmark_matrixf_lusolve_n16      MATRIXF_LUSOLVE_BENCHMARK_API(16, 0)
+void benchmark_matrixf_lusolve_n32      MATRIXF_LUSOLVE_BENCHMARK_API(32, 0)
+void benchmark_matrixf_lusolve_n64      MATRIXF_LUSOLVE_BENCHMARK_API(64, 0)
+
+void benchmark_matrixf_gjelim_n16       MATRIXF_LUSOLVE_BENCHMARK_API(16, 1)
+void benchmark_matrixf_gjelim_n32       MATRIXF_LUSOLVE_BENCHMARK_API(32, 1)
+void benchmark_matrixf_gjelim_n64       MATRIXF_LUSOLVE_BENCHMARK_API(64, 1)
+
+void benchmark_matrixf_cholsolve_n16    MATRIXF_LUSOLVE_BENCHMARK_API(16, 2)
+void benchmark_matrixf_cholsolve_n32    MATRIXF_LUSOLVE_BENCHMARK_API(32, 2)
+void benchmark_matrixf_cholsolve_n64    MATRIXF_LUSOLVE_BENCHMARK_API(64, 2)
+
@@ -25,10 +25,15 @@
 //
 
 #include <math.h>
+#include <string.h>
+
 #include "liquid.internal.h"
 
 #define DEBUG_MATRIX_CHOL 0
 
+// number of columns per panel in blocked Cholesky decomposition
+#define MATRIX_CHOL_NB  (16)
+
 // Compute Cholesky decomposition of a symmetric/Hermitian positive-
 // definite matrix as A = L * L^T
 //  _a      :   input square matrix [size: _n x _n]
@@ -38,61 +43,127 @@ int MATRIX(_chol)(T *          _a,
                   unsigned int _n,
                   T *          _l)
 {
-    // reset L
+    // copy lower triangle of A into L, clearing upper triangle
     unsigned int i;
-    for (i=0; i<_n*_n; i++)
-        _l[i] = 0.0;
-
     unsigned int j;
+    for (i=0; i<_n; i++) {
+        for (j=0; j<_n; j++)
+            matrix_access(_l,_n,_n,i,j) = j <= i ? matrix_access(_a,_n,_n,i,j) : 0;
+    }
+
+    // factor columns in panels of MATRIX_CHOL_NB; contributions from
+    // previous panels are removed with the blocked multiplication kernel
+    unsigned int j0;
     unsigned int k;
     T  a_jj;
-    T  l_jj;
+    TP l_jj;
     T  l_ik;
     T  l_jk;
     TP t0;
     T  t1;
-    for (j=0; j<_n; j++) {
-        // assert that a_jj is real, positive
-        a_jj = matrix_access(_a,_n,_n,j,j);
-        if ( creal(a_jj) < 0.0 )
-            return liquid_error(LIQUID_EICONFIG,"matrix_chol(), matrix is not positive definite (real{A[%u,%u]} = %12.4e < 0)",j,j,creal(a_jj));
+    for (j0=0; j0<_n; j0+=MATRIX_CHOL_NB) {
+        unsigned int jb = _n - j0 < MATRIX_CHOL_NB ? _n - j0 : MATRIX_CHOL_NB;
+        for (j=j0; j<j0+jb; j++) {
+            // assert that a_jj is real, positive
+            a_jj = matrix_access(_a,_n,_n,j,j);
+            if ( creal(a_jj) < 0.0 )
+                return liquid_error(LIQUID_EICONFIG,"matrix_chol(), matrix is not positive definite (real{A[%u,%u]} = %12.4e < 0)",j,j,creal(a_jj));
 #if T_COMPLEX
-        if ( fabs(cimag(a_jj)) > 0.0 )
-            return liquid_error(LIQUID_EICONFIG,"matrix_chol(), matrix is not positive definite (|imag{A[%u,%u]}| = %12.4e > 0)",j,j,fabs(cimag(a_jj)));
+            if ( fabs(cimag(a_jj)) > 0.0 )
+                return liquid_error(LIQUID_EICONFIG,"matrix_chol(), matrix is not positive definite (|imag{A[%u,%u]}| = %12.4e > 0)",j,j,fabs(cimag(a_jj)));
 #endif
 
-        // compute l_jj and store it in output matrix
-        t0 = 0.0;
-        for (k=0; k<j; k++) {
-            l_jk = matrix_access(_l,_n,_n,j,k);
+            // compute l_jj and store it in output matrix
+            t0 = 0.0;
+            for (k=j0; k<j; k++) {
+                l_jk = matrix_access(_l,_n,_n,j,k);
 #if T_COMPLEX
-            t0 += creal( l_jk * conj(l_jk) );
+                t0 += creal( l_jk * conj(l_jk) );
 #else
-            t0 += l_jk * l_jk;
+                t0 += l_jk * l_jk;
 #endif
-        }
-        // test to ensure a_jj > t0
-        if ( creal(a_jj) < t0 )
-            return liquid_error(LIQUID_EICONFIG,"matrix_chol(), matrix is not positive definite (real{A[%u,%u]} = %12.4e < %12.4e)",j,j,creal(a_jj),t0);
+            }
+            // test to ensure a_jj > t0, including previous panels
+            TP d = creal(matrix_access(_l,_n,_n,j,j)) - t0;
+            if ( d < 0 )
+                return liquid_error(LIQUID_EICONFIG,"matrix_chol(), matrix is not positive definite (real{A[%u,%u]} = %12.4e < %12.4e)",j,j,creal(a_jj),creal(a_jj)-d);
 
-        l_jj = sqrt( a_jj - t0 );
-        matrix_access(_l,_n,_n,j,j) = l_jj;
+            l_jj = sqrt(d);
+            matrix_access(_l,_n,_n,j,j) = l_jj;
 
-        for (i=j+1; i<_n; i++) {
-            t1 = matrix_access(_a,_n,_n,i,j);
-            for (k=0; k<j; k++) {
-                l_ik = matrix_access(_l,_n,_n,i,k);
-                l_jk = matrix_access(_l,_n,_n,j,k);
+            TP g = 1 / l_jj;
+            for (i=j+1; i<_n; i++) {
+                t1 = matrix_access(_l,_n,_n,i,j);
+                for (k=j0; k<j; k++) {
+                    l_ik = matrix_access(_l,_n,_n,i,k);
+                    l_jk = matrix_access(_l,_n,_n,j,k);
 #if T_COMPLEX
-                t1 -= l_ik * conj(l_jk);
+                    t1 -= l_ik * conj(l_jk);
 #else
-                t1 -= l_ik * l_jk;
+                    t1 -= l_ik * l_jk;
 #endif
+                }
+                matrix_access(_l,_n,_n,i,j) = t1 * g;
             }
-            // TODO : store inverse of l_jj to reduce number of divisions
-            matrix_access(_l,_n,_n,i,j) = t1 / l_jj;
         }
+
+        // update trailing sub-matrix: A22 -= L21 L21^H (lower triangle)
+        unsigned int m = _n - j0 - jb;
+        if (m == 0)
+            break;
+        T * l21 = &matrix_access(_l,_n,_n,j0+jb,j0);
+        int rc = MATRIX(_gemm)(m, m, jb,
+                               l21, _n, LIQUID_MATRIX_GEMM_N,
+                               l21, _n, LIQUID_MATRIX_GEMM_H,
+                               &matrix_access(_l,_n,_n,j0+jb,j0+jb), _n,
+                               LIQUID_MATRIX_GEMM_SUB | LIQUID_MATRIX_GEMM_LOWER);
+        if (rc != LIQUID_OK)
+            return rc;
+    }
+    return LIQUID_OK;
+}
+
+// solve A X = B using the Cholesky factor L from MATRIX(_chol)
+//  _l      :   lower-triangular factor [size: _n x _n]
+//  _n      :   system dimension
+//  _b      :   right-hand side [size: _n x _k]
+//  _k      :   number of right-hand sides
+//  _x      :   solution [size: _n x _k], may be the same as _b
+int MATRIX(_cholsolve)(T *          _l,
+                       unsigned int _n,
+                       T *          _b,
+                       unsigned int _k,
+                       T *          _x)
+{
+    if (_x != _b)
+        memmove(_x, _b, _n*_k*sizeof(T));
+
+    // forward substitution: L Y = B
+    unsigned int i, j, c;
+    for (i=0; i<_n; i++) {
+        for (j=0; j<i; j++) {
+            T l_ij = matrix_access(_l,_n,_n,i,j);
+            for (c=0; c<_k; c++)
+                matrix_access(_x,_n,_k,i,c) -= l_ij * matrix_access(_x,_n,_k,j,c);
+        }
+        T g = 1 / matrix_access(_l,_n,_n,i,i);
+        for (c=0; c<_k; c++)
+            matrix_access(_x,_n,_k,i,c) *= g;
+    }
+
+    // back substitution: L^H X = Y
+    for (i=_n; i>0; i--) {
+        unsigned int r = i-1;
+        for (j=r+1; j<_n; j++) {
+            T l_jr = conj(matrix_access(_l,_n,_n,j,r));
+            for (c=0; c<_k; c++)
+                matrix_access(_x,_n,_k,r,c) -= l_jr * matrix_access(_x,_n,_k,j,c);
+        }
+        T g = 1 / conj(matrix_access(_l,_n,_n,r,r));
+        for (c=0; c<_k; c++)
+            matrix_access(_x,_n,_k,r,c) *= g;
     }
     return LIQUID_OK;
 }
 
+#undef MATRIX_CHOL_NB
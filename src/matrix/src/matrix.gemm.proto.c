@@ -0,0 +1,281 @@
+/*
+ * Copyright (c) 2007 - 2022 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Blocked, register-tiled matrix multiplication kernel
+//
+// The operands are packed into contiguous panels (cache blocking over
+// MC x KC and KC x NC sub-matrices) and each MR x NR tile of the output
+// is accumulated in fixed-size arrays of the primitive type so that the
+// compiler can keep it in vector registers. Complex panels are stored
+// with real and imaginary parts in separate lanes to avoid the overhead
+// of complex multiplication.
+//
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "liquid.internal.h"
+
+// register tile size (output rows x columns)
+#define MATRIX_GEMM_MR  (4)
+#if T_COMPLEX
+#  define MATRIX_GEMM_NR  (4)
+#  define MATRIX_GEMM_NP  (2)   // primitive values per element
+#else
+#  define MATRIX_GEMM_NR  (8)
+#  define MATRIX_GEMM_NP  (1)   // primitive values per element
+#endif
+
+// fully unroll loops over the register tile so that the accumulators
+// are assigned to (vector) registers rather than kept on the stack
+#if defined(__GNUC__)
+#  define MATRIX_GEMM_UNROLL _Pragma("GCC unroll 8")
+#else
+#  define MATRIX_GEMM_UNROLL
+#endif
+
+// cache block sizes
+#define MATRIX_GEMM_MC  (64)
+#define MATRIX_GEMM_KC  (128)
+#define MATRIX_GEMM_NC  (128)
+
+// maximum size of packed panels kept on the stack (primitive values);
+// larger products allocate their panels on the heap
+#define MATRIX_GEMM_STACK_LEN   (4096)
+
+// pack _kc columns of _nr rows of a matrix into panels of _w rows: for
+// each panel and each column, _w real values (followed by _w imaginary
+// values for complex types); rows beyond _nr are set to zero
+//  _x      :   input matrix, element (r,c) at _x[r*_rs + c*_cs]
+//  _rs     :   row stride
+//  _cs     :   column stride
+//  _conj   :   conjugate elements?
+//  _nr     :   number of rows to pack
+//  _kc     :   number of columns to pack
+//  _w      :   panel width (number of rows)
+//  _xp     :   output packed panels
+static void MATRIX(_gemm_pack)(T *          _x,
+                               unsigned int _rs,
+                               unsigned int _cs,
+                               int          _conj,
+                               unsigned int _nr,
+                               unsigned int _kc,
+                               unsigned int _w,
+                               TP *         _xp)
+{
+    unsigned int ir, i, p;
+    for (ir=0; ir<_nr; ir+=_w) {
+        unsigned int w = _nr - ir < _w ? _nr - ir : _w;
+        for (p=0; p<_kc; p++) {
+            T * x = _x + ir*_rs + p*_cs;
+            for (i=0; i<w; i++) {
+#if T_COMPLEX
+                _xp[i]      = creal(x[i*_rs]);
+                _xp[_w + i] = _conj ? -cimag(x[i*_rs]) : cimag(x[i*_rs]);
+#else
+                _xp[i]      = x[i*_rs];
+#endif
+            }
+            for (i=w; i<_w; i++) {
+                _xp[i] = 0;
+#if T_COMPLEX
+                _xp[_w + i] = 0;
+#endif
+            }
+            _xp += MATRIX_GEMM_NP*_w;
+        }
+    }
+}
+
+// compute MR x NR tile from packed panels, _acc = ap * bp
+static void MATRIX(_gemm_kernel)(unsigned int _kc,
+                                 const TP *   _ap,
+                                 const TP *   _bp,
+                                 TP *         _acc)
+{
+    unsigned int i, j, p;
+#if T_COMPLEX
+    TP acc_re[MATRIX_GEMM_MR][MATRIX_GEMM_NR];
+    TP acc_im[MATRIX_GEMM_MR][MATRIX_GEMM_NR];
+    for (i=0; i<MATRIX_GEMM_MR; i++) {
+        for (j=0; j<MATRIX_GEMM_NR; j++) {
+            acc_re[i][j] = 0;
+            acc_im[i][j] = 0;
+        }
+    }
+    for (p=0; p<_kc; p++) {
+        const TP * a_re = _ap;
+        const TP * a_im = _ap + MATRIX_GEMM_MR;
+        const TP * b_re = _bp;
+        const TP * b_im = _bp + MATRIX_GEMM_NR;
+        MATRIX_GEMM_UNROLL
+        for (i=0; i<MATRIX_GEMM_MR; i++) {
+            MATRIX_GEMM_UNROLL
+            for (j=0; j<MATRIX_GEMM_NR; j++) {
+                acc_re[i][j] += a_re[i]*b_re[j] - a_im[i]*b_im[j];
+                acc_im[i][j] += a_re[i]*b_im[j] + a_im[i]*b_re[j];
+            }
+        }
+        _ap += 2*MATRIX_GEMM_MR;
+        _bp += 2*MATRIX_GEMM_NR;
+    }
+    for (i=0; i<MATRIX_GEMM_MR; i++) {
+        for (j=0; j<MATRIX_GEMM_NR; j++) {
+            _acc[2*(i*MATRIX_GEMM_NR+j)+0] = acc_re[i][j];
+            _acc[2*(i*MATRIX_GEMM_NR+j)+1] = acc_im[i][j];
+        }
+    }
+#else
+    TP acc[MATRIX_GEMM_MR][MATRIX_GEMM_NR];
+    for (i=0; i<MATRIX_GEMM_MR; i++) {
+        for (j=0; j<MATRIX_GEMM_NR; j++)
+            acc[i][j] = 0;
+    }
+    for (p=0; p<_kc; p++) {
+        MATRIX_GEMM_UNROLL
+        for (i=0; i<MATRIX_GEMM_MR; i++) {
+            MATRIX_GEMM_UNROLL
+            for (j=0; j<MATRIX_GEMM_NR; j++)
+                acc[i][j] += _ap[i]*_bp[j];
+        }
+        _ap += MATRIX_GEMM_MR;
+        _bp += MATRIX_GEMM_NR;
+    }
+    for (i=0; i<MATRIX_GEMM_MR; i++) {
+        for (j=0; j<MATRIX_GEMM_NR; j++)
+            _acc[i*MATRIX_GEMM_NR+j] = acc[i][j];
+    }
+#endif
+}
+
+// general matrix multiply, C = op(A) * op(B) or C -= op(A) * op(B)
+int MATRIX(_gemm)(unsigned int _m,
+                  unsigned int _n,
+                  unsigned int _k,
+                  T *          _a,
+                  unsigned int _lda,
+                  int          _opa,
+                  T *          _b,
+                  unsigned int _ldb,
+                  int          _opb,
+                  T *          _c,
+                  unsigned int _ldc,
+                  int          _flags)
+{
+    int sub   = _flags & LIQUID_MATRIX_GEMM_SUB;
+    int lower = _flags & LIQUID_MATRIX_GEMM_LOWER;
+    unsigned int i, j;
+
+    // empty inner dimension: product is zero
+    if (_k == 0) {
+        for (i=0; i<_m && !sub; i++) {
+            for (j=0; j<_n && (!lower || j<=i); j++)
+                _c[i*_ldc + j] = 0;
+        }
+        return LIQUID_OK;
+    }
+
+    // packed panels: on the stack for small products, on the heap otherwise
+    unsigned int mc_max = _m < MATRIX_GEMM_MC ? _m : MATRIX_GEMM_MC;
+    unsigned int nc_max = _n < MATRIX_GEMM_NC ? _n : MATRIX_GEMM_NC;
+    unsigned int kc_max = _k < MATRIX_GEMM_KC ? _k : MATRIX_GEMM_KC;
+    mc_max = ((mc_max + MATRIX_GEMM_MR - 1) / MATRIX_GEMM_MR) * MATRIX_GEMM_MR;
+    nc_max = ((nc_max + MATRIX_GEMM_NR - 1) / MATRIX_GEMM_NR) * MATRIX_GEMM_NR;
+    unsigned int panel_len = MATRIX_GEMM_NP*(mc_max + nc_max)*kc_max;
+    TP panel_stack[MATRIX_GEMM_STACK_LEN];
+    TP * ap = panel_stack;
+    if (panel_len > MATRIX_GEMM_STACK_LEN) {
+        ap = (TP*) malloc(panel_len*sizeof(TP));
+        if (ap == NULL)
+            return liquid_error(LIQUID_EIMEM,"matrix_gemm(), could not allocate memory");
+    }
+    TP * bp = ap + MATRIX_GEMM_NP*mc_max*kc_max;
+
+    // row/column strides of op(A), op(B)
+    unsigned int ars = _opa == LIQUID_MATRIX_GEMM_N ? _lda : 1;
+    unsigned int acs = _opa == LIQUID_MATRIX_GEMM_N ? 1 : _lda;
+    unsigned int brs = _opb == LIQUID_MATRIX_GEMM_N ? _ldb : 1;
+    unsigned int bcs = _opb == LIQUID_MATRIX_GEMM_N ? 1 : _ldb;
+
+    TP acc[MATRIX_GEMM_NP*MATRIX_GEMM_MR*MATRIX_GEMM_NR];
+    unsigned int jc, pc, ic, jr, ir;
+    for (jc=0; jc<_n; jc+=MATRIX_GEMM_NC) {
+        unsigned int nc = _n - jc < MATRIX_GEMM_NC ? _n - jc : MATRIX_GEMM_NC;
+        for (pc=0; pc<_k; pc+=MATRIX_GEMM_KC) {
+            unsigned int kc = _k - pc < MATRIX_GEMM_KC ? _k - pc : MATRIX_GEMM_KC;
+            // pack columns of op(B) as rows of panels
+            MATRIX(_gemm_pack)(_b + jc*bcs + pc*brs, bcs, brs, _opb == LIQUID_MATRIX_GEMM_H,
+                               nc, kc, MATRIX_GEMM_NR, bp);
+            for (ic=0; ic<_m; ic+=MATRIX_GEMM_MC) {
+                unsigned int mc = _m - ic < MATRIX_GEMM_MC ? _m - ic : MATRIX_GEMM_MC;
+                // skip blocks entirely above the diagonal
+                if (lower && ic + mc <= jc)
+                    continue;
+                MATRIX(_gemm_pack)(_a + ic*ars + pc*acs, ars, acs, _opa == LIQUID_MATRIX_GEMM_H,
+                                   mc, kc, MATRIX_GEMM_MR, ap);
+                for (jr=0; jr<nc; jr+=MATRIX_GEMM_NR) {
+                    for (ir=0; ir<mc; ir+=MATRIX_GEMM_MR) {
+                        unsigned int r0 = ic + ir;
+                        unsigned int c0 = jc + jr;
+                        if (lower && c0 >= r0 + MATRIX_GEMM_MR)
+                            continue;
+                        MATRIX(_gemm_kernel)(kc,
+                                ap + MATRIX_GEMM_NP*ir*kc,
+                                bp + MATRIX_GEMM_NP*jr*kc,
+                                acc);
+
+                        // store valid portion of tile
+                        unsigned int mr = mc - ir < MATRIX_GEMM_MR ? mc - ir : MATRIX_GEMM_MR;
+                        unsigned int nr = nc - jr < MATRIX_GEMM_NR ? nc - jr : MATRIX_GEMM_NR;
+                        for (i=0; i<mr; i++) {
+                            TP * c  = (TP*) (_c + (r0+i)*_ldc + c0);
+                            TP * t  = acc + MATRIX_GEMM_NP*i*MATRIX_GEMM_NR;
+                            unsigned int n = MATRIX_GEMM_NP*nr;
+                            if (lower && c0 + nr > r0 + i + 1)
+                                n = (r0 + i + 1 > c0) ? MATRIX_GEMM_NP*(r0 + i + 1 - c0) : 0;
+                            if (sub) {
+                                for (j=0; j<n; j++) c[j] -= t[j];
+                            } else if (pc == 0) {
+                                for (j=0; j<n; j++) c[j]  = t[j];
+                            } else {
+                                for (j=0; j<n; j++) c[j] += t[j];
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+    if (ap != panel_stack)
+        free(ap);
+    return LIQUID_OK;
+}
+
+#undef MATRIX_GEMM_MR
+#undef MATRIX_GEMM_NR
+#undef MATRIX_GEMM_NP
+#undef MATRIX_GEMM_MC
+#undef MATRIX_GEMM_KC
+#undef MATRIX_GEMM_NC
+#undef MATRIX_GEMM_STACK_LEN
+#undef MATRIX_GEMM_UNROLL
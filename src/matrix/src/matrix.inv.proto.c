@@ -24,6 +24,8 @@
 // Matrix inverse method definitions
 //
 
+#include <string.h>
+
 #include "liquid.internal.h"
 
 int MATRIX(_inv)(T * _X, unsigned int _XR, unsigned int _XC)
@@ -32,47 +34,16 @@ int MATRIX(_inv)(T * _X, unsigned int _XR, unsigned int _XC)
     if (_XR != _XC )
         return liquid_error(LIQUID_EICONFIG,"matrix_inv(), invalid dimensions");
 
-    // X:
-    //  x11 x12 ... x1n
-    //  x21 x22 ... x2n
-    //  ...
-    //  xn1 xn2 ... xnn
-
-    // allocate temporary memory
-    T x[2*_XR*_XC];
-    unsigned int xr = _XR;
-    unsigned int xc = _XC*2;
-
-    // x:
-    //  x11 x12 ... x1n 1   0   ... 0
-    //  x21 x22 ... x2n 0   1   ... 0
-    //  ...
-    //  xn1 xn2 ... xnn 0   0   ... 1
-    unsigned int r,c;
-    for (r=0; r<_XR; r++) {
-        // copy matrix elements
-        for (c=0; c<_XC; c++)
-            matrix_access(x,xr,xc,r,c) = matrix_access(_X,_XR,_XC,r,c);
-
-        // append identity matrix
-        for (c=0; c<_XC; c++)
-            matrix_access(x,xr,xc,r,_XC+c) = (r==c) ? 1 : 0;
-    }
-
-    // perform Gauss-Jordan elimination on x
-    // x:
-    //  1   0   ... 0   y11 y12 ... y1n
-    //  0   1   ... 0   y21 y22 ... y2n
-    //  ...
-    //  0   0   ... 1   yn1 yn2 ... ynn
-    MATRIX(_gjelim)(x,xr,xc);
-
-    // copy result from right half of x
-    for (r=0; r<_XR; r++) {
-        for (c=0; c<_XC; c++)
-            matrix_access(_X,_XR,_XC,r,c) = matrix_access(x,xr,xc,r,_XC+c);
-    }
-    return LIQUID_OK;
+    // compute L/U factorization of a copy of the input, then solve
+    // for each column of the identity matrix
+    T x[_XR*_XC];
+    unsigned int piv[_XR];
+    memmove(x, _X, _XR*_XC*sizeof(T));
+    int rc = MATRIX(_lufactor)(x, _XR, piv);
+    if (rc != LIQUID_OK)
+        return rc;
+    MATRIX(_eye)(_X, _XR);
+    return MATRIX(_lusolve)(x, _XR, piv, _X, _XC, _X);
 }
 
 // Gauss-Jordan elmination
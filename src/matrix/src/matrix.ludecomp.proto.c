@@ -24,6 +24,8 @@
 // Matrix L/U decomposition method definitions
 //
 
+#include <string.h>
+
 #include "liquid.internal.h"
 
 // L/U/P decomposition, Crout's method
@@ -138,3 +140,118 @@ int MATRIX(_ludecomp_doolittle)(T *          _x,
     return MATRIX(_eye)(_p,n);
 }
 
+
+// number of columns per panel in blocked L/U factorization
+#define MATRIX_LU_NB    (16)
+
+// L/U factorization with partial pivoting, computed in place as
+// P A = L U where L is unit lower triangular (stored below diagonal)
+// and U is upper triangular. Columns are factored in panels of
+// MATRIX_LU_NB; the trailing sub-matrix is updated with the blocked
+// multiplication kernel.
+int MATRIX(_lufactor)(T *            _a,
+                      unsigned int   _n,
+                      unsigned int * _piv)
+{
+    unsigned int i, j, c, j0;
+    for (j0=0; j0<_n; j0+=MATRIX_LU_NB) {
+        unsigned int jb = _n - j0 < MATRIX_LU_NB ? _n - j0 : MATRIX_LU_NB;
+
+        // factor panel (columns j0 to j0+jb-1)
+        for (j=j0; j<j0+jb; j++) {
+            // find pivot row based on maximum element along column
+            unsigned int r_opt = j;
+            TP v_max = T_ABS( matrix_access(_a,_n,_n,j,j) );
+            for (i=j+1; i<_n; i++) {
+                TP v = T_ABS( matrix_access(_a,_n,_n,i,j) );
+                if (v > v_max) {
+                    r_opt = i;
+                    v_max = v;
+                }
+            }
+
+            // if the maximum is zero, matrix is singular
+            if (v_max == 0)
+                return liquid_error(LIQUID_EICONFIG,"matrix_lufactor(), matrix singular to machine precision");
+
+            _piv[j] = r_opt;
+            MATRIX(_swaprows)(_a,_n,_n,j,r_opt);
+
+            // compute multipliers and update remainder of panel
+            T g = 1 / matrix_access(_a,_n,_n,j,j);
+            for (i=j+1; i<_n; i++) {
+                T l_ij = matrix_access(_a,_n,_n,i,j) * g;
+                matrix_access(_a,_n,_n,i,j) = l_ij;
+                for (c=j+1; c<j0+jb; c++)
+                    matrix_access(_a,_n,_n,i,c) -= l_ij * matrix_access(_a,_n,_n,j,c);
+            }
+        }
+
+        unsigned int m = _n - j0 - jb;
+        if (m == 0)
+            break;
+
+        // compute block row of U: solve L11 U12 = A12
+        for (j=j0; j<j0+jb; j++) {
+            for (i=j+1; i<j0+jb; i++) {
+                T l_ij = matrix_access(_a,_n,_n,i,j);
+                for (c=j0+jb; c<_n; c++)
+                    matrix_access(_a,_n,_n,i,c) -= l_ij * matrix_access(_a,_n,_n,j,c);
+            }
+        }
+
+        // update trailing sub-matrix: A22 -= L21 U12
+        int rc = MATRIX(_gemm)(m, m, jb,
+                               &matrix_access(_a,_n,_n,j0+jb,j0),    _n, LIQUID_MATRIX_GEMM_N,
+                               &matrix_access(_a,_n,_n,j0,   j0+jb), _n, LIQUID_MATRIX_GEMM_N,
+                               &matrix_access(_a,_n,_n,j0+jb,j0+jb), _n, LIQUID_MATRIX_GEMM_SUB);
+        if (rc != LIQUID_OK)
+            return rc;
+    }
+    return LIQUID_OK;
+}
+
+// solve A X = B using the factorization from MATRIX(_lufactor)
+int MATRIX(_lusolve)(T *            _lu,
+                     unsigned int   _n,
+                     unsigned int * _piv,
+                     T *            _b,
+                     unsigned int   _k,
+                     T *            _x)
+{
+    if (_x != _b)
+        memmove(_x, _b, _n*_k*sizeof(T));
+
+    // apply row permutation
+    unsigned int i, j, c;
+    for (i=0; i<_n; i++) {
+        if (_piv[i] >= _n)
+            return liquid_error(LIQUID_EIRANGE,"matrix_lusolve(), invalid pivot index");
+        MATRIX(_swaprows)(_x,_n,_k,i,_piv[i]);
+    }
+
+    // forward substitution: L Y = P B
+    for (i=1; i<_n; i++) {
+        for (j=0; j<i; j++) {
+            T l_ij = matrix_access(_lu,_n,_n,i,j);
+            for (c=0; c<_k; c++)
+                matrix_access(_x,_n,_k,i,c) -= l_ij * matrix_access(_x,_n,_k,j,c);
+        }
+    }
+
+    // back substitution: U X = Y
+    for (i=_n; i>0; i--) {
+        unsigned int r = i-1;
+        for (j=r+1; j<_n; j++) {
+            T u_rj = matrix_access(_lu,_n,_n,r,j);
+            for (c=0; c<_k; c++)
+                matrix_access(_x,_n,_k,r,c) -= u_rj * matrix_access(_x,_n,_k,j,c);
+        }
+        T g = 1 / matrix_access(_lu,_n,_n,r,r);
+        for (c=0; c<_k; c++)
+            matrix_access(_x,_n,_k,r,c) *= g;
+    }
+    return LIQUID_OK;
+}
+
+#undef MATRIX_LU_NB
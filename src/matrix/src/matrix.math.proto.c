@@ -28,6 +28,20 @@
 #include <stdio.h>
 #include <string.h>
 
+// minimum number of multiply-accumulate operations for which the
+// blocked multiplication kernel is used
+#define MATRIX_MUL_MIN_BLOCKED  (128)
+
+// minimum output dimensions for which the blocked multiplication kernel
+// is used (one register tile); thinner products such as matrix-vector
+// would mostly compute padding and are faster with the direct loop
+#define MATRIX_MUL_MIN_ROWS     (4)
+#if T_COMPLEX
+#  define MATRIX_MUL_MIN_COLS   (4)
+#else
+#  define MATRIX_MUL_MIN_COLS   (8)
+#endif
+
 // add elements of two matrices
 //  _X      :   1st input matrix [size: _R x _C]
 //  _Y      :   2nd input matrix [size: _R x _C]
@@ -110,6 +124,16 @@ int MATRIX(_mul)(T * _X, unsigned int _XR, unsigned int _XC,
     if (_ZR != _XR || _ZC != _YC || _XC != _YR )
         return liquid_error(LIQUID_EIRANGE,"matrix_mul(), invalid dimensions");
 
+    // use blocked kernel for all but the smallest and thinnest products
+    if (_ZR >= MATRIX_MUL_MIN_ROWS && _ZC >= MATRIX_MUL_MIN_COLS &&
+        _XR*_XC*_YC >= MATRIX_MUL_MIN_BLOCKED)
+    {
+        return MATRIX(_gemm)(_ZR, _ZC, _XC,
+                             _X, _XC, LIQUID_MATRIX_GEMM_N,
+                             _Y, _YC, LIQUID_MATRIX_GEMM_N,
+                             _Z, _ZC, 0);
+    }
+
     unsigned int r, c, i;
     for (r=0; r<_ZR; r++) {
         for (c=0; c<_ZC; c++) {
@@ -241,12 +265,52 @@ int MATRIX(_hermitian)(T *          _X,
     return LIQUID_OK;
 }
 
+// compute _n x _n product op(x) * op(x)' with the blocked kernel on the
+// lower triangle only, filling the upper triangle by symmetry
+//  _n      :   output dimension
+//  _k      :   inner dimension
+//  _x      :   input matrix
+//  _ldx    :   number of columns in _x
+//  _opa    :   operation on left operand
+//  _opb    :   operation on right operand
+//  _z      :   output matrix [size: _n x _n]
+static int MATRIX(_mul_sym)(unsigned int _n,
+                            unsigned int _k,
+                            T *          _x,
+                            unsigned int _ldx,
+                            int          _opa,
+                            int          _opb,
+                            T *          _z)
+{
+    int rc = MATRIX(_gemm)(_n, _n, _k,
+                           _x, _ldx, _opa,
+                           _x, _ldx, _opb,
+                           _z, _n, LIQUID_MATRIX_GEMM_LOWER);
+    if (rc != LIQUID_OK)
+        return rc;
+
+    // result is Hermitian if either operand is conjugated, symmetric otherwise
+    int herm = (_opa == LIQUID_MATRIX_GEMM_H || _opb == LIQUID_MATRIX_GEMM_H);
+    unsigned int r, c;
+    for (r=0; r<_n; r++) {
+        for (c=r+1; c<_n; c++) {
+            T v = matrix_access(_z,_n,_n,c,r);
+            matrix_access(_z,_n,_n,r,c) = herm ? conj(v) : v;
+        }
+    }
+    return LIQUID_OK;
+}
+
 // compute x*x' on m x n matrix, result: m x m
 int MATRIX(_mul_transpose)(T *          _x,
                            unsigned int _m,
                            unsigned int _n,
                            T *          _xxT)
 {
+    // use blocked kernel for all but the smallest and thinnest products
+    if (_m >= MATRIX_MUL_MIN_COLS && _m*_m*_n >= MATRIX_MUL_MIN_BLOCKED)
+        return MATRIX(_mul_sym)(_m, _n, _x, _n, LIQUID_MATRIX_GEMM_N, LIQUID_MATRIX_GEMM_H, _xxT);
+
     unsigned int r;
     unsigned int c;
     unsigned int i;
@@ -281,6 +345,10 @@ int MATRIX(_transpose_mul)(T *          _x,
                            unsigned int _n,
                            T *          _xTx)
 {
+    // use blocked kernel for all but the smallest and thinnest products
+    if (_n >= MATRIX_MUL_MIN_COLS && _n*_n*_m >= MATRIX_MUL_MIN_BLOCKED)
+        return MATRIX(_mul_sym)(_n, _m, _x, _n, LIQUID_MATRIX_GEMM_H, LIQUID_MATRIX_GEMM_N, _xTx);
+
     unsigned int r;
     unsigned int c;
     unsigned int i;
@@ -315,6 +383,10 @@ int MATRIX(_mul_hermitian)(T *          _x,
                            unsigned int _n,
                            T *          _xxH)
 {
+    // use blocked kernel for all but the smallest and thinnest products
+    if (_m >= MATRIX_MUL_MIN_COLS && _m*_m*_n >= MATRIX_MUL_MIN_BLOCKED)
+        return MATRIX(_mul_sym)(_m, _n, _x, _n, LIQUID_MATRIX_GEMM_N, LIQUID_MATRIX_GEMM_T, _xxH);
+
     unsigned int r;
     unsigned int c;
     unsigned int i;
@@ -348,6 +420,10 @@ int MATRIX(_hermitian_mul)(T *          _x,
                            unsigned int _n,
                            T *          _xHx)
 {
+    // use blocked kernel for all but the smallest and thinnest products
+    if (_n >= MATRIX_MUL_MIN_COLS && _n*_n*_m >= MATRIX_MUL_MIN_BLOCKED)
+        return MATRIX(_mul_sym)(_n, _m, _x, _n, LIQUID_MATRIX_GEMM_T, LIQUID_MATRIX_GEMM_N, _xHx);
+
     unsigned int r;
     unsigned int c;
     unsigned int i;
@@ -45,6 +45,7 @@
 #include "matrix.base.proto.c"
 #include "matrix.cgsolve.proto.c"
 #include "matrix.chol.proto.c"
+#include "matrix.gemm.proto.c"
 #include "matrix.gramschmidt.proto.c"
 #include "matrix.inv.proto.c"
 #include "matrix.linsolve.proto.c"
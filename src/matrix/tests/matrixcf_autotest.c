@@ -405,3 +405,166 @@ void autotest_matrixcf_transmul()
 
 
 
+
+// reference product z = op(x) * op(y) in double precision, where op()
+// is identity (0), transpose (1), or Hermitian transpose (2)
+static void matrixcf_test_mul_ref(float complex * _x, unsigned int _ldx, int _opx,
+                                  float complex * _y, unsigned int _ldy, int _opy,
+                                  double complex * _z,
+                                  unsigned int _m, unsigned int _n, unsigned int _k)
+{
+    unsigned int r, c, i;
+    for (r=0; r<_m; r++) {
+        for (c=0; c<_n; c++) {
+            double complex sum = 0;
+            for (i=0; i<_k; i++) {
+                double complex x = _opx == 0 ? _x[r*_ldx+i] : _x[i*_ldx+r];
+                double complex y = _opy == 0 ? _y[i*_ldy+c] : _y[c*_ldy+i];
+                if (_opx == 2) x = conj(x);
+                if (_opy == 2) y = conj(y);
+                sum += x * y;
+            }
+            _z[r*_n+c] = sum;
+        }
+    }
+}
+
+// test blocked multiplication on sizes spanning several register tiles
+// and cache blocks, with partial tiles on each edge
+void autotest_matrixcf_mul_blocked()
+{
+    float tol = 1e-4f;
+    unsigned int m = 71, k = 133, n = 37;
+    float complex  x[m*k], y[k*n], z[m*n];
+    double complex z_ref[m*n];
+    unsigned int i;
+    for (i=0; i<m*k; i++) x[i] = randnf() + _Complex_I*randnf();
+    for (i=0; i<k*n; i++) y[i] = randnf() + _Complex_I*randnf();
+
+    matrixcf_mul(x, m, k, y, k, n, z, m, n);
+    matrixcf_test_mul_ref(x, k, 0, y, n, 0, z_ref, m, n, k);
+
+    for (i=0; i<m*n; i++) {
+        CONTEND_DELTA( crealf(z[i]), creal(z_ref[i]), tol*k );
+        CONTEND_DELTA( cimagf(z[i]), cimag(z_ref[i]), tol*k );
+    }
+}
+
+// test blocked transpose/Hermitian products against reference
+void autotest_matrixcf_transmul_blocked()
+{
+    float tol = 1e-4f;
+    unsigned int m = 29, n = 41;
+    float complex x[m*n];
+    float complex z[n*n];
+    double complex z_ref[n*n];
+    unsigned int i;
+    for (i=0; i<m*n; i++) x[i] = randnf() + _Complex_I*randnf();
+
+    // x*x^H [m x m]
+    matrixcf_mul_transpose(x, m, n, z);
+    matrixcf_test_mul_ref(x, n, 0, x, n, 2, z_ref, m, m, n);
+    for (i=0; i<m*m; i++) {
+        CONTEND_DELTA( crealf(z[i]), creal(z_ref[i]), tol*n );
+        CONTEND_DELTA( cimagf(z[i]), cimag(z_ref[i]), tol*n );
+    }
+
+    // x*x^T [m x m]
+    matrixcf_mul_hermitian(x, m, n, z);
+    matrixcf_test_mul_ref(x, n, 0, x, n, 1, z_ref, m, m, n);
+    for (i=0; i<m*m; i++) {
+        CONTEND_DELTA( crealf(z[i]), creal(z_ref[i]), tol*n );
+        CONTEND_DELTA( cimagf(z[i]), cimag(z_ref[i]), tol*n );
+    }
+
+    // x^H*x [n x n]
+    matrixcf_transpose_mul(x, m, n, z);
+    matrixcf_test_mul_ref(x, n, 2, x, n, 0, z_ref, n, n, m);
+    for (i=0; i<n*n; i++) {
+        CONTEND_DELTA( crealf(z[i]), creal(z_ref[i]), tol*m );
+        CONTEND_DELTA( cimagf(z[i]), cimag(z_ref[i]), tol*m );
+    }
+
+    // x^T*x [n x n]
+    matrixcf_hermitian_mul(x, m, n, z);
+    matrixcf_test_mul_ref(x, n, 1, x, n, 0, z_ref, n, n, m);
+    for (i=0; i<n*n; i++) {
+        CONTEND_DELTA( crealf(z[i]), creal(z_ref[i]), tol*m );
+        CONTEND_DELTA( cimagf(z[i]), cimag(z_ref[i]), tol*m );
+    }
+}
+
+// test L/U factor-solve with multiple right-hand sides
+void autotest_matrixcf_lusolve()
+{
+    float tol = 1e-3f;
+    unsigned int n = 50, k = 3;
+    float complex  A[n*n], LU[n*n], b[n*k], x[n*k];
+    double complex b_hat[n*k];
+    unsigned int piv[n];
+    unsigned int i;
+    for (i=0; i<n*n; i++) A[i] = randnf() + _Complex_I*randnf();
+    for (i=0; i<n*k; i++) b[i] = randnf() + _Complex_I*randnf();
+
+    memmove(LU, A, sizeof(A));
+    CONTEND_EQUALITY( matrixcf_lufactor(LU, n, piv), LIQUID_OK );
+    CONTEND_EQUALITY( matrixcf_lusolve(LU, n, piv, b, k, x), LIQUID_OK );
+
+    // check residual A*x - b
+    matrixcf_test_mul_ref(A, n, 0, x, k, 0, b_hat, n, k, n);
+    for (i=0; i<n*k; i++) {
+        CONTEND_DELTA( crealf(b[i]), creal(b_hat[i]), tol );
+        CONTEND_DELTA( cimagf(b[i]), cimag(b_hat[i]), tol );
+    }
+}
+
+// singular matrix is rejected by L/U factorization
+void autotest_matrixcf_lufactor_singular()
+{
+#if LIQUID_STRICT_EXIT
+    AUTOTEST_WARN("skipping matrixcf_lufactor singular test with strict exit enabled");
+    return;
+#endif
+#if !LIQUID_SUPPRESS_ERROR_OUTPUT
+    fprintf(stderr,"warning: ignore potential errors here; checking for invalid configurations\n");
+#endif
+    float complex A[25];
+    unsigned int piv[5];
+    unsigned int i;
+    for (i=0; i<25; i++)
+        A[i] = (i % 5) == 2 ? 0 : randnf() + _Complex_I*randnf();
+    CONTEND_INEQUALITY(LIQUID_OK, matrixcf_lufactor(A, 5, piv));
+}
+
+// test blocked Cholesky decomposition and solve
+void autotest_matrixcf_cholsolve()
+{
+    float tol = 1e-3f;
+    unsigned int n = 40, k = 2;
+    float complex  X[n*n], A[n*n], L[n*n], b[n*k], x[n*k];
+    double complex z_ref[n*n];
+    unsigned int i;
+    for (i=0; i<n*n; i++) X[i] = randnf() + _Complex_I*randnf();
+    for (i=0; i<n*k; i++) b[i] = randnf() + _Complex_I*randnf();
+
+    // generate Hermitian positive-definite matrix A = X X^H + n I
+    matrixcf_mul_transpose(X, n, n, A);
+    for (i=0; i<n; i++)
+        A[i*n+i] = crealf(A[i*n+i]) + n;
+
+    // check L*L^H = A
+    CONTEND_EQUALITY( matrixcf_chol(A, n, L), LIQUID_OK );
+    matrixcf_test_mul_ref(L, n, 0, L, n, 2, z_ref, n, n, n);
+    for (i=0; i<n*n; i++) {
+        CONTEND_DELTA( crealf(A[i]), creal(z_ref[i]), tol*n );
+        CONTEND_DELTA( cimagf(A[i]), cimag(z_ref[i]), tol*n );
+    }
+
+    // check residual A*x - b
+    CONTEND_EQUALITY( matrixcf_cholsolve(L, n, b, k, x), LIQUID_OK );
+    matrixcf_test_mul_ref(A, n, 0, x, k, 0, z_ref, n, k, n);
+    for (i=0; i<n*k; i++) {
+        CONTEND_DELTA( crealf(b[i]), creal(z_ref[i]), tol );
+        CONTEND_DELTA( cimagf(b[i]), cimag(z_ref[i]), tol );
+    }
+}
@@ -20,6 +20,7 @@
  * THE SOFTWARE.
  */
 
+#include <stdlib.h>
 #include <string.h>
 
 #include "autotest/autotest.h"
@@ -420,3 +421,57 @@ void autotest_matrixf_transmul()
 
 
 
+
+// test blocked multiplication on sizes spanning several register tiles
+// and cache blocks, with partial tiles on each edge
+void autotest_matrixf_mul_blocked()
+{
+    float tol = 1e-4f;
+    unsigned int m = 67, k = 135, n = 141;
+    float * x = (float*) malloc(m*k*sizeof(float));
+    float * y = (float*) malloc(k*n*sizeof(float));
+    float * z = (float*) malloc(m*n*sizeof(float));
+    unsigned int i, r, c;
+    for (i=0; i<m*k; i++) x[i] = randnf();
+    for (i=0; i<k*n; i++) y[i] = randnf();
+
+    matrixf_mul(x, m, k, y, k, n, z, m, n);
+
+    // compare to reference computed in double precision
+    for (r=0; r<m; r++) {
+        for (c=0; c<n; c++) {
+            double sum = 0;
+            for (i=0; i<k; i++)
+                sum += (double)x[r*k+i] * (double)y[i*n+c];
+            CONTEND_DELTA( z[r*n+c], sum, tol*k );
+        }
+    }
+    free(x);
+    free(y);
+    free(z);
+}
+
+// test L/U factor-solve for a system larger than one factorization
+// panel
+void autotest_matrixf_lusolve()
+{
+    float tol = 1e-3f;
+    unsigned int n = 37;
+    float A[n*n], LU[n*n], b[n], x[n];
+    unsigned int piv[n];
+    unsigned int i, j;
+    for (i=0; i<n*n; i++) A[i] = randnf();
+    for (i=0; i<n; i++)   b[i] = randnf();
+
+    memmove(LU, A, sizeof(A));
+    CONTEND_EQUALITY( matrixf_lufactor(LU, n, piv), LIQUID_OK );
+    CONTEND_EQUALITY( matrixf_lusolve(LU, n, piv, b, 1, x), LIQUID_OK );
+
+    // check residual A*x - b
+    for (i=0; i<n; i++) {
+        double sum = 0;
+        for (j=0; j<n; j++)
+            sum += (double)A[i*n+j] * (double)x[j];
+        CONTEND_DELTA( b[i], sum, tol );
+    }
+}
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2007 - 2022 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <sys/resource.h>
+#include "liquid.h"
+
+// Helper function to keep code base small
+void ampmodem_demod_bench(struct rusage *      _start,
+                          struct rusage *      _finish,
+                          unsigned long int *  _num_iterations,
+                          liquid_ampmodem_type _type,
+                          int                  _suppressed_carrier,
+                          int                  _block)
+{
+    // create demodulator
+    ampmodem dem = ampmodem_create(0.8f, _type, _suppressed_carrier);
+
+    float complex r[256];   // modulated signal
+    float         m[256];   // message signal
+
+    unsigned long int i;
+    unsigned int j;
+
+    // generate modulated signal
+    for (j=0; j<256; j++)
+        r[j] = 0.3f*cexpf(_Complex_I*2*M_PI*j/20.0f);
+
+    // start trials
+    *_num_iterations /= 256;
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++) {
+        if (_block) {
+            ampmodem_demodulate_block(dem, r, 256, m);
+        } else {
+            for (j=0; j<256; j++)
+                ampmodem_demodulate(dem, r[j], &m[j]);
+        }
+    }
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= 256;
+
+    // destroy demodulator
+    ampmodem_destroy(dem);
+}
+
+#define AMPMODEM_DEMOD_BENCHMARK_API(TYPE,SC,BLOCK) \
+(   struct rusage *_start,                          \
+    struct rusage *_finish,                         \
+    unsigned long int *_num_iterations)             \
+{ ampmodem_demod_bench(_start, _finish, _num_iterations, TYPE, SC, BLOCK); }
+
+void benchmark_ampmodem_demod_usb_sc       AMPMODEM_DEMOD_BENCHMARK_API(LIQUID_AMPMODEM_USB, 1, 0)
+void benchmark_ampmodem_demod_usb_sc_block AMPMODEM_DEMOD_BENCHMARK_API(LIQUID_AMPMODEM_USB, 1, 1)
+void benchmark_ampmodem_demod_usb          AMPMODEM_DEMOD_BENCHMARK_API(LIQUID_AMPMODEM_USB, 0, 0)
+void benchmark_ampmodem_demod_usb_block    AMPMODEM_DEMOD_BENCHMARK_API(LIQUID_AMPMODEM_USB, 0, 1)
+
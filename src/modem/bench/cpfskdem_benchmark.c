@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <sys/resource.h>
+#include "liquid.h"
+
+// Helper function to keep code base small
+void cpfskdem_bench(struct rusage *     _start,
+                    struct rusage *     _finish,
+                    unsigned long int * _num_iterations,
+                    int                 _coherent,
+                    int                 _block)
+{
+    // options
+    unsigned int bps=1;     // bits per symbol
+    float        h=0.5f;    // modulation index
+    unsigned int k=4;       // filter samples/symbol
+    unsigned int m=3;       // filter delay (symbols)
+    float        BT=0.3f;   // bandwidth-time product
+    unsigned int num_symbols=256;
+
+    // create demodulator object
+    cpfskdem demod = _coherent ?
+        cpfskdem_create_coherent(bps, h, k, m, BT, LIQUID_CPFSK_GMSK) :
+        cpfskdem_create         (bps, h, k, m, BT, LIQUID_CPFSK_GMSK);
+
+    float complex x[k*num_symbols];
+    unsigned int symbols_out[num_symbols];
+
+    unsigned long int i, j;
+    for (i=0; i<k*num_symbols; i++)
+        x[i] = randnf()*cexpf(_Complex_I*2*M_PI*randf());
+
+    // start trials
+    *_num_iterations /= num_symbols;
+    if (_coherent) *_num_iterations /= 8;
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++) {
+        if (_block) {
+            cpfskdem_demodulate_block(demod, x, num_symbols, symbols_out);
+        } else {
+            for (j=0; j<num_symbols; j++)
+                symbols_out[j] = cpfskdem_demodulate(demod, &x[j*k]);
+        }
+    }
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= num_symbols;
+
+    // destroy demodulator object
+    cpfskdem_destroy(demod);
+}
+
+#define CPFSKDEM_BENCHMARK_API(NAME,COHERENT,BLOCK) \
+(   struct rusage *_start,                          \
+    struct rusage *_finish,                         \
+    unsigned long int *_num_iterations)             \
+{ cpfskdem_bench(_start, _finish, _num_iterations, COHERENT, BLOCK); }
+
+void benchmark_cpfskdem_noncoherent         CPFSKDEM_BENCHMARK_API("noncoherent",       0, 0)
+void benchmark_cpfskdem_noncoherent_block   CPFSKDEM_BENCHMARK_API("noncoherent_block", 0, 1)
+void benchmark_cpfskdem_coherent            CPFSKDEM_BENCHMARK_API("coherent",          1, 0)
+void benchmark_cpfskdem_coherent_block      CPFSKDEM_BENCHMARK_API("coherent_block",    1, 1)
@@ -76,3 +76,49 @@ void benchmark_freqdem(struct rusage *     _start,
 }
 
 
+
+// Helper function to keep code base small
+void freqdem_block_bench(struct rusage *     _start,
+                         struct rusage *     _finish,
+                         unsigned long int * _num_iterations,
+                         unsigned int        _terms)
+{
+    // create demodulator
+    float   kf  = 0.05f; // modulation index
+    freqdem dem = freqdem_create(kf);
+    freqdem_set_atan_terms(dem, _terms);
+
+    float complex r[1024];  // modulated signal
+    float         m[1024];  // message signal
+
+    unsigned long int i;
+
+    // generate modulated signal
+    for (i=0; i<1024; i++)
+        r[i] = 0.3f*cexpf(_Complex_I*2*M_PI*i/20.0f);
+
+    // normalize number of iterations
+    *_num_iterations /= 64;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++)
+        freqdem_demodulate_block(dem, r, 1024, m);
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= 1024;
+
+    // destroy demodulator
+    freqdem_destroy(dem);
+}
+
+#define FREQDEM_BLOCK_BENCH_API(TERMS)      \
+(   struct rusage *_start,                  \
+    struct rusage *_finish,                 \
+    unsigned long int *_num_iterations)     \
+{ freqdem_block_bench(_start, _finish, _num_iterations, TERMS); }
+
+void benchmark_freqdem_block_exact  FREQDEM_BLOCK_BENCH_API(0)
+void benchmark_freqdem_block_terms3 FREQDEM_BLOCK_BENCH_API(3)
+void benchmark_freqdem_block_terms5 FREQDEM_BLOCK_BENCH_API(5)
+void benchmark_freqdem_block_terms7 FREQDEM_BLOCK_BENCH_API(7)
@@ -101,3 +101,53 @@ void benchmark_fskdem_misc_M256    FSKDEM_BENCH_API( 8,  500, 0.3721451)
 void benchmark_fskdem_misc_M512    FSKDEM_BENCH_API( 9, 1000, 0.3721451)
 void benchmark_fskdem_misc_M1024   FSKDEM_BENCH_API(10, 2000, 0.3721451)
 
+
+#define FSKDEM_BLOCK_BENCH_API(m,k,bandwidth,pruned)    \
+(   struct rusage *     _start,                         \
+    struct rusage *     _finish,                        \
+    unsigned long int * _num_iterations)                \
+{ fskdem_block_bench(_start, _finish, _num_iterations, m, k, bandwidth, pruned); }
+
+// Helper function to keep code base small
+void fskdem_block_bench(struct rusage *     _start,
+                        struct rusage *     _finish,
+                        unsigned long int * _num_iterations,
+                        unsigned int        _m,
+                        unsigned int        _k,
+                        float               _bandwidth,
+                        int                 _pruned)
+{
+    // normalize number of iterations
+    unsigned int num_symbols = 32;
+    *_num_iterations /= _k * num_symbols / 8;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    // initialize demodulator
+    fskdem dem = fskdem_create(_m,_k,_bandwidth);
+    fskdem_set_pruned(dem, _pruned);
+
+    unsigned long int i;
+
+    // generate input vector to demodulate (spiral)
+    float complex buf[_k*num_symbols];
+    unsigned int  sym[num_symbols];
+    for (i=0; i<_k*num_symbols; i++)
+        buf[i] = 0.07 * (i % 20) * cexpf(_Complex_I*2*M_PI*0.1*i);
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++)
+        fskdem_demodulate_block(dem, buf, num_symbols, sym);
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= num_symbols;
+
+    fskdem_destroy(dem);
+}
+
+// BENCHMARKS: block demodulation, full transform and pruned transform
+void benchmark_fskdem_block_fft_M2     FSKDEM_BLOCK_BENCH_API(1,  64, 0.25f, 0)
+void benchmark_fskdem_block_fft_M4     FSKDEM_BLOCK_BENCH_API(2,  64, 0.25f, 0)
+void benchmark_fskdem_block_fft_M8     FSKDEM_BLOCK_BENCH_API(3, 200, 0.25f, 0)
+void benchmark_fskdem_block_pruned_M2  FSKDEM_BLOCK_BENCH_API(1,  64, 0.25f, 1)
+void benchmark_fskdem_block_pruned_M4  FSKDEM_BLOCK_BENCH_API(2,  64, 0.25f, 1)
+void benchmark_fskdem_block_pruned_M8  FSKDEM_BLOCK_BENCH_API(3, 200, 0.25f, 1)
@@ -93,3 +93,36 @@ void benchmark_gmskmodem_demodulate(struct rusage *_start,
     gmskdem_destroy(demod);
 }
 
+
+// 
+void benchmark_gmskmodem_demodulate_block(struct rusage *_start,
+                                          struct rusage *_finish,
+                                          unsigned long int *_num_iterations)
+{
+    // options
+    unsigned int k=2;   // filter samples/symbol
+    unsigned int m=3;   // filter delay (symbols)
+    float BT=0.3f;      // bandwidth-time product
+    unsigned int num_symbols=256;
+
+    // create modem object
+    gmskdem demod = gmskdem_create(k, m, BT);
+
+    float complex x[k*num_symbols];
+    unsigned int symbols_out[num_symbols];
+
+    unsigned long int i;
+    for (i=0; i<k*num_symbols; i++)
+        x[i] = randnf()*cexpf(_Complex_I*2*M_PI*randf());
+
+    // start trials
+    *_num_iterations /= num_symbols;
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++)
+        gmskdem_demodulate_block(demod, x, num_symbols, symbols_out);
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= num_symbols;
+
+    // destroy modem objects
+    gmskdem_destroy(demod);
+}
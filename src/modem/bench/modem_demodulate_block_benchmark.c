@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2007 - 2021 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <sys/resource.h>
+#include "liquid.internal.h"
+
+#define MODEM_DEMODULATE_BLOCK_BENCH_API(MS)    \
+(   struct rusage *_start,                      \
+    struct rusage *_finish,                     \
+    unsigned long int *_num_iterations)         \
+{ modemcf_demodulate_block_bench(_start, _finish, _num_iterations, MS); }
+
+// Helper function to keep code base small
+void modemcf_demodulate_block_bench(struct rusage *_start,
+                                    struct rusage *_finish,
+                                    unsigned long int *_num_iterations,
+                                    modulation_scheme _ms)
+{
+    // initialize modulator
+    modemcf demod = modemcf_create(_ms);
+
+    // normalize number of iterations
+    *_num_iterations /= 64;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    unsigned long int i;
+
+    // generate input vector to demodulate (spiral)
+    unsigned int  n = 1024;
+    float complex x[n];
+    unsigned int  s[n];
+    for (i=0; i<n; i++)
+        x[i] = 0.07 * (i % 20) * cexpf(_Complex_I*2*M_PI*0.1*i);
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++)
+        modemcf_demodulate_block(demod, x, n, s);
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= n;
+
+    modemcf_destroy(demod);
+}
+
+void benchmark_demodulate_block_bpsk   MODEM_DEMODULATE_BLOCK_BENCH_API(LIQUID_MODEM_BPSK)
+void benchmark_demodulate_block_qpsk   MODEM_DEMODULATE_BLOCK_BENCH_API(LIQUID_MODEM_QPSK)
+void benchmark_demodulate_block_ask16  MODEM_DEMODULATE_BLOCK_BENCH_API(LIQUID_MODEM_ASK16)
+void benchmark_demodulate_block_psk8   MODEM_DEMODULATE_BLOCK_BENCH_API(LIQUID_MODEM_PSK8)
+void benchmark_demodulate_block_dpsk8  MODEM_DEMODULATE_BLOCK_BENCH_API(LIQUID_MODEM_DPSK8)
+void benchmark_demodulate_block_qam16  MODEM_DEMODULATE_BLOCK_BENCH_API(LIQUID_MODEM_QAM16)
+void benchmark_demodulate_block_qam64  MODEM_DEMODULATE_BLOCK_BENCH_API(LIQUID_MODEM_QAM64)
+void benchmark_demodulate_block_qam256 MODEM_DEMODULATE_BLOCK_BENCH_API(LIQUID_MODEM_QAM256)
+void benchmark_demodulate_block_apsk64 MODEM_DEMODULATE_BLOCK_BENCH_API(LIQUID_MODEM_APSK64)
@@ -30,6 +30,9 @@
 
 #include "liquid.internal.h"
 
+// number of samples processed in each iteration of block methods
+#define AMPMODEM_BLOCK_LEN  (256)
+
 // internal methods for specific demodulation methods
 int ampmodem_demod_dsb_peak_detect(ampmodem _q, float complex _x, float * _m);
 int ampmodem_demod_dsb_pll_carrier(ampmodem _q, float complex _x, float * _m);
@@ -37,6 +40,10 @@ int ampmodem_demod_dsb_pll_costas (ampmodem _q, float complex _x, float * _m);
 int ampmodem_demod_ssb_pll_carrier(ampmodem _q, float complex _x, float * _m);
 int ampmodem_demod_ssb            (ampmodem _q, float complex _x, float * _m);
 
+// internal block methods for specific demodulation methods
+int ampmodem_demod_block_ssb_pll_carrier(ampmodem _q, float complex * _x, unsigned int _n, float * _m);
+int ampmodem_demod_block_ssb            (ampmodem _q, float complex * _x, unsigned int _n, float * _m);
+
 struct ampmodem_s {
     // modulation index
     float mod_index;
@@ -55,8 +62,9 @@ struct ampmodem_s {
     firfilt_crcf    lowpass;    // low-pass filter for SSB PLL
     wdelaycf        delay;      // delay buffer to align to low-pass filter delay
 
-    // demodulation function pointer
+    // demodulation function pointers
     int (*demod)(ampmodem _q, float complex _x, float * _m);
+    int (*demod_block)(ampmodem _q, float complex * _x, unsigned int _n, float * _m);
 };
 
 // create ampmodem object
@@ -102,8 +110,9 @@ ampmodem ampmodem_create(float                _mod_index,
     // delay buffer
     q->delay = wdelaycf_create(q->m);
 
-    // set appropriate demod function pointer
-    q->demod = NULL;
+    // set appropriate demod function pointers
+    q->demod       = NULL;
+    q->demod_block = NULL;
     if (q->type == LIQUID_AMPMODEM_DSB) {
         // double side-band
         q->demod = q->suppressed_carrier ?
@@ -113,6 +122,9 @@ ampmodem ampmodem_create(float                _mod_index,
     } else {
         // single side-band
         q->demod = q->suppressed_carrier ? ampmodem_demod_ssb : ampmodem_demod_ssb_pll_carrier;
+        q->demod_block = q->suppressed_carrier ?
+            ampmodem_demod_block_ssb :
+            ampmodem_demod_block_ssb_pll_carrier;
     }
 
     // reset object and return
@@ -222,10 +234,26 @@ int ampmodem_modulate_block(ampmodem        _q,
                             unsigned int    _n,
                             float complex * _s)
 {
-    // TODO: implement more efficient method
     unsigned int i;
+    if (_q->type == LIQUID_AMPMODEM_DSB) {
+        for (i=0; i<_n; i++)
+            _s[i] = _m[i];
+    } else {
+        // push through Hilbert transform
+        // LIQUID_AMPMODEM_USB:
+        // LIQUID_AMPMODEM_LSB: conjugate Hilbert transform output
+        firhilbf_r2c_execute_block(_q->hilbert, _m, _n, _s);
+
+        if (_q->type == LIQUID_AMPMODEM_LSB) {
+            for (i=0; i<_n; i++)
+                _s[i] = conjf(_s[i]);
+        }
+    }
+
+    // apply modulation index and carrier
+    float carrier = _q->suppressed_carrier ? 0.0f : 1.0f;
     for (i=0; i<_n; i++)
-        ampmodem_modulate(_q, _m[i], &_s[i]);
+        _s[i] = _s[i] * _q->mod_index + carrier;
     return LIQUID_OK;
 }
 
@@ -248,6 +276,10 @@ int ampmodem_demodulate_block(ampmodem        _q,
                               unsigned int    _n,
                               float *         _x)
 {
+    // invoke internal type-specific block method, if available
+    if (_q->demod_block != NULL)
+        return _q->demod_block(_q, _y, _n, _x);
+
     unsigned int i;
     int rc;
     for (i=0; i<_n; i++) {
@@ -391,3 +423,87 @@ int ampmodem_demod_ssb(ampmodem      _q,
     return LIQUID_OK;
 }
 
+
+// demodulate block of samples (single side-band, carrier present)
+int ampmodem_demod_block_ssb_pll_carrier(ampmodem        _q,
+                                         float complex * _x,
+                                         unsigned int    _n,
+                                         float *         _y)
+{
+    float complex v1[AMPMODEM_BLOCK_LEN];   // mixed-down, delayed signal
+    float         m[AMPMODEM_BLOCK_LEN];    // unused side-band
+
+    unsigned int i;
+    while (_n > 0) {
+        // number of samples processed in this iteration
+        unsigned int n = _n < AMPMODEM_BLOCK_LEN ? _n : AMPMODEM_BLOCK_LEN;
+
+        // carrier recovery must run sample-by-sample
+        for (i=0; i<n; i++) {
+            float complex x0, x1;
+            firfilt_crcf_push   (_q->lowpass, _x[i]);
+            firfilt_crcf_execute(_q->lowpass, &x0);
+            wdelaycf_push       (_q->delay,   _x[i]);
+            wdelaycf_read       (_q->delay,   &x1);
+
+            // mix each signal down
+            float complex v0;
+            nco_crcf_mix_down(_q->mixer, x0, &v0);
+            nco_crcf_mix_down(_q->mixer, x1, &v1[i]);
+
+            // adjust nco, pll objects and step nco
+            nco_crcf_pll_step(_q->mixer, cimagf(v0));
+            nco_crcf_step(_q->mixer);
+        }
+
+        // apply hilbert transform and retrieve appropriate side-band
+        if (_q->type == LIQUID_AMPMODEM_USB)
+            firhilbf_c2r_execute_block(_q->hilbert, v1, n, m, _y);
+        else
+            firhilbf_c2r_execute_block(_q->hilbert, v1, n, _y, m);
+
+        // recover message
+        for (i=0; i<n; i++)
+            _y[i] = 0.5f * _y[i] / _q->mod_index;
+
+        // apply DC block in place
+        firfilt_rrrf_execute_block(_q->dcblock, _y, n, _y);
+
+        // update pointers
+        _x += n;
+        _y += n;
+        _n -= n;
+    }
+    return LIQUID_OK;
+}
+
+// demodulate block of samples (single side-band, suppressed carrier)
+int ampmodem_demod_block_ssb(ampmodem        _q,
+                             float complex * _x,
+                             unsigned int    _n,
+                             float *         _y)
+{
+    float m[AMPMODEM_BLOCK_LEN];    // unused side-band
+
+    unsigned int i;
+    while (_n > 0) {
+        // number of samples processed in this iteration
+        unsigned int n = _n < AMPMODEM_BLOCK_LEN ? _n : AMPMODEM_BLOCK_LEN;
+
+        // apply hilbert transform and retrieve appropriate side-band
+        if (_q->type == LIQUID_AMPMODEM_USB)
+            firhilbf_c2r_execute_block(_q->hilbert, _x, n, m, _y);
+        else
+            firhilbf_c2r_execute_block(_q->hilbert, _x, n, _y, m);
+
+        // recover message
+        for (i=0; i<n; i++)
+            _y[i] = 0.5f * _y[i] / _q->mod_index;
+
+        // update pointers
+        _x += n;
+        _y += n;
+        _n -= n;
+    }
+    return LIQUID_OK;
+}
@@ -30,6 +30,15 @@
 
 #define DEBUG_CPFSKDEM()  0
 
+// create demodulator object with given receiver type
+CPFSKDEM() CPFSKDEM(_create_demod)(unsigned int _bps,
+                                   float        _h,
+                                   unsigned int _k,
+                                   unsigned int _m,
+                                   float        _beta,
+                                   int          _type,
+                                   int          _coherent);
+
 // initialize coherent demodulator
 int CPFSKDEM(_init_coherent)(CPFSKDEM() _q);
 
@@ -42,6 +51,26 @@ unsigned int CPFSKDEM(_demodulate_coherent)(CPFSKDEM() _q, TC * _y);
 // demodulate array of samples (non-coherent)
 unsigned int CPFSKDEM(_demodulate_noncoherent)(CPFSKDEM() _q, TC * _y);
 
+// reset coherent demodulator trellis
+int CPFSKDEM(_coherent_reset)(CPFSKDEM() _q);
+
+// map soft frequency estimate to nearest symbol
+unsigned int CPFSKDEM(_decide)(CPFSKDEM() _q, float _phi);
+
+// design transmit filter (see cpfskmod)
+int CPFSKMOD(_firdes)(unsigned int _k,
+                      unsigned int _m,
+                      float        _beta,
+                      int          _type,
+                      float *      _h,
+                      unsigned int _h_len);
+
+// maximum number of symbols processed at a time in block demodulation
+#define CPFSKDEM_BLOCK_LEN  (64)
+
+// maximum number of trellis states for coherent demodulator
+#define CPFSKDEM_MAX_STATES (64)
+
 // cpfskdem
 struct CPFSKDEM(_s) {
     // common
@@ -73,24 +102,36 @@ struct CPFSKDEM(_s) {
     // common data structure shared between coherent and non-coherent
     // demodulator receivers
     union {
-        // coherent demodulator
+        // coherent demodulator: reduced-state sequence estimator over
+        // the CPM trellis with per-survivor phase and symbol history
         struct {
-            //nco_crcf nco;       // oscillator/phase-locked loop
-            //firpfb_crcf mf;     // matched filter
-            //firpfb_crcf dmf;    // matched filter (derivative)
-            //eqlms_rrrf equalizer;
+            unsigned int Lh;        // frequency pulse length [symbols]
+            unsigned int j0;        // leading pulse intervals ignored
+            float        g_lead;    // pulse area of ignored intervals
+            unsigned int L;         // symbols hypothesized per branch
+            unsigned int D;         // decision depth [symbols]
+            unsigned int P;         // survivor path length [symbols]
+            unsigned int num_states;// number of trellis states, M^(L-1)
+            float *      g;         // phase pulse per interval [size: Lh*k x 1]
+            float        b0, b1;    // phase integrator coefficients
+            float *      metric;    // path metrics [size: num_states x 1]
+            float *      phase;     // survivor phase state [size: num_states x 1]
+            float *      path;      // survivor symbol values, newest first [size: num_states*P x 1]
+            float *      metric_new;
+            float *      phase_new;
+            float *      path_new;
         } coherent;
 
         // non-coherent demodulator
         struct {
             firfilt_crcf mf;    // matched filter
+            freqdem      fdem;  // phase-difference discriminator at symbol rate
         } noncoherent;
     } demod;
 
     // state variables
     unsigned int  index;    // debug
     unsigned int  counter;  // sample counter
-    float complex z_prime;  // (coherent only)
 };
 
 // create CPFSKDEM() object (frequency demodulator)
@@ -106,6 +147,35 @@ CPFSKDEM() CPFSKDEM(_create)(unsigned int _bps,
                              unsigned int _m,
                              float        _beta,
                              int          _type)
+{
+    return CPFSKDEM(_create_demod)(_bps, _h, _k, _m, _beta, _type, 0);
+}
+
+// create coherent demodulator object (sequence estimator)
+//  _bps    :   bits per symbol, _bps > 0
+//  _h      :   modulation index, _h > 0
+//  _k      :   samples/symbol, _k > 1, _k even
+//  _m      :   filter delay (symbols), _m > 0
+//  _beta   :   filter bandwidth parameter, _beta > 0
+//  _type   :   filter type (e.g. LIQUID_CPFSK_SQUARE)
+CPFSKDEM() CPFSKDEM(_create_coherent)(unsigned int _bps,
+                                      float        _h,
+                                      unsigned int _k,
+                                      unsigned int _m,
+                                      float        _beta,
+                                      int          _type)
+{
+    return CPFSKDEM(_create_demod)(_bps, _h, _k, _m, _beta, _type, 1);
+}
+
+// create demodulator object with given receiver type
+CPFSKDEM() CPFSKDEM(_create_demod)(unsigned int _bps,
+                                   float        _h,
+                                   unsigned int _k,
+                                   unsigned int _m,
+                                   float        _beta,
+                                   int          _type,
+                                   int          _coherent)
 {
     // validate input
     if (_bps == 0)
@@ -144,12 +214,16 @@ CPFSKDEM() CPFSKDEM(_create)(unsigned int _bps,
     q->M = 1 << q->bps; // constellation size
 
     // coherent or non-coherent?
-    // TODO: allow user to specify
-    if (q->h > 0.66667f) {
-        //cpfskdem_init_noncoherent(q);
-        fprintf(stderr,"warning: cpfskdem_create(), coherent demodulation with h > 2/3 not recommended\n");
+    if (_coherent) {
+        if (CPFSKDEM(_init_coherent)(q) != LIQUID_OK) {
+            free(q);
+            return liquid_error_config("cpfskdem_create_coherent(), could not initialize coherent demodulator");
+        }
+    } else {
+        if (q->h > 0.66667f)
+            fprintf(stderr,"warning: cpfskdem_create(), coherent demodulation with h > 2/3 not recommended\n");
+        CPFSKDEM(_init_noncoherent)(q);
     }
-    CPFSKDEM(_init_noncoherent)(q);
 
     // reset modem object
     CPFSKDEM(_reset)(q);
@@ -172,11 +246,18 @@ CPFSKDEM() CPFSKDEM(_copy)(CPFSKDEM() q_orig)
 
     // copy objects
     if (q_orig->demod_type == CPFSKDEM_COHERENT) {
-        //return liquid_error_config("cpfskdem_copy(), coherent mode not supported");
-        liquid_error(LIQUID_EINT,"cpfskdem_copy(), coherent mode not supported");
-        return NULL;
+        unsigned int S = q_orig->demod.coherent.num_states;
+        unsigned int P = q_orig->demod.coherent.P;
+        q_copy->demod.coherent.g          = (float*) liquid_malloc_copy(q_orig->demod.coherent.g,          q_orig->demod.coherent.Lh*q_orig->k, sizeof(float));
+        q_copy->demod.coherent.metric     = (float*) liquid_malloc_copy(q_orig->demod.coherent.metric,     S,   sizeof(float));
+        q_copy->demod.coherent.phase      = (float*) liquid_malloc_copy(q_orig->demod.coherent.phase,      S,   sizeof(float));
+        q_copy->demod.coherent.path       = (float*) liquid_malloc_copy(q_orig->demod.coherent.path,       S*P, sizeof(float));
+        q_copy->demod.coherent.metric_new = (float*) liquid_malloc_copy(q_orig->demod.coherent.metric_new, S,   sizeof(float));
+        q_copy->demod.coherent.phase_new  = (float*) liquid_malloc_copy(q_orig->demod.coherent.phase_new,  S,   sizeof(float));
+        q_copy->demod.coherent.path_new   = (float*) liquid_malloc_copy(q_orig->demod.coherent.path_new,   S*P, sizeof(float));
     } else {
-        q_copy->demod.noncoherent.mf = firfilt_crcf_copy(q_orig->demod.noncoherent.mf);
+        q_copy->demod.noncoherent.mf   = firfilt_crcf_copy(q_orig->demod.noncoherent.mf);
+        q_copy->demod.noncoherent.fdem = freqdem_copy(q_orig->demod.noncoherent.fdem);
     }
 
     // return new object
@@ -202,10 +283,118 @@ CPFSKDEM() CPFSKDEM(_create_gmsk)(unsigned int _k,
 }
 
 
-// initialize non-coherent demodulator
+// initialize coherent demodulator
 int CPFSKDEM(_init_coherent)(CPFSKDEM() _q)
 {
-    return liquid_error(LIQUID_EUMODE,"cpfskdem_init_coherent(), unsupported mode");
+    // specify coherent receiver
+    _q->demod_type = CPFSKDEM_COHERENT;
+
+    // set demodulate function pointer
+    _q->demodulate = CPFSKDEM(_demodulate_coherent);
+
+    // transmit pulse length and delay, matching modulator (see cpfskmod)
+    unsigned int ht_len    = 0;
+    unsigned int mod_delay = 0;
+    _q->demod.coherent.b0 = 0.5f;
+    _q->demod.coherent.b1 = 0.5f;
+    switch(_q->type) {
+    case LIQUID_CPFSK_SQUARE:
+        ht_len    = _q->k;
+        mod_delay = 1;
+        _q->demod.coherent.b0 = 0.0f;
+        _q->demod.coherent.b1 = 1.0f;
+        break;
+    case LIQUID_CPFSK_RCOS_FULL:
+        ht_len    = _q->k;
+        mod_delay = 1;
+        break;
+    case LIQUID_CPFSK_RCOS_PARTIAL:
+        ht_len    = 3*_q->k;
+        mod_delay = 2;
+        break;
+    case LIQUID_CPFSK_GMSK:
+        ht_len    = 2*_q->k*_q->m + _q->k + 1;
+        mod_delay = _q->m + 1;
+        break;
+    default:
+        return liquid_error(LIQUID_EICONFIG,"cpfskdem_init_coherent(), invalid tx filter type");
+    }
+
+    // design phase pulse, scaled by modulation index and split into
+    // symbol intervals: g[j*k + i] is the phase increment at sample i
+    // of the current symbol due to the symbol transmitted j symbols ago
+    unsigned int k  = _q->k;
+    unsigned int Lh = (ht_len + k - 1) / k;
+    float ht[Lh*k];
+    unsigned int i, j;
+    for (i=0; i<Lh*k; i++)
+        ht[i] = 0.0f;
+    CPFSKMOD(_firdes)(k, _q->m, _q->beta, _q->type, ht, ht_len);
+    _q->demod.coherent.Lh = Lh;
+    _q->demod.coherent.g  = (float*) malloc(Lh*k*sizeof(float));
+    for (i=0; i<Lh*k; i++)
+        _q->demod.coherent.g[i] = ht[i] * M_PI * _q->h;
+
+    // find significant span of pulse: leading intervals holding less than
+    // 0.5% of the pulse area are not hypothesized (their area is applied
+    // as a lump phase correction instead), and the trellis hypothesizes
+    // enough intervals to cover 99% of the area
+    float area[Lh];
+    float area_total = 0.0f;
+    for (j=0; j<Lh; j++) {
+        area[j] = 0.0f;
+        for (i=0; i<k; i++)
+            area[j] += fabsf(ht[j*k+i]);
+        area_total += area[j];
+    }
+    unsigned int j0 = 0;
+    float        a0 = 0.0f;
+    while (j0 < Lh-1 && a0 + area[j0] < 0.005f*area_total) {
+        a0 += area[j0];
+        j0++;
+    }
+    unsigned int L  = 1;
+    float        a1 = area[j0];
+    while (j0+L < Lh && a1 < 0.99f*area_total - a0) {
+        a1 += area[j0+L];
+        L++;
+    }
+    _q->demod.coherent.j0     = j0;
+    _q->demod.coherent.g_lead = 0.0f;
+    for (i=0; i<j0*k; i++)
+        _q->demod.coherent.g_lead += _q->demod.coherent.g[i];
+
+    // use at least two symbols of memory, limiting number of states
+    if (L < 2) L = 2;
+    unsigned int num_states = 1;
+    for (j=1; j<L; j++) {
+        if (num_states * _q->M > CPFSKDEM_MAX_STATES) {
+            L = j;
+            break;
+        }
+        num_states *= _q->M;
+    }
+    _q->demod.coherent.L          = L;
+    _q->demod.coherent.num_states = num_states;
+
+    // decision depth and survivor path length; the decision depth is
+    // extended so that the overall delay is at least that of the modulator
+    unsigned int D = 5*L;
+    if (j0 + D < mod_delay)
+        D = mod_delay - j0;
+    _q->demod.coherent.D = D;
+    _q->demod.coherent.P = D + 1 > Lh ? D + 1 : Lh;
+    _q->symbol_delay = j0 + D - mod_delay;
+
+    // allocate trellis memory
+    unsigned int P = _q->demod.coherent.P;
+    _q->demod.coherent.metric     = (float*) malloc(num_states  *sizeof(float));
+    _q->demod.coherent.phase      = (float*) malloc(num_states  *sizeof(float));
+    _q->demod.coherent.path       = (float*) malloc(num_states*P*sizeof(float));
+    _q->demod.coherent.metric_new = (float*) malloc(num_states  *sizeof(float));
+    _q->demod.coherent.phase_new  = (float*) malloc(num_states  *sizeof(float));
+    _q->demod.coherent.path_new   = (float*) malloc(num_states*P*sizeof(float));
+    return LIQUID_OK;
 }
 
 // initialize noncoherent demodulator
@@ -262,6 +451,10 @@ int CPFSKDEM(_init_noncoherent)(CPFSKDEM() _q)
     default:
         return liquid_error(LIQUID_EICONFIG,"cpfskdem_init_noncoherent(), invalid tx filter type");
     }
+
+    // phase-difference discriminator, scaled by modulation index such that
+    // output is (phase difference) / (pi h)
+    _q->demod.noncoherent.fdem = freqdem_create(0.5f * _q->h);
     return LIQUID_OK;
 }
 
@@ -275,10 +468,17 @@ int CPFSKDEM(_destroy)(CPFSKDEM() _q)
 #endif
     switch(_q->demod_type) {
     case CPFSKDEM_COHERENT:
-        return liquid_error(LIQUID_EINT,"cpfskdem_destroy(), coherent mode not supported");
+        free(_q->demod.coherent.g);
+        free(_q->demod.coherent.metric);
+        free(_q->demod.coherent.phase);
+        free(_q->demod.coherent.path);
+        free(_q->demod.coherent.metric_new);
+        free(_q->demod.coherent.phase_new);
+        free(_q->demod.coherent.path_new);
         break;
     case CPFSKDEM_NONCOHERENT:
         firfilt_crcf_destroy(_q->demod.noncoherent.mf);
+        freqdem_destroy(_q->demod.noncoherent.fdem);
         break;
     }
 
@@ -299,6 +499,10 @@ int CPFSKDEM(_print)(CPFSKDEM() _q)
     case LIQUID_CPFSK_GMSK:         printf(", type=\"gmsk\"");         break;
     default:;
     }
+    if (_q->demod_type == CPFSKDEM_COHERENT) {
+        printf(", receiver=\"coherent\", states=%u, depth=%u",
+            _q->demod.coherent.num_states, _q->demod.coherent.D);
+    }
     printf(">\n");
     return LIQUID_OK;
 }
@@ -308,9 +512,11 @@ int CPFSKDEM(_reset)(CPFSKDEM() _q)
 {
     switch(_q->demod_type) {
     case CPFSKDEM_COHERENT:
-        firfilt_crcf_reset(_q->demod.noncoherent.mf);
+        CPFSKDEM(_coherent_reset)(_q);
         break;
     case CPFSKDEM_NONCOHERENT:
+        firfilt_crcf_reset(_q->demod.noncoherent.mf);
+        freqdem_reset(_q->demod.noncoherent.fdem);
         break;
     default:
         break;
@@ -318,7 +524,6 @@ int CPFSKDEM(_reset)(CPFSKDEM() _q)
 
     _q->index   = 0;
     _q->counter = _q->k-1;
-    _q->z_prime = 0;
     return LIQUID_OK;
 }
 
@@ -463,14 +668,6 @@ unsigned int CPFSKDEM(_demodulate)(CPFSKDEM() _q,
     return _q->demodulate(_q, _y);
 }
 
-// demodulate array of samples (coherent)
-unsigned int CPFSKDEM(_demodulate_coherent)(CPFSKDEM() _q,
-                                            TC *       _y)
-{
-    liquid_error(LIQUID_EINT,"cpfskdem_demodulate_coherent(), coherent mode not supported");
-    return 0;
-}
-
 // demodulate array of samples (non-coherent)
 unsigned int CPFSKDEM(_demodulate_noncoherent)(CPFSKDEM() _q,
                                                TC *       _y)
@@ -497,20 +694,16 @@ unsigned int CPFSKDEM(_demodulate_noncoherent)(CPFSKDEM() _q,
             firfilt_crcf_execute(_q->demod.noncoherent.mf, &z);
 
             // compute instantaneous frequency scaled by modulation index
-            // TODO: pre-compute scaling factor
-            float phi_hat = cargf(conjf(_q->z_prime) * z) / (_q->h * M_PI);
+            float phi_hat;
+            freqdem_demodulate(_q->demod.noncoherent.fdem, z, &phi_hat);
 
             // estimate transmitted symbol
-            float v = (phi_hat + (_q->M-1.0))*0.5f;
-            sym_out = ((int) roundf(v)) % _q->M;
-
-            // save current point
-            _q->z_prime = z;
+            sym_out = CPFSKDEM(_decide)(_q, phi_hat);
 
 #if DEBUG_CPFSKDEM
             // print result to screen
-            printf("%%  %3u : %12.8f + j%12.8f, <f=%8.4f : %8.4f> (%1u)\n",
-                    _q->index++, crealf(z), cimagf(z), phi_hat, v, sym_out);
+            printf("%%  %3u : %12.8f + j%12.8f, <f=%8.4f> (%1u)\n",
+                    _q->index++, crealf(z), cimagf(z), phi_hat, sym_out);
 #endif
         }
     }
@@ -519,3 +712,153 @@ unsigned int CPFSKDEM(_demodulate_noncoherent)(CPFSKDEM() _q,
 
 #endif
 
+// demodulate block of symbols, assuming perfect timing
+//  _q      :   continuous-phase frequency demodulator object
+//  _y      :   input sample array, [size: _n*_k x 1]
+//  _n      :   number of symbols
+//  _s      :   output symbols, [size: _n x 1]
+int CPFSKDEM(_demodulate_block)(CPFSKDEM()     _q,
+                                TC *           _y,
+                                unsigned int   _n,
+                                unsigned int * _s)
+{
+    unsigned int i, j;
+    if (_q->demod_type != CPFSKDEM_NONCOHERENT) {
+        for (i=0; i<_n; i++)
+            _s[i] = _q->demodulate(_q, &_y[i*_q->k]);
+        return LIQUID_OK;
+    }
+
+    // non-coherent: evaluate matched filter only at the decimated output
+    // points, then run discriminator and decisions over the whole block
+    unsigned int k = _q->k;
+    TC z  [CPFSKDEM_BLOCK_LEN];
+    T  phi[CPFSKDEM_BLOCK_LEN];
+    for (i=0; i<_n; i+=CPFSKDEM_BLOCK_LEN) {
+        unsigned int n = _n - i < CPFSKDEM_BLOCK_LEN ? _n - i : CPFSKDEM_BLOCK_LEN;
+        for (j=0; j<n; j++) {
+            TC * y = &_y[(i+j)*k];
+            firfilt_crcf_push   (_q->demod.noncoherent.mf, y[0]);
+            firfilt_crcf_execute(_q->demod.noncoherent.mf, &z[j]);
+            firfilt_crcf_write  (_q->demod.noncoherent.mf, &y[1], k-1);
+        }
+        freqdem_demodulate_block(_q->demod.noncoherent.fdem, z, n, phi);
+        for (j=0; j<n; j++)
+            _s[i+j] = CPFSKDEM(_decide)(_q, phi[j]);
+    }
+    return LIQUID_OK;
+}
+
+// map soft frequency estimate to nearest symbol, clipping to valid range
+unsigned int CPFSKDEM(_decide)(CPFSKDEM() _q,
+                               float      _phi)
+{
+    float v = (_phi + (float)(_q->M-1))*0.5f;
+    v = v < 0 ? 0 : v;
+    v = v > (float)(_q->M-1) ? (float)(_q->M-1) : v;
+    return (unsigned int) roundf(v);
+}
+
+// reset coherent demodulator trellis
+int CPFSKDEM(_coherent_reset)(CPFSKDEM() _q)
+{
+    // start from a single known state: zero phase and no prior symbols
+    unsigned int i;
+    unsigned int S = _q->demod.coherent.num_states;
+    unsigned int P = _q->demod.coherent.P;
+    for (i=0; i<S; i++) {
+        _q->demod.coherent.metric[i] = i == 0 ? 0.0f : -INFINITY;
+        _q->demod.coherent.phase[i]  = 0.0f;
+    }
+    for (i=0; i<S*P; i++)
+        _q->demod.coherent.path[i] = 0.0f;
+    return LIQUID_OK;
+}
+
+// demodulate array of samples (coherent): run one trellis stage and
+// return the decision at full depth; each branch metric correlates the
+// received symbol against the signal reconstructed from the hypothesized
+// symbol, the state symbols, and the survivor's older symbols and phase
+unsigned int CPFSKDEM(_demodulate_coherent)(CPFSKDEM() _q,
+                                            TC *       _y)
+{
+    unsigned int k  = _q->k;
+    unsigned int M  = _q->M;
+    unsigned int S  = _q->demod.coherent.num_states;
+    unsigned int P  = _q->demod.coherent.P;
+    unsigned int Lh = _q->demod.coherent.Lh;
+    unsigned int j0 = _q->demod.coherent.j0;
+    float        b0 = _q->demod.coherent.b0;
+    float        b1 = _q->demod.coherent.b1;
+    const float * g = _q->demod.coherent.g;
+    float * metric     = _q->demod.coherent.metric;
+    float * phase      = _q->demod.coherent.phase;
+    float * path       = _q->demod.coherent.path;
+    float * metric_new = _q->demod.coherent.metric_new;
+    float * phase_new  = _q->demod.coherent.phase_new;
+    float * path_new   = _q->demod.coherent.path_new;
+
+    unsigned int s, t, u, i, j;
+    for (t=0; t<S; t++)
+        metric_new[t] = -INFINITY;
+
+    float base[k];  // phase increments due to previous symbols
+    float d[k];     // phase increments for branch
+    for (s=0; s<S; s++) {
+        if (metric[s] == -INFINITY)
+            continue;
+
+        // contribution of previous symbols held by this survivor
+        for (i=0; i<k; i++)
+            base[i] = 0.0f;
+        for (j=j0+1; j<Lh; j++) {
+            float v = path[s*P + j-j0-1];
+            for (i=0; i<k; i++)
+                base[i] += v * g[j*k+i];
+        }
+
+        for (u=0; u<M; u++) {
+            // reconstruct phase for hypothesized symbol and correlate
+            float v  = 2.0f*u - (float)M + 1.0f;
+            float S0 = phase[s] + v*_q->demod.coherent.g_lead;
+            float S1;
+            float m  = 0.0f;
+            for (i=0; i<k; i++)
+                d[i] = base[i] + v*g[j0*k+i];
+            for (i=0; i<k; i++) {
+                S1 = S0 + d[i];
+                float theta = b0*S1 + b1*S0;
+                m += crealf(_y[i])*cosf(theta) + cimagf(_y[i])*sinf(theta);
+                S0 = S1;
+            }
+
+            // add-compare-select
+            unsigned int n = (s*M + u) % S;
+            float metric_branch = metric[s] + m;
+            if (metric_branch > metric_new[n]) {
+                metric_new[n] = metric_branch;
+                phase_new[n]  = S0 - 2*M_PI*floorf(S0/(2*M_PI));
+                path_new[n*P] = v;
+                memmove(&path_new[n*P+1], &path[s*P], (P-1)*sizeof(float));
+            }
+        }
+    }
+
+    // find best survivor, normalize metrics, and swap buffers
+    unsigned int s_best = 0;
+    for (t=1; t<S; t++)
+        s_best = metric_new[t] > metric_new[s_best] ? t : s_best;
+    float metric_best = metric_new[s_best];
+    for (t=0; t<S; t++)
+        metric_new[t] -= metric_best;
+    _q->demod.coherent.metric     = metric_new;
+    _q->demod.coherent.phase      = phase_new;
+    _q->demod.coherent.path       = path_new;
+    _q->demod.coherent.metric_new = metric;
+    _q->demod.coherent.phase_new  = phase;
+    _q->demod.coherent.path_new   = path;
+
+    // output decision from best survivor at full decision depth
+    float v = path_new[s_best*P + _q->demod.coherent.D];
+    return CPFSKDEM(_decide)(_q, v);
+}
@@ -26,10 +26,31 @@
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #include <math.h>
 
 #include "liquid.internal.h"
 
+// number of samples processed at a time in block demodulation
+#define FREQDEM_BLOCK_LEN       (64)
+
+// maximum number of arctangent polynomial terms
+#define FREQDEM_ATAN_MAX_TERMS  (7)
+
+// default number of arctangent polynomial terms
+#define FREQDEM_ATAN_DEFAULT    (7)
+
+// Block demodulation evaluates the arctangent with the vectorized math
+// kernels; the requested number of polynomial terms selects the accuracy
+// tier: up to 4 terms uses the fast tier (4-term minimax polynomial),
+// more uses the precise tier.
+#define FREQDEM_ATAN_TIER(TERMS) ((TERMS) <= 4 ? LIQUID_VMATH_FAST : LIQUID_VMATH_PRECISE)
+
+// additional phase error (radians) between block and sample-by-sample
+// demodulation from rounding of the conjugate products and of the
+// reference arctangent
+#define FREQDEM_ATAN_ROUNDING   (5e-7f)
+
 // freqdem
 struct FREQDEM(_s) {
     // common
@@ -37,6 +58,9 @@ struct FREQDEM(_s) {
     T     ref;  // 1/(2*pi*kf)
 
     TC r_prime; // previous received sample
+
+    // block demodulation
+    unsigned int atan_terms;    // number of arctangent terms (0: exact)
 };
 
 // create freqdem object
@@ -56,6 +80,9 @@ FREQDEM() FREQDEM(_create)(float _kf)
     // compute derived values
     q->ref = 1.0f / (2*M_PI*q->kf);
 
+    // set default arctangent approximation for block demodulation
+    q->atan_terms = FREQDEM_ATAN_DEFAULT;
+
     // reset modem object
     FREQDEM(_reset)(q);
 
@@ -63,6 +90,19 @@ FREQDEM() FREQDEM(_create)(float _kf)
     return q;
 }
 
+// copy object
+FREQDEM() FREQDEM(_copy)(FREQDEM() q_orig)
+{
+    // validate input
+    if (q_orig == NULL)
+        return liquid_error_config("freqdem%s_copy(), object cannot be NULL", EXTENSION);
+
+    // create object and copy base parameters
+    FREQDEM() q_copy = (FREQDEM()) malloc(sizeof(struct FREQDEM(_s)));
+    memmove(q_copy, q_orig, sizeof(struct FREQDEM(_s)));
+    return q_copy;
+}
+
 // destroy modem object
 int FREQDEM(_destroy)(FREQDEM() _q)
 {
@@ -74,7 +114,7 @@ int FREQDEM(_destroy)(FREQDEM() _q)
 // print modulation internals
 int FREQDEM(_print)(FREQDEM() _q)
 {
-    printf("<liquid.freqdem, mod_factor=%g>\n", _q->kf);
+    printf("<liquid.freqdem, mod_factor=%g, atan_terms=%u>\n", _q->kf, _q->atan_terms);
     return LIQUID_OK;
 }
 
@@ -102,6 +142,35 @@ int FREQDEM(_demodulate)(FREQDEM() _q,
     return LIQUID_OK;
 }
 
+// set arctangent approximation used in block demodulation
+//  _q      :   frequency demodulator object
+//  _terms  :   number of polynomial terms, 0 uses exact arctangent
+int FREQDEM(_set_atan_terms)(FREQDEM()    _q,
+                             unsigned int _terms)
+{
+    if (_terms == 1 || _terms > FREQDEM_ATAN_MAX_TERMS) {
+        return liquid_error(LIQUID_EICONFIG,"freqdem%s_set_atan_terms(), number of terms (%u) must be 0 or in [2,%u]",
+                EXTENSION, _terms, FREQDEM_ATAN_MAX_TERMS);
+    }
+    _q->atan_terms = _terms;
+    return LIQUID_OK;
+}
+
+// get number of arctangent terms used in block demodulation
+unsigned int FREQDEM(_get_atan_terms)(FREQDEM() _q)
+{
+    return _q->atan_terms;
+}
+
+// get peak difference between block and sample demodulator outputs
+float FREQDEM(_get_block_error)(FREQDEM() _q)
+{
+    if (_q->atan_terms == 0)
+        return 0.0f;
+    int tier = FREQDEM_ATAN_TIER(_q->atan_terms);
+    return (liquid_vmath_get_max_error(LIQUID_VMATH_ATAN2, tier) + FREQDEM_ATAN_ROUNDING) * _q->ref;
+}
+
 // demodulate block of samples
 //  _q      :   frequency demodulator object
 //  _r      :   received signal r(t) [size: _n x 1]
@@ -112,10 +181,28 @@ int FREQDEM(_demodulate_block)(FREQDEM()    _q,
                                unsigned int _n,
                                T *          _m)
 {
-    // TODO: implement more efficient method
     unsigned int i;
-    for (i=0; i<_n; i++)
-        FREQDEM(_demodulate)(_q, _r[i], &_m[i]);
+    if (_q->atan_terms == 0) {
+        for (i=0; i<_n; i++)
+            FREQDEM(_demodulate)(_q, _r[i], &_m[i]);
+        return LIQUID_OK;
+    }
+
+    // conjugate multiply with lagged samples, conj(r[i-1]) * r[i], in
+    // blocks small enough to keep the products on the stack, and compute
+    // the arctangent of the interleaved products directly
+    int tier = FREQDEM_ATAN_TIER(_q->atan_terms);
+    TC  v[FREQDEM_BLOCK_LEN];
+    unsigned int j;
+    for (i=0; i<_n; i+=FREQDEM_BLOCK_LEN) {
+        unsigned int n = _n - i < FREQDEM_BLOCK_LEN ? _n - i : FREQDEM_BLOCK_LEN;
+        v[0] = conjf(_q->r_prime) * _r[i];
+        for (j=1; j<n; j++)
+            v[j] = conjf(_r[i+j-1]) * _r[i+j];
+        liquid_vatan2f_strided((T*)v + 1, (T*)v, 2, n, _m + i, tier);
+        for (j=0; j<n; j++)
+            _m[i+j] *= _q->ref;
+        _q->r_prime = _r[i + n - 1];
+    }
     return LIQUID_OK;
 }
-
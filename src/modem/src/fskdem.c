@@ -31,6 +31,31 @@
 
 #define DEBUG_FSKDEM 0
 
+// maximum number of symbols processed at a time in block demodulation
+#define FSKDEM_BLOCK_LEN (16)
+
+// select pruned transform (tone correlators) when direct evaluation of
+// the M tone bins is cheaper than the full K-point transform; the
+// arbitrary-length transform is costly relative to K log2(K), and the
+// correlator coefficients (M*k samples) should remain cache resident
+#define FSKDEM_PRUNE(M,k,K) ((M)*(k) >= 32 && (M)*(k) <= 65536 && \
+    (float)(M)*(float)(k) < 16.0f*(float)(K)*log2f((float)(K)))
+
+// compute per-tone energies of the current symbol
+int fskdem_compute_energy(fskdem          _q,
+                          float complex * _y,
+                          float *         _energy);
+
+// find symbol with the largest tone energy
+unsigned int fskdem_find_max(fskdem  _q,
+                             float * _energy);
+
+// compute full transform of current symbol if not already available
+int fskdem_update_transform(fskdem _q);
+
+// create tone correlators for pruned transform
+int fskdem_create_correlators(fskdem _q);
+
 // fskdem
 struct fskdem_s {
     // common
@@ -47,8 +72,16 @@ struct fskdem_s {
     FFT_PLAN        fft;        // FFT object
     unsigned int *  demod_map;  // demodulation map
 
+    // pruned transform: correlate input against each of the M tone bins
+    // directly rather than computing the full K-point transform
+    int             pruned;     // use pruned transform?
+    dotprod_cccf *  dp;         // tone correlators [size: M x 1]
+    float *         dp_energy;  // per-tone energies of block [size: FSKDEM_BLOCK_LEN*M x 1]
+    float *         energy;     // per-tone energy of last symbol [size: M x 1]
+
     // state variables
     unsigned int    s_demod;    // demodulated symbol (used for frequency error)
+    int             fft_valid;  // full transform of last symbol computed?
 };
 
 // create fskdem object (frequency demodulator)
@@ -135,6 +168,15 @@ fskdem fskdem_create(unsigned int _m,
     q->buf_freq = (float complex*) FFT_MALLOC(q->K * sizeof(float complex));
     q->fft = FFT_CREATE_PLAN(q->K, q->buf_time, q->buf_freq, FFT_DIR_FORWARD, 0);
 
+    // per-tone energies and pruned transform, enabled automatically when
+    // cheaper than the full transform
+    q->energy = (float*) malloc(q->M * sizeof(float));
+    q->dp        = NULL;
+    q->dp_energy = NULL;
+    q->pruned    = 0;
+    if (FSKDEM_PRUNE(q->M, q->k, q->K))
+        fskdem_set_pruned(q, 1);
+
     // reset modem object
     fskdem_reset(q);
 
@@ -162,8 +204,18 @@ fskdem fskdem_copy(fskdem q_orig)
     memmove(q_copy->buf_time, q_orig->buf_time, q_copy->K * sizeof(float complex));
     memmove(q_copy->buf_freq, q_orig->buf_freq, q_copy->K * sizeof(float complex));
 
-    // copy demodulation map
+    // copy demodulation map and tone energies
     q_copy->demod_map = (unsigned int*)liquid_malloc_copy(q_orig->demod_map, q_copy->M, sizeof(unsigned int));
+    q_copy->energy    = (float *)      liquid_malloc_copy(q_orig->energy,    q_copy->M, sizeof(float));
+
+    // copy tone correlators
+    if (q_orig->dp != NULL) {
+        q_copy->dp = (dotprod_cccf*) malloc(q_copy->M * sizeof(dotprod_cccf));
+        unsigned int i;
+        for (i=0; i<q_copy->M; i++)
+            q_copy->dp[i] = dotprod_cccf_copy(q_orig->dp[i]);
+        q_copy->dp_energy = (float*) malloc(FSKDEM_BLOCK_LEN * q_copy->M * sizeof(float));
+    }
 
     // return new object
     return q_copy;
@@ -172,8 +224,18 @@ fskdem fskdem_copy(fskdem q_orig)
 // destroy fskdem object
 int fskdem_destroy(fskdem _q)
 {
+    // destroy tone correlators
+    unsigned int i;
+    if (_q->dp != NULL) {
+        for (i=0; i<_q->M; i++)
+            dotprod_cccf_destroy(_q->dp[i]);
+        free(_q->dp);
+        free(_q->dp_energy);
+    }
+
     // free allocated arrays
     free(_q->demod_map);
+    free(_q->energy);
     FFT_FREE(_q->buf_time);
     FFT_FREE(_q->buf_freq);
     FFT_DESTROY_PLAN(_q->fft);
@@ -190,6 +252,7 @@ int fskdem_print(fskdem _q)
     printf(", bits/symbol=%u", _q->m);
     printf(", samples/symbol=%u", _q->k);
     printf(", bandwidth=%g", _q->bandwidth);
+    printf(", transform=%s", _q->pruned ? "pruned" : "fft");
     printf(">\n");
     return LIQUID_OK;
 }
@@ -203,42 +266,119 @@ int fskdem_reset(fskdem _q)
         _q->buf_time[i] = 0.0f;
         _q->buf_freq[i] = 0.0f;
     }
+    for (i=0; i<_q->M; i++)
+        _q->energy[i] = 0.0f;
 
     // clear state variables
-    _q->s_demod = 0;
+    _q->s_demod   = 0;
+    _q->fft_valid = 1;
+    return LIQUID_OK;
+}
+
+// enable/disable pruned transform, evaluating only the M tone bins
+//  _q      :   fskdem object
+//  _pruned :   use pruned transform (1) or full FFT (0)
+int fskdem_set_pruned(fskdem _q,
+                      int    _pruned)
+{
+    if (_pruned && _q->dp == NULL)
+        fskdem_create_correlators(_q);
+    _q->pruned = _pruned ? 1 : 0;
     return LIQUID_OK;
 }
 
+// get flag indicating if pruned transform is used
+int fskdem_get_pruned(fskdem _q)
+{
+    return _q->pruned;
+}
+
 // demodulate symbol, assuming perfect symbol timing
 //  _q      :   fskdem object
 //  _y      :   input sample array [size: _k x 1]
 unsigned int fskdem_demodulate(fskdem          _q,
                                float complex * _y)
 {
-    // copy input to internal time buffer
-    memmove(_q->buf_time, _y, _q->k*sizeof(float complex));
-
-    // compute transform, storing result in 'buf_freq'
-    FFT_EXECUTE(_q->fft);
+    // compute tone energies and find maximum
+    fskdem_compute_energy(_q, _y, _q->energy);
+    _q->s_demod = fskdem_find_max(_q, _q->energy);
+    return _q->s_demod;
+}
 
-    // find maximum by looking at particular bins
-    float        vmax  = 0;
-    unsigned int s     = 0;
+// demodulate block of symbols, assuming perfect symbol timing
+//  _q      :   fskdem object
+//  _y      :   input sample array, [size: _n*_k x 1]
+//  _n      :   number of symbols
+//  _s      :   output symbols, [size: _n x 1]
+int fskdem_demodulate_block(fskdem          _q,
+                            float complex * _y,
+                            unsigned int    _n,
+                            unsigned int *  _s)
+{
+    return fskdem_demodulate_soft_block(_q, _y, _n, _s, NULL);
+}
 
-    // run search
-    for (s=0; s<_q->M; s++) {
-        float v = cabsf( _q->buf_freq[_q->demod_map[s]] );
-        if (s==0 || v > vmax) {
-            // save optimal output symbol
-            _q->s_demod = s;
+// demodulate block of symbols with soft outputs (per-tone energies)
+//  _q      :   fskdem object
+//  _y      :   input sample array, [size: _n*_k x 1]
+//  _n      :   number of symbols
+//  _s      :   output symbols, [size: _n x 1]
+//  _energy :   output tone energies (ignored if NULL), [size: _n*M x 1]
+int fskdem_demodulate_soft_block(fskdem          _q,
+                                 float complex * _y,
+                                 unsigned int    _n,
+                                 unsigned int *  _s,
+                                 float *         _energy)
+{
+    if (_n == 0)
+        return LIQUID_OK;
+
+    unsigned int i, j;
+    if (!_q->pruned) {
+        for (i=0; i<_n; i++) {
+            _s[i] = fskdem_demodulate(_q, &_y[i*_q->k]);
+            if (_energy != NULL)
+                memmove(&_energy[i*_q->M], _q->energy, _q->M*sizeof(float));
+        }
+        return LIQUID_OK;
+    }
 
-            // save peak FFT bin value
-            vmax = v;
+    // pruned transform: run each tone correlator over several symbols at
+    // a time so its coefficients stay in cache
+    unsigned int  b = FSKDEM_BLOCK_LEN;
+    float complex v[FSKDEM_BLOCK_LEN];
+    float *       e = _q->dp_energy;
+    for (i=0; i<_n; i+=b) {
+        unsigned int n = _n - i < b ? _n - i : b;
+        unsigned int t;
+        for (t=0; t<_q->M; t++) {
+            for (j=0; j<n; j++)
+                dotprod_cccf_execute(_q->dp[t], &_y[(i+j)*_q->k], &v[j]);
+            for (j=0; j<n; j++)
+                e[j*_q->M + t] = crealf(v[j])*crealf(v[j]) + cimagf(v[j])*cimagf(v[j]);
         }
+        for (j=0; j<n; j++)
+            _s[i+j] = fskdem_find_max(_q, &e[j*_q->M]);
+        if (_energy != NULL)
+            memmove(&_energy[i*_q->M], e, n*_q->M*sizeof(float));
     }
 
-    // save best result
-    return _q->s_demod;
+    // retain state of last symbol
+    memmove(_q->energy, &e[((_n-1) % b)*_q->M], _q->M*sizeof(float));
+    memmove(_q->buf_time, &_y[(_n-1)*_q->k], _q->k*sizeof(float complex));
+    _q->s_demod   = _s[_n-1];
+    _q->fft_valid = 0;
+    return LIQUID_OK;
+}
+
+// get per-tone energies of last demodulated symbol
+//  _q      :   fskdem object
+//  _energy :   output tone energies, [size: M x 1]
+int fskdem_get_tone_energy(fskdem  _q,
+                           float * _energy)
+{
+    memmove(_energy, _q->energy, _q->M*sizeof(float));
+    return LIQUID_OK;
 }
 
 // get demodulator frequency error
@@ -247,6 +387,9 @@ float fskdem_get_frequency_error(fskdem _q)
     // get index of peak bin
     //unsigned int index = _q->buf_freq[ _q->s_demod ];
 
+    // ensure full transform is available
+    fskdem_update_transform(_q);
+
     // extract peak value of previous, post FFT index
     float vm = cabsf(_q->buf_freq[(_q->s_demod+_q->K-1)%_q->K]);  // previous
     float v0 = cabsf(_q->buf_freq[ _q->s_demod               ]);  // peak
@@ -273,6 +416,9 @@ float fskdem_get_symbol_energy(fskdem       _q,
     if (_range > _q->K)
         _range = _q->K;
 
+    // ensure full transform is available
+    fskdem_update_transform(_q);
+
     // map input symbol to FFT bin
     unsigned int index = _q->demod_map[_s];
 
@@ -295,3 +441,75 @@ float fskdem_get_symbol_energy(fskdem       _q,
     return energy;
 }
 
+// compute per-tone energies of the current symbol
+int fskdem_compute_energy(fskdem          _q,
+                          float complex * _y,
+                          float *         _energy)
+{
+    // copy input to internal time buffer
+    memmove(_q->buf_time, _y, _q->k*sizeof(float complex));
+
+    unsigned int s;
+    if (_q->pruned) {
+        // correlate against each tone; full transform deferred until needed
+        float complex v;
+        for (s=0; s<_q->M; s++) {
+            dotprod_cccf_execute(_q->dp[s], _y, &v);
+            _energy[s] = crealf(v)*crealf(v) + cimagf(v)*cimagf(v);
+        }
+        _q->fft_valid = 0;
+    } else {
+        // compute transform, storing result in 'buf_freq'
+        FFT_EXECUTE(_q->fft);
+        for (s=0; s<_q->M; s++) {
+            float complex v = _q->buf_freq[_q->demod_map[s]];
+            _energy[s] = crealf(v)*crealf(v) + cimagf(v)*cimagf(v);
+        }
+        _q->fft_valid = 1;
+    }
+    return LIQUID_OK;
+}
+
+// find symbol with the largest tone energy
+unsigned int fskdem_find_max(fskdem  _q,
+                             float * _energy)
+{
+    unsigned int s, s_max = 0;
+    float        vmax  = _energy[0];
+    for (s=1; s<_q->M; s++) {
+        s_max = _energy[s] > vmax ? s : s_max;
+        vmax  = _energy[s] > vmax ? _energy[s] : vmax;
+    }
+    return s_max;
+}
+
+// compute full transform of current symbol if not already available
+int fskdem_update_transform(fskdem _q)
+{
+    if (_q->fft_valid)
+        return LIQUID_OK;
+
+    // time buffer holds last symbol with zero padding beyond _k samples
+    FFT_EXECUTE(_q->fft);
+    _q->fft_valid = 1;
+    return LIQUID_OK;
+}
+
+// create tone correlators for pruned transform
+int fskdem_create_correlators(fskdem _q)
+{
+    // tone s: X[b] = sum_n y[n] exp(-j 2 pi b n / K), b = demod_map[s]
+    float complex h[_q->k];
+    unsigned int i, n;
+    _q->dp = (dotprod_cccf*) malloc(_q->M * sizeof(dotprod_cccf));
+    for (i=0; i<_q->M; i++) {
+        for (n=0; n<_q->k; n++) {
+            // reduce phase index modulo K for precision
+            unsigned int p = (_q->demod_map[i] * n) % _q->K;
+            h[n] = cexpf(-_Complex_I*2*M_PI*(float)p/(float)(_q->K));
+        }
+        _q->dp[i] = dotprod_cccf_create(h, _q->k);
+    }
+    _q->dp_energy = (float*) malloc(FSKDEM_BLOCK_LEN * _q->M * sizeof(float));
+    return LIQUID_OK;
+}
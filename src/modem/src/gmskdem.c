@@ -36,6 +36,9 @@
 
 #define GMSKDEM_USE_EQUALIZER   0
 
+// maximum number of symbols processed at a time in block demodulation
+#define GMSKDEM_BLOCK_LEN       (64)
+
 int gmskdem_debug_print(gmskdem _q, const char * _filename);
 
 struct gmskdem_s {
@@ -53,7 +56,7 @@ struct gmskdem_s {
     firfilt_rrrf filter;    // receiver matched filter
 #endif
 
-    float complex x_prime;  // received signal state
+    freqdem      fdem;      // phase-difference discriminator
 
     // demodulated symbols counter
     unsigned int num_symbols_demod;
@@ -107,6 +110,9 @@ gmskdem gmskdem_create(unsigned int _k,
     q->filter = firfilt_rrrf_create(q->h, q->h_len);
 #endif
 
+    // phase-difference discriminator, scaled to output radians
+    q->fdem = freqdem_create(0.5f / M_PI);
+
     // reset modem state
     gmskdem_reset(q);
 
@@ -138,6 +144,7 @@ gmskdem gmskdem_copy(gmskdem q_orig)
     // copy interpolator object
     q_copy->filter = firfilt_rrrf_copy(q_orig->filter);
 #endif
+    q_copy->fdem = freqdem_copy(q_orig->fdem);
 
 #if DEBUG_GMSKDEM
     q_copy->debug_mfout = windowf_copy(q_orig->debug_mfout);
@@ -163,6 +170,9 @@ int gmskdem_destroy(gmskdem _q)
     firfilt_rrrf_destroy(_q->filter);
 #endif
 
+    // destroy discriminator
+    freqdem_destroy(_q->fdem);
+
     // free filter array
     free(_q->h);
 
@@ -187,7 +197,7 @@ int gmskdem_print(gmskdem _q)
 int gmskdem_reset(gmskdem _q)
 {
     // reset phase state
-    _q->x_prime = 0.0f;
+    freqdem_reset(_q->fdem);
 
     // set demod. counter to zero
     _q->num_symbols_demod = 0;
@@ -231,8 +241,7 @@ int gmskdem_demodulate(gmskdem         _q,
     float d_hat;
     for (i=0; i<_q->k; i++) {
         // compute phase difference
-        phi = cargf( conjf(_q->x_prime)*_x[i] );
-        _q->x_prime = _x[i];
+        freqdem_demodulate(_q->fdem, _x[i], &phi);
 
         // run through matched filter
 #if GMSKDEM_USE_EQUALIZER
@@ -278,6 +287,46 @@ int gmskdem_demodulate(gmskdem         _q,
     return LIQUID_OK;
 }
 
+// demodulate block of symbols: the phase-difference discriminator runs
+// over all samples at once, and the matched filter is only evaluated at
+// the decimated output points
+int gmskdem_demodulate_block(gmskdem         _q,
+                             float complex * _x,
+                             unsigned int    _n,
+                             unsigned int *  _s)
+{
+#if GMSKDEM_USE_EQUALIZER || DEBUG_GMSKDEM
+    // equalizer and debugging need every filter output
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        gmskdem_demodulate(_q, &_x[i*_q->k], &_s[i]);
+#else
+    unsigned int k = _q->k;
+    float        phi  [GMSKDEM_BLOCK_LEN * k];
+    float        d_hat[GMSKDEM_BLOCK_LEN];
+    unsigned int i, j;
+    for (i=0; i<_n; i+=GMSKDEM_BLOCK_LEN) {
+        unsigned int n = _n - i < GMSKDEM_BLOCK_LEN ? _n - i : GMSKDEM_BLOCK_LEN;
+
+        // compute phase difference for all samples in block
+        freqdem_demodulate_block(_q->fdem, &_x[i*k], n*k, phi);
+
+        // run matched filter, computing output only at first sample of each symbol
+        for (j=0; j<n; j++) {
+            firfilt_rrrf_push   (_q->filter, phi[j*k]);
+            firfilt_rrrf_execute(_q->filter, &d_hat[j]);
+            firfilt_rrrf_write  (_q->filter, &phi[j*k+1], k-1);
+        }
+
+        // make decisions
+        for (j=0; j<n; j++)
+            _s[i+j] = d_hat[j] > 0.0f ? 1 : 0;
+    }
+    _q->num_symbols_demod += _n;
+#endif
+    return LIQUID_OK;
+}
+
 //
 // output debugging file
 //
@@ -64,6 +64,16 @@ int modem_demodulate_soft(modem _q, float complex _x,
         unsigned int * _s, unsigned char * _soft_bits)
     { return modemcf_demodulate_soft(_q, _x, _s, _soft_bits); }
 
+int modem_modulate_block(modem _q, unsigned int * _s, unsigned int _n, float complex * _y)
+    { return modemcf_modulate_block(_q, _s, _n, _y); }
+
+int modem_demodulate_block(modem _q, float complex * _x, unsigned int _n, unsigned int * _s)
+    { return modemcf_demodulate_block(_q, _x, _n, _s); }
+
+int modem_demodulate_soft_block(modem _q, float complex * _x, unsigned int _n,
+        unsigned int * _s, unsigned char * _soft_bits)
+    { return modemcf_demodulate_soft_block(_q, _x, _n, _s, _soft_bits); }
+
 int modem_get_demodulator_sample(modem _q, float complex * _x_hat)
     { return modemcf_get_demodulator_sample(_q, _x_hat); }
 
@@ -64,9 +64,15 @@ MODEM() MODEM(_create_apsk)(unsigned int _bits_per_symbol)
     q->data.apsk.map = (unsigned char *) malloc(q->M*sizeof(unsigned char));
     memmove(q->data.apsk.map, apskdef->map, q->M*sizeof(unsigned char));
 
+    // inverse symbol map for demodulation
+    q->data.apsk.demap = (unsigned char *) malloc(q->M*sizeof(unsigned char));
+    for (i=0; i<q->M; i++)
+        q->data.apsk.demap[q->data.apsk.map[i]] = i;
+
     // set modulation/demodulation function pointers
     q->modulate_func = &MODEM(_modulate_apsk);
     q->demodulate_func = &MODEM(_demodulate_apsk);
+    q->demodulate_block_func = &MODEM(_demodulate_block_apsk);
 
     // initialize soft-demodulation look-up table
     switch (q->m) {
@@ -133,57 +139,57 @@ int MODEM(_demodulate_apsk)(MODEM()        _q,
                             TC             _x,
                             unsigned int * _sym_out)
 {
-    // compute amplitude
-    T r = cabsf(_x);
+    MODEM(_demodulate_block_apsk)(_q, &_x, 1, _sym_out);
 
-    // determine which ring to demodulate with
-    unsigned int i, p=0;
-    for (i=0; i<_q->data.apsk.num_levels-1; i++) {
-        if (r < _q->data.apsk.r_slicer[i]) {
-            p = i;
-            break;
-        } else {
-            p = _q->data.apsk.num_levels-1;
-        }
-    }
+    // re-modulate symbol and store state
+    MODEM(_modulate)(_q, *_sym_out, &_q->x_hat);
+    _q->r = _x;
+    return LIQUID_OK;
+}
 
-    // find closest point in ring
-    T theta = cargf(_x);
-    if (theta < 0.0f) theta += 2.0f*M_PI;
-    T dphi = 2.0f*M_PI / (T) _q->data.apsk.p[p];
-    unsigned int s_hat=0;
-    T i_hat = (theta - _q->data.apsk.phi[p]) / dphi;
-    s_hat = roundf(i_hat);      // compute symbol (closest angle)
-    s_hat %= _q->data.apsk.p[p];   // ensure symbol is in range
-    //printf("          i_hat : %12.8f (%3u)\n", i_hat, s_hat);
-
-    // accumulate symbol points
-    for (i=0; i<p; i++)
-        s_hat += _q->data.apsk.p[i];
-    //assert(s_hat < _q->M);
-
-    // reverse symbol mapping
-    unsigned int s_prime=0;
-    for (i=0; i<_q->M; i++) {
-        if ( _q->data.apsk.map[i] == s_hat) {
-            s_prime = i;
-            break;
-        }
+// demodulate block of APSK samples
+int MODEM(_demodulate_block_apsk)(MODEM()        _q,
+                                  TC *           _x,
+                                  unsigned int   _n,
+                                  unsigned int * _sym_out)
+{
+    unsigned int i;
+    unsigned int num_levels = _q->data.apsk.num_levels;
+
+    // squared slicer radii, index of first symbol in each ring, and
+    // number of symbols per radian in each ring
+    T            r2_slicer[8];
+    unsigned int s0[8];
+    T            g[8];
+    unsigned int t = 0;
+    for (i=0; i<num_levels; i++) {
+        r2_slicer[i] = i < num_levels-1 ? _q->data.apsk.r_slicer[i]*_q->data.apsk.r_slicer[i] : 0;
+        s0[i] = t;
+        g[i]  = (T)(_q->data.apsk.p[i]) / (2.0f*M_PI);
+        t += _q->data.apsk.p[i];
     }
 
-#if 0
-    printf("              x : %12.8f + j*%12.8f\n", crealf(_x), cimagf(_x));
-    printf("              p : %3u\n", p);
-    printf("          theta : %12.8f\n", theta);
-    printf("           dmin : %12.8f\n", dmin);
-    printf("              s : %3u > %3u\n", s_hat, s_prime);
-#endif
-
-    *_sym_out = s_prime;
-
-    // re-modulate symbol and store state
-    MODEM(_modulate)(_q, s_prime, &_q->x_hat);
-    _q->r = _x;
+    for (i=0; i<_n; i++) {
+        T xi = crealf(_x[i]);
+        T xq = cimagf(_x[i]);
+
+        // determine which ring to demodulate with
+        T r2 = xi*xi + xq*xq;
+        unsigned int p = 0;
+        while (p < num_levels-1 && r2 >= r2_slicer[p])
+            p++;
+
+        // find closest point in ring
+        T theta = atan2f(xq, xi);
+        if (theta < 0.0f) theta += 2.0f*M_PI;
+        int k = (int) roundf((theta - _q->data.apsk.phi[p]) * g[p]);
+        int P = (int) _q->data.apsk.p[p];
+        k %= P;
+        if (k < 0) k += P;  // ensure symbol is in range
+
+        // reverse symbol mapping
+        _sym_out[i] = _q->data.apsk.demap[s0[p] + k];
+    }
     return LIQUID_OK;
 }
 
@@ -55,6 +55,7 @@ MODEM() MODEM(_create_ask)(unsigned int _bits_per_symbol)
 
     q->modulate_func = &MODEM(_modulate_ask);
     q->demodulate_func = &MODEM(_demodulate_ask);
+    q->demodulate_block_func = &MODEM(_demodulate_block_ask);
 
     // initialize soft-demodulation look-up table
     if (q->m >= 2 && q->m < 8)
@@ -97,3 +98,12 @@ int MODEM(_demodulate_ask)(MODEM()        _q,
     return LIQUID_OK;
 }
 
+// demodulate block of ASK samples
+int MODEM(_demodulate_block_ask)(MODEM()        _q,
+                                 TC *           _x,
+                                 unsigned int   _n,
+                                 unsigned int * _sym_out)
+{
+    // demodulate in-phase component on linearly-spaced array
+    return MODEM(_demodulate_linear_block)((const T *) _x, 2, _n, _q->m, _q->ref, _sym_out);
+}
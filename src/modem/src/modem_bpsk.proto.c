@@ -42,6 +42,7 @@ MODEM() MODEM(_create_bpsk)()
 
     q->modulate_func   = &MODEM(_modulate_bpsk);
     q->demodulate_func = &MODEM(_demodulate_bpsk);
+    q->demodulate_block_func = &MODEM(_demodulate_block_bpsk);
 
     // reset and return
     MODEM(_reset)(q);
@@ -72,6 +73,19 @@ int MODEM(_demodulate_bpsk)(MODEM()        _q,
     return LIQUID_OK;
 }
 
+// demodulate block of BPSK samples
+int MODEM(_demodulate_block_bpsk)(MODEM()        _q,
+                                  TC *           _x,
+                                  unsigned int   _n,
+                                  unsigned int * _sym_out)
+{
+    // slice directly to output symbols
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        _sym_out[i] = (crealf(_x[i]) > 0 ) ? 0 : 1;
+    return LIQUID_OK;
+}
+
 // demodulate BPSK (soft)
 int MODEM(_demodulate_soft_bpsk)(MODEM()         _q,
                                  TC              _x,
@@ -30,6 +30,9 @@
 
 #define DEBUG_DEMODULATE_SOFT 0
 
+// number of samples processed at a time by block demodulators
+#define MODEM_BLOCK_LEN (64)
+
 // modem structure used for both modulation and demodulation 
 //
 // The modem structure implements a variety of common modulation schemes,
@@ -100,6 +103,7 @@ struct MODEM(_s)
             T r_slicer[8];              // slicer radii of levels
             T phi[8];                   // phase offset of levels
             unsigned char * map;        // symbol mapping (allocated)
+            unsigned char * demap;      // inverse symbol mapping (allocated)
         } apsk;
 
         // 'square' 32-QAM
@@ -128,6 +132,12 @@ struct MODEM(_s)
                            TC _x,
                            unsigned int * _symbol_out);
 
+    // block demodulate function pointer (optional)
+    int (*demodulate_block_func)(MODEM()        _q,
+                                 TC *           _x,
+                                 unsigned int   _n,
+                                 unsigned int * _symbol_out);
+
     // soft demodulation
     //int demodulate_soft;    // soft demodulation flag
     // neighbors array
@@ -290,6 +300,7 @@ int MODEM(_destroy)(MODEM() _q)
         free(_q->data.sqam128.map);
     } else if (liquid_modem_is_apsk(_q->scheme)) {
         free(_q->data.apsk.map);
+        free(_q->data.apsk.demap);
     }
 
     // free main object memory
@@ -339,6 +350,7 @@ int MODEM(_init)(MODEM()      _q,
     // set function pointers initially to NULL
     _q->modulate_func = NULL;
     _q->demodulate_func = NULL;
+    _q->demodulate_block_func = NULL;
 
     // soft demodulation
     _q->demod_soft_neighbors = NULL;
@@ -459,6 +471,149 @@ int MODEM(_demodulate_soft)(MODEM() _q,
     return liquid_unpack_soft_bits(symbol_out, _q->m, _soft_bits);
 }
 
+// modulate block of symbols
+//  _q          :   modem object
+//  _s          :   input symbols [size: _n x 1]
+//  _n          :   number of symbols
+//  _y          :   output samples [size: _n x 1]
+int MODEM(_modulate_block)(MODEM()        _q,
+                           unsigned int * _s,
+                           unsigned int   _n,
+                           TC *           _y)
+{
+    // validate input; constellation size is a power of two so any
+    // symbol out of range sets a bit at or above M
+    unsigned int i;
+    unsigned int s_or = 0;
+    for (i=0; i<_n; i++)
+        s_or |= _s[i];
+    if (s_or >= _q->M)
+        return liquid_error(LIQUID_EICONFIG,"modem%s_modulate_block(), input symbol exceeds constellation size", EXTENSION);
+
+    if (_q->modulate_using_map) {
+        // gather directly from map (look-up table)
+        const TC * map = _q->symbol_map;
+        for (i=0; i<_n; i++)
+            _y[i] = map[_s[i]];
+    } else {
+        // invoke method specific to scheme (e.g. differential modems)
+        for (i=0; i<_n; i++)
+            _q->modulate_func(_q, _s[i], &_y[i]);
+    }
+    return LIQUID_OK;
+}
+
+// demodulate block of samples
+//  _q          :   modem object
+//  _x          :   input samples [size: _n x 1]
+//  _n          :   number of samples
+//  _s          :   output hard symbols [size: _n x 1]
+int MODEM(_demodulate_block)(MODEM()        _q,
+                             TC *           _x,
+                             unsigned int   _n,
+                             unsigned int * _s)
+{
+    unsigned int i;
+    if (_q->demodulate_block_func == NULL || _n == 0) {
+        // invoke method specific to scheme for each sample
+        for (i=0; i<_n; i++)
+            _q->demodulate_func(_q, _x[i], &_s[i]);
+        return LIQUID_OK;
+    }
+
+    // demodulate all but the last sample with the block method, and
+    // the last with the regular method to keep the demodulator state
+    _q->demodulate_block_func(_q, _x, _n-1, _s);
+    return _q->demodulate_func(_q, _x[_n-1], &_s[_n-1]);
+}
+
+// demodulate block of samples, computing soft bits
+//  _q          :   modem object
+//  _x          :   input samples [size: _n x 1]
+//  _n          :   number of samples
+//  _s          :   output hard symbols [size: _n x 1]
+//  _soft_bits  :   output soft bits [size: _n*bps x 1]
+int MODEM(_demodulate_soft_block)(MODEM()         _q,
+                                  TC *            _x,
+                                  unsigned int    _n,
+                                  unsigned int  * _s,
+                                  unsigned char * _soft_bits)
+{
+    // dispatch on scheme once for the whole block
+    int (*demodulate_soft)(MODEM(), TC, unsigned int *, unsigned char *) = NULL;
+    switch (_q->scheme) {
+    case LIQUID_MODEM_ARB:      demodulate_soft = MODEM(_demodulate_soft_arb);      break;
+    case LIQUID_MODEM_BPSK:     demodulate_soft = MODEM(_demodulate_soft_bpsk);     break;
+    case LIQUID_MODEM_QPSK:     demodulate_soft = MODEM(_demodulate_soft_qpsk);     break;
+    case LIQUID_MODEM_PI4DQPSK: demodulate_soft = MODEM(_demodulate_soft_pi4dqpsk); break;
+    default:
+        if (_q->demod_soft_neighbors != NULL && _q->demod_soft_p != 0)
+            demodulate_soft = MODEM(_demodulate_soft_table);
+    }
+
+    unsigned int i;
+    if (demodulate_soft != NULL) {
+        for (i=0; i<_n; i++)
+            demodulate_soft(_q, _x[i], &_s[i], &_soft_bits[i*_q->m]);
+        return LIQUID_OK;
+    }
+
+    // demodulate normally and simply copy the hard-demodulated bits
+    MODEM(_demodulate_block)(_q, _x, _n, _s);
+    for (i=0; i<_n; i++)
+        liquid_unpack_soft_bits(_s[i], _q->m, &_soft_bits[i*_q->m]);
+    return LIQUID_OK;
+}
+
+// Demodulate block of values on a linearly-spaced array by successive
+// approximation exactly as MODEM(_demodulate_linear_array_ref), so that
+// decisions agree bit-for-bit, even for values on a decision boundary.
+// Values are gathered into fixed-length, zero-padded blocks and each bit
+// is resolved with a branch-free pass over the block so that the slicer
+// loop has a constant trip count and can be vectorized by the compiler.
+//  _v      :   input values [size: _n x 1, stride: _stride]
+//  _stride :   input stride
+//  _n      :   number of values
+//  _m      :   bits per symbol
+//  _ref    :   array of thresholds [size: _m x 1]
+//  _k      :   output indices, Gray decoded [size: _n x 1]
+int MODEM(_demodulate_linear_block)(const T *      _v,
+                                    unsigned int   _stride,
+                                    unsigned int   _n,
+                                    unsigned int   _m,
+                                    const T *      _ref,
+                                    unsigned int * _k)
+{
+    T            v[MODEM_BLOCK_LEN];
+    unsigned int k[MODEM_BLOCK_LEN];
+    unsigned int i, j, b;
+    for (i=0; i<_n; i+=MODEM_BLOCK_LEN) {
+        unsigned int n = _n - i < MODEM_BLOCK_LEN ? _n - i : MODEM_BLOCK_LEN;
+        for (j=0; j<n; j++)
+            v[j] = _v[(i+j)*_stride];
+        for (j=n; j<MODEM_BLOCK_LEN; j++)
+            v[j] = 0;
+        for (j=0; j<MODEM_BLOCK_LEN; j++)
+            k[j] = 0;
+
+        // resolve one bit at a time, most significant first
+        for (b=0; b<_m; b++) {
+            T r = _ref[_m-b-1];
+            for (j=0; j<MODEM_BLOCK_LEN; j++) {
+                unsigned int d = v[j] > 0 ? 1 : 0;
+                k[j] = (k[j] << 1) | d;
+                v[j] += d ? -r : r;
+            }
+        }
+
+        // 'decode' output symbol (actually gray encoding)
+        for (j=0; j<MODEM_BLOCK_LEN; j++)
+            k[j] ^= k[j] >> 1;
+        memmove(&_k[i], k, n*sizeof(unsigned int));
+    }
+    return LIQUID_OK;
+}
+
 #if DEBUG_DEMODULATE_SOFT
 // print a string of bits to the standard output
 void print_bitstring_demod_soft(unsigned int _x,
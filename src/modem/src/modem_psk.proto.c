@@ -59,6 +59,7 @@ MODEM() MODEM(_create_psk)(unsigned int _bits_per_symbol)
     // set modulation/demodulation functions
     q->modulate_func = &MODEM(_modulate_psk);
     q->demodulate_func = &MODEM(_demodulate_psk);
+    q->demodulate_block_func = &MODEM(_demodulate_block_psk);
 
     // initialize symbol map
     q->symbol_map = (TC*)malloc(q->M*sizeof(TC));
@@ -112,3 +113,25 @@ int MODEM(_demodulate_psk)(MODEM()        _q,
     return LIQUID_OK;
 }
 
+// demodulate block of PSK samples
+int MODEM(_demodulate_block_psk)(MODEM()        _q,
+                                 TC *           _x,
+                                 unsigned int   _n,
+                                 unsigned int * _sym_out)
+{
+    T theta[MODEM_BLOCK_LEN];
+    unsigned int i, j;
+    for (i=0; i<_n; i+=MODEM_BLOCK_LEN) {
+        unsigned int n = _n - i < MODEM_BLOCK_LEN ? _n - i : MODEM_BLOCK_LEN;
+
+        // compute angle and subtract phase offset, ensuring phase is in [-pi,pi)
+        for (j=0; j<n; j++) {
+            T t = cargf(_x[i+j]) - _q->data.psk.d_phi;
+            theta[j] = t < -M_PI ? t + 2*M_PI : t;
+        }
+
+        // demodulate on linearly-spaced array
+        MODEM(_demodulate_linear_block)(theta, 1, n, _q->m, _q->ref, &_sym_out[i]);
+    }
+    return LIQUID_OK;
+}
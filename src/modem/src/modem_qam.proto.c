@@ -81,6 +81,7 @@ MODEM() MODEM(_create_qam)(unsigned int _bits_per_symbol)
 
     q->modulate_func = &MODEM(_modulate_qam);
     q->demodulate_func = &MODEM(_demodulate_qam);
+    q->demodulate_block_func = &MODEM(_demodulate_block_qam);
 
     // initialize symbol map
     q->symbol_map = (TC*)malloc(q->M*sizeof(TC));
@@ -142,3 +143,24 @@ int MODEM(_demodulate_qam)(MODEM()        _q,
     return LIQUID_OK;
 }
 
+// demodulate block of QAM samples
+int MODEM(_demodulate_block_qam)(MODEM()        _q,
+                                 TC *           _x,
+                                 unsigned int   _n,
+                                 unsigned int * _sym_out)
+{
+    const T * v = (const T *) _x;   // interleaved in-phase, quadrature
+    unsigned int s_i[MODEM_BLOCK_LEN];  // in-phase indices
+    unsigned int s_q[MODEM_BLOCK_LEN];  // quadrature indices
+    unsigned int i, j;
+    for (i=0; i<_n; i+=MODEM_BLOCK_LEN) {
+        unsigned int n = _n - i < MODEM_BLOCK_LEN ? _n - i : MODEM_BLOCK_LEN;
+        MODEM(_demodulate_linear_block)(v + 2*i + 0, 2, n, _q->data.qam.m_i, _q->ref, s_i);
+        MODEM(_demodulate_linear_block)(v + 2*i + 1, 2, n, _q->data.qam.m_q, _q->ref, s_q);
+
+        // combine gray-decoded in-phase and quadrature indices
+        for (j=0; j<n; j++)
+            _sym_out[i+j] = (s_i[j] << _q->data.qam.m_q) | s_q[j];
+    }
+    return LIQUID_OK;
+}
@@ -42,6 +42,7 @@ MODEM() MODEM(_create_qpsk)()
 
     q->modulate_func   = &MODEM(_modulate_qpsk);
     q->demodulate_func = &MODEM(_demodulate_qpsk);
+    q->demodulate_block_func = &MODEM(_demodulate_block_qpsk);
 
     // reset and return
     MODEM(_reset)(q);
@@ -75,6 +76,21 @@ int MODEM(_demodulate_qpsk)(MODEM() _q,
     return LIQUID_OK;
 }
 
+// demodulate block of QPSK samples
+int MODEM(_demodulate_block_qpsk)(MODEM()        _q,
+                                  TC *           _x,
+                                  unsigned int   _n,
+                                  unsigned int * _sym_out)
+{
+    // slice directly to output symbols
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        _sym_out[i] = (crealf(_x[i]) > 0 ? 0 : 1) +
+                      (cimagf(_x[i]) > 0 ? 0 : 2);
+    }
+    return LIQUID_OK;
+}
+
 // demodulate QPSK (soft)
 int MODEM(_demodulate_soft_qpsk)(MODEM()         _q,
                                   TC              _x,
@@ -123,3 +123,87 @@ void autotest_ampmodem_usb_carrier_off() { ampmodem_test_harness(0.8f,LIQUID_AMP
 void autotest_ampmodem_lsb_carrier_off() { ampmodem_test_harness(0.8f,LIQUID_AMPMODEM_LSB,1,0.00,0.0); }
 
 
+
+// block method under test, applied to [_i, _i+_n) of the buffers
+typedef void (*ampmodem_block_callback)(ampmodem     _q,
+                                        void *       _x,
+                                        void *       _y,
+                                        unsigned int _i,
+                                        unsigned int _n);
+
+// split _num_samples into irregular chunks and invoke _callback on each
+static void ampmodem_test_blocks(ampmodem                _q,
+                                 void *                  _x,
+                                 void *                  _y,
+                                 unsigned int            _num_samples,
+                                 ampmodem_block_callback _callback)
+{
+    unsigned int block_sizes[] = {1, 7, 300, 513, 2, 1000};
+    unsigned int i, n, k=0;
+    for (i=0; i<_num_samples; i+=n) {
+        n = block_sizes[k++ % 6];
+        n = i + n > _num_samples ? _num_samples - i : n;
+        _callback(_q, _x, _y, i, n);
+    }
+}
+
+static void ampmodem_modulate_chunk(ampmodem _q, void * _x, void * _y, unsigned int _i, unsigned int _n)
+    { ampmodem_modulate_block(_q, (float*)_x + _i, _n, (float complex*)_y + _i); }
+
+static void ampmodem_demodulate_chunk(ampmodem _q, void * _x, void * _y, unsigned int _i, unsigned int _n)
+    { ampmodem_demodulate_block(_q, (float complex*)_x + _i, _n, (float*)_y + _i); }
+
+// Help function to compare block methods against single-sample methods
+void ampmodem_test_block(liquid_ampmodem_type _type,
+                         int                  _suppressed_carrier)
+{
+    unsigned int num_samples = 1200;
+    // create mod/demod objects
+    ampmodem mod_0   = ampmodem_create(0.8f, _type, _suppressed_carrier);
+    ampmodem mod_1   = ampmodem_create(0.8f, _type, _suppressed_carrier);
+    ampmodem demod_0 = ampmodem_create(0.8f, _type, _suppressed_carrier);
+    ampmodem demod_1 = ampmodem_create(0.8f, _type, _suppressed_carrier);
+
+    unsigned int i;
+    float         msg_in [num_samples];
+    float complex x_0    [num_samples];
+    float complex x_1    [num_samples];
+    float complex y      [num_samples];
+    float         msg_0  [num_samples];
+    float         msg_1  [num_samples];
+    for (i=0; i<num_samples; i++)
+        msg_in[i] = 0.6f*cosf(0.031f*i) + 0.4f*cosf(0.024f*i);
+
+    // modulate
+    for (i=0; i<num_samples; i++)
+        ampmodem_modulate(mod_0, msg_in[i], &x_0[i]);
+    ampmodem_test_blocks(mod_1, msg_in, x_1, num_samples, ampmodem_modulate_chunk);
+    for (i=0; i<num_samples; i++) {
+        CONTEND_DELTA(crealf(x_0[i]), crealf(x_1[i]), 1e-6f);
+        CONTEND_DELTA(cimagf(x_0[i]), cimagf(x_1[i]), 1e-6f);
+    }
+
+    // add carrier offset and noise
+    for (i=0; i<num_samples; i++)
+        y[i] = x_0[i]*cexpf(_Complex_I*0.002f*i) + 0.01f*(randnf() + _Complex_I*randnf());
+
+    // demodulate
+    for (i=0; i<num_samples; i++)
+        ampmodem_demodulate(demod_0, y[i], &msg_0[i]);
+    ampmodem_test_blocks(demod_1, y, msg_1, num_samples, ampmodem_demodulate_chunk);
+    for (i=0; i<num_samples; i++)
+        CONTEND_DELTA(msg_0[i], msg_1[i], 1e-6f);
+
+    // destroy objects
+    ampmodem_destroy(mod_0);
+    ampmodem_destroy(mod_1);
+    ampmodem_destroy(demod_0);
+    ampmodem_destroy(demod_1);
+}
+
+void autotest_ampmodem_block_dsb_carrier_on () { ampmodem_test_block(LIQUID_AMPMODEM_DSB,0); }
+void autotest_ampmodem_block_usb_carrier_on () { ampmodem_test_block(LIQUID_AMPMODEM_USB,0); }
+void autotest_ampmodem_block_lsb_carrier_on () { ampmodem_test_block(LIQUID_AMPMODEM_LSB,0); }
+void autotest_ampmodem_block_dsb_carrier_off() { ampmodem_test_block(LIQUID_AMPMODEM_DSB,1); }
+void autotest_ampmodem_block_usb_carrier_off() { ampmodem_test_block(LIQUID_AMPMODEM_USB,1); }
+void autotest_ampmodem_block_lsb_carrier_off() { ampmodem_test_block(LIQUID_AMPMODEM_LSB,1); }
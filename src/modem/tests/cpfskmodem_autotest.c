@@ -139,6 +139,116 @@ void autotest_cpfskmodem_bps1_h0p5_k4_m7_gmsk() { cpfskmodem_test_harness( 1, 0.
 void autotest_cpfskmodem_bps1_h0p5_k6_m7_gmsk() { cpfskmodem_test_harness( 1, 0.5f, 6, 7, 0.30f, LIQUID_CPFSK_GMSK ); }
 void autotest_cpfskmodem_bps1_h0p5_k8_m7_gmsk() { cpfskmodem_test_harness( 1, 0.5f, 8, 7, 0.30f, LIQUID_CPFSK_GMSK ); }
 
+// Help function to keep code base small
+void cpfskmodem_test_harness_coherent(unsigned int _bps,
+                                      float        _h,
+                                      unsigned int _k,
+                                      unsigned int _m,
+                                      float        _beta,
+                                      int          _filter_type)
+{
+    // create modulator/demodulator pair
+    cpfskmod mod = cpfskmod_create         (_bps, _h, _k, _m, _beta, _filter_type);
+    cpfskdem dem = cpfskdem_create_coherent(_bps, _h, _k, _m, _beta, _filter_type);
+
+    // run modulation/demodulation tests
+    cpfskmodem_test_mod_demod(mod, dem);
+
+    // clean it up
+    cpfskmod_destroy(mod);
+    cpfskdem_destroy(dem);
+}
+
+//
+// AUTOTESTS: coherent demodulator
+//
+void autotest_cpfskmodem_coherent_bps1_h0p5_square()    { cpfskmodem_test_harness_coherent( 1, 0.50f, 4, 3, 0.25f, LIQUID_CPFSK_SQUARE      ); }
+void autotest_cpfskmodem_coherent_bps1_h0p25_square()   { cpfskmodem_test_harness_coherent( 1, 0.25f, 4, 3, 0.25f, LIQUID_CPFSK_SQUARE      ); }
+void autotest_cpfskmodem_coherent_bps1_h0p5_rcosfull()  { cpfskmodem_test_harness_coherent( 1, 0.50f, 4, 3, 0.25f, LIQUID_CPFSK_RCOS_FULL   ); }
+void autotest_cpfskmodem_coherent_bps1_h0p5_rcospart()  { cpfskmodem_test_harness_coherent( 1, 0.50f, 4, 3, 0.25f, LIQUID_CPFSK_RCOS_PARTIAL); }
+void autotest_cpfskmodem_coherent_bps1_h0p5_gmsk()      { cpfskmodem_test_harness_coherent( 1, 0.50f, 4, 3, 0.25f, LIQUID_CPFSK_GMSK        ); }
+void autotest_cpfskmodem_coherent_bps1_h0p5_k8_m7_gmsk(){ cpfskmodem_test_harness_coherent( 1, 0.50f, 8, 7, 0.30f, LIQUID_CPFSK_GMSK        ); }
+void autotest_cpfskmodem_coherent_bps2_h0p25_square()   { cpfskmodem_test_harness_coherent( 2, 0.25f, 4, 3, 0.25f, LIQUID_CPFSK_SQUARE      ); }
+
+// count symbol errors in noise
+//  _coherent   :   use coherent demodulator
+//  _SNRdB      :   signal-to-noise ratio [dB]
+unsigned int cpfskmodem_count_errors(int _coherent, float _SNRdB)
+{
+    unsigned int bps = 1, k = 4, m = 3, num_symbols = 4000;
+    float        h = 0.5f, BT = 0.3f;
+    cpfskmod mod = cpfskmod_create(bps, h, k, m, BT, LIQUID_CPFSK_GMSK);
+    cpfskdem dem = _coherent ?
+        cpfskdem_create_coherent(bps, h, k, m, BT, LIQUID_CPFSK_GMSK) :
+        cpfskdem_create         (bps, h, k, m, BT, LIQUID_CPFSK_GMSK);
+    unsigned int delay = cpfskmod_get_delay(mod) + cpfskdem_get_delay(dem);
+
+    float nstd = sqrtf(0.5f * k * powf(10.0f, -_SNRdB/10.0f));
+    float complex buf[k*num_symbols];
+    unsigned int  sym_in [num_symbols];
+    unsigned int  sym_out[num_symbols];
+    unsigned int  i, num_errors = 0;
+    for (i=0; i<num_symbols; i++) {
+        sym_in[i] = rand() & 1;
+        cpfskmod_modulate(mod, sym_in[i], &buf[i*k]);
+    }
+    for (i=0; i<k*num_symbols; i++)
+        buf[i] += nstd*(randnf() + _Complex_I*randnf());
+    cpfskdem_demodulate_block(dem, buf, num_symbols, sym_out);
+    for (i=delay; i<num_symbols; i++)
+        num_errors += sym_in[i-delay] == sym_out[i] ? 0 : 1;
+
+    cpfskmod_destroy(mod);
+    cpfskdem_destroy(dem);
+    return num_errors;
+}
+
+// coherent detection should be substantially more sensitive
+void autotest_cpfskmodem_coherent_sensitivity()
+{
+    unsigned int num_errors_coherent    = cpfskmodem_count_errors(1, 7.0f);
+    unsigned int num_errors_noncoherent = cpfskmodem_count_errors(0, 7.0f);
+    if (liquid_autotest_verbose)
+        printf("errors: coherent=%u, non-coherent=%u\n", num_errors_coherent, num_errors_noncoherent);
+    CONTEND_LESS_THAN(num_errors_coherent, 40);
+    CONTEND_LESS_THAN(4*num_errors_coherent, num_errors_noncoherent);
+}
+
+// test block demodulation against symbol-by-symbol demodulation
+void cpfskdem_test_block(int _coherent)
+{
+    unsigned int bps = 2, k = 4, m = 3, num_symbols = 300;
+    float        h = 0.25f, beta = 0.35f;
+    int          type = LIQUID_CPFSK_RCOS_PARTIAL;
+    cpfskmod mod   = cpfskmod_create(bps, h, k, m, beta, type);
+    cpfskdem dem_0 = _coherent ? cpfskdem_create_coherent(bps, h, k, m, beta, type) :
+                                 cpfskdem_create         (bps, h, k, m, beta, type);
+    cpfskdem dem_1 = cpfskdem_copy(dem_0);
+
+    float complex buf[k*num_symbols];
+    unsigned int  sym_0[num_symbols];
+    unsigned int  sym_1[num_symbols];
+    unsigned int  i;
+    for (i=0; i<num_symbols; i++)
+        cpfskmod_modulate(mod, rand() % 4, &buf[i*k]);
+    for (i=0; i<k*num_symbols; i++)
+        buf[i] += 0.2f*(randnf() + _Complex_I*randnf());
+
+    // symbol by symbol, then in uneven blocks
+    for (i=0; i<num_symbols; i++)
+        sym_0[i] = cpfskdem_demodulate(dem_0, &buf[i*k]);
+    CONTEND_EQUALITY(cpfskdem_demodulate_block(dem_1, buf,        7,               sym_1    ), LIQUID_OK);
+    CONTEND_EQUALITY(cpfskdem_demodulate_block(dem_1, buf +  7*k, 100,             sym_1 + 7), LIQUID_OK);
+    CONTEND_EQUALITY(cpfskdem_demodulate_block(dem_1, buf + 107*k, num_symbols-107, sym_1 + 107), LIQUID_OK);
+    CONTEND_SAME_DATA(sym_0, sym_1, num_symbols*sizeof(unsigned int));
+
+    cpfskmod_destroy(mod);
+    cpfskdem_destroy(dem_0);
+    cpfskdem_destroy(dem_1);
+}
+void autotest_cpfskdem_block_noncoherent() { cpfskdem_test_block(0); }
+void autotest_cpfskdem_block_coherent()    { cpfskdem_test_block(1); }
+
 // test spectral response
 void autotest_cpfskmodem_spectrum()
 {
@@ -221,6 +331,8 @@ void autotest_cpfskmodem_config()
     CONTEND_ISNULL( cpfskdem_create(1, 0.5f, 4, 12, 0.00f, LIQUID_CPFSK_SQUARE) ); // _beta is too small
     CONTEND_ISNULL( cpfskdem_create(1, 0.5f, 4, 12, 7.22f, LIQUID_CPFSK_SQUARE) ); // _beta is too large
     CONTEND_ISNULL( cpfskdem_create(1, 0.5f, 4, 12, 0.25f, -1) ); // invalid filter type
+    CONTEND_ISNULL( cpfskdem_create_coherent(1, 0.5f, 5, 12, 0.25f, LIQUID_CPFSK_SQUARE) ); // _k is not even
+    CONTEND_ISNULL( cpfskdem_create_coherent(1, 0.5f, 4, 12, 0.25f, -1) ); // invalid filter type
 
     // create modulator object and check configuration
     cpfskmod mod = cpfskmod_create(1, 0.5f, 4, 12, 0.5f, LIQUID_CPFSK_SQUARE);
@@ -231,5 +343,10 @@ void autotest_cpfskmodem_config()
     cpfskdem dem = cpfskdem_create(1, 0.5f, 4, 12, 0.5f, LIQUID_CPFSK_SQUARE);
     CONTEND_EQUALITY( LIQUID_OK, cpfskdem_print(dem) );
     cpfskdem_destroy(dem);
+
+    // create coherent demodulator object and check configuration
+    dem = cpfskdem_create_coherent(1, 0.5f, 4, 12, 0.5f, LIQUID_CPFSK_GMSK);
+    CONTEND_EQUALITY( LIQUID_OK, cpfskdem_print(dem) );
+    cpfskdem_destroy(dem);
 }
 
@@ -69,3 +69,62 @@ void autotest_freqmodem_kf_0_02() { freqmodem_test(0.02f); }
 void autotest_freqmodem_kf_0_04() { freqmodem_test(0.04f); }
 void autotest_freqmodem_kf_0_08() { freqmodem_test(0.08f); }
 
+
+// compare block demodulation against sample-by-sample demodulation
+//  _terms  :   number of arctangent polynomial terms
+void freqdem_test_block(unsigned int _terms)
+{
+    unsigned int i, num_samples = 1000;
+    float kf = 0.1f;
+
+    // create demodulators; exact reference and block approximation
+    freqdem dem_0 = freqdem_create(kf);
+    freqdem dem_1 = freqdem_create(kf);
+    CONTEND_EQUALITY(freqdem_set_atan_terms(dem_1, _terms), LIQUID_OK);
+    CONTEND_EQUALITY(freqdem_get_atan_terms(dem_1), _terms);
+    float tol = freqdem_get_block_error(dem_1);
+
+    // random input signal, including zeros and axis-aligned samples
+    float complex r[num_samples];
+    for (i=0; i<num_samples; i++)
+        r[i] = (0.01f + randf()) * cexpf(_Complex_I*2*M_PI*randf());
+    r[10] = 0; r[11] = 1; r[12] = -1; r[13] = _Complex_I; r[14] = -1; r[15] = -_Complex_I;
+
+    // demodulate in uneven pieces to exercise internal blocking and state
+    float y0[num_samples], y1[num_samples];
+    for (i=0; i<num_samples; i++)
+        freqdem_demodulate(dem_0, r[i], &y0[i]);
+    freqdem_demodulate_block(dem_1, r,       1,                 y1);
+    freqdem_demodulate_block(dem_1, r +   1, 200,               y1 +   1);
+    freqdem_demodulate_block(dem_1, r + 201, num_samples - 201, y1 + 201);
+
+    for (i=0; i<num_samples; i++)
+        CONTEND_DELTA( y1[i], y0[i], tol );
+
+    freqdem_destroy(dem_0);
+    freqdem_destroy(dem_1);
+}
+
+void autotest_freqdem_block_exact()   { freqdem_test_block(0); }
+void autotest_freqdem_block_terms2()  { freqdem_test_block(2); }
+void autotest_freqdem_block_terms4()  { freqdem_test_block(4); }
+void autotest_freqdem_block_terms7()  { freqdem_test_block(7); }
+
+void autotest_freqdem_config()
+{
+#if LIQUID_STRICT_EXIT
+    AUTOTEST_WARN("skipping freqdem config test with strict exit enabled\n");
+    return;
+#endif
+#if !LIQUID_SUPPRESS_ERROR_OUTPUT
+    fprintf(stderr,"warning: ignore potential errors here; checking for invalid configurations\n");
+#endif
+    CONTEND_ISNULL(freqdem_create(0.0f));
+
+    freqdem q = freqdem_create(0.1f);
+    CONTEND_INEQUALITY(LIQUID_OK, freqdem_set_atan_terms(q, 1));
+    CONTEND_INEQUALITY(LIQUID_OK, freqdem_set_atan_terms(q, 8));
+    CONTEND_EQUALITY  (LIQUID_OK, freqdem_set_atan_terms(q, 0));
+    CONTEND_EQUALITY  (0.0f, freqdem_get_block_error(q));
+    freqdem_destroy(q);
+}
@@ -167,3 +167,104 @@ void autotest_fskdem_copy()
     fskdem_destroy(dem_orig);
     fskdem_destroy(dem_copy);
 }
+
+// test block demodulation against symbol-by-symbol demodulation
+//  _pruned :   use pruned transform
+void fskdem_test_block(int _pruned)
+{
+    unsigned int m  = 2;        // bits per symbol
+    unsigned int k  = 64;       // samples per symbol
+    float        bw = 0.2345f;  // occupied bandwidth
+    unsigned int M  = 1 << m;   // constellation size
+    unsigned int num_symbols = 40;
+
+    // create modulator and demodulators
+    fskmod mod   = fskmod_create(m, k, bw);
+    fskdem dem_0 = fskdem_create(m, k, bw);
+    fskdem dem_1 = fskdem_create(m, k, bw);
+    fskdem_set_pruned(dem_0, _pruned);
+    fskdem_set_pruned(dem_1, _pruned);
+    CONTEND_EQUALITY(fskdem_get_pruned(dem_1), _pruned);
+
+    // modulate random symbols and add noise
+    unsigned int  sym_in[num_symbols];
+    float complex buf[num_symbols*k];
+    unsigned int i, j;
+    for (i=0; i<num_symbols; i++) {
+        sym_in[i] = rand() % M;
+        fskmod_modulate(mod, sym_in[i], &buf[i*k]);
+    }
+    for (i=0; i<num_symbols*k; i++)
+        buf[i] += 0.1f*(randnf() + _Complex_I*randnf());
+
+    // demodulate symbol by symbol
+    unsigned int sym_0[num_symbols];
+    float        energy_0[num_symbols*M];
+    for (i=0; i<num_symbols; i++) {
+        sym_0[i] = fskdem_demodulate(dem_0, &buf[i*k]);
+        fskdem_get_tone_energy(dem_0, &energy_0[i*M]);
+    }
+
+    // demodulate as block
+    unsigned int sym_1[num_symbols];
+    float        energy_1[num_symbols*M];
+    CONTEND_EQUALITY(fskdem_demodulate_soft_block(dem_1, buf, num_symbols, sym_1, energy_1), LIQUID_OK);
+
+    // compare results
+    for (i=0; i<num_symbols; i++) {
+        CONTEND_EQUALITY(sym_1[i], sym_in[i]);
+        CONTEND_EQUALITY(sym_1[i], sym_0[i]);
+        for (j=0; j<M; j++)
+            CONTEND_DELTA(energy_1[i*M+j], energy_0[i*M+j], 1e-3f*energy_0[i*M+j]);
+    }
+
+    // full transform is available for frequency error and symbol energy
+    CONTEND_DELTA(fskdem_get_frequency_error(dem_1), fskdem_get_frequency_error(dem_0), 1e-3f);
+    CONTEND_DELTA(fskdem_get_symbol_energy(dem_1, sym_in[num_symbols-1], 2),
+                  fskdem_get_symbol_energy(dem_0, sym_in[num_symbols-1], 2), 1e-2f);
+
+    // clean it up
+    fskmod_destroy(mod);
+    fskdem_destroy(dem_0);
+    fskdem_destroy(dem_1);
+}
+void autotest_fskdem_block_fft()    { fskdem_test_block(0); }
+void autotest_fskdem_block_pruned() { fskdem_test_block(1); }
+
+// test pruned transform against full transform
+void autotest_fskdem_pruned()
+{
+    unsigned int m  = 3;        // bits per symbol
+    unsigned int k  = 100;      // samples per symbol
+    float        bw = 0.3721451f;
+    unsigned int M  = 1 << m;
+
+    fskdem dem_0 = fskdem_create(m, k, bw);
+    fskdem dem_1 = fskdem_create(m, k, bw);
+    fskdem_set_pruned(dem_0, 0);
+    fskdem_set_pruned(dem_1, 1);
+
+    unsigned int  i, j;
+    float complex buf[k];
+    float         energy_0[M], energy_1[M];
+    for (i=0; i<20; i++) {
+        for (j=0; j<k; j++)
+            buf[j] = randnf() + _Complex_I*randnf();
+        CONTEND_EQUALITY(fskdem_demodulate(dem_0, buf), fskdem_demodulate(dem_1, buf));
+        fskdem_get_tone_energy(dem_0, energy_0);
+        fskdem_get_tone_energy(dem_1, energy_1);
+        for (j=0; j<M; j++)
+            CONTEND_DELTA(energy_1[j], energy_0[j], 1e-3f*energy_0[j] + 1e-3f);
+        CONTEND_DELTA(fskdem_get_symbol_energy(dem_1, i%M, 3),
+                      fskdem_get_symbol_energy(dem_0, i%M, 3), 1e-3f*fskdem_get_symbol_energy(dem_0, i%M, 3));
+    }
+
+    // copied object retains pruned transform
+    fskdem dem_2 = fskdem_copy(dem_1);
+    CONTEND_EQUALITY(fskdem_get_pruned(dem_2), 1);
+    CONTEND_EQUALITY(fskdem_demodulate(dem_1, buf), fskdem_demodulate(dem_2, buf));
+
+    fskdem_destroy(dem_0);
+    fskdem_destroy(dem_1);
+    fskdem_destroy(dem_2);
+}
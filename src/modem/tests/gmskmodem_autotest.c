@@ -185,3 +185,38 @@ void autotest_gmskdem_copy()
     gmskdem_destroy(dem_copy);
 }
 
+// test block demodulation against symbol-by-symbol demodulation
+void autotest_gmskdem_block()
+{
+    unsigned int k = 4, m = 3, num_symbols = 200;
+    float        bt = 0.3f;
+    gmskmod mod   = gmskmod_create(k, m, bt);
+    gmskdem dem_0 = gmskdem_create(k, m, bt);
+    gmskdem dem_1 = gmskdem_create(k, m, bt);
+
+    float complex buf[k*num_symbols];
+    unsigned int  sym_in[num_symbols];
+    unsigned int  sym_0 [num_symbols];
+    unsigned int  sym_1 [num_symbols];
+    unsigned int  i;
+    for (i=0; i<num_symbols; i++) {
+        sym_in[i] = rand() & 1;
+        gmskmod_modulate(mod, sym_in[i], &buf[i*k]);
+    }
+    for (i=0; i<k*num_symbols; i++)
+        buf[i] += 0.1f*(randnf() + _Complex_I*randnf());
+
+    // symbol by symbol, then in uneven blocks
+    for (i=0; i<num_symbols; i++)
+        gmskdem_demodulate(dem_0, &buf[i*k], &sym_0[i]);
+    CONTEND_EQUALITY(gmskdem_demodulate_block(dem_1, buf,        1,               sym_1     ), LIQUID_OK);
+    CONTEND_EQUALITY(gmskdem_demodulate_block(dem_1, buf +   k,  120,             sym_1 +  1), LIQUID_OK);
+    CONTEND_EQUALITY(gmskdem_demodulate_block(dem_1, buf + 121*k, num_symbols-121, sym_1 + 121), LIQUID_OK);
+    CONTEND_SAME_DATA(sym_0, sym_1, num_symbols*sizeof(unsigned int));
+    for (i=2*m; i<num_symbols; i++)
+        CONTEND_EQUALITY(sym_in[i-2*m], sym_1[i]);
+
+    gmskmod_destroy(mod);
+    gmskdem_destroy(dem_0);
+    gmskdem_destroy(dem_1);
+}
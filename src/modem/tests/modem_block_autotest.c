@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2007 - 2021 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+// compare block modulation/demodulation against per-symbol methods
+void modemcf_test_block(modulation_scheme _ms)
+{
+    // create one set of objects for each of per-symbol and block
+    // methods as differential modems carry state between symbols
+    modemcf mod_0   = modemcf_create(_ms);
+    modemcf mod_1   = modemcf_create(_ms);
+    modemcf demod_0 = modemcf_create(_ms);
+    modemcf demod_1 = modemcf_create(_ms);
+    modemcf soft_0  = modemcf_create(_ms);
+    modemcf soft_1  = modemcf_create(_ms);
+
+    unsigned int i, n = 1200;
+    unsigned int bps = modemcf_get_bps(mod_0);
+    unsigned int  s[n], s0[n], s1[n];
+    float complex y0[n], y1[n];
+    unsigned char b0[n*bps], b1[n*bps];
+
+    // modulate
+    for (i=0; i<n; i++)
+        s[i] = modemcf_gen_rand_sym(mod_0);
+    for (i=0; i<n; i++)
+        modemcf_modulate(mod_0, s[i], &y0[i]);
+    CONTEND_EQUALITY(modemcf_modulate_block(mod_1, s, n, y1), LIQUID_OK);
+    CONTEND_SAME_DATA(y0, y1, n*sizeof(float complex));
+
+    // add noise
+    for (i=0; i<n; i++)
+        y0[i] += 0.1f*(randnf() + _Complex_I*randnf());
+
+    // hard demodulation
+    for (i=0; i<n; i++)
+        modemcf_demodulate(demod_0, y0[i], &s0[i]);
+    CONTEND_EQUALITY(modemcf_demodulate_block(demod_1, y0, n, s1), LIQUID_OK);
+    CONTEND_SAME_DATA(s0, s1, n*sizeof(unsigned int));
+
+    // demodulator state reflects last sample
+    float complex x0, x1;
+    modemcf_get_demodulator_sample(demod_0, &x0);
+    modemcf_get_demodulator_sample(demod_1, &x1);
+    CONTEND_EQUALITY(x0, x1);
+
+    // soft demodulation
+    for (i=0; i<n; i++)
+        modemcf_demodulate_soft(soft_0, y0[i], &s0[i], &b0[i*bps]);
+    CONTEND_EQUALITY(modemcf_demodulate_soft_block(soft_1, y0, n, s1, b1), LIQUID_OK);
+    CONTEND_SAME_DATA(s0, s1, n*sizeof(unsigned int));
+    CONTEND_SAME_DATA(b0, b1, n*bps);
+
+    // clean it up
+    modemcf_destroy(mod_0);
+    modemcf_destroy(mod_1);
+    modemcf_destroy(demod_0);
+    modemcf_destroy(demod_1);
+    modemcf_destroy(soft_0);
+    modemcf_destroy(soft_1);
+}
+
+void autotest_modem_block_psk8()     { modemcf_test_block(LIQUID_MODEM_PSK8);     }
+void autotest_modem_block_psk64()    { modemcf_test_block(LIQUID_MODEM_PSK64);    }
+void autotest_modem_block_dpsk4()    { modemcf_test_block(LIQUID_MODEM_DPSK4);    }
+void autotest_modem_block_ask4()     { modemcf_test_block(LIQUID_MODEM_ASK4);     }
+void autotest_modem_block_ask16()    { modemcf_test_block(LIQUID_MODEM_ASK16);    }
+void autotest_modem_block_qam4()     { modemcf_test_block(LIQUID_MODEM_QAM4);     }
+void autotest_modem_block_qam16()    { modemcf_test_block(LIQUID_MODEM_QAM16);    }
+void autotest_modem_block_qam32()    { modemcf_test_block(LIQUID_MODEM_QAM32);    }
+void autotest_modem_block_qam256()   { modemcf_test_block(LIQUID_MODEM_QAM256);   }
+void autotest_modem_block_apsk16()   { modemcf_test_block(LIQUID_MODEM_APSK16);   }
+void autotest_modem_block_apsk64()   { modemcf_test_block(LIQUID_MODEM_APSK64);   }
+void autotest_modem_block_bpsk()     { modemcf_test_block(LIQUID_MODEM_BPSK);     }
+void autotest_modem_block_qpsk()     { modemcf_test_block(LIQUID_MODEM_QPSK);     }
+void autotest_modem_block_ook()      { modemcf_test_block(LIQUID_MODEM_OOK);      }
+void autotest_modem_block_sqam32()   { modemcf_test_block(LIQUID_MODEM_SQAM32);   }
+void autotest_modem_block_arb16opt() { modemcf_test_block(LIQUID_MODEM_ARB16OPT); }
+void autotest_modem_block_pi4dqpsk() { modemcf_test_block(LIQUID_MODEM_PI4DQPSK); }
+
+void autotest_modem_block_config()
+{
+#if LIQUID_STRICT_EXIT
+    AUTOTEST_WARN("skipping modem block config test with strict exit enabled\n");
+    return;
+#endif
+#if !LIQUID_SUPPRESS_ERROR_OUTPUT
+    fprintf(stderr,"warning: ignore potential errors here; checking for invalid configurations\n");
+#endif
+    modemcf q = modemcf_create(LIQUID_MODEM_QAM16);
+    unsigned int  s[4] = {0, 3, 16, 1};
+    float complex y[4];
+    CONTEND_INEQUALITY(LIQUID_OK, modemcf_modulate_block(q, s, 4, y));
+    CONTEND_EQUALITY  (LIQUID_OK, modemcf_modulate_block(q, s, 2, y));
+    modemcf_destroy(q);
+}
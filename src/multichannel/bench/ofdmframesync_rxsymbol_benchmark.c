@@ -111,3 +111,6 @@ void benchmark_ofdmframesync_rxsymbol_n128  OFDMFRAMESYNC_RXSYMBOL_BENCH_API(128
 void benchmark_ofdmframesync_rxsymbol_n256  OFDMFRAMESYNC_RXSYMBOL_BENCH_API(256,32)
 void benchmark_ofdmframesync_rxsymbol_n512  OFDMFRAMESYNC_RXSYMBOL_BENCH_API(512,64)
 
+void benchmark_ofdmframesync_rxsymbol_n1024 OFDMFRAMESYNC_RXSYMBOL_BENCH_API(1024,128)
+void benchmark_ofdmframesync_rxsymbol_n2048 OFDMFRAMESYNC_RXSYMBOL_BENCH_API(2048,256)
+void benchmark_ofdmframesync_rxsymbol_n4096 OFDMFRAMESYNC_RXSYMBOL_BENCH_API(4096,512)
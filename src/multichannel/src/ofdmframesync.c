@@ -37,6 +37,9 @@
 
 #define OFDMFRAMESYNC_ENABLE_SQUELCH    0
 
+// number of subcarriers sharing a single phase-compensation coefficient
+#define OFDMFRAMESYNC_ROT_BLOCK         (64)
+
 // forward declaration of internal methods
 
 int ofdmframesync_execute_seekplcp(ofdmframesync _q);
@@ -117,7 +120,14 @@ struct ofdmframesync_s {
     float complex * G1;     // complex subcarrier gain estimate, S1
     float complex * G;      // complex subcarrier gain estimate
     float complex * B;      // subcarrier phase rotation due to backoff
-    float complex * R;      // 
+    float * R_re;           // composite gain B/G (real), zero on null subcarriers
+    float * R_im;           // composite gain B/G (imag), zero on null subcarriers
+
+    // pilot tracking
+    unsigned int * pilot_index; // pilot subcarrier indices (fftshift order)
+    float * pilot_x;        // pilot subcarrier frequency index
+    float pilot_xm;         // mean of pilot frequency indices
+    float pilot_sxx;        // sum of squared pilot index deviations from mean
 
     // receiver state
     enum {
@@ -242,7 +252,8 @@ ofdmframesync ofdmframesync_create(unsigned int           _M,
     q->G0b = (float complex*) malloc((q->M)*sizeof(float complex));
     q->G   = (float complex*) malloc((q->M)*sizeof(float complex));
     q->B   = (float complex*) malloc((q->M)*sizeof(float complex));
-    q->R   = (float complex*) malloc((q->M)*sizeof(float complex));
+    q->R_re = (float*) malloc((q->M)*sizeof(float));
+    q->R_im = (float*) malloc((q->M)*sizeof(float));
 
 #if 1
     memset(q->G0a, 0x00, q->M*sizeof(float complex));
@@ -250,6 +261,8 @@ ofdmframesync ofdmframesync_create(unsigned int           _M,
     memset(q->G ,  0x00, q->M*sizeof(float complex));
     memset(q->B,   0x00, q->M*sizeof(float complex));
 #endif
+    memset(q->R_re, 0x00, q->M*sizeof(float));
+    memset(q->R_im, 0x00, q->M*sizeof(float));
 
     // timing backoff
     q->backoff = q->cp_len < 2 ? q->cp_len : 2;
@@ -258,6 +271,28 @@ ofdmframesync ofdmframesync_create(unsigned int           _M,
     for (i=0; i<q->M; i++)
         q->B[i] = liquid_cexpjf(i*phi);
 
+    // pilot locations in fftshift order along with their frequency index
+    // and fit statistics; the pilot phase slope is a first-order least-
+    // squares fit, solved in closed form for each received symbol
+    q->pilot_index = (unsigned int*) malloc((q->M_pilot)*sizeof(unsigned int));
+    q->pilot_x     = (float*)        malloc((q->M_pilot)*sizeof(float));
+    unsigned int n = 0;
+    for (i=0; i<q->M; i++) {
+        unsigned int k = (i + q->M2) % q->M;
+        if (q->p[k] == OFDMFRAME_SCTYPE_PILOT) {
+            q->pilot_index[n] = k;
+            q->pilot_x[n]     = (k > q->M2) ? (float)k - (float)(q->M) : (float)k;
+            n++;
+        }
+    }
+    q->pilot_xm = 0.0f;
+    for (i=0; i<q->M_pilot; i++)
+        q->pilot_xm += q->pilot_x[i];
+    q->pilot_xm /= (float)(q->M_pilot);
+    q->pilot_sxx = 0.0f;
+    for (i=0; i<q->M_pilot; i++)
+        q->pilot_sxx += (q->pilot_x[i] - q->pilot_xm)*(q->pilot_x[i] - q->pilot_xm);
+
     // set callback data
     q->callback = _callback;
     q->userdata = _userdata;
@@ -335,7 +370,10 @@ int ofdmframesync_destroy(ofdmframesync _q)
     free(_q->G0b);
     free(_q->G);
     free(_q->B);
-    free(_q->R);
+    free(_q->R_re);
+    free(_q->R_im);
+    free(_q->pilot_index);
+    free(_q->pilot_x);
 
     // destroy synchronizer objects
     nco_crcf_destroy(_q->nco_rx);           // numerically-controlled oscillator
@@ -401,6 +439,21 @@ int ofdmframesync_execute(ofdmframesync   _q,
     unsigned int i;
     float complex x;
     for (i=0; i<_n; i++) {
+#if !DEBUG_OFDMFRAMESYNC
+        // while receiving symbols, samples ahead of the symbol boundary only
+        // need to be mixed down and buffered; handle them as a block (at
+        // most M at a time through the transform input buffer)
+        if (_q->state == OFDMFRAMESYNC_STATE_RXSYMBOLS && _q->timer > 1) {
+            unsigned int n = _q->timer - 1;
+            if (n > _n - i) n = _n - i;
+            if (n > _q->M)  n = _q->M;
+            nco_crcf_mix_block_down(_q->nco_rx, &_x[i], _q->x, n);
+            windowcf_write(_q->input_buffer, _q->x, n);
+            _q->timer -= n;
+            i += n - 1;
+            continue;
+        }
+#endif
         x = _x[i];
 
         // correct for carrier frequency offset
@@ -734,12 +787,22 @@ int ofdmframesync_execute_S1(ofdmframesync _q)
         ofdmframesync_estimate_eqgain_poly(_q, poly_order);
 #endif
 
-#if 1
-        // compute composite gain
-        unsigned int i;
-        for (i=0; i<_q->M; i++)
-            _q->R[i] = _q->B[i] / _q->G[i];
-#endif
+        // compute composite gain R = B/G, stored as separate real and
+        // imaginary arrays for the per-symbol compensation pass
+        for (i=0; i<_q->M; i++) {
+            float g_re = crealf(_q->G[i]);
+            float g_im = cimagf(_q->G[i]);
+            float g2   = g_re*g_re + g_im*g_im;
+            if (_q->p[i] == OFDMFRAME_SCTYPE_NULL || g2 == 0.0f) {
+                _q->R_re[i] = 0.0f;
+                _q->R_im[i] = 0.0f;
+            } else {
+                float b_re = crealf(_q->B[i]);
+                float b_im = cimagf(_q->B[i]);
+                _q->R_re[i] = (b_re*g_re + b_im*g_im) / g2;
+                _q->R_im[i] = (b_im*g_re - b_re*g_im) / g2;
+            }
+        }
         return LIQUID_OK;
     }
 
@@ -1029,53 +1092,34 @@ int ofdmframesync_estimate_eqgain_poly(ofdmframesync _q,
 // recover symbol, correcting for gain, pilot phase, etc.
 int ofdmframesync_rxsymbol(ofdmframesync _q)
 {
-    // apply gain
     unsigned int i;
-    for (i=0; i<_q->M; i++)
-        _q->X[i] *= _q->R[i];
+    unsigned int j;
+    float * X = (float*) _q->X; // interleaved real/imag view of FFT output
 
-    // polynomial curve-fit
-    float x_phase[_q->M_pilot];
+    // estimate phase of equalized pilots
     float y_phase[_q->M_pilot];
-    float p_phase[2];
-
-    unsigned int n=0;
-    unsigned int k;
-    float complex pilot = 1.0f;
-    for (i=0; i<_q->M; i++) {
-
-        // start at mid-point (effective fftshift)
-        k = (i + _q->M2) % _q->M;
-
-        if (_q->p[k]==OFDMFRAME_SCTYPE_PILOT) {
-            if (n == _q->M_pilot)
-                return liquid_error(LIQUID_EINT,"ofdmframesync_estimate_eqgain_poly(), pilot subcarrier mismatch");
-
-            pilot = (msequence_advance(_q->ms_pilot) ? 1.0f : -1.0f);
-#if 0
-            printf("pilot[%3u] = %12.4e + j*%12.4e (expected %12.4e + j*%12.4e)\n",
-                    k,
-                    crealf(_q->X[k]), cimagf(_q->X[k]),
-                    crealf(pilot),    cimagf(pilot));
-#endif
-            // store resulting...
-            x_phase[n] = (k > _q->M2) ? (float)k - (float)(_q->M) : (float)k;
-            y_phase[n] = cargf(_q->X[k]*conjf(pilot));
-
-            // update counter
-            n++;
-
-        }
+    for (i=0; i<_q->M_pilot; i++) {
+        unsigned int k = _q->pilot_index[i];
+        float pilot = msequence_advance(_q->ms_pilot) ? 1.0f : -1.0f;
+        float y_re = X[2*k]*_q->R_re[k] - X[2*k+1]*_q->R_im[k];
+        float y_im = X[2*k]*_q->R_im[k] + X[2*k+1]*_q->R_re[k];
+        y_phase[i] = atan2f(pilot*y_im, pilot*y_re);
     }
 
-    if (n != _q->M_pilot)
-        return liquid_error(LIQUID_EINT,"ofdmframesync_estimate_eqgain_poly(), pilot subcarrier mismatch");
-
     // try to unwrap phase
     liquid_unwrap_phase(y_phase, _q->M_pilot);
 
-    // fit phase to 1st-order polynomial (2 coefficients)
-    polyf_fit(x_phase, y_phase, _q->M_pilot, p_phase, 2);
+    // fit phase to 1st-order polynomial (least squares, closed form)
+    float p_phase[2];
+    float ym = 0.0f;
+    for (i=0; i<_q->M_pilot; i++)
+        ym += y_phase[i];
+    ym /= (float)(_q->M_pilot);
+    float sxy = 0.0f;
+    for (i=0; i<_q->M_pilot; i++)
+        sxy += (_q->pilot_x[i] - _q->pilot_xm)*(y_phase[i] - ym);
+    p_phase[1] = sxy / _q->pilot_sxx;
+    p_phase[0] = ym - p_phase[1]*_q->pilot_xm;
 
     // filter slope estimate (timing offset)
     float alpha = 0.3f;
@@ -1085,8 +1129,8 @@ int ofdmframesync_rxsymbol(ofdmframesync _q)
 #if DEBUG_OFDMFRAMESYNC
     if (_q->debug_enabled) {
         // save pilots
-        memmove(_q->px, x_phase, _q->M_pilot*sizeof(float));
-        memmove(_q->py, y_phase, _q->M_pilot*sizeof(float));
+        memmove(_q->px, _q->pilot_x, _q->M_pilot*sizeof(float));
+        memmove(_q->py, y_phase,     _q->M_pilot*sizeof(float));
 
         // NOTE : swapping values for octave
         _q->p_phase[0] = p_phase[1];
@@ -1097,16 +1141,44 @@ int ofdmframesync_rxsymbol(ofdmframesync _q)
     }
 #endif
 
-    // compensate for phase offset
-    // TODO : find more computationally efficient way to do this
-    for (i=0; i<_q->M; i++) {
-        // only apply to data/pilot subcarriers
-        if (_q->p[i] == OFDMFRAME_SCTYPE_NULL) {
-            _q->X[i] = 0.0f;
-        } else {
-            float fx    = (i > _q->M2) ? (float)i - (float)(_q->M) : (float)i;
-            float theta = polyf_val(p_phase, 2, fx);
-            _q->X[i] *= liquid_cexpjf(-theta);
+    // apply gain and compensate for phase offset in a single pass:
+    //   X[i] <- X[i] R[i] exp(-j(p0 + p1 fx)),
+    // where the rotation for each block of subcarriers is a single
+    // coefficient times a shared table exp(-j p1 n); null subcarriers
+    // have R[i]=0 and are cleared in the process
+    float w_re[OFDMFRAMESYNC_ROT_BLOCK];
+    float w_im[OFDMFRAMESYNC_ROT_BLOCK];
+    for (j=0; j<OFDMFRAMESYNC_ROT_BLOCK; j++) {
+        w_re[j] =  cosf(p_phase[1]*(float)j);
+        w_im[j] = -sinf(p_phase[1]*(float)j);
+    }
+    unsigned int s;
+    for (s=0; s<2; s++) {
+        // positive frequencies [0,M/2], then negative frequencies (M/2,M)
+        unsigned int i0  = (s==0) ? 0 : _q->M2 + 1;
+        unsigned int i1  = (s==0) ? _q->M2 + 1 : _q->M;
+        float        fx0 = (s==0) ? 0.0f : (float)(_q->M2 + 1) - (float)(_q->M);
+        for (i=i0; i<i1; i+=OFDMFRAMESYNC_ROT_BLOCK) {
+            unsigned int n = (i1 - i) < OFDMFRAMESYNC_ROT_BLOCK ? i1 - i : OFDMFRAMESYNC_ROT_BLOCK;
+            float theta = p_phase[0] + p_phase[1]*(fx0 + (float)(i - i0));
+            float c_re  =  cosf(theta);
+            float c_im  = -sinf(theta);
+            float *       x    = &X[2*i];
+            const float * r_re = &_q->R_re[i];
+            const float * r_im = &_q->R_im[i];
+            for (j=0; j<n; j++) {
+                // rotation
+                float v_re = c_re*w_re[j] - c_im*w_im[j];
+                float v_im = c_re*w_im[j] + c_im*w_re[j];
+                // composite gain
+                float g_re = r_re[j]*v_re - r_im[j]*v_im;
+                float g_im = r_re[j]*v_im + r_im[j]*v_re;
+                // apply
+                float x_re = x[2*j  ];
+                float x_im = x[2*j+1];
+                x[2*j  ] = x_re*g_re - x_im*g_im;
+                x[2*j+1] = x_re*g_im + x_im*g_re;
+            }
         }
     }
 
@@ -1129,7 +1201,7 @@ int ofdmframesync_rxsymbol(ofdmframesync _q)
 
 #if 0
     for (i=0; i<_q->M_pilot; i++)
-        printf("x_phase(%3u) = %12.8f; y_phase(%3u) = %12.8f;\n", i+1, x_phase[i], i+1, y_phase[i]);
+        printf("x_phase(%3u) = %12.8f; y_phase(%3u) = %12.8f;\n", i+1, _q->pilot_x[i], i+1, y_phase[i]);
     printf("poly : p0=%12.8f, p1=%12.8f\n", p_phase[0], p_phase[1]);
 #endif
     return LIQUID_OK;
@@ -144,6 +144,113 @@ void autotest_ofdmframesync_acquire_n128()  { ofdmframesync_acquire_test(128, 16
 void autotest_ofdmframesync_acquire_n256()  { ofdmframesync_acquire_test(256, 32, 0); }
 void autotest_ofdmframesync_acquire_n512()  { ofdmframesync_acquire_test(512, 64, 0); }
 
+// accumulated received symbols for block equivalence test
+struct ofdmframesync_block_autotest_s {
+    float complex * X;          // received symbols, one row per symbol
+    unsigned int    num_symbols;// number of symbols received
+    unsigned int    max_symbols;// maximum number of symbols to store
+};
+
+int ofdmframesync_block_autotest_callback(float complex * _X,
+                                          unsigned char * _p,
+                                          unsigned int    _M,
+                                          void *          _userdata)
+{
+    struct ofdmframesync_block_autotest_s * q =
+        (struct ofdmframesync_block_autotest_s *)_userdata;
+    if (q->num_symbols < q->max_symbols)
+        memmove(&q->X[q->num_symbols*_M], _X, _M*sizeof(float complex));
+    q->num_symbols++;
+    return 0;
+}
+
+// Feed the same frame to two synchronizers, one sample at a time and in
+// irregular blocks (crossing symbol boundaries), and ensure the received
+// subcarrier symbols match.
+//  _num_subcarriers    :   number of subcarriers
+//  _cp_len             :   cyclic prefix length
+//  _taper_len          :   taper length
+void ofdmframesync_block_test(unsigned int _num_subcarriers,
+                              unsigned int _cp_len,
+                              unsigned int _taper_len)
+{
+    unsigned int M           = _num_subcarriers;
+    unsigned int cp_len      = _cp_len;
+    unsigned int num_symbols = 12;              // number of data symbols
+    unsigned int num_delay   = 37;              // leading noise samples
+    float        dphi        = 0.3f / (float)M; // carrier frequency offset
+    float        tol         = 1e-5f;           // error tolerance
+
+    unsigned int block_sizes[] = {1, 7, 300, 513, 2, 1000};
+
+    unsigned char p[M];
+    ofdmframe_init_default_sctype(M, p);
+
+    // generate frame: noise, preamble, data symbols, trailing zeros
+    unsigned int symbol_len  = M + cp_len;
+    unsigned int num_samples = num_delay + (3 + num_symbols + 2)*symbol_len;
+    float complex * y = (float complex*) malloc(num_samples*sizeof(float complex));
+    ofdmframegen fg = ofdmframegen_create(M, cp_len, _taper_len, p);
+    float complex X[M];
+    unsigned int i, j, n = 0;
+    for (i=0; i<num_delay; i++)
+        y[n++] = 0.01f*(randnf() + _Complex_I*randnf());
+    ofdmframegen_write_S0a(fg, &y[n]); n += symbol_len;
+    ofdmframegen_write_S0b(fg, &y[n]); n += symbol_len;
+    ofdmframegen_write_S1( fg, &y[n]); n += symbol_len;
+    for (i=0; i<num_symbols; i++) {
+        for (j=0; j<M; j++)
+            X[j] = cexpf(_Complex_I*2*M_PI*randf());
+        ofdmframegen_writesymbol(fg, X, &y[n]);
+        n += symbol_len;
+    }
+    while (n < num_samples)
+        y[n++] = 0.0f;
+    for (i=0; i<num_samples; i++)
+        y[i] *= cexpf(_Complex_I*dphi*i);
+
+    // run both receivers
+    struct ofdmframesync_block_autotest_s r0 = {NULL, 0, num_symbols};
+    struct ofdmframesync_block_autotest_s r1 = {NULL, 0, num_symbols};
+    r0.X = (float complex*) malloc(num_symbols*M*sizeof(float complex));
+    r1.X = (float complex*) malloc(num_symbols*M*sizeof(float complex));
+    ofdmframesync fs0 = ofdmframesync_create(M, cp_len, _taper_len, p,
+                            ofdmframesync_block_autotest_callback, (void*)&r0);
+    ofdmframesync fs1 = ofdmframesync_create(M, cp_len, _taper_len, p,
+                            ofdmframesync_block_autotest_callback, (void*)&r1);
+
+    for (i=0; i<num_samples; i++)
+        ofdmframesync_execute(fs0, &y[i], 1);
+
+    unsigned int k = 0;
+    for (i=0; i<num_samples; i+=n) {
+        n = block_sizes[k++ % 6];
+        if (i + n > num_samples)
+            n = num_samples - i;
+        ofdmframesync_execute(fs1, &y[i], n);
+    }
+
+    // both receivers should have recovered every data symbol identically
+    // (the receiver keeps demodulating the trailing samples after the frame)
+    CONTEND_EQUALITY(r1.num_symbols, r0.num_symbols);
+    CONTEND_GREATER_THAN(r0.num_symbols, num_symbols-1);
+    for (i=0; i<num_symbols*M; i++) {
+        CONTEND_DELTA(crealf(r1.X[i]), crealf(r0.X[i]), tol);
+        CONTEND_DELTA(cimagf(r1.X[i]), cimagf(r0.X[i]), tol);
+    }
+
+    ofdmframegen_destroy(fg);
+    ofdmframesync_destroy(fs0);
+    ofdmframesync_destroy(fs1);
+    free(y);
+    free(r0.X);
+    free(r1.X);
+}
+
+void autotest_ofdmframesync_block_n64()     { ofdmframesync_block_test( 64,  8, 0); }
+void autotest_ofdmframesync_block_n128()    { ofdmframesync_block_test(128, 16, 4); }
+void autotest_ofdmframesync_block_n512()    { ofdmframesync_block_test(512, 64, 0); }
+
 void autotest_ofdmframe_common_config()
 {
 #if LIQUID_STRICT_EXIT
@@ -31,11 +31,26 @@
 
 #include "liquid.internal.h"
 
+#if HAVE_LIBPTHREAD
+#include <pthread.h>
+#endif
+
 #define LIQUID_GA_SEARCH_MAX_POPULATION_SIZE (1024)
 #define LIQUID_GA_SEARCH_MAX_CHROMOSOME_SIZE (32)
 
 #define LIQUID_DEBUG_GA_SEARCH 0
 
+#if HAVE_LIBPTHREAD
+// worker thread context
+struct gasearch_worker_s {
+    gasearch     q;         // search object
+    unsigned int index;     // worker index
+};
+
+// worker thread: evaluate assigned chromosomes
+void * gasearch_worker(void * _context);
+#endif
+
 // Create a simple gasearch object; parameters are specified internally
 //  _utility            :   chromosome fitness utility function
 //  _userdata           :   user data, void pointer passed to _utility() callback
@@ -84,6 +99,14 @@ gasearch gasearch_create_advanced(gasearch_utility _utility,
     ga->get_utility     = _utility;
     ga->minimize        = ( _minmax==LIQUID_OPTIM_MINIMIZE ) ? 1 : 0;
 
+    // sequential evaluation without caching by default
+    ga->num_workers     = 1;
+    ga->clone           = NULL;
+    ga->destroy         = NULL;
+    ga->worker_userdata = NULL;
+    ga->cache           = 0;
+    gasearch_set_seed(ga, (unsigned int)rand());
+
     ga->bits_per_chromosome = _parent->num_bits;
 
     // initialize selection size be be 25% of population, minimum of 2
@@ -92,6 +115,8 @@ gasearch gasearch_create_advanced(gasearch_utility _utility,
     // allocate internal arrays
     ga->population = (chromosome*) malloc( sizeof(chromosome)*(ga->population_size) );
     ga->utility = (float*) calloc( sizeof(float), ga->population_size );
+    ga->dirty   = (unsigned char*) malloc( sizeof(unsigned char)*(ga->population_size) );
+    memset(ga->dirty, 1, ga->population_size);
 
     // create optimum chromosome (clone)
     ga->c = chromosome_create_clone(_parent);
@@ -107,7 +132,7 @@ gasearch gasearch_create_advanced(gasearch_utility _utility,
 
     // initialize population to random, preserving first chromosome
     for (i=1; i<ga->population_size; i++)
-        chromosome_init_random( ga->population[i] );
+        gasearch_init_random(ga, ga->population[i]);
 
     // evaluate population
     gasearch_evaluate(ga);
@@ -125,6 +150,9 @@ gasearch gasearch_create_advanced(gasearch_utility _utility,
 // destroy a gasearch object
 int gasearch_destroy(gasearch _g)
 {
+    // destroy worker user data clones
+    gasearch_set_workers(_g, 1, NULL, NULL);
+
     unsigned int i;
     for (i=0; i<_g->population_size; i++)
         chromosome_destroy( _g->population[i] );
@@ -134,6 +162,7 @@ int gasearch_destroy(gasearch _g)
     chromosome_destroy(_g->c);
 
     free(_g->utility);
+    free(_g->dirty);
     free(_g);
     return LIQUID_OK;
 }
@@ -147,6 +176,8 @@ int gasearch_print(gasearch _g)
     printf(", population=%u", _g->population_size);
     printf(", selection=%u", _g->selection_size);
     printf(", mutation=%g", _g->mutation_rate);
+    printf(", workers=%u", _g->num_workers);
+    printf(", cache=%s", _g->cache ? "true" : "false");
     printf(">\n");
     return LIQUID_OK;
 }
@@ -172,6 +203,7 @@ int gasearch_set_population_size(gasearch     _g,
     // re-size arrays
     _g->population = (chromosome*) realloc( _g->population, _population_size*sizeof(chromosome) );
     _g->utility = (float*) realloc( _g->utility, _population_size*sizeof(float) );
+    _g->dirty = (unsigned char*) realloc( _g->dirty, _population_size*sizeof(unsigned char) );
 
     // initialize new chromosomes (copies)
     if (_population_size > _g->population_size) {
@@ -185,6 +217,7 @@ int gasearch_set_population_size(gasearch     _g,
 
             // copy utility
             _g->utility[i] = _g->utility[k];
+            _g->dirty[i]   = _g->dirty[k];
         }
     }
 
@@ -205,6 +238,58 @@ int gasearch_set_mutation_rate(gasearch _g,
     return LIQUID_OK;
 }
 
+// set number of workers evaluating the utility function
+int gasearch_set_workers(gasearch                  _g,
+                         unsigned int              _num_workers,
+                         gasearch_userdata_clone   _clone,
+                         gasearch_userdata_destroy _destroy)
+{
+    if (_num_workers == 0)
+        return liquid_error(LIQUID_EICONFIG,"gasearch_set_workers(), number of workers must be greater than zero");
+
+    // destroy existing clones
+    unsigned int i;
+    if (_g->worker_userdata != NULL) {
+        for (i=0; i<_g->num_workers; i++) {
+            if (_g->destroy != NULL && _g->worker_userdata[i] != _g->userdata)
+                _g->destroy(_g->worker_userdata[i]);
+        }
+        free(_g->worker_userdata);
+        _g->worker_userdata = NULL;
+    }
+
+    _g->num_workers = _num_workers;
+    _g->clone       = _clone;
+    _g->destroy     = _destroy;
+    if (_num_workers == 1 && _clone == NULL)
+        return LIQUID_OK;
+
+    // create per-worker user data
+    _g->worker_userdata = (void**) malloc(_num_workers*sizeof(void*));
+    for (i=0; i<_num_workers; i++)
+        _g->worker_userdata[i] = _clone == NULL ? _g->userdata : _clone(_g->userdata, i);
+    return LIQUID_OK;
+}
+
+// seed internal random number generator
+int gasearch_set_seed(gasearch     _g,
+                      unsigned int _seed)
+{
+    // scramble seed; state must be non-zero
+    _g->rng_state = (_seed ^ 0x2545f491) * 2654435761u;
+    if (_g->rng_state == 0)
+        _g->rng_state = 1;
+    return LIQUID_OK;
+}
+
+// enable/disable caching of utility values
+int gasearch_set_cache(gasearch _g,
+                       int      _cache)
+{
+    _g->cache = _cache ? 1 : 0;
+    return LIQUID_OK;
+}
+
 // Execute the search
 //  _g              :   ga search object
 //  _max_iterations :   maximum number of iterations to run before bailing
@@ -229,7 +314,8 @@ float gasearch_run(gasearch     _g,
 int gasearch_evolve(gasearch _g)
 {
     // Inject random chromosome at end
-    chromosome_init_random(_g->population[_g->population_size-1]);
+    gasearch_init_random(_g, _g->population[_g->population_size-1]);
+    _g->dirty[_g->population_size-1] = 1;
 
     // Crossover
     gasearch_crossover(_g);
@@ -281,11 +367,60 @@ int gasearch_getopt(gasearch    _g,
 int gasearch_evaluate(gasearch _g)
 {
     unsigned int i;
-    for (i=0; i<_g->population_size; i++)
-        _g->utility[i] = _g->get_utility(_g->userdata, _g->population[i]);
+#if HAVE_LIBPTHREAD
+    if (_g->num_workers > 1) {
+        // run workers on separate threads; evaluate first worker's
+        // share on this thread, and any failing to start afterwards
+        pthread_t                threads[_g->num_workers];
+        struct gasearch_worker_s context[_g->num_workers];
+        int                      started[_g->num_workers];
+        for (i=1; i<_g->num_workers; i++) {
+            context[i].q     = _g;
+            context[i].index = i;
+            started[i] = pthread_create(&threads[i], NULL, gasearch_worker, &context[i]) == 0;
+        }
+        gasearch_evaluate_worker(_g, 0);
+        for (i=1; i<_g->num_workers; i++) {
+            if (started[i])
+                pthread_join(threads[i], NULL);
+            else
+                gasearch_evaluate_worker(_g, i);
+        }
+        return LIQUID_OK;
+    }
+#endif
+
+    // sequential evaluation
+    for (i=0; i<_g->num_workers; i++)
+        gasearch_evaluate_worker(_g, i);
     return LIQUID_OK;
 }
 
+// evaluate fitness of chromosomes assigned to worker
+int gasearch_evaluate_worker(gasearch     _g,
+                             unsigned int _worker)
+{
+    void * userdata = _g->worker_userdata == NULL ? _g->userdata : _g->worker_userdata[_worker];
+    unsigned int i;
+    for (i=_worker; i<_g->population_size; i+=_g->num_workers) {
+        if (_g->cache && !_g->dirty[i])
+            continue;
+        _g->utility[i] = _g->get_utility(userdata, _g->population[i]);
+        _g->dirty[i]   = 0;
+    }
+    return LIQUID_OK;
+}
+
+#if HAVE_LIBPTHREAD
+// worker thread: evaluate assigned chromosomes
+void * gasearch_worker(void * _context)
+{
+    struct gasearch_worker_s * w = (struct gasearch_worker_s*) _context;
+    gasearch_evaluate_worker(w->q, w->index);
+    return NULL;
+}
+#endif
+
 // crossover population
 int gasearch_crossover(gasearch _g)
 {
@@ -296,14 +431,15 @@ int gasearch_crossover(gasearch _g)
     unsigned int i;
     for (i=_g->selection_size; i<_g->population_size; i++) {
         // ensure fittest member is used at least once as parent
-        p1 = (i==_g->selection_size) ? _g->population[0] : _g->population[rand() % _g->selection_size];
-        p2 = _g->population[rand() % _g->selection_size];
-        threshold = rand() % _g->bits_per_chromosome;
+        p1 = (i==_g->selection_size) ? _g->population[0] : _g->population[gasearch_rand(_g) % _g->selection_size];
+        p2 = _g->population[gasearch_rand(_g) % _g->selection_size];
+        threshold = gasearch_rand(_g) % _g->bits_per_chromosome;
 
         c = _g->population[i];
 
         //printf("  gasearch_crossover, p1: %d, p2: %d, c: %d\n", p1, p2, c);
         chromosome_crossover(p1, p2, c, threshold);
+        _g->dirty[i] = 1;
     }
     return LIQUID_OK;
 }
@@ -320,9 +456,9 @@ int gasearch_mutate(gasearch _g)
         // generate random number and mutate if within mutation_rate range
         unsigned int num_mutations = 0;
         // force at least one mutation (otherwise nothing has changed)
-        while ( randf() < _g->mutation_rate || num_mutations == 0) {
+        while ( gasearch_randf(_g) < _g->mutation_rate || num_mutations == 0) {
             // generate random mutation index
-            index = rand() % _g->bits_per_chromosome;
+            index = gasearch_rand(_g) % _g->bits_per_chromosome;
 
             // mutate chromosome at index
             chromosome_mutate( _g->population[i], index );
@@ -333,6 +469,7 @@ int gasearch_mutate(gasearch _g)
             if (num_mutations == _g->bits_per_chromosome)
                 break;
         }
+        _g->dirty[i] = 1;
     }
     return LIQUID_OK;
 }
@@ -362,3 +499,29 @@ int gasearch_rank(gasearch _g)
     return LIQUID_OK;
 }
 
+// internal random number generator (xorshift)
+unsigned int gasearch_rand(gasearch _g)
+{
+    unsigned int x = _g->rng_state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    _g->rng_state = x;
+    return x;
+}
+
+// internal uniform random number generator in [0,1)
+float gasearch_randf(gasearch _g)
+{
+    return (float)(gasearch_rand(_g) >> 8) * (1.0f / 16777216.0f);
+}
+
+// initialize chromosome with random values from internal generator
+int gasearch_init_random(gasearch   _g,
+                         chromosome _c)
+{
+    unsigned int i;
+    for (i=0; i<_c->num_traits; i++)
+        _c->traits[i] = gasearch_rand(_g) & (_c->max_value[i]-1LU);
+    return LIQUID_OK;
+}
@@ -40,10 +40,13 @@ struct gradsearch_s {
 
     float * p;                  // gradient estimate
     float pnorm;                // L2-norm of gradient estimate
+    float * work;               // finite-difference points [n x n]
 
     utility_function utility;   // utility function pointer
     void * userdata;            // object to optimize (user data)
     int direction;              // search direction (minimize/maximimze utility)
+
+    struct optim_eval_s eval;   // gradient evaluator
 };
 
 // create a gradient search object
@@ -67,6 +70,13 @@ gradsearch gradsearch_create(void *           _userdata,
     q->utility        = _utility;
     q->direction      = _direction;
 
+    // evaluate gradient sequentially using finite differences by default
+    q->eval.utility     = _utility;
+    q->eval.batch       = NULL;
+    q->eval.gradient    = NULL;
+    q->eval.userdata    = _userdata;
+    q->eval.num_workers = 1;
+
     // set internal properties
     // TODO : make these user-configurable properties
     q->delta = 1e-6f;       // gradient approximation step size
@@ -74,6 +84,7 @@ gradsearch gradsearch_create(void *           _userdata,
 
     // allocate array for gradient estimate
     q->p = (float*) malloc(q->num_parameters*sizeof(float));
+    q->work = (float*) malloc(q->num_parameters*q->num_parameters*sizeof(float));
     q->pnorm = 0.0f;
     q->u = 0.0f;
 
@@ -82,8 +93,9 @@ gradsearch gradsearch_create(void *           _userdata,
 
 void gradsearch_destroy(gradsearch _q)
 {
-    // free gradient estimate array
+    // free gradient estimate and scratch arrays
     free(_q->p);
+    free(_q->work);
 
     // free main object memory
     free(_q);
@@ -121,11 +133,15 @@ float gradsearch_step(gradsearch _q)
 {
     unsigned int i;
 
+    // evaluate function at current operating point (needed for finite
+    // difference approximation only)
+    float u0 = _q->eval.gradient == NULL ? _q->utility(_q->userdata, _q->v, _q->num_parameters) : 0.0f;
+
     // ensure norm(p) > 0, otherwise increase delta
     unsigned int n=20;
     for (i=0; i<n; i++) {
         // compute gradient
-        gradsearch_gradient(_q->utility, _q->userdata, _q->v, _q->num_parameters, _q->delta, _q->p);
+        optim_eval_gradient(&_q->eval, _q->v, _q->num_parameters, u0, _q->delta, _q->work, _q->p);
 
         // normalize gradient vector
         _q->pnorm = gradsearch_norm(_q->p, _q->num_parameters);
@@ -205,6 +221,32 @@ float gradsearch_execute(gradsearch   _q,
 }
 
 
+// set batched utility function used to evaluate gradients
+int gradsearch_set_batch(gradsearch             _q,
+                         utility_function_batch _batch)
+{
+    _q->eval.batch = _batch;
+    return LIQUID_OK;
+}
+
+// set analytic gradient function
+int gradsearch_set_gradient(gradsearch        _q,
+                            gradient_function _gradient)
+{
+    _q->eval.gradient = _gradient;
+    return LIQUID_OK;
+}
+
+// set number of threads evaluating gradients
+int gradsearch_set_workers(gradsearch   _q,
+                           unsigned int _num_workers)
+{
+    if (_num_workers == 0)
+        return liquid_error(LIQUID_EICONFIG,"gradsearch_set_workers(), number of workers must be greater than zero");
+    _q->eval.num_workers = _num_workers;
+    return LIQUID_OK;
+}
+
 // 
 // internal (generic functions)
 //
@@ -26,9 +26,26 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "liquid.internal.h"
 
+#if HAVE_LIBPTHREAD
+#include <pthread.h>
+
+// worker thread context for evaluating block of points
+struct optim_eval_worker_s {
+    struct optim_eval_s * e;    // utility evaluator
+    float *               v;    // first point in block
+    unsigned int          n;    // dimensionality
+    unsigned int          k;    // number of points in block
+    float *               u;    // first utility in block
+};
+
+// worker thread: evaluate block of points
+void * optim_eval_worker(void * _context);
+#endif
+
 
 // optimization threshold switch
 //  _u0         :   first utility
@@ -73,4 +90,86 @@ void optim_sort(float *_v,
     }
 }
 
+// evaluate utility at multiple points
+int optim_eval_batch(struct optim_eval_s * _e,
+                     float *               _v,
+                     unsigned int          _n,
+                     unsigned int          _k,
+                     float *               _u)
+{
+    if (_e->batch != NULL)
+        return _e->batch(_e->userdata, _v, _n, _k, _u);
+
+    unsigned int i;
+#if HAVE_LIBPTHREAD
+    // split points into contiguous blocks, evaluating first on this thread
+    unsigned int num_workers = _e->num_workers < _k ? _e->num_workers : _k;
+    if (num_workers > 1) {
+        pthread_t                  threads[num_workers];
+        struct optim_eval_worker_s context[num_workers];
+        int                        started[num_workers];
+        for (i=0; i<num_workers; i++) {
+            unsigned int i0 = (i  *_k) / num_workers;
+            unsigned int i1 = ((i+1)*_k) / num_workers;
+            context[i].e = _e;
+            context[i].v = _v + i0*_n;
+            context[i].n = _n;
+            context[i].k = i1 - i0;
+            context[i].u = _u + i0;
+            started[i] = i > 0 &&
+                pthread_create(&threads[i], NULL, optim_eval_worker, &context[i]) == 0;
+        }
+        for (i=0; i<num_workers; i++) {
+            if (started[i])
+                pthread_join(threads[i], NULL);
+            else
+                optim_eval_worker(&context[i]);
+        }
+        return LIQUID_OK;
+    }
+#endif
+
+    // sequential evaluation
+    for (i=0; i<_k; i++)
+        _u[i] = _e->utility(_e->userdata, _v + i*_n, _n);
+    return LIQUID_OK;
+}
+
+#if HAVE_LIBPTHREAD
+// worker thread: evaluate block of points
+void * optim_eval_worker(void * _context)
+{
+    struct optim_eval_worker_s * w = (struct optim_eval_worker_s*) _context;
+    unsigned int i;
+    for (i=0; i<w->k; i++)
+        w->u[i] = w->e->utility(w->e->userdata, w->v + i*w->n, w->n);
+    return NULL;
+}
+#endif
 
+// compute gradient at a particular point
+int optim_eval_gradient(struct optim_eval_s * _e,
+                        float *               _x,
+                        unsigned int          _n,
+                        float                 _u0,
+                        float                 _delta,
+                        float *               _work,
+                        float *               _gradient)
+{
+    if (_e->gradient != NULL)
+        return _e->gradient(_e->userdata, _x, _n, _gradient);
+
+    // build test points, incrementing operating point by delta along
+    // each dimension, and evaluate as a single batch
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        memmove(&_work[i*_n], _x, _n*sizeof(float));
+        _work[i*_n + i] += _delta;
+    }
+    int rc = optim_eval_batch(_e, _work, _n, _n, _gradient);
+
+    // compute gradient estimate
+    for (i=0; i<_n; i++)
+        _gradient[i] = (_gradient[i] - _u0) / _delta;
+    return rc;
+}
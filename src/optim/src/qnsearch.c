@@ -44,14 +44,21 @@ struct qnsearch_s {
     float* p;           // search direction
     float* gradient;    // gradient approximation
     float* gradient0;   // gradient approximation (previous step)
+    float* work;        // finite-difference points [n x n]
 
     // External utility function.
     utility_function get_utility;
     float utility;      // current utility
     void * userdata;    // userdata pointer passed to utility callback
     int minimize;       // minimize/maximimze utility (search direction)
+
+    struct optim_eval_s eval;   // gradient/Hessian evaluator
 };
 
+// maximum number of points evaluated in a single batch when estimating
+// the Hessian (bounds temporary memory to this many parameter vectors)
+#define QNSEARCH_HESSIAN_BATCH (1024)
+
 // compute gradient(x_k)
 int qnsearch_compute_gradient(qnsearch _q);
 
@@ -91,6 +98,13 @@ qnsearch qnsearch_create(void *           _userdata,
     q->get_utility = _u;
     q->minimize = ( _minmax == LIQUID_OPTIM_MINIMIZE ) ? 1 : 0;
 
+    // evaluate sequentially using finite differences by default
+    q->eval.utility     = _u;
+    q->eval.batch       = NULL;
+    q->eval.gradient    = NULL;
+    q->eval.userdata    = _userdata;
+    q->eval.num_workers = 1;
+
     // initialize internal memory arrays
     q->B        = (float*) calloc( q->num_parameters*q->num_parameters, sizeof(float));
     q->H        = (float*) calloc( q->num_parameters*q->num_parameters, sizeof(float));
@@ -99,6 +113,7 @@ qnsearch qnsearch_create(void *           _userdata,
     q->gradient0= (float*) calloc( q->num_parameters, sizeof(float) );
     q->v_prime  = (float*) calloc( q->num_parameters, sizeof(float) );
     q->dv       = (float*) calloc( q->num_parameters, sizeof(float) );
+    q->work     = (float*) calloc( q->num_parameters*q->num_parameters, sizeof(float));
     q->utility = q->get_utility(q->userdata, q->v, q->num_parameters);
 
     qnsearch_reset(q);
@@ -114,6 +129,7 @@ int qnsearch_destroy(qnsearch _q)
     free(_q->gradient0);
     free(_q->v_prime);
     free(_q->dv);
+    free(_q->work);
     free(_q);
     return LIQUID_OK;
 }
@@ -223,6 +239,32 @@ float qnsearch_execute(qnsearch _q,
     return _q->utility;
 }
 
+// set batched utility function
+int qnsearch_set_batch(qnsearch               _q,
+                       utility_function_batch _batch)
+{
+    _q->eval.batch = _batch;
+    return LIQUID_OK;
+}
+
+// set analytic gradient function
+int qnsearch_set_gradient(qnsearch          _q,
+                          gradient_function _gradient)
+{
+    _q->eval.gradient = _gradient;
+    return LIQUID_OK;
+}
+
+// set number of threads evaluating utility
+int qnsearch_set_workers(qnsearch     _q,
+                         unsigned int _num_workers)
+{
+    if (_num_workers == 0)
+        return liquid_error(LIQUID_EICONFIG,"qnsearch_set_workers(), number of workers must be greater than zero");
+    _q->eval.num_workers = _num_workers;
+    return LIQUID_OK;
+}
+
 // 
 // internal
 //
@@ -230,83 +272,102 @@ float qnsearch_execute(qnsearch _q,
 // compute gradient
 int qnsearch_compute_gradient(qnsearch _q)
 {
-    unsigned int i;
-    float f_prime;
-
-    // reset v_prime
-    memmove(_q->v_prime, _q->v, (_q->num_parameters)*sizeof(float));
-
-    for (i=0; i<_q->num_parameters; i++) {
-        _q->v_prime[i] += _q->delta;
-        f_prime = _q->get_utility(_q->userdata, _q->v_prime, _q->num_parameters);
-        _q->v_prime[i] -= _q->delta;
-        _q->gradient[i] = (f_prime - _q->utility) / _q->delta;
-    }
-    return LIQUID_OK;
+    return optim_eval_gradient(&_q->eval, _q->v, _q->num_parameters,
+                               _q->utility, _q->delta, _q->work, _q->gradient);
 }
 
 // compute Hessian
 int qnsearch_compute_Hessian(qnsearch _q)
 {
-    unsigned int i, j;
+    unsigned int i, j, k;
     unsigned int n = _q->num_parameters;
-    float f00, f01, f10, f11;
-    float f0, f1, f2;
-    float m0, m1;
     float delta = 1e-2f;
 
-    // reset v_prime
-    memmove(_q->v_prime, _q->v, (_q->num_parameters)*sizeof(float));
-
+    if (_q->eval.gradient != NULL) {
+        // central differences of analytic gradient, symmetrized
+        float g0[n], g1[n];
+        memmove(_q->v_prime, _q->v, n*sizeof(float));
+        for (j=0; j<n; j++) {
+            _q->v_prime[j] = _q->v[j] - delta;
+            _q->eval.gradient(_q->eval.userdata, _q->v_prime, n, g0);
+            _q->v_prime[j] = _q->v[j] + delta;
+            _q->eval.gradient(_q->eval.userdata, _q->v_prime, n, g1);
+            _q->v_prime[j] = _q->v[j];
+            for (i=0; i<n; i++)
+                matrix_access(_q->H, n, n, i, j) = (g1[i] - g0[i]) / (2.0f*delta);
+        }
+        for (i=0; i<n; i++) {
+            for (j=0; j<i; j++) {
+                float h = 0.5f*(matrix_access(_q->H, n, n, i, j) + matrix_access(_q->H, n, n, j, i));
+                matrix_access(_q->H, n, n, i, j) = h;
+                matrix_access(_q->H, n, n, j, i) = h;
+            }
+        }
+        return LIQUID_OK;
+    }
 
-    for (i=0; i<_q->num_parameters; i++) {
-        //for (j=0; j<_q->num_parameters; j++) {
-        for (j=0; j<=i; j++) {
-            if (i==j) {
-
-                _q->v_prime[i] = _q->v[i] - delta;
-                f0 = _q->get_utility(_q->userdata, _q->v_prime, _q->num_parameters);
-
-                _q->v_prime[i] = _q->v[i];
-                f1 = _q->get_utility(_q->userdata, _q->v_prime, _q->num_parameters);
-
-                _q->v_prime[i] = _q->v[i] + delta;
-                f2 = _q->get_utility(_q->userdata, _q->v_prime, _q->num_parameters);
-                
-                m0 = (f1 - f0) / delta;
-                m1 = (f2 - f1) / delta;
-                matrix_access(_q->H, n, n, i, j) = (m1 - m0) / delta;
-
-            } else {
-
-                // 0 0
-                _q->v_prime[i] = _q->v[i] - delta;
-                _q->v_prime[j] = _q->v[j] - delta;
-                f00 = _q->get_utility(_q->userdata, _q->v_prime, _q->num_parameters);
-
-                // 0 1
-                _q->v_prime[i] = _q->v[i] - delta;
-                _q->v_prime[j] = _q->v[j] + delta;
-                f01 = _q->get_utility(_q->userdata, _q->v_prime, _q->num_parameters);
-
-                // 1 0
-                _q->v_prime[i] = _q->v[i] + delta;
-                _q->v_prime[j] = _q->v[j] - delta;
-                f10 = _q->get_utility(_q->userdata, _q->v_prime, _q->num_parameters);
-
-                // 1 1
-                _q->v_prime[i] = _q->v[i] + delta;
-                _q->v_prime[j] = _q->v[j] + delta;
-                f11 = _q->get_utility(_q->userdata, _q->v_prime, _q->num_parameters);
-
-                // compute second partial derivative
-                m0 = (f01 - f00) / (2.0f*delta);
-                m1 = (f11 - f10) / (2.0f*delta);
-                matrix_access(_q->H, n, n, i, j) = (m1 - m0) / (2.0f*delta);
-                matrix_access(_q->H, n, n, j, i) = (m1 - m0) / (2.0f*delta);
+    // Evaluation points: center; v[i] -/+ delta along each dimension;
+    // and v[i] -/+ delta, v[j] -/+ delta for each pair j < i. Each point
+    // is described by its two perturbed indices and signs; all points are
+    // evaluated in batches.
+    unsigned int num_points = 1 + 2*n + 2*n*(n-1);
+    unsigned int * pi = (unsigned int*) malloc(2*num_points*sizeof(unsigned int));
+    signed char  * ps = (signed char *) malloc(2*num_points*sizeof(signed char));
+    float        * f  = (float*)        malloc(  num_points*sizeof(float));
+    k = 0;
+    pi[0] = pi[1] = 0; ps[0] = ps[1] = 0; k++;
+    for (i=0; i<n; i++) {
+        int si;
+        for (si=-1; si<=1; si+=2) {
+            pi[2*k] = i; ps[2*k] = si; pi[2*k+1] = 0; ps[2*k+1] = 0; k++;
+        }
+        for (j=0; j<i; j++) {
+            int sj;
+            for (si=-1; si<=1; si+=2) {
+                for (sj=-1; sj<=1; sj+=2) {
+                    pi[2*k] = i; ps[2*k] = si; pi[2*k+1] = j; ps[2*k+1] = sj; k++;
+                }
             }
         }
     }
+
+    unsigned int batch = num_points < QNSEARCH_HESSIAN_BATCH ? num_points : QNSEARCH_HESSIAN_BATCH;
+    float * v = (float*) malloc(batch*n*sizeof(float));
+    unsigned int k0;
+    for (k0=0; k0<num_points; k0+=batch) {
+        unsigned int kn = num_points - k0 < batch ? num_points - k0 : batch;
+        for (k=0; k<kn; k++) {
+            float * vk = &v[k*n];
+            memmove(vk, _q->v, n*sizeof(float));
+            vk[pi[2*(k0+k)  ]] += ps[2*(k0+k)  ]*delta;
+            vk[pi[2*(k0+k)+1]] += ps[2*(k0+k)+1]*delta;
+        }
+        optim_eval_batch(&_q->eval, v, n, kn, &f[k0]);
+    }
+
+    // compute second partial derivatives
+    float f1 = f[0];
+    k = 1;
+    for (i=0; i<n; i++) {
+        float f0 = f[k++];
+        float f2 = f[k++];
+        matrix_access(_q->H, n, n, i, i) = ((f2 - f1) - (f1 - f0)) / (delta*delta);
+        for (j=0; j<i; j++) {
+            float f00 = f[k++];
+            float f01 = f[k++];
+            float f10 = f[k++];
+            float f11 = f[k++];
+            float m0 = (f01 - f00) / (2.0f*delta);
+            float m1 = (f11 - f10) / (2.0f*delta);
+            matrix_access(_q->H, n, n, i, j) = (m1 - m0) / (2.0f*delta);
+            matrix_access(_q->H, n, n, j, i) = (m1 - m0) / (2.0f*delta);
+        }
+    }
+
+    free(pi);
+    free(ps);
+    free(f);
+    free(v);
     return LIQUID_OK;
 }
 
@@ -196,9 +196,140 @@ void autotest_gasearch_config()
     CONTEND_INEQUALITY(LIQUID_OK, gasearch_set_mutation_rate  (ga,-1.0f)) // mutation rate out of range
     CONTEND_INEQUALITY(LIQUID_OK, gasearch_set_mutation_rate  (ga, 2.0f)) // mutation rate out of range
     CONTEND_EQUALITY  (LIQUID_OK, gasearch_set_mutation_rate  (ga, 0.1f)) // ok
+    CONTEND_INEQUALITY(LIQUID_OK, gasearch_set_workers(ga, 0, NULL, NULL)) // too few workers
+    CONTEND_EQUALITY  (LIQUID_OK, gasearch_set_workers(ga, 4, NULL, NULL)) // ok
 
     // destroy objects
     chromosome_destroy(prototype);
     gasearch_destroy(ga);
 }
 
+
+// counting callback: peak utility, incrementing evaluation counter
+float gasearch_autotest_count_callback(void * _userdata, chromosome _c)
+{
+    unsigned int * count = (unsigned int*)_userdata;
+    (*count)++;
+    return gasearch_autotest_peak_callback(NULL, _c);
+}
+
+// number of live user data clones
+static int gasearch_autotest_num_clones = 0;
+
+void * gasearch_autotest_clone(void * _userdata, unsigned int _worker)
+{
+    gasearch_autotest_num_clones++;
+    unsigned int * count = (unsigned int*) malloc(sizeof(unsigned int));
+    *count = 0;
+    return count;
+}
+
+void gasearch_autotest_destroy(void * _userdata)
+{
+    gasearch_autotest_num_clones--;
+    free(_userdata);
+}
+
+// run search with given number of workers from fixed seed
+float gasearch_autotest_run(unsigned int _num_workers,
+                            float *      _v_opt)
+{
+    unsigned int i, count = 0;
+    chromosome prototype = chromosome_create_basic(8, 10);
+    srand(1234);
+    gasearch ga = gasearch_create_advanced(gasearch_autotest_count_callback, &count,
+                    prototype, LIQUID_OPTIM_MAXIMIZE, 24, 0.2f);
+    gasearch_set_seed(ga, 5678);
+    if (_num_workers > 1) {
+        gasearch_set_workers(ga, _num_workers, gasearch_autotest_clone, gasearch_autotest_destroy);
+        CONTEND_EQUALITY(gasearch_autotest_num_clones, (int)_num_workers);
+    }
+    float u_opt;
+    gasearch_run(ga, 200, 1e6f);
+    gasearch_getopt(ga, prototype, &u_opt);
+    for (i=0; i<8; i++)
+        _v_opt[i] = chromosome_valuef(prototype, i);
+    chromosome_destroy(prototype);
+    gasearch_destroy(ga);
+    CONTEND_EQUALITY(gasearch_autotest_num_clones, 0);
+    return u_opt;
+}
+
+// parallel evaluation gives same result as sequential
+void autotest_gasearch_workers()
+{
+    float v0[8], v1[8];
+    float u0 = gasearch_autotest_run(1, v0);
+    float u1 = gasearch_autotest_run(4, v1);
+    CONTEND_EQUALITY(u0, u1);
+    CONTEND_SAME_DATA(v0, v1, sizeof(v0));
+}
+
+// cached evaluation skips unchanged elite
+void autotest_gasearch_cache()
+{
+    unsigned int population_size = 16;
+    unsigned int num_iterations  = 50;
+    unsigned int count = 0;
+    chromosome prototype = chromosome_create_basic(8, 10);
+    gasearch ga = gasearch_create_advanced(gasearch_autotest_count_callback, &count,
+                    prototype, LIQUID_OPTIM_MAXIMIZE, population_size, 0.2f);
+    CONTEND_EQUALITY(count, population_size);
+
+    // without caching, entire population is evaluated each generation
+    unsigned int i;
+    for (i=0; i<num_iterations; i++)
+        gasearch_evolve(ga);
+    CONTEND_EQUALITY(count, population_size*(1+num_iterations));
+
+    // with caching, elite is not re-evaluated
+    count = 0;
+    gasearch_set_cache(ga, 1);
+    for (i=0; i<num_iterations; i++)
+        gasearch_evolve(ga);
+    CONTEND_EQUALITY(count, (population_size-1)*num_iterations);
+
+    chromosome_destroy(prototype);
+    gasearch_destroy(ga);
+}
+
+// per-worker evaluation counters
+static unsigned int gasearch_autotest_worker_count[4];
+
+void * gasearch_autotest_clone_counter(void * _userdata, unsigned int _worker)
+{
+    gasearch_autotest_worker_count[_worker] = 0;
+    return &gasearch_autotest_worker_count[_worker];
+}
+
+void gasearch_autotest_destroy_counter(void * _userdata)
+{
+}
+
+// parallel evaluation invokes utility exactly once per chromosome
+void autotest_gasearch_workers_count()
+{
+    unsigned int population_size = 16;
+    unsigned int num_iterations  = 20;
+    unsigned int count = 0;
+    chromosome prototype = chromosome_create_basic(8, 10);
+    gasearch ga = gasearch_create_advanced(gasearch_autotest_count_callback, &count,
+                    prototype, LIQUID_OPTIM_MAXIMIZE, population_size, 0.2f);
+    gasearch_set_workers(ga, 4, gasearch_autotest_clone_counter,
+                                gasearch_autotest_destroy_counter);
+
+    unsigned int i;
+    for (i=0; i<num_iterations; i++)
+        gasearch_evolve(ga);
+
+    // each worker evaluates its own share of the population
+    unsigned int total = 0;
+    for (i=0; i<4; i++) {
+        CONTEND_EQUALITY(gasearch_autotest_worker_count[i], population_size/4*num_iterations);
+        total += gasearch_autotest_worker_count[i];
+    }
+    CONTEND_EQUALITY(total, population_size*num_iterations);
+
+    chromosome_destroy(prototype);
+    gasearch_destroy(ga);
+}
@@ -30,6 +30,7 @@
 #include <getopt.h>
 
 #include "liquid.internal.h"
+#include "src/optim/tests/optim_runtest.h"
 
 //
 // AUTOTEST: Find minimum of Rosenbrock function, should be [1 1 1 ...]
@@ -158,3 +159,43 @@ void autotest_gradsearch_maxutility()
     CONTEND_DELTA( utility_max_autotest(NULL, v_opt, num_parameters), 1.0f, tol );
 }
 
+
+// run Rosenbrock search: 0 (default), 1 (workers), 2 (batch), 3 (gradient)
+void gradsearch_autotest_run(int          _mode,
+                             unsigned int _num_iterations,
+                             float *      _v,
+                             unsigned int _n)
+{
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        _v[i] = 0.0f;
+    gradsearch gs = gradsearch_create(NULL, _v, _n, liquid_rosenbrock, LIQUID_OPTIM_MINIMIZE);
+    if (_mode == 1) gradsearch_set_workers (gs, 4);
+    if (_mode == 2) gradsearch_set_batch   (gs, optim_autotest_rosenbrock_batch);
+    if (_mode == 3) gradsearch_set_gradient(gs, optim_autotest_rosenbrock_gradient);
+    for (i=0; i<_num_iterations; i++)
+        gradsearch_step(gs);
+    gradsearch_destroy(gs);
+}
+
+// parallel and batched gradient evaluation match sequential evaluation
+void autotest_gradsearch_workers()
+{
+    float v0[12], v1[12], v2[12];
+    gradsearch_autotest_run(0, 200, v0, 12);
+    gradsearch_autotest_run(1, 200, v1, 12);
+    gradsearch_autotest_run(2, 200, v2, 12);
+    CONTEND_SAME_DATA(v0, v1, sizeof(v0));
+    CONTEND_SAME_DATA(v0, v2, sizeof(v0));
+}
+
+// search converges with analytic gradient
+void autotest_gradsearch_gradient()
+{
+    float tol = 1e-2f;
+    float v[6];
+    gradsearch_autotest_run(3, 4000, v, 6);
+    unsigned int i;
+    for (i=0; i<6; i++)
+        CONTEND_DELTA(v[i], 1.0f, tol);
+}
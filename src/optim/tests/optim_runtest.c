@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2007 - 2022 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "autotest/autotest.h"
+#include "liquid.h"
+#include "src/optim/tests/optim_runtest.h"
+
+// batched Rosenbrock utility
+int optim_autotest_rosenbrock_batch(void *       _userdata,
+                                    float *      _v,
+                                    unsigned int _n,
+                                    unsigned int _k,
+                                    float *      _u)
+{
+    unsigned int i;
+    for (i=0; i<_k; i++)
+        _u[i] = liquid_rosenbrock(_userdata, _v + i*_n, _n);
+    return LIQUID_OK;
+}
+
+// analytic gradient of Rosenbrock utility
+int optim_autotest_rosenbrock_gradient(void *       _userdata,
+                                       float *      _v,
+                                       unsigned int _n,
+                                       float *      _g)
+{
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        _g[i] = 0.0f;
+    for (i=0; i<_n-1; i++) {
+        float t = _v[i+1] - _v[i]*_v[i];
+        _g[i]   += -2.0f*(1.0f - _v[i]) - 400.0f*_v[i]*t;
+        _g[i+1] +=  200.0f*t;
+    }
+    return LIQUID_OK;
+}
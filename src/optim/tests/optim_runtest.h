@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2007 - 2022 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// optimization autotest helper functions
+//
+
+#ifndef __LIQUID_OPTIM_RUNTEST_H__
+#define __LIQUID_OPTIM_RUNTEST_H__
+
+// batched Rosenbrock utility (see utility_function_batch)
+//  _userdata   :   user data (unused)
+//  _v          :   input points, one per row, [size: _k x _n]
+//  _n          :   dimensionality of search
+//  _k          :   number of points
+//  _u          :   output utilities, [size: _k x 1]
+int optim_autotest_rosenbrock_batch(void *       _userdata,
+                                    float *      _v,
+                                    unsigned int _n,
+                                    unsigned int _k,
+                                    float *      _u);
+
+// analytic gradient of Rosenbrock utility (see gradient_function)
+//  _userdata   :   user data (unused)
+//  _v          :   operating point, [size: _n x 1]
+//  _n          :   dimensionality of search
+//  _g          :   output gradient, [size: _n x 1]
+int optim_autotest_rosenbrock_gradient(void *       _userdata,
+                                       float *      _v,
+                                       unsigned int _n,
+                                       float *      _g);
+
+#endif // __LIQUID_OPTIM_RUNTEST_H__
@@ -30,6 +30,7 @@
 #include <getopt.h>
 
 #include "liquid.internal.h"
+#include "src/optim/tests/optim_runtest.h"
 
 void autotest_qnsearch_rosenbrock()
 {
@@ -81,8 +82,52 @@ void autotest_qnsearch_config()
     // create proper object and test configurations
     qnsearch q = qnsearch_create(NULL, v, 8, liquid_rosenbrock, LIQUID_OPTIM_MINIMIZE);
     CONTEND_EQUALITY(LIQUID_OK, qnsearch_print(q))
+    CONTEND_INEQUALITY(LIQUID_OK, qnsearch_set_workers(q, 0))
+    CONTEND_EQUALITY  (LIQUID_OK, qnsearch_set_workers(q, 2))
 
     // destroy objects
     qnsearch_destroy(q);
 }
 
+
+// parallel and batched evaluation match sequential evaluation
+void autotest_qnsearch_workers()
+{
+    unsigned int n = 8;
+    float v0[n], v1[n], v2[n];
+    unsigned int i;
+    for (i=0; i<n; i++)
+        v0[i] = v1[i] = v2[i] = 0.0f;
+    qnsearch q0 = qnsearch_create(NULL, v0, n, liquid_rosenbrock, LIQUID_OPTIM_MINIMIZE);
+    qnsearch q1 = qnsearch_create(NULL, v1, n, liquid_rosenbrock, LIQUID_OPTIM_MINIMIZE);
+    qnsearch q2 = qnsearch_create(NULL, v2, n, liquid_rosenbrock, LIQUID_OPTIM_MINIMIZE);
+    qnsearch_set_workers(q1, 3);
+    qnsearch_set_batch  (q2, optim_autotest_rosenbrock_batch);
+    for (i=0; i<50; i++) {
+        qnsearch_step(q0);
+        qnsearch_step(q1);
+        qnsearch_step(q2);
+    }
+    CONTEND_SAME_DATA(v0, v1, sizeof(v0));
+    CONTEND_SAME_DATA(v0, v2, sizeof(v0));
+    qnsearch_destroy(q0);
+    qnsearch_destroy(q1);
+    qnsearch_destroy(q2);
+}
+
+// search converges with analytic gradient and Hessian from gradients
+void autotest_qnsearch_gradient()
+{
+    float tol = 1e-2f;
+    unsigned int n = 6;
+    float v[n];
+    unsigned int i;
+    for (i=0; i<n; i++)
+        v[i] = 0.0f;
+    qnsearch q = qnsearch_create(NULL, v, n, liquid_rosenbrock, LIQUID_OPTIM_MINIMIZE);
+    qnsearch_set_gradient(q, optim_autotest_rosenbrock_gradient);
+    qnsearch_execute(q, 4000, 0.0f);
+    qnsearch_destroy(q);
+    for (i=0; i<n; i++)
+        CONTEND_DELTA(v[i], 1.0f, tol);
+}
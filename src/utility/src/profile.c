@@ -0,0 +1,361 @@
+/*
+ * Copyright (c) 2007 - 2022 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Per-object profiling registry
+//
+// Each instrumented object holds a node in a global list of live
+// instances; nodes are grouped by type, and the counters of destroyed
+// instances are accumulated into their type. Counters are updated by the
+// thread using the object without locking (objects are not shared
+// between threads); the registry itself is protected by a mutex.
+//
+
+#include <stdlib.h>
+#include <string.h>
+#include "liquid.internal.h"
+
+#if LIQUID_PROFILE
+
+#if HAVE_LIBPTHREAD
+#  include <pthread.h>
+static pthread_mutex_t liquid_profile_mutex = PTHREAD_MUTEX_INITIALIZER;
+#  define LIQUID_PROFILE_LOCK()   pthread_mutex_lock  (&liquid_profile_mutex)
+#  define LIQUID_PROFILE_UNLOCK() pthread_mutex_unlock(&liquid_profile_mutex)
+#else
+#  define LIQUID_PROFILE_LOCK()
+#  define LIQUID_PROFILE_UNLOCK()
+#endif
+
+// cycle counter: time-stamp counter on x86, monotonic clock elsewhere
+#if defined(__x86_64__) || defined(__i386__)
+#  include <x86intrin.h>
+#  define LIQUID_PROFILE_CLOCK_STR "tsc"
+static unsigned long long liquid_profile_clock(void)
+{
+    return __rdtsc();
+}
+#else
+#  include <time.h>
+#  define LIQUID_PROFILE_CLOCK_STR "ns"
+static unsigned long long liquid_profile_clock(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return 1000000000ULL*ts.tv_sec + ts.tv_nsec;
+}
+#endif
+
+// object type: totals of destroyed instances
+typedef struct liquid_profile_type_s * liquid_profile_type;
+struct liquid_profile_type_s {
+    const char *        name;           // type name
+    unsigned int        num_instances;  // number of instances created
+    unsigned long long  num_calls;      // calls of destroyed instances
+    unsigned long long  num_samples;    // samples of destroyed instances
+    unsigned long long  num_cycles;     // cycles of destroyed instances
+    liquid_profile_type next;
+};
+
+// object instance
+struct liquid_profile_node_s {
+    liquid_profile_type type;           // object type
+    unsigned long int   id;             // unique instance id
+    unsigned long long  num_calls;      // number of instrumented calls
+    unsigned long long  num_samples;    // number of samples processed
+    unsigned long long  num_cycles;     // cumulative cycles
+    unsigned int        depth;          // nesting depth of instrumented calls
+    liquid_profile_node prev;
+    liquid_profile_node next;
+};
+
+// global registry
+static liquid_profile_type     liquid_profile_types    = NULL;
+static liquid_profile_node     liquid_profile_nodes    = NULL;
+static unsigned long int       liquid_profile_next_id  = 1;
+static liquid_profile_callback liquid_profile_destroy_callback = NULL;
+static void *                  liquid_profile_destroy_userdata = NULL;
+
+// find type by name, creating it if necessary (registry must be locked)
+static liquid_profile_type liquid_profile_find_type(const char * _name,
+                                                    int          _create)
+{
+    liquid_profile_type t;
+    for (t=liquid_profile_types; t!=NULL; t=t->next) {
+        if (strcmp(t->name, _name) == 0)
+            return t;
+    }
+    if (!_create)
+        return NULL;
+    t = (liquid_profile_type) calloc(1, sizeof(struct liquid_profile_type_s));
+    t->name = _name;
+    t->next = liquid_profile_types;
+    liquid_profile_types = t;
+    return t;
+}
+
+// fill statistics from instance
+static void liquid_profile_node_stats(liquid_profile_node _q,
+                                      liquid_profile_s *  _stats)
+{
+    _stats->type          = _q->type->name;
+    _stats->id            = _q->id;
+    _stats->num_instances = 1;
+    _stats->num_calls     = _q->num_calls;
+    _stats->num_samples   = _q->num_samples;
+    _stats->num_cycles    = _q->num_cycles;
+}
+
+// fill statistics from type, including live instances (registry must
+// be locked)
+static void liquid_profile_type_stats(liquid_profile_type _t,
+                                      liquid_profile_s *  _stats)
+{
+    _stats->type          = _t->name;
+    _stats->id            = 0;
+    _stats->num_instances = _t->num_instances;
+    _stats->num_calls     = _t->num_calls;
+    _stats->num_samples   = _t->num_samples;
+    _stats->num_cycles    = _t->num_cycles;
+    liquid_profile_node q;
+    for (q=liquid_profile_nodes; q!=NULL; q=q->next) {
+        if (q->type != _t)
+            continue;
+        _stats->num_calls   += q->num_calls;
+        _stats->num_samples += q->num_samples;
+        _stats->num_cycles  += q->num_cycles;
+    }
+}
+
+liquid_profile_node liquid_profile_register(const char * _type)
+{
+    liquid_profile_node q = (liquid_profile_node) calloc(1, sizeof(struct liquid_profile_node_s));
+    LIQUID_PROFILE_LOCK();
+    q->type = liquid_profile_find_type(_type, 1);
+    q->type->num_instances++;
+    q->id   = liquid_profile_next_id++;
+    q->next = liquid_profile_nodes;
+    if (q->next != NULL)
+        q->next->prev = q;
+    liquid_profile_nodes = q;
+    LIQUID_PROFILE_UNLOCK();
+    return q;
+}
+
+void liquid_profile_unregister(liquid_profile_node _q)
+{
+    if (_q == NULL)
+        return;
+
+    // remove from list and accumulate counters into type
+    LIQUID_PROFILE_LOCK();
+    if (_q->prev != NULL) _q->prev->next = _q->next;
+    else                  liquid_profile_nodes = _q->next;
+    if (_q->next != NULL) _q->next->prev = _q->prev;
+    _q->type->num_calls   += _q->num_calls;
+    _q->type->num_samples += _q->num_samples;
+    _q->type->num_cycles  += _q->num_cycles;
+    liquid_profile_callback callback = liquid_profile_destroy_callback;
+    void *                  userdata = liquid_profile_destroy_userdata;
+    LIQUID_PROFILE_UNLOCK();
+
+    // export final statistics outside of lock
+    if (callback != NULL) {
+        liquid_profile_s stats;
+        liquid_profile_node_stats(_q, &stats);
+        callback(&stats, userdata);
+    }
+    free(_q);
+}
+
+unsigned long long liquid_profile_begin(liquid_profile_node _q)
+{
+    if (_q == NULL || _q->depth++ > 0)
+        return 0;
+    return liquid_profile_clock();
+}
+
+void liquid_profile_end(liquid_profile_node _q,
+                        unsigned long long  _t0,
+                        unsigned long long  _num_samples)
+{
+    if (_q == NULL || --_q->depth > 0)
+        return;
+    _q->num_cycles  += liquid_profile_clock() - _t0;
+    _q->num_calls   += 1;
+    _q->num_samples += _num_samples;
+}
+
+int liquid_profile_is_enabled(void)
+{
+    return 1;
+}
+
+int liquid_profile_reset(void)
+{
+    LIQUID_PROFILE_LOCK();
+    liquid_profile_type t;
+    for (t=liquid_profile_types; t!=NULL; t=t->next) {
+        t->num_calls   = 0;
+        t->num_samples = 0;
+        t->num_cycles  = 0;
+    }
+    liquid_profile_node q;
+    for (q=liquid_profile_nodes; q!=NULL; q=q->next) {
+        q->num_calls   = 0;
+        q->num_samples = 0;
+        q->num_cycles  = 0;
+    }
+    LIQUID_PROFILE_UNLOCK();
+    return LIQUID_OK;
+}
+
+int liquid_profile_get(const char *       _type,
+                       liquid_profile_s * _stats)
+{
+    LIQUID_PROFILE_LOCK();
+    liquid_profile_type t = liquid_profile_find_type(_type, 0);
+    if (t != NULL)
+        liquid_profile_type_stats(t, _stats);
+    LIQUID_PROFILE_UNLOCK();
+    return t == NULL ? LIQUID_EIVAL : LIQUID_OK;
+}
+
+// Callbacks are invoked with the registry locked and therefore must not
+// create or destroy instrumented objects.
+int liquid_profile_foreach(liquid_profile_callback _callback,
+                           void *                  _userdata)
+{
+    liquid_profile_s stats;
+    LIQUID_PROFILE_LOCK();
+    liquid_profile_node q;
+    for (q=liquid_profile_nodes; q!=NULL; q=q->next) {
+        liquid_profile_node_stats(q, &stats);
+        _callback(&stats, _userdata);
+    }
+    LIQUID_PROFILE_UNLOCK();
+    return LIQUID_OK;
+}
+
+int liquid_profile_foreach_type(liquid_profile_callback _callback,
+                                void *                  _userdata)
+{
+    liquid_profile_s stats;
+    LIQUID_PROFILE_LOCK();
+    liquid_profile_type t;
+    for (t=liquid_profile_types; t!=NULL; t=t->next) {
+        liquid_profile_type_stats(t, &stats);
+        _callback(&stats, _userdata);
+    }
+    LIQUID_PROFILE_UNLOCK();
+    return LIQUID_OK;
+}
+
+int liquid_profile_set_callback(liquid_profile_callback _callback,
+                                void *                  _userdata)
+{
+    LIQUID_PROFILE_LOCK();
+    liquid_profile_destroy_callback = _callback;
+    liquid_profile_destroy_userdata = _userdata;
+    LIQUID_PROFILE_UNLOCK();
+    return LIQUID_OK;
+}
+
+#else
+
+// profiling disabled: no objects are ever registered
+
+int liquid_profile_is_enabled(void)
+{
+    return 0;
+}
+
+int liquid_profile_reset(void)
+{
+    return LIQUID_OK;
+}
+
+int liquid_profile_get(const char *       _type,
+                       liquid_profile_s * _stats)
+{
+    return LIQUID_EIVAL;
+}
+
+int liquid_profile_foreach(liquid_profile_callback _callback,
+                           void *                  _userdata)
+{
+    return LIQUID_OK;
+}
+
+int liquid_profile_foreach_type(liquid_profile_callback _callback,
+                                void *                  _userdata)
+{
+    return LIQUID_OK;
+}
+
+int liquid_profile_set_callback(liquid_profile_callback _callback,
+                                void *                  _userdata)
+{
+    return LIQUID_OK;
+}
+
+#endif
+
+// JSON output state
+typedef struct {
+    FILE *       fid;
+    unsigned int n;     // number of records written
+} liquid_profile_json_s;
+
+// write single record as JSON
+static int liquid_profile_print_json_record(const liquid_profile_s * _stats,
+                                            void *                   _userdata)
+{
+    liquid_profile_json_s * q = (liquid_profile_json_s*) _userdata;
+    fprintf(q->fid,"%s    {\"type\":\"%s\", \"id\":%lu, \"instances\":%u, \"calls\":%llu, \"samples\":%llu, \"cycles\":%llu}",
+            q->n++ ? ",\n" : "",
+            _stats->type, _stats->id, _stats->num_instances,
+            _stats->num_calls, _stats->num_samples, _stats->num_cycles);
+    return LIQUID_OK;
+}
+
+int liquid_profile_print_json(FILE * _fid)
+{
+    if (_fid == NULL)
+        return liquid_error(LIQUID_EIO,"liquid_profile_print_json(), invalid file pointer");
+
+    liquid_profile_json_s q = {_fid, 0};
+    fprintf(_fid,"{\n");
+    fprintf(_fid,"  \"enabled\": %s,\n", liquid_profile_is_enabled() ? "true" : "false");
+#if LIQUID_PROFILE
+    fprintf(_fid,"  \"clock\": \"%s\",\n", LIQUID_PROFILE_CLOCK_STR);
+#endif
+    fprintf(_fid,"  \"types\": [\n");
+    liquid_profile_foreach_type(liquid_profile_print_json_record, &q);
+    fprintf(_fid, q.n ? "\n  ],\n" : "  ],\n");
+    q.n = 0;
+    fprintf(_fid,"  \"instances\": [\n");
+    liquid_profile_foreach(liquid_profile_print_json_record, &q);
+    fprintf(_fid, q.n ? "\n  ]\n" : "  ]\n");
+    fprintf(_fid,"}\n");
+    return LIQUID_OK;
+}
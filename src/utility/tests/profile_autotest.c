@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2007 - 2022 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+#include "autotest/autotest.h"
+#include "liquid.internal.h"
+
+// get totals for object type, zero if no instance has been created
+void profile_get(const char * _type, liquid_profile_s * _stats)
+{
+    if (liquid_profile_get(_type, _stats) != LIQUID_OK)
+        memset(_stats, 0, sizeof(liquid_profile_s));
+}
+
+// without profiling compiled in, no objects are ever registered
+void profile_test_disabled(const char * _type)
+{
+    liquid_profile_s stats;
+    CONTEND_EQUALITY(liquid_profile_get(_type, &stats), LIQUID_EIVAL);
+}
+
+// test counters for calls and samples, counting nested calls once
+void autotest_profile_firfilt()
+{
+    firfilt_crcf q = firfilt_crcf_create_kaiser(11, 0.2f, 60.0f, 0.0f);
+    if (!liquid_profile_is_enabled()) {
+        firfilt_crcf_destroy(q);
+        profile_test_disabled("firfilt_crcf");
+        return;
+    }
+    liquid_profile_s s0, s1;
+    profile_get("firfilt_crcf", &s0);
+
+    // run filter on block, then on single samples
+    float complex buf[100];
+    unsigned int i;
+    for (i=0; i<100; i++)
+        buf[i] = (float)i;
+    firfilt_crcf_execute_block(q, buf, 100, buf);
+    for (i=0; i<10; i++)
+        firfilt_crcf_execute_one(q, buf[i], &buf[i]);
+
+    profile_get("firfilt_crcf", &s1);
+    CONTEND_EQUALITY(s1.num_calls   - s0.num_calls,   11);
+    CONTEND_EQUALITY(s1.num_samples - s0.num_samples, 110);
+    CONTEND_GREATER_THAN(s1.num_cycles, s0.num_cycles);
+
+    // counters of destroyed instance are kept in type totals
+    firfilt_crcf_destroy(q);
+    profile_get("firfilt_crcf", &s0);
+    CONTEND_EQUALITY(s0.num_samples, s1.num_samples);
+    CONTEND_EQUALITY(s0.num_instances, s1.num_instances);
+}
+
+// sub-transforms of a plan are not registered separately
+void autotest_profile_fftplan()
+{
+    liquid_profile_s s0, s1;
+    profile_get("fftplan", &s0);
+
+    // mixed-radix transform with sub-transforms
+    float complex x[30], y[30];
+    memset(x, 0, sizeof(x));
+    fftplan q = fft_create_plan(30, x, y, LIQUID_FFT_FORWARD, 0);
+    unsigned int i;
+    for (i=0; i<3; i++)
+        fft_execute(q);
+    fft_destroy_plan(q);
+
+    if (!liquid_profile_is_enabled()) {
+        profile_test_disabled("fftplan");
+        return;
+    }
+    profile_get("fftplan", &s1);
+    CONTEND_EQUALITY(s1.num_instances - s0.num_instances, 1);
+    CONTEND_EQUALITY(s1.num_calls     - s0.num_calls,     3);
+    CONTEND_EQUALITY(s1.num_samples   - s0.num_samples,   90);
+}
+
+// callback for exporting statistics of destroyed objects
+int profile_test_callback(const liquid_profile_s * _stats, void * _userdata)
+{
+    liquid_profile_s * s = (liquid_profile_s*) _userdata;
+    if (strcmp(_stats->type, "resamp_crcf") == 0)
+        memmove(s, _stats, sizeof(liquid_profile_s));
+    return LIQUID_OK;
+}
+
+// test callback with final statistics when object is destroyed, and
+// enumeration of live instances
+void autotest_profile_callback()
+{
+    liquid_profile_s s = {NULL, 0, 0, 0, 0, 0};
+    liquid_profile_set_callback(profile_test_callback, &s);
+
+    resamp_crcf q = resamp_crcf_create_default(1.5f);
+    float complex x[40], y[80];
+    memset(x, 0, sizeof(x));
+    unsigned int ny;
+    resamp_crcf_execute_block(q, x, 40, y, &ny);
+
+    // live instance is enumerated
+    liquid_profile_s e = {NULL, 0, 0, 0, 0, 0};
+    liquid_profile_foreach(profile_test_callback, &e);
+    resamp_crcf_destroy(q);
+    liquid_profile_set_callback(NULL, NULL);
+
+    if (!liquid_profile_is_enabled()) {
+        CONTEND_TRUE(s.type == NULL);
+        CONTEND_TRUE(e.type == NULL);
+        return;
+    }
+    CONTEND_TRUE(s.type != NULL);
+    CONTEND_EQUALITY(s.num_calls,   1);
+    CONTEND_EQUALITY(s.num_samples, 40);
+    CONTEND_EQUALITY(e.id, s.id);
+    CONTEND_EQUALITY(e.num_samples, 40);
+}
+
+// test JSON output
+void autotest_profile_json()
+{
+    firfilt_crcf q = firfilt_crcf_create_kaiser(7, 0.2f, 60.0f, 0.0f);
+    float complex y;
+    firfilt_crcf_execute_one(q, 1.0f, &y);
+
+    FILE * fid = tmpfile();
+    CONTEND_EQUALITY(liquid_profile_print_json(fid), LIQUID_OK);
+    firfilt_crcf_destroy(q);
+
+    // read back
+    char buf[4096];
+    rewind(fid);
+    size_t n = fread(buf, 1, sizeof(buf)-1, fid);
+    buf[n] = '\0';
+    fclose(fid);
+    CONTEND_TRUE(strstr(buf, "\"types\"") != NULL);
+    CONTEND_TRUE(strstr(buf, "\"instances\"") != NULL);
+    if (liquid_profile_is_enabled())
+        CONTEND_TRUE(strstr(buf, "\"type\":\"firfilt_crcf\"") != NULL);
+}
+
@@ -38,33 +38,26 @@ void VECTOR(_cexpj)(TP *         _theta,
                     unsigned int _n,
                     T *          _x)
 {
+#if T_COMPLEX
+    // vectorized polynomial kernel
+    liquid_vcexpjf(_theta, _n, _x, LIQUID_VMATH_PRECISE);
+#else
     // t = 4*(floor(_n/4))
     unsigned int t=(_n>>2)<<2; 
 
     // compute in groups of 4
     unsigned int i;
     for (i=0; i<t; i+=4) {
-#if T_COMPLEX
-        _x[i  ] = cexpf(_Complex_I*_theta[i  ]);
-        _x[i+1] = cexpf(_Complex_I*_theta[i+1]);
-        _x[i+2] = cexpf(_Complex_I*_theta[i+2]);
-        _x[i+3] = cexpf(_Complex_I*_theta[i+3]);
-#else
         _x[i  ] = _theta[i  ] > 0 ? 1.0 : -1.0;
         _x[i+1] = _theta[i+1] > 0 ? 1.0 : -1.0;
         _x[i+2] = _theta[i+2] > 0 ? 1.0 : -1.0;
         _x[i+3] = _theta[i+3] > 0 ? 1.0 : -1.0;
-#endif
     }
 
     // clean up remaining
-    for ( ; i<_n; i++) {
-#if T_COMPLEX
-        _x[i] = cexpf(_Complex_I*_theta[i]);
-#else
+    for ( ; i<_n; i++)
         _x[i] = _theta[i] > 0 ? 1.0 : -1.0;
 #endif
-    }
 }
 
 // compute complex phase rotation: x[i] = exp{ j theta[i] }
@@ -75,33 +68,27 @@ void VECTOR(_carg)(T *          _x,
                    unsigned int _n,
                    TP *         _theta)
 {
+#if T_COMPLEX
+    // vectorized polynomial kernel on interleaved (real, imaginary) values
+    const TP * x = (const TP *) _x;
+    liquid_vatan2f_strided(x+1, x, 2, _n, _theta, LIQUID_VMATH_PRECISE);
+#else
     // t = 4*(floor(_n/4))
     unsigned int t=(_n>>2)<<2; 
 
     // compute in groups of 4
     unsigned int i;
     for (i=0; i<t; i+=4) {
-#if T_COMPLEX
-        _theta[i  ] = cargf(_x[i  ]);
-        _theta[i+1] = cargf(_x[i+1]);
-        _theta[i+2] = cargf(_x[i+2]);
-        _theta[i+3] = cargf(_x[i+3]);
-#else
         _theta[i  ] = _x[i  ] > 0 ? 0 : M_PI;
         _theta[i+1] = _x[i+1] > 0 ? 0 : M_PI;
         _theta[i+2] = _x[i+2] > 0 ? 0 : M_PI;
         _theta[i+3] = _x[i+3] > 0 ? 0 : M_PI;
-#endif
     }
 
     // clean up remaining
-    for ( ; i<_n; i++) {
-#if T_COMPLEX
-        _theta[i] = cargf(_x[i]);
-#else
+    for ( ; i<_n; i++)
         _theta[i] = _x[i] > 0 ? 0 : M_PI;
 #endif
-    }
 }
 
 // compute absolute value of each element: y[i] = |x[i]|